@@ -25,6 +25,11 @@ ExpressionBenchmarkSet& ExpressionBenchmarkSet::addExpression(
     const std::string& expression) {
   expressions_.push_back(
       std::make_pair(name, builder_.compileExpression(expression, inputType_)));
+  if (compareFusion_) {
+    expressions_.push_back(std::make_pair(
+        name + "_fused",
+        builder_.compileFusedExpression(expression, inputType_)));
+  }
   return *this;
 }
 
@@ -36,6 +41,15 @@ ExpressionBenchmarkSet& ExpressionBenchmarkSet::addExpressions(
   return *this;
 }
 
+exec::ExprSet ExpressionBenchmarkBuilder::compileFusedExpression(
+    const std::string& expression,
+    const TypePtr& rowType) {
+  auto untyped = parse::parseExpr(expression, options_);
+  auto typed =
+      core::Expressions::inferTypes(untyped, rowType, fusedExecCtx_.pool());
+  return exec::ExprSet({typed}, &fusedExecCtx_);
+}
+
 // Make sure all input vectors are generated.
 void ExpressionBenchmarkBuilder::ensureInputVectors() {
   for (auto& [_, benchmarkSet] : benchmarkSets_) {
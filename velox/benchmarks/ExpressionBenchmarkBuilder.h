@@ -58,6 +58,14 @@ class ExpressionBenchmarkSet {
     return *this;
   }
 
+  // Also benchmarks the expressions added after this call with fused
+  // evaluation of their arithmetic, comparison and conjunct trees. The fused
+  // variant of expression 'name' is named 'name_fused'.
+  ExpressionBenchmarkSet& compareFusion() {
+    compareFusion_ = true;
+    return *this;
+  }
+
  private:
   ExpressionBenchmarkSet(
       ExpressionBenchmarkBuilder& builder,
@@ -92,6 +100,8 @@ class ExpressionBenchmarkSet {
 
   bool disableTesting_ = false;
 
+  bool compareFusion_ = false;
+
   // The builder that this expression set belongs to.
   ExpressionBenchmarkBuilder& builder_;
   friend class ExpressionBenchmarkBuilder;
@@ -115,6 +125,11 @@ class ExpressionBenchmarkBuilder
     return vectorMaker_;
   }
 
+  // Compiles 'expression' with QueryConfig::kExprFusionEnabled set.
+  exec::ExprSet compileFusedExpression(
+      const std::string& expression,
+      const TypePtr& rowType);
+
   ExpressionBenchmarkSet& addBenchmarkSet(
       const std::string& name,
       const RowVectorPtr& inputRowVector) {
@@ -135,5 +150,10 @@ class ExpressionBenchmarkBuilder
   void ensureInputVectors();
 
   std::map<std::string, ExpressionBenchmarkSet> benchmarkSets_;
+
+  std::shared_ptr<core::QueryCtx> fusedQueryCtx_{core::QueryCtx::create(
+      nullptr,
+      core::QueryConfig({{core::QueryConfig::kExprFusionEnabled, "true"}}))};
+  core::ExecCtx fusedExecCtx_{pool_.get(), fusedQueryCtx_.get()};
 };
 } // namespace facebook::velox
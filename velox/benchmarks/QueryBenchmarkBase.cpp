@@ -91,6 +91,23 @@ DEFINE_int32(
 
 DEFINE_int32(split_preload_per_driver, 2, "Prefetch split metadata");
 
+DEFINE_string(
+    stats_json_path,
+    "",
+    "Path of a JSON file to write the execution time and per operator stats "
+    "of the queries run with statistics to");
+DEFINE_string(
+    baseline_stats_json_path,
+    "",
+    "Path of a JSON file written with --stats_json_path by an earlier build. "
+    "The queries and operators that take more CPU time than there by over "
+    "--regression_threshold_pct are reported and the benchmark fails");
+DEFINE_double(
+    regression_threshold_pct,
+    10,
+    "CPU time increase in percent over --baseline_stats_json_path that is "
+    "reported as a regression");
+
 using namespace facebook::velox::exec;
 using namespace facebook::velox::exec::test;
 using namespace facebook::velox::dwio::common;
@@ -372,6 +389,106 @@ void QueryBenchmarkBase::runOne(std::ostream& out, RunStats& stats) {
   out << result.str();
 }
 
+void QueryBenchmarkBase::recordQueryStats(
+    const std::string& name,
+    const exec::TaskStats& stats) {
+  auto operators = exec::toPlanStatsJson(stats);
+  int64_t cpuNanos{0};
+  for (const auto& op : operators) {
+    cpuNanos += op["cpuNanos"].asInt();
+  }
+  folly::dynamic query = folly::dynamic::object;
+  query["query"] = name;
+  query["executionMillis"] =
+      stats.executionEndTimeMs - stats.executionStartTimeMs;
+  query["cpuNanos"] = cpuNanos;
+  query["operators"] = std::move(operators);
+  queryStats_.push_back(std::move(query));
+}
+
+int32_t QueryBenchmarkBase::writeAndCompareStats(std::ostream& out) {
+  if (!FLAGS_stats_json_path.empty()) {
+    std::ofstream file(FLAGS_stats_json_path);
+    file << folly::toPrettyJson(queryStats_) << std::endl;
+    VELOX_CHECK(file.good(), "Failed to write {}", FLAGS_stats_json_path);
+  }
+  if (FLAGS_baseline_stats_json_path.empty()) {
+    return 0;
+  }
+  std::ifstream file(FLAGS_baseline_stats_json_path);
+  VELOX_CHECK(file.good(), "Failed to read {}", FLAGS_baseline_stats_json_path);
+  const std::string baseline(
+      (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  return compareStats(
+      folly::parseJson(baseline),
+      queryStats_,
+      FLAGS_regression_threshold_pct,
+      out);
+}
+
+// static
+int32_t QueryBenchmarkBase::compareStats(
+    const folly::dynamic& baseline,
+    const folly::dynamic& current,
+    double thresholdPct,
+    std::ostream& out) {
+  // Differences in shorter CPU times are noise.
+  constexpr int64_t kMinCpuNanos = 10'000'000;
+  int32_t numRegressions{0};
+  auto check = [&](const std::string& name,
+                   int64_t baselineNanos,
+                   int64_t currentNanos) {
+    if (baselineNanos < kMinCpuNanos ||
+        currentNanos <= baselineNanos * (1 + thresholdPct / 100)) {
+      return;
+    }
+    ++numRegressions;
+    out << fmt::format(
+               "Regression: {} CPU time {} -> {} (+{:.1f}%)",
+               name,
+               succinctNanos(baselineNanos),
+               succinctNanos(currentNanos),
+               100.0 * (currentNanos - baselineNanos) / baselineNanos)
+        << std::endl;
+  };
+
+  std::unordered_map<std::string, const folly::dynamic*> baselineQueries;
+  for (const auto& query : baseline) {
+    baselineQueries[query["query"].asString()] = &query;
+  }
+  for (const auto& query : current) {
+    const auto name = query["query"].asString();
+    auto it = baselineQueries.find(name);
+    if (it == baselineQueries.end()) {
+      continue;
+    }
+    const auto& baselineQuery = *it->second;
+    check(name, baselineQuery["cpuNanos"].asInt(), query["cpuNanos"].asInt());
+
+    // The plan node ids of a query are the same in both builds.
+    auto opName = [](const folly::dynamic& op) {
+      return fmt::format(
+          "{} {}", op["planNodeId"].asString(), op["operatorType"].asString());
+    };
+    std::unordered_map<std::string, int64_t> baselineOperators;
+    for (const auto& op : baselineQuery["operators"]) {
+      baselineOperators[opName(op)] = op["cpuNanos"].asInt();
+    }
+    for (const auto& op : query["operators"]) {
+      auto opIt = baselineOperators.find(opName(op));
+      if (opIt != baselineOperators.end()) {
+        check(
+            fmt::format("{} node {}", name, opIt->first),
+            opIt->second,
+            op["cpuNanos"].asInt());
+      }
+    }
+  }
+  out << fmt::format("{} regressions over {}%", numRegressions, thresholdPct)
+      << std::endl;
+  return numRegressions;
+}
+
 void QueryBenchmarkBase::runAllCombinations() {
   readCombinations();
   runCombinations(0);
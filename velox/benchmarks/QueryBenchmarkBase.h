@@ -21,6 +21,7 @@
 #include <sys/time.h>
 
 #include <folly/Benchmark.h>
+#include <folly/json.h>
 #include <folly/init/Init.h>
 #include <gflags/gflags.h>
 #include <sys/stat.h>
@@ -115,6 +116,24 @@ class QueryBenchmarkBase {
 
   void runAllCombinations();
 
+  /// Records the execution time and per operator stats of the query 'name'
+  /// for --stats_json_path.
+  void recordQueryStats(const std::string& name, const exec::TaskStats& stats);
+
+  /// Writes the stats recorded by recordQueryStats() to --stats_json_path and
+  /// compares them with those in --baseline_stats_json_path. Returns the
+  /// number of regressions.
+  int32_t writeAndCompareStats(std::ostream& out);
+
+  /// Prints the queries and operators of 'current' whose CPU time is more
+  /// than 'thresholdPct' percent over that in 'baseline'. Both are arrays
+  /// made by recordQueryStats(). Returns the number printed.
+  static int32_t compareStats(
+      const folly::dynamic& baseline,
+      const folly::dynamic& current,
+      double thresholdPct,
+      std::ostream& out);
+
  protected:
   std::unique_ptr<folly::IOThreadPoolExecutor> ioExecutor_;
   std::unique_ptr<folly::IOThreadPoolExecutor> cacheExecutor_;
@@ -125,5 +144,8 @@ class QueryBenchmarkBase {
   std::vector<ParameterDim> parameters_;
 
   std::vector<RunStats> runStats_;
+
+  // The stats recorded by recordQueryStats().
+  folly::dynamic queryStats_ = folly::dynamic::array;
 };
 } // namespace facebook::velox
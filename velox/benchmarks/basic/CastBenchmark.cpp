@@ -149,6 +149,34 @@ int main(int argc, char** argv) {
           "try_cast_invalid_infinity", "try_cast (invalid_infinity as double)")
       .addExpression("try_cast_space", "try_cast (space as double)");
 
+  // Digit strings are cast in bulk, the others, e.g. with a '+' or spaces,
+  // one by one.
+  auto shortDigitsInput = vectorMaker.flatVector<std::string>(
+      vectorSize, [](auto row) { return std::to_string(row * 7919); });
+  auto longDigitsInput = vectorMaker.flatVector<std::string>(
+      vectorSize, [](auto row) {
+        return std::to_string(-1'234'567'890'123'456 - row * 7919);
+      });
+  auto irregularDigitsInput = vectorMaker.flatVector<std::string>(
+      vectorSize, [](auto row) { return fmt::format(" +{} ", row * 7919); });
+  auto shortDecimalStringInput = vectorMaker.flatVector<std::string>(
+      vectorSize, [](auto row) { return fmt::format("{}.25", row * 7919); });
+  benchmarkBuilder
+      .addBenchmarkSet(
+          "cast_varchar_as_number",
+          vectorMaker.rowVector(
+              {"short_digits", "long_digits", "irregular", "short_decimal"},
+              {shortDigitsInput,
+               longDigitsInput,
+               irregularDigitsInput,
+               shortDecimalStringInput}))
+      .addExpression("cast_short_as_int", "cast (short_digits as int)")
+      .addExpression("cast_short_as_bigint", "cast (short_digits as bigint)")
+      .addExpression("cast_long_as_bigint", "cast (long_digits as bigint)")
+      .addExpression("cast_irregular_as_bigint", "cast (irregular as bigint)")
+      .addExpression("cast_short_as_double", "cast (short_decimal as double)")
+      .addExpression("cast_irregular_as_double", "cast (irregular as double)");
+
   benchmarkBuilder
       .addBenchmarkSet(
           "cast",
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+
+#include "velox/benchmarks/ExpressionBenchmarkBuilder.h"
+#include "velox/functions/prestosql/registration/RegistrationFunctions.h"
+
+using namespace facebook;
+using namespace facebook::velox;
+
+// Compares the interpreted and the fused evaluation of arithmetic and
+// comparison trees.
+int main(int argc, char** argv) {
+  folly::Init init(&argc, &argv);
+  memory::MemoryManager::initialize({});
+  functions::prestosql::registerAllScalarFunctions();
+
+  ExpressionBenchmarkBuilder benchmarkBuilder;
+  const vector_size_t vectorSize = 10'000;
+  auto vectorMaker = benchmarkBuilder.vectorMaker();
+
+  auto makeBigint = [&](int32_t modulus) {
+    return vectorMaker.flatVector<int64_t>(
+        vectorSize, [&](auto row) { return row % modulus; });
+  };
+  auto makeDouble = [&](double scale) {
+    return vectorMaker.flatVector<double>(
+        vectorSize, [&](auto row) { return row * scale; });
+  };
+
+  auto bigints = vectorMaker.rowVector(
+      {"a", "b", "c", "d", "e"},
+      {makeBigint(7), makeBigint(11), makeBigint(13), makeBigint(17),
+       makeBigint(100)});
+  auto doubles = vectorMaker.rowVector(
+      {"a", "b", "c"}, {makeDouble(0.1), makeDouble(0.01), makeDouble(0.001)});
+
+  // Each set has the interpreted and the fused variant of one expression.
+  auto addSet = [&](const std::string& name,
+                    const RowVectorPtr& input,
+                    const std::string& expression) {
+    benchmarkBuilder.addBenchmarkSet(name, input)
+        .compareFusion()
+        .addExpression(name, expression);
+  };
+  addSet("bigint_plus", bigints, "a * b + c * d");
+  addSet("bigint_compare", bigints, "a * b + c * d > e");
+  addSet("bigint_conjunct", bigints, "a * b + c * d > e AND a < c OR b = d");
+  addSet("double_plus", doubles, "a * 2.0 + b * c");
+  addSet("double_compare", doubles, "a * 2.0 + b * c < 100.0 AND b > c");
+
+  benchmarkBuilder.registerBenchmarks();
+  benchmarkBuilder.testBenchmarks();
+  folly::runBenchmarks();
+  return 0;
+}
@@ -70,6 +70,13 @@ class SelectivityVectorBenchmark
       }
     }
 
+    nulls_.resize(bits::nwords(vectorSize_), bits::kNotNull64);
+    for (size_t i = 0; i < vectorSize_; ++i) {
+      if (fuzzer.coinToss(0.1)) {
+        bits::setNull(nulls_.data(), i);
+      }
+    }
+
     rowsAll_.updateBounds();
     rows99PerCent_.updateBounds();
     rows50PerCent_.updateBounds();
@@ -108,6 +115,38 @@ class SelectivityVectorBenchmark
     return run(rows99PerCent_);
   }
 
+  // Intersects a copy of all rows with 'rows' and counts the result, as
+  // done when combining filter results.
+  size_t runIntersect(const SelectivityVector& rows) {
+    SelectivityVector result(vectorSize_);
+    result.intersect(rows);
+    folly::doNotOptimizeAway(result.countSelected());
+    return vectorSize_;
+  }
+
+  // Deselects the nulls of a vector with 10% nulls from 'rows'.
+  size_t runDeselectNulls(const SelectivityVector& rows) {
+    SelectivityVector result(rows);
+    result.deselectNulls(nulls_.data(), 0, vectorSize_);
+    folly::doNotOptimizeAway(result.countSelected());
+    return vectorSize_;
+  }
+
+  const SelectivityVector& rows(int32_t percent) const {
+    switch (percent) {
+      case 100:
+        return rowsAll_;
+      case 99:
+        return rows99PerCent_;
+      case 50:
+        return rows50PerCent_;
+      case 10:
+        return rows10PerCent_;
+      default:
+        return rows1PerCent_;
+    }
+  }
+
  private:
   size_t run(const SelectivityVector& rows) {
     const int64_t* flatBuffer = flatVector_->values()->as<int64_t>();
@@ -126,6 +165,7 @@ class SelectivityVectorBenchmark
   SelectivityVector rows50PerCent_;
   SelectivityVector rows10PerCent_;
   SelectivityVector rows1PerCent_;
+  std::vector<uint64_t> nulls_;
 };
 
 std::unique_ptr<SelectivityVectorBenchmark> benchmark;
@@ -161,6 +201,32 @@ BENCHMARK(sumSelectivity1PerCent) {
   run([] { benchmark->runSelectivity1PerCent(); });
 }
 
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK(intersectAll) {
+  run([] { benchmark->runIntersect(benchmark->rows(100)); });
+}
+
+BENCHMARK(intersect50PerCent) {
+  run([] { benchmark->runIntersect(benchmark->rows(50)); });
+}
+
+BENCHMARK(intersect1PerCent) {
+  run([] { benchmark->runIntersect(benchmark->rows(1)); });
+}
+
+BENCHMARK(deselectNullsAll) {
+  run([] { benchmark->runDeselectNulls(benchmark->rows(100)); });
+}
+
+BENCHMARK(deselectNulls50PerCent) {
+  run([] { benchmark->runDeselectNulls(benchmark->rows(50)); });
+}
+
+BENCHMARK(deselectNulls1PerCent) {
+  run([] { benchmark->runDeselectNulls(benchmark->rows(1)); });
+}
+
 } // namespace
 
 int main(int argc, char* argv[]) {
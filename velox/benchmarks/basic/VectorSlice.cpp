@@ -18,6 +18,7 @@
 #include <folly/init/Init.h>
 
 #include <gflags/gflags.h>
+#include <numeric>
 
 #include "velox/vector/fuzzer/VectorFuzzer.h"
 
@@ -48,6 +49,9 @@ struct BenchmarkData {
     arrayVector = fuzzer.fuzzFlat(ARRAY(BIGINT()));
     mapVector = fuzzer.fuzzFlat(MAP(BIGINT(), BIGINT()));
     rowVector = fuzzer.fuzzFlat(ROW({BIGINT(), BIGINT(), BIGINT()}));
+    nestedVector = fuzzer.fuzzFlat(
+        ROW({ARRAY(ROW({BIGINT(), VARCHAR()})),
+             MAP(VARCHAR(), ARRAY(BIGINT()))}));
   }
 
   ~BenchmarkData() {
@@ -55,12 +59,14 @@ struct BenchmarkData {
     arrayVector.reset();
     mapVector.reset();
     rowVector.reset();
+    nestedVector.reset();
   }
 
   VectorPtr flatVector;
   VectorPtr arrayVector;
   VectorPtr mapVector;
   VectorPtr rowVector;
+  VectorPtr nestedVector;
 
  private:
   std::shared_ptr<memory::MemoryPool> pool_;
@@ -90,6 +96,22 @@ int runCopy(const BaseVector& vec) {
   return count;
 }
 
+// Wraps the rows of each slice in a dictionary, as operators do for a subset
+// of their input.
+int runDictionary(const VectorPtr& vec) {
+  int count = 0;
+  for (int i = 0; i + FLAGS_slice_size < vec->size(); i += FLAGS_slice_size) {
+    auto indices = allocateIndices(FLAGS_slice_size, vec->pool());
+    auto* rawIndices = indices->asMutable<vector_size_t>();
+    std::iota(rawIndices, rawIndices + FLAGS_slice_size, i);
+    auto wrapped =
+        BaseVector::wrapInDictionary(nullptr, indices, FLAGS_slice_size, vec);
+    folly::doNotOptimizeAway(wrapped);
+    ++count;
+  }
+  return count;
+}
+
 #define DEFINE_BENCHMARKS(name)                    \
   BENCHMARK_MULTI(name##Slice) {                   \
     return runSlice(*data->name##Vector, 0);       \
@@ -97,6 +119,9 @@ int runCopy(const BaseVector& vec) {
   BENCHMARK_RELATIVE_MULTI(name##SliceUnaligned) { \
     return runSlice(*data->name##Vector, 1);       \
   }                                                \
+  BENCHMARK_RELATIVE_MULTI(name##Dictionary) {     \
+    return runDictionary(data->name##Vector);      \
+  }                                                \
   BENCHMARK_RELATIVE_MULTI(name##Copy) {           \
     return runCopy(*data->name##Vector);           \
   }
@@ -105,6 +130,7 @@ DEFINE_BENCHMARKS(flat)
 DEFINE_BENCHMARKS(array)
 DEFINE_BENCHMARKS(map)
 DEFINE_BENCHMARKS(row)
+DEFINE_BENCHMARKS(nested)
 
 } // namespace
 } // namespace facebook::velox
@@ -50,6 +50,12 @@ DEFINE_int32(
     run_query_verbose,
     -1,
     "Run a given query and print execution statistics");
+DEFINE_bool(
+    run_all_queries,
+    false,
+    "Run all queries one after another and print execution statistics for "
+    "each. Use with --stats_json_path and --baseline_stats_json_path to "
+    "compare builds");
 DEFINE_int32(
     io_meter_column_pct,
     0,
@@ -62,46 +68,74 @@ std::shared_ptr<TpchQueryBuilder> queryBuilder;
 class TpchBenchmark : public QueryBenchmarkBase {
  public:
   void runMain(std::ostream& out, RunStats& runStats) override {
-    if (FLAGS_run_query_verbose == -1 && FLAGS_io_meter_column_pct == 0) {
+    if (FLAGS_run_all_queries) {
+      for (auto query = 1; query <= 22; ++query) {
+        out << fmt::format("Q{}", query) << std::endl;
+        runQuery(
+            fmt::format("q{}", query),
+            queryBuilder->getQueryPlan(query),
+            out,
+            runStats);
+      }
+    } else if (
+        FLAGS_run_query_verbose == -1 && FLAGS_io_meter_column_pct == 0) {
       folly::runBenchmarks();
+    } else if (FLAGS_io_meter_column_pct > 0) {
+      runQuery(
+          "ioMeter",
+          queryBuilder->getIoMeterPlan(FLAGS_io_meter_column_pct),
+          out,
+          runStats);
     } else {
-      const auto queryPlan = FLAGS_io_meter_column_pct > 0
-          ? queryBuilder->getIoMeterPlan(FLAGS_io_meter_column_pct)
-          : queryBuilder->getQueryPlan(FLAGS_run_query_verbose);
-      auto [cursor, actualResults] = run(queryPlan);
-      if (!cursor) {
-        LOG(ERROR) << "Query terminated with error. Exiting";
-        exit(1);
-      }
-      auto task = cursor->task();
-      ensureTaskCompletion(task.get());
-      if (FLAGS_include_results) {
-        printResults(actualResults, out);
-        out << std::endl;
-      }
-      const auto stats = task->taskStats();
-      int64_t rawInputBytes = 0;
-      for (auto& pipeline : stats.pipelineStats) {
-        auto& first = pipeline.operatorStats[0];
-        if (first.operatorType == "TableScan") {
-          rawInputBytes += first.rawInputBytes;
-        }
+      runQuery(
+          fmt::format("q{}", FLAGS_run_query_verbose),
+          queryBuilder->getQueryPlan(FLAGS_run_query_verbose),
+          out,
+          runStats);
+    }
+  }
+
+ private:
+  // Runs 'queryPlan' and prints its execution statistics to 'out'.
+  void runQuery(
+      const std::string& name,
+      const TpchPlan& queryPlan,
+      std::ostream& out,
+      RunStats& runStats) {
+    auto [cursor, actualResults] = run(queryPlan);
+    if (!cursor) {
+      LOG(ERROR) << "Query terminated with error. Exiting";
+      exit(1);
+    }
+    auto task = cursor->task();
+    ensureTaskCompletion(task.get());
+    if (FLAGS_include_results) {
+      printResults(actualResults, out);
+      out << std::endl;
+    }
+    const auto stats = task->taskStats();
+    int64_t rawInputBytes = 0;
+    for (auto& pipeline : stats.pipelineStats) {
+      auto& first = pipeline.operatorStats[0];
+      if (first.operatorType == "TableScan") {
+        rawInputBytes += first.rawInputBytes;
       }
-      runStats.rawInputBytes = rawInputBytes;
-      out << fmt::format(
-                 "Execution time: {}",
-                 succinctMillis(
-                     stats.executionEndTimeMs - stats.executionStartTimeMs))
-          << std::endl;
-      out << fmt::format(
-                 "Splits total: {}, finished: {}",
-                 stats.numTotalSplits,
-                 stats.numFinishedSplits)
-          << std::endl;
-      out << printPlanWithStats(
-                 *queryPlan.plan, stats, FLAGS_include_custom_stats)
-          << std::endl;
     }
+    runStats.rawInputBytes += rawInputBytes;
+    recordQueryStats(name, stats);
+    out << fmt::format(
+               "Execution time: {}",
+               succinctMillis(
+                   stats.executionEndTimeMs - stats.executionStartTimeMs))
+        << std::endl;
+    out << fmt::format(
+               "Splits total: {}, finished: {}",
+               stats.numTotalSplits,
+               stats.numFinishedSplits)
+        << std::endl;
+    out << printPlanWithStats(
+               *queryPlan.plan, stats, FLAGS_include_custom_stats)
+        << std::endl;
   }
 };
 
@@ -228,7 +262,8 @@ int tpchBenchmarkMain() {
   } else {
     benchmark.runAllCombinations();
   }
+  const auto numRegressions = benchmark.writeAndCompareStats(std::cout);
   benchmark.shutdown();
   queryBuilder.reset();
-  return 0;
+  return numRegressions > 0 ? 1 : 0;
 }
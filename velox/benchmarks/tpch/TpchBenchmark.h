@@ -15,4 +15,5 @@
  */
 #pragma once
 
-void tpchBenchmarkMain();
+/// Returns non-zero if a regression over --baseline_stats_json_path is found.
+int tpchBenchmarkMain();
@@ -15,6 +15,8 @@
  */
 
 #include <deque>
+#include <optional>
+#include <thread>
 
 #include <folly/Benchmark.h>
 #include <folly/init/Init.h>
@@ -33,6 +35,10 @@ DEFINE_int64(
     memory_free_every_n_operations,
     5,
     "Specifies memory free for every N operations. If it is 5, then we free one of existing memory allocation for every 5 memory operations");
+DEFINE_int32(
+    memory_allocation_threads,
+    64,
+    "The number of threads allocating from one memory pool concurrently");
 
 using namespace facebook::velox;
 using namespace facebook::velox::memory;
@@ -191,6 +197,46 @@ size_t MemoryPoolAllocationBenchMark::runReallocate() {
   return FLAGS_memory_allocation_count;
 }
 
+// Allocates and frees small chunks from one thread-safe leaf pool on
+// 'FLAGS_memory_allocation_threads' threads to measure the contention on the
+// pool's reservation. If 'cacheBytes' is not zero, each thread allocates
+// through a ScopedReservationCache of 'cacheBytes'.
+size_t runConcurrentAllocate(int64_t cacheBytes) {
+  folly::BenchmarkSuspender suspender;
+  auto manager = std::make_shared<MemoryManager>(MemoryManagerOptions{});
+  auto pool = manager->addLeafPool("ConcurrentAllocationBenchMark");
+  std::vector<std::thread> threads;
+  threads.reserve(FLAGS_memory_allocation_threads);
+  suspender.dismiss();
+  for (int32_t i = 0; i < FLAGS_memory_allocation_threads; ++i) {
+    threads.emplace_back([&, i]() {
+      std::optional<ScopedReservationCache> cache;
+      if (cacheBytes > 0) {
+        cache.emplace(cacheBytes);
+      }
+      folly::Random::DefaultGenerator rng(FLAGS_allocation_size_seed + i);
+      std::vector<std::pair<void*, size_t>> allocations;
+      for (auto iter = 0; iter < FLAGS_memory_allocation_count; ++iter) {
+        if (iter % FLAGS_memory_free_every_n_operations == 0) {
+          for (const auto& [ptr, size] : allocations) {
+            pool->free(ptr, size);
+          }
+          allocations.clear();
+        }
+        const size_t size = 128 + folly::Random::rand32(3072 - 128 + 1, rng);
+        allocations.emplace_back(pool->allocate(size), size);
+      }
+      for (const auto& [ptr, size] : allocations) {
+        pool->free(ptr, size);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return FLAGS_memory_allocation_count * FLAGS_memory_allocation_threads;
+}
+
 // allocateBytes API.
 BENCHMARK_MULTI(StdAllocateSmallNoAlignment) {
   MemoryPoolAllocationBenchMark benchmark(Type::kStd, 16, 128, 3072);
@@ -432,6 +478,14 @@ BENCHMARK_RELATIVE_MULTI(MmapReallocateMix64) {
   MemoryPoolAllocationBenchMark benchmark(Type::kMmap, 64, 128, 32 << 20);
   return benchmark.runReallocate();
 }
+// Concurrent allocations from one pool.
+BENCHMARK_MULTI(ConcurrentAllocateSmall) {
+  return runConcurrentAllocate(0);
+}
+
+BENCHMARK_RELATIVE_MULTI(ConcurrentAllocateSmallReservationCache) {
+  return runConcurrentAllocate(1 << 20);
+}
 } // namespace
 
 int main(int argc, char* argv[]) {
@@ -146,6 +146,13 @@ class Buffer {
     return false;
   }
 
+  /// Returns true if simd::kPadding bytes past capacity() are addressable, so
+  /// that a full width SIMD load starting at any element below size() stays
+  /// within the allocation.
+  virtual bool hasSimdPadding() const {
+    return false;
+  }
+
   friend std::ostream& operator<<(std::ostream& os, const Buffer& buffer) {
     std::ios_base::fmtflags f(os.flags());
 
@@ -334,6 +341,10 @@ class AlignedBuffer : public Buffer {
     checkEndGuard();
   }
 
+  bool hasSimdPadding() const override {
+    return true;
+  }
+
   // It's almost like partial specialization, but we redirect all POD types to
   // the same non-templated class
   template <typename T>
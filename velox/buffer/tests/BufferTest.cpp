@@ -61,6 +61,7 @@ TEST_F(BufferTest, testAlignedBuffer) {
     BufferPtr buffer = AlignedBuffer::allocate<char>(size, pool_.get(), 'i');
     EXPECT_EQ(buffer->as<char>()[0], 'i');
     EXPECT_TRUE(buffer->isMutable());
+    EXPECT_TRUE(buffer->hasSimdPadding());
     EXPECT_EQ(buffer->size(), size);
     EXPECT_GE(buffer->capacity(), size);
     buffer->setSize(buffer->capacity());
@@ -321,6 +322,7 @@ TEST_F(BufferTest, testBufferView) {
     EXPECT_EQ(memcmp(data, other->as<uint8_t>(), strlen(data)), 0);
   }
   EXPECT_TRUE(buffer->unique());
+  EXPECT_FALSE(buffer->hasSimdPadding());
   buffer = nullptr;
   EXPECT_EQ(pin.pinCount, 0);
 }
@@ -178,6 +178,16 @@ void registerVeloxMetrics() {
   DEFINE_METRIC(
       kMetricMemoryCacheNumStaleEntries, facebook::velox::StatType::COUNT);
 
+  // Number of new AsyncDataCache entries that the admission filter admits as
+  // immediately evictable.
+  DEFINE_METRIC(
+      kMetricMemoryCacheNumAdmissionRejects, facebook::velox::StatType::COUNT);
+
+  // Number of AsyncDataCache entries picked for eviction that are kept to be
+  // written to SSD because they have been used often enough.
+  DEFINE_METRIC(
+      kMetricMemoryCacheNumSsdAdmissions, facebook::velox::StatType::COUNT);
+
   /// ================== SsdCache Counters ==================
 
   // Number of regions currently cached by SSD.
@@ -265,6 +275,10 @@ void registerVeloxMetrics() {
   DEFINE_METRIC(
       kMetricSsdCacheRecoveredEntries, facebook::velox::StatType::SUM);
 
+  // Bytes written to SSD cache per 100 bytes read from it, i.e. the write
+  // amplification against the hit rate.
+  DEFINE_METRIC(kMetricSsdCacheWriteToReadPct, facebook::velox::StatType::AVG);
+
   /// ================== Memory Arbitration Counters =================
 
   // The number of arbitration requests.
@@ -434,6 +448,45 @@ void registerVeloxMetrics() {
       99,
       100);
 
+  // The distribution of the total time a query waits for memory arbitration
+  // over its lifetime in range of [0, 600s] with 20 buckets. It is configured
+  // to report the latency at P50, P90, P99, and P100 percentiles.
+  DEFINE_HISTOGRAM_METRIC(
+      kMetricArbitratorQueryArbitrationWaitTimeMs,
+      30'000,
+      0,
+      600'000,
+      50,
+      90,
+      99,
+      100);
+
+  // The amount of capacity granted ahead of requests by predictive
+  // arbitration to query memory pools with growing memory usage.
+  DEFINE_METRIC(
+      kMetricArbitratorPredictiveGrowBytes, facebook::velox::StatType::SUM);
+
+  // The amount of memory reclaimed by early spilling of predictive arbitration
+  // from query memory pools expected to run out of capacity.
+  DEFINE_METRIC(
+      kMetricArbitratorPredictiveReclaimBytes, facebook::velox::StatType::SUM);
+
+  // Tracks the average of the forecast memory of the queries admitted by the
+  // memory admission controller in bytes.
+  DEFINE_METRIC(
+      kMetricMemoryAdmissionAdmittedBytes, facebook::velox::StatType::AVG);
+
+  // The number of queries queued by the memory admission controller because
+  // their forecast memory doesn't fit.
+  DEFINE_METRIC(
+      kMetricMemoryAdmissionQueuedCount, facebook::velox::StatType::COUNT);
+
+  // The distribution of the time a query waits in the memory admission queue
+  // in range of [0, 600s] with 20 buckets. It is configured to report the
+  // latency at P50, P90, P99, and P100 percentiles.
+  DEFINE_HISTOGRAM_METRIC(
+      kMetricMemoryAdmissionQueuedTimeMs, 30'000, 0, 600'000, 50, 90, 99, 100);
+
   // The distribution of the amount of time it takes to complete a single
   // arbitration operation in range of [0, 600s] with 20 buckets. It is
   // configured to report the latency at P50, P90, P99, and P100 percentiles.
@@ -553,6 +606,18 @@ void registerVeloxMetrics() {
   // The peak spilling memory usage in bytes.
   DEFINE_METRIC(kMetricSpillPeakMemoryBytes, facebook::velox::StatType::AVG);
 
+  // The number of spill writes in flight admitted by the spill IO scheduler.
+  DEFINE_METRIC(kMetricSpillIoInflightWrites, facebook::velox::StatType::AVG);
+
+  // The number of spill writes queued by the spill IO scheduler.
+  DEFINE_METRIC(kMetricSpillIoQueuedCount, facebook::velox::StatType::COUNT);
+
+  // The distribution of the time a spill write waits in the spill IO scheduler
+  // in range of [0, 60s] with 60 buckets. It is configured to report the
+  // latency at P50, P90, P99, and P100 percentiles.
+  DEFINE_HISTOGRAM_METRIC(
+      kMetricSpillIoWaitTimeMs, 1'000, 0, 60'000, 50, 90, 99, 100);
+
   /// ================== Exchange Counters =================
 
   // Tracks exchange http transaction create delay in range of [0, 30s] with
@@ -600,5 +665,21 @@ void registerVeloxMetrics() {
   // The number of times that storage IOs get throttled in a storage cluster.
   DEFINE_METRIC(
       kMetricStorageGlobalThrottled, facebook::velox::StatType::COUNT);
+
+  /// ================== Decompression Counters =================
+
+  // Number of bytes decompressed by hardware accelerators. Together with the
+  // time below gives the throughput of the accelerators.
+  DEFINE_METRIC(
+      kMetricHardwareDecompressedBytes, facebook::velox::StatType::SUM);
+
+  // Time in microseconds spent in hardware accelerated decompression.
+  DEFINE_METRIC(
+      kMetricHardwareDecompressTimeUs, facebook::velox::StatType::SUM);
+
+  // The number of chunks that a hardware accelerator failed to decompress and
+  // that were decompressed on the CPU instead.
+  DEFINE_METRIC(
+      kMetricHardwareDecompressFallbackCount, facebook::velox::StatType::COUNT);
 }
 } // namespace facebook::velox
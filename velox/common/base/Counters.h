@@ -108,6 +108,24 @@ constexpr folly::StringPiece kMetricArbitratorGlobalArbitrationWaitCount{
 constexpr folly::StringPiece kMetricArbitratorGlobalArbitrationWaitTimeMs{
     "velox.arbitrator_global_arbitration_wait_time_ms"};
 
+constexpr folly::StringPiece kMetricArbitratorQueryArbitrationWaitTimeMs{
+    "velox.arbitrator_query_arbitration_wait_time_ms"};
+
+constexpr folly::StringPiece kMetricArbitratorPredictiveGrowBytes{
+    "velox.arbitrator_predictive_grow_bytes"};
+
+constexpr folly::StringPiece kMetricArbitratorPredictiveReclaimBytes{
+    "velox.arbitrator_predictive_reclaim_bytes"};
+
+constexpr folly::StringPiece kMetricMemoryAdmissionAdmittedBytes{
+    "velox.memory_admission_admitted_bytes"};
+
+constexpr folly::StringPiece kMetricMemoryAdmissionQueuedCount{
+    "velox.memory_admission_queued_count"};
+
+constexpr folly::StringPiece kMetricMemoryAdmissionQueuedTimeMs{
+    "velox.memory_admission_queued_time_ms"};
+
 constexpr folly::StringPiece kMetricArbitratorAbortedCount{
     "velox.arbitrator_aborted_count"};
 
@@ -167,6 +185,15 @@ constexpr folly::StringPiece kMetricSpillMemoryBytes{
 constexpr folly::StringPiece kMetricSpillPeakMemoryBytes{
     "velox.spill_peak_memory_bytes"};
 
+constexpr folly::StringPiece kMetricSpillIoInflightWrites{
+    "velox.spill_io_inflight_writes"};
+
+constexpr folly::StringPiece kMetricSpillIoQueuedCount{
+    "velox.spill_io_queued_count"};
+
+constexpr folly::StringPiece kMetricSpillIoWaitTimeMs{
+    "velox.spill_io_wait_time_ms"};
+
 constexpr folly::StringPiece kMetricFileWriterEarlyFlushedRawBytes{
     "velox.file_writer_early_flushed_raw_bytes"};
 
@@ -253,6 +280,12 @@ constexpr folly::StringPiece kMetricMemoryCacheNumAgedOutEntries{
 constexpr folly::StringPiece kMetricMemoryCacheNumStaleEntries{
     "velox.memory_cache_num_stale_entries"};
 
+constexpr folly::StringPiece kMetricMemoryCacheNumAdmissionRejects{
+    "velox.memory_cache_num_admission_rejects"};
+
+constexpr folly::StringPiece kMetricMemoryCacheNumSsdAdmissions{
+    "velox.memory_cache_num_ssd_admissions"};
+
 constexpr folly::StringPiece kMetricSsdCacheCachedRegions{
     "velox.ssd_cache_cached_regions"};
 
@@ -328,6 +361,9 @@ constexpr folly::StringPiece kMetricSsdCacheRegionsEvicted{
 constexpr folly::StringPiece kMetricSsdCacheRecoveredEntries{
     "velox.ssd_cache_recovered_entries"};
 
+constexpr folly::StringPiece kMetricSsdCacheWriteToReadPct{
+    "velox.ssd_cache_write_to_read_pct"};
+
 constexpr folly::StringPiece kMetricExchangeTransactionCreateDelay{
     "velox.exchange.transaction_create_delay_ms"};
 
@@ -360,4 +396,13 @@ constexpr folly::StringPiece kMetricStorageGlobalThrottled{
 
 constexpr folly::StringPiece kMetricStorageNetworkThrottled{
     "velox.storage_network_throttled_count"};
+
+constexpr folly::StringPiece kMetricHardwareDecompressedBytes{
+    "velox.hardware_decompressed_bytes"};
+
+constexpr folly::StringPiece kMetricHardwareDecompressTimeUs{
+    "velox.hardware_decompress_time_us"};
+
+constexpr folly::StringPiece kMetricHardwareDecompressFallbackCount{
+    "velox.hardware_decompress_fallback_count"};
 } // namespace facebook::velox
@@ -84,6 +84,12 @@ void PeriodicStatsReporter::start() {
       "report_spill_stats",
       [this]() { reportSpillStats(); },
       options_.spillStatsIntervalMs);
+  if (options_.sampleOperators) {
+    addTask(
+        "sample_operators",
+        [this]() { options_.sampleOperators(); },
+        options_.operatorSampleIntervalMs);
+  }
 }
 
 void PeriodicStatsReporter::stop() {
@@ -171,6 +177,8 @@ void PeriodicStatsReporter::reportCacheStats() {
       kMetricMemoryCacheNumAgedOutEntries, deltaCacheStats.numAgedOut);
   REPORT_IF_NOT_ZERO(
       kMetricMemoryCacheSumEvictScore, deltaCacheStats.sumEvictScore);
+  REPORT_IF_NOT_ZERO(
+      kMetricMemoryCacheNumSsdAdmissions, deltaCacheStats.numSsdAdmissions);
 
   // SSD cache snapshot stats.
   if (cacheStats.ssdStats != nullptr) {
@@ -231,6 +239,11 @@ void PeriodicStatsReporter::reportCacheStats() {
         deltaSsdStats.readWithoutChecksumChecks);
     REPORT_IF_NOT_ZERO(
         kMetricSsdCacheRecoveredEntries, deltaSsdStats.entriesRecovered);
+    if (deltaSsdStats.bytesRead > 0) {
+      RECORD_METRIC_VALUE(
+          kMetricSsdCacheWriteToReadPct,
+          deltaSsdStats.bytesWritten * 100 / deltaSsdStats.bytesRead);
+    }
   }
 
   // TTL controler snapshot stats.
@@ -53,14 +53,21 @@ class PeriodicStatsReporter {
     const memory::MemoryPool* spillMemoryPool{nullptr};
     uint64_t spillStatsIntervalMs{60'000};
 
+    /// Takes a sample of the operators the running queries are in, e.g.
+    /// exec::OperatorSampler::sample(). Not run if empty.
+    std::function<void()> sampleOperators;
+    uint64_t operatorSampleIntervalMs{1'000};
+
     std::string toString() const {
       return fmt::format(
           "allocatorStatsIntervalMs:{}, cacheStatsIntervalMs:{}, "
-          "arbitratorStatsIntervalMs:{}, spillStatsIntervalMs:{}",
+          "arbitratorStatsIntervalMs:{}, spillStatsIntervalMs:{}, "
+          "operatorSampleIntervalMs:{}",
           allocatorStatsIntervalMs,
           cacheStatsIntervalMs,
           arbitratorStatsIntervalMs,
-          spillStatsIntervalMs);
+          spillStatsIntervalMs,
+          operatorSampleIntervalMs);
     }
   };
 
@@ -47,6 +47,23 @@ class SelectivityInfo {
     return numOut_;
   }
 
+  SelectivityInfo& operator+=(const SelectivityInfo& other) {
+    numIn_ += other.numIn_;
+    numOut_ += other.numOut_;
+    timeClocks_ += other.timeClocks_;
+    return *this;
+  }
+
+  /// Returns the stats collected since 'earlier', which must be a previous
+  /// value of 'this'.
+  SelectivityInfo operator-(const SelectivityInfo& earlier) const {
+    SelectivityInfo result;
+    result.numIn_ = numIn_ - earlier.numIn_;
+    result.numOut_ = numOut_ - earlier.numOut_;
+    result.timeClocks_ = timeClocks_ - earlier.timeClocks_;
+    return result;
+  }
+
  private:
   uint64_t numIn_ = 0;
   uint64_t numOut_ = 0;
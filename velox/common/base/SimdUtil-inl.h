@@ -1436,6 +1436,25 @@ inline bool memEqualUnsafe(const void* x, const void* y, int32_t size) {
   return true;
 }
 
+inline bool memEqual16(const void* x, const void* y) {
+#if XSIMD_WITH_SSE2
+  const auto left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x));
+  const auto right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y));
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(left, right)) == 0xffff;
+#elif XSIMD_WITH_NEON
+  const auto equal = vceqq_u64(
+      vld1q_u64(reinterpret_cast<const uint64_t*>(x)),
+      vld1q_u64(reinterpret_cast<const uint64_t*>(y)));
+  return vminvq_u32(vreinterpretq_u32_u64(equal)) == 0xffffffff;
+#else
+  uint64_t left[2];
+  uint64_t right[2];
+  std::memcpy(left, x, sizeof(left));
+  std::memcpy(right, y, sizeof(right));
+  return ((left[0] ^ right[0]) | (left[1] ^ right[1])) == 0;
+#endif
+}
+
 namespace detail {
 
 /// NOTE: SSE_4_2`s the performance of simdStrStr is a little slower than
@@ -497,6 +497,10 @@ xsimd::batch<T, A> reinterpretBatch(xsimd::batch<U, A>, const A& = {});
 template <typename A = xsimd::default_arch>
 inline bool memEqualUnsafe(const void* x, const void* y, int32_t size);
 
+// Returns true if the 16 bytes at 'x' and 'y' are equal. Compares both 8 byte
+// halves with one vector compare, e.g. for 128 bit normalized keys.
+inline bool memEqual16(const void* x, const void* y);
+
 FOLLY_ALWAYS_INLINE size_t
 simdStrstr(const char* s, size_t n, const char* needle, size_t k);
 
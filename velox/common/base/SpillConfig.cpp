@@ -35,7 +35,15 @@ SpillConfig::SpillConfig(
     uint64_t _writerFlushThresholdSize,
     const std::string& _compressionKind,
     std::optional<PrefixSortConfig> _prefixSortConfig,
-    const std::string& _fileCreateConfig)
+    const std::string& _fileCreateConfig,
+    bool _columnarFormat,
+    bool _asyncWrite,
+    uint64_t _partitionTargetSize,
+    bool _mergePrefixKeys,
+    bool _pageRouting,
+    const SpillIoShare& _ioShare,
+    bool _checksumEnabled,
+    bool _encryptionEnabled)
     : getSpillDirPathCb(std::move(_getSpillDirPathCb)),
       updateAndCheckSpillLimitCb(std::move(_updateAndCheckSpillLimitCb)),
       fileNamePrefix(std::move(_fileNamePrefix)),
@@ -54,7 +62,15 @@ SpillConfig::SpillConfig(
       writerFlushThresholdSize(_writerFlushThresholdSize),
       compressionKind(common::stringToCompressionKind(_compressionKind)),
       prefixSortConfig(_prefixSortConfig),
-      fileCreateConfig(_fileCreateConfig) {
+      fileCreateConfig(_fileCreateConfig),
+      columnarFormat(_columnarFormat),
+      asyncWrite(_asyncWrite),
+      partitionTargetSize(_partitionTargetSize),
+      mergePrefixKeys(_mergePrefixKeys),
+      pageRouting(_pageRouting),
+      ioShare(_ioShare),
+      checksumEnabled(_checksumEnabled),
+      encryptionEnabled(_encryptionEnabled) {
   VELOX_USER_CHECK_GE(
       spillableReservationGrowthPct,
       minSpillableReservationPct,
@@ -43,6 +43,13 @@ using GetSpillDirectoryPathCB = std::function<std::string_view()>;
 /// bytes exceed the set limit.
 using UpdateAndCheckSpillLimitCB = std::function<void(uint64_t)>;
 
+/// Identifies the query of the spill writes to SpillIoScheduler and its share
+/// of the spill IO bandwidth.
+struct SpillIoShare {
+  std::string queryId;
+  uint32_t weight{1};
+};
+
 /// Specifies the config for spilling.
 struct SpillConfig {
   SpillConfig() = default;
@@ -63,7 +70,15 @@ struct SpillConfig {
       uint64_t _writerFlushThresholdSize,
       const std::string& _compressionKind,
       std::optional<PrefixSortConfig> _prefixSortConfig = std::nullopt,
-      const std::string& _fileCreateConfig = {});
+      const std::string& _fileCreateConfig = {},
+      bool _columnarFormat = false,
+      bool _asyncWrite = false,
+      uint64_t _partitionTargetSize = 0,
+      bool _mergePrefixKeys = false,
+      bool _pageRouting = false,
+      const SpillIoShare& _ioShare = {},
+      bool _checksumEnabled = false,
+      bool _encryptionEnabled = false);
 
   /// Returns the spilling level with given 'startBitOffset' and
   /// 'numPartitionBits'.
@@ -148,5 +163,39 @@ struct SpillConfig {
 
   /// Custom options passed to velox::FileSystem to create spill WriteFile.
   std::string fileCreateConfig;
+
+  /// If true, spill files store each column of a batch as a separate chunk.
+  bool columnarFormat{false};
+
+  /// If true and 'executor' is set, spill file writes run on 'executor' and
+  /// overlap with the serialization of the next write buffer.
+  bool asyncWrite{false};
+
+  /// If not zero, the target size of a spill partition used to choose the
+  /// number of partition bits from a sample of the spilled rows. See
+  /// estimateSpillPartitionBits().
+  uint64_t partitionTargetSize{0};
+
+  /// If true, sorted spill files store the normalized prefix keys of the rows
+  /// for the merge of the spilled runs. The key layout follows
+  /// 'prefixSortConfig', or the default one if it is not set.
+  bool mergePrefixKeys{false};
+
+  /// If true, hash build spill files group the rows of each page by the
+  /// partition bits of the next spill level, so that a restored partition that
+  /// is spilled again routes the pages as is without deserializing them.
+  bool pageRouting{false};
+
+  /// The query and weight of the spill writes if they are scheduled by the
+  /// process-wide SpillIoScheduler.
+  SpillIoShare ioShare;
+
+  /// If true, each block written to a spill file carries a CRC32C checksum
+  /// which is verified on read.
+  bool checksumEnabled{false};
+
+  /// If true, the spill files are encrypted and authenticated with a random
+  /// in-memory key per file.
+  bool encryptionEnabled{false};
 };
 } // namespace facebook::velox::common
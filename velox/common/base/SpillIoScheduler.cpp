@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/base/SpillIoScheduler.h"
+
+#include <chrono>
+#include <thread>
+
+#include "velox/common/base/Counters.h"
+#include "velox/common/base/Exceptions.h"
+#include "velox/common/base/StatsReporter.h"
+
+namespace facebook::velox::common {
+namespace {
+uint64_t nowUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+} // namespace
+
+std::string SpillIoScheduler::Config::toString() const {
+  return fmt::format(
+      "maxInflightWrites:{}, maxBytesPerSec:{}",
+      maxInflightWrites,
+      maxBytesPerSec);
+}
+
+void SpillIoScheduler::init(const Config& config) {
+  std::unique_lock guard{instanceLock()};
+  auto& instance = instanceRef();
+  VELOX_CHECK_NULL(instance, "SpillIoScheduler has already been set");
+  instance = std::unique_ptr<SpillIoScheduler>(new SpillIoScheduler(config));
+}
+
+SpillIoScheduler* SpillIoScheduler::instance() {
+  std::shared_lock guard{instanceLock()};
+  return instanceRef().get();
+}
+
+SpillIoScheduler::SpillIoScheduler(const Config& config) : config_(config) {
+  VELOX_CHECK_GT(config_.maxInflightWrites, 0);
+  LOG(INFO) << "Spill IO scheduler config: " << config_.toString();
+}
+
+uint64_t SpillIoScheduler::accept(
+    const std::string& queryId,
+    uint32_t weight,
+    uint64_t bytes) {
+  VELOX_CHECK_GT(weight, 0);
+  ContinueFuture future;
+  uint64_t startTimeUs{0};
+  uint32_t numInflightWrites{0};
+  {
+    std::lock_guard<std::mutex> l(mu_);
+    auto& query = queries_[queryId];
+    const double startTag = std::max(virtualTime_, query.finishTag);
+    query.finishTag = startTag + static_cast<double>(bytes) / weight;
+    ++query.numWrites;
+    if (queue_.empty() && numInflightWrites_ < config_.maxInflightWrites) {
+      startTimeUs = admitLocked(startTag, bytes);
+    } else {
+      auto [promise, unblockFuture] = makeVeloxContinuePromiseContract();
+      queue_.emplace(
+          query.finishTag,
+          Request{bytes, startTag, &startTimeUs, std::move(promise)});
+      future = std::move(unblockFuture);
+    }
+    numInflightWrites = numInflightWrites_;
+  }
+
+  const auto acceptTimeUs = nowUs();
+  if (future.valid()) {
+    RECORD_METRIC_VALUE(kMetricSpillIoQueuedCount);
+    future.wait();
+  } else {
+    RECORD_METRIC_VALUE(kMetricSpillIoInflightWrites, numInflightWrites);
+  }
+  if (startTimeUs > nowUs()) {
+    std::this_thread::sleep_for(
+        std::chrono::microseconds(startTimeUs - nowUs()));
+  }
+  const auto waitTimeUs = nowUs() - acceptTimeUs;
+  RECORD_HISTOGRAM_METRIC_VALUE(kMetricSpillIoWaitTimeMs, waitTimeUs / 1'000);
+  return waitTimeUs;
+}
+
+void SpillIoScheduler::release(const std::string& queryId) {
+  uint32_t numInflightWrites{0};
+  {
+    std::lock_guard<std::mutex> l(mu_);
+    VELOX_CHECK_GT(numInflightWrites_, 0);
+    --numInflightWrites_;
+    auto it = queries_.find(queryId);
+    VELOX_CHECK(it != queries_.end(), "Unknown spill query {}", queryId);
+    if (--it->second.numWrites == 0) {
+      queries_.erase(it);
+    }
+    while (!queue_.empty() &&
+           numInflightWrites_ < config_.maxInflightWrites) {
+      auto& request = queue_.begin()->second;
+      *request.startTimeUs = admitLocked(request.startTag, request.bytes);
+      request.promise.setValue();
+      queue_.erase(queue_.begin());
+    }
+    numInflightWrites = numInflightWrites_;
+  }
+  RECORD_METRIC_VALUE(kMetricSpillIoInflightWrites, numInflightWrites);
+}
+
+uint64_t SpillIoScheduler::admitLocked(double startTag, uint64_t bytes) {
+  ++numInflightWrites_;
+  virtualTime_ = std::max(virtualTime_, startTag);
+  if (config_.maxBytesPerSec == 0) {
+    return 0;
+  }
+  const auto startTimeUs = std::max(nowUs(), nextWriteTimeUs_);
+  nextWriteTimeUs_ = startTimeUs + bytes * 1'000'000 / config_.maxBytesPerSec;
+  return startTimeUs;
+}
+
+SpillIoScheduler::Stats SpillIoScheduler::stats() const {
+  std::lock_guard<std::mutex> l(mu_);
+  Stats stats;
+  stats.numInflightWrites = numInflightWrites_;
+  stats.numQueuedWrites = queue_.size();
+  stats.numQueries = queries_.size();
+  return stats;
+}
+} // namespace facebook::velox::common
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <folly/SharedMutex.h>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include "velox/common/future/VeloxPromise.h"
+
+namespace facebook::velox::common {
+
+/// A process-wide scheduler of spill file writes which shares the spill IO
+/// bandwidth between the spilling queries. A write must be accepted by the
+/// scheduler before it starts and released after it finishes.
+///
+/// The scheduler limits the number of writes in flight and optionally paces
+/// them to a max bandwidth. When the in-flight limit is reached, the writes
+/// queue up and are admitted in weighted fair order: each write of a query is
+/// tagged with the virtual finish time of the query's writes so far plus its
+/// byte size divided by the query weight, and the write with the smallest tag
+/// goes first. A query with twice the weight of another gets twice the spill
+/// bandwidth while both of them are spilling, and a query that starts
+/// spilling doesn't wait behind the earlier writes of the other queries.
+class SpillIoScheduler {
+ public:
+  struct Config {
+    /// The max number of spill writes in flight across all the queries.
+    uint32_t maxInflightWrites{std::numeric_limits<uint32_t>::max()};
+    /// The max spill write bandwidth in bytes per second across all the
+    /// queries. 0 means no limit.
+    uint64_t maxBytesPerSec{0};
+
+    std::string toString() const;
+  };
+
+  struct Stats {
+    uint32_t numInflightWrites{0};
+    uint32_t numQueuedWrites{0};
+    /// The number of queries with writes in flight or queued.
+    uint32_t numQueries{0};
+  };
+
+  /// Sets up the process-wide scheduler. Spill writes are not scheduled until
+  /// it is called.
+  static void init(const Config& config);
+
+  /// Returns the process-wide scheduler or null if not set up.
+  static SpillIoScheduler* instance();
+
+  /// Blocks until a spill write of 'bytes' from query 'queryId' with 'weight'
+  /// is allowed to start. Returns the wait time in microseconds. The caller
+  /// must call release() once the write finishes.
+  uint64_t accept(const std::string& queryId, uint32_t weight, uint64_t bytes);
+
+  /// Invoked when a write of 'queryId' accepted by accept() finishes.
+  void release(const std::string& queryId);
+
+  Stats stats() const;
+
+  static void testingReset() {
+    std::unique_lock guard{instanceLock()};
+    instanceRef().reset();
+  }
+
+ private:
+  static folly::SharedMutex& instanceLock() {
+    static folly::SharedMutex mu;
+    return mu;
+  }
+
+  static std::unique_ptr<SpillIoScheduler>& instanceRef() {
+    static std::unique_ptr<SpillIoScheduler> instance;
+    return instance;
+  }
+
+  explicit SpillIoScheduler(const Config& config);
+
+  // Admits a write of 'bytes' with 'startTag'. Returns the time in
+  // microseconds at which the write may start given the bandwidth limit.
+  uint64_t admitLocked(double startTag, uint64_t bytes);
+
+  struct Request {
+    uint64_t bytes;
+    double startTag;
+    // Set by the releasing thread to the start time of the admitted write.
+    uint64_t* startTimeUs;
+    ContinuePromise promise;
+  };
+
+  struct QueryState {
+    // The virtual finish time of the last write of the query.
+    double finishTag{0};
+    // The number of writes of the query in flight or queued.
+    uint32_t numWrites{0};
+  };
+
+  const Config config_;
+
+  mutable std::mutex mu_;
+  // The virtual time which is the start tag of the last admitted write.
+  double virtualTime_{0};
+  uint32_t numInflightWrites_{0};
+  // The earliest start time in microseconds of the next write given the
+  // bandwidth limit.
+  uint64_t nextWriteTimeUs_{0};
+  // The queued writes ordered by their finish tags.
+  std::multimap<double, Request> queue_;
+  std::unordered_map<std::string, QueryState> queries_;
+};
+} // namespace facebook::velox::common
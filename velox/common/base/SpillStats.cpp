@@ -33,6 +33,16 @@ folly::Synchronized<SpillStats>& localSpillStats() {
   auto& spillStatsVector = allSpillStats();
   return spillStatsVector[idx % spillStatsVector.size()];
 }
+
+std::atomic_uint64_t& localSpillQuotaBytes() {
+  static std::atomic_uint64_t quota{0};
+  return quota;
+}
+
+std::atomic_uint64_t& localSpilledBytesCounter() {
+  static std::atomic_uint64_t bytes{0};
+  return bytes;
+}
 } // namespace
 
 SpillStats::SpillStats(
@@ -87,6 +97,7 @@ SpillStats& SpillStats::operator+=(const SpillStats& other) {
   spillWrites += other.spillWrites;
   spillFlushTimeNanos += other.spillFlushTimeNanos;
   spillWriteTimeNanos += other.spillWriteTimeNanos;
+  spillWriteWaitTimeNanos += other.spillWriteWaitTimeNanos;
   spillMaxLevelExceededCount += other.spillMaxLevelExceededCount;
   spillReadBytes += other.spillReadBytes;
   spillReads += other.spillReads;
@@ -114,6 +125,8 @@ SpillStats SpillStats::operator-(const SpillStats& other) const {
   result.spillWrites = spillWrites - other.spillWrites;
   result.spillFlushTimeNanos = spillFlushTimeNanos - other.spillFlushTimeNanos;
   result.spillWriteTimeNanos = spillWriteTimeNanos - other.spillWriteTimeNanos;
+  result.spillWriteWaitTimeNanos =
+      spillWriteWaitTimeNanos - other.spillWriteWaitTimeNanos;
   result.spillMaxLevelExceededCount =
       spillMaxLevelExceededCount - other.spillMaxLevelExceededCount;
   result.spillReadBytes = spillReadBytes - other.spillReadBytes;
@@ -149,6 +162,7 @@ bool SpillStats::operator<(const SpillStats& other) const {
   UPDATE_COUNTER(spillWrites);
   UPDATE_COUNTER(spillFlushTimeNanos);
   UPDATE_COUNTER(spillWriteTimeNanos);
+  UPDATE_COUNTER(spillWriteWaitTimeNanos);
   UPDATE_COUNTER(spillMaxLevelExceededCount);
   UPDATE_COUNTER(spillReadBytes);
   UPDATE_COUNTER(spillReads);
@@ -190,6 +204,7 @@ bool SpillStats::operator==(const SpillStats& other) const {
              spillWrites,
              spillFlushTimeNanos,
              spillWriteTimeNanos,
+             spillWriteWaitTimeNanos,
              spillMaxLevelExceededCount,
              spillReadBytes,
              spillReads,
@@ -209,6 +224,7 @@ bool SpillStats::operator==(const SpillStats& other) const {
              other.spillWrites,
              other.spillFlushTimeNanos,
              other.spillWriteTimeNanos,
+             other.spillWriteWaitTimeNanos,
              spillMaxLevelExceededCount,
              spillReadBytes,
              spillReads,
@@ -230,6 +246,7 @@ void SpillStats::reset() {
   spillWrites = 0;
   spillFlushTimeNanos = 0;
   spillWriteTimeNanos = 0;
+  spillWriteWaitTimeNanos = 0;
   spillMaxLevelExceededCount = 0;
   spillReadBytes = 0;
   spillReads = 0;
@@ -242,7 +259,8 @@ std::string SpillStats::toString() const {
       "spillRuns[{}] spilledInputBytes[{}] spilledBytes[{}] spilledRows[{}] "
       "spilledPartitions[{}] spilledFiles[{}] spillFillTimeNanos[{}] "
       "spillSortTimeNanos[{}] spillExtractVectorTime[{}] spillSerializationTimeNanos[{}] spillWrites[{}] "
-      "spillFlushTimeNanos[{}] spillWriteTimeNanos[{}] maxSpillExceededLimitCount[{}] "
+      "spillFlushTimeNanos[{}] spillWriteTimeNanos[{}] spillWriteWaitTimeNanos[{}] "
+      "maxSpillExceededLimitCount[{}] "
       "spillReadBytes[{}] spillReads[{}] spillReadTimeNanos[{}] "
       "spillReadDeserializationTimeNanos[{}]",
       spillRuns,
@@ -258,6 +276,7 @@ std::string SpillStats::toString() const {
       spillWrites,
       succinctNanos(spillFlushTimeNanos),
       succinctNanos(spillWriteTimeNanos),
+      succinctNanos(spillWriteWaitTimeNanos),
       spillMaxLevelExceededCount,
       succinctBytes(spillReadBytes),
       spillReads,
@@ -356,4 +375,25 @@ SpillStats globalSpillStats() {
   }
   return gSpillStats;
 }
+
+void setLocalSpillQuota(uint64_t bytes) {
+  localSpillQuotaBytes() = bytes;
+}
+
+uint64_t localSpillQuota() {
+  return localSpillQuotaBytes();
+}
+
+void updateLocalSpilledBytes(int64_t delta) {
+  localSpilledBytesCounter() += delta;
+}
+
+uint64_t localSpilledBytes() {
+  return localSpilledBytesCounter();
+}
+
+bool localSpillQuotaExceeded() {
+  const auto quota = localSpillQuota();
+  return quota != 0 && localSpilledBytes() >= quota;
+}
 } // namespace facebook::velox::common
@@ -56,6 +56,8 @@ struct SpillStats {
   uint64_t spillFlushTimeNanos{0};
   /// The time spent on writing spilled rows to disk.
   uint64_t spillWriteTimeNanos{0};
+  /// The time spent on waiting for asynchronous spill writes to finish.
+  uint64_t spillWriteWaitTimeNanos{0};
   /// The number of times that an hash build operator exceeds the max spill
   /// limit.
   uint64_t spillMaxLevelExceededCount{0};
@@ -169,6 +171,26 @@ void updateGlobalSpillDeserializationTimeNs(uint64_t timeNs);
 
 /// Gets the cumulative global spill stats.
 SpillStats globalSpillStats();
+
+/// The utilities to account the process wide local spill tier. Tasks spill to
+/// their local spill directory until the spill files of all tasks on the local
+/// tier reach the quota, and then to their overflow spill directory if they
+/// have one, see exec::Task::setOverflowSpillDirectory().
+///
+/// Sets the byte quota of the local spill tier. Zero means no quota.
+void setLocalSpillQuota(uint64_t bytes);
+
+/// Returns the byte quota of the local spill tier.
+uint64_t localSpillQuota();
+
+/// Adds 'delta' to the bytes of the spill files on the local spill tier.
+void updateLocalSpilledBytes(int64_t delta);
+
+/// Returns the bytes of the spill files on the local spill tier.
+uint64_t localSpilledBytes();
+
+/// Returns true if the local spill tier has a quota and has used it up.
+bool localSpillQuotaExceeded();
 } // namespace facebook::velox::common
 
 template <>
@@ -466,6 +466,25 @@ TEST_F(SimdUtilTest, memEqualUnsafe) {
   EXPECT_FALSE(simd::memEqualUnsafe(&data.x[1], &data.y[1], 67));
 }
 
+TEST_F(SimdUtilTest, memEqual16) {
+  uint64_t x[3] = {1, 2, 3};
+  uint64_t y[3] = {1, 2, 4};
+  EXPECT_TRUE(simd::memEqual16(x, y));
+  EXPECT_FALSE(simd::memEqual16(&x[1], &y[1]));
+  y[0] = 0;
+  EXPECT_FALSE(simd::memEqual16(x, y));
+
+  // Unaligned and with a difference in the last byte only.
+  char a[17];
+  char b[17];
+  memset(a, 5, sizeof(a));
+  memset(b, 5, sizeof(b));
+  EXPECT_TRUE(simd::memEqual16(&a[1], &b[1]));
+  b[16] = 0;
+  EXPECT_TRUE(simd::memEqual16(a, b));
+  EXPECT_FALSE(simd::memEqual16(&a[1], &b[1]));
+}
+
 TEST_F(SimdUtilTest, memcpyTime) {
   constexpr int64_t kMaxMove = 128;
   constexpr int64_t kSize = (128 << 20) + kMaxMove;
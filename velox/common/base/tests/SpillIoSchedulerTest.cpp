@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/base/SpillIoScheduler.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include "velox/common/base/tests/GTestUtils.h"
+
+using namespace facebook::velox;
+namespace facebook::velox::common {
+class SpillIoSchedulerTest : public testing::Test {
+ protected:
+  void TearDown() override {
+    SpillIoScheduler::testingReset();
+  }
+
+  // Waits until 'scheduler' has 'numQueuedWrites' queued.
+  static void waitForQueuedWrites(
+      SpillIoScheduler* scheduler,
+      uint32_t numQueuedWrites) {
+    while (scheduler->stats().numQueuedWrites < numQueuedWrites) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1)); // NOLINT
+    }
+  }
+};
+
+TEST_F(SpillIoSchedulerTest, init) {
+  ASSERT_EQ(SpillIoScheduler::instance(), nullptr);
+  SpillIoScheduler::init({});
+  auto* scheduler = SpillIoScheduler::instance();
+  ASSERT_NE(scheduler, nullptr);
+  VELOX_ASSERT_THROW(
+      SpillIoScheduler::init({}), "SpillIoScheduler has already been set");
+  ASSERT_EQ(scheduler, SpillIoScheduler::instance());
+
+  scheduler->accept("q1", 1, 100);
+  scheduler->accept("q2", 1, 100);
+  ASSERT_EQ(scheduler->stats().numInflightWrites, 2);
+  ASSERT_EQ(scheduler->stats().numQueries, 2);
+  scheduler->release("q1");
+  scheduler->release("q2");
+  ASSERT_EQ(scheduler->stats().numInflightWrites, 0);
+  ASSERT_EQ(scheduler->stats().numQueries, 0);
+  VELOX_ASSERT_THROW(scheduler->accept("q1", 0, 100), "");
+}
+
+TEST_F(SpillIoSchedulerTest, weightedFairOrder) {
+  SpillIoScheduler::Config config;
+  config.maxInflightWrites = 1;
+  SpillIoScheduler::init(config);
+  auto* scheduler = SpillIoScheduler::instance();
+
+  // Blocks the other writes until all of them are queued.
+  scheduler->accept("blocker", 1, 100);
+
+  std::mutex mutex;
+  std::vector<std::string> writeOrder;
+  std::vector<std::thread> threads;
+  auto queueWrite = [&](const std::string& queryId, uint32_t weight) {
+    threads.emplace_back([&, queryId, weight]() {
+      scheduler->accept(queryId, weight, 100);
+      {
+        std::lock_guard<std::mutex> l(mutex);
+        writeOrder.push_back(queryId);
+      }
+      scheduler->release(queryId);
+    });
+    waitForQueuedWrites(scheduler, threads.size());
+  };
+  // The writes of 'low' are queued first but 'high' has 4x the weight.
+  for (auto i = 0; i < 4; ++i) {
+    queueWrite("low", 1);
+  }
+  for (auto i = 0; i < 3; ++i) {
+    queueWrite("high", 4);
+  }
+  ASSERT_EQ(scheduler->stats().numQueries, 3);
+
+  scheduler->release("blocker");
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(
+      writeOrder,
+      std::vector<std::string>(
+          {"high", "high", "high", "low", "low", "low", "low"}));
+  ASSERT_EQ(scheduler->stats().numInflightWrites, 0);
+  ASSERT_EQ(scheduler->stats().numQueuedWrites, 0);
+  ASSERT_EQ(scheduler->stats().numQueries, 0);
+}
+
+TEST_F(SpillIoSchedulerTest, maxBytesPerSec) {
+  SpillIoScheduler::Config config;
+  config.maxBytesPerSec = 1 << 20;
+  SpillIoScheduler::init(config);
+  auto* scheduler = SpillIoScheduler::instance();
+
+  // Each write of 100KB takes about 100ms of the bandwidth, so the third write
+  // starts no earlier than 200ms after the first one.
+  uint64_t waitTimeUs{0};
+  for (auto i = 0; i < 3; ++i) {
+    waitTimeUs += scheduler->accept("q1", 1, 100 << 10);
+    scheduler->release("q1");
+  }
+  ASSERT_GE(waitTimeUs, 150'000);
+}
+} // namespace facebook::velox::common
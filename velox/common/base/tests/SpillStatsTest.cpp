@@ -129,7 +129,8 @@ TEST(SpillStatsTest, spillStats) {
       "spilledRows[1031] spilledPartitions[1025] spilledFiles[1026] "
       "spillFillTimeNanos[1.03us] spillSortTimeNanos[1.03us] spillExtractVectorTime[1.03us] "
       "spillSerializationTimeNanos[1.03us] spillWrites[1028] spillFlushTimeNanos[1.03us] "
-      "spillWriteTimeNanos[1.03us] maxSpillExceededLimitCount[4] "
+      "spillWriteTimeNanos[1.03us] spillWriteWaitTimeNanos[0ns] "
+      "maxSpillExceededLimitCount[4] "
       "spillReadBytes[2.00KB] spillReads[10] spillReadTimeNanos[100ns] "
       "spillReadDeserializationTimeNanos[100ns]");
   ASSERT_EQ(
@@ -139,7 +140,7 @@ TEST(SpillStatsTest, spillStats) {
       "spillFillTimeNanos[1.03us] spillSortTimeNanos[1.03us] spillExtractVectorTime[1.03us] "
       "spillSerializationTimeNanos[1.03us] spillWrites[1028] "
       "spillFlushTimeNanos[1.03us] spillWriteTimeNanos[1.03us] "
-      "maxSpillExceededLimitCount[4] "
+      "spillWriteWaitTimeNanos[0ns] maxSpillExceededLimitCount[4] "
       "spillReadBytes[2.00KB] spillReads[10] spillReadTimeNanos[100ns] "
       "spillReadDeserializationTimeNanos[100ns]");
 }
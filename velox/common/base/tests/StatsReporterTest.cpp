@@ -480,6 +480,7 @@ TEST_F(PeriodicStatsReporterTest, basic) {
     ASSERT_EQ(counterMap.count(kMetricMemoryCacheNumAllocClocks.str()), 0);
     ASSERT_EQ(counterMap.count(kMetricMemoryCacheNumAgedOutEntries.str()), 0);
     ASSERT_EQ(counterMap.count(kMetricMemoryCacheSumEvictScore.str()), 0);
+    ASSERT_EQ(counterMap.count(kMetricMemoryCacheNumSsdAdmissions.str()), 0);
     ASSERT_EQ(counterMap.count(kMetricSsdCacheReadEntries.str()), 0);
     ASSERT_EQ(counterMap.count(kMetricSsdCacheReadBytes.str()), 0);
     ASSERT_EQ(counterMap.count(kMetricSsdCacheWrittenEntries.str()), 0);
@@ -502,6 +503,7 @@ TEST_F(PeriodicStatsReporterTest, basic) {
     ASSERT_EQ(counterMap.count(kMetricSsdCacheAgedOutRegions.str()), 0);
     ASSERT_EQ(counterMap.count(kMetricSsdCacheRecoveredEntries.str()), 0);
     ASSERT_EQ(counterMap.count(kMetricSsdCacheReadWithoutChecksum.str()), 0);
+    ASSERT_EQ(counterMap.count(kMetricSsdCacheWriteToReadPct.str()), 0);
     ASSERT_EQ(counterMap.size(), 22);
   }
 
@@ -536,6 +538,7 @@ TEST_F(PeriodicStatsReporterTest, basic) {
        .numNew = 10,
        .numEvict = 10,
        .numSavableEvict = 10,
+       .numSsdAdmissions = 10,
        .numEvictChecks = 10,
        .numWaitExclusive = 10,
        .numAgedOut = 10,
@@ -563,6 +566,7 @@ TEST_F(PeriodicStatsReporterTest, basic) {
     ASSERT_EQ(counterMap.count(kMetricMemoryCacheNumAllocClocks.str()), 1);
     ASSERT_EQ(counterMap.count(kMetricMemoryCacheNumAgedOutEntries.str()), 1);
     ASSERT_EQ(counterMap.count(kMetricMemoryCacheSumEvictScore.str()), 1);
+    ASSERT_EQ(counterMap.count(kMetricMemoryCacheNumSsdAdmissions.str()), 1);
     ASSERT_EQ(counterMap.count(kMetricSsdCacheReadEntries.str()), 1);
     ASSERT_EQ(counterMap.count(kMetricSsdCacheReadBytes.str()), 1);
     ASSERT_EQ(counterMap.count(kMetricSsdCacheWrittenEntries.str()), 1);
@@ -585,7 +589,8 @@ TEST_F(PeriodicStatsReporterTest, basic) {
     ASSERT_EQ(counterMap.count(kMetricSsdCacheAgedOutRegions.str()), 1);
     ASSERT_EQ(counterMap.count(kMetricSsdCacheRecoveredEntries.str()), 1);
     ASSERT_EQ(counterMap.count(kMetricSsdCacheReadWithoutChecksum.str()), 1);
-    ASSERT_EQ(counterMap.size(), 54);
+    ASSERT_EQ(counterMap.count(kMetricSsdCacheWriteToReadPct.str()), 1);
+    ASSERT_EQ(counterMap.size(), 56);
   }
 }
 
@@ -47,12 +47,14 @@ AsyncDataCacheEntry::~AsyncDataCacheEntry() {
   shard_->cache()->allocator()->freeNonContiguous(data_);
 }
 
-void AsyncDataCacheEntry::setExclusiveToShared(bool ssdSavable) {
+void AsyncDataCacheEntry::setExclusiveToShared(
+    bool ssdSavable,
+    bool reusePredicted) {
   VELOX_CHECK(isExclusive());
   numPins_ = 1;
   std::unique_ptr<folly::SharedPromise<bool>> promise;
   {
-    std::lock_guard<std::mutex> l(shard_->mutex());
+    std::lock_guard<std::shared_mutex> l(shard_->mutex());
     // Enter the shard's mutex to make sure a promise is not being added during
     // the move.
     promise = std::move(promise_);
@@ -76,6 +78,11 @@ void AsyncDataCacheEntry::setExclusiveToShared(bool ssdSavable) {
 
   auto* ssdCache = shard_->cache()->ssdCache();
   if ((ssdCache != nullptr) && (ssdFile_ == nullptr)) {
+    if (shard_->cache()->options().ssdAdmissionMinUses > 0 &&
+        !reusePredicted) {
+      // Admitted on eviction if used often enough. See CacheShard::evict().
+      return;
+    }
     if (ssdCache->groupStats().shouldSaveToSsd(groupId_, trackingId_)) {
       ssdSaveable_ = true;
       shard_->cache()->possibleSsdSave(size_);
@@ -138,6 +145,7 @@ void AsyncDataCacheEntry::initialize(FileCacheKey key) {
 }
 
 void AsyncDataCacheEntry::makeEvictable() {
+  keepResident_ = false;
   accessStats_.lastUse = 0;
   accessStats_.numUses = 0;
 }
@@ -166,10 +174,23 @@ CachePin CacheShard::findOrCreate(
     RawFileCacheKey key,
     uint64_t size,
     folly::SemiFuture<bool>* wait) {
+  // The admission filter counts all accesses in a sketch that is not safe
+  // for concurrent updates, so all lookups take the exclusive path then.
+  if (admissionSketch_ == nullptr) {
+    auto pin = findShared(key, size);
+    if (!pin.empty()) {
+      return pin;
+    }
+  }
   AsyncDataCacheEntry* entryToInit = nullptr;
+  const uint64_t hash =
+      admissionSketch_ ? std::hash<RawFileCacheKey>()(key) : 0;
   {
-    std::lock_guard<std::mutex> l(mutex_);
+    std::lock_guard<std::shared_mutex> l(mutex_);
     ++eventCounter_;
+    if (admissionSketch_ != nullptr) {
+      admissionSketch_->increment(hash);
+    }
     auto it = entryMap_.find(key);
     if (it != entryMap_.end()) {
       auto* foundEntry = it->second;
@@ -212,10 +233,21 @@ CachePin CacheShard::findOrCreate(
       entryMap_.erase(it);
     }
 
+    const bool rejected = rejectAdmission(key, hash);
     auto newEntry = getFreeEntry();
     // Initialize the members that must be set inside 'mutex_'.
     newEntry->numPins_ = AsyncDataCacheEntry::kExclusive;
     newEntry->promise_ = nullptr;
+    newEntry->keepResident_ = false;
+    newEntry->expireTimeSec_ = 0;
+    if (rejected) {
+      // The caller still gets the entry to load the data into, but the entry
+      // is the first to go unless it is hit again before the clock hand comes
+      // around.
+      newEntry->makeEvictable();
+      RECORD_METRIC_VALUE(kMetricMemoryCacheNumAdmissionRejects);
+      ++numAdmissionRejects_;
+    }
     entryToInit = newEntry.get();
     entryMap_[key] = newEntry.get();
     if (emptySlots_.empty()) {
@@ -234,8 +266,54 @@ CachePin CacheShard::findOrCreate(
   return initEntry(key, entryToInit);
 }
 
+CachePin CacheShard::findShared(RawFileCacheKey key, uint64_t size) {
+  std::shared_lock<std::shared_mutex> l(mutex_);
+  auto it = entryMap_.find(key);
+  if (it == entryMap_.end()) {
+    return CachePin();
+  }
+  auto* entry = it->second;
+  if (entry->isExclusive() || entry->isPrefetch() || entry->size() < size) {
+    return CachePin();
+  }
+  // The entry cannot be evicted or made exclusive while the shared lock is
+  // held, so adding a pin does not race with the pin count check of evict().
+  // Concurrent touch() may lose an update, which only affects the score.
+  entry->touch();
+  ++entry->numPins_;
+  ++numSharedHit_;
+  sharedHitBytes_ += entry->size();
+  CachePin pin;
+  pin.setEntry(entry);
+  return pin;
+}
+
+bool CacheShard::rejectAdmission(RawFileCacheKey key, uint64_t hash) const {
+  // Admission only matters once the shard is full, i.e. new entries replace
+  // evicted ones.
+  if (admissionSketch_ == nullptr || numEvict_ == 0 || entries_.empty()) {
+    return false;
+  }
+  const auto numChecks = std::min<size_t>(
+      kAdmissionVictimChecks, entries_.size());
+  for (size_t i = 0; i < numChecks; ++i) {
+    const auto& victim = entries_[(clockHand_ + i) % entries_.size()];
+    if (victim == nullptr || !victim->key_.fileNum.hasValue()) {
+      continue;
+    }
+    const RawFileCacheKey victimKey{
+        victim->key_.fileNum.id(), victim->key_.offset};
+    if (victimKey == key) {
+      return false;
+    }
+    return admissionSketch_->estimate(hash) <=
+        admissionSketch_->estimate(std::hash<RawFileCacheKey>()(victimKey));
+  }
+  return false;
+}
+
 void CacheShard::makeEvictable(RawFileCacheKey key) {
-  std::lock_guard<std::mutex> l(mutex_);
+  std::lock_guard<std::shared_mutex> l(mutex_);
   auto it = entryMap_.find(key);
   if (it == entryMap_.end()) {
     return;
@@ -243,8 +321,22 @@ void CacheShard::makeEvictable(RawFileCacheKey key) {
   it->second->makeEvictable();
 }
 
+CachePin CacheShard::find(RawFileCacheKey key) {
+  std::shared_lock<std::shared_mutex> l(mutex_);
+  auto it = entryMap_.find(key);
+  if (it == entryMap_.end() || it->second->isExclusive()) {
+    return CachePin();
+  }
+  auto* entry = it->second;
+  entry->touch();
+  ++entry->numPins_;
+  CachePin pin;
+  pin.setEntry(entry);
+  return pin;
+}
+
 bool CacheShard::exists(RawFileCacheKey key) const {
-  std::lock_guard<std::mutex> l(mutex_);
+  std::shared_lock<std::shared_mutex> l(mutex_);
   auto it = entryMap_.find(key);
   if (it != entryMap_.end()) {
     it->second->touch();
@@ -278,7 +370,7 @@ bool CoalescedLoad::loadOrFuture(
     folly::SemiFuture<bool>* wait,
     bool ssdSavable) {
   {
-    std::lock_guard<std::mutex> l(mutex_);
+    std::lock_guard<std::shared_mutex> l(mutex_);
     if (state_ == State::kCancelled || state_ == State::kLoaded) {
       return true;
     }
@@ -321,7 +413,7 @@ bool CoalescedLoad::loadOrFuture(
 void CoalescedLoad::setEndState(State endState) {
   std::unique_ptr<folly::SharedPromise<bool>> promise;
   {
-    std::lock_guard<std::mutex> l(mutex_);
+    std::lock_guard<std::shared_mutex> l(mutex_);
     state_ = endState;
     promise.swap(promise_);
   }
@@ -332,7 +424,7 @@ void CoalescedLoad::setEndState(State endState) {
 
 std::unique_ptr<folly::SharedPromise<bool>> CacheShard::removeEntry(
     AsyncDataCacheEntry* entry) {
-  std::lock_guard<std::mutex> l(mutex_);
+  std::lock_guard<std::shared_mutex> l(mutex_);
   removeEntryLocked(entry);
   // After the entry is removed from the hash table, a promise can no longer
   // be made. It is safe to move the promise and realize it.
@@ -373,13 +465,17 @@ uint64_t CacheShard::evict(
   auto* ssdCache = cache_->ssdCache();
   const bool skipSsdSaveable =
       (ssdCache != nullptr) && ssdCache->writeInProgress();
+  const int32_t ssdAdmissionMinUses =
+      ssdCache != nullptr ? cache_->options().ssdAdmissionMinUses : 0;
   auto now = accessTime();
+  const int64_t nowSec = getCurrentTimeSec();
   std::vector<memory::Allocation> toFree;
   int64_t tinyEvicted = 0;
   int64_t largeEvicted = 0;
   int32_t evictSaveableSkipped = 0;
+  int32_t numSsdAdmitted = 0;
   {
-    std::lock_guard<std::mutex> l(mutex_);
+    std::lock_guard<std::shared_mutex> l(mutex_);
     const size_t size = entries_.size();
     if (size == 0) {
       return 0;
@@ -416,11 +512,26 @@ uint64_t CacheShard::evict(
       int32_t score = 0;
       if (candidate->numPins_ == 0 &&
           (!candidate->key_.fileNum.hasValue() || evictAllUnpinned ||
-           (score = candidate->score(now)) >= evictionThreshold_)) {
+           candidate->isExpired(nowSec) ||
+           (!candidate->keepResident_ &&
+            (score = candidate->score(now)) >= evictionThreshold_))) {
         if (skipSsdSaveable && candidate->ssdSaveable() && !evictAllUnpinned) {
           ++evictSaveableSkipped;
           continue;
         }
+        if (ssdAdmissionMinUses > 0 && !evictAllUnpinned &&
+            candidate->key_.fileNum.hasValue() &&
+            candidate->ssdFile_ == nullptr && !candidate->ssdSaveable() &&
+            candidate->accessStats_.numUses >= ssdAdmissionMinUses &&
+            ssdCache->groupStats().shouldSaveToSsd(
+                candidate->groupId_, candidate->trackingId_)) {
+          // Reused enough to be worth writing to SSD. Keeps the entry until
+          // it is written.
+          candidate->ssdSaveable_ = true;
+          ++numSsdAdmitted;
+          ++numSsdAdmissions_;
+          continue;
+        }
         if (candidate->ssdSaveable()) {
           ++numSavableEvict_;
         }
@@ -458,12 +569,14 @@ uint64_t CacheShard::evict(
   freeAllocations(toFree);
   cache_->incrementCachedPages(
       -memory::AllocationTraits::numPages(largeEvicted));
-  if (evictSaveableSkipped) {
+  if (evictSaveableSkipped || numSsdAdmitted) {
     VELOX_CHECK_NOT_NULL(ssdCache);
     if (ssdCache->startWrite()) {
-      // Rare. May occur if SSD is unusually slow. Useful for diagnostics.
-      VELOX_SSD_CACHE_LOG(INFO) << "Start save for old saveable, skipped "
-                                << cache_->numSkippedSaves();
+      if (evictSaveableSkipped) {
+        // Rare. May occur if SSD is unusually slow. Useful for diagnostics.
+        VELOX_SSD_CACHE_LOG(INFO) << "Start save for old saveable, skipped "
+                                  << cache_->numSkippedSaves();
+      }
       cache_->numSkippedSaves() = 0;
       cache_->saveToSsd();
     } else {
@@ -513,7 +626,7 @@ void CacheShard::calibrateThreshold() {
 }
 
 void CacheShard::updateStats(CacheStats& stats) {
-  std::lock_guard<std::mutex> l(mutex_);
+  std::lock_guard<std::shared_mutex> l(mutex_);
   for (auto& entry : entries_) {
     if (!entry || !entry->key_.fileNum.hasValue()) {
       ++stats.numEmptyEntries;
@@ -543,8 +656,8 @@ void CacheShard::updateStats(CacheStats& stats) {
       stats.largePadding += entry->data_.byteSize() - entry->size_;
     }
   }
-  stats.numHit += numHit_;
-  stats.hitBytes += hitBytes_;
+  stats.numHit += numHit_ + numSharedHit_;
+  stats.hitBytes += hitBytes_ + sharedHitBytes_;
   stats.numNew += numNew_;
   stats.numEvict += numEvict_;
   stats.numSavableEvict += numSavableEvict_;
@@ -552,12 +665,14 @@ void CacheShard::updateStats(CacheStats& stats) {
   stats.numWaitExclusive += numWaitExclusive_;
   stats.numAgedOut += numAgedOut_;
   stats.numStales += numStales_;
+  stats.numAdmissionRejects += numAdmissionRejects_;
+  stats.numSsdAdmissions += numSsdAdmissions_;
   stats.sumEvictScore += sumEvictScore_;
   stats.allocClocks += allocClocks_;
 }
 
 void CacheShard::appendSsdSaveable(bool saveAll, std::vector<CachePin>& pins) {
-  std::lock_guard<std::mutex> l(mutex_);
+  std::lock_guard<std::shared_mutex> l(mutex_);
   // Do not add entries to a write batch more than maxWriteRatio_. If SSD save
   // is slower than storage read, we must not have a situation where SSD save
   // pins everything and stops reading.
@@ -593,7 +708,7 @@ bool CacheShard::removeFileEntries(
   int64_t pagesRemoved = 0;
   std::vector<memory::Allocation> toFree;
   {
-    std::lock_guard<std::mutex> l(mutex_);
+    std::lock_guard<std::shared_mutex> l(mutex_);
 
     auto entryIndex = -1;
     for (auto& cacheEntry : entries_) {
@@ -641,6 +756,8 @@ CacheStats CacheStats::operator-(const CacheStats& other) const {
   result.numWaitExclusive = numWaitExclusive - other.numWaitExclusive;
   result.numAgedOut = numAgedOut - other.numAgedOut;
   result.numStales = numStales - other.numStales;
+  result.numAdmissionRejects = numAdmissionRejects - other.numAdmissionRejects;
+  result.numSsdAdmissions = numSsdAdmissions - other.numSsdAdmissions;
   result.allocClocks = allocClocks - other.allocClocks;
   result.sumEvictScore = sumEvictScore - other.sumEvictScore;
   if (ssdStats != nullptr) {
@@ -668,7 +785,8 @@ AsyncDataCache::AsyncDataCache(
       ssdCache_(std::move(ssdCache)),
       cachedPages_(0) {
   for (auto i = 0; i < kNumShards; ++i) {
-    shards_.push_back(std::make_unique<CacheShard>(this, opts_.maxWriteRatio));
+    shards_.push_back(std::make_unique<CacheShard>(
+        this, opts_.maxWriteRatio, opts_.admissionFilter));
   }
 }
 
@@ -682,6 +800,21 @@ std::shared_ptr<AsyncDataCache> AsyncDataCache::create(
   auto cache =
       std::make_shared<AsyncDataCache>(options, allocator, std::move(ssdCache));
   allocator->registerCache(cache);
+  if (options.ssdPrewarmBytes > 0 && cache->ssdCache() != nullptr) {
+    ++cache->prewarmsInProgress_;
+    cache->ssdCache()->executor()->add(
+        [cache, bytes = options.ssdPrewarmBytes]() {
+          try {
+            const auto loadedBytes = cache->prewarmFromSsd(bytes);
+            VELOX_CACHE_LOG(INFO) << "Prewarmed AsyncDataCache with "
+                                  << succinctBytes(loadedBytes) << " from SSD";
+          } catch (const std::exception& e) {
+            VELOX_CACHE_LOG(WARNING)
+                << "Error prewarming AsyncDataCache from SSD: " << e.what();
+          }
+          --cache->prewarmsInProgress_;
+        });
+  }
   return cache;
 }
 
@@ -701,7 +834,66 @@ AsyncDataCache** AsyncDataCache::getInstancePtr() {
   return &cache_;
 }
 
+uint64_t AsyncDataCache::prewarmFromSsd(uint64_t maxBytes) {
+  if (ssdCache_ == nullptr || maxBytes == 0) {
+    return 0;
+  }
+  uint64_t loadedBytes = 0;
+  bool outOfMemory = false;
+  for (const auto& shardEntries : ssdCache_->hotEntries(maxBytes)) {
+    if (outOfMemory) {
+      break;
+    }
+    std::vector<CachePin> pins;
+    std::vector<SsdPin> ssdPins;
+    for (const auto& [key, size] : shardEntries) {
+      CachePin pin;
+      try {
+        pin = findOrCreate(key, size, nullptr);
+      } catch (const VeloxException&) {
+        outOfMemory = true;
+        break;
+      }
+      // Skips entries that are already in memory or being loaded.
+      if (pin.empty() || !pin.checkedEntry()->isExclusive()) {
+        continue;
+      }
+      auto ssdPin = ssdCache_->file(key.fileNum).find(key);
+      if (ssdPin.empty()) {
+        continue;
+      }
+      pins.push_back(std::move(pin));
+      ssdPins.push_back(std::move(ssdPin));
+    }
+    if (pins.empty()) {
+      continue;
+    }
+    try {
+      ssdPins[0].file()->load(ssdPins, pins);
+    } catch (const std::exception& e) {
+      // The exclusive pins are dropped, which removes their entries.
+      VELOX_CACHE_LOG(WARNING)
+          << "Error prewarming AsyncDataCache from SSD: " << e.what();
+      continue;
+    }
+    for (auto& pin : pins) {
+      auto* entry = pin.checkedEntry();
+      entry->setPrefetch();
+      loadedBytes += entry->size();
+      entry->setExclusiveToShared();
+    }
+  }
+  return loadedBytes;
+}
+
+void AsyncDataCache::waitForPrewarmToFinish() {
+  while (prewarmsInProgress_ != 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100)); // NOLINT
+  }
+}
+
 void AsyncDataCache::shutdown() {
+  waitForPrewarmToFinish();
   if (ssdCache_) {
     ssdCache_->shutdown();
   }
@@ -733,6 +925,11 @@ bool AsyncDataCache::exists(RawFileCacheKey key) const {
   return shards_[shard]->exists(key);
 }
 
+CachePin AsyncDataCache::find(RawFileCacheKey key) {
+  int shard = std::hash<RawFileCacheKey>()(key) & (kShardMask);
+  return shards_[shard]->find(key);
+}
+
 bool AsyncDataCache::makeSpace(
     MachinePageCount numPages,
     std::function<bool(memory::Allocation& allocation)> allocate) {
@@ -1009,6 +1206,7 @@ std::string CacheStats::toString() const {
       << " savable eviction: " << numSavableEvict
       << " eviction checks: " << numEvictChecks << " aged out: " << numAgedOut
       << " stales: " << numStales
+      << " admission rejects: " << numAdmissionRejects
       << "\n"
       // Cache prefetch stats.
       << "Prefetch entries: " << numPrefetch
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <deque>
+#include <shared_mutex>
 
 #include <fmt/format.h>
 #include <folly/GLog.h>
@@ -29,6 +30,7 @@
 #include "velox/common/base/Portability.h"
 #include "velox/common/base/SelectivityInfo.h"
 #include "velox/common/caching/FileGroupStats.h"
+#include "velox/common/caching/FrequencySketch.h"
 #include "velox/common/caching/ScanTracker.h"
 #include "velox/common/caching/StringIdMap.h"
 #include "velox/common/file/File.h"
@@ -44,6 +46,7 @@ namespace facebook::velox::cache {
 
 class AsyncDataCache;
 class CacheShard;
+class PeerCache;
 class SsdCache;
 struct SsdCacheStats;
 class SsdFile;
@@ -119,6 +122,17 @@ struct RawFileCacheKey {
     return offset == other.offset && fileNum == other.fileNum;
   }
 };
+
+/// Bit set in the offset of the key of an entry that holds the decoded, e.g.
+/// decompressed, form of the file data at the offset without the bit.
+constexpr uint64_t kDecodedCacheKeyBit = 1ULL << 63;
+
+/// Returns the key of the decoded form of the file data cached under 'key'.
+/// Decoded entries live in the same shards as the raw file data and are
+/// charged to and evicted from the same memory but are never saved to SSD.
+inline RawFileCacheKey decodedCacheKey(RawFileCacheKey key) {
+  return RawFileCacheKey{key.fileNum, key.offset | kDecodedCacheKeyBit};
+}
 } // namespace facebook::velox::cache
 
 namespace std {
@@ -231,8 +245,13 @@ class AsyncDataCacheEntry {
   }
 
   /// If 'ssdSavable' is true, marks the loaded cache entry as ssdSavable if it
-  /// is not loaded from ssd.
-  void setExclusiveToShared(bool ssdSavable = true);
+  /// is not loaded from ssd. With SSD admission, see
+  /// AsyncDataCache::Options::ssdAdmissionMinUses, the entry is marked only if
+  /// 'reusePredicted' is also true. Otherwise it qualifies for SSD when it is
+  /// evicted after enough uses.
+  void setExclusiveToShared(
+      bool ssdSavable = true,
+      bool reusePredicted = false);
 
   void setSsdFile(SsdFile* file, uint64_t offset) {
     ssdFile_ = file;
@@ -263,6 +282,30 @@ class AsyncDataCacheEntry {
   /// Sets access stats so that this is immediately evictable.
   void makeEvictable();
 
+  /// If 'keepResident' is true, 'this' is not evicted by score. It is still
+  /// evicted when the cache cannot make space otherwise.
+  void setKeepResident(bool keepResident) {
+    keepResident_ = keepResident;
+  }
+
+  bool keepResident() const {
+    return keepResident_;
+  }
+
+  /// Makes 'this' evictable regardless of its score once the wall time in
+  /// seconds is past 'expireTimeSec'. 0 means no expiry.
+  void setExpireTimeSec(int64_t expireTimeSec) {
+    expireTimeSec_ = expireTimeSec;
+  }
+
+  int64_t expireTimeSec() const {
+    return expireTimeSec_;
+  }
+
+  bool isExpired(int64_t nowSec) const {
+    return expireTimeSec_ != 0 && nowSec >= expireTimeSec_;
+  }
+
   /// Moves the promise out of 'this'. Used in order to handle the
   /// promise within the lock of the cache shard, so not within private
   /// methods of 'this'.
@@ -300,7 +343,8 @@ class AsyncDataCacheEntry {
   std::unique_ptr<folly::SharedPromise<bool>> promise_;
   int32_t size_{0};
 
-  // Setting this from 0 to 1 or to kExclusive requires owning shard_->mutex_.
+  // Setting this from 0 to 1 requires at least a shared lock on
+  // shard_->mutex_. Setting this to kExclusive requires an exclusive lock.
   std::atomic<int32_t> numPins_{0};
 
   AccessStats accessStats_;
@@ -334,6 +378,12 @@ class AsyncDataCacheEntry {
   // True if this should be saved to SSD.
   std::atomic<bool> ssdSaveable_{false};
 
+  // True if 'this' is exempt from eviction by score.
+  tsan_atomic<bool> keepResident_{false};
+
+  // Wall time in seconds after which 'this' is evictable, 0 if none.
+  tsan_atomic<int64_t> expireTimeSec_{0};
+
   friend class CacheShard;
   friend class CachePin;
   friend class test::AsyncDataCacheEntryTestHelper;
@@ -525,6 +575,9 @@ struct CacheStats {
   /// Number of times a valid entry was removed in order to make space but has
   /// not been saved to SSD yet.
   int64_t numSavableEvict{0};
+  /// Number of entries picked for eviction that were instead admitted to SSD
+  /// because they had been used often enough.
+  int64_t numSsdAdmissions{0};
   /// Number of entries considered for evicting.
   int64_t numEvictChecks{0};
   /// Number of times a user waited for an entry to transit from exclusive to
@@ -535,6 +588,10 @@ struct CacheStats {
   /// Total number of entries that are stale because of cache request size
   /// mismatch.
   int64_t numStales{0};
+  /// Total number of new entries that the admission filter found less
+  /// frequently accessed than their eviction victim. These are admitted as
+  /// immediately evictable.
+  int64_t numAdmissionRejects{0};
   /// Cumulative clocks spent in allocating or freeing memory for backing cache
   /// entries.
   uint64_t allocClocks{0};
@@ -556,8 +613,16 @@ struct CacheStats {
 /// and other housekeeping.
 class CacheShard {
  public:
-  CacheShard(AsyncDataCache* cache, double maxWriteRatio)
-      : cache_(cache), maxWriteRatio_(maxWriteRatio) {}
+  CacheShard(
+      AsyncDataCache* cache,
+      double maxWriteRatio,
+      bool admissionFilter = false)
+      : cache_(cache),
+        maxWriteRatio_(maxWriteRatio),
+        admissionSketch_(
+            admissionFilter
+                ? std::make_unique<FrequencySketch>(kAdmissionSketchWidth)
+                : nullptr) {}
 
   /// See AsyncDataCache::findOrCreate.
   CachePin findOrCreate(
@@ -571,11 +636,14 @@ class CacheShard {
   /// Returns true if there is an entry for 'key'. Updates access time.
   bool exists(RawFileCacheKey key) const;
 
+  /// See AsyncDataCache::find.
+  CachePin find(RawFileCacheKey key);
+
   AsyncDataCache* cache() const {
     return cache_;
   }
 
-  std::mutex& mutex() {
+  std::shared_mutex& mutex() {
     return mutex_;
   }
 
@@ -646,10 +714,32 @@ class CacheShard {
 
   void tryAddFreeEntry(std::unique_ptr<AsyncDataCacheEntry>&& entry);
 
+  // Returns true if the new entry for 'key' should be admitted as evictable
+  // because 'key' is accessed less frequently than the entry the clock hand
+  // would evict next. Called inside 'mutex_' before a new entry is made.
+  bool rejectAdmission(RawFileCacheKey key, uint64_t hash) const;
+
+  // Number of counters per row in 'admissionSketch_'.
+  static constexpr uint32_t kAdmissionSketchWidth = 1 << 14;
+  // Max number of entries checked to find the eviction victim to compare a
+  // new entry with.
+  static constexpr int32_t kAdmissionVictimChecks = 8;
+
+  // Returns a shared pin on the entry for 'key' if it is readable and at
+  // least 'size' bytes, using only a shared lock on 'mutex_'. Returns an
+  // empty pin if the lookup needs the exclusive path of findOrCreate(), e.g.
+  // for a miss or on the first hit of a prefetched entry.
+  CachePin findShared(RawFileCacheKey key, uint64_t size);
+
   AsyncDataCache* const cache_;
   const double maxWriteRatio_;
+  // Access frequency of the keys of 'this', if the TinyLFU admission filter is
+  // enabled. Accessed inside 'mutex_'.
+  const std::unique_ptr<FrequencySketch> admissionSketch_;
 
-  mutable std::mutex mutex_;
+  // Hits take a shared lock. Anything that changes the key to entry mapping,
+  // eviction state or pins an entry exclusively takes an exclusive lock.
+  mutable std::shared_mutex mutex_;
   folly::F14FastMap<RawFileCacheKey, AsyncDataCacheEntry*> entryMap_;
   // Entries associated to a key.
   std::deque<std::unique_ptr<AsyncDataCacheEntry>> entries_;
@@ -669,6 +759,11 @@ class CacheShard {
   uint64_t numHit_{0};
   // Cumulative Sum of bytes in cache hits.
   uint64_t hitBytes_{0};
+  // Cumulative count and bytes of the hits served under a shared lock. Kept
+  // apart from 'numHit_' and 'hitBytes_' that are only updated inside an
+  // exclusive lock.
+  std::atomic<uint64_t> numSharedHit_{0};
+  std::atomic<uint64_t> sharedHitBytes_{0};
   // Cumulative count of hits on entries held in exclusive mode.
   uint64_t numWaitExclusive_{0};
   // Cumulative count of new entry creation.
@@ -684,6 +779,10 @@ class CacheShard {
   uint64_t numAgedOut_{0};
   // Cumulative count of stale entries because of cache request size mismatch.
   uint64_t numStales_{0};
+  // Cumulative count of new entries rejected by the admission filter.
+  uint64_t numAdmissionRejects_{0};
+  // Cumulative count of entries admitted to SSD on eviction.
+  uint64_t numSsdAdmissions_{0};
   // Cumulative sum of evict scores. This divided by 'numEvict_' correlates to
   // time data stays in cache.
   uint64_t sumEvictScore_{0};
@@ -700,10 +799,18 @@ class AsyncDataCache : public memory::Cache {
     Options(
         double _maxWriteRatio = 0.7,
         double _ssdSavableRatio = 0.125,
-        int32_t _minSsdSavableBytes = 1 << 24)
+        int32_t _minSsdSavableBytes = 1 << 24,
+        bool _admissionFilter = false,
+        bool _cacheDecompressed = false,
+        uint64_t _ssdPrewarmBytes = 0,
+        int32_t _ssdAdmissionMinUses = 0)
         : maxWriteRatio(_maxWriteRatio),
           ssdSavableRatio(_ssdSavableRatio),
-          minSsdSavableBytes(_minSsdSavableBytes){};
+          minSsdSavableBytes(_minSsdSavableBytes),
+          admissionFilter(_admissionFilter),
+          cacheDecompressed(_cacheDecompressed),
+          ssdPrewarmBytes(_ssdPrewarmBytes),
+          ssdAdmissionMinUses(_ssdAdmissionMinUses){};
 
     /// The max ratio of the number of in-memory cache entries being written to
     /// SSD cache over the total number of cache entries. This is to control SSD
@@ -722,6 +829,30 @@ class AsyncDataCache : public memory::Cache {
     /// NOTE: we only write to SSD cache when both above conditions satisfy. The
     /// default is 16MB.
     int32_t minSsdSavableBytes;
+
+    /// If true, a new entry that would evict an entry is admitted as
+    /// immediately evictable unless its key has been requested at least as
+    /// often as the key of the victim. This keeps one-off scans from flushing
+    /// the frequently used entries out of the cache (TinyLFU admission).
+    bool admissionFilter;
+
+    /// If true, readers also cache the decompressed chunks of compressed
+    /// streams read through the cache, under decodedCacheKey() of the chunk.
+    /// A hit then costs a copy instead of a decompression. The decompressed
+    /// entries compete for memory with the raw file data.
+    bool cacheDecompressed;
+
+    /// If non-zero and there is an SSD cache, create() starts loading up to
+    /// this many bytes of the most read SSD entries into memory in the
+    /// background. See prewarmFromSsd().
+    uint64_t ssdPrewarmBytes;
+
+    /// If non-zero, a loaded entry is written to SSD only if its reader
+    /// predicts reuse, see ScanTracker::predictsReuse(), or if it has been
+    /// used at least this many times when it is picked for eviction. Such an
+    /// entry stays in memory until it is written. This keeps data scanned
+    /// once from being written to SSD. If 0, every loaded entry is written.
+    int32_t ssdAdmissionMinUses;
   };
 
   AsyncDataCache(
@@ -748,6 +879,17 @@ class AsyncDataCache : public memory::Cache {
   /// shutdown. The cache will no longer be valid after this call.
   void shutdown();
 
+  /// Loads up to 'maxBytes' of the entries in the most read regions of the SSD
+  /// cache into memory, e.g. after the SSD cache is recovered from its
+  /// checkpoint on restart, so that the hit rate recovers before queries
+  /// arrive. The loaded entries count as prefetched. Checksums are verified
+  /// as usual for SSD reads, if enabled. Stops early if memory runs out.
+  /// Returns the number of bytes loaded.
+  uint64_t prewarmFromSsd(uint64_t maxBytes);
+
+  /// Waits for the background prewarm started by create() to finish.
+  void waitForPrewarmToFinish();
+
   /// Calls 'allocate' until this returns true. Returns true if
   /// allocate returns true. and Tries to evict at least 'numPages' of
   /// cache after each failed call to 'allocate'.  May pause to wait
@@ -765,6 +907,10 @@ class AsyncDataCache : public memory::Cache {
     return allocator_;
   }
 
+  const Options& options() const {
+    return opts_;
+  }
+
   /// Finds or creates a cache entry corresponding to 'key'. The entry
   /// is returned in 'pin'. If the entry is new, it is pinned in
   /// exclusive mode and its 'data_' has uninitialized space for at
@@ -787,6 +933,21 @@ class AsyncDataCache : public memory::Cache {
   /// Returns true if there is an entry for 'key'. Updates access time.
   bool exists(RawFileCacheKey key) const;
 
+  /// Returns a shared pin on the readable entry for 'key', or an empty pin if
+  /// there is none. Unlike findOrCreate(), never creates an entry and does
+  /// not count as a hit. Updates access time.
+  CachePin find(RawFileCacheKey key);
+
+  /// Sets the cooperative cache to ask for data owned by peers on a miss.
+  /// Must be set before the cache is used.
+  void setPeerCache(std::shared_ptr<PeerCache> peerCache) {
+    peerCache_ = std::move(peerCache);
+  }
+
+  PeerCache* peerCache() const {
+    return peerCache_.get();
+  }
+
 #if defined(__has_feature)
 #if __has_feature(thread_sanitizer)
   __attribute__((__no_sanitize__("thread")))
@@ -893,12 +1054,15 @@ class AsyncDataCache : public memory::Cache {
   const Options opts_;
   memory::MemoryAllocator* const allocator_;
   std::unique_ptr<SsdCache> ssdCache_;
+  std::shared_ptr<PeerCache> peerCache_;
   std::vector<std::unique_ptr<CacheShard>> shards_;
   std::atomic<int32_t> shardCounter_{0};
   std::atomic<memory::MachinePageCount> cachedPages_{0};
   // Number of pages that are allocated and not yet loaded or loaded
   // but not yet hit for the first time.
   std::atomic<memory::MachinePageCount> prefetchPages_{0};
+  // Number of prewarmFromSsd() calls running in the background.
+  std::atomic<int32_t> prewarmsInProgress_{0};
 
   // Approximate counter of bytes allocated to cover misses. When this
   // exceeds 'nextSsdScoreSize_' we update the SSD admission criteria.
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <folly/hash/Hash.h>
+
+#include "velox/common/base/BitUtil.h"
+#include "velox/common/base/Exceptions.h"
+
+namespace facebook::velox::cache {
+
+/// Count-min sketch of the access frequency of cache keys, used as the
+/// TinyLFU admission filter of a CacheShard. Keeps 4 rows of saturating
+/// counters capped at 15. The estimate of a key is the minimum of its
+/// counters. All counters are halved after 10 increments per counter in a row
+/// so that the sketch tracks recent frequency. Not thread safe.
+class FrequencySketch {
+ public:
+  static constexpr int32_t kMaxCount = 15;
+
+  /// 'width' is the number of counters per row, rounded up to a power of 2.
+  explicit FrequencySketch(uint32_t width)
+      : width_(bits::nextPowerOfTwo(std::max<uint32_t>(width, 64))),
+        sampleSize_(10 * width_),
+        counters_(kDepth * width_, 0) {}
+
+  /// Counts an access to the key with 'hash'.
+  void increment(uint64_t hash) {
+    for (auto row = 0; row < kDepth; ++row) {
+      auto& counter = counters_[row * width_ + index(hash, row)];
+      if (counter < kMaxCount) {
+        ++counter;
+      }
+    }
+    if (++numIncrements_ >= sampleSize_) {
+      age();
+    }
+  }
+
+  /// Returns the estimated recent access count of the key with 'hash'.
+  int32_t estimate(uint64_t hash) const {
+    int32_t count = kMaxCount;
+    for (auto row = 0; row < kDepth; ++row) {
+      count = std::min<int32_t>(
+          count, counters_[row * width_ + index(hash, row)]);
+    }
+    return count;
+  }
+
+  uint32_t width() const {
+    return width_;
+  }
+
+ private:
+  static constexpr int32_t kDepth = 4;
+
+  uint32_t index(uint64_t hash, int32_t row) const {
+    return folly::hash::twang_mix64(hash + row * 0x9E3779B97F4A7C15ULL) &
+        (width_ - 1);
+  }
+
+  // Halves all counters.
+  void age() {
+    for (auto& counter : counters_) {
+      counter >>= 1;
+    }
+    numIncrements_ /= 2;
+  }
+
+  const uint32_t width_;
+  const uint64_t sampleSize_;
+  std::vector<uint8_t> counters_;
+  uint64_t numIncrements_{0};
+};
+
+} // namespace facebook::velox::cache
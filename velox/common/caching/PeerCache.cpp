@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/caching/PeerCache.h"
+
+#include <algorithm>
+
+#include <fmt/format.h>
+#include <folly/hash/Hash.h>
+
+#include "velox/common/base/Exceptions.h"
+#include "velox/common/caching/AsyncDataCache.h"
+#include "velox/common/caching/FileIds.h"
+
+namespace facebook::velox::cache {
+namespace {
+// Hash that is the same on all workers.
+uint64_t ringHash(std::string_view string) {
+  return folly::hash::fnv64_buf(string.data(), string.size());
+}
+
+// Copies bytes into a sequence of ranges, skipping the ranges with no data.
+class RangesWriter {
+ public:
+  explicit RangesWriter(const std::vector<folly::Range<char*>>& ranges)
+      : ranges_(ranges) {}
+
+  void write(const char* data, uint64_t size) {
+    while (size > 0) {
+      VELOX_CHECK_LT(rangeIndex_, ranges_.size());
+      const auto& range = ranges_[rangeIndex_];
+      const auto bytes = std::min<uint64_t>(size, range.size() - rangeOffset_);
+      if (range.data() != nullptr) {
+        ::memcpy(range.data() + rangeOffset_, data, bytes);
+      }
+      data += bytes;
+      size -= bytes;
+      rangeOffset_ += bytes;
+      if (rangeOffset_ == range.size()) {
+        ++rangeIndex_;
+        rangeOffset_ = 0;
+      }
+    }
+  }
+
+ private:
+  const std::vector<folly::Range<char*>>& ranges_;
+  size_t rangeIndex_{0};
+  uint64_t rangeOffset_{0};
+};
+} // namespace
+
+PeerCache::PeerCache(
+    std::vector<std::string> peers,
+    std::string self,
+    int32_t numVirtualNodes)
+    : peers_(std::move(peers)), self_(std::move(self)) {
+  VELOX_CHECK(!peers_.empty());
+  VELOX_CHECK_GT(numVirtualNodes, 0);
+  VELOX_CHECK(
+      std::find(peers_.begin(), peers_.end(), self_) != peers_.end(),
+      "Worker {} is not one of the peers",
+      self_);
+  ring_.reserve(peers_.size() * numVirtualNodes);
+  for (auto peer = 0; peer < peers_.size(); ++peer) {
+    for (auto node = 0; node < numVirtualNodes; ++node) {
+      ring_.emplace_back(
+          ringHash(fmt::format("{}#{}", peers_[peer], node)), peer);
+    }
+  }
+  std::sort(ring_.begin(), ring_.end());
+}
+
+const std::string& PeerCache::owner(std::string_view fileName) const {
+  const auto hash = ringHash(fileName);
+  auto it = std::lower_bound(
+      ring_.begin(),
+      ring_.end(),
+      hash,
+      [](const auto& point, uint64_t value) { return point.first < value; });
+  if (it == ring_.end()) {
+    it = ring_.begin();
+  }
+  return peers_[it->second];
+}
+
+bool PeerCache::read(
+    std::string_view fileName,
+    uint64_t offset,
+    const std::vector<folly::Range<char*>>& buffers) {
+  const auto& peer = owner(fileName);
+  if (peer == self_) {
+    return false;
+  }
+  if (!readFromPeer(peer, fileName, offset, buffers)) {
+    ++numMisses_;
+    return false;
+  }
+  ++numHits_;
+  for (const auto& buffer : buffers) {
+    if (buffer.data() != nullptr) {
+      hitBytes_ += buffer.size();
+    }
+  }
+  return true;
+}
+
+// static
+bool PeerCache::readFromCache(
+    AsyncDataCache& cache,
+    std::string_view fileName,
+    uint64_t offset,
+    const std::vector<folly::Range<char*>>& buffers) {
+  const auto fileNum = fileIds().id(fileName);
+  if (fileNum == StringIdMap::kNoId) {
+    return false;
+  }
+  uint64_t remaining = 0;
+  for (const auto& buffer : buffers) {
+    remaining += buffer.size();
+  }
+  RangesWriter writer(buffers);
+  auto position = offset;
+  while (remaining > 0) {
+    auto pin = cache.find(RawFileCacheKey{fileNum, position});
+    if (pin.empty()) {
+      return false;
+    }
+    auto* entry = pin.checkedEntry();
+    const auto entryBytes = std::min<uint64_t>(entry->size(), remaining);
+    if (entry->tinyData() != nullptr) {
+      writer.write(entry->tinyData(), entryBytes);
+    } else {
+      auto bytes = entryBytes;
+      const auto& allocation = entry->data();
+      for (auto i = 0; i < allocation.numRuns() && bytes > 0; ++i) {
+        const auto run = allocation.runAt(i);
+        const auto runBytes = std::min<uint64_t>(run.numBytes(), bytes);
+        writer.write(run.data<char>(), runBytes);
+        bytes -= runBytes;
+      }
+    }
+    position += entryBytes;
+    remaining -= entryBytes;
+  }
+  return true;
+}
+
+} // namespace facebook::velox::cache
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <folly/Range.h>
+
+namespace facebook::velox::cache {
+
+class AsyncDataCache;
+
+/// Client side of a cooperative cache between the workers of a cluster. Each
+/// file is owned by one worker, chosen by consistent hashing of the file
+/// name, so that adding or removing a worker moves only a small part of the
+/// files. When a worker misses its own cache for a file owned by a peer, it
+/// asks the peer for the bytes before going to storage. This keeps data that
+/// a peer has already read useful after split affinity is lost, e.g. on
+/// rebalancing or scale out.
+///
+/// The transport is up to the embedding application: a subclass implements
+/// readFromPeer() by sending the request over e.g. the exchange transport,
+/// and the peer serves it with readFromCache() on its own cache.
+class PeerCache {
+ public:
+  struct Stats {
+    /// Number of reads served by a peer.
+    uint64_t numHits{0};
+    /// Number of reads for a peer owned file that the peer could not serve.
+    uint64_t numMisses{0};
+    /// Bytes served by peers.
+    uint64_t hitBytes{0};
+  };
+
+  /// 'peers' are the ids of all the workers that share their caches,
+  /// including this worker, which is 'self'. Each peer is placed at
+  /// 'numVirtualNodes' points of the hash ring to even out the ownership.
+  PeerCache(
+      std::vector<std::string> peers,
+      std::string self,
+      int32_t numVirtualNodes = 64);
+
+  virtual ~PeerCache() = default;
+
+  /// Returns the id of the worker that owns 'fileName'.
+  const std::string& owner(std::string_view fileName) const;
+
+  /// Reads the bytes starting at 'offset' of 'fileName' into 'buffers' from
+  /// the owning peer. Ranges with a null data pointer stand for bytes to
+  /// skip, as in ReadFile::preadv(). Returns false if this worker owns the
+  /// file or if the peer does not have all the bytes, in which case the
+  /// caller reads from storage.
+  bool read(
+      std::string_view fileName,
+      uint64_t offset,
+      const std::vector<folly::Range<char*>>& buffers);
+
+  /// Serves a read() from 'peer' out of 'cache'. The bytes must be covered by
+  /// consecutive cache entries starting at 'offset', i.e. the peer must load
+  /// the file with the same load quantum. Returns false if any of the bytes
+  /// are not in memory. Does not load anything into 'cache'.
+  static bool readFromCache(
+      AsyncDataCache& cache,
+      std::string_view fileName,
+      uint64_t offset,
+      const std::vector<folly::Range<char*>>& buffers);
+
+  Stats stats() const {
+    return Stats{numHits_, numMisses_, hitBytes_};
+  }
+
+ protected:
+  /// Sends a read() to 'peer'. Returns false if the peer could not serve all
+  /// the bytes or could not be reached.
+  virtual bool readFromPeer(
+      const std::string& peer,
+      std::string_view fileName,
+      uint64_t offset,
+      const std::vector<folly::Range<char*>>& buffers) = 0;
+
+ private:
+  const std::vector<std::string> peers_;
+  const std::string self_;
+  // Points of the hash ring as pairs of hash and index in 'peers_', in
+  // ascending order of hash.
+  std::vector<std::pair<uint64_t, int32_t>> ring_;
+
+  std::atomic<uint64_t> numHits_{0};
+  std::atomic<uint64_t> numMisses_{0};
+  std::atomic<uint64_t> hitBytes_{0};
+};
+
+} // namespace facebook::velox::cache
@@ -19,9 +19,11 @@
 #include <folly/container/F14Map.h>
 #include <cstdint>
 #include <mutex>
+#include <string>
 
 #include "velox/common/base/BitUtil.h"
 #include "velox/common/base/Exceptions.h"
+#include "velox/common/base/SelectivityInfo.h"
 
 namespace facebook::velox::cache {
 
@@ -129,6 +131,18 @@ class ScanTracker {
     return readPct(id) >= minReadPct;
   }
 
+  /// True if 'trackingId' has been referenced and is read at least
+  /// 'minReadPct' % of the time. Unlike shouldPrefetch(), false if there is no
+  /// data. A stream that the scan consistently reads is likely to be read
+  /// again by later scans of the same data, so that it is worth keeping on
+  /// SSD.
+  bool predictsReuse(TrackingId id, int32_t minReadPct) {
+    std::lock_guard<std::mutex> l(mutex_);
+    const auto& data = data_[id];
+    return data.referencedBytes > 0 &&
+        data.readBytes / data.referencedBytes * 100 >= minReadPct;
+  }
+
   /// Returns the percentage of referenced columns that are actually read. 100%
   /// if no data.
   int32_t readPct(TrackingId id) {
@@ -145,6 +159,19 @@ class ScanTracker {
     return data_[id];
   }
 
+  /// Adds 'delta', the stats of the filter on 'field' collected by one scan
+  /// since its previous call, to the stats shared by all the scans with the
+  /// same id. Returns the shared stats so that a scan starting a new split can
+  /// order its filters by what all the scans have seen so far.
+  SelectivityInfo updateSelectivity(
+      const std::string& field,
+      const SelectivityInfo& delta) {
+    std::lock_guard<std::mutex> l(mutex_);
+    auto& selectivity = selectivity_[field];
+    selectivity += delta;
+    return selectivity;
+  }
+
   std::string_view id() const {
     return id_;
   }
@@ -164,6 +191,8 @@ class ScanTracker {
   std::mutex mutex_;
   folly::F14FastMap<TrackingId, TrackingData> data_;
   TrackingData sum_;
+  // Filter stats of the top level columns, by column name.
+  folly::F14FastMap<std::string, SelectivityInfo> selectivity_;
 };
 
 } // namespace facebook::velox::cache
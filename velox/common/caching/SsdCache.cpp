@@ -176,6 +176,16 @@ bool SsdCache::removeFileEntries(
   return success;
 }
 
+std::vector<std::vector<std::pair<RawFileCacheKey, int32_t>>>
+SsdCache::hotEntries(uint64_t maxBytes) {
+  std::vector<std::vector<std::pair<RawFileCacheKey, int32_t>>> result;
+  result.reserve(numShards_);
+  for (auto& file : files_) {
+    result.push_back(file->hotEntries(maxBytes / numShards_));
+  }
+  return result;
+}
+
 SsdCacheStats SsdCache::stats() const {
   SsdCacheStats stats;
   for (auto& file : files_) {
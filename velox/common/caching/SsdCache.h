@@ -140,6 +140,11 @@ class SsdCache {
       const folly::F14FastSet<uint64_t>& filesToRemove,
       folly::F14FastSet<uint64_t>& filesRetained);
 
+  /// Returns SsdFile::hotEntries() of each shard, allowing each shard an
+  /// equal part of 'maxBytes'.
+  std::vector<std::vector<std::pair<RawFileCacheKey, int32_t>>> hotEntries(
+      uint64_t maxBytes);
+
   /// Returns stats aggregated from all shards.
   SsdCacheStats stats() const;
 
@@ -153,6 +158,10 @@ class SsdCache {
 
   std::string toString() const;
 
+  folly::Executor* executor() const {
+    return executor_;
+  }
+
   const std::string& filePrefix() const {
     return filePrefix_;
   }
@@ -16,6 +16,7 @@
 
 #include "velox/common/caching/SsdFile.h"
 
+#include <folly/futures/Future.h>
 #include <folly/portability/SysUio.h>
 #include "velox/common/base/AsyncSource.h"
 #include "velox/common/base/Crc.h"
@@ -177,6 +178,55 @@ SsdPin SsdFile::find(RawFileCacheKey key) {
   return SsdPin(*this, run);
 }
 
+std::vector<std::pair<RawFileCacheKey, int32_t>> SsdFile::hotEntries(
+    uint64_t maxBytes) {
+  std::vector<std::pair<RawFileCacheKey, int32_t>> result;
+  std::shared_lock<std::shared_mutex> l(mutex_);
+  if (suspended_ || entries_.empty()) {
+    return result;
+  }
+  // Region read scores are persisted in the checkpoint, entry access counts
+  // are not. Takes the entries of the most read regions first.
+  const auto& scores = tracker_.regionScores();
+  std::vector<int32_t> regions(numRegions_);
+  std::iota(regions.begin(), regions.end(), 0);
+  std::sort(regions.begin(), regions.end(), [&](int32_t left, int32_t right) {
+    return scores[left] > scores[right];
+  });
+  std::vector<std::vector<std::pair<RawFileCacheKey, SsdRun>>> regionEntries(
+      numRegions_);
+  for (const auto& [key, run] : entries_) {
+    regionEntries[regionIndex(run.offset())].push_back(
+        {RawFileCacheKey{key.fileNum.id(), key.offset}, run});
+  }
+  std::vector<std::pair<RawFileCacheKey, SsdRun>> selected;
+  uint64_t selectedBytes = 0;
+  for (const auto region : regions) {
+    if (selectedBytes >= maxBytes) {
+      break;
+    }
+    for (const auto& entry : regionEntries[region]) {
+      if (selectedBytes + entry.second.size() > maxBytes) {
+        break;
+      }
+      selected.push_back(entry);
+      selectedBytes += entry.second.size();
+    }
+  }
+  // Ascending SSD offsets let the loads coalesce.
+  std::sort(
+      selected.begin(),
+      selected.end(),
+      [](const auto& left, const auto& right) {
+        return left.second.offset() < right.second.offset();
+      });
+  result.reserve(selected.size());
+  for (const auto& [key, run] : selected) {
+    result.emplace_back(key, run.size());
+  }
+  return result;
+}
+
 bool SsdFile::erase(RawFileCacheKey key) {
   FileCacheKey ssdKey{StringIdLease(fileIds(), key.fileNum), key.offset};
   std::lock_guard<std::shared_mutex> l(mutex_);
@@ -195,22 +245,11 @@ CoalesceIoStats SsdFile::load(
   if (pins.empty()) {
     return CoalesceIoStats();
   }
-  size_t totalPayloadBytes = 0;
-  for (auto i = 0; i < pins.size(); ++i) {
-    const auto runSize = ssdPins[i].run().size();
-    auto* entry = pins[i].checkedEntry();
-    if (FOLLY_UNLIKELY(runSize < entry->size())) {
-      ++stats_.readSsdErrors;
-      VELOX_FAIL(
-          "IOERR: SSD cache cache entry {} short than requested range {}",
-          succinctBytes(runSize),
-          succinctBytes(entry->size()));
-    }
-    totalPayloadBytes += entry->size();
-    regionRead(regionIndex(ssdPins[i].run().offset()), runSize);
-    ++stats_.entriesRead;
-    stats_.bytesRead += entry->size();
+  if (readFile_->hasPreadvAsync()) {
+    // Submits all the coalesced reads before waiting for any of them.
+    return loadAsync(ssdPins, pins).get();
   }
+  const auto totalPayloadBytes = prepareLoad(ssdPins, pins);
 
   // Do coalesced IO for the pins. For short payloads, the break-even between
   // discrete pread calls and a single preadv that discards gaps is ~25K per
@@ -230,14 +269,80 @@ CoalesceIoStats SsdFile::load(
           const std::vector<folly::Range<char*>>& buffers) {
         read(offset, buffers);
       });
+  finishLoad(ssdPins, pins);
+  return stats;
+}
+
+folly::SemiFuture<CoalesceIoStats> SsdFile::loadAsync(
+    const std::vector<SsdPin>& ssdPins,
+    const std::vector<CachePin>& pins) {
+  VELOX_CHECK_EQ(ssdPins.size(), pins.size());
+  if (pins.empty()) {
+    return folly::makeSemiFuture(CoalesceIoStats());
+  }
+  const auto totalPayloadBytes = prepareLoad(ssdPins, pins);
+
+  // The buffers of the reads in flight. Kept alive until all reads complete
+  // since the file may read into them after the submitting call returns.
+  auto buffers =
+      std::make_shared<std::vector<std::vector<folly::Range<char*>>>>();
+  std::vector<folly::SemiFuture<uint64_t>> reads;
+  const auto stats = readPins(
+      pins,
+      totalPayloadBytes / pins.size() < 10000 ? 25000 : 50000,
+      900,
+      [&](int32_t index) { return ssdPins[index].run().offset(); },
+      [&](const std::vector<CachePin>& /*pins*/,
+          int32_t /*begin*/,
+          int32_t /*end*/,
+          uint64_t offset,
+          const std::vector<folly::Range<char*>>& ranges) {
+        buffers->push_back(ranges);
+        reads.push_back(readFile_->preadvAsync(offset, buffers->back()));
+      });
+  return folly::collectAll(std::move(reads))
+      .deferValue([this, &ssdPins, &pins, stats, buffers](
+                      std::vector<folly::Try<uint64_t>>&& results) {
+        for (auto& result : results) {
+          // Rethrows the first read error.
+          result.value();
+        }
+        finishLoad(ssdPins, pins);
+        return stats;
+      });
+}
 
+size_t SsdFile::prepareLoad(
+    const std::vector<SsdPin>& ssdPins,
+    const std::vector<CachePin>& pins) {
+  size_t totalPayloadBytes = 0;
+  for (auto i = 0; i < pins.size(); ++i) {
+    const auto runSize = ssdPins[i].run().size();
+    auto* entry = pins[i].checkedEntry();
+    if (FOLLY_UNLIKELY(runSize < entry->size())) {
+      ++stats_.readSsdErrors;
+      VELOX_FAIL(
+          "IOERR: SSD cache cache entry {} short than requested range {}",
+          succinctBytes(runSize),
+          succinctBytes(entry->size()));
+    }
+    totalPayloadBytes += entry->size();
+    regionRead(regionIndex(ssdPins[i].run().offset()), runSize);
+    ++stats_.entriesRead;
+    stats_.bytesRead += entry->size();
+  }
+  return totalPayloadBytes;
+}
+
+void SsdFile::finishLoad(
+    const std::vector<SsdPin>& ssdPins,
+    const std::vector<CachePin>& pins) {
   for (auto i = 0; i < ssdPins.size(); ++i) {
     pins[i].checkedEntry()->setSsdFile(this, ssdPins[i].run().offset());
     auto* entry = pins[i].checkedEntry();
     auto ssdRun = ssdPins[i].run();
     maybeVerifyChecksum(*entry, ssdRun);
   }
-  return stats;
 }
 
 void SsdFile::read(
@@ -308,6 +308,12 @@ class SsdFile {
   /// Finds an entry for 'key'. If no entry is found, the returned pin is empty.
   SsdPin find(RawFileCacheKey key);
 
+  /// Returns the keys and sizes of the entries in the most read regions, up to
+  /// 'maxBytes' in total, in ascending order of their offset in this file.
+  /// Used for warming up the memory cache after recovering from a checkpoint.
+  std::vector<std::pair<RawFileCacheKey, int32_t>> hotEntries(
+      uint64_t maxBytes);
+
   /// Erases 'key'
   bool erase(RawFileCacheKey key);
   /// Copies the data in 'ssdPins' into 'pins'. Coalesces IO for nearby
@@ -316,6 +322,15 @@ class SsdFile {
       const std::vector<SsdPin>& ssdPins,
       const std::vector<CachePin>& pins);
 
+  /// Like load() but submits all the coalesced reads to the file up front and
+  /// returns a future that is realized when all of them complete. The reads
+  /// run in the background if the file has a native preadvAsync(), so the
+  /// caller does not hold a thread per read. 'ssdPins' and 'pins' must stay
+  /// alive until the future is realized.
+  folly::SemiFuture<CoalesceIoStats> loadAsync(
+      const std::vector<SsdPin>& ssdPins,
+      const std::vector<CachePin>& pins);
+
   /// Increments the pin count of the region of 'offset'.
   void pinRegion(uint64_t offset);
 
@@ -434,6 +449,17 @@ class SsdFile {
   // Reads the backing file with ReadFile::preadv().
   void read(uint64_t offset, const std::vector<folly::Range<char*>>& buffers);
 
+  // Checks that 'ssdPins' cover 'pins' and updates the read stats before
+  // loading 'pins'. Returns the total size of 'pins'.
+  size_t prepareLoad(
+      const std::vector<SsdPin>& ssdPins,
+      const std::vector<CachePin>& pins);
+
+  // Marks the loaded 'pins' as being on SSD and verifies their checksums.
+  void finishLoad(
+      const std::vector<SsdPin>& ssdPins,
+      const std::vector<CachePin>& pins);
+
   // Verifies that 'entry' has the data at 'run'.
   void verifyWrite(AsyncDataCacheEntry& entry, SsdRun run);
 
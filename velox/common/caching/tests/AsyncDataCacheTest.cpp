@@ -948,7 +948,7 @@ TEST_P(AsyncDataCacheTest, cacheStats) {
       "Cache size: 2.56KB tinySize: 257B large size: 2.31KB\n"
       "Cache entries: 100 read pins: 30 write pins: 20 pinned shared: 10.00MB pinned exclusive: 10.00MB\n"
       " num write wait: 244 empty entries: 20\n"
-      "Cache access miss: 2041 hit: 46 hit bytes: 1.34KB eviction: 463 savable eviction: 0 eviction checks: 348 aged out: 10 stales: 100\n"
+      "Cache access miss: 2041 hit: 46 hit bytes: 1.34KB eviction: 463 savable eviction: 0 eviction checks: 348 aged out: 10 stales: 100 admission rejects: 0\n"
       "Prefetch entries: 30 bytes: 100B\n"
       "Alloc Megaclocks 0");
 
@@ -984,7 +984,7 @@ TEST_P(AsyncDataCacheTest, cacheStats) {
       "Cache size: 0B tinySize: 0B large size: 0B\n"
       "Cache entries: 0 read pins: 0 write pins: 0 pinned shared: 0B pinned exclusive: 0B\n"
       " num write wait: 0 empty entries: 0\n"
-      "Cache access miss: 0 hit: 0 hit bytes: 0B eviction: 0 savable eviction: 0 eviction checks: 0 aged out: 0 stales: 0\n"
+      "Cache access miss: 0 hit: 0 hit bytes: 0B eviction: 0 savable eviction: 0 eviction checks: 0 aged out: 0 stales: 0 admission rejects: 0\n"
       "Prefetch entries: 0 bytes: 0B\n"
       "Alloc Megaclocks 0\n"
       "Allocated pages: 0 cached pages: 0\n"
@@ -1008,7 +1008,7 @@ TEST_P(AsyncDataCacheTest, cacheStats) {
       "Cache size: 0B tinySize: 0B large size: 0B\n"
       "Cache entries: 0 read pins: 0 write pins: 0 pinned shared: 0B pinned exclusive: 0B\n"
       " num write wait: 0 empty entries: 0\n"
-      "Cache access miss: 0 hit: 0 hit bytes: 0B eviction: 0 savable eviction: 0 eviction checks: 0 aged out: 0 stales: 0\n"
+      "Cache access miss: 0 hit: 0 hit bytes: 0B eviction: 0 savable eviction: 0 eviction checks: 0 aged out: 0 stales: 0 admission rejects: 0\n"
       "Prefetch entries: 0 bytes: 0B\n"
       "Alloc Megaclocks 0\n"
       "Allocated pages: 0 cached pages: 0\n";
@@ -1031,7 +1031,7 @@ TEST_P(AsyncDataCacheTest, cacheStatsWithSsd) {
   ASSERT_EQ(deltaStats.ssdStats->bytesWritten, 1);
   ASSERT_EQ(deltaStats.ssdStats->bytesRead, 1);
   const std::string expectedDeltaCacheStats =
-      "Cache size: 0B tinySize: 0B large size: 0B\nCache entries: 0 read pins: 0 write pins: 0 pinned shared: 0B pinned exclusive: 0B\n num write wait: 0 empty entries: 0\nCache access miss: 0 hit: 234 hit bytes: 0B eviction: 1024 savable eviction: 0 eviction checks: 0 aged out: 0 stales: 0\nPrefetch entries: 0 bytes: 0B\nAlloc Megaclocks 0";
+      "Cache size: 0B tinySize: 0B large size: 0B\nCache entries: 0 read pins: 0 write pins: 0 pinned shared: 0B pinned exclusive: 0B\n num write wait: 0 empty entries: 0\nCache access miss: 0 hit: 234 hit bytes: 0B eviction: 1024 savable eviction: 0 eviction checks: 0 aged out: 0 stales: 0 admission rejects: 0\nPrefetch entries: 0 bytes: 0B\nAlloc Megaclocks 0";
   ASSERT_EQ(deltaStats.toString(), expectedDeltaCacheStats);
 }
 
@@ -1076,6 +1076,169 @@ TEST_P(AsyncDataCacheTest, staleEntry) {
   ASSERT_EQ(stats.numHit, 1);
 }
 
+TEST_P(AsyncDataCacheTest, admissionFilter) {
+  constexpr uint64_t kRamBytes = 128UL << 20;
+  constexpr int32_t kDataSize = 1 << 20;
+  for (const bool admissionFilter : {false, true}) {
+    SCOPED_TRACE(fmt::format("admissionFilter: {}", admissionFilter));
+    initializeCache(
+        kRamBytes,
+        0,
+        0,
+        false,
+        AsyncDataCache::Options(0.7, 0.125, 1 << 24, admissionFilter));
+    // Scans twice the cache capacity once, so that the later entries replace
+    // the earlier ones.
+    const int32_t numEntries = 2 * kRamBytes / kDataSize;
+    for (int32_t i = 0; i < numEntries; ++i) {
+      auto pin = newEntry(static_cast<uint64_t>(i) * kDataSize, kDataSize);
+      ASSERT_FALSE(pin.empty());
+      pin.entry()->setExclusiveToShared();
+    }
+    const auto stats = cache_->refreshStats();
+    ASSERT_EQ(stats.numNew, numEntries);
+    ASSERT_GT(stats.numEvict, 0);
+    if (admissionFilter) {
+      // Each scanned key is seen once, no more often than its victim.
+      ASSERT_GT(stats.numAdmissionRejects, 0);
+    } else {
+      ASSERT_EQ(stats.numAdmissionRejects, 0);
+    }
+  }
+}
+
+TEST_P(AsyncDataCacheTest, concurrentHits) {
+  constexpr int32_t kNumEntries = 16;
+  constexpr int32_t kNumThreads = 8;
+  constexpr int32_t kNumHitsPerThread = 10'000;
+  constexpr int32_t kDataSize = 4096;
+  initializeCache(64 << 20);
+  for (int32_t i = 0; i < kNumEntries; ++i) {
+    auto pin = newEntry(static_cast<uint64_t>(i) * kDataSize, kDataSize);
+    ASSERT_FALSE(pin.empty());
+    pin.entry()->setPrefetch(false);
+    pin.entry()->setExclusiveToShared();
+  }
+  const auto hitsBefore = cache_->refreshStats().numHit;
+
+  std::vector<std::thread> threads;
+  threads.reserve(kNumThreads);
+  std::atomic<int32_t> numMisses{0};
+  for (int32_t i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&, i]() {
+      for (int32_t j = 0; j < kNumHitsPerThread; ++j) {
+        const RawFileCacheKey key{
+            filenames_[0].id(),
+            static_cast<uint64_t>((i + j) % kNumEntries) * kDataSize};
+        auto pin = cache_->findOrCreate(key, kDataSize);
+        if (pin.empty() || !pin.entry()->isShared()) {
+          ++numMisses;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(numMisses, 0);
+  const auto stats = cache_->refreshStats();
+  ASSERT_EQ(stats.numHit - hitsBefore, kNumThreads * kNumHitsPerThread);
+  ASSERT_EQ(stats.numShared, 0);
+  ASSERT_EQ(stats.numExclusive, 0);
+}
+
+TEST_P(AsyncDataCacheTest, keepResident) {
+  constexpr uint64_t kRamBytes = 128UL << 20;
+  constexpr int32_t kDataSize = 1 << 20;
+  constexpr int32_t kNumFirst = 32;
+  initializeCache(kRamBytes);
+  // Every other one of the first entries is kept resident.
+  for (int32_t i = 0; i < kNumFirst; ++i) {
+    auto pin = newEntry(static_cast<uint64_t>(i) * kDataSize, kDataSize);
+    ASSERT_FALSE(pin.empty());
+    pin.entry()->setKeepResident(i % 2 == 0);
+    pin.entry()->setExclusiveToShared();
+  }
+  // Scans twice the cache capacity to evict the first entries.
+  const int32_t numEntries = 2 * kRamBytes / kDataSize;
+  for (int32_t i = kNumFirst; i < kNumFirst + numEntries; ++i) {
+    auto pin = newEntry(static_cast<uint64_t>(i) * kDataSize, kDataSize);
+    ASSERT_FALSE(pin.empty());
+    pin.entry()->setExclusiveToShared();
+  }
+  int32_t numResident = 0;
+  int32_t numOther = 0;
+  for (int32_t i = 0; i < kNumFirst; ++i) {
+    const RawFileCacheKey key{
+        filenames_[0].id(), static_cast<uint64_t>(i) * kDataSize};
+    if (!cache_->find(key).empty()) {
+      ++(i % 2 == 0 ? numResident : numOther);
+    }
+  }
+  ASSERT_GT(numResident, numOther);
+
+  // An expired entry is evictable regardless of its score.
+  auto pin = newEntry(
+      static_cast<uint64_t>(kNumFirst + numEntries) * kDataSize, kDataSize);
+  ASSERT_FALSE(pin.empty());
+  auto* entry = pin.checkedEntry();
+  entry->setKeepResident(true);
+  entry->setExclusiveToShared();
+  ASSERT_FALSE(entry->isExpired(getCurrentTimeSec()));
+  entry->setExpireTimeSec(getCurrentTimeSec() - 1);
+  ASSERT_TRUE(entry->isExpired(getCurrentTimeSec()));
+  entry->makeEvictable();
+  ASSERT_FALSE(entry->keepResident());
+}
+
+TEST_P(AsyncDataCacheTest, ssdAdmission) {
+  constexpr uint64_t kRamBytes = 32UL << 20;
+  constexpr uint64_t kSsdBytes = 128UL << 20;
+  constexpr int32_t kDataSize = 1 << 20;
+  initializeCache(
+      kRamBytes,
+      kSsdBytes,
+      0,
+      true,
+      {0.8, 0.3, 4UL << 20, false, false, 0, /*_ssdAdmissionMinUses=*/1});
+  {
+    auto pin = newEntry(0, kDataSize);
+    ASSERT_FALSE(pin.empty());
+    pin.entry()->setExclusiveToShared();
+    // Not written to SSD unless reused.
+    ASSERT_FALSE(pin.entry()->ssdSaveable());
+  }
+  {
+    auto pin = newEntry(kDataSize, kDataSize);
+    ASSERT_FALSE(pin.empty());
+    pin.entry()->setExclusiveToShared(true, /*reusePredicted=*/true);
+    ASSERT_TRUE(pin.entry()->ssdSaveable());
+  }
+
+  // Every other entry is hit once and is admitted to SSD when picked for
+  // eviction.
+  const int32_t numEntries = 4 * kRamBytes / kDataSize;
+  int32_t numReused = 1;
+  for (int32_t i = 2; i < 2 + numEntries; ++i) {
+    const uint64_t offset = static_cast<uint64_t>(i) * kDataSize;
+    auto pin = newEntry(offset, kDataSize);
+    ASSERT_FALSE(pin.empty());
+    pin.entry()->setExclusiveToShared();
+    pin.clear();
+    if (i % 2 == 0) {
+      ASSERT_FALSE(
+          cache_->findOrCreate({filenames_[0].id(), offset}, kDataSize)
+              .empty());
+      ++numReused;
+    }
+  }
+  waitForSsdWriteToFinish(cache_->ssdCache());
+  const auto stats = cache_->refreshStats();
+  ASSERT_GT(stats.numSsdAdmissions, 0);
+  ASSERT_GT(stats.ssdStats->entriesWritten, 0);
+  ASSERT_LE(stats.ssdStats->entriesWritten, numReused);
+}
+
 TEST_P(AsyncDataCacheTest, shrinkCache) {
   constexpr uint64_t kRamBytes = 128UL << 20;
   constexpr uint64_t kSsdBytes = 512UL << 20;
@@ -1570,6 +1733,36 @@ TEST_P(AsyncDataCacheTest, checkpoint) {
   ASSERT_EQ(stats.ssdStats->checkpointsWritten, kNumSsdShards);
 }
 
+TEST_P(AsyncDataCacheTest, prewarmFromSsd) {
+  constexpr uint64_t kRamBytes = 64UL << 20; // 64 MB
+  constexpr uint64_t kSsdBytes = 128UL << 20; // 128 MB
+  constexpr uint64_t kPrewarmBytes = 8UL << 20; // 8 MB
+  initializeCache(kRamBytes, kSsdBytes, 0, true, {0.8, 0.3, 4UL << 20});
+  ASSERT_EQ(cache_->prewarmFromSsd(0), 0);
+
+  loadLoop(0, kRamBytes / 2);
+  waitForPendingLoads();
+  waitForSsdWriteToFinish(cache_->ssdCache());
+  auto stats = cache_->refreshStats();
+  ASSERT_GT(stats.ssdStats->entriesWritten, 0);
+
+  // Drops the memory cache as if the process restarted with the SSD cache.
+  cache_->clear();
+  stats = cache_->refreshStats();
+  const auto numPrefetch = stats.numPrefetch;
+  const auto entriesRead = stats.ssdStats->entriesRead;
+
+  const auto loadedBytes = cache_->prewarmFromSsd(kPrewarmBytes);
+  ASSERT_GT(loadedBytes, 0);
+  ASSERT_LE(loadedBytes, kPrewarmBytes);
+  stats = cache_->refreshStats();
+  ASSERT_GT(stats.numPrefetch, numPrefetch);
+  ASSERT_GT(stats.ssdStats->entriesRead, entriesRead);
+
+  // The same entries are found in memory the second time.
+  ASSERT_EQ(cache_->prewarmFromSsd(kPrewarmBytes), 0);
+}
+
 // TODO: add concurrent fuzzer test.
 
 INSTANTIATE_TEST_SUITE_P(
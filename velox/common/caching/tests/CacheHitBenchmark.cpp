@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gflags/gflags.h>
+#include <glog/logging.h>
+#include <folly/Random.h>
+
+#include <thread>
+
+#include "velox/common/base/SuccinctPrinter.h"
+#include "velox/common/caching/AsyncDataCache.h"
+#include "velox/common/caching/FileIds.h"
+#include "velox/common/memory/Memory.h"
+#include "velox/common/time/Timer.h"
+
+DEFINE_uint32(num_threads, 64, "The number of threads looking up the cache");
+DEFINE_uint32(num_entries, 4'096, "The number of cached entries");
+DEFINE_uint32(entry_size, 64 << 10, "The size in bytes of a cached entry");
+DEFINE_uint32(num_hits_per_thread, 1'000'000, "The number of hits to make");
+DEFINE_bool(
+    exclusive_hits,
+    false,
+    "If true, enables the admission filter, which makes all hits take the "
+    "exclusive shard lock. Used as the baseline for shared lock hits.");
+
+using namespace facebook::velox;
+using namespace facebook::velox::cache;
+
+// Measures the throughput of concurrent hits on a hot working set that fits
+// in the cache.
+int main(int argc, char* argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  const uint64_t capacity =
+      2 * static_cast<uint64_t>(FLAGS_num_entries) * FLAGS_entry_size +
+      (256 << 20);
+  memory::MemoryManagerOptions options;
+  options.useMmapAllocator = true;
+  options.allocatorCapacity = capacity;
+  options.arbitratorCapacity = capacity;
+  memory::MemoryManager manager(options);
+  auto cache = AsyncDataCache::create(
+      manager.allocator(),
+      nullptr,
+      AsyncDataCache::Options(0.7, 0.125, 1 << 24, FLAGS_exclusive_hits));
+
+  StringIdLease file(fileIds(), std::string_view("CacheHitBenchmark"));
+  for (uint64_t i = 0; i < FLAGS_num_entries; ++i) {
+    auto pin = cache->findOrCreate(
+        RawFileCacheKey{file.id(), i * FLAGS_entry_size}, FLAGS_entry_size);
+    VELOX_CHECK(!pin.empty());
+    pin.checkedEntry()->setExclusiveToShared();
+  }
+
+  uint64_t elapsedUs{0};
+  {
+    MicrosecondTimer timer(&elapsedUs);
+    std::vector<std::thread> threads;
+    threads.reserve(FLAGS_num_threads);
+    for (auto i = 0; i < FLAGS_num_threads; ++i) {
+      threads.emplace_back([&, i]() {
+        folly::Random::DefaultGenerator rng(i);
+        for (auto j = 0; j < FLAGS_num_hits_per_thread; ++j) {
+          const uint64_t index =
+              folly::Random::rand32(FLAGS_num_entries, rng);
+          auto pin = cache->findOrCreate(
+              RawFileCacheKey{file.id(), index * FLAGS_entry_size},
+              FLAGS_entry_size);
+          VELOX_CHECK(!pin.empty());
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+  const auto numHits =
+      static_cast<uint64_t>(FLAGS_num_threads) * FLAGS_num_hits_per_thread;
+  LOG(INFO) << (FLAGS_exclusive_hits ? "Exclusive" : "Shared") << " lock hits "
+            << numHits << " in " << succinctMicros(elapsedUs) << ", "
+            << numHits * 1'000'000 / std::max<uint64_t>(1, elapsedUs)
+            << " hits/s";
+  cache->shutdown();
+  return 0;
+}
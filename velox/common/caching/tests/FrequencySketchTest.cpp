@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/caching/FrequencySketch.h"
+
+#include "gtest/gtest.h"
+
+using namespace facebook::velox::cache;
+
+TEST(FrequencySketchTest, estimate) {
+  FrequencySketch sketch(1024);
+  ASSERT_EQ(sketch.width(), 1024);
+  for (uint64_t hash = 0; hash < 100; ++hash) {
+    ASSERT_EQ(sketch.estimate(hash), 0);
+  }
+  for (auto i = 0; i < 5; ++i) {
+    sketch.increment(1);
+  }
+  sketch.increment(2);
+  // Count-min estimates never undercount.
+  ASSERT_GE(sketch.estimate(1), 5);
+  ASSERT_GE(sketch.estimate(2), 1);
+  ASSERT_LT(sketch.estimate(2), sketch.estimate(1));
+
+  // Counters saturate.
+  for (auto i = 0; i < 100; ++i) {
+    sketch.increment(3);
+  }
+  ASSERT_EQ(sketch.estimate(3), FrequencySketch::kMaxCount);
+}
+
+TEST(FrequencySketchTest, width) {
+  ASSERT_EQ(FrequencySketch(1000).width(), 1024);
+  ASSERT_EQ(FrequencySketch(1).width(), 64);
+}
+
+TEST(FrequencySketchTest, aging) {
+  FrequencySketch sketch(64);
+  // All counters are halved after 10 increments per counter in a row.
+  for (auto i = 0; i < 10 * 64 - 1; ++i) {
+    sketch.increment(1);
+  }
+  ASSERT_EQ(sketch.estimate(1), FrequencySketch::kMaxCount);
+  sketch.increment(1);
+  ASSERT_EQ(sketch.estimate(1), FrequencySketch::kMaxCount / 2);
+}
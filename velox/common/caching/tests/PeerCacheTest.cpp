@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/caching/PeerCache.h"
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/common/caching/AsyncDataCache.h"
+#include "velox/common/caching/FileIds.h"
+#include "velox/common/memory/MmapAllocator.h"
+
+#include <fmt/format.h>
+#include <unordered_map>
+
+#include "gtest/gtest.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::cache;
+
+namespace {
+// Serves reads from the caches of in-process peers.
+class TestPeerCache : public PeerCache {
+ public:
+  TestPeerCache(
+      std::vector<std::string> peers,
+      std::string self,
+      std::unordered_map<std::string, AsyncDataCache*> caches)
+      : PeerCache(std::move(peers), std::move(self)),
+        caches_(std::move(caches)) {}
+
+ protected:
+  bool readFromPeer(
+      const std::string& peer,
+      std::string_view fileName,
+      uint64_t offset,
+      const std::vector<folly::Range<char*>>& buffers) override {
+    auto it = caches_.find(peer);
+    if (it == caches_.end()) {
+      return false;
+    }
+    return readFromCache(*it->second, fileName, offset, buffers);
+  }
+
+ private:
+  const std::unordered_map<std::string, AsyncDataCache*> caches_;
+};
+
+std::vector<std::string> makePeers(int32_t numPeers) {
+  std::vector<std::string> peers;
+  for (auto i = 0; i < numPeers; ++i) {
+    peers.push_back(fmt::format("worker{}", i));
+  }
+  return peers;
+}
+} // namespace
+
+class PeerCacheTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    memory::MemoryManagerOptions options;
+    options.useMmapAllocator = true;
+    options.allocatorCapacity = 64 << 20;
+    options.arbitratorCapacity = 64 << 20;
+    manager_ = std::make_unique<memory::MemoryManager>(options);
+    cache_ = AsyncDataCache::create(manager_->allocator());
+  }
+
+  void TearDown() override {
+    cache_->shutdown();
+  }
+
+  // Caches 'size' bytes of 'fileNum' at 'offset', with byte i being the low
+  // byte of 'offset' + i.
+  void addEntry(uint64_t fileNum, uint64_t offset, int32_t size) {
+    folly::SemiFuture<bool> wait(false);
+    auto pin =
+        cache_->findOrCreate(RawFileCacheKey{fileNum, offset}, size, &wait);
+    ASSERT_FALSE(pin.empty());
+    auto* entry = pin.checkedEntry();
+    std::string data(size, 0);
+    for (auto i = 0; i < size; ++i) {
+      data[i] = static_cast<char>(offset + i);
+    }
+    if (entry->tinyData() != nullptr) {
+      ::memcpy(entry->tinyData(), data.data(), size);
+    } else {
+      auto bytes = size;
+      auto* source = data.data();
+      for (auto i = 0; i < entry->data().numRuns() && bytes > 0; ++i) {
+        const auto run = entry->data().runAt(i);
+        const auto runBytes = std::min<int32_t>(run.numBytes(), bytes);
+        ::memcpy(run.data<char>(), source, runBytes);
+        source += runBytes;
+        bytes -= runBytes;
+      }
+    }
+    entry->setExclusiveToShared();
+  }
+
+  std::unique_ptr<memory::MemoryManager> manager_;
+  std::shared_ptr<AsyncDataCache> cache_;
+};
+
+TEST_F(PeerCacheTest, owner) {
+  constexpr int32_t kNumFiles = 10'000;
+  const auto peers = makePeers(4);
+  TestPeerCache cache(peers, peers[0], {});
+  std::unordered_map<std::string, int32_t> numOwned;
+  std::vector<std::string> owners;
+  for (auto i = 0; i < kNumFiles; ++i) {
+    const auto& owner = cache.owner(fmt::format("file{}", i));
+    ++numOwned[owner];
+    owners.push_back(owner);
+  }
+  ASSERT_EQ(numOwned.size(), peers.size());
+  for (const auto& [peer, count] : numOwned) {
+    ASSERT_GT(count, kNumFiles / peers.size() / 2) << peer;
+    ASSERT_LT(count, kNumFiles / peers.size() * 2) << peer;
+  }
+
+  // Adding a peer moves files only to the new peer.
+  auto morePeers = peers;
+  morePeers.push_back("worker4");
+  TestPeerCache moreCache(morePeers, peers[0], {});
+  int32_t numMoved = 0;
+  for (auto i = 0; i < kNumFiles; ++i) {
+    const auto& owner = moreCache.owner(fmt::format("file{}", i));
+    if (owner != owners[i]) {
+      ASSERT_EQ(owner, "worker4");
+      ++numMoved;
+    }
+  }
+  ASSERT_GT(numMoved, 0);
+  ASSERT_LT(numMoved, kNumFiles / 2);
+
+  VELOX_ASSERT_THROW(
+      TestPeerCache(peers, "worker9", {}), "is not one of the peers");
+}
+
+TEST_F(PeerCacheTest, read) {
+  const auto peers = makePeers(2);
+  // Finds a file owned by the peer and one owned by this worker.
+  TestPeerCache probe(peers, peers[0], {});
+  std::string peerFile;
+  std::string selfFile;
+  for (auto i = 0; peerFile.empty() || selfFile.empty(); ++i) {
+    auto name = fmt::format("file{}", i);
+    (probe.owner(name) == peers[1] ? peerFile : selfFile) = name;
+  }
+  StringIdLease peerFileId(fileIds(), peerFile);
+  StringIdLease selfFileId(fileIds(), selfFile);
+  addEntry(peerFileId.id(), 0, 100);
+  addEntry(peerFileId.id(), 100, 100'000);
+  addEntry(selfFileId.id(), 0, 100);
+
+  TestPeerCache peerCache(peers, peers[0], {{peers[1], cache_.get()}});
+
+  // Reads across the two entries, skipping some bytes in the middle. Reads
+  // start at an entry like the loads of a worker with the same load quantum.
+  std::string first(50, 0);
+  std::string second(1000, 0);
+  std::vector<folly::Range<char*>> buffers{
+      folly::Range<char*>(first.data(), first.size()),
+      folly::Range<char*>(nullptr, reinterpret_cast<char*>(100)),
+      folly::Range<char*>(second.data(), second.size())};
+  ASSERT_TRUE(peerCache.read(peerFile, 0, buffers));
+  for (auto i = 0; i < first.size(); ++i) {
+    ASSERT_EQ(first[i], static_cast<char>(i));
+  }
+  for (auto i = 0; i < second.size(); ++i) {
+    ASSERT_EQ(second[i], static_cast<char>(150 + i));
+  }
+  auto stats = peerCache.stats();
+  ASSERT_EQ(stats.numHits, 1);
+  ASSERT_EQ(stats.numMisses, 0);
+  ASSERT_EQ(stats.hitBytes, first.size() + second.size());
+
+  // Bytes past the cached entries are a miss.
+  std::string tail(100, 0);
+  std::vector<folly::Range<char*>> tailBuffers{
+      folly::Range<char*>(tail.data(), tail.size())};
+  ASSERT_FALSE(peerCache.read(peerFile, 100'050, tailBuffers));
+  // An offset that is not at the start of an entry is a miss.
+  ASSERT_FALSE(peerCache.read(peerFile, 10, tailBuffers));
+  stats = peerCache.stats();
+  ASSERT_EQ(stats.numHits, 1);
+  ASSERT_EQ(stats.numMisses, 2);
+
+  // Files owned by this worker are read from storage.
+  ASSERT_FALSE(peerCache.read(selfFile, 0, tailBuffers));
+  ASSERT_EQ(peerCache.stats().numMisses, 2);
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/caching/ScanTracker.h"
+
+#include "gtest/gtest.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::cache;
+
+namespace {
+SelectivityInfo makeSelectivity(uint64_t numIn, uint64_t numOut) {
+  SelectivityInfo info;
+  {
+    SelectivityTimer timer(info, numIn);
+  }
+  info.addOutput(numOut);
+  return info;
+}
+} // namespace
+
+TEST(ScanTrackerTest, updateSelectivity) {
+  ScanTracker tracker("scan", nullptr, 1);
+  auto first = makeSelectivity(100, 10);
+  auto shared = tracker.updateSelectivity("c0", first);
+  EXPECT_EQ(shared.numIn(), 100);
+  EXPECT_EQ(shared.numOut(), 10);
+
+  // A second scan reports its stats on the same column.
+  shared = tracker.updateSelectivity("c0", makeSelectivity(50, 40));
+  EXPECT_EQ(shared.numIn(), 150);
+  EXPECT_EQ(shared.numOut(), 50);
+
+  // The first scan continues from the shared stats and reports only what it
+  // collected since.
+  auto local = shared;
+  local += makeSelectivity(20, 20);
+  const auto delta = local - shared;
+  EXPECT_EQ(delta.numIn(), 20);
+  EXPECT_EQ(delta.numOut(), 20);
+  shared = tracker.updateSelectivity("c0", delta);
+  EXPECT_EQ(shared.numIn(), 170);
+  EXPECT_EQ(shared.numOut(), 70);
+
+  // Columns are tracked separately.
+  shared = tracker.updateSelectivity("c1", SelectivityInfo{});
+  EXPECT_EQ(shared.numIn(), 0);
+  EXPECT_EQ(shared.numOut(), 0);
+}
@@ -401,6 +401,37 @@ TEST_F(SsdFileTest, writeAndRead) {
   }
 }
 
+TEST_F(SsdFileTest, loadAsync) {
+  constexpr int64_t kSsdSize = 4 * SsdFile::kRegionSize;
+  initializeCache(kSsdSize);
+  ASSERT_EQ(ssdFile_->loadAsync({}, {}).get().numIos, 0);
+
+  auto pins = makePins(fileName_.id(), 0, 4096, 2048 * 1025, 62 * kMB);
+  ssdFile_->write(pins);
+  std::vector<SsdPin> ssdPins;
+  ssdPins.reserve(pins.size());
+  int64_t payloadBytes = 0;
+  for (auto& pin : pins) {
+    ssdPins.push_back(ssdFile_->find(RawFileCacheKey{
+        pin.entry()->key().fileNum.id(), pin.entry()->key().offset}));
+    ASSERT_FALSE(ssdPins.back().empty());
+    payloadBytes += pin.entry()->size();
+  }
+  SsdCacheStats statsBefore;
+  ssdFile_->updateStats(statsBefore);
+
+  auto future = ssdFile_->loadAsync(ssdPins, pins);
+  const auto ioStats = std::move(future).get();
+  ASSERT_GT(ioStats.numIos, 0);
+  ASSERT_EQ(ioStats.payloadBytes, payloadBytes);
+  for (auto& pin : pins) {
+    checkContents(pin.entry()->data(), pin.entry()->size());
+  }
+  SsdCacheStats statsAfter;
+  ssdFile_->updateStats(statsAfter);
+  ASSERT_EQ(statsAfter.entriesRead - statsBefore.entriesRead, pins.size());
+}
+
 TEST_F(SsdFileTest, checkpoint) {
   constexpr int64_t kSsdSize = 16 * SsdFile::kRegionSize;
   const uint64_t checkpointIntervalBytes = 5 * SsdFile::kRegionSize;
@@ -283,6 +283,135 @@ folly::SemiFuture<uint64_t> LocalReadFile::preadvAsync(
   return std::move(future);
 }
 
+ParallelReadFile::ParallelReadFile(
+    std::unique_ptr<ReadFile> file,
+    folly::Executor* executor,
+    uint64_t partSize,
+    int32_t maxParallelParts)
+    : file_(std::move(file)),
+      executor_(executor),
+      partSize_(partSize),
+      maxParallelParts_(maxParallelParts) {
+  VELOX_CHECK_NOT_NULL(file_);
+  VELOX_CHECK_NOT_NULL(executor_);
+  VELOX_CHECK_GT(partSize_, 0);
+  VELOX_CHECK_GT(maxParallelParts_, 0);
+}
+
+folly::SemiFuture<uint64_t> ParallelReadFile::preadvAsync(
+    uint64_t offset,
+    const std::vector<folly::Range<char*>>& buffers,
+    filesystems::File::IoStats* stats) const {
+  struct Part {
+    uint64_t offset;
+    std::vector<folly::Range<char*>> buffers;
+  };
+  std::vector<Part> parts;
+  Part part;
+  uint64_t partBytes = 0;
+  const auto addPart = [&]() {
+    while (!part.buffers.empty() && part.buffers.back().data() == nullptr) {
+      part.buffers.pop_back();
+    }
+    if (!part.buffers.empty()) {
+      parts.push_back(std::move(part));
+    }
+    part.buffers.clear();
+    partBytes = 0;
+  };
+  uint64_t position = offset;
+  for (const auto& range : buffers) {
+    uint64_t rangeOffset = 0;
+    while (rangeOffset < range.size()) {
+      if (part.buffers.empty()) {
+        if (range.data() == nullptr) {
+          // Parts do not start with a gap.
+          position += range.size() - rangeOffset;
+          break;
+        }
+        part.offset = position;
+      }
+      const auto size =
+          std::min<uint64_t>(range.size() - rangeOffset, partSize_ - partBytes);
+      part.buffers.emplace_back(
+          range.data() == nullptr ? nullptr : range.data() + rangeOffset, size);
+      rangeOffset += size;
+      position += size;
+      partBytes += size;
+      if (partBytes == partSize_) {
+        addPart();
+      }
+    }
+  }
+  addPart();
+  const uint64_t length = position - offset;
+  if (parts.empty()) {
+    return folly::makeSemiFuture<uint64_t>(length);
+  }
+
+  struct Read {
+    explicit Read(int32_t numParts) : numPending(numParts) {}
+
+    std::atomic<int32_t> numPending;
+    folly::Promise<uint64_t> promise;
+    std::mutex mutex;
+    // The error of the first part that failed.
+    folly::exception_wrapper error;
+  };
+  auto read = std::make_shared<Read>(static_cast<int32_t>(parts.size()));
+  auto future = read->promise.getSemiFuture();
+  for (auto& readPart : parts) {
+    schedule([this, read, length, stats, readPart = std::move(readPart)]() {
+      try {
+        file_->preadv(readPart.offset, readPart.buffers, stats);
+      } catch (const std::exception&) {
+        std::lock_guard<std::mutex> l(read->mutex);
+        if (!read->error) {
+          read->error = folly::exception_wrapper(std::current_exception());
+        }
+      }
+      if (--read->numPending > 0) {
+        return;
+      }
+      if (read->error) {
+        read->promise.setException(std::move(read->error));
+      } else {
+        read->promise.setValue(length);
+      }
+    });
+  }
+  return future;
+}
+
+void ParallelReadFile::schedule(folly::Func read) const {
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    if (numRunning_ >= maxParallelParts_) {
+      pending_.push_back(std::move(read));
+      return;
+    }
+    ++numRunning_;
+  }
+  executor_->add(
+      [this, read = std::move(read)]() mutable { runRead(std::move(read)); });
+}
+
+void ParallelReadFile::runRead(folly::Func read) const {
+  read();
+  folly::Func next;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    if (pending_.empty()) {
+      --numRunning_;
+      return;
+    }
+    next = std::move(pending_.front());
+    pending_.pop_front();
+  }
+  executor_->add(
+      [this, next = std::move(next)]() mutable { runRead(std::move(next)); });
+}
+
 uint64_t LocalReadFile::size() const {
   return size_;
 }
@@ -30,7 +30,9 @@
 #include <atomic>
 #include <cstdint>
 #include <cstdio>
+#include <deque>
 #include <functional>
+#include <mutex>
 #include <string>
 #include <string_view>
 
@@ -355,6 +357,107 @@ class LocalReadFile final : public ReadFile {
   long size_;
 };
 
+/// Makes preadvAsync() of 'file' asynchronous and parallel for files whose
+/// reads wait on the network, e.g. objects of S3, GCS or ABFS. The span of a
+/// preadvAsync() is split into parts of up to 'partSize' bytes that are read
+/// on 'executor' with preadv() of 'file'. At most 'maxParallelParts' parts of
+/// 'this' are read at a time. The threads of 'executor' bound the parallelism
+/// of the process. The gaps at the ends of a part are not read. The other reads
+/// go to 'file' directly. 'this' must outlive the futures of preadvAsync().
+class ParallelReadFile final : public ReadFile {
+ public:
+  ParallelReadFile(
+      std::unique_ptr<ReadFile> file,
+      folly::Executor* executor,
+      uint64_t partSize,
+      int32_t maxParallelParts);
+
+  std::string_view pread(
+      uint64_t offset,
+      uint64_t length,
+      void* buf,
+      filesystems::File::IoStats* stats = nullptr) const final {
+    return file_->pread(offset, length, buf, stats);
+  }
+
+  std::string pread(
+      uint64_t offset,
+      uint64_t length,
+      filesystems::File::IoStats* stats = nullptr) const final {
+    return file_->pread(offset, length, stats);
+  }
+
+  uint64_t preadv(
+      uint64_t offset,
+      const std::vector<folly::Range<char*>>& buffers,
+      filesystems::File::IoStats* stats = nullptr) const final {
+    return file_->preadv(offset, buffers, stats);
+  }
+
+  uint64_t preadv(
+      folly::Range<const common::Region*> regions,
+      folly::Range<folly::IOBuf*> iobufs,
+      filesystems::File::IoStats* stats = nullptr) const final {
+    return file_->preadv(regions, iobufs, stats);
+  }
+
+  folly::SemiFuture<uint64_t> preadvAsync(
+      uint64_t offset,
+      const std::vector<folly::Range<char*>>& buffers,
+      filesystems::File::IoStats* stats = nullptr) const final;
+
+  bool hasPreadvAsync() const final {
+    return true;
+  }
+
+  uint64_t size() const final {
+    return file_->size();
+  }
+
+  uint64_t memoryUsage() const final {
+    return file_->memoryUsage();
+  }
+
+  uint64_t bytesRead() const final {
+    return file_->bytesRead();
+  }
+
+  void resetBytesRead() final {
+    file_->resetBytesRead();
+  }
+
+  bool shouldCoalesce() const final {
+    return file_->shouldCoalesce();
+  }
+
+  std::string getName() const final {
+    return file_->getName();
+  }
+
+  uint64_t getNaturalReadSize() const final {
+    return file_->getNaturalReadSize();
+  }
+
+ private:
+  // Runs 'read' on 'executor_' once fewer than 'maxParallelParts_' parts are
+  // being read.
+  void schedule(folly::Func read) const;
+
+  // Runs 'read' and then the next pending read, if any.
+  void runRead(folly::Func read) const;
+
+  const std::unique_ptr<ReadFile> file_;
+  folly::Executor* const executor_;
+  const uint64_t partSize_;
+  const int32_t maxParallelParts_;
+
+  mutable std::mutex mutex_;
+  // Number of parts being read.
+  mutable int32_t numRunning_{0};
+  // The reads waiting for a running read to finish.
+  mutable std::deque<folly::Func> pending_;
+};
+
 class LocalWriteFile final : public WriteFile {
  public:
   struct Attributes {
@@ -73,6 +73,23 @@ bool isPathSupportedByRegisteredFileSystems(const std::string_view& filePath) {
   return false;
 }
 
+void wrapRegisteredFileSystems(
+    std::function<bool(std::string_view)> schemeMatcher,
+    std::function<std::shared_ptr<FileSystem>(std::shared_ptr<FileSystem>)>
+        wrapper) {
+  for (auto& fileSystem : registeredFileSystems()) {
+    fileSystem.second = [generator = std::move(fileSystem.second),
+                         schemeMatcher,
+                         wrapper](
+                            std::shared_ptr<const config::ConfigBase>
+                                properties,
+                            std::string_view filePath) {
+      auto wrapped = generator(std::move(properties), filePath);
+      return schemeMatcher(filePath) ? wrapper(std::move(wrapped)) : wrapped;
+    };
+  }
+}
+
 namespace {
 
 folly::once_flag localFSInstantiationFlag;
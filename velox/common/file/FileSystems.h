@@ -237,6 +237,13 @@ std::shared_ptr<FileSystem> getFileSystem(
 /// otherwise false.
 bool isPathSupportedByRegisteredFileSystems(const std::string_view& filePath);
 
+/// Makes the file systems registered so far return 'wrapper' of themselves
+/// for the paths matching 'schemeMatcher'.
+void wrapRegisteredFileSystems(
+    std::function<bool(std::string_view)> schemeMatcher,
+    std::function<std::shared_ptr<FileSystem>(std::shared_ptr<FileSystem>)>
+        wrapper);
+
 /// FileSystems must be registered explicitly.
 /// The registration function takes two parameters:
 /// a std::function<bool(std::string_view)> that says whether the registered
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/file/LocalFileCache.h"
+
+#include <fmt/format.h>
+#include <folly/hash/Hash.h>
+#include <glog/logging.h>
+#include <filesystem>
+
+#include "velox/common/base/Exceptions.h"
+#include "velox/common/base/SuccinctPrinter.h"
+
+namespace facebook::velox::filesystems {
+
+std::string LocalFileCache::Stats::toString() const {
+  return fmt::format(
+      "hits {} ({}) misses {} ({}) evictions {} writeErrors {} blocks {} ({})",
+      numHits,
+      succinctBytes(hitBytes),
+      numMisses,
+      succinctBytes(missBytes),
+      numEvictions,
+      numWriteErrors,
+      numBlocks,
+      succinctBytes(cachedBytes));
+}
+
+size_t LocalFileCache::BlockKeyHasher::operator()(const BlockKey& key) const {
+  return folly::hash::hash_combine(key.fileName, key.blockIndex);
+}
+
+LocalFileCache::LocalFileCache(
+    std::string directory,
+    uint64_t capacityBytes,
+    uint64_t blockSize)
+    : directory_(std::move(directory)),
+      capacityBytes_(capacityBytes),
+      blockSize_(blockSize) {
+  VELOX_CHECK_GT(blockSize_, 0);
+  std::filesystem::create_directories(directory_);
+  for (const auto& entry : std::filesystem::directory_iterator(directory_)) {
+    std::filesystem::remove_all(entry.path());
+  }
+}
+
+void LocalFileCache::read(
+    const std::string& fileName,
+    const ReadFile& file,
+    uint64_t offset,
+    uint64_t length,
+    char* buf) {
+  const auto fileSize = file.size();
+  VELOX_CHECK_LE(
+      offset + length,
+      fileSize,
+      "Cannot read {} beyond its size {}",
+      fileName,
+      fileSize);
+  std::string blockData;
+  while (length > 0) {
+    const BlockKey key{fileName, offset / blockSize_};
+    const auto blockOffset = key.blockIndex * blockSize_;
+    const auto blockEnd = std::min(blockOffset + blockSize_, fileSize);
+    const auto readLength = std::min(length, blockEnd - offset);
+
+    bool hit = false;
+    if (auto path = lookup(key)) {
+      try {
+        LocalReadFile(*path).pread(offset - blockOffset, readLength, buf);
+        hit = true;
+      } catch (const std::exception& e) {
+        // The block may have been evicted since the lookup.
+        VLOG(1) << "Failed to read cached block of " << fileName << ": "
+                << e.what();
+      }
+    }
+    if (!hit) {
+      blockData.resize(blockEnd - blockOffset);
+      file.pread(blockOffset, blockData.size(), blockData.data());
+      ::memcpy(buf, blockData.data() + (offset - blockOffset), readLength);
+      insert(key, blockData);
+    }
+    {
+      std::lock_guard<std::mutex> l(mutex_);
+      if (hit) {
+        ++stats_.numHits;
+        stats_.hitBytes += readLength;
+      } else {
+        ++stats_.numMisses;
+        stats_.missBytes += readLength;
+      }
+    }
+    offset += readLength;
+    buf += readLength;
+    length -= readLength;
+  }
+}
+
+std::optional<std::string> LocalFileCache::lookup(const BlockKey& key) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = blocks_.find(key);
+  if (it == blocks_.end()) {
+    return std::nullopt;
+  }
+  lru_.splice(lru_.end(), lru_, it->second.lruPosition);
+  return it->second.path;
+}
+
+void LocalFileCache::insert(const BlockKey& key, std::string_view data) {
+  if (data.size() > capacityBytes_) {
+    return;
+  }
+  std::string path;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    path = fmt::format("{}/{}", directory_, nextFileId_++);
+  }
+  try {
+    LocalWriteFile blockFile(path);
+    blockFile.append(data);
+    blockFile.close();
+  } catch (const std::exception& e) {
+    LOG(WARNING) << "Failed to write cached block of " << key.fileName << ": "
+                 << e.what();
+    std::error_code error;
+    std::filesystem::remove(path, error);
+    std::lock_guard<std::mutex> l(mutex_);
+    ++stats_.numWriteErrors;
+    return;
+  }
+
+  std::lock_guard<std::mutex> l(mutex_);
+  if (blocks_.count(key) != 0) {
+    // Added by another thread meanwhile.
+    std::error_code error;
+    std::filesystem::remove(path, error);
+    return;
+  }
+  while (!lru_.empty() && stats_.cachedBytes + data.size() > capacityBytes_) {
+    removeLocked(blocks_.find(lru_.front()));
+    ++stats_.numEvictions;
+  }
+  auto lruPosition = lru_.insert(lru_.end(), key);
+  blocks_.emplace(key, Block{std::move(path), data.size(), lruPosition});
+  ++stats_.numBlocks;
+  stats_.cachedBytes += data.size();
+}
+
+void LocalFileCache::removeLocked(BlockMap::iterator it) {
+  VELOX_CHECK(it != blocks_.end());
+  std::error_code error;
+  std::filesystem::remove(it->second.path, error);
+  --stats_.numBlocks;
+  stats_.cachedBytes -= it->second.size;
+  lru_.erase(it->second.lruPosition);
+  blocks_.erase(it);
+}
+
+void LocalFileCache::remove(const std::string& fileName) {
+  std::lock_guard<std::mutex> l(mutex_);
+  for (auto it = blocks_.begin(); it != blocks_.end();) {
+    if (it->first.fileName == fileName) {
+      auto next = std::next(it);
+      removeLocked(it);
+      it = next;
+    } else {
+      ++it;
+    }
+  }
+}
+
+void LocalFileCache::clear() {
+  std::lock_guard<std::mutex> l(mutex_);
+  while (!blocks_.empty()) {
+    removeLocked(blocks_.begin());
+  }
+}
+
+LocalFileCache::Stats LocalFileCache::stats() const {
+  std::lock_guard<std::mutex> l(mutex_);
+  return stats_;
+}
+
+std::string_view LocalCachedReadFile::pread(
+    uint64_t offset,
+    uint64_t length,
+    void* buf,
+    filesystems::File::IoStats* /*stats*/) const {
+  cache_->read(fileName_, *file_, offset, length, static_cast<char*>(buf));
+  return {static_cast<char*>(buf), length};
+}
+
+std::unique_ptr<ReadFile> LocalCacheFileSystem::openFileForRead(
+    std::string_view path,
+    const FileOptions& options) {
+  return std::make_unique<LocalCachedReadFile>(
+      std::string(path), fileSystem_->openFileForRead(path, options), cache_);
+}
+
+std::unique_ptr<WriteFile> LocalCacheFileSystem::openFileForWrite(
+    std::string_view path,
+    const FileOptions& options) {
+  cache_->remove(std::string(path));
+  return fileSystem_->openFileForWrite(path, options);
+}
+
+void LocalCacheFileSystem::remove(std::string_view path) {
+  cache_->remove(std::string(path));
+  fileSystem_->remove(path);
+}
+
+void LocalCacheFileSystem::rename(
+    std::string_view oldPath,
+    std::string_view newPath,
+    bool overwrite) {
+  cache_->remove(std::string(oldPath));
+  cache_->remove(std::string(newPath));
+  fileSystem_->rename(oldPath, newPath, overwrite);
+}
+
+void registerLocalFileCache(
+    std::function<bool(std::string_view)> schemeMatcher,
+    std::shared_ptr<LocalFileCache> cache) {
+  VELOX_CHECK_NOT_NULL(cache);
+  wrapRegisteredFileSystems(
+      std::move(schemeMatcher),
+      [cache](std::shared_ptr<FileSystem> fileSystem) {
+        return std::make_shared<LocalCacheFileSystem>(
+            std::move(fileSystem), cache);
+      });
+}
+
+} // namespace facebook::velox::filesystems
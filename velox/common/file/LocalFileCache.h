@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <folly/container/F14Map.h>
+#include <list>
+#include <mutex>
+
+#include "velox/common/file/File.h"
+#include "velox/common/file/FileSystems.h"
+
+namespace facebook::velox::filesystems {
+
+/// Caches fixed size blocks of remote files in files under a local directory,
+/// e.g. on NVMe. The blocks are evicted in LRU order when their total size
+/// exceeds the capacity. Unlike SsdCache, it is below the ReadFile, so every
+/// read of a file benefits whether or not it goes through AsyncDataCache. The
+/// cached files must not change.
+class LocalFileCache {
+ public:
+  struct Stats {
+    uint64_t numHits{0};
+    uint64_t hitBytes{0};
+    uint64_t numMisses{0};
+    uint64_t missBytes{0};
+    uint64_t numEvictions{0};
+    uint64_t numWriteErrors{0};
+    /// The number and total size of the blocks in the cache.
+    uint64_t numBlocks{0};
+    uint64_t cachedBytes{0};
+
+    std::string toString() const;
+  };
+
+  /// Removes the files found in 'directory', which are from a previous
+  /// process.
+  LocalFileCache(
+      std::string directory,
+      uint64_t capacityBytes,
+      uint64_t blockSize = 8 << 20);
+
+  /// Reads 'length' bytes at 'offset' of 'file' named 'fileName' into 'buf'.
+  /// Reads the blocks not in the cache from 'file' and adds them to the cache.
+  void read(
+      const std::string& fileName,
+      const ReadFile& file,
+      uint64_t offset,
+      uint64_t length,
+      char* buf);
+
+  /// Removes the blocks of the file named 'fileName'.
+  void remove(const std::string& fileName);
+
+  uint64_t blockSize() const {
+    return blockSize_;
+  }
+
+  Stats stats() const;
+
+  /// Removes all the blocks.
+  void clear();
+
+ private:
+  struct BlockKey {
+    std::string fileName;
+    uint64_t blockIndex;
+
+    bool operator==(const BlockKey& other) const {
+      return blockIndex == other.blockIndex && fileName == other.fileName;
+    }
+  };
+
+  struct BlockKeyHasher {
+    size_t operator()(const BlockKey& key) const;
+  };
+
+  struct Block {
+    std::string path;
+    uint64_t size;
+    std::list<BlockKey>::iterator lruPosition;
+  };
+
+  // Returns the path of the file of the block 'key', or std::nullopt if it is
+  // not in the cache. Marks the block as used.
+  std::optional<std::string> lookup(const BlockKey& key);
+
+  // Writes 'data' to the file of the block 'key' and adds the block to the
+  // cache. Evicts the blocks used least recently if needed.
+  void insert(const BlockKey& key, std::string_view data);
+
+  using BlockMap = folly::F14FastMap<BlockKey, Block, BlockKeyHasher>;
+
+  // Removes 'it' and its file. Must hold 'mutex_'.
+  void removeLocked(BlockMap::iterator it);
+
+  const std::string directory_;
+  const uint64_t capacityBytes_;
+  const uint64_t blockSize_;
+
+  mutable std::mutex mutex_;
+  BlockMap blocks_;
+  // The blocks from least to most recently used.
+  std::list<BlockKey> lru_;
+  uint64_t nextFileId_{0};
+  Stats stats_;
+};
+
+/// A ReadFile that reads 'file' named 'fileName' through 'cache'.
+class LocalCachedReadFile final : public ReadFile {
+ public:
+  LocalCachedReadFile(
+      std::string fileName,
+      std::shared_ptr<ReadFile> file,
+      std::shared_ptr<LocalFileCache> cache)
+      : fileName_(std::move(fileName)),
+        file_(std::move(file)),
+        cache_(std::move(cache)) {}
+
+  using ReadFile::pread;
+
+  std::string_view pread(
+      uint64_t offset,
+      uint64_t length,
+      void* buf,
+      filesystems::File::IoStats* stats = nullptr) const override;
+
+  uint64_t size() const override {
+    return file_->size();
+  }
+
+  uint64_t memoryUsage() const override {
+    return file_->memoryUsage();
+  }
+
+  bool shouldCoalesce() const override {
+    return file_->shouldCoalesce();
+  }
+
+  std::string getName() const override {
+    return file_->getName();
+  }
+
+  uint64_t getNaturalReadSize() const override {
+    return file_->getNaturalReadSize();
+  }
+
+ private:
+  const std::string fileName_;
+  const std::shared_ptr<ReadFile> file_;
+  const std::shared_ptr<LocalFileCache> cache_;
+};
+
+/// Wraps a FileSystem so that its files are read through a LocalFileCache.
+/// The other operations go to the wrapped FileSystem. Files written, renamed
+/// or removed are dropped from the cache.
+class LocalCacheFileSystem : public FileSystem {
+ public:
+  LocalCacheFileSystem(
+      std::shared_ptr<FileSystem> fileSystem,
+      std::shared_ptr<LocalFileCache> cache)
+      : FileSystem(nullptr),
+        fileSystem_(std::move(fileSystem)),
+        cache_(std::move(cache)) {}
+
+  std::string name() const override {
+    return fileSystem_->name();
+  }
+
+  std::string_view extractPath(std::string_view path) const override {
+    return fileSystem_->extractPath(path);
+  }
+
+  std::unique_ptr<ReadFile> openFileForRead(
+      std::string_view path,
+      const FileOptions& options = {}) override;
+
+  std::unique_ptr<WriteFile> openFileForWrite(
+      std::string_view path,
+      const FileOptions& options = {}) override;
+
+  void remove(std::string_view path) override;
+
+  void rename(
+      std::string_view oldPath,
+      std::string_view newPath,
+      bool overwrite = false) override;
+
+  bool exists(std::string_view path) override {
+    return fileSystem_->exists(path);
+  }
+
+  bool isDirectory(std::string_view path) const override {
+    return fileSystem_->isDirectory(path);
+  }
+
+  std::vector<std::string> list(std::string_view path) override {
+    return fileSystem_->list(path);
+  }
+
+  void mkdir(std::string_view path, const DirectoryOptions& options = {})
+      override {
+    fileSystem_->mkdir(path, options);
+  }
+
+  void rmdir(std::string_view path) override {
+    fileSystem_->rmdir(path);
+  }
+
+ private:
+  const std::shared_ptr<FileSystem> fileSystem_;
+  const std::shared_ptr<LocalFileCache> cache_;
+};
+
+/// Makes the file systems registered so far read the files of the paths that
+/// match 'schemeMatcher' through 'cache', e.g. for "s3://" paths. To be called
+/// after the file systems are registered.
+void registerLocalFileCache(
+    std::function<bool(std::string_view)> schemeMatcher,
+    std::shared_ptr<LocalFileCache> cache);
+
+} // namespace facebook::velox::filesystems
@@ -20,6 +20,7 @@
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/common/file/File.h"
 #include "velox/common/file/FileSystems.h"
+#include "velox/common/file/LocalFileCache.h"
 #include "velox/common/file/tests/FaultyFileSystem.h"
 #include "velox/exec/tests/utils/TempDirectoryPath.h"
 #include "velox/exec/tests/utils/TempFilePath.h"
@@ -175,6 +176,41 @@ TEST(InMemoryFile, preadv) {
   EXPECT_EQ(expected, values);
 }
 
+TEST(ParallelReadFile, preadvAsync) {
+  std::string buf;
+  {
+    InMemoryWriteFile writeFile(&buf);
+    writeData(&writeFile);
+  }
+  // aaaaa bbbbb c*1MB ddddd
+  auto executor = std::make_unique<folly::CPUThreadPoolExecutor>(4);
+  ParallelReadFile readFile(
+      std::make_unique<InMemoryReadFile>(buf), executor.get(), 1000, 2);
+  ASSERT_TRUE(readFile.hasPreadvAsync());
+  ASSERT_EQ(readFile.size(), buf.size());
+
+  // Reads "abbbbbcc", skips to the last 2 c's and reads "ccddd".
+  std::string head(8, 0);
+  std::string tail(5, 0);
+  std::vector<folly::Range<char*>> buffers = {
+      folly::Range<char*>(head.data(), head.size()),
+      folly::Range<char*>(nullptr, kOneMB - 4),
+      folly::Range<char*>(tail.data(), tail.size())};
+  EXPECT_EQ(readFile.preadvAsync(4, buffers).wait().value(), kOneMB + 9);
+  EXPECT_EQ(head, "abbbbbcc");
+  EXPECT_EQ(tail, "ccddd");
+
+  // A range longer than a part is read in several parts.
+  std::string middle(5'000, 0);
+  EXPECT_EQ(
+      readFile
+          .preadvAsync(10, {folly::Range<char*>(middle.data(), middle.size())})
+          .wait()
+          .value(),
+      middle.size());
+  EXPECT_EQ(middle, std::string(middle.size(), 'c'));
+}
+
 class LocalFileTest : public ::testing::TestWithParam<bool> {
  protected:
   LocalFileTest() : useFaultyFs_(GetParam()) {}
@@ -828,3 +864,81 @@ TEST_F(FaultyFsTest, fileWriteFaultHookInjection) {
     fs_->remove(path2);
   }
 }
+
+namespace {
+// Counts the reads that reach the file.
+class CountingReadFile : public InMemoryReadFile {
+ public:
+  explicit CountingReadFile(std::string data)
+      : InMemoryReadFile(std::move(data)) {}
+
+  std::string_view pread(
+      uint64_t offset,
+      uint64_t length,
+      void* buf,
+      filesystems::File::IoStats* stats = nullptr) const override {
+    ++numReads;
+    return InMemoryReadFile::pread(offset, length, buf, stats);
+  }
+
+  mutable int32_t numReads{0};
+};
+} // namespace
+
+TEST(LocalFileCache, readThrough) {
+  auto tempFolder = exec::test::TempDirectoryPath::create();
+  auto cache = std::make_shared<filesystems::LocalFileCache>(
+      tempFolder->getPath(), 1 << 20, 100);
+  std::string data(1'000, '\0');
+  for (auto i = 0; i < data.size(); ++i) {
+    data[i] = 'a' + i % 26;
+  }
+  auto file = std::make_shared<CountingReadFile>(data);
+  filesystems::LocalCachedReadFile cachedFile("remote/file", file, cache);
+  ASSERT_EQ(cachedFile.size(), data.size());
+
+  char buffer[250];
+  // Reads blocks 0 to 2 from the file.
+  ASSERT_EQ(cachedFile.pread(50, 200, buffer), data.substr(50, 200));
+  ASSERT_EQ(file->numReads, 3);
+  // Reads blocks 1 and 2 from the cache and block 3 from the file.
+  ASSERT_EQ(cachedFile.pread(120, 250, buffer), data.substr(120, 250));
+  ASSERT_EQ(file->numReads, 4);
+  // The last block is short.
+  ASSERT_EQ(cachedFile.pread(950, 50), data.substr(950, 50));
+  ASSERT_EQ(file->numReads, 5);
+  auto stats = cache->stats();
+  ASSERT_EQ(stats.numMisses, 5);
+  ASSERT_EQ(stats.numHits, 2);
+  ASSERT_EQ(stats.numBlocks, 5);
+  ASSERT_EQ(stats.cachedBytes, 500);
+
+  cache->remove("remote/file");
+  ASSERT_EQ(cache->stats().numBlocks, 0);
+  ASSERT_EQ(cachedFile.pread(0, 10), data.substr(0, 10));
+  ASSERT_EQ(file->numReads, 6);
+  VELOX_ASSERT_THROW(cachedFile.pread(990, 20), "beyond its size");
+}
+
+TEST(LocalFileCache, eviction) {
+  auto tempFolder = exec::test::TempDirectoryPath::create();
+  auto cache = std::make_shared<filesystems::LocalFileCache>(
+      tempFolder->getPath(), 300, 100);
+  std::string data(1'000, 'x');
+  auto file = std::make_shared<CountingReadFile>(data);
+  filesystems::LocalCachedReadFile cachedFile("remote/file", file, cache);
+  for (auto i = 0; i < 10; ++i) {
+    ASSERT_EQ(cachedFile.pread(i * 100, 100), data.substr(i * 100, 100));
+    // Block 0 stays in the cache since it is read each time.
+    ASSERT_EQ(cachedFile.pread(0, 10), data.substr(0, 10));
+  }
+  const auto stats = cache->stats();
+  ASSERT_EQ(stats.numBlocks, 3);
+  ASSERT_EQ(stats.cachedBytes, 300);
+  ASSERT_EQ(stats.numEvictions, 7);
+  ASSERT_EQ(stats.numMisses, 10);
+  ASSERT_EQ(
+      stats.toString(),
+      "hits 10 (100B) misses 10 (1000B) evictions 7 writeErrors 0 "
+      "blocks 3 (300B)");
+}
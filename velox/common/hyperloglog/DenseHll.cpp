@@ -15,6 +15,7 @@
  */
 #include "velox/common/hyperloglog/DenseHll.h"
 
+#include <algorithm>
 #include <exception>
 #include <sstream>
 #include "velox/common/base/IOUtils.h"
@@ -143,6 +144,30 @@ void DenseHll::insertHash(uint64_t hash) {
   insert(index, value);
 }
 
+void DenseHll::insertHashes(const uint64_t* hashes, int32_t numHashes) {
+  constexpr int32_t kBatchSize = 64;
+  uint32_t indices[kBatchSize];
+  int8_t values[kBatchSize];
+  for (int32_t start = 0; start < numHashes; start += kBatchSize) {
+    const int32_t batchSize = std::min(kBatchSize, numHashes - start);
+    const uint64_t* batch = hashes + start;
+    // Branch free loops the compiler can vectorize.
+    for (auto i = 0; i < batchSize; ++i) {
+      indices[i] = computeIndex(batch[i], indexBitLength_);
+    }
+    for (auto i = 0; i < batchSize; ++i) {
+      values[i] = numberOfLeadingZeros(batch[i], indexBitLength_) + 1;
+    }
+    for (auto i = 0; i < batchSize; ++i) {
+      // insert() does nothing unless the delta exceeds the bucket delta.
+      // 'baseline_' may change on insert, so it is read for each value.
+      if (values[i] - baseline_ > getDelta(indices[i])) {
+        insert(indices[i], values[i]);
+      }
+    }
+  }
+}
+
 void DenseHll::insert(int32_t index, int8_t value) {
   auto delta = value - baseline_;
   auto oldDelta = getDelta(index);
@@ -48,6 +48,13 @@ class DenseHll {
 
   void insertHash(uint64_t hash);
 
+  /// Inserts 'numHashes' hashes. Produces the same state as calling
+  /// insertHash() for each hash in order. Computes buckets and values for a
+  /// batch of hashes at a time and skips the hashes whose value does not
+  /// exceed the value of their bucket, which is most of them once the HLL has
+  /// seen a few times more distinct values than it has buckets.
+  void insertHashes(const uint64_t* hashes, int32_t numHashes);
+
   /// Inserts pre-computed {bucket, value} pair. These value must be compatible
   /// with computeIndex and computeValue methods called with the indexBitLength
   /// value of this HLL. Used by SparseHll.toDense().
@@ -30,12 +30,16 @@ uint64_t hashOne(T value) {
   return XXH64(&value, sizeof(value), 0);
 }
 
-// A benchmark for DenseHll::mergeWith(serialized) API.
+// A benchmark for DenseHll::mergeWith(serialized) and DenseHll::insertHashes
+// APIs.
 //
 // Measures the time it takes to merge 2 serialized digests using different
 // values for hash bits. Larger values of hash bits corresponds to larger
 // digests that are more accurate, but slower to merge. The default number of
 // hash bits is 11, while in practice 16 is common.
+//
+// Also measures the time it takes to insert 1M hashes one at a time and in
+// batches.
 class DenseHllBenchmark {
  public:
   explicit DenseHllBenchmark(memory::MemoryPool* pool) : pool_(pool) {
@@ -43,6 +47,26 @@ class DenseHllBenchmark {
       serializedHlls_[hashBits].push_back(makeSerializedHll(hashBits, 1));
       serializedHlls_[hashBits].push_back(makeSerializedHll(hashBits, 2));
     }
+    for (int32_t i = 0; i < 1'000'000; ++i) {
+      hashes_.push_back(hashOne(i));
+    }
+  }
+
+  void runInsert(int hashBits, bool batch) {
+    folly::BenchmarkSuspender suspender;
+
+    HashStringAllocator allocator(pool_);
+    common::hll::DenseHll hll(hashBits, &allocator);
+
+    suspender.dismiss();
+
+    if (batch) {
+      hll.insertHashes(hashes_.data(), hashes_.size());
+    } else {
+      for (auto hash : hashes_) {
+        hll.insertHash(hash);
+      }
+    }
   }
 
   void run(int hashBits) {
@@ -82,6 +106,9 @@ class DenseHllBenchmark {
   // List of serialized HLLs to use for merging, keyed by the number of hash
   // bits.
   std::unordered_map<int, std::vector<std::string>> serializedHlls_;
+
+  // Hashes to insert.
+  std::vector<uint64_t> hashes_;
 };
 
 } // namespace
@@ -100,6 +127,22 @@ BENCHMARK(mergeSerialized16) {
   benchmark->run(16);
 }
 
+BENCHMARK(insertHash11) {
+  benchmark->runInsert(11, false);
+}
+
+BENCHMARK_RELATIVE(insertHashes11) {
+  benchmark->runInsert(11, true);
+}
+
+BENCHMARK(insertHash16) {
+  benchmark->runInsert(16, false);
+}
+
+BENCHMARK_RELATIVE(insertHashes16) {
+  benchmark->runInsert(16, true);
+}
+
 int main(int argc, char** argv) {
   folly::Init init(&argc, &argv);
 
@@ -225,6 +225,34 @@ TEST_P(DenseHllTest, mergeWith) {
   testMergeWith(indexBitLength, sequence(0, 2'000'000), sequence(0, 2'000'000));
 }
 
+TEST_P(DenseHllTest, insertHashes) {
+  int8_t indexBitLength = GetParam();
+
+  // Enough values to move the baseline and to create overflows.
+  std::vector<uint64_t> hashes;
+  for (int i = 0; i < 100'000; i++) {
+    hashes.push_back(hashOne(i));
+  }
+
+  DenseHll expected{indexBitLength, &allocator_};
+  for (auto hash : hashes) {
+    expected.insertHash(hash);
+  }
+
+  // Batch sizes that are not a multiple of the internal batch.
+  for (auto batchSize : {1, 63, 1'000, 100'000}) {
+    SCOPED_TRACE(fmt::format("batchSize: {}", batchSize));
+    DenseHll hll{indexBitLength, &allocator_};
+    for (int32_t start = 0; start < hashes.size(); start += batchSize) {
+      hll.insertHashes(
+          hashes.data() + start,
+          std::min<int32_t>(batchSize, hashes.size() - start));
+    }
+    ASSERT_EQ(hll.cardinality(), expected.cardinality());
+    ASSERT_EQ(serialize(hll), serialize(expected));
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     DenseHllTest,
     DenseHllTest,
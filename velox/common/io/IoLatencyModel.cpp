@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/io/IoLatencyModel.h"
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <unordered_map>
+
+namespace facebook::velox::io {
+
+// static
+std::shared_ptr<IoLatencyModel> IoLatencyModel::forPath(
+    std::string_view path) {
+  static std::mutex mutex;
+  static std::unordered_map<std::string, std::shared_ptr<IoLatencyModel>>
+      models;
+  const auto schemeEnd = path.find("://");
+  const std::string scheme(
+      schemeEnd == std::string_view::npos ? std::string_view()
+                                          : path.substr(0, schemeEnd));
+  std::lock_guard<std::mutex> l(mutex);
+  auto& model = models[scheme];
+  if (model == nullptr) {
+    model = std::make_shared<IoLatencyModel>();
+  }
+  return model;
+}
+
+void IoLatencyModel::record(uint64_t bytes, uint64_t micros) {
+  const double x = bytes;
+  const double y = micros;
+  std::lock_guard<std::mutex> l(mutex_);
+  ++numSamples_;
+  weight_ = weight_ * kDecay + 1;
+  sumX_ = sumX_ * kDecay + x;
+  sumY_ = sumY_ * kDecay + y;
+  sumXX_ = sumXX_ * kDecay + x * x;
+  sumXY_ = sumXY_ * kDecay + x * y;
+}
+
+bool IoLatencyModel::fit(double& latencyUs, double& bytesPerUs) const {
+  std::lock_guard<std::mutex> l(mutex_);
+  if (numSamples_ < kMinSamples) {
+    return false;
+  }
+  const double denominator = weight_ * sumXX_ - sumX_ * sumX_;
+  // All reads of about the same size do not tell latency from throughput.
+  if (denominator <= 1e-9 * weight_ * sumXX_) {
+    return false;
+  }
+  const double usPerByte = (weight_ * sumXY_ - sumX_ * sumY_) / denominator;
+  if (usPerByte <= 0) {
+    return false;
+  }
+  latencyUs = std::max<double>(0, (sumY_ - usPerByte * sumX_) / weight_);
+  bytesPerUs = 1 / usPerByte;
+  return true;
+}
+
+int32_t IoLatencyModel::coalesceDistance(int32_t configuredDistance) const {
+  double latencyUs;
+  double bytesPerUs;
+  if (configuredDistance <= 0 || !fit(latencyUs, bytesPerUs)) {
+    return configuredDistance;
+  }
+  const double minDistance =
+      std::max<double>(1, configuredDistance / kMaxDistanceFactor);
+  const double maxDistance =
+      static_cast<double>(configuredDistance) * kMaxDistanceFactor;
+  return static_cast<int32_t>(std::min<double>(
+      std::max<double>(latencyUs * bytesPerUs, minDistance),
+      std::min<double>(maxDistance, std::numeric_limits<int32_t>::max())));
+}
+
+} // namespace facebook::velox::io
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+
+namespace facebook::velox::io {
+
+/// Models the time of a read from a storage system as a fixed time to first
+/// byte plus the size over the throughput, fitted to the observed reads by
+/// least squares with exponential decay of old samples. Used for choosing
+/// how far apart two reads may be and still be coalesced: reading a gap of
+/// fewer bytes than the latency-throughput product costs less time than an
+/// extra request. The right distance differs by an order of magnitude
+/// between e.g. local SSD and object stores.
+class IoLatencyModel {
+ public:
+  /// Number of samples before the model is used.
+  static constexpr int32_t kMinSamples = 16;
+
+  /// Weight of the previous samples when adding a new one.
+  static constexpr double kDecay = 0.99;
+
+  /// Factor by which the coalesce distance may deviate from the configured
+  /// one in either direction.
+  static constexpr int32_t kMaxDistanceFactor = 8;
+
+  /// Returns the process-wide model for the storage system that serves
+  /// 'path', identified by the scheme of 'path', e.g. "s3" in
+  /// "s3://bucket/key". Paths without a scheme share one model.
+  static std::shared_ptr<IoLatencyModel> forPath(std::string_view path);
+
+  /// Records a read of 'bytes' that took 'micros'.
+  void record(uint64_t bytes, uint64_t micros);
+
+  /// Returns the gap in bytes up to which reads should be coalesced.
+  /// 'configuredDistance' is returned until there are enough samples and
+  /// bounds the result to within kMaxDistanceFactor of it.
+  int32_t coalesceDistance(int32_t configuredDistance) const;
+
+  /// Returns the fitted time to first byte in microseconds and throughput in
+  /// bytes per microsecond. Returns false if there is no usable fit yet.
+  bool fit(double& latencyUs, double& bytesPerUs) const;
+
+ private:
+  mutable std::mutex mutex_;
+  int64_t numSamples_{0};
+  // Decayed sums for the least squares fit of micros (y) over bytes (x).
+  double weight_{0};
+  double sumX_{0};
+  double sumY_{0};
+  double sumXX_{0};
+  double sumXY_{0};
+};
+
+} // namespace facebook::velox::io
@@ -118,6 +118,7 @@ void IoStatistics::merge(const IoStatistics& other) {
   read_.merge(other.read_);
   ramHit_.merge(other.ramHit_);
   ssdRead_.merge(other.ssdRead_);
+  peerRead_.merge(other.peerRead_);
   queryThreadIoLatency_.merge(other.queryThreadIoLatency_);
   {
     const auto& otherOperationStats = other.operationStats();
@@ -123,6 +123,10 @@ class IoStatistics {
     return ramHit_;
   }
 
+  IoCounter& peerRead() {
+    return peerRead_;
+  }
+
   IoCounter& queryThreadIoLatency() {
     return queryThreadIoLatency_;
   }
@@ -167,6 +171,9 @@ class IoStatistics {
   // reads.
   IoCounter ssdRead_;
 
+  // Read from the cache of a peer worker instead of storage.
+  IoCounter peerRead_;
+
   // Time spent by a query processing thread waiting for synchronously issued IO
   // or for an in-progress read-ahead to finish.
   IoCounter queryThreadIoLatency_;
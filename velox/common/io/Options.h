@@ -16,6 +16,11 @@
 
 #pragma once
 
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "velox/common/io/IoLatencyModel.h"
 #include "velox/common/memory/Memory.h"
 
 namespace facebook::velox::io {
@@ -56,6 +61,28 @@ enum class PrefetchMode {
                 // actual reads.
 };
 
+/// Retention of the data of a table or column in the memory cache.
+struct CachePolicy {
+  enum class Kind {
+    /// Retained by access recency and frequency like all other data.
+    kDefault,
+    /// Not evicted by score. Only evicted if the cache cannot otherwise make
+    /// space.
+    kPin,
+    /// Evicted 'ttlSecs' after being loaded, regardless of use.
+    kTtl,
+    /// Evicted as soon as it is not in use and never written to SSD.
+    kNeverCache,
+  };
+
+  Kind kind{Kind::kDefault};
+  int64_t ttlSecs{0};
+
+  bool operator==(const CachePolicy& other) const {
+    return kind == other.kind && ttlSecs == other.ttlSecs;
+  }
+};
+
 class ReaderOptions {
  public:
   static constexpr int32_t kDefaultLoadQuantum = 8 << 20; // 8MB
@@ -110,6 +137,14 @@ class ReaderOptions {
     return *this;
   }
 
+  /// Limits the bytes of the row group being read and the prefetched row
+  /// groups. Fewer row groups than prefetchRowGroups() are prefetched if
+  /// they don't fit. 0 means no limit.
+  ReaderOptions& setPrefetchRowGroupsMemoryLimit(uint64_t bytes) {
+    prefetchRowGroupsMemoryLimit_ = bytes;
+    return *this;
+  }
+
   /// Gets the memory allocator.
   velox::memory::MemoryPool& memoryPool() const {
     return *memoryPool_;
@@ -139,6 +174,10 @@ class ReaderOptions {
     return prefetchRowGroups_;
   }
 
+  uint64_t prefetchRowGroupsMemoryLimit() const {
+    return prefetchRowGroupsMemoryLimit_;
+  }
+
   bool noCacheRetention() const {
     return noCacheRetention_;
   }
@@ -147,6 +186,49 @@ class ReaderOptions {
     noCacheRetention_ = noCacheRetention;
   }
 
+  /// Sets the storage latency model that adapts the coalesce distance to the
+  /// observed reads. The configured distance is used as is if not set.
+  void setLatencyModel(std::shared_ptr<IoLatencyModel> model) {
+    latencyModel_ = std::move(model);
+  }
+
+  const std::shared_ptr<IoLatencyModel>& latencyModel() const {
+    return latencyModel_;
+  }
+
+  /// Returns the maximum gap in bytes between coalesced reads, adapted by
+  /// the latency model if there is one.
+  int32_t coalesceDistance() const {
+    return latencyModel_ == nullptr
+        ? maxCoalesceDistance_
+        : latencyModel_->coalesceDistance(maxCoalesceDistance_);
+  }
+
+  /// Sets the cache policy for the columns that have no policy of their own.
+  void setCachePolicy(CachePolicy policy) {
+    cachePolicy_ = policy;
+  }
+
+  /// Sets the cache policies of top level columns by column name.
+  void setColumnCachePolicies(
+      std::unordered_map<std::string, CachePolicy> policies) {
+    columnCachePolicies_ = std::move(policies);
+  }
+
+  /// Returns the cache policy for a stream with 'label'. The label starts
+  /// with the top level column name, e.g. "/c0/f0", and may be empty for
+  /// formats that do not label their streams.
+  CachePolicy cachePolicy(std::string_view label = {}) const {
+    if (columnCachePolicies_.empty() || label.size() < 2) {
+      return cachePolicy_;
+    }
+    const auto end = label.find('/', 1);
+    const auto column = std::string(
+        label.substr(1, end == std::string_view::npos ? end : end - 1));
+    auto it = columnCachePolicies_.find(column);
+    return it == columnCachePolicies_.end() ? cachePolicy_ : it->second;
+  }
+
  protected:
   velox::memory::MemoryPool* memoryPool_;
   uint64_t autoPreloadLength_;
@@ -155,6 +237,10 @@ class ReaderOptions {
   int32_t maxCoalesceDistance_{kDefaultCoalesceDistance};
   int64_t maxCoalesceBytes_{kDefaultCoalesceBytes};
   int32_t prefetchRowGroups_{kDefaultPrefetchRowGroups};
+  uint64_t prefetchRowGroupsMemoryLimit_{0};
   bool noCacheRetention_{false};
+  std::shared_ptr<IoLatencyModel> latencyModel_;
+  CachePolicy cachePolicy_;
+  std::unordered_map<std::string, CachePolicy> columnCachePolicies_;
 };
 } // namespace facebook::velox::io
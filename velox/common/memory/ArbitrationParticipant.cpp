@@ -363,9 +363,26 @@ size_t ArbitrationParticipant::numWaitingOps() const {
   return waitOps_.size();
 }
 
+double ArbitrationParticipant::updateGrowthRate() {
+  // The weight of the latest sample in the smoothed rate.
+  constexpr double kSampleWeight = 0.5;
+  const uint64_t nowNs = getCurrentTimeNano();
+  const uint64_t usedBytes = pool_->usedBytes();
+  if (lastUsageTimeNs_ != 0 && nowNs > lastUsageTimeNs_) {
+    const double sampleRate =
+        (static_cast<double>(usedBytes) - lastUsedBytes_) * 1'000'000'000 /
+        (nowNs - lastUsageTimeNs_);
+    growthRate_ =
+        kSampleWeight * sampleRate + (1 - kSampleWeight) * growthRate_;
+  }
+  lastUsedBytes_ = usedBytes;
+  lastUsageTimeNs_ = nowNs;
+  return growthRate_;
+}
+
 std::string ArbitrationParticipant::Stats::toString() const {
   return fmt::format(
-      "numRequests: {}, numReclaims: {}, numShrinks: {}, numGrows: {}, reclaimedBytes: {}, growBytes: {}, aborted: {}, duration: {}",
+      "numRequests: {}, numReclaims: {}, numShrinks: {}, numGrows: {}, reclaimedBytes: {}, growBytes: {}, aborted: {}, duration: {}, arbitrationWait: {}",
       numRequests,
       numReclaims,
       numShrinks,
@@ -373,7 +390,8 @@ std::string ArbitrationParticipant::Stats::toString() const {
       succinctBytes(reclaimedBytes),
       succinctBytes(growBytes),
       aborted,
-      succinctNanos(durationNs));
+      succinctNanos(durationNs),
+      succinctNanos(arbitrationWaitTimeNs));
 }
 
 ScopedArbitrationParticipant::ScopedArbitrationParticipant(
@@ -267,6 +267,24 @@ class ArbitrationParticipant
   /// Returns the number of waiting arbitration operations on this participant.
   size_t numWaitingOps() const;
 
+  /// Samples the used memory of the query memory pool and updates the
+  /// exponentially smoothed growth rate of the usage. Returns the updated rate
+  /// in bytes per second, negative if the usage is shrinking. Invoked
+  /// periodically by the predictive arbitration.
+  double updateGrowthRate();
+
+  /// Returns the smoothed growth rate of the used memory in bytes per second
+  /// as of the last updateGrowthRate() call.
+  double growthRate() const {
+    return growthRate_;
+  }
+
+  /// Adds 'waitTimeNs' spent by an arbitration request of this participant
+  /// waiting for memory.
+  void addArbitrationWaitTime(uint64_t waitTimeNs) {
+    arbitrationWaitTimeNs_ += waitTimeNs;
+  }
+
   struct Stats {
     uint64_t durationNs{0};
     uint32_t numRequests{0};
@@ -275,6 +293,7 @@ class ArbitrationParticipant
     uint32_t numGrows{0};
     uint64_t reclaimedBytes{0};
     uint64_t growBytes{0};
+    uint64_t arbitrationWaitTimeNs{0};
     bool aborted{false};
 
     std::string toString() const;
@@ -290,6 +309,7 @@ class ArbitrationParticipant
     stats.numReclaims = numReclaims_;
     stats.reclaimedBytes = reclaimedBytes_;
     stats.growBytes = growBytes_;
+    stats.arbitrationWaitTimeNs = arbitrationWaitTimeNs_;
     return stats;
   }
 
@@ -354,6 +374,14 @@ class ArbitrationParticipant
   tsan_atomic<uint32_t> numGrows_{0};
   tsan_atomic<uint64_t> reclaimedBytes_{0};
   tsan_atomic<uint64_t> growBytes_{0};
+  tsan_atomic<uint64_t> arbitrationWaitTimeNs_{0};
+
+  // The used bytes and time of the last updateGrowthRate() sample and the
+  // smoothed growth rate in bytes per second. Only accessed by the predictive
+  // arbitration.
+  uint64_t lastUsedBytes_{0};
+  uint64_t lastUsageTimeNs_{0};
+  tsan_atomic<double> growthRate_{0};
 
   mutable std::timed_mutex reclaimMutex_;
 
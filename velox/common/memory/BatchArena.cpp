@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/memory/BatchArena.h"
+
+namespace facebook::velox::memory {
+
+BatchArena::~BatchArena() {
+  for (const auto& chunk : chunks_) {
+    pool_->free(chunk.data, chunk.size);
+  }
+}
+
+char* BatchArena::allocate(int64_t bytes, int32_t alignment) {
+  VELOX_DCHECK_GE(bytes, 0);
+  VELOX_DCHECK(bits::isPowerOfTwo(alignment));
+  VELOX_DCHECK_LE(alignment, pool_->alignment());
+  if (currentChunk_ >= 0) {
+    const auto offset = bits::roundUp(offset_, alignment);
+    if (offset + bytes <= chunks_[currentChunk_].size) {
+      offset_ = offset + bytes;
+      allocatedBytes_ += bytes;
+      return chunks_[currentChunk_].data + offset;
+    }
+  }
+  // A new chunk starts at the pool alignment.
+  nextChunk(bytes);
+  offset_ = bytes;
+  allocatedBytes_ += bytes;
+  return chunks_[currentChunk_].data;
+}
+
+void BatchArena::nextChunk(int64_t bytes) {
+  // Reuses the next retained chunk if it is large enough. A retained chunk
+  // that is too small is freed.
+  while (currentChunk_ + 1 < static_cast<int32_t>(chunks_.size())) {
+    auto& chunk = chunks_[currentChunk_ + 1];
+    if (chunk.size >= bytes) {
+      ++currentChunk_;
+      offset_ = 0;
+      return;
+    }
+    pool_->free(chunk.data, chunk.size);
+    retainedBytes_ -= chunk.size;
+    chunks_.erase(chunks_.begin() + currentChunk_ + 1);
+  }
+  // Doubles the chunk size with each chunk to bound the number of chunks.
+  const int64_t size = std::max<int64_t>(
+      bytes,
+      std::max<int64_t>(
+          kMinChunkBytes, chunks_.empty() ? 0 : chunks_.back().size * 2));
+  chunks_.push_back({reinterpret_cast<char*>(pool_->allocate(size)), size});
+  retainedBytes_ += size;
+  currentChunk_ = chunks_.size() - 1;
+  offset_ = 0;
+}
+
+void BatchArena::reset() {
+  // Keeps the leading chunks within 'maxRetainedBytes_'. The first chunk is
+  // always kept.
+  int64_t keptBytes = 0;
+  size_t numKept = 0;
+  for (; numKept < chunks_.size(); ++numKept) {
+    if (numKept > 0 && keptBytes + chunks_[numKept].size > maxRetainedBytes_) {
+      break;
+    }
+    keptBytes += chunks_[numKept].size;
+  }
+  for (auto i = numKept; i < chunks_.size(); ++i) {
+    pool_->free(chunks_[i].data, chunks_[i].size);
+  }
+  chunks_.resize(numKept);
+  retainedBytes_ = keptBytes;
+  currentChunk_ = chunks_.empty() ? -1 : 0;
+  offset_ = 0;
+  allocatedBytes_ = 0;
+}
+
+} // namespace facebook::velox::memory
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "velox/common/memory/Memory.h"
+
+namespace facebook::velox::memory {
+
+/// A bump allocator for scratch memory that lives for the processing of one
+/// batch, e.g. the intermediate state of a vector function for one call of
+/// ExprSet::eval. Allocations are never freed individually. reset() frees all
+/// allocations at once and keeps up to 'maxRetainedBytes' of the chunks for
+/// reuse by the next batch, so that steady state batches make no calls to the
+/// memory pool. Memory from 'this' must not escape the batch, e.g. it can't
+/// back a vector returned as an expression result. Not thread safe.
+class BatchArena {
+ public:
+  static constexpr int64_t kMinChunkBytes = 64 << 10;
+  static constexpr int64_t kDefaultMaxRetainedBytes = 1 << 20;
+
+  explicit BatchArena(
+      MemoryPool* pool,
+      int64_t maxRetainedBytes = kDefaultMaxRetainedBytes)
+      : pool_(pool), maxRetainedBytes_(maxRetainedBytes) {
+    VELOX_CHECK_NOT_NULL(pool_);
+  }
+
+  ~BatchArena();
+
+  BatchArena(const BatchArena&) = delete;
+  BatchArena& operator=(const BatchArena&) = delete;
+
+  /// Returns 'bytes' of uninitialized memory aligned at 'alignment', which
+  /// must be a power of 2 not larger than the pool alignment.
+  char* allocate(int64_t bytes, int32_t alignment = alignof(std::max_align_t));
+
+  /// Returns uninitialized space for 'numValues' of T.
+  template <typename T>
+  T* allocate(int64_t numValues) {
+    static_assert(std::is_trivially_destructible_v<T>);
+    return reinterpret_cast<T*>(allocate(numValues * sizeof(T), alignof(T)));
+  }
+
+  /// Frees all allocations made since the last reset.
+  void reset();
+
+  /// Returns the bytes handed out since the last reset.
+  int64_t allocatedBytes() const {
+    return allocatedBytes_;
+  }
+
+  /// Returns the bytes allocated from the memory pool.
+  int64_t retainedBytes() const {
+    return retainedBytes_;
+  }
+
+  MemoryPool* pool() const {
+    return pool_;
+  }
+
+ private:
+  struct Chunk {
+    char* data;
+    int64_t size;
+  };
+
+  // Makes 'currentChunk_' a chunk with at least 'bytes' free.
+  void nextChunk(int64_t bytes);
+
+  MemoryPool* const pool_;
+  const int64_t maxRetainedBytes_;
+
+  std::vector<Chunk> chunks_;
+  // Index in 'chunks_' of the chunk allocations are made from.
+  int32_t currentChunk_{-1};
+  // Offset of the first free byte in the current chunk.
+  int64_t offset_{0};
+  int64_t allocatedBytes_{0};
+  int64_t retainedBytes_{0};
+};
+
+} // namespace facebook::velox::memory
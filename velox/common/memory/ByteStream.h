@@ -210,18 +210,34 @@ class ByteInputStream {
 
   virtual std::string toString() const = 0;
 
+  /// Returns the owner of the memory of the stream if there is one. A reader
+  /// may then reference the stream memory instead of copying it out, as long
+  /// as it holds on to the owner. Null if the memory is only valid while the
+  /// stream is read.
+  const std::shared_ptr<const void>& memoryOwner() const {
+    return memoryOwner_;
+  }
+
  protected:
   // Points to the current buffered byte range.
   ByteRange* current_{nullptr};
+
+  // Keeps the memory of the stream alive, see memoryOwner().
+  std::shared_ptr<const void> memoryOwner_;
 };
 
 /// Read-only input stream backed by a set of buffers.
 class BufferInputStream : public ByteInputStream {
  public:
-  explicit BufferInputStream(std::vector<ByteRange> ranges) {
+  /// 'memoryOwner', if set, owns the memory of 'ranges', see
+  /// ByteInputStream::memoryOwner().
+  explicit BufferInputStream(
+      std::vector<ByteRange> ranges,
+      std::shared_ptr<const void> memoryOwner = nullptr) {
     VELOX_CHECK(!ranges.empty(), "Empty BufferInputStream");
     ranges_ = std::move(ranges);
     current_ = &ranges_[0];
+    memoryOwner_ = std::move(memoryOwner);
   }
 
   BufferInputStream(const BufferInputStream&) = delete;
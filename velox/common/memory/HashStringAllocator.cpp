@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 #include "velox/common/memory/HashStringAllocator.h"
+
+#include <algorithm>
+
 #include "velox/common/base/Portability.h"
 #include "velox/common/base/SimdUtil.h"
 
@@ -97,6 +100,15 @@ void HashStringAllocator::clear() {
     state_.currentBytes() -= size;
   }
   state_.allocationsFromPool().clear();
+  state_.slabs().clear();
+  std::fill(
+      std::begin(state_.slabFreeLists()),
+      std::end(state_.slabFreeLists()),
+      nullptr);
+  state_.slabCursor() = nullptr;
+  state_.slabEnd() = nullptr;
+  state_.slabBytes() = 0;
+  state_.slabAllocatedBytes() = 0;
   for (auto i = 0; i < kNumFreeLists; ++i) {
     new (&state_.freeLists()[i]) CompactDoubleList();
   }
@@ -345,6 +357,10 @@ StringView HashStringAllocator::contiguousString(
 }
 
 void HashStringAllocator::freeRestOfBlock(Header* header, int32_t keepBytes) {
+  if (state_.useSlabs() && isSlabBlock(header)) {
+    // Slab blocks keep the size of their size class.
+    return;
+  }
   keepBytes = std::max(keepBytes, kMinAlloc);
   const int32_t freeSize = header->size() - keepBytes - kHeaderSize;
   if (freeSize <= kMinAlloc) {
@@ -373,6 +389,9 @@ void HashStringAllocator::removeFromFreeList(Header* header) {
 HashStringAllocator::Header* HashStringAllocator::allocate(
     int32_t size,
     bool exactSize) {
+  if (state_.useSlabs() && exactSize && size <= kMaxSlabAlloc) {
+    return allocateFromSlab(size);
+  }
   if (size > kMaxAlloc && exactSize) {
     VELOX_CHECK_LE(size, Header::kSizeMask);
     auto* header = castToHeader(allocateFromPool(size + kHeaderSize));
@@ -390,6 +409,54 @@ HashStringAllocator::Header* HashStringAllocator::allocate(
   return header;
 }
 
+HashStringAllocator::Header* HashStringAllocator::allocateFromSlab(
+    int32_t size) {
+  const auto index = slabClass(size);
+  auto*& freeList = state_.slabFreeLists()[index];
+  Header* header;
+  if (freeList != nullptr) {
+    header = freeList;
+    freeList = *reinterpret_cast<Header**>(header->begin());
+    header->clearFree();
+  } else {
+    const int32_t classSize = kMinSlabAlloc << index;
+    const int32_t bytes = classSize + kHeaderSize;
+    if (state_.slabEnd() - state_.slabCursor() < bytes) {
+      // The tail of the last slab is left unused.
+      auto* slab = reinterpret_cast<char*>(allocateFromPool(kSlabBytes));
+      auto& slabs = state_.slabs();
+      slabs.insert(std::upper_bound(slabs.begin(), slabs.end(), slab), slab);
+      state_.slabBytes() += kSlabBytes;
+      state_.slabCursor() = slab;
+      state_.slabEnd() = slab + kSlabBytes;
+    }
+    header = new (state_.slabCursor()) Header(classSize);
+    state_.slabCursor() += bytes;
+  }
+  state_.slabAllocatedBytes() += blockBytes(header);
+  return header;
+}
+
+bool HashStringAllocator::isSlabBlock(const Header* header) const {
+  const auto& slabs = state_.slabs();
+  const auto* address = reinterpret_cast<const char*>(header);
+  auto it = std::upper_bound(slabs.begin(), slabs.end(), address);
+  if (it == slabs.begin()) {
+    return false;
+  }
+  --it;
+  return address < *it + kSlabBytes;
+}
+
+void HashStringAllocator::freeToSlab(Header* header) {
+  VELOX_CHECK(!header->isFree());
+  header->setFree();
+  auto*& freeList = state_.slabFreeLists()[slabClass(header->size())];
+  *reinterpret_cast<Header**>(header->begin()) = freeList;
+  freeList = header;
+  state_.slabAllocatedBytes() -= blockBytes(header);
+}
+
 HashStringAllocator::Header* HashStringAllocator::allocateFromFreeLists(
     int32_t preferredSize,
     bool mustHaveSize,
@@ -447,7 +514,11 @@ void HashStringAllocator::free(Header* header) {
       continued = headerToFree->nextContinued();
       headerToFree->clearContinued();
     }
-    if (headerToFree->size() > kMaxAlloc &&
+    if (state_.useSlabs() && headerToFree->size() <= kMaxSlabAlloc &&
+        isSlabBlock(headerToFree)) {
+      freeToSlab(headerToFree);
+    } else if (
+        headerToFree->size() > kMaxAlloc &&
         !state_.pool().isInCurrentRange(headerToFree) &&
         state_.allocationsFromPool().find(headerToFree) !=
             state_.allocationsFromPool().end()) {
@@ -762,10 +833,24 @@ int64_t HashStringAllocator::checkConsistency() const {
 
   VELOX_CHECK_EQ(numInFreeList, state_.numFree());
   VELOX_CHECK_EQ(bytesInFreeList, state_.freeBytes());
-  return allocatedBytes;
+
+  int64_t slabFreeBytes = 0;
+  for (auto i = 0; i < kNumSlabClasses; ++i) {
+    for (auto* free = state_.slabFreeLists()[i]; free != nullptr;
+         free = *reinterpret_cast<Header* const*>(free->begin())) {
+      VELOX_CHECK(free->isFree());
+      VELOX_CHECK(isSlabBlock(free));
+      VELOX_CHECK_EQ(free->size(), kMinSlabAlloc << i);
+      slabFreeBytes += blockBytes(free);
+    }
+  }
+  VELOX_CHECK_LE(
+      state_.slabAllocatedBytes() + slabFreeBytes, state_.slabBytes());
+  return allocatedBytes + state_.slabAllocatedBytes();
 }
 
 bool HashStringAllocator::isEmpty() const {
-  return state_.sizeFromPool() == 0 && checkConsistency() == 0;
+  return state_.sizeFromPool() == state_.slabBytes() &&
+      checkConsistency() == 0;
 }
 } // namespace facebook::velox
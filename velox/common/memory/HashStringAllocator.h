@@ -24,6 +24,9 @@
 #include "velox/type/StringView.h"
 
 #include <folly/container/F14Map.h>
+#include <gflags/gflags.h>
+
+DECLARE_bool(velox_hash_string_allocator_use_slabs);
 
 namespace facebook::velox {
 
@@ -174,8 +177,16 @@ class HashStringAllocator : public StreamArena {
     }
   };
 
-  explicit HashStringAllocator(memory::MemoryPool* pool)
-      : StreamArena(pool), state_(pool) {}
+  /// If 'useSlabs' is true, allocations of up to kMaxSlabAlloc bytes are
+  /// rounded up to a power of two size class and bump allocated from slabs
+  /// of kSlabBytes. Freed slab blocks go to a free list of their size class
+  /// and are not coalesced. The slabs are returned to the pool on clear().
+  explicit HashStringAllocator(
+      memory::MemoryPool* pool,
+      bool useSlabs = FLAGS_velox_hash_string_allocator_use_slabs)
+      : StreamArena(pool), state_(pool) {
+    state_.useSlabs() = useSlabs;
+  }
 
   ~HashStringAllocator();
 
@@ -321,6 +332,19 @@ class HashStringAllocator : public StreamArena {
     return state_.currentBytes();
   }
 
+  /// Returns the bytes of the slabs for small blocks. Zero unless slabs are
+  /// used.
+  int64_t slabBytes() const {
+    return state_.slabBytes();
+  }
+
+  /// Returns the bytes of the blocks allocated from slabs, including headers.
+  /// The difference to slabBytes() is the fragmentation of the slabs: freed
+  /// blocks waiting for reuse in their size class and unused slab tails.
+  int64_t slabAllocatedBytes() const {
+    return state_.slabAllocatedBytes();
+  }
+
   /// Checks the free space accounting and consistency of Headers. Throws when
   /// detects corruption. Returns the number of allocated payload bytes,
   /// excluding headers, continue links and other overhead.
@@ -352,6 +376,29 @@ class HashStringAllocator : public StreamArena {
   static constexpr int32_t kNumFreeLists = kMaxAlloc - kMinAlloc + 2;
   static constexpr uint32_t kHeaderSize = sizeof(Header);
 
+  // Slab size classes are the powers of two from kMinSlabAlloc to
+  // kMaxSlabAlloc.
+  static constexpr int32_t kMinSlabAlloc = 32;
+  static constexpr int32_t kMaxSlabAlloc = 1024;
+  static constexpr int32_t kNumSlabClasses = 6;
+  static constexpr int64_t kSlabBytes = 64 << 10;
+
+  // Returns the slab size class index for 'size' <= kMaxSlabAlloc.
+  static int32_t slabClass(int32_t size) {
+    return size <= kMinSlabAlloc
+        ? 0
+        : 64 - bits::countLeadingZeros<uint64_t>(size - 1) - 5;
+  }
+
+  // Allocates a block of at least 'size' bytes from the slabs.
+  Header* allocateFromSlab(int32_t size);
+
+  // Returns true if 'header' is in a slab.
+  bool isSlabBlock(const Header* header) const;
+
+  // Puts slab block 'header' in the free list of its size class.
+  void freeToSlab(Header* header);
+
   void newRange(
       int32_t bytes,
       ByteRange* lastRange,
@@ -489,6 +536,31 @@ class HashStringAllocator : public StreamArena {
     // Sum of sizes in 'allocationsFromPool_'.
     DECLARE_FIELD_WITH_INIT_VALUE(int64_t, sizeFromPool, 0);
 
+    typedef Header* SlabFreeLists[kNumSlabClasses];
+    typedef std::vector<char*> Slabs;
+
+    // True if small blocks are allocated from slabs.
+    DECLARE_FIELD_WITH_INIT_VALUE(bool, useSlabs, false);
+
+    // Start addresses of the slabs in ascending order. The slabs are allocated
+    // from pool() and are also in 'allocationsFromPool_'.
+    DECLARE_FIELD(Slabs, slabs);
+
+    // Singly linked lists of freed slab blocks per size class. The next
+    // pointer is in the first bytes of the block.
+    DECLARE_FIELD_WITH_INIT_VALUE(SlabFreeLists, slabFreeLists, {});
+
+    // The unused range of the last slab for bump allocation.
+    DECLARE_FIELD_WITH_INIT_VALUE(char*, slabCursor, nullptr);
+    DECLARE_FIELD_WITH_INIT_VALUE(char*, slabEnd, nullptr);
+
+    // Sum of the sizes of the slabs.
+    DECLARE_FIELD_WITH_INIT_VALUE(int64_t, slabBytes, 0);
+
+    // Bytes of the blocks allocated from slabs and not freed, including
+    // headers.
+    DECLARE_FIELD_WITH_INIT_VALUE(int64_t, slabAllocatedBytes, 0);
+
 #undef DECLARE_FIELD_WITH_INIT_VALUE
 #undef DECLARE_FIELD
 #undef DECLARE_GETTERS
@@ -52,6 +52,8 @@ std::shared_ptr<MemoryAllocator> createAllocator(
     mmapOptions.largestSizeClass = options.largestSizeClassPages;
     mmapOptions.useMmapArena = options.useMmapArena;
     mmapOptions.mmapArenaCapacityRatio = options.mmapArenaCapacityRatio;
+    mmapOptions.useHugePages = options.useMmapHugePages;
+    mmapOptions.numaAware = options.useNumaAwareMmap;
     return std::make_shared<MmapAllocator>(mmapOptions);
   } else {
     return std::make_shared<MallocAllocator>(
@@ -95,6 +97,7 @@ MemoryManager::MemoryManager(const MemoryManagerOptions& options)
       alignment_(std::max(MemoryAllocator::kMinAlignment, options.alignment)),
       checkUsageLeak_(options.checkUsageLeak),
       debugEnabled_(options.debugEnabled),
+      allocationSampleBytes_(options.allocationSampleBytes),
       coreOnAllocationFailureEnabled_(options.coreOnAllocationFailureEnabled),
       disableMemoryPoolTracking_(options.disableMemoryPoolTracking),
       poolDestructionCb_([&](MemoryPool* pool) { dropPool(pool); }),
@@ -111,6 +114,7 @@ MemoryManager::MemoryManager(const MemoryManagerOptions& options)
               .maxCapacity = kMaxMemory,
               .trackUsage = options.trackDefaultUsage,
               .debugEnabled = options.debugEnabled,
+              .allocationSampleBytes = options.allocationSampleBytes,
               .coreOnAllocationFailureEnabled =
                   options.coreOnAllocationFailureEnabled})},
       spillPool_{addLeafPool("__sys_spilling__")},
@@ -246,6 +250,7 @@ std::shared_ptr<MemoryPool> MemoryManager::addRootPool(
   options.maxCapacity = maxCapacity;
   options.trackUsage = true;
   options.debugEnabled = debugEnabled_;
+  options.allocationSampleBytes = allocationSampleBytes_;
   options.coreOnAllocationFailureEnabled = coreOnAllocationFailureEnabled_;
 
   auto pool = createRootPool(poolName, reclaimer, options);
@@ -357,6 +362,54 @@ std::string MemoryManager::toString(bool detail) const {
   return out.str();
 }
 
+std::string MemoryManager::allocationProfile() const {
+  std::map<std::vector<void*>, MemoryPoolImpl::AllocationSample> samples;
+  {
+    std::lock_guard<std::mutex> l(allocationSampleMutex_);
+    samples = retainedAllocationSamples_;
+  }
+  const auto addSamples = [&](const MemoryPool* pool) {
+    for (auto& sample :
+         static_cast<const MemoryPoolImpl*>(pool)->allocationSamples()) {
+      auto& aggregated = samples[sample.stack];
+      aggregated.numSamples += sample.numSamples;
+      aggregated.bytes += sample.bytes;
+    }
+  };
+  std::function<void(MemoryPool*)> visitLeaves = [&](MemoryPool* pool) {
+    if (pool->isLeaf()) {
+      addSamples(pool);
+      return;
+    }
+    pool->visitChildren([&](MemoryPool* child) {
+      visitLeaves(child);
+      return true;
+    });
+  };
+  visitLeaves(sysRoot_.get());
+  for (const auto& pool : getAlivePools()) {
+    visitLeaves(pool.get());
+  }
+
+  std::vector<MemoryPoolImpl::AllocationSample> sampleList;
+  sampleList.reserve(samples.size());
+  for (auto& [stack, sample] : samples) {
+    sample.stack = stack;
+    sampleList.push_back(std::move(sample));
+  }
+  return MemoryPoolImpl::formatAllocationProfile(sampleList);
+}
+
+void MemoryManager::addAllocationSamples(
+    const std::vector<MemoryPoolImpl::AllocationSample>& samples) {
+  std::lock_guard<std::mutex> l(allocationSampleMutex_);
+  for (const auto& sample : samples) {
+    auto& retained = retainedAllocationSamples_[sample.stack];
+    retained.numSamples += sample.numSamples;
+    retained.bytes += sample.bytes;
+  }
+}
+
 std::vector<std::shared_ptr<MemoryPool>> MemoryManager::getAlivePools() const {
   std::vector<std::shared_ptr<MemoryPool>> pools;
   std::shared_lock guard{mutex_};
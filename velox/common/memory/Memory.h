@@ -78,6 +78,12 @@ struct MemoryManagerOptions {
   /// testing purpose.
   bool debugEnabled{FLAGS_velox_memory_pool_debug_enabled};
 
+  /// If not zero, the memory pools record the call stack of an allocation
+  /// once every 'allocationSampleBytes' allocated bytes. See
+  /// MemoryManager::allocationProfile().
+  uint64_t allocationSampleBytes{
+      FLAGS_velox_memory_pool_allocation_sample_bytes};
+
   /// Terminates the process and generates a core file on an allocation failure
   bool coreOnAllocationFailureEnabled{false};
 
@@ -112,6 +118,18 @@ struct MemoryManagerOptions {
   /// NOTE: this only applies for MmapAllocator.
   int32_t mmapArenaCapacityRatio{10};
 
+  /// If true, MmapAllocator aligns large mappings to 2MB and advises them for
+  /// transparent huge pages.
+  ///
+  /// NOTE: this only applies for MmapAllocator.
+  bool useMmapHugePages{false};
+
+  /// If true, MmapAllocator places contiguous allocations on the NUMA node of
+  /// the allocating thread and reports per node usage in its stats.
+  ///
+  /// NOTE: this only applies for MmapAllocator.
+  bool useNumaAwareMmap{false};
+
   /// If not zero, reserve 'smallAllocationReservePct'% of space from
   /// 'allocatorCapacity' for ad hoc small allocations. And those allocations
   /// are delegated to std::malloc. If 'maxMallocBytes' is 0, this value will be
@@ -263,6 +281,17 @@ class MemoryManager {
   /// pools.
   std::string toString(bool detail = false) const;
 
+  /// Returns the allocation samples of all the memory pools in allocation
+  /// sampling mode as a heap profile that pprof can read. This includes the
+  /// samples of the memory pools that have been destroyed. It can be passed as
+  /// the heap report of process::Profiler.
+  std::string allocationProfile() const;
+
+  /// Invoked by a leaf memory pool on destruction to retain its allocation
+  /// 'samples' in the allocation profile.
+  void addAllocationSamples(
+      const std::vector<MemoryPoolImpl::AllocationSample>& samples);
+
   /// Returns the memory manger's internal default root memory pool for testing
   /// purpose.
   MemoryPool& testingDefaultRoot() const {
@@ -306,6 +335,7 @@ class MemoryManager {
   const uint16_t alignment_;
   const bool checkUsageLeak_;
   const bool debugEnabled_;
+  const uint64_t allocationSampleBytes_;
   const bool coreOnAllocationFailureEnabled_;
   const bool disableMemoryPoolTracking_;
 
@@ -314,6 +344,13 @@ class MemoryManager {
   // the pool from 'pools_'.
   const MemoryPoolImpl::DestructionCallback poolDestructionCb_;
 
+  // Declared before the memory pools owned by 'this' which retain their
+  // allocation samples here on destruction.
+  mutable std::mutex allocationSampleMutex_;
+  // The allocation samples of the destroyed memory pools keyed by call stack.
+  std::map<std::vector<void*>, MemoryPoolImpl::AllocationSample>
+      retainedAllocationSamples_;
+
   const std::shared_ptr<MemoryPool> sysRoot_;
   const std::shared_ptr<MemoryPool> spillPool_;
   const std::shared_ptr<MemoryPool> cachePool_;
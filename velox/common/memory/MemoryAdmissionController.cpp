@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/memory/MemoryAdmissionController.h"
+
+#include "velox/common/base/Counters.h"
+#include "velox/common/base/SuccinctPrinter.h"
+
+namespace facebook::velox::memory {
+namespace {
+common::AdmissionController::Config toAdmissionConfig(
+    const MemoryAdmissionController::Config& config) {
+  common::AdmissionController::Config admissionConfig;
+  admissionConfig.maxLimit = config.capacity;
+  admissionConfig.resourceUsageAvgMetric =
+      std::string(kMetricMemoryAdmissionAdmittedBytes);
+  admissionConfig.resourceQueuedCountMetric =
+      std::string(kMetricMemoryAdmissionQueuedCount);
+  admissionConfig.resourceQueuedTimeMsHistogramMetric =
+      std::string(kMetricMemoryAdmissionQueuedTimeMs);
+  return admissionConfig;
+}
+} // namespace
+
+MemoryAdmissionController::MemoryAdmissionController(
+    const Config& config,
+    MemoryArbitrator* arbitrator)
+    : config_(config),
+      arbitrator_(arbitrator),
+      admissionController_(toAdmissionConfig(config_)) {
+  VELOX_CHECK_GT(config_.capacity, 0, "Memory admission capacity can't be 0");
+  VELOX_CHECK(
+      config_.historyWeight > 0 && config_.historyWeight <= 1,
+      "Invalid memory admission history weight {}",
+      config_.historyWeight);
+}
+
+uint64_t MemoryAdmissionController::estimateBytes(
+    const std::string& fingerprint) const {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = history_.find(fingerprint);
+  if (it == history_.end()) {
+    return config_.defaultQueryBytes;
+  }
+  return it->second.estimatedBytes;
+}
+
+uint64_t MemoryAdmissionController::admit(
+    MemoryPool* pool,
+    uint64_t estimatedBytes) {
+  VELOX_CHECK(pool == nullptr || pool->isRoot());
+  const uint64_t admittedBytes = std::min(estimatedBytes, config_.capacity);
+  admissionController_.accept(admittedBytes);
+  if (pool == nullptr || arbitrator_ == nullptr) {
+    return admittedBytes;
+  }
+  const uint64_t targetBytes =
+      std::min<uint64_t>(admittedBytes, pool->maxCapacity());
+  if (targetBytes <= static_cast<uint64_t>(pool->capacity())) {
+    return admittedBytes;
+  }
+  try {
+    arbitrator_->growCapacity(
+        pool, targetBytes - static_cast<uint64_t>(pool->usedBytes()));
+  } catch (const std::exception& e) {
+    // The query still runs and grows its capacity on demand.
+    LOG(WARNING) << "Failed to reserve " << succinctBytes(targetBytes)
+                 << " capacity for admitted query memory pool "
+                 << pool->name() << ": " << e.what();
+  }
+  return admittedBytes;
+}
+
+void MemoryAdmissionController::release(
+    uint64_t admittedBytes,
+    const std::string& fingerprint,
+    uint64_t peakBytes) {
+  admissionController_.release(admittedBytes);
+  if (!fingerprint.empty()) {
+    recordPeakBytes(fingerprint, peakBytes);
+  }
+}
+
+void MemoryAdmissionController::recordPeakBytes(
+    const std::string& fingerprint,
+    uint64_t peakBytes) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = history_.find(fingerprint);
+  if (it == history_.end()) {
+    lru_.push_front(fingerprint);
+    history_.emplace(fingerprint, HistoryEntry{peakBytes, lru_.begin()});
+    if (history_.size() > config_.maxHistoryEntries) {
+      history_.erase(lru_.back());
+      lru_.pop_back();
+    }
+    return;
+  }
+  auto& entry = it->second;
+  const auto smoothedBytes = static_cast<uint64_t>(
+      config_.historyWeight * peakBytes +
+      (1 - config_.historyWeight) * entry.estimatedBytes);
+  // Never forecasts below the latest peak to avoid under admitting a plan
+  // whose memory usage grows.
+  entry.estimatedBytes = std::max(smoothedBytes, peakBytes);
+  lru_.splice(lru_.begin(), lru_, entry.lruPosition);
+}
+} // namespace facebook::velox::memory
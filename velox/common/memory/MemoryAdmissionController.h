@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "velox/common/base/AdmissionController.h"
+#include "velox/common/memory/MemoryArbitrator.h"
+#include "velox/common/memory/MemoryPool.h"
+
+namespace facebook::velox::memory {
+
+/// Admits queries by their forecast memory usage instead of by the currently
+/// reserved memory. Each query is admitted with a memory estimate against the
+/// memory arbitrator capacity, so that queries which will later need more
+/// memory than is left wait to start instead of thrashing memory arbitration
+/// with spills and kills. The estimate is either passed in by the caller or
+/// learned from the peak memory usage of the past runs of the same plan,
+/// keyed by a plan fingerprint. On admission, the query root memory pool
+/// capacity is grown to the estimate up-front to reserve the headroom in the
+/// memory arbitrator.
+class MemoryAdmissionController {
+ public:
+  struct Config {
+    /// The total forecast memory in bytes of the concurrently admitted
+    /// queries. Normally set to the memory arbitrator capacity.
+    uint64_t capacity{0};
+
+    /// The memory estimate in bytes of a query without a caller estimate and
+    /// without history.
+    uint64_t defaultQueryBytes{0};
+
+    /// The weight of the latest run in the learned estimate of a plan
+    /// fingerprint. The learned estimate is never below the latest peak.
+    double historyWeight{0.5};
+
+    /// The max number of plan fingerprints to keep the history for. The ones
+    /// least recently recorded are dropped first.
+    size_t maxHistoryEntries{10'000};
+  };
+
+  /// If 'arbitrator' is not null, the capacity of an admitted query root
+  /// memory pool is grown to its estimate through 'arbitrator' before the
+  /// query starts.
+  explicit MemoryAdmissionController(
+      const Config& config,
+      MemoryArbitrator* arbitrator = nullptr);
+
+  /// Returns the memory estimate of a query with plan 'fingerprint'. This is
+  /// the learned estimate if there is history, otherwise 'defaultQueryBytes'.
+  uint64_t estimateBytes(const std::string& fingerprint) const;
+
+  /// Blocks until a query with 'estimatedBytes' fits in the capacity and then
+  /// reserves the capacity for the query root memory 'pool'. The estimate is
+  /// capped at the total capacity so that a large query runs alone rather
+  /// than never. Returns the admitted bytes to pass to release().
+  uint64_t admit(MemoryPool* pool, uint64_t estimatedBytes);
+
+  /// Same as above but uses the estimate of plan 'fingerprint'.
+  uint64_t admit(MemoryPool* pool, const std::string& fingerprint) {
+    return admit(pool, estimateBytes(fingerprint));
+  }
+
+  /// Releases the 'admittedBytes' of a finished query. If 'fingerprint' is not
+  /// empty, learns its 'peakBytes' for the next run of the same plan.
+  void release(
+      uint64_t admittedBytes,
+      const std::string& fingerprint = "",
+      uint64_t peakBytes = 0);
+
+  /// Records 'peakBytes' of a run of plan 'fingerprint' in the history.
+  void recordPeakBytes(const std::string& fingerprint, uint64_t peakBytes);
+
+  /// Returns the forecast memory of the admitted queries in bytes.
+  uint64_t admittedBytes() const {
+    return admissionController_.currentResourceUsage();
+  }
+
+  size_t numHistoryEntries() const {
+    std::lock_guard<std::mutex> l(mutex_);
+    return history_.size();
+  }
+
+ private:
+  struct HistoryEntry {
+    uint64_t estimatedBytes;
+    // Position in 'lru_'.
+    std::list<std::string>::iterator lruPosition;
+  };
+
+  const Config config_;
+  MemoryArbitrator* const arbitrator_;
+  common::AdmissionController admissionController_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, HistoryEntry> history_;
+  // The fingerprints in 'history_' from the most to the least recently
+  // recorded.
+  std::list<std::string> lru_;
+};
+} // namespace facebook::velox::memory
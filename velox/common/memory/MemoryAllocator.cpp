@@ -370,6 +370,9 @@ Stats Stats::operator-(const Stats& other) const {
     result.sizes[i] = sizes[i] - other.sizes[i];
   }
   result.numAdvise = numAdvise - other.numAdvise;
+  for (auto i = 0; i < kMaxNumaNodes; ++i) {
+    result.numaNodeBytes[i] = numaNodeBytes[i] - other.numaNodeBytes[i];
+  }
   return result;
 }
 
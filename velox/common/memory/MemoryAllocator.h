@@ -86,6 +86,9 @@ struct Stats {
   /// allocation is recorded to the class corresponding to the closest
   /// power of 2 >= the allocation size.
   static constexpr int32_t kNumSizes = 20;
+  /// Max number of NUMA nodes tracked in 'numaNodeBytes'. Allocations on
+  /// higher nodes are recorded to the last one.
+  static constexpr int32_t kMaxNumaNodes = 8;
   Stats() {
     for (auto i = 0; i < sizes.size(); ++i) {
       sizes[i].size = 1 << i;
@@ -136,6 +139,10 @@ struct Stats {
 
   /// Cumulative count of pages advised away, if the allocator exposes this.
   int64_t numAdvise{0};
+
+  /// Bytes of contiguous allocations currently placed on each NUMA node, if
+  /// the allocator is NUMA aware.
+  std::array<int64_t, kMaxNumaNodes> numaNodeBytes{};
 };
 
 class MemoryAllocator;
@@ -17,6 +17,7 @@
 #include "velox/common/memory/MemoryPool.h"
 
 #include <signal.h>
+#include <fstream>
 #include <set>
 
 #include "velox/common/base/Counters.h"
@@ -158,6 +159,10 @@ std::string capacityToString(int64_t capacity) {
   if (FOLLY_UNLIKELY(debugEnabled_)) { \
     recordAllocDbg(__VA_ARGS__);       \
   }
+#define SAMPLE_ALLOC(bytes)                          \
+  if (FOLLY_UNLIKELY(allocationSampleBytes_ != 0)) { \
+    sampleAllocation(bytes);                         \
+  }
 #define DEBUG_RECORD_FREE(...)         \
   if (FOLLY_UNLIKELY(debugEnabled_)) { \
     recordFreeDbg(__VA_ARGS__);        \
@@ -166,6 +171,8 @@ std::string capacityToString(int64_t capacity) {
   if (FOLLY_UNLIKELY(debugEnabled_)) { \
     leakCheckDbg();                    \
   }
+
+thread_local ScopedReservationCache* currentReservationCache{nullptr};
 } // namespace
 
 std::string MemoryPool::Stats::toString() const {
@@ -227,6 +234,7 @@ MemoryPool::MemoryPool(
       trackUsage_(options.trackUsage),
       threadSafe_(options.threadSafe),
       debugEnabled_(options.debugEnabled),
+      allocationSampleBytes_(options.allocationSampleBytes),
       coreOnAllocationFailureEnabled_(options.coreOnAllocationFailureEnabled) {
   VELOX_CHECK(!isRoot() || !isLeaf());
   VELOX_CHECK_GT(
@@ -432,7 +440,16 @@ MemoryPoolImpl::MemoryPoolImpl(
 }
 
 MemoryPoolImpl::~MemoryPoolImpl() {
+  if (isLeaf()) {
+    for (auto* cache = currentReservationCache; cache != nullptr;
+         cache = cache->previous_) {
+      cache->flush(this);
+    }
+  }
   DEBUG_LEAK_CHECK();
+  if (FOLLY_UNLIKELY(allocationSampleBytes_ != 0) && isLeaf()) {
+    manager_->addAllocationSamples(allocationSamples());
+  }
   if (parent_ != nullptr) {
     toImpl(parent_)->dropChild(this);
   }
@@ -515,6 +532,7 @@ void* MemoryPoolImpl::allocate(
         allocator_->getAndClearFailureMessage()));
   }
   DEBUG_RECORD_ALLOC(buffer, size);
+  SAMPLE_ALLOC(size);
   return buffer;
 }
 
@@ -535,6 +553,7 @@ void* MemoryPoolImpl::allocateZeroFilled(int64_t numEntries, int64_t sizeEach) {
         allocator_->getAndClearFailureMessage()));
   }
   DEBUG_RECORD_ALLOC(buffer, size);
+  SAMPLE_ALLOC(size);
   return buffer;
 }
 
@@ -555,6 +574,7 @@ void* MemoryPoolImpl::reallocate(void* p, int64_t size, int64_t newSize) {
         allocator_->getAndClearFailureMessage()));
   }
   DEBUG_RECORD_ALLOC(newP, newSize);
+  SAMPLE_ALLOC(newSize);
   if (p != nullptr) {
     ::memcpy(newP, p, std::min(size, newSize));
     free(p, size);
@@ -603,6 +623,7 @@ void MemoryPoolImpl::allocateNonContiguous(
         allocator_->getAndClearFailureMessage()));
   }
   DEBUG_RECORD_ALLOC(out);
+  SAMPLE_ALLOC(out.byteSize());
   VELOX_CHECK(!out.empty());
   VELOX_CHECK_NULL(out.pool());
   out.setPool(this);
@@ -655,6 +676,7 @@ void MemoryPoolImpl::allocateContiguous(
         allocator_->getAndClearFailureMessage()));
   }
   DEBUG_RECORD_ALLOC(out);
+  SAMPLE_ALLOC(out.size());
   VELOX_CHECK(!out.empty());
   VELOX_CHECK_NULL(out.pool());
   out.setPool(this);
@@ -690,6 +712,7 @@ void MemoryPoolImpl::growContiguous(
   if (FOLLY_UNLIKELY(debugEnabled_)) {
     recordGrowDbg(allocation.data(), allocation.size());
   }
+  SAMPLE_ALLOC(AllocationTraits::pageBytes(increment));
 }
 
 int64_t MemoryPoolImpl::capacity() const {
@@ -749,6 +772,7 @@ std::shared_ptr<MemoryPool> MemoryPoolImpl::genChild(
           .trackUsage = trackUsage_,
           .threadSafe = threadSafe,
           .debugEnabled = debugEnabled_,
+          .allocationSampleBytes = allocationSampleBytes_,
           .coreOnAllocationFailureEnabled = coreOnAllocationFailureEnabled_});
 }
 
@@ -777,6 +801,10 @@ bool MemoryPoolImpl::maybeReserve(uint64_t increment) {
 void MemoryPoolImpl::reserve(uint64_t size, bool reserveOnly) {
   if (FOLLY_LIKELY(trackUsage_)) {
     if (FOLLY_LIKELY(threadSafe_)) {
+      if (FOLLY_UNLIKELY(currentReservationCache != nullptr) && !reserveOnly &&
+          currentReservationCache->reserve(this, size)) {
+        return;
+      }
       reserveThreadSafe(size, reserveOnly);
     } else {
       reserveNonThreadSafe(size, reserveOnly);
@@ -911,6 +939,10 @@ void MemoryPoolImpl::release() {
 void MemoryPoolImpl::release(uint64_t size, bool releaseOnly) {
   if (FOLLY_LIKELY(trackUsage_)) {
     if (FOLLY_LIKELY(threadSafe_)) {
+      if (FOLLY_UNLIKELY(currentReservationCache != nullptr) && !releaseOnly &&
+          currentReservationCache->release(this, size)) {
+        return;
+      }
       releaseThreadSafe(size, releaseOnly);
     } else {
       releaseNonThreadSafe(size, releaseOnly);
@@ -1256,6 +1288,71 @@ void MemoryPoolImpl::recordGrowDbg(const void* addr, uint64_t newSize) {
   allocResult->second.size = newSize;
 }
 
+void MemoryPoolImpl::sampleAllocation(uint64_t bytes) {
+  const uint64_t prevBytes = sampledAllocBytes_.fetch_add(bytes);
+  const uint64_t numSamples = (prevBytes + bytes) / allocationSampleBytes_ -
+      prevBytes / allocationSampleBytes_;
+  if (numSamples == 0) {
+    return;
+  }
+  // Skips the frame of this function.
+  process::StackTrace stackTrace(1);
+  std::lock_guard<std::mutex> l(allocationSampleMutex_);
+  auto& sample = allocationSamples_[stackTrace.getStack()];
+  sample.first += numSamples;
+  sample.second += numSamples * allocationSampleBytes_;
+}
+
+std::vector<MemoryPoolImpl::AllocationSample>
+MemoryPoolImpl::allocationSamples() const {
+  std::vector<AllocationSample> samples;
+  std::lock_guard<std::mutex> l(allocationSampleMutex_);
+  samples.reserve(allocationSamples_.size());
+  for (const auto& [stack, sample] : allocationSamples_) {
+    samples.push_back({stack, sample.first, sample.second});
+  }
+  return samples;
+}
+
+// static
+std::string MemoryPoolImpl::formatAllocationProfile(
+    const std::vector<AllocationSample>& samples) {
+  uint64_t totalSamples{0};
+  uint64_t totalBytes{0};
+  for (const auto& sample : samples) {
+    totalSamples += sample.numSamples;
+    totalBytes += sample.bytes;
+  }
+  std::stringstream out;
+  // The 'heapprofile' format takes the sampled bytes as they are. Reports the
+  // allocated bytes as both the in use and the allocated space.
+  out << fmt::format(
+      "heap profile: {}: {} [{}: {}] @ heapprofile\n",
+      totalSamples,
+      totalBytes,
+      totalSamples,
+      totalBytes);
+  for (const auto& sample : samples) {
+    out << fmt::format(
+        "{}: {} [{}: {}] @",
+        sample.numSamples,
+        sample.bytes,
+        sample.numSamples,
+        sample.bytes);
+    for (const auto* frame : sample.stack) {
+      out << fmt::format(" {}", fmt::ptr(frame));
+    }
+    out << "\n";
+  }
+  // pprof symbolizes the addresses with the mapped binaries.
+  out << "\nMAPPED_LIBRARIES:\n";
+  std::ifstream maps("/proc/self/maps");
+  if (maps.is_open()) {
+    out << maps.rdbuf();
+  }
+  return out.str();
+}
+
 void MemoryPoolImpl::leakCheckDbg() {
   VELOX_CHECK(debugEnabled_);
   if (debugAllocRecords_.empty()) {
@@ -1312,4 +1409,98 @@ void MemoryPoolImpl::handleAllocationFailure(
 
   VELOX_MEM_ALLOC_ERROR(failureMessage);
 }
+
+ScopedReservationCache::ScopedReservationCache(int64_t maxBytesPerPool)
+    : maxBytesPerPool_(maxBytesPerPool), previous_(currentReservationCache) {
+  VELOX_CHECK_GT(maxBytesPerPool_, 0);
+  currentReservationCache = this;
+}
+
+ScopedReservationCache::~ScopedReservationCache() {
+  VELOX_CHECK_EQ(currentReservationCache, this);
+  flush();
+  currentReservationCache = previous_;
+}
+
+// static
+ScopedReservationCache* ScopedReservationCache::current() {
+  return currentReservationCache;
+}
+
+void ScopedReservationCache::flush() {
+  // Releasing to a pool may free memory that comes back to this cache, so the
+  // cached bytes are detached before the release.
+  while (!pools_.empty()) {
+    auto pools = std::move(pools_);
+    pools_.clear();
+    for (const auto& [pool, bytes] : pools) {
+      if (bytes > 0) {
+        pool->releaseThreadSafe(bytes, false);
+      }
+    }
+  }
+}
+
+void ScopedReservationCache::flush(MemoryPoolImpl* pool) {
+  for (auto it = pools_.begin(); it != pools_.end(); ++it) {
+    if (it->first == pool) {
+      const auto bytes = it->second;
+      pools_.erase(it);
+      if (bytes > 0) {
+        pool->releaseThreadSafe(bytes, false);
+      }
+      return;
+    }
+  }
+}
+
+int64_t ScopedReservationCache::cachedBytes(const MemoryPool* pool) const {
+  for (const auto& [cachedPool, bytes] : pools_) {
+    if (cachedPool == pool) {
+      return bytes;
+    }
+  }
+  return 0;
+}
+
+bool ScopedReservationCache::reserve(MemoryPoolImpl* pool, int64_t size) {
+  if (size > maxBytesPerPool_) {
+    return false;
+  }
+  for (auto& [cachedPool, bytes] : pools_) {
+    if (cachedPool == pool && bytes >= size) {
+      bytes -= size;
+      return true;
+    }
+  }
+  // Refills the cache with 'maxBytesPerPool_' bytes. The reservation may free
+  // memory of 'pool' through memory arbitration which in turn goes to the
+  // cache, so the entry is looked up after the reservation.
+  pool->reserveThreadSafe(maxBytesPerPool_);
+  for (auto& [cachedPool, bytes] : pools_) {
+    if (cachedPool == pool) {
+      bytes += maxBytesPerPool_ - size;
+      return true;
+    }
+  }
+  pools_.emplace_back(pool, maxBytesPerPool_ - size);
+  return true;
+}
+
+bool ScopedReservationCache::release(MemoryPoolImpl* pool, int64_t size) {
+  for (auto& [cachedPool, bytes] : pools_) {
+    if (cachedPool == pool) {
+      if (bytes + size > maxBytesPerPool_) {
+        return false;
+      }
+      bytes += size;
+      return true;
+    }
+  }
+  if (size > maxBytesPerPool_) {
+    return false;
+  }
+  pools_.emplace_back(pool, size);
+  return true;
+}
 } // namespace facebook::velox::memory
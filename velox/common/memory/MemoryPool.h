@@ -17,8 +17,10 @@
 #pragma once
 
 #include <atomic>
+#include <map>
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include <fmt/format.h>
 #include "velox/common/base/BitUtil.h"
@@ -30,6 +32,7 @@
 
 DECLARE_bool(velox_memory_leak_check_enabled);
 DECLARE_bool(velox_memory_pool_debug_enabled);
+DECLARE_uint64(velox_memory_pool_allocation_sample_bytes);
 DECLARE_bool(velox_memory_pool_capacity_transfer_across_tasks);
 
 namespace facebook::velox::exec {
@@ -135,6 +138,13 @@ class MemoryPool : public std::enable_shared_from_this<MemoryPool> {
     /// of memory leak for testing purpose.
     bool debugEnabled{FLAGS_velox_memory_pool_debug_enabled};
 
+    /// If not zero, records the call stack of an allocation once every
+    /// 'allocationSampleBytes' allocated from a leaf memory pool. The samples
+    /// are aggregated per call stack to find the allocation hot spots at a low
+    /// cost. See MemoryManager::allocationProfile().
+    uint64_t allocationSampleBytes{
+        FLAGS_velox_memory_pool_allocation_sample_bytes};
+
     /// Terminates the process and generates a core file on an allocation
     /// failure
     bool coreOnAllocationFailureEnabled{false};
@@ -522,6 +532,7 @@ class MemoryPool : public std::enable_shared_from_this<MemoryPool> {
   const bool trackUsage_;
   const bool threadSafe_;
   const bool debugEnabled_;
+  const uint64_t allocationSampleBytes_;
   const bool coreOnAllocationFailureEnabled_;
 
   /// Indicates if the memory pool has been aborted by the memory arbitrator or
@@ -715,6 +726,23 @@ class MemoryPoolImpl : public MemoryPool {
     debugPoolNameRegex() = regex;
   }
 
+  /// The allocations sampled from one call stack in the allocation sampling
+  /// mode. Each sample stands for 'allocationSampleBytes' allocated bytes.
+  struct AllocationSample {
+    std::vector<void*> stack;
+    uint64_t numSamples{0};
+    uint64_t bytes{0};
+  };
+
+  /// Returns the allocation samples of this leaf memory pool aggregated per
+  /// call stack. Empty if the allocation sampling mode is not enabled.
+  std::vector<AllocationSample> allocationSamples() const;
+
+  /// Formats 'samples' as a legacy text heap profile that pprof can read. The
+  /// sampled bytes are the cumulative allocated bytes, not the bytes in use.
+  static std::string formatAllocationProfile(
+      const std::vector<AllocationSample>& samples);
+
  private:
   void enterArbitration() override;
 
@@ -973,6 +1001,11 @@ class MemoryPoolImpl : public MemoryPool {
   // Accounts for ContiguousAllocation size change in growContiguous().
   void recordGrowDbg(const void* addr, uint64_t newSize);
 
+  // Invoked on each allocation of 'bytes' if the allocation sampling mode of
+  // this memory pool is enabled. Records the call stack of the allocation
+  // for each 'allocationSampleBytes_' boundary crossed.
+  void sampleAllocation(uint64_t bytes);
+
   // Invoked by memory pool destructor to detect the sources of leaked memory
   // allocations from the call sites which are still recorded in
   // 'debugAllocRecords_'. If there is no memory leaks, 'debugAllocRecords_'
@@ -1053,6 +1086,65 @@ class MemoryPoolImpl : public MemoryPool {
 
   // Map from address to 'AllocationRecord'.
   std::unordered_map<uint64_t, AllocationRecord> debugAllocRecords_;
+
+  // The number of bytes allocated from this memory pool in allocation
+  // sampling mode.
+  std::atomic_uint64_t sampledAllocBytes_{0};
+
+  // Mutex for 'allocationSamples_'.
+  mutable std::mutex allocationSampleMutex_;
+
+  // Map from allocation call stack to the number of samples and bytes.
+  std::map<std::vector<void*>, std::pair<uint64_t, uint64_t>>
+      allocationSamples_;
+
+  friend class ScopedReservationCache;
+};
+
+/// Caches memory reservations of thread-safe leaf memory pools for the calling
+/// thread. While a cache is in scope, the allocations and frees of the thread
+/// on a thread-safe leaf pool are first served from up to 'maxBytesPerPool'
+/// bytes pre-reserved from that pool, without taking the pool's lock. The
+/// cached bytes are counted as used by the pool and are released back to it
+/// when the cache goes out of scope. A driver thread keeps a cache in scope for
+/// each operator call so that the cached bytes are flushed at operator
+/// boundaries.
+class ScopedReservationCache {
+ public:
+  explicit ScopedReservationCache(int64_t maxBytesPerPool);
+
+  ~ScopedReservationCache();
+
+  /// Returns the innermost cache in scope on the calling thread or nullptr.
+  static ScopedReservationCache* current();
+
+  /// Releases the cached bytes of all pools back to the pools.
+  void flush();
+
+  /// Returns the bytes cached for 'pool'.
+  int64_t cachedBytes(const MemoryPool* pool) const;
+
+ private:
+  // Serves the reservation of 'size' bytes on 'pool' from the cache, refilling
+  // the cache from 'pool' if needed. Returns false if 'size' is too large to
+  // be cached.
+  bool reserve(MemoryPoolImpl* pool, int64_t size);
+
+  // Returns 'size' freed bytes of 'pool' to the cache. Returns false if the
+  // cache of 'pool' is full.
+  bool release(MemoryPoolImpl* pool, int64_t size);
+
+  // Releases the cached bytes of 'pool' back to 'pool'.
+  void flush(MemoryPoolImpl* pool);
+
+  const int64_t maxBytesPerPool_;
+  ScopedReservationCache* const previous_;
+
+  // Cached bytes per pool. An operator allocates from a few pools, so a vector
+  // is faster than a map here.
+  std::vector<std::pair<MemoryPoolImpl*, int64_t>> pools_;
+
+  friend class MemoryPoolImpl;
 };
 
 /// An Allocator backed by a memory pool for STL containers.
@@ -17,6 +17,10 @@
 #include "velox/common/memory/MmapAllocator.h"
 
 #include <sys/mman.h>
+#ifdef linux
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include "velox/common/base/Counters.h"
 #include "velox/common/base/Portability.h"
@@ -24,10 +28,91 @@
 #include "velox/common/memory/Memory.h"
 
 namespace facebook::velox::memory {
+namespace {
+constexpr size_t kHugePageSize = 2 << 20;
+
+// Maps 'bytes' of anonymous memory. If 'hugePages' is true, the mapping starts
+// at a huge page boundary and is advised for transparent huge pages. Returns
+// MAP_FAILED on error.
+void* mmapMemory(size_t bytes, bool hugePages) {
+  if (!hugePages) {
+    return ::mmap(
+        nullptr,
+        bytes,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0);
+  }
+  // Over-maps by one huge page and trims the unaligned head and tail.
+  auto* data = reinterpret_cast<char*>(::mmap(
+      nullptr,
+      bytes + kHugePageSize,
+      PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS,
+      -1,
+      0));
+  if (data == MAP_FAILED) {
+    return MAP_FAILED;
+  }
+  auto* aligned = reinterpret_cast<char*>(
+      bits::roundUp(reinterpret_cast<uint64_t>(data), kHugePageSize));
+  if (aligned > data) {
+    ::munmap(data, aligned - data);
+  }
+  const auto tailBytes = kHugePageSize - (aligned - data);
+  if (tailBytes > 0) {
+    ::munmap(aligned + bytes, tailBytes);
+  }
+#ifdef linux
+  if (::madvise(aligned, bytes, MADV_HUGEPAGE) != 0) {
+    VELOX_MEM_LOG(WARNING) << "madvise hugepage errno="
+                           << folly::errnoStr(errno);
+  }
+#endif
+  return aligned;
+}
+
+// Returns the NUMA node of the calling thread, or 0 if it can't be determined.
+int32_t currentNumaNode() {
+#ifdef linux
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return std::min<int32_t>(node, Stats::kMaxNumaNodes - 1);
+  }
+#endif
+  return 0;
+}
+
+// Prefers 'node' for the physical pages of the 'bytes' at 'data'. The pages
+// are placed on first touch, so this only affects pages not yet touched.
+void bindToNumaNode(void* data, size_t bytes, int32_t node) {
+#ifdef linux
+  constexpr int kMpolPreferred = 1;
+  unsigned long mask = 1UL << node;
+  if (::syscall(
+          SYS_mbind,
+          data,
+          bytes,
+          kMpolPreferred,
+          &mask,
+          sizeof(mask) * 8 + 1,
+          0) != 0) {
+    VELOX_MEM_LOG_EVERY_MS(WARNING, 1000)
+        << "mbind to NUMA node " << node << " errno="
+        << folly::errnoStr(errno);
+  }
+#endif
+}
+} // namespace
+
 MmapAllocator::MmapAllocator(const Options& options)
     : MemoryAllocator(options.largestSizeClass),
       kind_(MemoryAllocator::Kind::kMmap),
       useMmapArena_(options.useMmapArena),
+      useHugePages_(options.useHugePages),
+      numaAware_(options.numaAware),
       maxMallocBytes_(options.maxMallocBytes),
       mallocReservedBytes_(
           maxMallocBytes_ == 0
@@ -37,7 +122,11 @@ MmapAllocator::MmapAllocator(const Options& options)
           AllocationTraits::numPages(options.capacity - mallocReservedBytes_),
           64 * sizeClassSizes_.back())) {
   for (const auto& size : sizeClassSizes_) {
-    sizeClasses_.push_back(std::make_unique<SizeClass>(capacity_ / size, size));
+    sizeClasses_.push_back(std::make_unique<SizeClass>(
+        capacity_ / size,
+        size,
+        useHugePages_ &&
+            AllocationTraits::pageBytes(size) >= kHugePageSize));
   }
 
   if (useMmapArena_) {
@@ -248,16 +337,7 @@ bool MmapAllocator::allocateContiguousImpl(
   }
   const auto numLargeCollateralPages = allocation.numPages();
   if (numLargeCollateralPages > 0) {
-    useHugePages(allocation, false);
-    if (useMmapArena_) {
-      std::lock_guard<std::mutex> l(arenaMutex_);
-      managedArenas_->free(allocation.data(), allocation.maxSize());
-    } else {
-      if (::munmap(allocation.data(), allocation.maxSize()) < 0) {
-        VELOX_MEM_LOG(ERROR) << "munmap got " << folly::errnoStr(errno)
-                             << " for " << allocation.toString();
-      }
-    }
+    unmapContiguous(allocation);
     allocation.clear();
   }
   const auto totalCollateralPages =
@@ -330,13 +410,7 @@ bool MmapAllocator::allocateContiguousImpl(
       std::lock_guard<std::mutex> l(arenaMutex_);
       data = managedArenas_->allocate(AllocationTraits::pageBytes(maxPages));
     } else {
-      data = ::mmap(
-          nullptr,
-          AllocationTraits::pageBytes(maxPages),
-          PROT_READ | PROT_WRITE,
-          MAP_PRIVATE | MAP_ANONYMOUS,
-          -1,
-          0);
+      data = mmapMemory(AllocationTraits::pageBytes(maxPages), useHugePages_);
     }
   }
   if (data == nullptr || data == MAP_FAILED) {
@@ -358,6 +432,7 @@ bool MmapAllocator::allocateContiguousImpl(
       AllocationTraits::pageBytes(numPages),
       AllocationTraits::pageBytes(maxPages));
   useHugePages(allocation, true);
+  addNumaNodeBytes(data, allocation.size());
   return true;
 }
 
@@ -370,6 +445,22 @@ void MmapAllocator::freeContiguousImpl(ContiguousAllocation& allocation) {
   if (allocation.empty()) {
     return;
   }
+  unmapContiguous(allocation);
+  numMapped_ -= allocation.numPages();
+  numExternalMapped_ -= allocation.numPages();
+  numAllocated_ -= allocation.numPages();
+  allocation.clear();
+}
+
+void MmapAllocator::unmapContiguous(ContiguousAllocation& allocation) {
+  if (numaAware_) {
+    std::lock_guard<std::mutex> l(numaMutex_);
+    auto it = numaNodes_.find(allocation.data());
+    if (it != numaNodes_.end()) {
+      numaNodeBytes_[it->second.first] -= it->second.second;
+      numaNodes_.erase(it);
+    }
+  }
   useHugePages(allocation, false);
   if (useMmapArena_) {
     std::lock_guard<std::mutex> l(arenaMutex_);
@@ -380,10 +471,21 @@ void MmapAllocator::freeContiguousImpl(ContiguousAllocation& allocation) {
                            << " for " << allocation.toString();
     }
   }
-  numMapped_ -= allocation.numPages();
-  numExternalMapped_ -= allocation.numPages();
-  numAllocated_ -= allocation.numPages();
-  allocation.clear();
+}
+
+void MmapAllocator::addNumaNodeBytes(void* data, int64_t bytes) {
+  if (!numaAware_) {
+    return;
+  }
+  std::lock_guard<std::mutex> l(numaMutex_);
+  auto it = numaNodes_.find(data);
+  if (it == numaNodes_.end()) {
+    const auto node = currentNumaNode();
+    bindToNumaNode(data, bytes, node);
+    it = numaNodes_.emplace(data, std::make_pair(node, 0)).first;
+  }
+  it->second.second += bytes;
+  numaNodeBytes_[it->second.first] += bytes;
 }
 
 bool MmapAllocator::growContiguousWithoutRetry(
@@ -420,6 +522,7 @@ bool MmapAllocator::growContiguousWithoutRetry(
   }
 
   numExternalMapped_ += increment;
+  addNumaNodeBytes(allocation.data(), AllocationTraits::pageBytes(increment));
   allocation.set(
       allocation.data(),
       allocation.size() + AllocationTraits::pageBytes(increment),
@@ -509,7 +612,10 @@ MachinePageCount MmapAllocator::adviseAway(MachinePageCount target) {
   return numAway;
 }
 
-MmapAllocator::SizeClass::SizeClass(size_t capacity, MachinePageCount unitSize)
+MmapAllocator::SizeClass::SizeClass(
+    size_t capacity,
+    MachinePageCount unitSize,
+    bool useHugePages)
     : capacity_(capacity),
       unitSize_(unitSize),
       byteSize_(AllocationTraits::pageBytes(capacity_ * unitSize_)),
@@ -523,13 +629,7 @@ MmapAllocator::SizeClass::SizeClass(size_t capacity, MachinePageCount unitSize)
       0,
       "Sizeclass {} must have a multiple of 64 capacity",
       unitSize_);
-  void* ptr = mmap(
-      nullptr,
-      AllocationTraits::pageBytes(capacity_ * unitSize_),
-      PROT_READ | PROT_WRITE,
-      MAP_PRIVATE | MAP_ANONYMOUS,
-      -1,
-      0);
+  void* ptr = mmapMemory(byteSize_, useHugePages);
   if (ptr == MAP_FAILED || ptr == nullptr) {
     VELOX_FAIL(
         "Could not allocate working memory "
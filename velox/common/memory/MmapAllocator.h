@@ -22,6 +22,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 
 #include <folly/ThreadCachedInt.h>
@@ -80,6 +81,17 @@ class MmapAllocator : public MemoryAllocator {
     /// and 'smallAllocationReservePct' will be automatically set to 0
     /// disregarding any passed in value.
     int32_t maxMallocBytes = 3072;
+
+    /// If true, mmaps for contiguous allocations are aligned to the 2MB huge
+    /// page size and advised with MADV_HUGEPAGE so that transparent huge pages
+    /// back them. Size classes of at least 2MB, i.e. 'largestSizeClass' of 512
+    /// pages or more, are mapped the same way.
+    bool useHugePages{false};
+
+    /// If true, contiguous allocations are placed on the NUMA node of the
+    /// allocating thread and the bytes allocated per node are reported in
+    /// Stats::numaNodeBytes.
+    bool numaAware{false};
   };
 
   explicit MmapAllocator(const Options& options);
@@ -156,6 +168,9 @@ class MmapAllocator : public MemoryAllocator {
   Stats stats() const override {
     auto stats = stats_;
     stats.numAdvise = numAdvisedPages_;
+    for (auto i = 0; i < Stats::kMaxNumaNodes; ++i) {
+      stats.numaNodeBytes[i] = numaNodeBytes_[i];
+    }
     return stats;
   }
 
@@ -168,7 +183,10 @@ class MmapAllocator : public MemoryAllocator {
   // 'unitSize_' machine pages.
   class SizeClass {
    public:
-    SizeClass(size_t capacity, MachinePageCount unitSize);
+    SizeClass(
+        size_t capacity,
+        MachinePageCount unitSize,
+        bool useHugePages = false);
 
     ~SizeClass();
 
@@ -336,6 +354,15 @@ class MmapAllocator : public MemoryAllocator {
 
   void freeContiguousImpl(ContiguousAllocation& allocation);
 
+  // Unmaps the memory of contiguous 'allocation' and drops it from the per
+  // NUMA node accounting. Does not update the page counters.
+  void unmapContiguous(ContiguousAllocation& allocation);
+
+  // Records 'bytes' of contiguous allocation at 'data' as placed on the NUMA
+  // node of the calling thread. Binds the range to that node on first call for
+  // 'data'. No-op unless 'numaAware_' is set.
+  void addNumaNodeBytes(void* data, int64_t bytes);
+
   // Allocates 'bytes' contiguous bytes and returns the pointer to the first
   // byte. If 'bytes' is less than 'maxMallocBytes_', delegates the allocation
   // to malloc. If the size is above that and below the largest size classes'
@@ -379,6 +406,22 @@ class MmapAllocator : public MemoryAllocator {
   // issued for each such allocation.
   const bool useMmapArena_;
 
+  // See Options::useHugePages.
+  const bool useHugePages_;
+
+  // See Options::numaAware.
+  const bool numaAware_;
+
+  // Serializes access to 'numaNodes_'.
+  std::mutex numaMutex_;
+
+  // The NUMA node and size in bytes of each contiguous allocation keyed by its
+  // start address. Set only if 'numaAware_' is true.
+  std::unordered_map<void*, std::pair<int32_t, int64_t>> numaNodes_;
+
+  // Bytes of contiguous allocations per NUMA node.
+  std::array<std::atomic<int64_t>, Stats::kMaxNumaNodes> numaNodeBytes_{};
+
   // Serializes moving capacity between size classes
   std::mutex sizeClassBalanceMutex_;
 
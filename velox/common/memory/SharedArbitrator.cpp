@@ -233,6 +233,24 @@ bool SharedArbitrator::ExtraConfig::globalArbitrationWithoutSpill(
       kDefaultGlobalArbitrationWithoutSpill);
 }
 
+bool SharedArbitrator::ExtraConfig::predictiveArbitrationEnabled(
+    const std::unordered_map<std::string, std::string>& configs) {
+  return getConfig<bool>(
+      configs,
+      kPredictiveArbitrationEnabled,
+      kDefaultPredictiveArbitrationEnabled);
+}
+
+uint64_t SharedArbitrator::ExtraConfig::predictiveArbitrationIntervalNs(
+    const std::unordered_map<std::string, std::string>& configs) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             config::toDuration(getConfig<std::string>(
+                 configs,
+                 kPredictiveArbitrationInterval,
+                 std::string(kDefaultPredictiveArbitrationInterval))))
+      .count();
+}
+
 double SharedArbitrator::ExtraConfig::globalArbitrationAbortTimeRatio(
     const std::unordered_map<std::string, std::string>& configs) {
   return getConfig<double>(
@@ -269,12 +287,19 @@ SharedArbitrator::SharedArbitrator(const Config& config)
           ExtraConfig::globalArbitrationAbortTimeRatio(config.extraConfigs)),
       globalArbitrationWithoutSpill_(
           ExtraConfig::globalArbitrationWithoutSpill(config.extraConfigs)),
+      predictiveArbitrationEnabled_(
+          ExtraConfig::predictiveArbitrationEnabled(config.extraConfigs)),
+      predictiveArbitrationIntervalNs_(
+          ExtraConfig::predictiveArbitrationIntervalNs(config.extraConfigs)),
       freeReservedCapacity_(reservedCapacity_),
       freeNonReservedCapacity_(capacity_ - freeReservedCapacity_) {
   VELOX_CHECK_EQ(kind_, config.kind);
   VELOX_CHECK_LE(reservedCapacity_, capacity_);
   VELOX_CHECK_GT(
       maxArbitrationTimeNs_, 0, "maxArbitrationTimeNs can't be zero");
+  VELOX_CHECK(
+      !predictiveArbitrationEnabled_ || predictiveArbitrationIntervalNs_ > 0,
+      "predictiveArbitrationInterval can't be zero");
 
   VELOX_CHECK_LE(
       globalArbitrationMemoryReclaimPct_,
@@ -418,6 +443,8 @@ void SharedArbitrator::finishArbitration(ArbitrationOperation* op) {
   op->finish();
 
   const auto stats = op->stats();
+  op->participant()->addArbitrationWaitTime(
+      stats.localArbitrationWaitTimeNs + stats.globalArbitrationWaitTimeNs);
   if (stats.executionTimeNs != 0) {
     RECORD_HISTOGRAM_METRIC_VALUE(
         kMetricArbitratorOpExecTimeMs, stats.executionTimeNs / 1'000'000);
@@ -504,8 +531,12 @@ void SharedArbitrator::removePool(MemoryPool* pool) {
   freeCapacity(freedBytes);
 
   std::unique_lock guard{participantLock_};
-  const auto ret = participants_.erase(pool->name());
-  VELOX_CHECK_EQ(ret, 1);
+  auto it = participants_.find(pool->name());
+  VELOX_CHECK(it != participants_.end());
+  RECORD_HISTOGRAM_METRIC_VALUE(
+      kMetricArbitratorQueryArbitrationWaitTimeMs,
+      it->second->stats().arbitrationWaitTimeNs / 1'000'000);
+  participants_.erase(it);
 }
 
 std::vector<ArbitrationCandidate> SharedArbitrator::getCandidates(
@@ -888,18 +919,32 @@ void SharedArbitrator::updateGlobalArbitrationStats(
 void SharedArbitrator::globalArbitrationMain() {
   VELOX_MEM_LOG(INFO) << "Global arbitration controller started";
   while (true) {
+    bool hasWaiters{false};
     {
       std::unique_lock<std::mutex> l(stateMutex_);
-      globalArbitrationThreadCv_.wait(l, [&] {
+      const auto wakeup = [&] {
         return hasShutdownLocked() || !globalArbitrationWaiters_.empty();
-      });
+      };
+      if (predictiveArbitrationEnabled_) {
+        globalArbitrationThreadCv_.wait_for(
+            l,
+            std::chrono::nanoseconds(predictiveArbitrationIntervalNs_),
+            wakeup);
+      } else {
+        globalArbitrationThreadCv_.wait(l, wakeup);
+      }
       if (hasShutdownLocked()) {
         VELOX_CHECK(globalArbitrationWaiters_.empty());
         break;
       }
+      hasWaiters = !globalArbitrationWaiters_.empty();
     }
     GlobalArbitrationSection section{this};
-    runGlobalArbitration();
+    if (hasWaiters) {
+      runGlobalArbitration();
+    } else {
+      runPredictiveArbitration();
+    }
   }
   VELOX_MEM_LOG(INFO) << "Global arbitration controller stopped";
 }
@@ -967,6 +1012,67 @@ void SharedArbitrator::runGlobalArbitration() {
                       << " with " << round << " rounds";
 }
 
+void SharedArbitrator::runPredictiveArbitration() {
+  TestValue::adjust(
+      "facebook::velox::memory::SharedArbitrator::runPredictiveArbitration",
+      this);
+  const double intervalSecs =
+      predictiveArbitrationIntervalNs_ / 1'000'000'000.0;
+  uint64_t grownBytes{0};
+  uint64_t reclaimedBytes{0};
+  auto candidates = getCandidates();
+  for (const auto& candidate : candidates) {
+    const auto& participant = candidate.participant;
+    const double growthRate = participant->updateGrowthRate();
+    // Leaves the participants under arbitration to the arbitration itself.
+    if (participant->aborted() || participant->hasRunningOp()) {
+      continue;
+    }
+    if (growthRate < 0) {
+      shrink(participant, /*reclaimAll=*/false);
+      continue;
+    }
+    if (growthRate == 0) {
+      continue;
+    }
+    const uint64_t expectedBytes = participant->pool()->usedBytes() +
+        static_cast<uint64_t>(growthRate * intervalSecs);
+    const uint64_t capacity = participant->capacity();
+    if (expectedBytes <= capacity || capacity >= participant->maxCapacity()) {
+      continue;
+    }
+    const uint64_t growBytes = std::min(
+        bits::roundUp(expectedBytes - capacity, 1 << 20),
+        participant->maxCapacity() - capacity);
+    const uint64_t allocatedBytes =
+        allocateCapacity(participant->id(), 0, growBytes, 0);
+    if (allocatedBytes > 0) {
+      if (participant->grow(allocatedBytes, 0)) {
+        grownBytes += allocatedBytes;
+      } else {
+        freeCapacity(allocatedBytes);
+      }
+    }
+    // Spills the fast growing participant early if the arbitrator is out of
+    // free capacity, before its requests block on the global arbitration.
+    if (allocatedBytes < growBytes && !globalArbitrationWithoutSpill_ &&
+        participant->reclaimableUsedCapacity() > 0) {
+      reclaimedBytes += reclaim(
+          participant,
+          growBytes - allocatedBytes,
+          maxArbitrationTimeNs_,
+          /*localArbitration=*/false);
+    }
+  }
+  if (grownBytes > 0) {
+    RECORD_METRIC_VALUE(kMetricArbitratorPredictiveGrowBytes, grownBytes);
+  }
+  if (reclaimedBytes > 0) {
+    RECORD_METRIC_VALUE(
+        kMetricArbitratorPredictiveReclaimBytes, reclaimedBytes);
+  }
+}
+
 uint64_t SharedArbitrator::getGlobalArbitrationTarget() {
   uint64_t targetBytes{0};
   std::lock_guard<std::mutex> l(stateMutex_);
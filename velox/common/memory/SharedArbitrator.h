@@ -225,6 +225,28 @@ class SharedArbitrator : public memory::MemoryArbitrator {
     static bool globalArbitrationWithoutSpill(
         const std::unordered_map<std::string, std::string>& configs);
 
+    /// If true, the global arbitration controller also wakes up every
+    /// 'predictive-arbitration-interval' to track the memory usage growth rate
+    /// of each query memory pool. A pool expected to outgrow its capacity
+    /// within the next interval gets the capacity ahead of its requests. If
+    /// there is not enough free capacity, it is spilled early instead of
+    /// blocking on arbitration later. The free capacity of pools with
+    /// shrinking usage is released. It is only in effect when
+    /// 'global-arbitration-enabled' is true.
+    static constexpr std::string_view kPredictiveArbitrationEnabled{
+        "predictive-arbitration-enabled"};
+    static constexpr bool kDefaultPredictiveArbitrationEnabled{false};
+    static bool predictiveArbitrationEnabled(
+        const std::unordered_map<std::string, std::string>& configs);
+
+    /// The interval of the predictive arbitration runs.
+    static constexpr std::string_view kPredictiveArbitrationInterval{
+        "predictive-arbitration-interval"};
+    static constexpr std::string_view kDefaultPredictiveArbitrationInterval{
+        "1s"};
+    static uint64_t predictiveArbitrationIntervalNs(
+        const std::unordered_map<std::string, std::string>& configs);
+
     /// If true, do sanity check on the arbitrator state on destruction.
     ///
     /// TODO: deprecate this flag after all the existing memory leak use cases
@@ -401,6 +423,11 @@ class SharedArbitrator : public memory::MemoryArbitrator {
   // Invoked by global arbitration control thread to run global arbitration.
   void runGlobalArbitration();
 
+  // Invoked by global arbitration control thread every
+  // 'predictiveArbitrationIntervalNs_' to adjust the capacity of the
+  // participants based on their memory usage growth rates.
+  void runPredictiveArbitration();
+
   // Helper method used by 'runGlobalArbitration()' to decide if current
   // iteration of global run should directly reclaim capacity by aborting
   // queries.
@@ -606,6 +633,8 @@ class SharedArbitrator : public memory::MemoryArbitrator {
   const uint32_t globalArbitrationMemoryReclaimPct_;
   const double globalArbitrationAbortTimeRatio_;
   const bool globalArbitrationWithoutSpill_;
+  const bool predictiveArbitrationEnabled_;
+  const uint64_t predictiveArbitrationIntervalNs_;
 
   // The executor used to reclaim memory from multiple participants in parallel
   // at the background for global arbitration or external memory reclamation.
@@ -19,6 +19,7 @@
 #include <fmt/format.h>
 #include <re2/re2.h>
 #include <deque>
+#include <thread>
 #include <vector>
 
 #include "folly/experimental/EventCount.h"
@@ -1281,6 +1282,36 @@ TEST_F(ArbitrationParticipantTest, shrink) {
   }
 }
 
+TEST_F(ArbitrationParticipantTest, growthRate) {
+  auto task = createTask(kMemoryCapacity);
+  const auto config = arbitrationConfig();
+  auto participant = ArbitrationParticipant::create(10, task->pool(), &config);
+  auto scopedParticipant = participant->lock().value();
+  scopedParticipant->shrink(/*reclaimAll=*/true);
+  scopedParticipant->grow(64 << 20, 0);
+  ASSERT_EQ(scopedParticipant->growthRate(), 0);
+  // The first sample only sets the baseline.
+  ASSERT_EQ(scopedParticipant->updateGrowthRate(), 0);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(10)); // NOLINT
+  void* buffer = task->allocate(32 << 20);
+  const double growthRate = scopedParticipant->updateGrowthRate();
+  ASSERT_GT(growthRate, 0);
+  ASSERT_EQ(scopedParticipant->growthRate(), growthRate);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(10)); // NOLINT
+  ASSERT_EQ(scopedParticipant->updateGrowthRate(), growthRate / 2);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(10)); // NOLINT
+  task->free(buffer);
+  ASSERT_LT(scopedParticipant->updateGrowthRate(), 0);
+
+  ASSERT_EQ(scopedParticipant->stats().arbitrationWaitTimeNs, 0);
+  scopedParticipant->addArbitrationWaitTime(1'000);
+  scopedParticipant->addArbitrationWaitTime(2'000);
+  ASSERT_EQ(scopedParticipant->stats().arbitrationWaitTimeNs, 3'000);
+}
+
 TEST_F(ArbitrationParticipantTest, abort) {
   struct {
     uint64_t maxCapacity;
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/memory/BatchArena.h"
+#include "velox/common/memory/Memory.h"
+
+#include <gtest/gtest.h>
+
+using namespace facebook::velox;
+using namespace facebook::velox::memory;
+
+class BatchArenaTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    manager_ = std::make_shared<MemoryManager>(
+        MemoryManagerOptions{.allocatorCapacity = 8L << 30});
+    root_ = manager_->addRootPool("batchArenaTestRoot");
+    pool_ = root_->addLeafChild("leaf");
+  }
+
+  std::shared_ptr<MemoryManager> manager_;
+  std::shared_ptr<MemoryPool> root_;
+  std::shared_ptr<MemoryPool> pool_;
+};
+
+TEST_F(BatchArenaTest, allocateAndReset) {
+  constexpr int64_t kChunk = BatchArena::kMinChunkBytes;
+  {
+    BatchArena arena(pool_.get());
+    ASSERT_EQ(arena.retainedBytes(), 0);
+
+    auto* bytes = arena.allocate(3, 1);
+    auto* values = arena.allocate<int64_t>(10);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(values) % alignof(int64_t), 0);
+    ASSERT_GE(reinterpret_cast<char*>(values), bytes + 3);
+    std::fill(values, values + 10, 1);
+    ASSERT_EQ(arena.allocatedBytes(), 3 + 10 * sizeof(int64_t));
+    ASSERT_EQ(arena.retainedBytes(), kChunk);
+
+    // Doesn't fit in the first chunk.
+    auto* large = arena.allocate(kChunk);
+    std::memset(large, 0, kChunk);
+    ASSERT_EQ(arena.retainedBytes(), 3 * kChunk);
+
+    arena.reset();
+    ASSERT_EQ(arena.allocatedBytes(), 0);
+    ASSERT_EQ(arena.retainedBytes(), 3 * kChunk);
+
+    // The next batch reuses the retained chunks without allocating from the
+    // pool.
+    const auto poolBytes = pool_->usedBytes();
+    ASSERT_EQ(arena.allocate(3, 1), bytes);
+    arena.allocate<int64_t>(10);
+    ASSERT_EQ(arena.allocate(kChunk), large);
+    ASSERT_EQ(pool_->usedBytes(), poolBytes);
+
+    // Chunks beyond the retention limit are freed on reset.
+    arena.allocate(2 * BatchArena::kDefaultMaxRetainedBytes);
+    ASSERT_GT(arena.retainedBytes(), BatchArena::kDefaultMaxRetainedBytes);
+    arena.reset();
+    ASSERT_EQ(arena.retainedBytes(), 3 * kChunk);
+    ASSERT_EQ(pool_->usedBytes(), poolBytes);
+  }
+  ASSERT_EQ(pool_->usedBytes(), 0);
+}
+
+TEST_F(BatchArenaTest, smallRetainedChunk) {
+  BatchArena arena(pool_.get(), 0);
+  arena.allocate(10);
+  arena.allocate(BatchArena::kMinChunkBytes);
+  // The first chunk is kept regardless of the limit.
+  arena.reset();
+  ASSERT_EQ(arena.retainedBytes(), BatchArena::kMinChunkBytes);
+
+  // A retained chunk that is too small for an allocation is skipped.
+  arena.allocate(4 * BatchArena::kMinChunkBytes);
+  ASSERT_EQ(arena.retainedBytes(), 5 * BatchArena::kMinChunkBytes);
+  arena.reset();
+  ASSERT_EQ(arena.retainedBytes(), BatchArena::kMinChunkBytes);
+}
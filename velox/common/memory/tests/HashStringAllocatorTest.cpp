@@ -202,6 +202,54 @@ TEST_F(HashStringAllocatorTest, allocate) {
   EXPECT_LE(allocator_->retainedSize() - allocator_->freeSpace(), 250);
 }
 
+TEST_F(HashStringAllocatorTest, slabs) {
+  allocator_ = std::make_unique<HashStringAllocator>(pool_.get(), true);
+  std::vector<HSA::Header*> headers;
+  for (auto i = 0; i < 10'000; ++i) {
+    headers.push_back(allocate(1 + (i % 100) * 10));
+    // Small blocks get a power of two size class.
+    ASSERT_TRUE(bits::isPowerOfTwo(headers.back()->size()));
+  }
+  // A large block comes from the free lists and mixes with the slab blocks.
+  headers.push_back(allocate(HashStringAllocator::kMaxAlloc));
+  EXPECT_GT(allocator_->slabBytes(), 0);
+  EXPECT_LE(allocator_->slabAllocatedBytes(), allocator_->slabBytes());
+  EXPECT_GE(
+      allocator_->checkConsistency(),
+      allocator_->slabAllocatedBytes() + HashStringAllocator::kMaxAlloc);
+
+  // Freed blocks are reused by the same size class without new slabs.
+  const auto slabBytes = allocator_->slabBytes();
+  const auto allocatedBytes = allocator_->slabAllocatedBytes();
+  for (auto i = 0; i < 10'000; i += 2) {
+    allocator_->free(headers[i]);
+  }
+  EXPECT_LT(allocator_->slabAllocatedBytes(), allocatedBytes);
+  allocator_->checkConsistency();
+  for (auto i = 0; i < 10'000; i += 2) {
+    headers[i] = allocate(1 + (i % 100) * 10);
+  }
+  EXPECT_EQ(allocator_->slabBytes(), slabBytes);
+  EXPECT_EQ(allocator_->slabAllocatedBytes(), allocatedBytes);
+
+  // Multipart writes use the free lists next to the slabs.
+  ByteOutputStream stream(allocator_.get());
+  auto position = allocator_->newWrite(stream);
+  const std::string data(100, 'x');
+  stream.appendStringView(std::string_view(data));
+  allocator_->finishWrite(stream, 0);
+  allocator_->free(position.header);
+
+  for (auto* header : headers) {
+    allocator_->free(header);
+  }
+  EXPECT_EQ(allocator_->slabAllocatedBytes(), 0);
+  EXPECT_TRUE(allocator_->isEmpty());
+  allocator_->clear();
+  EXPECT_EQ(allocator_->slabBytes(), 0);
+  EXPECT_EQ(allocator_->retainedSize(), 0);
+}
+
 TEST_F(HashStringAllocatorTest, allocateLarge) {
   // Verify that allocate() can handle sizes larger than the largest class size
   // supported by memory allocators, that is, 256 pages.
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/memory/MemoryAdmissionController.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/common/memory/Memory.h"
+#include "velox/common/memory/SharedArbitrator.h"
+
+namespace facebook::velox::memory {
+namespace {
+constexpr uint64_t kMB = 1 << 20;
+
+class MemoryAdmissionControllerTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    SharedArbitrator::registerFactory();
+  }
+
+  void TearDown() override {
+    SharedArbitrator::unregisterFactory();
+  }
+};
+
+TEST_F(MemoryAdmissionControllerTest, config) {
+  VELOX_ASSERT_THROW(
+      MemoryAdmissionController({.capacity = 0}),
+      "Memory admission capacity can't be 0");
+  VELOX_ASSERT_THROW(
+      MemoryAdmissionController({.capacity = kMB, .historyWeight = 0}),
+      "Invalid memory admission history weight 0");
+  VELOX_ASSERT_THROW(
+      MemoryAdmissionController({.capacity = kMB, .historyWeight = 1.5}),
+      "Invalid memory admission history weight 1.5");
+}
+
+TEST_F(MemoryAdmissionControllerTest, history) {
+  MemoryAdmissionController controller(
+      {.capacity = 1024 * kMB,
+       .defaultQueryBytes = 16 * kMB,
+       .historyWeight = 0.5,
+       .maxHistoryEntries = 2});
+  ASSERT_EQ(controller.estimateBytes("plan1"), 16 * kMB);
+
+  controller.recordPeakBytes("plan1", 100 * kMB);
+  ASSERT_EQ(controller.estimateBytes("plan1"), 100 * kMB);
+  // A smaller peak is smoothed.
+  controller.recordPeakBytes("plan1", 50 * kMB);
+  ASSERT_EQ(controller.estimateBytes("plan1"), 75 * kMB);
+  // A larger peak is taken as is.
+  controller.recordPeakBytes("plan1", 200 * kMB);
+  ASSERT_EQ(controller.estimateBytes("plan1"), 200 * kMB);
+
+  controller.recordPeakBytes("plan2", 10 * kMB);
+  ASSERT_EQ(controller.numHistoryEntries(), 2);
+  controller.recordPeakBytes("plan1", 200 * kMB);
+  // Drops the least recently recorded 'plan2'.
+  controller.recordPeakBytes("plan3", 30 * kMB);
+  ASSERT_EQ(controller.numHistoryEntries(), 2);
+  ASSERT_EQ(controller.estimateBytes("plan2"), 16 * kMB);
+  ASSERT_EQ(controller.estimateBytes("plan1"), 200 * kMB);
+  ASSERT_EQ(controller.estimateBytes("plan3"), 30 * kMB);
+
+  // Releasing a query learns its peak.
+  const auto admittedBytes = controller.admit(nullptr, "plan4");
+  ASSERT_EQ(admittedBytes, 16 * kMB);
+  ASSERT_EQ(controller.admittedBytes(), 16 * kMB);
+  controller.release(admittedBytes, "plan4", 40 * kMB);
+  ASSERT_EQ(controller.admittedBytes(), 0);
+  ASSERT_EQ(controller.estimateBytes("plan4"), 40 * kMB);
+}
+
+TEST_F(MemoryAdmissionControllerTest, admit) {
+  MemoryAdmissionController controller({.capacity = 100 * kMB});
+  // An estimate above the capacity is capped so the query can run alone.
+  ASSERT_EQ(controller.admit(nullptr, 200 * kMB), 100 * kMB);
+  controller.release(100 * kMB);
+
+  ASSERT_EQ(controller.admit(nullptr, 60 * kMB), 60 * kMB);
+  std::atomic_bool admitted{false};
+  std::thread queryThread([&]() {
+    const auto admittedBytes = controller.admit(nullptr, 60 * kMB);
+    admitted = true;
+    controller.release(admittedBytes);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100)); // NOLINT
+  ASSERT_FALSE(admitted);
+  controller.release(60 * kMB);
+  queryThread.join();
+  ASSERT_TRUE(admitted);
+  ASSERT_EQ(controller.admittedBytes(), 0);
+}
+
+TEST_F(MemoryAdmissionControllerTest, reserveCapacity) {
+  MemoryManagerOptions options;
+  options.arbitratorKind = "SHARED";
+  options.allocatorCapacity = 512 * kMB;
+  options.arbitratorCapacity = 512 * kMB;
+  options.extraArbitratorConfigs = {
+      {std::string(SharedArbitrator::ExtraConfig::kMemoryPoolInitialCapacity),
+       "0B"},
+      {std::string(SharedArbitrator::ExtraConfig::kMemoryPoolReservedCapacity),
+       "0B"}};
+  MemoryManager manager(options);
+  MemoryAdmissionController controller(
+      {.capacity = 512 * kMB}, manager.arbitrator());
+
+  auto pool = manager.addRootPool("reserveCapacity");
+  ASSERT_EQ(pool->capacity(), 0);
+  const auto admittedBytes = controller.admit(pool.get(), 64 * kMB);
+  ASSERT_GE(pool->capacity(), 64 * kMB);
+
+  // The reservation is capped at the pool max capacity.
+  auto smallPool = manager.addRootPool("smallPool", 32 * kMB);
+  const auto smallAdmittedBytes = controller.admit(smallPool.get(), 64 * kMB);
+  ASSERT_EQ(smallPool->capacity(), 32 * kMB);
+
+  controller.release(admittedBytes);
+  controller.release(smallAdmittedBytes);
+  ASSERT_EQ(controller.admittedBytes(), 0);
+}
+} // namespace
+} // namespace facebook::velox::memory
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "velox/common/memory/MemoryAllocator.h"
+#include <numeric>
 #include <thread>
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/common/memory/AllocationPool.h"
@@ -478,6 +479,35 @@ TEST_P(MemoryAllocatorTest, mmapAllocatorInit) {
   }
 }
 
+TEST_P(MemoryAllocatorTest, mmapHugePagesAndNumaNodes) {
+  if (!useMmap_) {
+    return;
+  }
+  MmapAllocator::Options options;
+  options.capacity = kCapacityBytes;
+  options.useHugePages = true;
+  options.numaAware = true;
+  auto mmapAllocator = std::make_shared<MmapAllocator>(options);
+  const auto numNodeBytes = [&]() {
+    const auto stats = mmapAllocator->stats();
+    return std::accumulate(
+        stats.numaNodeBytes.begin(), stats.numaNodeBytes.end(), int64_t{0});
+  };
+
+  const MachinePageCount kNumPages = 1000;
+  ContiguousAllocation allocation;
+  ASSERT_TRUE(mmapAllocator->allocateContiguous(
+      kNumPages, nullptr, allocation, nullptr, 2 * kNumPages));
+  EXPECT_EQ(reinterpret_cast<uint64_t>(allocation.data()) % (2 << 20), 0);
+  EXPECT_EQ(numNodeBytes(), AllocationTraits::pageBytes(kNumPages));
+
+  ASSERT_TRUE(mmapAllocator->growContiguous(100, allocation));
+  EXPECT_EQ(numNodeBytes(), AllocationTraits::pageBytes(kNumPages + 100));
+
+  mmapAllocator->freeContiguous(allocation);
+  EXPECT_EQ(numNodeBytes(), 0);
+}
+
 TEST_P(MemoryAllocatorTest, allocationPool) {
   const size_t kNumLargeAllocPages = instance_->largestSizeClass() * 2;
   const size_t kLarge = kNumLargeAllocPages * AllocationTraits::kPageSize;
@@ -431,6 +431,107 @@ TEST_P(MemoryPoolTest, usedBytes) {
   ASSERT_EQ(root->usedBytes(), 0);
 }
 
+TEST_P(MemoryPoolTest, scopedReservationCache) {
+  auto manager = getMemoryManager();
+  auto root = manager->addRootPool();
+  auto child = root->addLeafChild("scopedReservationCache", isLeafThreadSafe_);
+
+  const int64_t kChunkSize{128};
+  const int64_t kCacheBytes{64 << 10};
+  {
+    ScopedReservationCache cache(kCacheBytes);
+    ASSERT_EQ(ScopedReservationCache::current(), &cache);
+    void* buf1 = child->allocate(kChunkSize);
+    void* buf2 = child->allocate(kChunkSize);
+    if (isLeafThreadSafe_) {
+      // The first allocation reserves the whole cache.
+      ASSERT_EQ(child->usedBytes(), kCacheBytes);
+      ASSERT_EQ(cache.cachedBytes(child.get()), kCacheBytes - 2 * kChunkSize);
+    } else {
+      ASSERT_EQ(child->usedBytes(), 2 * kChunkSize);
+      ASSERT_EQ(cache.cachedBytes(child.get()), 0);
+    }
+    child->free(buf1, kChunkSize);
+    child->free(buf2, kChunkSize);
+    if (isLeafThreadSafe_) {
+      ASSERT_EQ(child->usedBytes(), kCacheBytes);
+      ASSERT_EQ(cache.cachedBytes(child.get()), kCacheBytes);
+    }
+
+    // Allocations larger than the cache go to the pool.
+    void* large = child->allocate(2 * kCacheBytes);
+    ASSERT_EQ(
+        cache.cachedBytes(child.get()), isLeafThreadSafe_ ? kCacheBytes : 0);
+    child->free(large, 2 * kCacheBytes);
+
+    cache.flush();
+    ASSERT_EQ(cache.cachedBytes(child.get()), 0);
+    ASSERT_EQ(child->usedBytes(), 0);
+    buf1 = child->allocate(kChunkSize);
+    child->free(buf1, kChunkSize);
+  }
+  ASSERT_EQ(ScopedReservationCache::current(), nullptr);
+  ASSERT_EQ(child->usedBytes(), 0);
+  ASSERT_EQ(root->usedBytes(), 0);
+
+  // A pool destroyed while the cache is in scope flushes its cached bytes.
+  {
+    ScopedReservationCache cache(kCacheBytes);
+    auto tempChild = root->addLeafChild("tempChild", isLeafThreadSafe_);
+    void* buf = tempChild->allocate(kChunkSize);
+    tempChild->free(buf, kChunkSize);
+    tempChild.reset();
+    ASSERT_EQ(root->usedBytes(), 0);
+  }
+}
+
+TEST_P(MemoryPoolTest, allocationSampling) {
+  constexpr uint64_t kSampleBytes{1024};
+  setupMemory(
+      {.allocationSampleBytes = kSampleBytes,
+       .allocatorCapacity = kDefaultCapacity,
+       .arbitratorCapacity = kDefaultCapacity});
+  auto manager = getMemoryManager();
+  auto root = manager->addRootPool("allocationSamplingRoot");
+  auto child = root->addLeafChild("allocationSampling", isLeafThreadSafe_);
+  auto* childImpl = static_cast<MemoryPoolImpl*>(child.get());
+  ASSERT_TRUE(childImpl->allocationSamples().empty());
+
+  // Every other allocation crosses a sample boundary.
+  constexpr int32_t kNumAllocations{10};
+  constexpr int64_t kAllocationSize{kSampleBytes / 2};
+  std::vector<void*> buffers;
+  for (auto i = 0; i < kNumAllocations; ++i) {
+    buffers.push_back(child->allocate(kAllocationSize));
+  }
+  uint64_t numSamples{0};
+  uint64_t sampledBytes{0};
+  for (const auto& sample : childImpl->allocationSamples()) {
+    ASSERT_FALSE(sample.stack.empty());
+    numSamples += sample.numSamples;
+    sampledBytes += sample.bytes;
+  }
+  ASSERT_EQ(numSamples, kNumAllocations / 2);
+  ASSERT_EQ(sampledBytes, kNumAllocations * kAllocationSize);
+  for (auto* buffer : buffers) {
+    child->free(buffer, kAllocationSize);
+  }
+
+  const auto expectedHeader = fmt::format(
+      "heap profile: {}: {} [{}: {}] @ heapprofile\n",
+      numSamples,
+      sampledBytes,
+      numSamples,
+      sampledBytes);
+  auto profile = manager->allocationProfile();
+  ASSERT_EQ(profile.rfind(expectedHeader, 0), 0) << profile;
+  ASSERT_NE(profile.find("MAPPED_LIBRARIES:"), std::string::npos);
+
+  // The samples of a destroyed pool are retained in the profile.
+  child.reset();
+  ASSERT_EQ(manager->allocationProfile().rfind(expectedHeader, 0), 0);
+}
+
 TEST_P(MemoryPoolTest, DISABLED_memoryLeakCheck) {
   gflags::FlagSaver flagSaver;
   testing::FLAGS_gtest_death_test_style = "fast";
@@ -755,7 +856,7 @@ TEST_P(MemoryPoolTest, memoryCapExceptions) {
                     "0 write pins: 0 pinned shared: 0B pinned exclusive: 0B\n "
                     "num write wait: 0 empty entries: 0\nCache access miss: 0 "
                     "hit: 0 hit bytes: 0B eviction: 0 savable eviction: 0 eviction checks: 0 "
-                    "aged out: 0 stales: 0\nPrefetch entries: 0 bytes: 0B\nAlloc Megaclocks 0\n"
+                    "aged out: 0 stales: 0 admission rejects: 0\nPrefetch entries: 0 bytes: 0B\nAlloc Megaclocks 0\n"
                     "Allocated pages: 0 cached pages: 0\n",
                     isLeafThreadSafe_ ? "thread-safe" : "non-thread-safe"),
                 ex.message());
@@ -789,7 +890,7 @@ TEST_P(MemoryPoolTest, memoryCapExceptions) {
                     "read pins: 0 write pins: 0 pinned shared: 0B pinned "
                     "exclusive: 0B\n num write wait: 0 empty entries: 0\nCache "
                     "access miss: 0 hit: 0 hit bytes: 0B eviction: 0 savable eviction: 0 eviction "
-                    "checks: 0 aged out: 0 stales: 0\nPrefetch entries: 0 bytes: 0B\nAlloc Megaclocks"
+                    "checks: 0 aged out: 0 stales: 0 admission rejects: 0\nPrefetch entries: 0 bytes: 0B\nAlloc Megaclocks"
                     " 0\nAllocated pages: 0 cached pages: 0\n",
                     isLeafThreadSafe_ ? "thread-safe" : "non-thread-safe"),
                 ex.message());
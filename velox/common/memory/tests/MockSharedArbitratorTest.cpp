@@ -657,6 +657,13 @@ TEST_F(MockSharedArbitrationTest, extraConfigs) {
       SharedArbitrator::ExtraConfig::globalArbitrationAbortTimeRatio(
           emptyConfigs),
       SharedArbitrator::ExtraConfig::kDefaultGlobalArbitrationAbortTimeRatio);
+  ASSERT_EQ(
+      SharedArbitrator::ExtraConfig::predictiveArbitrationEnabled(emptyConfigs),
+      SharedArbitrator::ExtraConfig::kDefaultPredictiveArbitrationEnabled);
+  ASSERT_EQ(
+      SharedArbitrator::ExtraConfig::predictiveArbitrationIntervalNs(
+          emptyConfigs),
+      1'000'000'000UL);
 
   // Testing custom values
   std::unordered_map<std::string, std::string> configs;
@@ -686,6 +693,11 @@ TEST_F(MockSharedArbitrationTest, extraConfigs) {
       SharedArbitrator::ExtraConfig::kGlobalArbitrationWithoutSpill)] = "true";
   configs[std::string(
       SharedArbitrator::ExtraConfig::kGlobalArbitrationAbortTimeRatio)] = "0.8";
+  configs[std::string(
+      SharedArbitrator::ExtraConfig::kPredictiveArbitrationEnabled)] = "true";
+  configs[std::string(
+      SharedArbitrator::ExtraConfig::kPredictiveArbitrationInterval)] =
+      "200ms";
 
   ASSERT_EQ(SharedArbitrator::ExtraConfig::reservedCapacity(configs), 100);
   ASSERT_EQ(
@@ -716,6 +728,11 @@ TEST_F(MockSharedArbitrationTest, extraConfigs) {
   ASSERT_EQ(
       SharedArbitrator::ExtraConfig::globalArbitrationAbortTimeRatio(configs),
       0.8);
+  ASSERT_TRUE(
+      SharedArbitrator::ExtraConfig::predictiveArbitrationEnabled(configs));
+  ASSERT_EQ(
+      SharedArbitrator::ExtraConfig::predictiveArbitrationIntervalNs(configs),
+      200'000'000UL);
 
   // Testing invalid values
   configs[std::string(SharedArbitrator::ExtraConfig::kReservedCapacity)] =
@@ -747,6 +764,12 @@ TEST_F(MockSharedArbitrationTest, extraConfigs) {
   configs[std::string(
       SharedArbitrator::ExtraConfig::kGlobalArbitrationAbortTimeRatio)] =
       "invalid";
+  configs[std::string(
+      SharedArbitrator::ExtraConfig::kPredictiveArbitrationEnabled)] =
+      "invalid";
+  configs[std::string(
+      SharedArbitrator::ExtraConfig::kPredictiveArbitrationInterval)] =
+      "invalid";
 
   VELOX_ASSERT_THROW(
       SharedArbitrator::ExtraConfig::reservedCapacity(configs),
@@ -787,6 +810,12 @@ TEST_F(MockSharedArbitrationTest, extraConfigs) {
   VELOX_ASSERT_THROW(
       SharedArbitrator::ExtraConfig::globalArbitrationAbortTimeRatio(configs),
       "Failed while parsing SharedArbitrator configs");
+  VELOX_ASSERT_THROW(
+      SharedArbitrator::ExtraConfig::predictiveArbitrationEnabled(configs),
+      "Failed while parsing SharedArbitrator configs");
+  VELOX_ASSERT_THROW(
+      SharedArbitrator::ExtraConfig::predictiveArbitrationIntervalNs(configs),
+      "Invalid duration 'invalid'");
   // Invalid memory reclaim executor hw multiplier.
   VELOX_ASSERT_THROW(
       setupMemory(kMemoryCapacity, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1),
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/process/PerfCounters.h"
+
+#include <memory>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace facebook::velox::process {
+
+// static
+ThreadPerfCounters* ThreadPerfCounters::get() {
+  thread_local std::unique_ptr<ThreadPerfCounters> counters;
+  thread_local bool opened{false};
+  if (!opened) {
+    opened = true;
+    std::unique_ptr<ThreadPerfCounters> newCounters(new ThreadPerfCounters());
+    if (newCounters->open()) {
+      counters = std::move(newCounters);
+    }
+  }
+  return counters.get();
+}
+
+ThreadPerfCounters::~ThreadPerfCounters() {
+#ifdef __linux__
+  for (const auto fd : fds_) {
+    if (fd >= 0) {
+      ::close(fd);
+    }
+  }
+#endif
+}
+
+bool ThreadPerfCounters::open() {
+#ifdef __linux__
+  constexpr std::array<uint64_t, kNumCounters> kEvents = {
+      PERF_COUNT_HW_CPU_CYCLES,
+      PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_CACHE_MISSES,
+      PERF_COUNT_HW_BRANCH_MISSES};
+  for (auto i = 0; i < kNumCounters; ++i) {
+    struct perf_event_attr attr {};
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = kEvents[i];
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // The leader is enabled once the group is complete.
+    attr.disabled = i == 0 ? 1 : 0;
+    fds_[i] = syscall(
+        __NR_perf_event_open,
+        &attr,
+        0,
+        -1,
+        i == 0 ? -1 : fds_[0],
+        PERF_FLAG_FD_CLOEXEC);
+    if (fds_[i] < 0) {
+      return false;
+    }
+  }
+  return ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) == 0;
+#else
+  return false;
+#endif
+}
+
+bool ThreadPerfCounters::read(PerfCounts& counts) const {
+#ifdef __linux__
+  // The layout of a read of a group with PERF_FORMAT_GROUP.
+  struct {
+    uint64_t numCounters;
+    uint64_t values[kNumCounters];
+  } data;
+  if (::read(fds_[0], &data, sizeof(data)) != sizeof(data) ||
+      data.numCounters != kNumCounters) {
+    return false;
+  }
+  counts.cycles = data.values[0];
+  counts.instructions = data.values[1];
+  counts.cacheMisses = data.values[2];
+  counts.branchMisses = data.values[3];
+  return true;
+#else
+  return false;
+#endif
+}
+
+} // namespace facebook::velox::process
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace facebook::velox::process {
+
+/// Hardware event counts of a thread.
+struct PerfCounts {
+  uint64_t cycles{0};
+  uint64_t instructions{0};
+  uint64_t cacheMisses{0};
+  uint64_t branchMisses{0};
+
+  PerfCounts operator-(const PerfCounts& other) const {
+    return {
+        cycles - other.cycles,
+        instructions - other.instructions,
+        cacheMisses - other.cacheMisses,
+        branchMisses - other.branchMisses};
+  }
+};
+
+/// A group of perf_event counters of the calling thread, read with one system
+/// call. Counts user space events only. Available on Linux if the kernel
+/// permits perf events for the process, see perf_event_paranoid.
+class ThreadPerfCounters {
+ public:
+  /// Returns the counters of the calling thread, opened on first use, or
+  /// nullptr if perf events are not available. The result is owned by the
+  /// thread and must be used only on it.
+  static ThreadPerfCounters* get();
+
+  ~ThreadPerfCounters();
+
+  /// Sets 'counts' to the counts since the counters were opened. Returns false
+  /// if the read fails.
+  bool read(PerfCounts& counts) const;
+
+ private:
+  static constexpr int32_t kNumCounters = 4;
+
+  ThreadPerfCounters() = default;
+
+  // Opens the counters. Returns false if any of them fails to open.
+  bool open();
+
+  // The descriptors of the counters in the order of the PerfCounts fields.
+  // The first one is the group leader.
+  std::array<int32_t, kNumCounters> fds_{-1, -1, -1, -1};
+};
+
+} // namespace facebook::velox::process
@@ -68,6 +68,7 @@ int64_t Profiler::cpuAtSampleStart_;
 int64_t Profiler::cpuAtLastCheck_;
 std::function<void()> Profiler::startExtra_;
 std::function<std::string()> Profiler::extraReport_;
+std::function<std::string()> Profiler::heapReport_;
 
 namespace {
 std::string hostname;
@@ -171,6 +172,23 @@ void Profiler::copyToResult(const std::string* data) {
     LOG(ERROR) << "PROFILE: Error opening/writing " << target << ":"
                << e.what();
   }
+  if (heapReport_) {
+    const auto heapTarget = fmt::format("{}.heap", target);
+    try {
+      try {
+        fileSystem_->remove(heapTarget);
+      } catch (const std::exception&) {
+        // ignore
+      }
+      auto out = fileSystem_->openFileForWrite(heapTarget);
+      out->append(heapReport_());
+      out->flush();
+      LOG(INFO) << "PROFILE: Produced heap profile " << heapTarget;
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "PROFILE: Error opening/writing " << heapTarget << ":"
+                 << e.what();
+    }
+  }
 }
 
 void Profiler::makeProfileDir(std::string path) {
@@ -307,7 +325,8 @@ bool Profiler::isRunning() {
 void Profiler::start(
     const std::string& path,
     std::function<void()> extraStart,
-    std::function<std::string()> extraReport) {
+    std::function<std::string()> extraReport,
+    std::function<std::string()> heapReport) {
   {
 #if !defined(linux)
     VELOX_FAIL("Profiler is only available for Linux");
@@ -315,6 +334,7 @@ void Profiler::start(
     resultPath_ = path;
     startExtra_ = extraStart;
     extraReport_ = extraReport;
+    heapReport_ = heapReport;
     std::lock_guard<std::mutex> l(profileMutex_);
     if (profileStarted_) {
       return;
@@ -28,11 +28,14 @@ namespace facebook::velox::process {
 
 class Profiler {
  public:
-  /// Starts periodic production of perf reports.
+  /// Starts periodic production of perf reports. If 'heapReport' is set, its
+  /// result is written next to each perf report as a pprof heap profile, e.g.
+  /// the memory pool allocation profile from MemoryManager.
   static void start(
       const std::string& path,
       std::function<void()> extraStart = nullptr,
-      std::function<std::string()> extraReport = nullptr);
+      std::function<std::string()> extraReport = nullptr,
+      std::function<std::string()> heapReport = nullptr);
 
   // Stops profiling background associated threads. Threads are stopped on
   // return.
@@ -75,6 +78,7 @@ class Profiler {
 
   static std::function<void()> startExtra_;
   static std::function<std::string()> extraReport_;
+  static std::function<std::string()> heapReport_;
 };
 
 } // namespace facebook::velox::process
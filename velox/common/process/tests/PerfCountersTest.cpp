@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/process/PerfCounters.h"
+
+#include <gtest/gtest.h>
+
+namespace facebook::velox::process {
+namespace {
+
+TEST(PerfCountersTest, basic) {
+  auto* counters = ThreadPerfCounters::get();
+  if (counters == nullptr) {
+    GTEST_SKIP() << "Perf events are not available";
+  }
+  ASSERT_EQ(counters, ThreadPerfCounters::get());
+  PerfCounts before;
+  ASSERT_TRUE(counters->read(before));
+  volatile uint64_t sum{0};
+  for (auto i = 0; i < 1'000'000; ++i) {
+    sum = sum + (i % 7 == 0 ? i : 1);
+  }
+  PerfCounts after;
+  ASSERT_TRUE(counters->read(after));
+  const auto delta = after - before;
+  ASSERT_GT(delta.instructions, 1'000'000);
+  ASSERT_GT(delta.cycles, 0);
+}
+
+} // namespace
+} // namespace facebook::velox::process
@@ -32,7 +32,8 @@ std::unordered_map<std::string, std::shared_ptr<Connector>>& connectors() {
 } // namespace
 
 bool DataSink::Stats::empty() const {
-  return numWrittenBytes == 0 && numWrittenFiles == 0 && spillStats.empty();
+  return numWrittenBytes == 0 && numWrittenFiles == 0 && numOpenWriters == 0 &&
+      spillStats.empty();
 }
 
 std::string DataSink::Stats::toString() const {
@@ -79,6 +79,14 @@ struct ConnectorSplit : public ISerializable {
 
   virtual ~ConnectorSplit() {}
 
+  /// Returns splits that together read the same data as 'this', each of about
+  /// 'maxBytes', so that the drivers of a scan can share the work of a large
+  /// split. Returns an empty vector if 'this' is not divided.
+  virtual std::vector<std::shared_ptr<ConnectorSplit>> divide(
+      uint64_t /*maxBytes*/) const {
+    return {};
+  }
+
   virtual std::string toString() const {
     return fmt::format(
         "[split: connector id {}, weight {}, cacheable {}]",
@@ -189,6 +197,8 @@ class DataSink {
   struct Stats {
     uint64_t numWrittenBytes{0};
     uint32_t numWrittenFiles{0};
+    /// The number of open file writers. Set while the data sink is running.
+    uint32_t numOpenWriters{0};
     uint64_t writeIOTimeUs{0};
     common::SpillStats spillStats;
 
@@ -210,6 +220,13 @@ class DataSink {
   /// function returns true if it has processed all data. This call is blocking.
   virtual bool finish() = 0;
 
+  /// Returns a future to wait for before calling finish() again after it
+  /// returned false, e.g. while the files are closed on another executor.
+  /// Returns an invalid future if finish() may be called again right away.
+  virtual ContinueFuture finishFuture() {
+    return ContinueFuture::makeEmpty();
+  }
+
   /// Called once after all data has been added via possibly multiple calls to
   /// appendData(). The function returns the metadata of written data in string
   /// form. We don't expect any appendData() calls on a closed data sink object.
@@ -223,6 +240,28 @@ class DataSink {
   virtual Stats stats() const = 0;
 };
 
+/// An aggregate over the rows of a split that a DataSource may compute from
+/// the file metadata, e.g. footer row counts and column statistics, instead
+/// of reading the rows.
+struct MetadataAggregate {
+  enum class Kind {
+    /// count(*).
+    kCount,
+    /// min() of 'channel'.
+    kMin,
+    /// max() of 'channel'.
+    kMax,
+    /// The value of 'channel' if it is constant in the split, e.g. a
+    /// partition key.
+    kConstant,
+  };
+
+  Kind kind;
+
+  /// The output column of the DataSource. Not used for kCount.
+  column_index_t channel{0};
+};
+
 class DataSource {
  public:
   static constexpr int64_t kUnknownRowSize = -1;
@@ -274,6 +313,18 @@ class DataSource {
     VELOX_UNSUPPORTED("setFromDataSource");
   }
 
+  /// Computes 'aggregates' over the rows of the split added last from the file
+  /// metadata. If all of them are known, returns one row with a column per
+  /// aggregate, or no rows if the split has no rows, and finishes the split.
+  /// count(*) is BIGINT and the others are of the type of their channel.
+  /// Otherwise returns nullptr and the split is read by next(). Filters and
+  /// deleted rows make the metadata not applicable. Called after addSplit()
+  /// and before next().
+  virtual RowVectorPtr aggregateFromMetadata(
+      const std::vector<MetadataAggregate>& /*aggregates*/) {
+    return nullptr;
+  }
+
   /// Returns a connector dependent row size if available. This can be
   /// called after addSplit().  This estimates uncompressed data
   /// sizes. This is better than getCompletedBytes()/getCompletedRows()
@@ -556,6 +607,20 @@ class Connector {
     return false;
   }
 
+  /// Returns true if prefetchSplitMetadata() does anything. If so, TableScan
+  /// can prefetch the metadata of splits queued behind the preloaded ones.
+  virtual bool supportsSplitMetadataPrefetch() {
+    return false;
+  }
+
+  /// Reads the file metadata of 'split', e.g. the footer, into a cache so
+  /// that a DataSource reading 'split' later does not wait for it. Called on
+  /// executor() and may be called concurrently for different splits.
+  virtual void prefetchSplitMetadata(
+      const std::shared_ptr<ConnectorTableHandle>& /*tableHandle*/,
+      const std::shared_ptr<ConnectorSplit>& /*split*/,
+      ConnectorQueryCtx* /*connectorQueryCtx*/) {}
+
   /// Returns true if the connector supports index lookup, otherwise false.
   virtual bool supportsIndexLookup() const {
     return false;
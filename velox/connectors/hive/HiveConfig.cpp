@@ -67,6 +67,22 @@ uint32_t HiveConfig::maxPartitionsPerWriters(
       config_->get<uint32_t>(kMaxPartitionsPerWriters, 128));
 }
 
+uint64_t HiveConfig::maxOpenWritersMemoryBytes(
+    const config::ConfigBase* session) const {
+  return config::toCapacity(
+      session->get<std::string>(
+          kMaxOpenWritersMemoryBytesSession,
+          config_->get<std::string>(kMaxOpenWritersMemoryBytes, "0B")),
+      config::CapacityUnit::BYTE);
+}
+
+bool HiveConfig::asyncFileCloseEnabled(
+    const config::ConfigBase* session) const {
+  return session->get<bool>(
+      kAsyncFileCloseEnabledSession,
+      config_->get<bool>(kAsyncFileCloseEnabled, false));
+}
+
 bool HiveConfig::immutablePartitions() const {
   return config_->get<bool>(kImmutablePartitions, false);
 }
@@ -88,6 +104,22 @@ std::optional<std::string> HiveConfig::gcsMaxRetryTime() const {
       config_->get<std::string>(kGcsMaxRetryTime));
 }
 
+bool HiveConfig::hdfsShortCircuitReadEnabled() const {
+  return config_->get<bool>(kHdfsShortCircuitReadEnabled, false);
+}
+
+std::string HiveConfig::hdfsDomainSocketPath() const {
+  return config_->get<std::string>(kHdfsDomainSocketPath, std::string(""));
+}
+
+uint32_t HiveConfig::hdfsHedgedReadThreadPoolSize() const {
+  return config_->get<uint32_t>(kHdfsHedgedReadThreadPoolSize, 0);
+}
+
+uint64_t HiveConfig::hdfsHedgedReadThresholdMs() const {
+  return config_->get<uint64_t>(kHdfsHedgedReadThresholdMs, 500);
+}
+
 bool HiveConfig::isOrcUseColumnNames(const config::ConfigBase* session) const {
   return session->get<bool>(
       kOrcUseColumnNamesSession, config_->get<bool>(kOrcUseColumnNames, false));
@@ -145,10 +177,23 @@ int32_t HiveConfig::maxCoalescedDistanceBytes(
   return int32_t(distance);
 }
 
+bool HiveConfig::adaptiveCoalesceEnabled(
+    const config::ConfigBase* session) const {
+  return session->get<bool>(
+      kAdaptiveCoalesceEnabledSession,
+      config_->get<bool>(kAdaptiveCoalesceEnabled, false));
+}
+
 int32_t HiveConfig::prefetchRowGroups() const {
   return config_->get<int32_t>(kPrefetchRowGroups, 1);
 }
 
+uint64_t HiveConfig::prefetchRowGroupsMemoryLimit() const {
+  return config::toCapacity(
+      config_->get<std::string>(kPrefetchRowGroupsMemoryLimit, "0B"),
+      config::CapacityUnit::BYTE);
+}
+
 int32_t HiveConfig::loadQuantum(const config::ConfigBase* session) const {
   return session->get<int32_t>(
       kLoadQuantumSession, config_->get<int32_t>(kLoadQuantum, 8 << 20));
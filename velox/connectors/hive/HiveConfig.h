@@ -49,6 +49,23 @@ class HiveConfig {
   static constexpr const char* kMaxPartitionsPerWritersSession =
       "max_partitions_per_writers";
 
+  /// Maximum memory of the open partition writers of a single table writer
+  /// instance. When exceeded, the writers written least recently are closed
+  /// and their partitions continue in new files. 0 means no limit.
+  static constexpr const char* kMaxOpenWritersMemoryBytes =
+      "max-open-writers-memory-bytes";
+  static constexpr const char* kMaxOpenWritersMemoryBytesSession =
+      "max_open_writers_memory_bytes";
+
+  /// Whether the table writer closes its files, i.e. writes the footers and
+  /// flushes and closes the remote files, concurrently on the connector
+  /// executor after all data is added, instead of one after another on the
+  /// driver thread. Not applied to data sinks that may spill.
+  static constexpr const char* kAsyncFileCloseEnabled =
+      "async-file-close-enabled";
+  static constexpr const char* kAsyncFileCloseEnabledSession =
+      "async_file_close_enabled";
+
   /// Whether new data can be inserted into an unpartition table.
   /// Velox currently does not support appending data to existing partitions.
   static constexpr const char* kImmutablePartitions =
@@ -67,6 +84,27 @@ class HiveConfig {
   /// The GCS maximum time allowed to retry transient errors.
   static constexpr const char* kGcsMaxRetryTime = "hive.gcs.max-retry-time";
 
+  /// Whether HDFS reads of blocks on the local datanode bypass the datanode
+  /// and read the block files through file descriptors passed over
+  /// 'kHdfsDomainSocketPath'.
+  static constexpr const char* kHdfsShortCircuitReadEnabled =
+      "hive.hdfs.short-circuit-read-enabled";
+
+  /// The UNIX domain socket shared with the local datanode for short-circuit
+  /// reads.
+  static constexpr const char* kHdfsDomainSocketPath =
+      "hive.hdfs.domain-socket-path";
+
+  /// The number of threads issuing hedged HDFS reads. A read not answered by
+  /// a datanode within 'kHdfsHedgedReadThresholdMs' is also sent to another
+  /// replica and the first answer is used. 0 disables hedged reads.
+  static constexpr const char* kHdfsHedgedReadThreadPoolSize =
+      "hive.hdfs.hedged-read-thread-pool-size";
+
+  /// The latency after which a hedged HDFS read is issued.
+  static constexpr const char* kHdfsHedgedReadThresholdMs =
+      "hive.hdfs.hedged-read-threshold-ms";
+
   /// Maps table field names to file field names using names, not indices.
   // TODO: remove hive_orc_use_column_names since it doesn't exist in presto,
   // right now this is only used for testing.
@@ -109,9 +147,22 @@ class HiveConfig {
   static constexpr const char* kMaxCoalescedDistanceSession =
       "orc_max_merge_distance";
 
+  /// If true, the max merge distance adapts to the latency and throughput
+  /// observed on reads from the storage system of the file, within a factor
+  /// of 8 of the configured distance.
+  static constexpr const char* kAdaptiveCoalesceEnabled =
+      "adaptive-coalesce-enabled";
+  static constexpr const char* kAdaptiveCoalesceEnabledSession =
+      "adaptive_coalesce_enabled";
+
   /// The number of prefetch rowgroups
   static constexpr const char* kPrefetchRowGroups = "prefetch-rowgroups";
 
+  /// The maximum bytes of the row group being read and the prefetched row
+  /// groups of a file. 0 means no limit.
+  static constexpr const char* kPrefetchRowGroupsMemoryLimit =
+      "prefetch-rowgroups-memory-limit";
+
   /// The total size in bytes for a direct coalesce request. Up to 8MB load
   /// quantum size is supported when SSD cache is enabled.
   static constexpr const char* kLoadQuantum = "load-quantum";
@@ -188,6 +239,10 @@ class HiveConfig {
 
   uint32_t maxPartitionsPerWriters(const config::ConfigBase* session) const;
 
+  uint64_t maxOpenWritersMemoryBytes(const config::ConfigBase* session) const;
+
+  bool asyncFileCloseEnabled(const config::ConfigBase* session) const;
+
   bool immutablePartitions() const;
 
   std::string gcsEndpoint() const;
@@ -198,6 +253,14 @@ class HiveConfig {
 
   std::optional<std::string> gcsMaxRetryTime() const;
 
+  bool hdfsShortCircuitReadEnabled() const;
+
+  std::string hdfsDomainSocketPath() const;
+
+  uint32_t hdfsHedgedReadThreadPoolSize() const;
+
+  uint64_t hdfsHedgedReadThresholdMs() const;
+
   bool isOrcUseColumnNames(const config::ConfigBase* session) const;
 
   bool isParquetUseColumnNames(const config::ConfigBase* session) const;
@@ -215,8 +278,12 @@ class HiveConfig {
 
   int32_t maxCoalescedDistanceBytes(const config::ConfigBase* session) const;
 
+  bool adaptiveCoalesceEnabled(const config::ConfigBase* session) const;
+
   int32_t prefetchRowGroups() const;
 
+  uint64_t prefetchRowGroupsMemoryLimit() const;
+
   int32_t loadQuantum(const config::ConfigBase* session) const;
 
   int32_t numCacheFileHandles() const;
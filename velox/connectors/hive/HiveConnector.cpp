@@ -18,6 +18,7 @@
 
 #include "velox/common/base/Fs.h"
 #include "velox/connectors/hive/HiveConfig.h"
+#include "velox/connectors/hive/HiveConnectorUtil.h"
 #include "velox/connectors/hive/HiveDataSink.h"
 #include "velox/connectors/hive/HiveDataSource.h"
 #include "velox/connectors/hive/HivePartitionFunction.h"
@@ -87,6 +88,30 @@ std::unique_ptr<DataSource> HiveConnector::createDataSource(
       hiveConfig_);
 }
 
+void HiveConnector::prefetchSplitMetadata(
+    const std::shared_ptr<ConnectorTableHandle>& tableHandle,
+    const std::shared_ptr<ConnectorSplit>& split,
+    ConnectorQueryCtx* connectorQueryCtx) {
+  auto hiveSplit = std::dynamic_pointer_cast<HiveConnectorSplit>(split);
+  if (auto bundle =
+          std::dynamic_pointer_cast<HiveConnectorSplitBundle>(split)) {
+    // The data source prefetches the rest of the bundle.
+    hiveSplit = bundle->splits[0];
+  }
+  auto hiveTableHandle =
+      std::dynamic_pointer_cast<const HiveTableHandle>(tableHandle);
+  if (hiveSplit == nullptr || hiveTableHandle == nullptr) {
+    return;
+  }
+  hive::prefetchSplitMetadata(
+      hiveConfig_,
+      connectorQueryCtx,
+      hiveTableHandle,
+      hiveSplit,
+      &fileHandleFactory_,
+      executor_);
+}
+
 std::unique_ptr<DataSink> HiveConnector::createDataSink(
     RowTypePtr inputType,
     std::shared_ptr<ConnectorInsertTableHandle> connectorInsertTableHandle,
@@ -101,7 +126,8 @@ std::unique_ptr<DataSink> HiveConnector::createDataSink(
       hiveInsertHandle,
       connectorQueryCtx,
       commitStrategy,
-      hiveConfig_);
+      hiveConfig_,
+      executor_);
 }
 
 std::unique_ptr<core::PartitionFunction> HivePartitionFunctionSpec::create(
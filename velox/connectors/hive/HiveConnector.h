@@ -60,6 +60,17 @@ class HiveConnector : public Connector {
     return true;
   }
 
+  bool supportsSplitMetadataPrefetch() override {
+    return true;
+  }
+
+  /// Opens the file of 'split' and reads its footer into the process-wide
+  /// file metadata cache. See hive::prefetchSplitMetadata().
+  void prefetchSplitMetadata(
+      const std::shared_ptr<ConnectorTableHandle>& tableHandle,
+      const std::shared_ptr<ConnectorSplit>& split,
+      ConnectorQueryCtx* connectorQueryCtx) override;
+
   std::unique_ptr<DataSink> createDataSink(
       RowTypePtr inputType,
       std::shared_ptr<ConnectorInsertTableHandle> connectorInsertTableHandle,
@@ -16,6 +16,10 @@
 
 #include "velox/connectors/hive/HiveConnectorSplit.h"
 
+#include <folly/String.h>
+
+#include "velox/common/base/BitUtil.h"
+
 namespace facebook::velox::connector::hive {
 
 std::string HiveConnectorSplit::toString() const {
@@ -35,6 +39,52 @@ std::string HiveConnectorSplit::getFileName() const {
   return i == std::string::npos ? filePath : filePath.substr(i + 1);
 }
 
+std::vector<std::shared_ptr<ConnectorSplit>> HiveConnectorSplit::divide(
+    uint64_t maxBytes) const {
+  if (maxBytes == 0 ||
+      (fileFormat != dwio::common::FileFormat::DWRF &&
+       fileFormat != dwio::common::FileFormat::ORC &&
+       fileFormat != dwio::common::FileFormat::PARQUET)) {
+    return {};
+  }
+  uint64_t end = std::numeric_limits<uint64_t>::max();
+  if (length != std::numeric_limits<uint64_t>::max()) {
+    end = start + length;
+  }
+  if (properties.has_value() && properties->fileSize.has_value()) {
+    end = std::min<uint64_t>(end, properties->fileSize.value());
+  }
+  if (end == std::numeric_limits<uint64_t>::max() || end <= start ||
+      end - start <= maxBytes) {
+    return {};
+  }
+  const auto numParts = bits::divRoundUp(end - start, maxBytes);
+  std::vector<std::shared_ptr<ConnectorSplit>> parts;
+  parts.reserve(numParts);
+  for (auto partStart = start; partStart < end; partStart += maxBytes) {
+    const auto partLength = std::min(maxBytes, end - partStart);
+    parts.push_back(std::make_shared<HiveConnectorSplit>(
+        connectorId,
+        filePath,
+        fileFormat,
+        partStart,
+        partLength,
+        partitionKeys,
+        tableBucketNumber,
+        customSplitInfo,
+        extraFileInfo,
+        serdeParameters,
+        storageParameters,
+        splitWeight / numParts,
+        cacheable,
+        infoColumns,
+        properties,
+        rowIdProperties,
+        bucketConversion));
+  }
+  return parts;
+}
+
 folly::dynamic HiveConnectorSplit::serialize() const {
   folly::dynamic obj = folly::dynamic::object;
   obj["name"] = "HiveConnectorSplit";
@@ -226,5 +276,72 @@ std::shared_ptr<HiveConnectorSplit> HiveConnectorSplit::create(
 void HiveConnectorSplit::registerSerDe() {
   auto& registry = DeserializationRegistryForSharedPtr();
   registry.Register("HiveConnectorSplit", HiveConnectorSplit::create);
+  registry.Register(
+      "HiveConnectorSplitBundle", HiveConnectorSplitBundle::create);
+}
+
+namespace {
+int64_t totalSplitWeight(
+    const std::vector<std::shared_ptr<HiveConnectorSplit>>& splits) {
+  int64_t weight = 0;
+  for (const auto& split : splits) {
+    weight += split->splitWeight;
+  }
+  return weight;
+}
+
+bool allCacheable(
+    const std::vector<std::shared_ptr<HiveConnectorSplit>>& splits) {
+  return std::all_of(splits.begin(), splits.end(), [](const auto& split) {
+    return split->cacheable;
+  });
+}
+} // namespace
+
+HiveConnectorSplitBundle::HiveConnectorSplitBundle(
+    std::vector<std::shared_ptr<HiveConnectorSplit>> _splits)
+    : ConnectorSplit(
+          _splits.empty() ? "" : _splits[0]->connectorId,
+          totalSplitWeight(_splits),
+          allCacheable(_splits)),
+      splits(std::move(_splits)) {
+  VELOX_CHECK(!splits.empty(), "Hive split bundle must not be empty");
+  for (const auto& split : splits) {
+    VELOX_CHECK_NOT_NULL(split);
+    VELOX_CHECK_EQ(
+        split->connectorId,
+        connectorId,
+        "All splits of a Hive split bundle must be of the same connector");
+  }
+}
+
+std::string HiveConnectorSplitBundle::toString() const {
+  std::vector<std::string> strings;
+  strings.reserve(splits.size());
+  for (const auto& split : splits) {
+    strings.push_back(split->toString());
+  }
+  return fmt::format("Hive bundle: [{}]", folly::join(", ", strings));
+}
+
+folly::dynamic HiveConnectorSplitBundle::serialize() const {
+  folly::dynamic obj = folly::dynamic::object;
+  obj["name"] = "HiveConnectorSplitBundle";
+  folly::dynamic splitsObj = folly::dynamic::array;
+  for (const auto& split : splits) {
+    splitsObj.push_back(split->serialize());
+  }
+  obj["splits"] = splitsObj;
+  return obj;
+}
+
+// static
+std::shared_ptr<HiveConnectorSplitBundle> HiveConnectorSplitBundle::create(
+    const folly::dynamic& obj) {
+  std::vector<std::shared_ptr<HiveConnectorSplit>> splits;
+  for (const auto& split : obj["splits"]) {
+    splits.push_back(HiveConnectorSplit::create(split));
+  }
+  return std::make_shared<HiveConnectorSplitBundle>(std::move(splits));
 }
 } // namespace facebook::velox::connector::hive
@@ -115,6 +115,12 @@ struct HiveConnectorSplit : public connector::ConnectorSplit {
 
   std::string getFileName() const;
 
+  /// Divides the byte range of the split if the file format reads the stripes
+  /// or row groups that start in a range, and the end of the range is known
+  /// from 'length' or the file size in 'properties'.
+  std::vector<std::shared_ptr<ConnectorSplit>> divide(
+      uint64_t maxBytes) const override;
+
   folly::dynamic serialize() const override;
 
   static std::shared_ptr<HiveConnectorSplit> create(const folly::dynamic& obj);
@@ -122,6 +128,23 @@ struct HiveConnectorSplit : public connector::ConnectorSplit {
   static void registerSerDe();
 };
 
+/// Splits of files with the same schema that one HiveDataSource reads one
+/// after another, e.g. the many small files of a table. The files after the
+/// first are opened and their footers prefetched while the first is read.
+struct HiveConnectorSplitBundle : public connector::ConnectorSplit {
+  const std::vector<std::shared_ptr<HiveConnectorSplit>> splits;
+
+  explicit HiveConnectorSplitBundle(
+      std::vector<std::shared_ptr<HiveConnectorSplit>> _splits);
+
+  std::string toString() const override;
+
+  folly::dynamic serialize() const override;
+
+  static std::shared_ptr<HiveConnectorSplitBundle> create(
+      const folly::dynamic& obj);
+};
+
 class HiveConnectorSplitBuilder {
  public:
   explicit HiveConnectorSplitBuilder(std::string filePath)
@@ -20,6 +20,8 @@
 #include "velox/connectors/hive/HiveConnectorSplit.h"
 #include "velox/dwio/common/CachedBufferedInput.h"
 #include "velox/dwio/common/DirectBufferedInput.h"
+#include "velox/dwio/common/FileMetadataCache.h"
+#include "velox/dwio/common/ReaderFactory.h"
 #include "velox/expression/Expr.h"
 #include "velox/expression/ExprToSubfieldFilter.h"
 
@@ -524,6 +526,54 @@ std::unique_ptr<dwio::common::SerDeOptions> parseSerdeParameters(
   return serDeOptions;
 }
 
+io::CachePolicy parseCachePolicy(std::string_view value) {
+  static constexpr std::string_view kTtlPrefix{"ttl="};
+  io::CachePolicy policy;
+  if (value == "pin") {
+    policy.kind = io::CachePolicy::Kind::kPin;
+  } else if (value == "never-cache") {
+    policy.kind = io::CachePolicy::Kind::kNeverCache;
+  } else if (value.substr(0, kTtlPrefix.size()) == kTtlPrefix) {
+    const auto ttlSecs = folly::tryTo<int64_t>(
+        folly::StringPiece(value.substr(kTtlPrefix.size())));
+    VELOX_USER_CHECK(
+        ttlSecs.hasValue() && ttlSecs.value() > 0,
+        "Invalid cache policy TTL: {}",
+        value);
+    policy.kind = io::CachePolicy::Kind::kTtl;
+    policy.ttlSecs = ttlSecs.value();
+  } else if (value != "default") {
+    VELOX_USER_FAIL("Invalid cache policy: {}", value);
+  }
+  return policy;
+}
+
+namespace {
+
+void configureCachePolicies(
+    const std::unordered_map<std::string, std::string>& tableParameters,
+    dwio::common::ReaderOptions& readerOptions) {
+  const std::string_view tableKey{dwio::common::TableParameter::kCachePolicy};
+  std::unordered_map<std::string, io::CachePolicy> columnPolicies;
+  for (const auto& [key, value] : tableParameters) {
+    if (key.compare(0, tableKey.size(), tableKey) != 0) {
+      continue;
+    }
+    if (key.size() == tableKey.size()) {
+      const auto policy = parseCachePolicy(value);
+      readerOptions.setCachePolicy(policy);
+      if (policy.kind == io::CachePolicy::Kind::kNeverCache) {
+        readerOptions.setNoCacheRetention(true);
+      }
+    } else if (key[tableKey.size()] == '.') {
+      columnPolicies.emplace(
+          key.substr(tableKey.size() + 1), parseCachePolicy(value));
+    }
+  }
+  readerOptions.setColumnCachePolicies(std::move(columnPolicies));
+}
+} // namespace
+
 void configureReaderOptions(
     const std::shared_ptr<const HiveConfig>& hiveConfig,
     const ConnectorQueryCtx* connectorQueryCtx,
@@ -552,6 +602,10 @@ void configureReaderOptions(
       hiveConfig->maxCoalescedBytes(sessionProperties));
   readerOptions.setMaxCoalesceDistance(
       hiveConfig->maxCoalescedDistanceBytes(sessionProperties));
+  if (hiveConfig->adaptiveCoalesceEnabled(sessionProperties)) {
+    readerOptions.setLatencyModel(
+        io::IoLatencyModel::forPath(hiveSplit->filePath));
+  }
   readerOptions.setFileColumnNamesReadAsLowerCase(
       hiveConfig->isFileColumnNamesReadAsLowerCase(sessionProperties));
   bool useColumnNamesForColumnMapping = false;
@@ -577,7 +631,14 @@ void configureReaderOptions(
   readerOptions.setFooterEstimatedSize(hiveConfig->footerEstimatedSize());
   readerOptions.setFilePreloadThreshold(hiveConfig->filePreloadThreshold());
   readerOptions.setPrefetchRowGroups(hiveConfig->prefetchRowGroups());
+  readerOptions.setPrefetchRowGroupsMemoryLimit(
+      hiveConfig->prefetchRowGroupsMemoryLimit());
   readerOptions.setNoCacheRetention(!hiveSplit->cacheable);
+  if (hiveSplit->properties.has_value()) {
+    readerOptions.setFileModificationTime(
+        hiveSplit->properties->modificationTime);
+  }
+  configureCachePolicies(tableParameters, readerOptions);
   const auto& sessionTzName = connectorQueryCtx->sessionTimezone();
   if (!sessionTzName.empty()) {
     const auto timezone = tz::locateZone(sessionTzName);
@@ -774,6 +835,43 @@ std::unique_ptr<dwio::common::BufferedInput> createBufferedInput(
       readerOpts);
 }
 
+void prefetchSplitMetadata(
+    const std::shared_ptr<const HiveConfig>& hiveConfig,
+    const ConnectorQueryCtx* connectorQueryCtx,
+    const std::shared_ptr<const HiveTableHandle>& hiveTableHandle,
+    const std::shared_ptr<const HiveConnectorSplit>& hiveSplit,
+    FileHandleFactory* fileHandleFactory,
+    folly::Executor* executor) {
+  auto fileHandle = fileHandleFactory->generate(
+      hiveSplit->filePath,
+      hiveSplit->properties.has_value() ? &*hiveSplit->properties : nullptr,
+      nullptr);
+  // Without the cache the footer read here would be dropped.
+  if (dwio::common::FileMetadataCache::getInstance() == nullptr) {
+    return;
+  }
+  dwio::common::ReaderOptions readerOptions(connectorQueryCtx->memoryPool());
+  configureReaderOptions(
+      hiveConfig,
+      connectorQueryCtx,
+      hiveTableHandle,
+      hiveSplit,
+      readerOptions);
+  if (!readerOptions.fileModificationTime().has_value()) {
+    return;
+  }
+  auto input = createBufferedInput(
+      *fileHandle,
+      readerOptions,
+      connectorQueryCtx,
+      std::make_shared<io::IoStatistics>(),
+      nullptr,
+      executor);
+  // Creating the reader reads and parses the footer and caches it.
+  dwio::common::getReaderFactory(readerOptions.fileFormat())
+      ->createReader(std::move(input), readerOptions);
+}
+
 namespace {
 
 core::CallTypedExprPtr replaceInputs(
@@ -60,6 +60,10 @@ std::shared_ptr<common::ScanSpec> makeScanSpec(
     bool disableStatsBasedFilterReorder,
     memory::MemoryPool* pool);
 
+/// Parses the value of a 'cache.policy' table parameter: 'default', 'pin',
+/// 'ttl=<seconds>' or 'never-cache'. Throws on other values.
+io::CachePolicy parseCachePolicy(std::string_view value);
+
 void configureReaderOptions(
     const std::shared_ptr<const HiveConfig>& config,
     const ConnectorQueryCtx* connectorQueryCtx,
@@ -102,6 +106,18 @@ std::unique_ptr<dwio::common::BufferedInput> createBufferedInput(
     std::shared_ptr<filesystems::File::IoStats> fsStats,
     folly::Executor* executor);
 
+/// Opens the file of 'hiveSplit' through 'fileHandleFactory' so that the file
+/// handle is cached for the reader of the split. If the process-wide file
+/// metadata cache is enabled and the split has a modification time, also
+/// reads the footer of the file into the cache.
+void prefetchSplitMetadata(
+    const std::shared_ptr<const HiveConfig>& hiveConfig,
+    const ConnectorQueryCtx* connectorQueryCtx,
+    const std::shared_ptr<const HiveTableHandle>& hiveTableHandle,
+    const std::shared_ptr<const HiveConnectorSplit>& hiveSplit,
+    FileHandleFactory* fileHandleFactory,
+    folly::Executor* executor);
+
 core::TypedExprPtr extractFiltersFromRemainingFilter(
     const core::TypedExprPtr& expr,
     core::ExpressionEvaluator* evaluator,
@@ -365,7 +365,8 @@ HiveDataSink::HiveDataSink(
     std::shared_ptr<const HiveInsertTableHandle> insertTableHandle,
     const ConnectorQueryCtx* connectorQueryCtx,
     CommitStrategy commitStrategy,
-    const std::shared_ptr<const HiveConfig>& hiveConfig)
+    const std::shared_ptr<const HiveConfig>& hiveConfig,
+    folly::Executor* ioExecutor)
     : inputType_(std::move(inputType)),
       insertTableHandle_(std::move(insertTableHandle)),
       connectorQueryCtx_(connectorQueryCtx),
@@ -374,6 +375,8 @@ HiveDataSink::HiveDataSink(
       updateMode_(getUpdateMode()),
       maxOpenWriters_(hiveConfig_->maxPartitionsPerWriters(
           connectorQueryCtx->sessionProperties())),
+      maxOpenWritersMemoryBytes_(hiveConfig_->maxOpenWritersMemoryBytes(
+          connectorQueryCtx->sessionProperties())),
       partitionChannels_(getPartitionChannels(insertTableHandle_)),
       partitionIdGenerator_(
           !partitionChannels_.empty()
@@ -401,7 +404,12 @@ HiveDataSink::HiveDataSink(
       spillConfig_(connectorQueryCtx->spillConfig()),
       sortWriterFinishTimeSliceLimitMs_(getFinishTimeSliceLimitMsFromHiveConfig(
           hiveConfig_,
-          connectorQueryCtx->sessionProperties())) {
+          connectorQueryCtx->sessionProperties())),
+      ioExecutor_(ioExecutor),
+      asyncFileClose_(
+          ioExecutor_ != nullptr && !canReclaim() &&
+          hiveConfig_->asyncFileCloseEnabled(
+              connectorQueryCtx->sessionProperties())) {
   if (isBucketed()) {
     VELOX_USER_CHECK_LT(
         bucketCount_, maxBucketCount(), "bucketCount exceeds the limit");
@@ -442,6 +450,10 @@ HiveDataSink::HiveDataSink(
   }
 }
 
+HiveDataSink::~HiveDataSink() {
+  waitForAsyncCloses();
+}
+
 bool HiveDataSink::canReclaim() const {
   // Currently, we only support memory reclaim on dwrf file writer.
   return (spillConfig_ != nullptr) &&
@@ -471,6 +483,7 @@ void HiveDataSink::appendData(RowVectorPtr input) {
   if (!isBucketed() && partitionIdGenerator_->numPartitions() == 1) {
     const auto index = ensureWriter(HiveWriterId{0});
     write(index, input);
+    closeColdWriters();
     return;
   }
 
@@ -487,6 +500,7 @@ void HiveDataSink::appendData(RowVectorPtr input) {
         : exec::wrap(partitionSize, partitionRows_[index], input);
     write(index, writerInput);
   }
+  closeColdWriters();
 }
 
 void HiveDataSink::write(size_t index, RowVectorPtr input) {
@@ -496,6 +510,65 @@ void HiveDataSink::write(size_t index, RowVectorPtr input) {
   writers_[index]->write(dataInput);
   writerInfo_[index]->inputSizeInBytes += dataInput->estimateFlatSize();
   writerInfo_[index]->numWrittenRows += dataInput->size();
+  writerInfo_[index]->lastWrite = ++numWrites_;
+}
+
+bool HiveDataSink::canCloseWriters() const {
+  return maxOpenWritersMemoryBytes_ != 0 && isPartitioned() &&
+      !isBucketed() &&
+      insertTableHandle_->locationHandle()->targetFileName().empty();
+}
+
+void HiveDataSink::closeColdWriters() {
+  if (!canCloseWriters()) {
+    return;
+  }
+  uint64_t openWritersBytes{0};
+  std::vector<uint32_t> openWriters;
+  for (uint32_t i = 0; i < writers_.size(); ++i) {
+    if (writers_[i] != nullptr) {
+      openWritersBytes += writerInfo_[i]->writerPool->reservedBytes();
+      openWriters.push_back(i);
+    }
+  }
+  if (openWritersBytes <= maxOpenWritersMemoryBytes_) {
+    return;
+  }
+  std::sort(openWriters.begin(), openWriters.end(), [&](auto lhs, auto rhs) {
+    return writerInfo_[lhs]->lastWrite < writerInfo_[rhs]->lastWrite;
+  });
+  for (auto i = 0; i + 1 < openWriters.size() &&
+       openWritersBytes > maxOpenWritersMemoryBytes_;
+       ++i) {
+    const auto index = openWriters[i];
+    openWritersBytes -= writerInfo_[index]->writerPool->reservedBytes();
+    closeWriter(index);
+  }
+}
+
+void HiveDataSink::closeWriter(uint32_t index) {
+  {
+    WRITER_NON_RECLAIMABLE_SECTION_GUARD(index);
+    writers_[index]->close();
+  }
+  writers_[index].reset();
+  auto& info = *writerInfo_[index];
+  uint64_t closedBytes{0};
+  for (const auto& file : info.closedFiles) {
+    closedBytes += file.fileSize;
+  }
+  info.closedFiles.push_back(
+      {info.writerParameters.writeFileName(),
+       info.writerParameters.targetFileName(),
+       ioStats_[index]->rawBytesWritten() - closedBytes});
+}
+
+void HiveDataSink::reopenWriter(uint32_t index) {
+  VELOX_CHECK_NULL(writers_[index]);
+  auto& info = *writerInfo_[index];
+  info.writerParameters =
+      getWriterParameters(info.writerParameters.partitionName(), std::nullopt);
+  writers_[index] = createWriter(index);
 }
 
 std::string HiveDataSink::stateString(State state) {
@@ -555,10 +628,16 @@ DataSink::Stats HiveDataSink::stats() const {
   stats.writeIOTimeUs = writeIOTimeUs;
 
   if (state_ != State::kClosed) {
+    stats.numOpenWriters = std::count_if(
+        writers_.begin(), writers_.end(), [](const auto& writer) {
+          return writer != nullptr;
+        });
     return stats;
   }
 
-  stats.numWrittenFiles = writers_.size();
+  for (const auto& info : writerInfo_) {
+    stats.numWrittenFiles += info->closedFiles.size();
+  }
   for (int i = 0; i < writerInfo_.size(); ++i) {
     const auto& info = writerInfo_.at(i);
     VELOX_CHECK_NOT_NULL(info);
@@ -626,13 +705,16 @@ bool HiveDataSink::finish() {
 
   // As for now, only sorted writer needs flush buffered data. For non-sorted
   // writer, data is directly written to the underlying file writer.
-  if (!sortWrite()) {
-    return true;
+  if (!sortWrite() || asyncClosesStarted_) {
+    return closeWritersAsync();
   }
 
   // TODO: we might refactor to move the data sorting logic into hive data sink.
   const uint64_t startTimeMs = getCurrentTimeMs();
   for (auto i = 0; i < writers_.size(); ++i) {
+    if (writers_[i] == nullptr) {
+      continue;
+    }
     WRITER_NON_RECLAIMABLE_SECTION_GUARD(i);
     if (!writers_[i]->finish()) {
       return false;
@@ -641,9 +723,66 @@ bool HiveDataSink::finish() {
       return false;
     }
   }
+  return closeWritersAsync();
+}
+
+bool HiveDataSink::closeWritersAsync() {
+  if (!asyncFileClose_) {
+    return true;
+  }
+  if (!asyncClosesStarted_) {
+    asyncClosesStarted_ = true;
+    std::vector<uint32_t> openWriters;
+    for (uint32_t i = 0; i < writers_.size(); ++i) {
+      if (writers_[i] != nullptr) {
+        openWriters.push_back(i);
+      }
+    }
+    if (openWriters.empty()) {
+      asyncClosesDone_.setValue();
+      return true;
+    }
+    numAsyncCloses_ = openWriters.size();
+    // Each close touches only the writer at its index.
+    for (const auto index : openWriters) {
+      ioExecutor_->add([this, index]() {
+        try {
+          closeWriter(index);
+        } catch (...) {
+          asyncCloseError_.withWLock([](auto& error) {
+            if (error == nullptr) {
+              error = std::current_exception();
+            }
+          });
+        }
+        if (--numAsyncCloses_ == 0) {
+          asyncClosesDone_.setValue();
+        }
+      });
+    }
+  }
+  if (numAsyncCloses_ > 0) {
+    return false;
+  }
+  if (const auto error = *asyncCloseError_.rlock()) {
+    std::rethrow_exception(error);
+  }
   return true;
 }
 
+ContinueFuture HiveDataSink::finishFuture() {
+  if (!asyncClosesStarted_ || numAsyncCloses_ == 0) {
+    return ContinueFuture::makeEmpty();
+  }
+  return asyncClosesDone_.getSemiFuture();
+}
+
+void HiveDataSink::waitForAsyncCloses() {
+  if (asyncClosesStarted_) {
+    asyncClosesDone_.getSemiFuture().wait();
+  }
+}
+
 std::vector<std::string> HiveDataSink::close() {
   setState(State::kClosed);
   closeInternal();
@@ -653,6 +792,12 @@ std::vector<std::string> HiveDataSink::close() {
   for (int i = 0; i < writerInfo_.size(); ++i) {
     const auto& info = writerInfo_.at(i);
     VELOX_CHECK_NOT_NULL(info);
+    auto fileWriteInfos = folly::dynamic::array();
+    for (const auto& file : info->closedFiles) {
+      fileWriteInfos.push_back(folly::dynamic::object(
+          "writeFileName", file.writeFileName)(
+          "targetFileName", file.targetFileName)("fileSize", file.fileSize));
+    }
     // clang-format off
       auto partitionUpdateJson = folly::toJson(
        folly::dynamic::object
@@ -662,11 +807,7 @@ std::vector<std::string> HiveDataSink::close() {
               info->writerParameters.updateMode()))
           ("writePath", info->writerParameters.writeDirectory())
           ("targetPath", info->writerParameters.targetDirectory())
-          ("fileWriteInfos", folly::dynamic::array(
-            folly::dynamic::object
-              ("writeFileName", info->writerParameters.writeFileName())
-              ("targetFileName", info->writerParameters.targetFileName())
-              ("fileSize", ioStats_.at(i)->rawBytesWritten())))
+          ("fileWriteInfos", std::move(fileWriteInfos))
           ("rowCount", info->numWrittenRows)
           ("inMemoryDataSizeInBytes", info->inputSizeInBytes)
           ("onDiskDataSizeInBytes", ioStats_.at(i)->rawBytesWritten())
@@ -685,19 +826,23 @@ void HiveDataSink::abort() {
 void HiveDataSink::closeInternal() {
   VELOX_CHECK_NE(state_, State::kRunning);
   VELOX_CHECK_NE(state_, State::kFinishing);
+  waitForAsyncCloses();
 
   TestValue::adjust(
       "facebook::velox::connector::hive::HiveDataSink::closeInternal", this);
 
   if (state_ == State::kClosed) {
     for (int i = 0; i < writers_.size(); ++i) {
-      WRITER_NON_RECLAIMABLE_SECTION_GUARD(i);
-      writers_[i]->close();
+      if (writers_[i] != nullptr) {
+        closeWriter(i);
+      }
     }
   } else {
     for (int i = 0; i < writers_.size(); ++i) {
-      WRITER_NON_RECLAIMABLE_SECTION_GUARD(i);
-      writers_[i]->abort();
+      if (writers_[i] != nullptr) {
+        WRITER_NON_RECLAIMABLE_SECTION_GUARD(i);
+        writers_[i]->abort();
+      }
     }
   }
 }
@@ -705,6 +850,9 @@ void HiveDataSink::closeInternal() {
 uint32_t HiveDataSink::ensureWriter(const HiveWriterId& id) {
   auto it = writerIndexMap_.find(id);
   if (it != writerIndexMap_.end()) {
+    if (writers_[it->second] == nullptr) {
+      reopenWriter(it->second);
+    }
     return it->second;
   }
   return appendWriter(id);
@@ -726,8 +874,6 @@ uint32_t HiveDataSink::appendWriter(const HiveWriterId& id) {
   // Without explicitly setting flush policy, the default memory based flush
   // policy is used.
   auto writerParameters = getWriterParameters(partitionName, id.bucketId);
-  const auto writePath = fs::path(writerParameters.writeDirectory()) /
-      writerParameters.writeFileName();
   auto writerPool = createWriterPool(id);
   auto sinkPool = createSinkPool(writerPool);
   std::shared_ptr<memory::MemoryPool> sortPool{nullptr};
@@ -742,6 +888,22 @@ uint32_t HiveDataSink::appendWriter(const HiveWriterId& id) {
   ioStats_.emplace_back(std::make_shared<io::IoStatistics>());
   setMemoryReclaimers(writerInfo_.back().get(), ioStats_.back().get());
 
+  writers_.emplace_back(createWriter(writerInfo_.size() - 1));
+  // Extends the buffer used for partition rows calculations.
+  partitionSizes_.emplace_back(0);
+  partitionRows_.emplace_back(nullptr);
+  rawPartitionRows_.emplace_back(nullptr);
+
+  writerIndexMap_.emplace(id, writers_.size() - 1);
+  return writerIndexMap_[id];
+}
+
+std::unique_ptr<dwio::common::Writer> HiveDataSink::createWriter(
+    uint32_t index) {
+  const auto& info = writerInfo_[index];
+  const auto writePath = fs::path(info->writerParameters.writeDirectory()) /
+      info->writerParameters.writeFileName();
+
   // Take the writer options provided by the user as a starting point, or
   // allocate a new one.
   auto options = insertTableHandle_->writerOptions();
@@ -758,7 +920,7 @@ uint32_t HiveDataSink::appendWriter(const HiveWriterId& id) {
   }
 
   if (options->memoryPool == nullptr) {
-    options->memoryPool = writerInfo_.back()->writerPool.get();
+    options->memoryPool = info->writerPool.get();
   }
 
   if (!options->compressionKind) {
@@ -770,8 +932,7 @@ uint32_t HiveDataSink::appendWriter(const HiveWriterId& id) {
   }
 
   if (options->nonReclaimableSection == nullptr) {
-    options->nonReclaimableSection =
-        writerInfo_.back()->nonReclaimableSectionHolder.get();
+    options->nonReclaimableSection = info->nonReclaimableSectionHolder.get();
   }
 
   if (options->memoryReclaimerFactory == nullptr ||
@@ -793,7 +954,7 @@ uint32_t HiveDataSink::appendWriter(const HiveWriterId& id) {
   options->processConfigs(*hiveConfig_->config(), *connectorSessionProperties);
 
   // Prevents the memory allocation during the writer creation.
-  WRITER_NON_RECLAIMABLE_SECTION_GUARD(writerInfo_.size() - 1);
+  WRITER_NON_RECLAIMABLE_SECTION_GUARD(index);
   auto writer = writerFactory_->createWriter(
       dwio::common::FileSink::create(
           writePath,
@@ -801,20 +962,12 @@ uint32_t HiveDataSink::appendWriter(const HiveWriterId& id) {
               .bufferWrite = false,
               .connectorProperties = hiveConfig_->config(),
               .fileCreateConfig = hiveConfig_->writeFileCreateConfig(),
-              .pool = writerInfo_.back()->sinkPool.get(),
+              .pool = info->sinkPool.get(),
               .metricLogger = dwio::common::MetricsLog::voidLog(),
-              .stats = ioStats_.back().get(),
+              .stats = ioStats_[index].get(),
           }),
       options);
-  writer = maybeCreateBucketSortWriter(std::move(writer));
-  writers_.emplace_back(std::move(writer));
-  // Extends the buffer used for partition rows calculations.
-  partitionSizes_.emplace_back(0);
-  partitionRows_.emplace_back(nullptr);
-  rawPartitionRows_.emplace_back(nullptr);
-
-  writerIndexMap_.emplace(id, writers_.size() - 1);
-  return writerIndexMap_[id];
+  return maybeCreateBucketSortWriter(std::move(writer));
 }
 
 std::unique_ptr<facebook::velox::dwio::common::Writer>
@@ -841,7 +994,8 @@ HiveDataSink::maybeCreateBucketSortWriter(
           connectorQueryCtx_->sessionProperties()),
       hiveConfig_->sortWriterMaxOutputBytes(
           connectorQueryCtx_->sessionProperties()),
-      sortWriterFinishTimeSliceLimitMs_);
+      sortWriterFinishTimeSliceLimitMs_,
+      spillConfig_ != nullptr ? spillConfig_->executor : nullptr);
 }
 
 HiveWriterId HiveDataSink::getWriterId(size_t row) const {
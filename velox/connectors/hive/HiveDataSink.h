@@ -15,6 +15,8 @@
  */
 #pragma once
 
+#include <folly/futures/SharedPromise.h>
+
 #include "velox/common/compression/Compression.h"
 #include "velox/connectors/Connector.h"
 #include "velox/connectors/hive/HiveConfig.h"
@@ -377,12 +379,19 @@ class HiveWriterParameters {
   }
 
  private:
-  const UpdateMode updateMode_;
-  const std::optional<std::string> partitionName_;
-  const std::string targetFileName_;
-  const std::string targetDirectory_;
-  const std::string writeFileName_;
-  const std::string writeDirectory_;
+  UpdateMode updateMode_;
+  std::optional<std::string> partitionName_;
+  std::string targetFileName_;
+  std::string targetDirectory_;
+  std::string writeFileName_;
+  std::string writeDirectory_;
+};
+
+/// A file written by a hive writer.
+struct HiveWriterFile {
+  std::string writeFileName;
+  std::string targetFileName;
+  uint64_t fileSize{0};
 };
 
 struct HiveWriterInfo {
@@ -398,7 +407,9 @@ struct HiveWriterInfo {
         sinkPool(std::move(_sinkPool)),
         sortPool(std::move(_sortPool)) {}
 
-  const HiveWriterParameters writerParameters;
+  /// The parameters of the file being written. Replaced when the writer is
+  /// reopened on a new file.
+  HiveWriterParameters writerParameters;
   const std::unique_ptr<tsan_atomic<bool>> nonReclaimableSectionHolder;
   /// Collects the spill stats from sort writer if the spilling has been
   /// triggered.
@@ -408,6 +419,12 @@ struct HiveWriterInfo {
   const std::shared_ptr<memory::MemoryPool> sortPool;
   int64_t numWrittenRows = 0;
   int64_t inputSizeInBytes = 0;
+  /// The files closed so far, e.g. to release the memory of the writer while
+  /// other partitions are written.
+  std::vector<HiveWriterFile> closedFiles;
+  /// The sequence number of the last write to the writer. The writers written
+  /// least recently are closed first.
+  uint64_t lastWrite{0};
 };
 
 /// Identifies a hive writer.
@@ -472,7 +489,11 @@ class HiveDataSink : public DataSink {
       std::shared_ptr<const HiveInsertTableHandle> insertTableHandle,
       const ConnectorQueryCtx* connectorQueryCtx,
       CommitStrategy commitStrategy,
-      const std::shared_ptr<const HiveConfig>& hiveConfig);
+      const std::shared_ptr<const HiveConfig>& hiveConfig,
+      folly::Executor* ioExecutor = nullptr);
+
+  /// Waits for the files being closed on 'ioExecutor'.
+  ~HiveDataSink() override;
 
   static uint32_t maxBucketCount() {
     static const uint32_t kMaxBucketCount = 100'000;
@@ -483,6 +504,8 @@ class HiveDataSink : public DataSink {
 
   bool finish() override;
 
+  ContinueFuture finishFuture() override;
+
   Stats stats() const override;
 
   std::vector<std::string> close() override;
@@ -578,6 +601,35 @@ class HiveDataSink : public DataSink {
   // the newly created writer in 'writers_'.
   uint32_t appendWriter(const HiveWriterId& id);
 
+  // Creates the file writer of 'writerInfo_[index]' on the file of its
+  // parameters.
+  std::unique_ptr<dwio::common::Writer> createWriter(uint32_t index);
+
+  // Returns true if the writers of partitions may be closed before the end to
+  // stay within 'maxOpenWritersMemoryBytes_'. The rows of a partition then go
+  // to several files. Not done for bucketed tables, which have one file per
+  // bucket, nor for explicit target file names.
+  bool canCloseWriters() const;
+
+  // Closes the writers written least recently while the memory of the open
+  // writers exceeds 'maxOpenWritersMemoryBytes_'. The last open one is kept.
+  void closeColdWriters();
+
+  // Closes the file of 'writers_[index]' and records it in 'closedFiles'.
+  void closeWriter(uint32_t index);
+
+  // Closes the open writers concurrently on 'ioExecutor_' if
+  // 'asyncFileClose_' is set. Returns true when all are closed. Rethrows the
+  // first error of a close.
+  bool closeWritersAsync();
+
+  // Waits for the writers being closed by closeWritersAsync().
+  void waitForAsyncCloses();
+
+  // Opens a new file for the partition of 'writerInfo_[index]', whose writer
+  // was closed by closeColdWriters().
+  void reopenWriter(uint32_t index);
+
   std::unique_ptr<facebook::velox::dwio::common::Writer>
   maybeCreateBucketSortWriter(
       std::unique_ptr<facebook::velox::dwio::common::Writer> writer);
@@ -614,6 +666,7 @@ class HiveDataSink : public DataSink {
   const std::shared_ptr<const HiveConfig> hiveConfig_;
   const HiveWriterParameters::UpdateMode updateMode_;
   const uint32_t maxOpenWriters_;
+  const uint64_t maxOpenWritersMemoryBytes_;
   const std::vector<column_index_t> partitionChannels_;
   const std::unique_ptr<PartitionIdGenerator> partitionIdGenerator_;
   // Indices of dataChannel are stored in ascending order
@@ -623,6 +676,10 @@ class HiveDataSink : public DataSink {
   const std::shared_ptr<dwio::common::WriterFactory> writerFactory_;
   const common::SpillConfig* const spillConfig_;
   const uint64_t sortWriterFinishTimeSliceLimitMs_{0};
+  folly::Executor* const ioExecutor_;
+  // True if finish() closes the files on 'ioExecutor_'. Not done if the
+  // writers may be reclaimed, as the reclaim does not stop the IO threads.
+  const bool asyncFileClose_;
 
   std::vector<column_index_t> sortColumnIndices_;
   std::vector<CompareFlags> sortCompareFlags_;
@@ -638,7 +695,11 @@ class HiveDataSink : public DataSink {
   // Below are structures for partitions from all inputs. writerInfo_ and
   // writers_ are both indexed by partitionId.
   std::vector<std::shared_ptr<HiveWriterInfo>> writerInfo_;
+  // Null for the writers closed by closeColdWriters() until they get rows
+  // again.
   std::vector<std::unique_ptr<dwio::common::Writer>> writers_;
+  // The number of writes so far. Orders the writers by 'lastWrite'.
+  uint64_t numWrites_{0};
   // IO statistics collected for each writer.
   std::vector<std::shared_ptr<io::IoStatistics>> ioStats_;
 
@@ -652,6 +713,16 @@ class HiveDataSink : public DataSink {
 
   // Reusable buffers for bucket id calculations.
   std::vector<uint32_t> bucketIds_;
+
+  // Set when closeWritersAsync() has started the closes.
+  bool asyncClosesStarted_{false};
+  // The number of writers being closed on 'ioExecutor_'.
+  std::atomic<int32_t> numAsyncCloses_{0};
+  // Fulfilled when the last of the closes started by closeWritersAsync() is
+  // done.
+  folly::SharedPromise<folly::Unit> asyncClosesDone_;
+  // The first error of a close on 'ioExecutor_'.
+  folly::Synchronized<std::exception_ptr> asyncCloseError_;
 };
 
 FOLLY_ALWAYS_INLINE std::ostream& operator<<(
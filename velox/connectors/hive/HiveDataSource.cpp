@@ -151,6 +151,9 @@ HiveDataSource::HiveDataSource(
       columnNames[readColumnNames[i]] = i;
     }
     for (auto& input : remainingFilterExpr->distinctFields()) {
+      if (partitionKeys_.count(input->field()) > 0) {
+        remainingFilterPartitionKeys_.push_back(input->field());
+      }
       auto it = columnNames.find(input->field());
       if (it != columnNames.end()) {
         if (shouldEagerlyMaterialize(*remainingFilterExpr, *input)) {
@@ -201,6 +204,14 @@ HiveDataSource::HiveDataSource(
   if (remainingFilter) {
     metadataFilter_ = std::make_shared<common::MetadataFilter>(
         *scanSpec_, *remainingFilter, expressionEvaluator_);
+    if (!remainingFilterPartitionKeys_.empty()) {
+      remainingFilter_ = std::move(remainingFilter);
+    }
+  }
+  if (!scanSpec_->statsBasedFilterReorderDisabled()) {
+    scanTracker_ = Connector::getTracker(
+        connectorQueryCtx_->scanId(),
+        hiveConfig_->loadQuantum(connectorQueryCtx_->sessionProperties()));
   }
 
   ioStats_ = std::make_shared<io::IoStatistics>();
@@ -298,12 +309,72 @@ void HiveDataSource::setupRowIdColumn() {
           connectorQueryCtx_->memoryPool());
 }
 
+HiveDataSource::~HiveDataSource() {
+  waitForBundlePrefetches();
+}
+
 void HiveDataSource::addSplit(std::shared_ptr<ConnectorSplit> split) {
   VELOX_CHECK_NULL(
       split_,
       "Previous split has not been processed yet. Call next to process the split.");
-  split_ = std::dynamic_pointer_cast<HiveConnectorSplit>(split);
-  VELOX_CHECK_NOT_NULL(split_, "Wrong type of split");
+  if (auto bundle =
+          std::dynamic_pointer_cast<HiveConnectorSplitBundle>(split)) {
+    VELOX_CHECK(bundledSplits_.empty());
+    waitForBundlePrefetches();
+    bundledSplits_.assign(bundle->splits.begin() + 1, bundle->splits.end());
+    numBundledSplits_ += bundle->splits.size();
+    addHiveSplit(bundle->splits[0]);
+    return;
+  }
+  auto hiveSplit = std::dynamic_pointer_cast<HiveConnectorSplit>(split);
+  VELOX_CHECK_NOT_NULL(hiveSplit, "Wrong type of split");
+  addHiveSplit(std::move(hiveSplit));
+}
+
+bool HiveDataSource::addNextBundledSplit() {
+  if (bundledSplits_.empty()) {
+    return false;
+  }
+  auto split = std::move(bundledSplits_.front());
+  bundledSplits_.pop_front();
+  addHiveSplit(std::move(split));
+  return true;
+}
+
+void HiveDataSource::prefetchBundledSplits() {
+  if (executor_ == nullptr) {
+    return;
+  }
+  // Started from next() and not from addSplit() since a preloaded data source
+  // is moved into another one with a different ConnectorQueryCtx.
+  for (const auto& split : bundledSplits_) {
+    bundlePrefetches_.push_back(folly::via(executor_, [this, split]() {
+      // An error surfaces when the split is read.
+      try {
+        prefetchSplitMetadata(
+            hiveConfig_,
+            connectorQueryCtx_,
+            hiveTableHandle_,
+            split,
+            fileHandleFactory_,
+            executor_);
+      } catch (const std::exception& e) {
+        VLOG(1) << "Failed to prefetch " << split->toString() << ": "
+                << e.what();
+      }
+    }));
+  }
+}
+
+void HiveDataSource::waitForBundlePrefetches() {
+  for (auto& prefetch : bundlePrefetches_) {
+    prefetch.wait();
+  }
+  bundlePrefetches_.clear();
+}
+
+void HiveDataSource::addHiveSplit(std::shared_ptr<HiveConnectorSplit> split) {
+  split_ = std::move(split);
 
   VLOG(1) << "Adding split " << split_->toString();
 
@@ -319,6 +390,10 @@ void HiveDataSource::addSplit(std::shared_ptr<ConnectorSplit> split) {
   if (specialColumns_.rowId.has_value()) {
     setupRowIdColumn();
   }
+  if (remainingFilter_) {
+    bindRemainingFilter();
+  }
+  syncFilterSelectivity();
 
   splitReader_ = createSplitReader();
   // Split reader subclasses may need to use the reader options in prepareSplit
@@ -328,6 +403,30 @@ void HiveDataSource::addSplit(std::shared_ptr<ConnectorSplit> split) {
   readerOutputType_ = splitReader_->readerOutputType();
 }
 
+void HiveDataSource::bindRemainingFilter() {
+  std::unordered_map<std::string, core::TypedExprPtr> constants;
+  for (const auto& name : remainingFilterPartitionKeys_) {
+    auto it = split_->partitionKeys.find(name);
+    VELOX_CHECK(
+        it != split_->partitionKeys.end(),
+        "Partition key {} is missing in split {}",
+        name,
+        split_->toString());
+    constants.emplace(
+        name,
+        std::make_shared<core::ConstantTypedExpr>(makePartitionKeyConstant(
+            *partitionKeys_.at(name),
+            it->second,
+            1,
+            *connectorQueryCtx_,
+            *hiveConfig_)));
+  }
+  // Compiling folds the subtrees that depend only on the partition keys.
+  remainingFilterExprSet_ = expressionEvaluator_->compile(
+      remainingFilter_->rewriteInputNames(constants));
+  ++numRemainingFilterBinds_;
+}
+
 vector_size_t HiveDataSource::applyBucketConversion(
     const RowVectorPtr& rowVector,
     BufferPtr& indices) {
@@ -376,9 +475,13 @@ std::optional<RowVectorPtr> HiveDataSource::next(
   TestValue::adjust(
       "facebook::velox::connector::hive::HiveDataSource::next", this);
 
+  if (bundlePrefetches_.empty() && !bundledSplits_.empty()) {
+    prefetchBundledSplits();
+  }
+
   if (splitReader_->emptySplit()) {
     resetSplit();
-    return nullptr;
+    return addNextBundledSplit() ? getEmptyOutput() : nullptr;
   }
 
   // Bucket conversion or delta update could add extra column to reader output.
@@ -395,7 +498,7 @@ std::optional<RowVectorPtr> HiveDataSource::next(
   if (rowsScanned == 0) {
     splitReader_->updateRuntimeStats(runtimeStats_);
     resetSplit();
-    return nullptr;
+    return addNextBundledSplit() ? getEmptyOutput() : nullptr;
   }
 
   VELOX_CHECK(
@@ -469,6 +572,7 @@ void HiveDataSource::addDynamicFilter(
   fieldSpec.addFilter(*filter);
   scanSpec_->resetCachedValues(true);
   if (splitReader_) {
+    splitReader_->onDynamicFilter(fieldSpec, *filter);
     splitReader_->resetFilterCaches();
   }
 }
@@ -511,6 +615,13 @@ std::unordered_map<std::string, RuntimeCounter> HiveDataSource::runtimeStats() {
          RuntimeCounter(
              ioStats_->ssdRead().sum(), RuntimeCounter::Unit::kBytes)});
   }
+  if (ioStats_->peerRead().count() > 0) {
+    res.insert({"numPeerRead", RuntimeCounter(ioStats_->peerRead().count())});
+    res.insert(
+        {"peerReadBytes",
+         RuntimeCounter(
+             ioStats_->peerRead().sum(), RuntimeCounter::Unit::kBytes)});
+  }
   if (ioStats_->ramHit().count() > 0) {
     res.insert({"numRamRead", RuntimeCounter(ioStats_->ramHit().count())});
     res.insert(
@@ -521,6 +632,13 @@ std::unordered_map<std::string, RuntimeCounter> HiveDataSource::runtimeStats() {
   if (numBucketConversion_ > 0) {
     res.insert({"numBucketConversion", RuntimeCounter(numBucketConversion_)});
   }
+  if (numBundledSplits_ > 0) {
+    res.insert({"numBundledSplits", RuntimeCounter(numBundledSplits_)});
+  }
+  if (numRemainingFilterBinds_ > 0) {
+    res.insert(
+        {"numRemainingFilterBinds", RuntimeCounter(numRemainingFilterBinds_)});
+  }
 
   const auto fsStats = fsStats_->stats();
   for (const auto& storageStats : fsStats) {
@@ -537,6 +655,8 @@ void HiveDataSource::setFromDataSource(
   VELOX_CHECK_NOT_NULL(source, "Bad DataSource type");
 
   split_ = std::move(source->split_);
+  bundledSplits_ = std::move(source->bundledSplits_);
+  numBundledSplits_ += source->numBundledSplits_;
   runtimeStats_.skippedSplits += source->runtimeStats_.skippedSplits;
   runtimeStats_.skippedSplitBytes += source->runtimeStats_.skippedSplitBytes;
   readerOutputType_ = std::move(source->readerOutputType_);
@@ -552,7 +672,11 @@ void HiveDataSource::setFromDataSource(
   fsStats_ = std::move(source->fsStats_);
 
   numBucketConversion_ += source->numBucketConversion_;
+  numRemainingFilterBinds_ += source->numRemainingFilterBinds_;
   partitionFunction_ = std::move(source->partitionFunction_);
+  if (remainingFilter_ && split_) {
+    bindRemainingFilter();
+  }
 }
 
 int64_t HiveDataSource::estimatedRowSize() {
@@ -584,10 +708,60 @@ vector_size_t HiveDataSource::evaluateRemainingFilter(RowVectorPtr& rowVector) {
   return rowsRemaining;
 }
 
+RowVectorPtr HiveDataSource::aggregateFromMetadata(
+    const std::vector<MetadataAggregate>& aggregates) {
+  VELOX_CHECK_NOT_NULL(split_, "No split to aggregate");
+  VELOX_CHECK_NOT_NULL(splitReader_);
+  if (!bundledSplits_.empty() || remainingFilterExprSet_ ||
+      metadataFilter_ || randomSkip_ || partitionFunction_) {
+    return nullptr;
+  }
+  // The reader output may have the columns in a different order.
+  std::vector<MetadataAggregate> readerAggregates;
+  readerAggregates.reserve(aggregates.size());
+  for (const auto& aggregate : aggregates) {
+    auto& readerAggregate = readerAggregates.emplace_back(aggregate);
+    if (aggregate.kind == MetadataAggregate::Kind::kCount) {
+      continue;
+    }
+    const auto channel = readerOutputType_->getChildIdxIfExists(
+        outputType_->nameOf(aggregate.channel));
+    if (!channel.has_value()) {
+      return nullptr;
+    }
+    readerAggregate.channel = *channel;
+  }
+  auto result = splitReader_->aggregateFromMetadata(readerAggregates);
+  if (result != nullptr) {
+    resetSplit();
+  }
+  return result;
+}
+
 void HiveDataSource::resetSplit() {
   split_.reset();
   splitReader_->resetSplit();
   // Keep readers around to hold adaptation.
+  syncFilterSelectivity();
+}
+
+void HiveDataSource::syncFilterSelectivity() {
+  if (!scanTracker_) {
+    return;
+  }
+  for (auto& child : scanSpec_->children()) {
+    if (child->isConstant() || !child->hasFilter()) {
+      continue;
+    }
+    auto& selectivity = child->selectivity();
+    auto& synced = syncedSelectivity_[child->fieldName()];
+    // A column added by a rebuilt scan spec starts with no stats.
+    const auto delta = selectivity.numIn() >= synced.numIn()
+        ? selectivity - synced
+        : SelectivityInfo{};
+    synced = scanTracker_->updateSelectivity(child->fieldName(), delta);
+    selectivity = synced;
+  }
 }
 
 HiveDataSource::WaveDelegateHookFunction HiveDataSource::waveDelegateHook_;
@@ -15,6 +15,10 @@
  */
 #pragma once
 
+#include <deque>
+
+#include <folly/futures/Future.h>
+
 #include "velox/common/base/RandomUtil.h"
 #include "velox/common/file/FileSystems.h"
 #include "velox/common/io/IoStatistics.h"
@@ -46,6 +50,10 @@ class HiveDataSource : public DataSource {
       const ConnectorQueryCtx* connectorQueryCtx,
       const std::shared_ptr<HiveConfig>& hiveConfig);
 
+  ~HiveDataSource() override;
+
+  /// Takes a HiveConnectorSplit or a HiveConnectorSplitBundle. The splits of a
+  /// bundle are read one after another, sharing the ScanSpec and the filters.
   void addSplit(std::shared_ptr<ConnectorSplit> split) override;
 
   std::optional<RowVectorPtr> next(uint64_t size, velox::ContinueFuture& future)
@@ -71,6 +79,11 @@ class HiveDataSource : public DataSource {
 
   void setFromDataSource(std::unique_ptr<DataSource> sourceUnique) override;
 
+  /// Returns nullptr for bundles, bucket conversion, random sampling and
+  /// filters not pushed down into the reader.
+  RowVectorPtr aggregateFromMetadata(
+      const std::vector<MetadataAggregate>& aggregates) override;
+
   int64_t estimatedRowSize() override;
 
   std::shared_ptr<wave::WaveDataSource> toWaveDataSource() override;
@@ -134,6 +147,24 @@ class HiveDataSource : public DataSource {
 
   void setupRowIdColumn();
 
+  // Recompiles 'remainingFilter_' with the partition keys it references
+  // replaced by their values in 'split_', so that the parts that depend only
+  // on them are evaluated once per split instead of once per row.
+  void bindRemainingFilter();
+
+  // Sets up 'splitReader_' for 'split'.
+  void addHiveSplit(std::shared_ptr<HiveConnectorSplit> split);
+
+  // Adds the next split of the current bundle. Returns false if there is
+  // none.
+  bool addNextBundledSplit();
+
+  // Opens the files of 'bundledSplits_' and prefetches their footers on
+  // 'executor_'.
+  void prefetchBundledSplits();
+
+  void waitForBundlePrefetches();
+
   // Evaluates remainingFilter_ on the specified vector. Returns number of rows
   // passed. Populates filterEvalCtx_.selectedIndices and selectedBits if only
   // some rows passed the filter. If none or all rows passed
@@ -144,6 +175,11 @@ class HiveDataSource : public DataSource {
   // hold adaptation.
   void resetSplit();
 
+  // Adds the filter stats collected since the last call to the ones shared
+  // with the other drivers of the same scan, and continues from the shared
+  // stats so that the filter order benefits from all the splits read so far.
+  void syncFilterSelectivity();
+
   const RowVectorPtr& getEmptyOutput() {
     if (!emptyOutput_) {
       emptyOutput_ = RowVector::createEmpty(outputType_, pool_);
@@ -164,17 +200,39 @@ class HiveDataSource : public DataSource {
   common::SubfieldFilters filters_;
   std::shared_ptr<common::MetadataFilter> metadataFilter_;
   std::unique_ptr<exec::ExprSet> remainingFilterExprSet_;
+  // The remaining filter if it references partition keys. Compiled into
+  // 'remainingFilterExprSet_' for each split by bindRemainingFilter().
+  core::TypedExprPtr remainingFilter_;
+  // The partition keys referenced by 'remainingFilter_'.
+  std::vector<std::string> remainingFilterPartitionKeys_;
+  // Number of times 'remainingFilter_' was compiled for a split.
+  uint64_t numRemainingFilterBinds_{0};
   RowVectorPtr emptyOutput_;
   dwio::common::RuntimeStatistics runtimeStats_;
   std::atomic<uint64_t> totalRemainingFilterTime_{0};
   uint64_t completedRows_ = 0;
 
+  // The splits of the current bundle after 'split_'.
+  std::deque<std::shared_ptr<HiveConnectorSplit>> bundledSplits_;
+  // The prefetches of the files of 'bundledSplits_'. Waited for on
+  // destruction.
+  std::vector<folly::Future<folly::Unit>> bundlePrefetches_;
+  // Number of splits read as part of a bundle.
+  uint64_t numBundledSplits_{0};
+
   // Field indices referenced in both remaining filter and output type. These
   // columns need to be materialized eagerly to avoid missing values in output.
   std::vector<column_index_t> multiReferencedFields_;
 
   std::shared_ptr<random::RandomSkipTracker> randomSkip_;
 
+  // Holds the filter stats shared by the drivers of this scan. Null if stats
+  // based filter reordering is disabled.
+  std::shared_ptr<cache::ScanTracker> scanTracker_;
+  // Filter stats of the top level columns as of the last
+  // syncFilterSelectivity().
+  folly::F14FastMap<std::string, SelectivityInfo> syncedSelectivity_;
+
   int64_t numBucketConversion_ = 0;
   std::unique_ptr<HivePartitionFunction> partitionFunction_;
   std::vector<uint32_t> partitions_;
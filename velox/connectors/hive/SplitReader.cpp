@@ -24,6 +24,7 @@
 #include "velox/connectors/hive/iceberg/IcebergSplitReader.h"
 #include "velox/dwio/common/CachedBufferedInput.h"
 #include "velox/dwio/common/ReaderFactory.h"
+#include "velox/dwio/common/Statistics.h"
 #include "velox/type/TimestampConversion.h"
 
 namespace facebook::velox::connector::hive {
@@ -73,8 +74,74 @@ VectorPtr newConstantFromString(
         pool, size, false, type, std::move(copy));
   }
 }
+bool isIntegerType(const TypePtr& type) {
+  switch (type->kind()) {
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+      return !type->isDecimal();
+    default:
+      return false;
+  }
+}
+
+template <TypeKind kind>
+VectorPtr newIntegerVector(
+    const TypePtr& type,
+    int64_t value,
+    velox::memory::MemoryPool* pool) {
+  using T = typename TypeTraits<kind>::NativeType;
+  auto vector = BaseVector::create<FlatVector<T>>(type, 1, pool);
+  vector->set(0, static_cast<T>(value));
+  return vector;
+}
+
+// Returns a vector of one row of 'type' with 'value', or null if 'value' is
+// not set.
+VectorPtr newIntegerVector(
+    const TypePtr& type,
+    std::optional<int64_t> value,
+    velox::memory::MemoryPool* pool) {
+  if (!value.has_value()) {
+    return BaseVector::createNullConstant(type, 1, pool);
+  }
+  switch (type->kind()) {
+    case TypeKind::TINYINT:
+      return newIntegerVector<TypeKind::TINYINT>(type, *value, pool);
+    case TypeKind::SMALLINT:
+      return newIntegerVector<TypeKind::SMALLINT>(type, *value, pool);
+    case TypeKind::INTEGER:
+      return newIntegerVector<TypeKind::INTEGER>(type, *value, pool);
+    case TypeKind::BIGINT:
+      return newIntegerVector<TypeKind::BIGINT>(type, *value, pool);
+    default:
+      VELOX_UNREACHABLE();
+  }
+}
+
 } // namespace
 
+VectorPtr makePartitionKeyConstant(
+    const HiveColumnHandle& handle,
+    const std::optional<std::string>& value,
+    vector_size_t size,
+    const ConnectorQueryCtx& connectorQueryCtx,
+    const HiveConfig& hiveConfig) {
+  const auto& type = handle.dataType();
+  return VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH_ALL(
+      newConstantFromString,
+      type->kind(),
+      type,
+      value,
+      size,
+      connectorQueryCtx.memoryPool(),
+      connectorQueryCtx.sessionTimezone(),
+      hiveConfig.readTimestampPartitionValueAsLocalTime(
+          connectorQueryCtx.sessionProperties()),
+      handle.isPartitionDateValueDaysSinceEpoch());
+}
+
 std::unique_ptr<SplitReader> SplitReader::create(
     const std::shared_ptr<hive::HiveConnectorSplit>& hiveSplit,
     const std::shared_ptr<const HiveTableHandle>& hiveTableHandle,
@@ -196,6 +263,95 @@ bool SplitReader::emptySplit() const {
   return emptySplit_;
 }
 
+RowVectorPtr SplitReader::aggregateFromMetadata(
+    const std::vector<MetadataAggregate>& aggregates) const {
+  // The metadata covers all the rows of the file, so the split must cover all
+  // of them and the filters must drop none. The filters on partition keys are
+  // applied when preparing the split.
+  if (!emptySplit_ &&
+      (hiveSplit_->start != 0 || hiveSplit_->length < fileSize_)) {
+    return nullptr;
+  }
+  for (const auto& childSpec : scanSpec_->children()) {
+    if (!childSpec->isConstant() && childSpec->hasFilter()) {
+      return nullptr;
+    }
+  }
+  uint64_t numRows = 0;
+  if (!emptySplit_) {
+    const auto fileRows = baseReader_->numberOfRows();
+    if (!fileRows.has_value()) {
+      return nullptr;
+    }
+    numRows = *fileRows;
+  }
+
+  std::vector<std::string> names;
+  std::vector<TypePtr> types;
+  for (const auto& aggregate : aggregates) {
+    names.push_back(fmt::format("a{}", names.size()));
+    types.push_back(
+        aggregate.kind == MetadataAggregate::Kind::kCount
+            ? BIGINT()
+            : readerOutputType_->childAt(aggregate.channel));
+  }
+  auto rowType = ROW(std::move(names), std::move(types));
+  if (numRows == 0) {
+    return RowVector::createEmpty(rowType, pool_);
+  }
+
+  std::vector<VectorPtr> columns;
+  for (auto i = 0; i < aggregates.size(); ++i) {
+    const auto& aggregate = aggregates[i];
+    const auto& type = rowType->childAt(i);
+    if (aggregate.kind == MetadataAggregate::Kind::kCount) {
+      columns.push_back(
+          newIntegerVector(type, static_cast<int64_t>(numRows), pool_));
+      continue;
+    }
+    const auto& name = readerOutputType_->nameOf(aggregate.channel);
+    const auto* childSpec = scanSpec_->childByName(name);
+    if (childSpec == nullptr) {
+      return nullptr;
+    }
+    if (childSpec->isConstant()) {
+      columns.push_back(
+          BaseVector::wrapInConstant(1, 0, childSpec->constantValue()));
+      continue;
+    }
+    if (aggregate.kind == MetadataAggregate::Kind::kConstant ||
+        !isIntegerType(type)) {
+      return nullptr;
+    }
+    const auto fileIndex = baseReader_->rowType()->getChildIdxIfExists(name);
+    if (!fileIndex.has_value() ||
+        baseReader_->rowType()->childAt(*fileIndex)->kind() != type->kind()) {
+      return nullptr;
+    }
+    auto stats = baseReader_->columnStatistics(
+        baseReader_->typeWithId()->childAt(*fileIndex)->id());
+    const auto* integerStats =
+        dynamic_cast<const dwio::common::IntegerColumnStatistics*>(stats.get());
+    if (integerStats == nullptr ||
+        !integerStats->getNumberOfValues().has_value()) {
+      return nullptr;
+    }
+    // min() and max() of only nulls are null.
+    std::optional<int64_t> value;
+    if (*integerStats->getNumberOfValues() > 0) {
+      value = aggregate.kind == MetadataAggregate::Kind::kMin
+          ? integerStats->getMinimum()
+          : integerStats->getMaximum();
+      if (!value.has_value()) {
+        return nullptr;
+      }
+    }
+    columns.push_back(newIntegerVector(type, value, pool_));
+  }
+  return std::make_shared<RowVector>(
+      pool_, std::move(rowType), nullptr, 1, std::move(columns));
+}
+
 void SplitReader::resetSplit() {
   hiveSplit_.reset();
 }
@@ -269,6 +425,7 @@ void SplitReader::createReader() {
   if (auto* cacheTTLController = cache::CacheTTLController::getInstance()) {
     cacheTTLController->addOpenFileInfo(fileHandleCachePtr->uuid.id());
   }
+  fileSize_ = fileHandleCachePtr->file->size();
   auto baseFileInput = createBufferedInput(
       *fileHandleCachePtr,
       baseReaderOpts_,
@@ -406,19 +563,8 @@ void SplitReader::setPartitionValue(
       it != partitionKeys_->end(),
       "ColumnHandle is missing for partition key {}",
       partitionKey);
-  auto type = it->second->dataType();
-  auto constant = VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH_ALL(
-      newConstantFromString,
-      type->kind(),
-      type,
-      value,
-      1,
-      connectorQueryCtx_->memoryPool(),
-      connectorQueryCtx_->sessionTimezone(),
-      hiveConfig_->readTimestampPartitionValueAsLocalTime(
-          connectorQueryCtx_->sessionProperties()),
-      it->second->isPartitionDateValueDaysSinceEpoch());
-  spec->setConstantValue(constant);
+  spec->setConstantValue(makePartitionKeyConstant(
+      *it->second, value, 1, *connectorQueryCtx_, *hiveConfig_));
 }
 
 } // namespace facebook::velox::connector::hive
@@ -52,6 +52,15 @@ class HiveTableHandle;
 class HiveColumnHandle;
 class HiveConfig;
 
+/// Returns a constant vector of 'size' rows holding the value 'value' of the
+/// partition key 'handle' as found in a split.
+VectorPtr makePartitionKeyConstant(
+    const HiveColumnHandle& handle,
+    const std::optional<std::string>& value,
+    vector_size_t size,
+    const ConnectorQueryCtx& connectorQueryCtx,
+    const HiveConfig& hiveConfig);
+
 class SplitReader {
  public:
   static std::unique_ptr<SplitReader> create(
@@ -85,8 +94,21 @@ class SplitReader {
 
   void resetFilterCaches();
 
+  /// Called after the data source merged the dynamic filter 'filter' into
+  /// 'fieldSpec' of the scan spec. Table formats that change the filters of
+  /// the scan spec for a split keep 'filter' when they restore them.
+  virtual void onDynamicFilter(
+      const common::ScanSpec& /*fieldSpec*/,
+      const common::Filter& /*filter*/) {}
+
   bool emptySplit() const;
 
+  /// Computes 'aggregates' over the split from the file footer, see
+  /// DataSource::aggregateFromMetadata(). The channels of 'aggregates' are
+  /// into readerOutputType(). Returns nullptr if any of them is not known.
+  virtual RowVectorPtr aggregateFromMetadata(
+      const std::vector<MetadataAggregate>& aggregates) const;
+
   void resetSplit();
 
   int64_t estimatedRowSize() const;
@@ -179,6 +201,8 @@ class SplitReader {
   dwio::common::ReaderOptions baseReaderOpts_;
   dwio::common::RowReaderOptions baseRowReaderOpts_;
   bool emptySplit_;
+  // Size of the file of 'hiveSplit_'. Set by createReader().
+  uint64_t fileSize_{0};
 };
 
 } // namespace facebook::velox::connector::hive
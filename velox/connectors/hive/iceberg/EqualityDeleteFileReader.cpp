@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/connectors/hive/iceberg/EqualityDeleteFileReader.h"
+
+#include <algorithm>
+
+#include "velox/connectors/hive/HiveConnectorSplit.h"
+#include "velox/connectors/hive/HiveConnectorUtil.h"
+#include "velox/connectors/hive/iceberg/IcebergDeleteFile.h"
+#include "velox/dwio/common/ReaderFactory.h"
+
+namespace facebook::velox::connector::hive::iceberg {
+
+namespace {
+
+constexpr uint64_t kBatchSize = 10'000;
+
+// True for the types of a single delete column that are deleted by a filter.
+bool isFilterable(const TypePtr& type) {
+  if (type->isDecimal()) {
+    return false;
+  }
+  switch (type->kind()) {
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+    case TypeKind::VARCHAR:
+    case TypeKind::VARBINARY:
+      return true;
+    default:
+      return false;
+  }
+}
+
+int64_t integerAt(const DecodedVector& decoded, vector_size_t row) {
+  switch (decoded.base()->typeKind()) {
+    case TypeKind::TINYINT:
+      return decoded.valueAt<int8_t>(row);
+    case TypeKind::SMALLINT:
+      return decoded.valueAt<int16_t>(row);
+    case TypeKind::INTEGER:
+      return decoded.valueAt<int32_t>(row);
+    case TypeKind::BIGINT:
+      return decoded.valueAt<int64_t>(row);
+    default:
+      VELOX_UNREACHABLE();
+  }
+}
+
+template <TypeKind Kind>
+void appendValue(
+    const DecodedVector& decoded,
+    vector_size_t row,
+    std::string& key) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  const auto value = decoded.valueAt<T>(row);
+  if constexpr (std::is_same_v<T, StringView>) {
+    const uint32_t size = value.size();
+    key.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    key.append(value.data(), size);
+  } else {
+    key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+}
+
+// Appends 'row' of 'decoded' to 'key' so that rows with equal values of the
+// delete columns make equal keys.
+void appendKey(
+    const std::vector<DecodedVector>& decoded,
+    vector_size_t row,
+    std::string& key) {
+  key.clear();
+  for (const auto& column : decoded) {
+    if (column.isNullAt(row)) {
+      key.push_back(0);
+      continue;
+    }
+    key.push_back(1);
+    VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+        appendValue, column.base()->typeKind(), column, row, key);
+  }
+}
+
+struct EqualityDeletesGenerator {
+  std::unique_ptr<EqualityDeletes> operator()(
+      const std::string& /*key*/,
+      const EqualityDeleteFileReader* reader,
+      void* /*stats*/) {
+    return reader->readDeletes();
+  }
+};
+
+using EqualityDeletesFactory = CachedFactory<
+    std::string,
+    EqualityDeletes,
+    EqualityDeletesGenerator,
+    EqualityDeleteFileReader,
+    void,
+    EqualityDeletesSizer>;
+
+// Keeps up to 256MB of deletes of the delete files read recently. The entries
+// are per query and expire 10 minutes after they are read. The ones in use by
+// a split are pinned.
+EqualityDeletesFactory& deletesFactory() {
+  static EqualityDeletesFactory factory(
+      std::make_unique<SimpleLRUCache<std::string, EqualityDeletes>>(
+          256 << 20, 10 * 60 * 1'000),
+      std::make_unique<EqualityDeletesGenerator>());
+  return factory;
+}
+
+} // namespace
+
+bool EqualityDeletes::isDeleted(
+    const std::vector<DecodedVector>& decoded,
+    vector_size_t row,
+    std::string& key) const {
+  if (filter == nullptr) {
+    appendKey(decoded, row, key);
+    return keys.contains(key);
+  }
+  const auto& column = decoded[0];
+  if (column.isNullAt(row)) {
+    return !filter->testNull();
+  }
+  if (filter->kind() == common::FilterKind::kIsNotNull) {
+    return false;
+  }
+  if (filter->kind() == common::FilterKind::kNegatedBytesValues) {
+    const auto value = column.valueAt<StringView>(row);
+    return !filter->testBytes(value.data(), value.size());
+  }
+  return !filter->testInt64(integerAt(column, row));
+}
+
+EqualityDeleteFileReader::EqualityDeleteFileReader(
+    const IcebergDeleteFile& deleteFile,
+    RowTypePtr deleteColumns,
+    FileHandleFactory* fileHandleFactory,
+    const ConnectorQueryCtx* connectorQueryCtx,
+    folly::Executor* executor,
+    const std::shared_ptr<const HiveConfig>& hiveConfig,
+    const std::shared_ptr<io::IoStatistics>& ioStats,
+    const std::shared_ptr<filesystems::File::IoStats>& fsStats,
+    const std::string& connectorId)
+    : deleteFile_(deleteFile),
+      deleteColumns_(std::move(deleteColumns)),
+      fileHandleFactory_(fileHandleFactory),
+      connectorQueryCtx_(connectorQueryCtx),
+      executor_(executor),
+      hiveConfig_(hiveConfig),
+      ioStats_(ioStats),
+      fsStats_(fsStats),
+      connectorId_(connectorId) {
+  VELOX_CHECK(deleteFile_.content == FileContent::kEqualityDeletes);
+  VELOX_CHECK_GT(deleteColumns_->size(), 0);
+}
+
+EqualityDeletesPtr EqualityDeleteFileReader::deletes() const {
+  const auto key = fmt::format(
+      "{}:{}:{}",
+      connectorQueryCtx_->queryId(),
+      deleteFile_.filePath,
+      deleteColumns_->toString());
+  return deletesFactory().generate(key, this);
+}
+
+std::unique_ptr<EqualityDeletes> EqualityDeleteFileReader::readDeletes()
+    const {
+  auto* pool = connectorQueryCtx_->memoryPool();
+  auto scanSpec = std::make_shared<common::ScanSpec>("<root>");
+  for (auto i = 0; i < deleteColumns_->size(); ++i) {
+    scanSpec->addField(deleteColumns_->nameOf(i), i);
+  }
+
+  auto deleteSplit = std::make_shared<HiveConnectorSplit>(
+      connectorId_,
+      deleteFile_.filePath,
+      deleteFile_.fileFormat,
+      0,
+      deleteFile_.fileSizeInBytes);
+
+  dwio::common::ReaderOptions deleteReaderOpts(pool);
+  configureReaderOptions(
+      hiveConfig_,
+      connectorQueryCtx_,
+      deleteColumns_,
+      deleteSplit,
+      /*tableParameters=*/{},
+      deleteReaderOpts);
+
+  auto deleteFileHandleCachePtr =
+      fileHandleFactory_->generate(deleteFile_.filePath);
+  auto deleteFileInput = createBufferedInput(
+      *deleteFileHandleCachePtr,
+      deleteReaderOpts,
+      connectorQueryCtx_,
+      ioStats_,
+      fsStats_,
+      executor_);
+
+  auto deleteReader =
+      dwio::common::getReaderFactory(deleteReaderOpts.fileFormat())
+          ->createReader(std::move(deleteFileInput), deleteReaderOpts);
+
+  dwio::common::RowReaderOptions deleteRowReaderOpts;
+  configureRowReaderOptions(
+      {},
+      scanSpec,
+      nullptr,
+      deleteColumns_,
+      deleteSplit,
+      nullptr,
+      nullptr,
+      deleteRowReaderOpts);
+  auto deleteRowReader = deleteReader->createRowReader(deleteRowReaderOpts);
+
+  auto deletes = std::make_unique<EqualityDeletes>();
+  deletes->columns = deleteColumns_;
+  const bool useFilter =
+      deleteColumns_->size() == 1 && isFilterable(deleteColumns_->childAt(0));
+  std::vector<int64_t> integers;
+  std::vector<std::string> strings;
+  bool hasNull = false;
+
+  VectorPtr output = BaseVector::create(deleteColumns_, 0, pool);
+  std::vector<DecodedVector> decoded(deleteColumns_->size());
+  std::string key;
+  while (deleteRowReader->next(kBatchSize, output) > 0) {
+    const auto numRows = output->size();
+    if (numRows == 0) {
+      continue;
+    }
+    auto* rowVector = output->asUnchecked<RowVector>();
+    for (auto i = 0; i < decoded.size(); ++i) {
+      decoded[i].decode(
+          *BaseVector::loadedVectorShared(rowVector->childAt(i)));
+    }
+    for (vector_size_t row = 0; row < numRows; ++row) {
+      if (!useFilter) {
+        appendKey(decoded, row, key);
+        if (deletes->keys.insert(key).second) {
+          deletes->sizeInBytes += sizeof(std::string) + key.size();
+        }
+      } else if (decoded[0].isNullAt(row)) {
+        hasNull = true;
+      } else if (decoded[0].base()->type()->isVarchar() ||
+                 decoded[0].base()->type()->isVarbinary()) {
+        strings.emplace_back(decoded[0].valueAt<StringView>(row));
+        deletes->sizeInBytes += sizeof(std::string) + strings.back().size();
+      } else {
+        integers.push_back(integerAt(decoded[0], row));
+      }
+    }
+  }
+
+  if (!strings.empty()) {
+    deletes->filter =
+        std::make_unique<common::NegatedBytesValues>(strings, !hasNull);
+  } else if (!integers.empty()) {
+    std::sort(integers.begin(), integers.end());
+    integers.erase(
+        std::unique(integers.begin(), integers.end()), integers.end());
+    deletes->filter = common::createNegatedBigintValues(integers, !hasNull);
+    deletes->sizeInBytes += integers.size() * sizeof(int64_t);
+  } else if (hasNull) {
+    deletes->filter = std::make_unique<common::IsNotNull>();
+  }
+  return deletes;
+}
+
+} // namespace facebook::velox::connector::hive::iceberg
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <folly/Executor.h>
+#include <folly/container/F14Set.h>
+#include <memory>
+
+#include "velox/common/caching/CachedFactory.h"
+#include "velox/connectors/Connector.h"
+#include "velox/connectors/hive/FileHandle.h"
+#include "velox/connectors/hive/HiveConfig.h"
+#include "velox/type/Filter.h"
+#include "velox/vector/DecodedVector.h"
+
+namespace facebook::velox::connector::hive::iceberg {
+
+struct IcebergDeleteFile;
+
+/// The rows of an equality delete file. A row of a base file is deleted if its
+/// values of 'columns' are equal to the ones of a delete row. Nulls are equal
+/// to nulls.
+struct EqualityDeletes {
+  /// The delete columns, by name and type in the base files.
+  RowTypePtr columns;
+
+  /// Set for a single integer or string column. Passes the values that are
+  /// not deleted. It can be pushed down into the scan of the base files.
+  std::unique_ptr<common::Filter> filter;
+
+  /// The delete rows, each encoded as one key, if 'filter' is not set.
+  folly::F14FastSet<std::string> keys;
+
+  /// Memory held by 'filter' or 'keys'.
+  uint64_t sizeInBytes{0};
+
+  /// True if the file has no rows.
+  bool empty() const {
+    return filter == nullptr && keys.empty();
+  }
+
+  /// Returns true if 'row' of the delete columns in 'decoded' is deleted.
+  /// 'key' is scratch memory.
+  bool isDeleted(
+      const std::vector<DecodedVector>& decoded,
+      vector_size_t row,
+      std::string& key) const;
+};
+
+struct EqualityDeletesSizer {
+  uint64_t operator()(const EqualityDeletes& deletes) const {
+    return deletes.sizeInBytes;
+  }
+};
+
+using EqualityDeletesPtr = CachedPtr<std::string, EqualityDeletes>;
+
+class EqualityDeleteFileReader {
+ public:
+  /// Reads the 'deleteColumns' of 'deleteFile'. 'deleteColumns' has the names
+  /// and types of the columns in the base files.
+  EqualityDeleteFileReader(
+      const IcebergDeleteFile& deleteFile,
+      RowTypePtr deleteColumns,
+      FileHandleFactory* fileHandleFactory,
+      const ConnectorQueryCtx* connectorQueryCtx,
+      folly::Executor* executor,
+      const std::shared_ptr<const HiveConfig>& hiveConfig,
+      const std::shared_ptr<io::IoStatistics>& ioStats,
+      const std::shared_ptr<filesystems::File::IoStats>& fsStats,
+      const std::string& connectorId);
+
+  /// Returns the deletes of the file. The splits of a query that reference the
+  /// same delete file share the deletes read by the first of them.
+  EqualityDeletesPtr deletes() const;
+
+  /// Reads the whole file.
+  std::unique_ptr<EqualityDeletes> readDeletes() const;
+
+ private:
+  const IcebergDeleteFile& deleteFile_;
+  const RowTypePtr deleteColumns_;
+  FileHandleFactory* const fileHandleFactory_;
+  const ConnectorQueryCtx* const connectorQueryCtx_;
+  folly::Executor* const executor_;
+  const std::shared_ptr<const HiveConfig> hiveConfig_;
+  const std::shared_ptr<io::IoStatistics> ioStats_;
+  const std::shared_ptr<filesystems::File::IoStats> fsStats_;
+  const std::string connectorId_;
+};
+
+} // namespace facebook::velox::connector::hive::iceberg
@@ -16,6 +16,8 @@
 
 #include "velox/connectors/hive/iceberg/IcebergSplitReader.h"
 
+#include <algorithm>
+
 #include "velox/connectors/hive/iceberg/IcebergDeleteFile.h"
 #include "velox/connectors/hive/iceberg/IcebergSplit.h"
 #include "velox/dwio/common/BufferUtil.h"
@@ -54,6 +56,17 @@ IcebergSplitReader::IcebergSplitReader(
       deleteBitmap_(nullptr),
       deleteBitmapBitOffset_(0) {}
 
+IcebergSplitReader::~IcebergSplitReader() {
+  if (pushedDownFilters_.empty()) {
+    return;
+  }
+  // The scan spec is shared with the next splits.
+  for (auto& [spec, filter] : pushedDownFilters_) {
+    spec->setFilter(std::move(filter));
+  }
+  scanSpec_->resetCachedValues(false);
+}
+
 void IcebergSplitReader::prepareSplit(
     std::shared_ptr<common::MetadataFilter> metadataFilter,
     dwio::common::RuntimeStatistics& runtimeStats) {
@@ -68,10 +81,12 @@ void IcebergSplitReader::prepareSplit(
     return;
   }
 
-  createRowReader(std::move(metadataFilter), std::move(rowType));
-
   std::shared_ptr<const HiveIcebergSplit> icebergSplit =
       std::dynamic_pointer_cast<const HiveIcebergSplit>(hiveSplit_);
+  prepareEqualityDeletes(icebergSplit->deleteFiles);
+
+  createRowReader(std::move(metadataFilter), std::move(rowType));
+
   baseReadOffset_ = 0;
   splitOffset_ = baseRowReader_->nextRowNumber();
   positionalDeleteFileReaders_.clear();
@@ -94,12 +109,154 @@ void IcebergSplitReader::prepareSplit(
                 splitOffset_,
                 hiveSplit_->connectorId));
       }
-    } else {
+    } else if (deleteFile.content != FileContent::kEqualityDeletes) {
       VELOX_NYI();
     }
   }
 }
 
+void IcebergSplitReader::prepareEqualityDeletes(
+    const std::vector<IcebergDeleteFile>& deleteFiles) {
+  equalityDeletes_.clear();
+  const auto& fileType = baseReader_->rowType();
+  for (const auto& deleteFile : deleteFiles) {
+    if (deleteFile.content != FileContent::kEqualityDeletes ||
+        deleteFile.recordCount == 0) {
+      continue;
+    }
+    VELOX_USER_CHECK(
+        !deleteFile.equalityFieldIds.empty(),
+        "Iceberg equality delete file has no equality field ids: {}",
+        deleteFile.filePath);
+    // The field ids of the top level columns are their 1-based positions in
+    // the base file.
+    std::vector<std::string> names;
+    std::vector<TypePtr> types;
+    for (const auto fieldId : deleteFile.equalityFieldIds) {
+      VELOX_USER_CHECK(
+          fieldId > 0 && fieldId <= fileType->size(),
+          "Iceberg equality delete field id {} is not a top level column of {}",
+          fieldId,
+          hiveSplit_->filePath);
+      const auto& name = fileType->nameOf(fieldId - 1);
+      names.push_back(name);
+      // The values of the delete file are compared to the values read.
+      types.push_back(
+          readerOutputType_->containsChild(name)
+              ? readerOutputType_->findChild(name)
+              : fileType->childAt(fieldId - 1));
+    }
+
+    EqualityDeleteFileReader reader(
+        deleteFile,
+        ROW(std::move(names), std::move(types)),
+        fileHandleFactory_,
+        connectorQueryCtx_,
+        executor_,
+        hiveConfig_,
+        ioStats_,
+        fsStats_,
+        hiveSplit_->connectorId);
+    auto deletes = reader.deletes();
+    if (deletes->empty()) {
+      continue;
+    }
+    const auto& columns = *deletes->columns;
+    if (deletes->filter != nullptr) {
+      auto* spec = scanSpec_->childByName(columns.nameOf(0));
+      if (spec != nullptr && !spec->isConstant()) {
+        pushDownDeletes(*spec, *deletes->filter);
+        continue;
+      }
+    }
+
+    std::vector<column_index_t> channels;
+    for (const auto& name : columns.names()) {
+      auto* spec = scanSpec_->childByName(name);
+      if (spec == nullptr || !spec->projectOut()) {
+        VELOX_NYI(
+            "Iceberg equality deletes on columns that are not projected: {}",
+            name);
+      }
+      channels.push_back(spec->channel());
+    }
+    equalityDeletes_.emplace_back(std::move(deletes), std::move(channels));
+  }
+}
+
+void IcebergSplitReader::pushDownDeletes(
+    common::ScanSpec& spec,
+    const common::Filter& filter) {
+  auto it = std::find_if(
+      pushedDownFilters_.begin(),
+      pushedDownFilters_.end(),
+      [&](const auto& pushedDown) { return pushedDown.first == &spec; });
+  if (it == pushedDownFilters_.end()) {
+    pushedDownFilters_.emplace_back(
+        &spec, spec.filter() ? spec.filter()->clone() : nullptr);
+  }
+  spec.addFilter(filter);
+  scanSpec_->resetCachedValues(false);
+}
+
+RowVectorPtr IcebergSplitReader::aggregateFromMetadata(
+    const std::vector<MetadataAggregate>& aggregates) const {
+  if (!positionalDeleteFileReaders_.empty() || !equalityDeletes_.empty() ||
+      !pushedDownFilters_.empty()) {
+    return nullptr;
+  }
+  return SplitReader::aggregateFromMetadata(aggregates);
+}
+
+void IcebergSplitReader::onDynamicFilter(
+    const common::ScanSpec& fieldSpec,
+    const common::Filter& filter) {
+  for (auto& [spec, original] : pushedDownFilters_) {
+    if (spec == &fieldSpec) {
+      original = original ? original->mergeWith(&filter) : filter.clone();
+    }
+  }
+}
+
+void IcebergSplitReader::applyEqualityDeletes(VectorPtr& output) {
+  auto* rowVector = output->asUnchecked<RowVector>();
+  const auto numRows = rowVector->size();
+  std::vector<std::vector<DecodedVector>> decoded(equalityDeletes_.size());
+  for (auto i = 0; i < equalityDeletes_.size(); ++i) {
+    for (const auto channel : equalityDeletes_[i].second) {
+      decoded[i].emplace_back(
+          *BaseVector::loadedVectorShared(rowVector->childAt(channel)));
+    }
+  }
+
+  auto* pool = connectorQueryCtx_->memoryPool();
+  auto indices = allocateIndices(numRows, pool);
+  auto* rawIndices = indices->asMutable<vector_size_t>();
+  vector_size_t numPassed = 0;
+  std::string key;
+  for (vector_size_t row = 0; row < numRows; ++row) {
+    bool deleted = false;
+    for (auto i = 0; i < equalityDeletes_.size() && !deleted; ++i) {
+      deleted = equalityDeletes_[i].first->isDeleted(decoded[i], row, key);
+    }
+    if (!deleted) {
+      rawIndices[numPassed++] = row;
+    }
+  }
+  if (numPassed == numRows) {
+    return;
+  }
+
+  std::vector<VectorPtr> children;
+  children.reserve(rowVector->childrenSize());
+  for (const auto& child : rowVector->children()) {
+    children.push_back(
+        BaseVector::wrapInDictionary(nullptr, indices, numPassed, child));
+  }
+  output = std::make_shared<RowVector>(
+      pool, rowVector->type(), nullptr, numPassed, std::move(children));
+}
+
 uint64_t IcebergSplitReader::next(uint64_t size, VectorPtr& output) {
   Mutation mutation;
   mutation.randomSkip = baseReaderOpts_.randomSkip().get();
@@ -155,6 +312,10 @@ uint64_t IcebergSplitReader::next(uint64_t size, VectorPtr& output) {
   baseReadOffset_ += rowsScanned;
   deleteBitmapBitOffset_ = rowsScanned;
 
+  if (!equalityDeletes_.empty() && output->size() > 0) {
+    applyEqualityDeletes(output);
+  }
+
   return rowsScanned;
 }
 
@@ -18,6 +18,7 @@
 
 #include "velox/connectors/Connector.h"
 #include "velox/connectors/hive/SplitReader.h"
+#include "velox/connectors/hive/iceberg/EqualityDeleteFileReader.h"
 #include "velox/connectors/hive/iceberg/PositionalDeleteFileReader.h"
 
 namespace facebook::velox::connector::hive::iceberg {
@@ -40,7 +41,8 @@ class IcebergSplitReader : public SplitReader {
       folly::Executor* executor,
       const std::shared_ptr<common::ScanSpec>& scanSpec);
 
-  ~IcebergSplitReader() override = default;
+  /// Restores the filters the equality deletes were pushed down into.
+  ~IcebergSplitReader() override;
 
   void prepareSplit(
       std::shared_ptr<common::MetadataFilter> metadataFilter,
@@ -48,7 +50,37 @@ class IcebergSplitReader : public SplitReader {
 
   uint64_t next(uint64_t size, VectorPtr& output) override;
 
+  /// Returns nullptr if the split has deletes.
+  RowVectorPtr aggregateFromMetadata(
+      const std::vector<MetadataAggregate>& aggregates) const override;
+
+  void onDynamicFilter(
+      const common::ScanSpec& fieldSpec,
+      const common::Filter& filter) override;
+
  private:
+  // Reads the equality delete files of the split. The deletes on a single
+  // integer or string column that is read are pushed down as a filter on the
+  // column. The others are applied to the batches read. Must be called before
+  // the row reader is created.
+  void prepareEqualityDeletes(
+      const std::vector<IcebergDeleteFile>& deleteFiles);
+
+  // Adds 'filter' to the filter of 'spec' for the split.
+  void pushDownDeletes(common::ScanSpec& spec, const common::Filter& filter);
+
+  // Removes the rows of 'output' that match 'equalityDeletes_'.
+  void applyEqualityDeletes(VectorPtr& output);
+
+  // The column specs that have the equality deletes of the split pushed down
+  // into their filter, with their filter from before the split.
+  std::vector<std::pair<common::ScanSpec*, std::unique_ptr<common::Filter>>>
+      pushedDownFilters_;
+  // The equality deletes of the split that are applied to the batches read,
+  // with the channels of their columns in the batches.
+  std::vector<std::pair<EqualityDeletesPtr, std::vector<column_index_t>>>
+      equalityDeletes_;
+
   // The read offset to the beginning of the split in number of rows for the
   // current batch for the base data file
   uint64_t baseReadOffset_;
@@ -16,6 +16,8 @@
 
 #include "velox/connectors/hive/iceberg/PositionalDeleteFileReader.h"
 
+#include <algorithm>
+
 #include "velox/connectors/hive/HiveConnectorUtil.h"
 #include "velox/connectors/hive/TableHandle.h"
 #include "velox/connectors/hive/iceberg/IcebergDeleteFile.h"
@@ -24,6 +26,114 @@
 
 namespace facebook::velox::connector::hive::iceberg {
 
+namespace {
+
+constexpr uint64_t kBatchSize = 10'000;
+
+struct PositionalDeletesGenerator {
+  std::unique_ptr<PositionalDeletes> operator()(
+      const std::string& /*key*/,
+      const PositionalDeleteFileReader* reader,
+      dwio::common::RuntimeStatistics* runtimeStats) {
+    return reader->readDeletes(*runtimeStats);
+  }
+};
+
+using PositionalDeletesFactory = CachedFactory<
+    std::string,
+    PositionalDeletes,
+    PositionalDeletesGenerator,
+    PositionalDeleteFileReader,
+    dwio::common::RuntimeStatistics,
+    PositionalDeletesSizer>;
+
+// Keeps up to 256MB of positions of the delete files read recently. Delete
+// files do not change, so the entries are shared by all queries. The ones in
+// use by a split are pinned.
+PositionalDeletesFactory& deletesFactory() {
+  static PositionalDeletesFactory factory(
+      std::make_unique<SimpleLRUCache<std::string, PositionalDeletes>>(
+          256 << 20),
+      std::make_unique<PositionalDeletesGenerator>());
+  return factory;
+}
+
+} // namespace
+
+PositionalDeletes::PositionalDeletes(std::vector<int64_t> positions) {
+  std::sort(positions.begin(), positions.end());
+  positions.erase(
+      std::unique(positions.begin(), positions.end()), positions.end());
+  VELOX_CHECK(
+      positions.empty() || positions.front() >= 0,
+      "Iceberg delete file pos column cannot be negative");
+  for (size_t begin = 0; begin < positions.size();) {
+    Chunk chunk;
+    chunk.firstRow = positions[begin] & ~static_cast<int64_t>(kChunkSize - 1);
+    auto end = begin;
+    while (end < positions.size() &&
+           positions[end] < chunk.firstRow + kChunkSize) {
+      ++end;
+    }
+    if (end - begin <= kMaxSparsePositions) {
+      chunk.offsets.reserve(end - begin);
+      for (auto i = begin; i < end; ++i) {
+        chunk.offsets.push_back(positions[i] - chunk.firstRow);
+      }
+      sizeInBytes_ += chunk.offsets.size() * sizeof(uint16_t);
+    } else {
+      chunk.bits.resize(bits::nwords(kChunkSize));
+      for (auto i = begin; i < end; ++i) {
+        bits::setBit(chunk.bits.data(), positions[i] - chunk.firstRow);
+      }
+      sizeInBytes_ += chunk.bits.size() * sizeof(uint64_t);
+    }
+    chunks_.push_back(std::move(chunk));
+    begin = end;
+  }
+  if (!positions.empty()) {
+    maxPosition_ = positions.back();
+  }
+  sizeInBytes_ += sizeof(*this) + chunks_.size() * sizeof(Chunk);
+}
+
+int64_t PositionalDeletes::setBits(int64_t begin, int64_t end, uint8_t* bits)
+    const {
+  int64_t lastPosition = -1;
+  // The first chunk that may have positions at or after 'begin'.
+  auto it = std::upper_bound(
+      chunks_.begin(),
+      chunks_.end(),
+      begin,
+      [](int64_t row, const Chunk& chunk) { return row < chunk.firstRow; });
+  if (it != chunks_.begin()) {
+    --it;
+  }
+  for (; it != chunks_.end() && it->firstRow < end; ++it) {
+    const int32_t from = std::max(begin, it->firstRow) - it->firstRow;
+    const int32_t to =
+        std::min(end, it->firstRow + kChunkSize) - it->firstRow;
+    if (from >= to) {
+      continue;
+    }
+    const auto setBit = [&](int32_t offset) {
+      lastPosition = it->firstRow + offset;
+      bits::setBit(bits, lastPosition - begin);
+    };
+    if (it->bits.empty()) {
+      for (auto offset = std::lower_bound(
+               it->offsets.begin(), it->offsets.end(), from);
+           offset != it->offsets.end() && *offset < to;
+           ++offset) {
+        setBit(*offset);
+      }
+    } else {
+      bits::forEachSetBit(it->bits.data(), from, to, setBit);
+    }
+  }
+  return lastPosition;
+}
+
 PositionalDeleteFileReader::PositionalDeleteFileReader(
     const IcebergDeleteFile& deleteFile,
     const std::string& baseFilePath,
@@ -39,25 +149,28 @@ PositionalDeleteFileReader::PositionalDeleteFileReader(
     : deleteFile_(deleteFile),
       baseFilePath_(baseFilePath),
       fileHandleFactory_(fileHandleFactory),
+      connectorQueryCtx_(connectorQueryCtx),
       executor_(executor),
       hiveConfig_(hiveConfig),
       ioStats_(ioStats),
       fsStats_(fsStats),
       pool_(connectorQueryCtx->memoryPool()),
+      connectorId_(connectorId),
       filePathColumn_(IcebergMetadataColumn::icebergDeleteFilePathColumn()),
       posColumn_(IcebergMetadataColumn::icebergDeletePosColumn()),
-      splitOffset_(splitOffset),
-      deleteSplit_(nullptr),
-      deleteRowReader_(nullptr),
-      deletePositionsOutput_(nullptr),
-      deletePositionsOffset_(0),
-      totalNumRowsScanned_(0) {
+      splitOffset_(splitOffset) {
   VELOX_CHECK(deleteFile_.content == FileContent::kPositionalDeletes);
   VELOX_CHECK(deleteFile_.recordCount);
 
-  // TODO: check if the lowerbounds and upperbounds in deleteFile overlap with
-  //  this batch. If not, no need to proceed.
+  // The splits of the base file share the positions read by the first one.
+  deletes_ = deletesFactory().generate(
+      fmt::format("{}\n{}", deleteFile_.filePath, baseFilePath_),
+      this,
+      &runtimeStats);
+}
 
+std::unique_ptr<PositionalDeletes> PositionalDeleteFileReader::readDeletes(
+    dwio::common::RuntimeStatistics& runtimeStats) const {
   // Create the ScanSpec for this delete file
   auto scanSpec = std::make_shared<common::ScanSpec>("<root>");
   scanSpec->addField(posColumn_->name, 0);
@@ -73,8 +186,8 @@ PositionalDeleteFileReader::PositionalDeleteFileReader(
   RowTypePtr deleteFileSchema =
       ROW(std::move(deleteColumnNames), std::move(deleteColumnTypes));
 
-  deleteSplit_ = std::make_shared<HiveConnectorSplit>(
-      connectorId,
+  auto deleteSplit = std::make_shared<HiveConnectorSplit>(
+      connectorId_,
       deleteFile_.filePath,
       deleteFile_.fileFormat,
       0,
@@ -85,9 +198,9 @@ PositionalDeleteFileReader::PositionalDeleteFileReader(
   dwio::common::ReaderOptions deleteReaderOpts(pool_);
   configureReaderOptions(
       hiveConfig_,
-      connectorQueryCtx,
+      connectorQueryCtx_,
       deleteFileSchema,
-      deleteSplit_,
+      deleteSplit,
       /*tableParameters=*/{},
       deleteReaderOpts);
 
@@ -96,7 +209,7 @@ PositionalDeleteFileReader::PositionalDeleteFileReader(
   auto deleteFileInput = createBufferedInput(
       *deleteFileHandleCachePtr,
       deleteReaderOpts,
-      connectorQueryCtx,
+      connectorQueryCtx_,
       ioStats_,
       fsStats_,
       executor_);
@@ -106,21 +219,18 @@ PositionalDeleteFileReader::PositionalDeleteFileReader(
           ->createReader(std::move(deleteFileInput), deleteReaderOpts);
 
   // Check if the whole delete file split can be skipped. This could happen when
-  // 1) the delete file doesn't contain the base file that is being read; 2) The
-  // delete file does not contain the positions in the current batch for the
-  // base file.
+  // the delete file doesn't contain the base file that is being read.
   if (!testFilters(
           scanSpec.get(),
           deleteReader.get(),
-          deleteSplit_->filePath,
-          deleteSplit_->partitionKeys,
+          deleteSplit->filePath,
+          deleteSplit->partitionKeys,
           {})) {
     // We only count the number of base splits skipped as skippedSplits runtime
     // statistics in Velox.  Skipped delta split is only counted as skipped
     // bytes.
-    runtimeStats.skippedSplitBytes += deleteSplit_->length;
-    deleteSplit_.reset();
-    return;
+    runtimeStats.skippedSplitBytes += deleteSplit->length;
+    return std::make_unique<PositionalDeletes>(std::vector<int64_t>{});
   }
 
   dwio::common::RowReaderOptions deleteRowReaderOpts;
@@ -129,158 +239,59 @@ PositionalDeleteFileReader::PositionalDeleteFileReader(
       scanSpec,
       nullptr,
       deleteFileSchema,
-      deleteSplit_,
+      deleteSplit,
       nullptr,
       nullptr,
       deleteRowReaderOpts);
+  auto deleteRowReader = deleteReader->createRowReader(deleteRowReaderOpts);
 
-  deleteRowReader_.reset();
-  deleteRowReader_ = deleteReader->createRowReader(deleteRowReaderOpts);
-}
-
-void PositionalDeleteFileReader::readDeletePositions(
-    uint64_t baseReadOffset,
-    uint64_t size,
-    BufferPtr deleteBitmapBuffer) {
-  // We are going to read to the row number up to the end of the batch. For the
-  // same base file, the deleted rows are in ascending order in the same delete
-  // file. rowNumberUpperBound is the upperbound for the row number in this
-  // batch, excluding boundaries
-  int64_t rowNumberUpperBound = splitOffset_ + baseReadOffset + size;
-
-  // Finish unused delete positions from last batch. Note that at this point we
-  // don't know how many rows the base row reader would scan yet.
-  if (deletePositionsOutput_ &&
-      deletePositionsOffset_ < deletePositionsOutput_->size()) {
-    updateDeleteBitmap(
-        std::dynamic_pointer_cast<RowVector>(deletePositionsOutput_)
-            ->childAt(0),
-        baseReadOffset,
-        rowNumberUpperBound,
-        deleteBitmapBuffer);
-
-    if (readFinishedForBatch(rowNumberUpperBound)) {
-      return;
-    }
-  }
-
-  if (!deleteRowReader_ || !deleteSplit_) {
-    return;
-  }
-
-  // Read the new delete positions for this batch into deletePositionsOutput_
-  // and update the delete bitmap
-
-  auto outputType = posColumn_->type;
   RowTypePtr outputRowType = ROW({posColumn_->name}, {posColumn_->type});
-  if (!deletePositionsOutput_) {
-    deletePositionsOutput_ = BaseVector::create(outputRowType, 0, pool_);
-  }
-
-  do {
-    auto rowsScanned = deleteRowReader_->next(size, deletePositionsOutput_);
-    totalNumRowsScanned_ += rowsScanned;
-
-    if (rowsScanned > 0) {
-      VELOX_CHECK(
-          !deletePositionsOutput_->mayHaveNulls(),
-          "Iceberg delete file pos column cannot have nulls");
-
-      auto numDeletedRows = deletePositionsOutput_->size();
-      if (numDeletedRows > 0) {
-        deletePositionsOutput_->loadedVector();
-        deletePositionsOffset_ = 0;
-
-        // Convert the row numbers to set bits, up to rowNumberUpperBound.
-        // Beyond that the buffer of deleteBitMap is not available.
-        updateDeleteBitmap(
-            std::dynamic_pointer_cast<RowVector>(deletePositionsOutput_)
-                ->childAt(0),
-            baseReadOffset,
-            rowNumberUpperBound,
-            deleteBitmapBuffer);
-      }
-    } else {
-      // Reaching the end of the file
-      deleteSplit_.reset();
-      break;
+  VectorPtr output = BaseVector::create(outputRowType, 0, pool_);
+  std::vector<int64_t> positions;
+  while (deleteRowReader->next(kBatchSize, output) > 0) {
+    if (output->size() == 0) {
+      continue;
     }
-  } while (!readFinishedForBatch(rowNumberUpperBound));
-}
-
-bool PositionalDeleteFileReader::noMoreData() {
-  return totalNumRowsScanned_ >= deleteFile_.recordCount &&
-      deletePositionsOutput_ &&
-      deletePositionsOffset_ >= deletePositionsOutput_->size();
+    output->loadedVector();
+    auto positionsVector =
+        std::dynamic_pointer_cast<RowVector>(output)->childAt(0);
+    VELOX_CHECK(
+        !positionsVector->mayHaveNulls(),
+        "Iceberg delete file pos column cannot have nulls");
+    const int64_t* rawPositions =
+        positionsVector->as<FlatVector<int64_t>>()->rawValues();
+    positions.insert(
+        positions.end(), rawPositions, rawPositions + positionsVector->size());
+  }
+  return std::make_unique<PositionalDeletes>(std::move(positions));
 }
 
-void PositionalDeleteFileReader::updateDeleteBitmap(
-    VectorPtr deletePositionsVector,
+void PositionalDeleteFileReader::readDeletePositions(
     uint64_t baseReadOffset,
-    int64_t rowNumberUpperBound,
+    uint64_t size,
     BufferPtr deleteBitmapBuffer) {
-  auto deleteBitmap = deleteBitmapBuffer->asMutable<uint8_t>();
-
-  // Convert the positions in file into positions relative to the start of the
-  // split.
-  const int64_t* deletePositions =
-      deletePositionsVector->as<FlatVector<int64_t>>()->rawValues();
-  int64_t rowNumberLowerBound = baseReadOffset + splitOffset_;
-
-  // If the rowNumberLowerBound is greater than the last position in this delete
-  // rows batch, nothing to delete.
-  if (rowNumberLowerBound >
-      deletePositions[deletePositionsVector->size() - 1]) {
+  // The positions are relative to the start of the base file. Bit 0 of the
+  // bitmap is the first row of the batch.
+  const int64_t rowNumberLowerBound = splitOffset_ + baseReadOffset;
+  readEnd_ = baseReadOffset + size;
+  const auto lastPosition = deletes_->setBits(
+      rowNumberLowerBound,
+      rowNumberLowerBound + size,
+      deleteBitmapBuffer->asMutable<uint8_t>());
+  if (lastPosition < 0) {
     return;
   }
 
-  // Skip the delete positions in deletePositionsVector until they are in the
-  // [rowNumberLowerBound, rowNumberUpperBound) range.
-  while (deletePositionsOffset_ < deletePositionsVector->size() &&
-         deletePositions[deletePositionsOffset_] < rowNumberLowerBound) {
-    deletePositionsOffset_++;
-  }
-  while (deletePositionsOffset_ < deletePositionsVector->size() &&
-         deletePositions[deletePositionsOffset_] < rowNumberUpperBound) {
-    bits::setBit(
-        deleteBitmap,
-        deletePositions[deletePositionsOffset_] - rowNumberLowerBound);
-    deletePositionsOffset_++;
-  }
-
   // There might be multiple delete files for a single base file. The size of
   // the deleteBitmapBuffer should be the largest position among all delte files
-  deleteBitmapBuffer->setSize(std::max(
-      static_cast<uint64_t>(deleteBitmapBuffer->size()),
-      deletePositionsOffset_ == 0 ||
-              (deletePositionsOffset_ < deletePositionsVector->size() &&
-               deletePositions[deletePositionsOffset_] >= rowNumberUpperBound)
-          ? 0
-          : bits::nbytes(
-                deletePositions[deletePositionsOffset_ - 1] + 1 -
-                rowNumberLowerBound)));
+  deleteBitmapBuffer->setSize(std::max<uint64_t>(
+      deleteBitmapBuffer->size(),
+      bits::nbytes(lastPosition + 1 - rowNumberLowerBound)));
 }
 
-bool PositionalDeleteFileReader::readFinishedForBatch(
-    int64_t rowNumberUpperBound) {
-  VELOX_CHECK_NOT_NULL(deletePositionsOutput_);
-
-  auto deletePositionsVector =
-      std::dynamic_pointer_cast<RowVector>(deletePositionsOutput_)->childAt(0);
-  const int64_t* deletePositions =
-      deletePositionsVector->as<FlatVector<int64_t>>()->rawValues();
-
-  // We've read enough of the delete positions from this delete file when 1) it
-  // reaches the end of the file, or 2) the last read delete position is greater
-  // than the largest base file row number that is going to be read in this
-  // batch
-  if (totalNumRowsScanned_ >= deleteFile_.recordCount ||
-      (deletePositionsVector->size() != 0 &&
-       (deletePositionsOffset_ < deletePositionsVector->size() &&
-        deletePositions[deletePositionsOffset_] >= rowNumberUpperBound))) {
-    return true;
-  }
-  return false;
+bool PositionalDeleteFileReader::noMoreData() {
+  return deletes_->maxPosition() <
+      static_cast<int64_t>(splitOffset_ + readEnd_);
 }
 
 } // namespace facebook::velox::connector::hive::iceberg
@@ -19,6 +19,7 @@
 #include <folly/Executor.h>
 #include <memory>
 
+#include "velox/common/caching/CachedFactory.h"
 #include "velox/connectors/Connector.h"
 #include "velox/connectors/hive/FileHandle.h"
 #include "velox/connectors/hive/HiveConfig.h"
@@ -30,6 +31,57 @@ namespace facebook::velox::connector::hive::iceberg {
 struct IcebergDeleteFile;
 struct IcebergMetadataColumn;
 
+/// The positions a positional delete file deletes from one base file, kept in
+/// chunks of 64K rows. A chunk with few positions keeps their 16 bit offsets,
+/// a denser one keeps a bitmap, like roaring bitmaps do.
+class PositionalDeletes {
+ public:
+  /// 'positions' need not be sorted.
+  explicit PositionalDeletes(std::vector<int64_t> positions);
+
+  /// Sets the bits of the positions in [begin, end) in 'bits', bit 0 being
+  /// 'begin'. Returns the last position set, or -1 if none.
+  int64_t setBits(int64_t begin, int64_t end, uint8_t* bits) const;
+
+  /// The largest position, or -1 if there are none.
+  int64_t maxPosition() const {
+    return maxPosition_;
+  }
+
+  uint64_t sizeInBytes() const {
+    return sizeInBytes_;
+  }
+
+ private:
+  static constexpr int32_t kChunkBits = 16;
+  static constexpr int32_t kChunkSize = 1 << kChunkBits;
+  // Chunks with more positions keep a bitmap, which takes the same memory.
+  static constexpr int32_t kMaxSparsePositions = kChunkSize / 16;
+
+  struct Chunk {
+    // The position of the first row of the chunk.
+    int64_t firstRow;
+    // The sorted offsets from 'firstRow' if the chunk is sparse.
+    std::vector<uint16_t> offsets;
+    // The bitmap of the offsets if the chunk is dense.
+    std::vector<uint64_t> bits;
+  };
+
+  std::vector<Chunk> chunks_;
+  int64_t maxPosition_{-1};
+  uint64_t sizeInBytes_{0};
+};
+
+struct PositionalDeletesSizer {
+  uint64_t operator()(const PositionalDeletes& deletes) const {
+    return deletes.sizeInBytes();
+  }
+};
+
+/// Reads the positions of a positional delete file that delete rows of one
+/// base file. The positions are cached for the delete file and the base file,
+/// so that the splits of a base file read the delete file once and only take
+/// the positions in their row range.
 class PositionalDeleteFileReader {
  public:
   PositionalDeleteFileReader(
@@ -52,42 +104,30 @@ class PositionalDeleteFileReader {
 
   bool noMoreData();
 
- private:
-  void updateDeleteBitmap(
-      VectorPtr deletePositionsVector,
-      uint64_t baseReadOffset,
-      int64_t rowNumberUpperBound,
-      BufferPtr deleteBitmapBuffer);
-
-  bool readFinishedForBatch(int64_t rowNumberUpperBound);
+  /// Reads the positions of the whole delete file for the base file.
+  std::unique_ptr<PositionalDeletes> readDeletes(
+      dwio::common::RuntimeStatistics& runtimeStats) const;
 
+ private:
   const IcebergDeleteFile& deleteFile_;
   const std::string& baseFilePath_;
   FileHandleFactory* const fileHandleFactory_;
+  const ConnectorQueryCtx* const connectorQueryCtx_;
   folly::Executor* const executor_;
   const std::shared_ptr<const HiveConfig> hiveConfig_;
   const std::shared_ptr<io::IoStatistics> ioStats_;
   const std::shared_ptr<filesystems::File::IoStats> fsStats_;
-  const std::shared_ptr<filesystems::File::IoStats> fsStats;
   memory::MemoryPool* const pool_;
+  const std::string connectorId_;
 
   std::shared_ptr<IcebergMetadataColumn> filePathColumn_;
   std::shared_ptr<IcebergMetadataColumn> posColumn_;
   uint64_t splitOffset_;
 
-  std::shared_ptr<HiveConnectorSplit> deleteSplit_;
-  std::unique_ptr<dwio::common::RowReader> deleteRowReader_;
-  // The vector to hold the delete positions read from the positional delete
-  // file. These positions are relative to the start of the whole base data
-  // file.
-  VectorPtr deletePositionsOutput_;
-  // The index of deletePositionsOutput_ that indicates up to where the delete
-  // positions have been converted into the bitmap
-  uint64_t deletePositionsOffset_;
-  // Total number of rows read from this positional delete file reader,
-  // including the rows filtered out from filters on both filePathColumn_ and
-  // posColumn_.
-  uint64_t totalNumRowsScanned_;
+  CachedPtr<std::string, PositionalDeletes> deletes_;
+  // The end of the row numbers relative to the split of the last
+  // readDeletePositions().
+  uint64_t readEnd_{0};
 };
 
 } // namespace facebook::velox::connector::hive::iceberg
@@ -775,4 +775,72 @@ TEST_F(HiveIcebergTest, testPartitionedRead) {
 
   HiveConnectorTestBase::assertQuery(plan, splits, "SELECT 0, '2018-04-06'");
 }
+
+TEST_F(HiveIcebergTest, equalityDeletes) {
+  folly::SingletonVault::singleton()->registrationComplete();
+
+  constexpr int32_t kNumRows = 1'000;
+  auto data = makeRowVector(
+      {"c0", "c1"},
+      {makeFlatVector<int64_t>(kNumRows, [](auto row) { return row; }),
+       makeFlatVector<std::string>(
+           kNumRows, [](auto row) { return std::to_string(row % 10); })});
+  auto dataFilePath = TempFilePath::create();
+  writeToFile(dataFilePath->getPath(), {data}, config_, flushPolicyFactory_);
+  createDuckDbTable({data});
+
+  const auto writeDeleteFile = [&](const RowVectorPtr& deletes,
+                                   std::vector<int32_t> fieldIds) {
+    auto path = TempFilePath::create();
+    writeToFile(path->getPath(), deletes);
+    IcebergDeleteFile deleteFile(
+        FileContent::kEqualityDeletes,
+        path->getPath(),
+        dwio::common::FileFormat::DWRF,
+        deletes->size(),
+        testing::internal::GetFileSize(
+            std::fopen(path->getPath().c_str(), "r")),
+        std::move(fieldIds));
+    return std::make_pair(path, deleteFile);
+  };
+
+  // Deletes on c0 alone are pushed down into the scan as a filter.
+  auto [c0Path, c0Deletes] = writeDeleteFile(
+      makeRowVector(
+          {"c0"},
+          {makeFlatVector<int64_t>(
+              kNumRows / 7, [](auto row) { return row * 7; })}),
+      {1});
+  // Deletes on c0 and c1 are applied to the rows read. Only (3, '3') and
+  // (25, '5') match a row.
+  auto [c0c1Path, c0c1Deletes] = writeDeleteFile(
+      makeRowVector(
+          {"c0", "c1"},
+          {makeFlatVector<int64_t>({3, 25, 4}),
+           makeFlatVector<std::string>({"3", "5", "5"})}),
+      {1, 2});
+
+  auto splits =
+      makeIcebergSplits(dataFilePath->getPath(), {c0Deletes, c0c1Deletes});
+  const auto rowType = ROW({"c0", "c1"}, {BIGINT(), VARCHAR()});
+  const std::string notDeleted =
+      "c0 % 7 <> 0 AND NOT (c0 = 3 AND c1 = '3') "
+      "AND NOT (c0 = 25 AND c1 = '5')";
+  assertQuery(
+      PlanBuilder(pool_.get()).tableScan(rowType).planNode(),
+      splits,
+      "SELECT * FROM tmp WHERE " + notDeleted);
+
+  // The pushed down deletes are merged with the filter of the query, which is
+  // restored for the next split.
+  auto plan =
+      PlanBuilder(pool_.get()).tableScan(rowType, {"c0 < 500"}).planNode();
+  auto noDeleteSplits = makeIcebergSplits(dataFilePath->getPath());
+  splits.insert(splits.end(), noDeleteSplits.begin(), noDeleteSplits.end());
+  assertQuery(
+      plan,
+      splits,
+      "SELECT * FROM tmp WHERE c0 < 500 AND " + notDeleted +
+          " UNION ALL SELECT * FROM tmp WHERE c0 < 500");
+}
 } // namespace facebook::velox::connector::hive::iceberg
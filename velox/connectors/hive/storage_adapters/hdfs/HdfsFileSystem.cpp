@@ -15,6 +15,7 @@
  */
 #include "velox/connectors/hive/storage_adapters/hdfs/HdfsFileSystem.h"
 #include "velox/common/config/Config.h"
+#include "velox/connectors/hive/HiveConfig.h"
 #include "velox/connectors/hive/storage_adapters/hdfs/HdfsReadFile.h"
 #include "velox/connectors/hive/storage_adapters/hdfs/HdfsWriteFile.h"
 #include "velox/external/hdfs/ArrowHdfsInternal.h"
@@ -26,10 +27,11 @@ std::string_view HdfsFileSystem::kViewfsScheme("viewfs://");
 
 class HdfsFileSystem::Impl {
  public:
-  // Keep config here for possible use in the future.
   explicit Impl(
       const config::ConfigBase* config,
       const HdfsServiceEndpoint& endpoint) {
+    const connector::hive::HiveConfig hiveConfig(
+        std::make_shared<config::ConfigBase>(config->rawConfigsCopy()));
     auto status = filesystems::arrow::io::internal::ConnectLibHdfs(&driver_);
     if (!status.ok()) {
       LOG(ERROR) << "ConnectLibHdfs failed due to: " << status.ToString();
@@ -47,6 +49,7 @@ class HdfsFileSystem::Impl {
       driver_->BuilderSetNameNodePort(builder, atoi(endpoint.port.data()));
     }
     driver_->BuilderSetForceNewInstance(builder);
+    setReadOptions(hiveConfig, builder);
     hdfsClient_ = driver_->BuilderConnect(builder);
     VELOX_CHECK_NOT_NULL(
         hdfsClient_,
@@ -72,7 +75,45 @@ class HdfsFileSystem::Impl {
     return driver_;
   }
 
+  bool hedgedReadEnabled() const {
+    return hedgedReadEnabled_;
+  }
+
  private:
+  // Sets the HDFS client options for short-circuit and hedged reads.
+  void setReadOptions(
+      const connector::hive::HiveConfig& hiveConfig,
+      hdfsBuilder* builder) {
+    const auto setOption = [&](const char* key, const std::string& value) {
+      VELOX_CHECK_EQ(
+          driver_->BuilderConfSetStr(builder, key, value.c_str()),
+          0,
+          "Unable to set HDFS client option {} to {}",
+          key,
+          value);
+    };
+    if (hiveConfig.hdfsShortCircuitReadEnabled()) {
+      const auto socketPath = hiveConfig.hdfsDomainSocketPath();
+      VELOX_USER_CHECK(
+          !socketPath.empty(),
+          "{} is required for HDFS short-circuit reads",
+          connector::hive::HiveConfig::kHdfsDomainSocketPath);
+      setOption("dfs.client.read.shortcircuit", "true");
+      setOption("dfs.domain.socket.path", socketPath);
+    }
+    const auto hedgedReadThreads = hiveConfig.hdfsHedgedReadThreadPoolSize();
+    if (hedgedReadThreads > 0) {
+      setOption(
+          "dfs.client.hedged.read.threadpool.size",
+          std::to_string(hedgedReadThreads));
+      setOption(
+          "dfs.client.hedged.read.threshold.millis",
+          std::to_string(hiveConfig.hdfsHedgedReadThresholdMs()));
+      hedgedReadEnabled_ = true;
+    }
+  }
+
+  bool hedgedReadEnabled_{false};
   hdfsFS hdfsClient_;
   filesystems::arrow::io::internal::LibHdfsShim* driver_;
 };
@@ -99,7 +140,10 @@ std::unique_ptr<ReadFile> HdfsFileSystem::openFileForRead(
     }
   }
   return std::make_unique<HdfsReadFile>(
-      impl_->hdfsShim(), impl_->hdfsClient(), path);
+      impl_->hdfsShim(),
+      impl_->hdfsClient(),
+      path,
+      /*positionalRead=*/impl_->hedgedReadEnabled());
 }
 
 std::unique_ptr<WriteFile> HdfsFileSystem::openFileForWrite(
@@ -15,6 +15,7 @@
  */
 
 #include "HdfsReadFile.h"
+#include "velox/common/time/Timer.h"
 #include "velox/external/hdfs/ArrowHdfsInternal.h"
 
 namespace facebook::velox {
@@ -58,6 +59,15 @@ struct HdfsFile {
     VELOX_CHECK(bytesRead >= 0, "Read failure in HDFSReadFile::preadInternal.");
     return bytesRead;
   }
+
+  int32_t pread(uint64_t offset, char* pos, uint64_t length) const {
+    auto bytesRead = driver_->Pread(client_, handle_, offset, pos, length);
+    VELOX_CHECK(
+        bytesRead >= 0,
+        "Positional read failure in HDFSReadFile::preadInternal: {}",
+        driver_->GetLastExceptionRootCause());
+    return bytesRead;
+  }
 };
 
 class HdfsReadFile::Impl {
@@ -65,8 +75,12 @@ class HdfsReadFile::Impl {
   Impl(
       filesystems::arrow::io::internal::LibHdfsShim* driver,
       hdfsFS hdfs,
-      const std::string_view path)
-      : driver_(driver), hdfsClient_(hdfs), filePath_(path) {
+      const std::string_view path,
+      bool positionalRead)
+      : driver_(driver),
+        hdfsClient_(hdfs),
+        filePath_(path),
+        positionalRead_(positionalRead && driver_->HasPread()) {
     fileInfo_ = driver_->GetPathInfo(hdfsClient_, filePath_.data());
     if (fileInfo_ == nullptr) {
       auto error = fmt::format(
@@ -89,29 +103,53 @@ class HdfsReadFile::Impl {
     }
   }
 
-  void preadInternal(uint64_t offset, uint64_t length, char* pos) const {
+  void preadInternal(
+      uint64_t offset,
+      uint64_t length,
+      char* pos,
+      filesystems::File::IoStats* stats) const {
     checkFileReadParameters(offset, length);
     if (!file_->handle_) {
       file_->open(driver_, hdfsClient_, filePath_);
     }
-    file_->seek(offset);
-    uint64_t totalBytesRead = 0;
-    while (totalBytesRead < length) {
-      auto bytesRead = file_->read(pos, length - totalBytesRead);
-      totalBytesRead += bytesRead;
-      pos += bytesRead;
+    uint64_t readTimeNs{0};
+    {
+      NanosecondTimer timer(&readTimeNs);
+      if (!positionalRead_) {
+        file_->seek(offset);
+      }
+      uint64_t totalBytesRead = 0;
+      while (totalBytesRead < length) {
+        const auto remaining = length - totalBytesRead;
+        auto bytesRead = positionalRead_
+            ? file_->pread(offset + totalBytesRead, pos, remaining)
+            : file_->read(pos, remaining);
+        totalBytesRead += bytesRead;
+        pos += bytesRead;
+      }
+    }
+    if (stats != nullptr) {
+      stats->addCounter(
+          kReadTime, RuntimeCounter(readTimeNs, RuntimeCounter::Unit::kNanos));
     }
   }
 
-  std::string_view pread(uint64_t offset, uint64_t length, void* buf) const {
-    preadInternal(offset, length, static_cast<char*>(buf));
+  std::string_view pread(
+      uint64_t offset,
+      uint64_t length,
+      void* buf,
+      filesystems::File::IoStats* stats) const {
+    preadInternal(offset, length, static_cast<char*>(buf), stats);
     return {static_cast<char*>(buf), length};
   }
 
-  std::string pread(uint64_t offset, uint64_t length) const {
+  std::string pread(
+      uint64_t offset,
+      uint64_t length,
+      filesystems::File::IoStats* stats) const {
     std::string result(length, 0);
     char* pos = result.data();
-    preadInternal(offset, length, pos);
+    preadInternal(offset, length, pos, stats);
     return result;
   }
 
@@ -144,9 +182,13 @@ class HdfsReadFile::Impl {
   }
 
  private:
+  // The name of the stat with the wall time of the reads from HDFS.
+  static constexpr const char* kReadTime = "hdfsReadWallNanos";
+
   filesystems::arrow::io::internal::LibHdfsShim* driver_;
   hdfsFS hdfsClient_;
   std::string filePath_;
+  const bool positionalRead_;
   hdfsFileInfo* fileInfo_;
   folly::ThreadLocal<HdfsFile> file_;
 };
@@ -154,8 +196,9 @@ class HdfsReadFile::Impl {
 HdfsReadFile::HdfsReadFile(
     filesystems::arrow::io::internal::LibHdfsShim* driver,
     hdfsFS hdfs,
-    const std::string_view path)
-    : pImpl(std::make_unique<Impl>(driver, hdfs, path)) {}
+    const std::string_view path,
+    bool positionalRead)
+    : pImpl(std::make_unique<Impl>(driver, hdfs, path, positionalRead)) {}
 
 HdfsReadFile::~HdfsReadFile() = default;
 
@@ -164,14 +207,14 @@ std::string_view HdfsReadFile::pread(
     uint64_t length,
     void* buf,
     filesystems::File::IoStats* stats) const {
-  return pImpl->pread(offset, length, buf);
+  return pImpl->pread(offset, length, buf, stats);
 }
 
 std::string HdfsReadFile::pread(
     uint64_t offset,
     uint64_t length,
     filesystems::File::IoStats* stats) const {
-  return pImpl->pread(offset, length);
+  return pImpl->pread(offset, length, stats);
 }
 
 uint64_t HdfsReadFile::size() const {
@@ -28,10 +28,13 @@ class LibHdfsShim;
  */
 class HdfsReadFile final : public ReadFile {
  public:
+  /// 'positionalRead' reads with hdfsPread() instead of a seek and a read. The
+  /// client issues hedged reads only for positional reads.
   explicit HdfsReadFile(
       filesystems::arrow::io::internal::LibHdfsShim* driver,
       hdfsFS hdfs,
-      std::string_view path);
+      std::string_view path,
+      bool positionalRead = false);
   ~HdfsReadFile() override;
 
   std::string_view pread(
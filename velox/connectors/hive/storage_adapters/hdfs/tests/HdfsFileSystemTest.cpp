@@ -212,6 +212,21 @@ TEST_F(HdfsFileSystemTest, read) {
   readData(&readFile);
 }
 
+TEST_F(HdfsFileSystemTest, positionalRead) {
+  filesystems::arrow::io::internal::LibHdfsShim* driver;
+  auto hdfs = connectHdfsDriver(
+      &driver,
+      std::string(miniCluster->host()),
+      std::string(miniCluster->nameNodePort()));
+  HdfsReadFile readFile(driver, hdfs, kDestinationPath, true);
+  readData(&readFile);
+
+  filesystems::File::IoStats stats;
+  char buffer[10];
+  ASSERT_EQ(readFile.pread(0, 10, &buffer, &stats), "aaaaabbbbb");
+  ASSERT_EQ(stats.stats().at("hdfsReadWallNanos").count, 1);
+}
+
 TEST_F(HdfsFileSystemTest, viaFileSystem) {
   auto config = std::make_shared<const config::ConfigBase>(
       std::unordered_map<std::string, std::string>(configurationValues));
@@ -72,6 +72,11 @@ class S3Config {
     kMaxAttempts,
     kRetryMode,
     kUseProxyFromEnv,
+    kReadThreads,
+    kReadPartSize,
+    kReadParallelParts,
+    kUploadThreads,
+    kUploadParallelParts,
     kEnd
   };
 
@@ -107,7 +112,15 @@ class S3Config {
             {Keys::kMaxAttempts, std::make_pair("max-attempts", std::nullopt)},
             {Keys::kRetryMode, std::make_pair("retry-mode", std::nullopt)},
             {Keys::kUseProxyFromEnv,
-             std::make_pair("use-proxy-from-env", "false")}};
+             std::make_pair("use-proxy-from-env", "false")},
+            {Keys::kReadThreads, std::make_pair("read-threads", "0")},
+            {Keys::kReadPartSize,
+             std::make_pair("read-part-size", "8388608")},
+            {Keys::kReadParallelParts,
+             std::make_pair("read-parallel-parts", "4")},
+            {Keys::kUploadThreads, std::make_pair("upload-threads", "0")},
+            {Keys::kUploadParallelParts,
+             std::make_pair("upload-parallel-parts", "4")}};
     return config;
   }
 
@@ -224,6 +237,39 @@ class S3Config {
     return folly::to<bool>(value);
   }
 
+  /// Number of threads of the file system that read the ranges of
+  /// preadvAsync() as parallel ranged GETs. 0 serves preadvAsync() with a
+  /// synchronous read on the calling thread.
+  uint32_t readThreads() const {
+    auto value = config_.find(Keys::kReadThreads)->second.value();
+    return folly::to<uint32_t>(value);
+  }
+
+  /// Max bytes of a single ranged GET of preadvAsync().
+  uint64_t readPartSize() const {
+    auto value = config_.find(Keys::kReadPartSize)->second.value();
+    return folly::to<uint64_t>(value);
+  }
+
+  /// Max number of ranged GETs in flight for a single file.
+  int32_t readParallelParts() const {
+    auto value = config_.find(Keys::kReadParallelParts)->second.value();
+    return folly::to<int32_t>(value);
+  }
+
+  /// Number of threads of the file system that upload the parts of multipart
+  /// uploads. 0 uploads the parts synchronously on the writer thread.
+  uint32_t uploadThreads() const {
+    auto value = config_.find(Keys::kUploadThreads)->second.value();
+    return folly::to<uint32_t>(value);
+  }
+
+  /// Max number of parts in flight for a single file being written.
+  int32_t uploadParallelParts() const {
+    auto value = config_.find(Keys::kUploadParallelParts)->second.value();
+    return folly::to<int32_t>(value);
+  }
+
   std::string payloadSigningPolicy() const {
     return payloadSigningPolicy_;
   }
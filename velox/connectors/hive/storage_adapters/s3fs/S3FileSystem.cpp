@@ -24,7 +24,11 @@
 #include "velox/connectors/hive/storage_adapters/s3fs/S3WriteFile.h"
 #include "velox/dwio/common/DataBuffer.h"
 
+#include <deque>
 #include <fmt/format.h>
+#include <folly/executors/IOThreadPoolExecutor.h>
+#include <folly/executors/thread_factory/NamedThreadFactory.h>
+#include <folly/futures/Future.h>
 #include <glog/logging.h>
 #include <memory>
 #include <stdexcept>
@@ -254,10 +258,16 @@ class S3WriteFile::Impl {
   explicit Impl(
       std::string_view path,
       Aws::S3::S3Client* client,
-      memory::MemoryPool* pool)
-      : client_(client), pool_(pool) {
+      memory::MemoryPool* pool,
+      folly::Executor* uploadExecutor,
+      int32_t maxParallelParts)
+      : client_(client),
+        pool_(pool),
+        uploadExecutor_(uploadExecutor),
+        maxParallelParts_(maxParallelParts) {
     VELOX_CHECK_NOT_NULL(client);
     VELOX_CHECK_NOT_NULL(pool);
+    VELOX_CHECK_GT(maxParallelParts_, 0);
     getBucketAndKeyFromPath(path, bucket_, key_);
     currentPart_ = std::make_unique<dwio::common::DataBuffer<char>>(*pool_);
     currentPart_->reserve(kPartUploadSize);
@@ -315,6 +325,14 @@ class S3WriteFile::Impl {
     fileSize_ = 0;
   }
 
+  ~Impl() {
+    // The parts in flight reference 'this'.
+    while (!inFlightParts_.empty()) {
+      std::move(inFlightParts_.front().completedPart).wait();
+      inFlightParts_.pop_front();
+    }
+  }
+
   // Appends data to the end of the file.
   void append(std::string_view data) {
     VELOX_CHECK(!closed(), "File is closed");
@@ -341,6 +359,8 @@ class S3WriteFile::Impl {
       return;
     }
     RECORD_METRIC_VALUE(kMetricS3StartedUploads);
+    // The completed parts must be in part number order.
+    waitForParts(0);
     uploadPart({currentPart_->data(), currentPart_->size()}, true);
     VELOX_CHECK_EQ(uploadState_.partNumber, uploadState_.completedParts.size());
     // Complete the multipart upload.
@@ -400,7 +420,7 @@ class S3WriteFile::Impl {
     // Fill-up the remaining currentPart_.
     auto remainingBufferSize = currentPart_->capacity() - currentPart_->size();
     currentPart_->unsafeAppend(dataPtr, remainingBufferSize);
-    uploadPart({currentPart_->data(), currentPart_->size()});
+    uploadCurrentPart();
     dataPtr += remainingBufferSize;
     dataSize -= remainingBufferSize;
     while (dataSize > kPartUploadSize) {
@@ -412,43 +432,103 @@ class S3WriteFile::Impl {
     currentPart_->unsafeAppend(0, dataPtr, dataSize);
   }
 
+  // Uploads the full 'currentPart_'. With an upload executor the buffer moves
+  // to the upload and 'currentPart_' gets a new one.
+  void uploadCurrentPart() {
+    if (uploadExecutor_ == nullptr) {
+      uploadPart({currentPart_->data(), currentPart_->size()});
+      return;
+    }
+    auto buffer = std::move(currentPart_);
+    currentPart_ = std::make_unique<dwio::common::DataBuffer<char>>(*pool_);
+    currentPart_->reserve(kPartUploadSize);
+    uploadPartAsync(std::move(buffer));
+  }
+
   void uploadPart(const std::string_view part, bool isLast = false) {
     // Only the last part can be less than kPartUploadSize.
     VELOX_CHECK(isLast || (!isLast && (part.size() == kPartUploadSize)));
-    // Upload the part.
-    {
-      Aws::S3::Model::UploadPartRequest request;
-      request.SetBucket(bucket_);
-      request.SetKey(key_);
-      request.SetUploadId(uploadState_.id);
-      request.SetPartNumber(++uploadState_.partNumber);
-      request.SetContentLength(part.size());
-      request.SetBody(
-          std::make_shared<StringViewStream>(part.data(), part.size()));
-      // The default algorithm used is MD5. However, MD5 is not supported with
-      // fips and can cause a SIGSEGV. Set CRC32 instead which is a standard for
-      // checksum computation and is not restricted by fips.
-      request.SetChecksumAlgorithm(Aws::S3::Model::ChecksumAlgorithm::CRC32);
-      auto outcome = client_->UploadPart(request);
-      VELOX_CHECK_AWS_OUTCOME(outcome, "Failed to upload", bucket_, key_);
-      // Append ETag and part number for this uploaded part.
-      // This will be needed for upload completion in Close().
-      auto result = outcome.GetResult();
-      Aws::S3::Model::CompletedPart part;
-
-      part.SetPartNumber(uploadState_.partNumber);
-      part.SetETag(result.GetETag());
-      // Don't add the checksum to the part if the checksum is empty.
-      // Some filesystems such as IBM COS require this to be not set.
-      if (!result.GetChecksumCRC32().empty()) {
-        part.SetChecksumCRC32(result.GetChecksumCRC32());
-      }
-      uploadState_.completedParts.push_back(std::move(part));
+    if (uploadExecutor_ != nullptr && !isLast) {
+      // 'part' is only valid during the call.
+      auto buffer =
+          std::make_unique<dwio::common::DataBuffer<char>>(*pool_, part.size());
+      std::memcpy(buffer->data(), part.data(), part.size());
+      uploadPartAsync(std::move(buffer));
+      return;
+    }
+    const auto partNumber = ++uploadState_.partNumber;
+    uploadState_.completedParts.push_back(doUploadPart(part, partNumber));
+  }
+
+  // Uploads 'buffer' on 'uploadExecutor_' after waiting for the oldest part
+  // in flight if 'maxParallelParts_' are in flight.
+  void uploadPartAsync(std::unique_ptr<dwio::common::DataBuffer<char>> buffer) {
+    waitForParts(maxParallelParts_ - 1);
+    const std::string_view part{buffer->data(), buffer->size()};
+    const auto partNumber = ++uploadState_.partNumber;
+    auto completedPart =
+        folly::via(uploadExecutor_, [this, part, partNumber]() {
+          return doUploadPart(part, partNumber);
+        });
+    inFlightParts_.push_back({std::move(buffer), std::move(completedPart)});
+  }
+
+  // Waits for the oldest parts in flight until at most 'maxInFlight' are
+  // left. The buffers of the parts are freed on the writer thread. Throws the
+  // error of a failed part.
+  void waitForParts(int32_t maxInFlight) {
+    while (static_cast<int32_t>(inFlightParts_.size()) > maxInFlight) {
+      auto inFlight = std::move(inFlightParts_.front());
+      inFlightParts_.pop_front();
+      uploadState_.completedParts.push_back(
+          std::move(inFlight.completedPart).get());
     }
   }
 
+  Aws::S3::Model::CompletedPart doUploadPart(
+      const std::string_view part,
+      int64_t partNumber) const {
+    Aws::S3::Model::UploadPartRequest request;
+    request.SetBucket(bucket_);
+    request.SetKey(key_);
+    request.SetUploadId(uploadState_.id);
+    request.SetPartNumber(partNumber);
+    request.SetContentLength(part.size());
+    request.SetBody(
+        std::make_shared<StringViewStream>(part.data(), part.size()));
+    // The default algorithm used is MD5. However, MD5 is not supported with
+    // fips and can cause a SIGSEGV. Set CRC32 instead which is a standard for
+    // checksum computation and is not restricted by fips.
+    request.SetChecksumAlgorithm(Aws::S3::Model::ChecksumAlgorithm::CRC32);
+    auto outcome = client_->UploadPart(request);
+    VELOX_CHECK_AWS_OUTCOME(outcome, "Failed to upload", bucket_, key_);
+    // Append ETag and part number for this uploaded part.
+    // This will be needed for upload completion in Close().
+    auto result = outcome.GetResult();
+    Aws::S3::Model::CompletedPart completedPart;
+
+    completedPart.SetPartNumber(partNumber);
+    completedPart.SetETag(result.GetETag());
+    // Don't add the checksum to the part if the checksum is empty.
+    // Some filesystems such as IBM COS require this to be not set.
+    if (!result.GetChecksumCRC32().empty()) {
+      completedPart.SetChecksumCRC32(result.GetChecksumCRC32());
+    }
+    return completedPart;
+  }
+
+  // A part being uploaded on 'uploadExecutor_'.
+  struct InFlightPart {
+    std::unique_ptr<dwio::common::DataBuffer<char>> buffer;
+    folly::Future<Aws::S3::Model::CompletedPart> completedPart;
+  };
+
   Aws::S3::S3Client* client_;
   memory::MemoryPool* pool_;
+  folly::Executor* const uploadExecutor_;
+  const int32_t maxParallelParts_;
+  // The parts in flight, oldest first.
+  std::deque<InFlightPart> inFlightParts_;
   std::unique_ptr<dwio::common::DataBuffer<char>> currentPart_;
   std::string bucket_;
   std::string key_;
@@ -458,8 +538,11 @@ class S3WriteFile::Impl {
 S3WriteFile::S3WriteFile(
     std::string_view path,
     Aws::S3::S3Client* client,
-    memory::MemoryPool* pool) {
-  impl_ = std::make_shared<Impl>(path, client, pool);
+    memory::MemoryPool* pool,
+    folly::Executor* uploadExecutor,
+    int32_t maxParallelParts) {
+  impl_ = std::make_shared<Impl>(
+      path, client, pool, uploadExecutor, maxParallelParts);
 }
 
 void S3WriteFile::append(std::string_view data) {
@@ -635,10 +718,27 @@ class S3FileSystem::Impl {
 
     client_ = std::make_shared<Aws::S3::S3Client>(
         credentialsProvider, nullptr /* endpointProvider */, clientConfig);
+
+    if (s3Config.readThreads() > 0) {
+      readExecutor_ = std::make_unique<folly::IOThreadPoolExecutor>(
+          s3Config.readThreads(),
+          std::make_shared<folly::NamedThreadFactory>("S3Read"));
+      readPartSize_ = s3Config.readPartSize();
+      readParallelParts_ = s3Config.readParallelParts();
+    }
+    if (s3Config.uploadThreads() > 0) {
+      uploadExecutor_ = std::make_unique<folly::IOThreadPoolExecutor>(
+          s3Config.uploadThreads(),
+          std::make_shared<folly::NamedThreadFactory>("S3Upload"));
+      uploadParallelParts_ = s3Config.uploadParallelParts();
+    }
     ++fileSystemCount;
   }
 
   ~Impl() {
+    // Joins the reads and uploads in flight before the client goes away.
+    readExecutor_.reset();
+    uploadExecutor_.reset();
     client_.reset();
     --fileSystemCount;
   }
@@ -769,8 +869,37 @@ class S3FileSystem::Impl {
     return getAwsInstance()->getLogLevelName();
   }
 
+  folly::Executor* uploadExecutor() const {
+    return uploadExecutor_.get();
+  }
+
+  int32_t uploadParallelParts() const {
+    return uploadParallelParts_;
+  }
+
+  // Wraps 'file' to serve preadvAsync() with parallel ranged GETs if read
+  // threads are configured.
+  std::unique_ptr<ReadFile> wrapForAsyncRead(std::unique_ptr<ReadFile> file) {
+    if (readExecutor_ == nullptr) {
+      return file;
+    }
+    return std::make_unique<ParallelReadFile>(
+        std::move(file),
+        readExecutor_.get(),
+        readPartSize_,
+        readParallelParts_);
+  }
+
  private:
   std::shared_ptr<Aws::S3::S3Client> client_;
+  // Runs the ranged GETs of preadvAsync(). Its threads bound the reads in
+  // flight for all the files of the file system.
+  std::unique_ptr<folly::IOThreadPoolExecutor> readExecutor_;
+  uint64_t readPartSize_{0};
+  int32_t readParallelParts_{0};
+  // Uploads the parts of the files being written, if set.
+  std::unique_ptr<folly::IOThreadPoolExecutor> uploadExecutor_;
+  int32_t uploadParallelParts_{1};
 };
 
 S3FileSystem::S3FileSystem(
@@ -791,15 +920,19 @@ std::unique_ptr<ReadFile> S3FileSystem::openFileForRead(
   const auto path = getPath(s3Path);
   auto s3file = std::make_unique<S3ReadFile>(path, impl_->s3Client());
   s3file->initialize(options);
-  return s3file;
+  return impl_->wrapForAsyncRead(std::move(s3file));
 }
 
 std::unique_ptr<WriteFile> S3FileSystem::openFileForWrite(
     std::string_view s3Path,
     const FileOptions& options) {
   const auto path = getPath(s3Path);
-  auto s3file =
-      std::make_unique<S3WriteFile>(path, impl_->s3Client(), options.pool);
+  auto s3file = std::make_unique<S3WriteFile>(
+      path,
+      impl_->s3Client(),
+      options.pool,
+      impl_->uploadExecutor(),
+      impl_->uploadParallelParts());
   return s3file;
 }
 
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <folly/Executor.h>
+
 #include "velox/common/file/File.h"
 #include "velox/common/memory/MemoryPool.h"
 
@@ -42,15 +44,19 @@ namespace facebook::velox::filesystems {
 /// https://docs.aws.amazon.com/AmazonS3/latest/userguide/mpuoverview.html
 /// https://github.com/apache/arrow/blob/main/cpp/src/arrow/filesystem/s3fs.cc
 /// S3WriteFile is not thread-safe.
-/// UploadPart is currently synchronous during append and flush.
-/// TODO: Evaluate and add option for asynchronous part uploads.
+/// Without 'uploadExecutor', UploadPart is synchronous during append and
+/// close. With it, full parts are uploaded on 'uploadExecutor' while append
+/// goes on, with up to 'maxParallelParts' parts in flight. The buffers of the
+/// parts in flight are allocated from 'pool'. close() waits for all the parts.
 /// TODO: Implement retry on failure.
 class S3WriteFile : public WriteFile {
  public:
   S3WriteFile(
       std::string_view path,
       Aws::S3::S3Client* client,
-      memory::MemoryPool* pool);
+      memory::MemoryPool* pool,
+      folly::Executor* uploadExecutor = nullptr,
+      int32_t maxParallelParts = 1);
 
   /// Appends data to the end of the file.
   /// Uploads a part on reaching part size limit.
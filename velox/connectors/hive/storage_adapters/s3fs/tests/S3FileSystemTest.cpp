@@ -255,6 +255,40 @@ TEST_F(S3FileSystemTest, writeFileAndRead) {
   ASSERT_EQ(readFile->pread(contentSize * 250'000, contentSize), dataContent);
 }
 
+TEST_F(S3FileSystemTest, writeFileWithParallelUploads) {
+  const auto bucketName = "paralleluploads";
+  const auto file = "test.txt";
+  const auto s3File = s3URI(bucketName, file);
+
+  auto hiveConfig = minioServer_->hiveConfig(
+      {{"hive.s3.upload-threads", "4"},
+       {"hive.s3.upload-parallel-parts", "2"}});
+  filesystems::S3FileSystem s3fs(bucketName, hiveConfig);
+  auto pool = memory::memoryManager()->addLeafPool("S3FileSystemTest");
+  auto writeFile =
+      s3fs.openFileForWrite(s3File, {{}, pool.get(), std::nullopt});
+  auto s3WriteFile = dynamic_cast<filesystems::S3WriteFile*>(writeFile.get());
+
+  // 45MiB in appends of 1MiB of distinct bytes makes 5 parts.
+  constexpr int32_t kMB = 1 << 20;
+  std::string chunk(kMB, 0);
+  for (int32_t i = 0; i < 45; ++i) {
+    std::fill(chunk.begin(), chunk.end(), 'a' + i % 26);
+    writeFile->append(chunk);
+  }
+  EXPECT_EQ(s3WriteFile->numPartsUploaded(), 4);
+  writeFile->close();
+  EXPECT_EQ(s3WriteFile->numPartsUploaded(), 5);
+  EXPECT_EQ(pool->usedBytes(), 0);
+
+  auto readFile = s3fs.openFileForRead(s3File);
+  ASSERT_EQ(readFile->size(), 45 * kMB);
+  for (int32_t i = 0; i < 45; ++i) {
+    ASSERT_EQ(
+        readFile->pread(i * kMB + kMB / 2, 1), std::string(1, 'a' + i % 26));
+  }
+}
+
 TEST_F(S3FileSystemTest, invalidConnectionSettings) {
   auto hiveConfig =
       minioServer_->hiveConfig({{"hive.s3.connect-timeout", "400"}});
@@ -41,6 +41,7 @@ TEST(HiveConfigTest, defaultConfig) {
   ASSERT_EQ(hiveConfig.maxCoalescedBytes(emptySession.get()), 128 << 20);
   ASSERT_EQ(
       hiveConfig.maxCoalescedDistanceBytes(emptySession.get()), 512 << 10);
+  ASSERT_FALSE(hiveConfig.adaptiveCoalesceEnabled(emptySession.get()));
   ASSERT_FALSE(
       hiveConfig.readStatsBasedFilterReorderDisabled(emptySession.get()));
   ASSERT_EQ(hiveConfig.numCacheFileHandles(), 20'000);
@@ -53,6 +54,7 @@ TEST(HiveConfigTest, defaultConfig) {
   ASSERT_TRUE(hiveConfig.isPartitionPathAsLowerCase(emptySession.get()));
   ASSERT_TRUE(hiveConfig.allowNullPartitionKeys(emptySession.get()));
   ASSERT_EQ(hiveConfig.loadQuantum(emptySession.get()), 8 << 20);
+  ASSERT_EQ(hiveConfig.prefetchRowGroupsMemoryLimit(), 0);
 }
 
 TEST(HiveConfigTest, overrideConfig) {
@@ -74,7 +76,8 @@ TEST(HiveConfigTest, overrideConfig) {
       {HiveConfig::kSortWriterMaxOutputBytes, "100MB"},
       {HiveConfig::kSortWriterFinishTimeSliceLimitMs, "400"},
       {HiveConfig::kReadStatsBasedFilterReorderDisabled, "true"},
-      {HiveConfig::kLoadQuantum, std::to_string(4 << 20)}};
+      {HiveConfig::kLoadQuantum, std::to_string(4 << 20)},
+      {HiveConfig::kPrefetchRowGroupsMemoryLimit, "256MB"}};
   HiveConfig hiveConfig(
       std::make_shared<config::ConfigBase>(std::move(configFromFile)));
   auto emptySession = std::make_shared<config::ConfigBase>(
@@ -104,6 +107,7 @@ TEST(HiveConfigTest, overrideConfig) {
   ASSERT_TRUE(
       hiveConfig.readStatsBasedFilterReorderDisabled(emptySession.get()));
   ASSERT_EQ(hiveConfig.loadQuantum(emptySession.get()), 4 << 20);
+  ASSERT_EQ(hiveConfig.prefetchRowGroupsMemoryLimit(), 256UL << 20);
 }
 
 TEST(HiveConfigTest, overrideSession) {
@@ -116,6 +120,7 @@ TEST(HiveConfigTest, overrideSession) {
       {HiveConfig::kSortWriterMaxOutputRowsSession, "20"},
       {HiveConfig::kSortWriterMaxOutputBytesSession, "20MB"},
       {HiveConfig::kMaxCoalescedDistanceSession, "3MB"},
+      {HiveConfig::kAdaptiveCoalesceEnabledSession, "true"},
       {HiveConfig::kSortWriterFinishTimeSliceLimitMsSession, "300"},
       {HiveConfig::kPartitionPathAsLowerCaseSession, "false"},
       {HiveConfig::kAllowNullPartitionKeysSession, "false"},
@@ -137,6 +142,7 @@ TEST(HiveConfigTest, overrideSession) {
 
   ASSERT_EQ(hiveConfig.maxCoalescedBytes(session.get()), 128 << 20);
   ASSERT_EQ(hiveConfig.maxCoalescedDistanceBytes(session.get()), 3 << 20);
+  ASSERT_TRUE(hiveConfig.adaptiveCoalesceEnabled(session.get()));
   ASSERT_EQ(hiveConfig.numCacheFileHandles(), 20'000);
   ASSERT_TRUE(hiveConfig.isFileHandleCacheEnabled());
   ASSERT_EQ(hiveConfig.sortWriterMaxOutputRows(session.get()), 20);
@@ -302,5 +302,24 @@ TEST_F(HiveConnectorSerDeTest, hiveConnectorSplit) {
   testSerde(split3);
 }
 
+TEST_F(HiveConnectorSerDeTest, hiveConnectorSplitBundle) {
+  const auto connectorId = "testSerde";
+  const auto fileFormat = dwio::common::FileFormat::DWRF;
+  HiveConnectorSplitBundle bundle({
+      std::make_shared<HiveConnectorSplit>(
+          connectorId, "/testSerde/p0", fileFormat),
+      std::make_shared<HiveConnectorSplit>(
+          connectorId, "/testSerde/p1", fileFormat, 10, 100),
+  });
+  const auto clone =
+      ISerializable::deserialize<HiveConnectorSplitBundle>(bundle.serialize());
+  ASSERT_EQ(clone->toString(), bundle.toString());
+  ASSERT_EQ(clone->connectorId, connectorId);
+  ASSERT_EQ(clone->splits.size(), 2);
+  for (auto i = 0; i < bundle.splits.size(); ++i) {
+    testSerde(*clone->splits[i]);
+  }
+}
+
 } // namespace
 } // namespace facebook::velox::connector::hive::test
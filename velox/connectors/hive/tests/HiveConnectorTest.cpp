@@ -656,5 +656,84 @@ TEST_F(HiveConnectorTest, prestoTableSampling) {
   ASSERT_TRUE(filters.empty());
 }
 
+TEST_F(HiveConnectorTest, aggregateFromMetadata) {
+  auto data = makeRowVector(
+      {"c0", "c1"},
+      {makeFlatVector<int64_t>(100, [](auto row) { return row - 10; }),
+       makeFlatVector<int32_t>(
+           100, [](auto row) { return row * 2; }, nullEvery(7))});
+  auto filePath = TempFilePath::create();
+  writeToFile(filePath->getPath(), data);
+
+  config::ConfigBase sessionProperties({});
+  auto connectorQueryCtx = std::make_unique<connector::ConnectorQueryCtx>(
+      pool_.get(),
+      pool_.get(),
+      &sessionProperties,
+      nullptr,
+      common::PrefixSortConfig(),
+      nullptr,
+      nullptr,
+      "query.HiveConnectorTest",
+      "task.HiveConnectorTest",
+      "planNodeId.HiveConnectorTest",
+      0,
+      "");
+  auto outputType = ROW({"ds", "c1", "c0"}, {VARCHAR(), INTEGER(), BIGINT()});
+  ColumnHandleMap assignments = {
+      {"ds", partitionKey("ds", VARCHAR())},
+      {"c0", regularColumn("c0", BIGINT())},
+      {"c1", regularColumn("c1", INTEGER())}};
+  auto split = HiveConnectorSplitBuilder(filePath->getPath())
+                   .partitionKey("ds", "2024-01-01")
+                   .build();
+  const std::vector<MetadataAggregate> aggregates = {
+      {MetadataAggregate::Kind::kCount},
+      {MetadataAggregate::Kind::kMin, 2},
+      {MetadataAggregate::Kind::kMax, 2},
+      {MetadataAggregate::Kind::kMax, 1},
+      {MetadataAggregate::Kind::kConstant, 0}};
+
+  auto connector = connector::getConnector(kHiveConnectorId);
+  auto dataSource = connector->createDataSource(
+      outputType, makeTableHandle(), assignments, connectorQueryCtx.get());
+  dataSource->addSplit(split);
+  auto result = dataSource->aggregateFromMetadata(aggregates);
+  ASSERT_NE(result, nullptr);
+  assertEqualVectors(
+      makeRowVector(
+          {"a0", "a1", "a2", "a3", "a4"},
+          {makeFlatVector<int64_t>({100}),
+           makeFlatVector<int64_t>({-10}),
+           makeFlatVector<int64_t>({89}),
+           makeFlatVector<int32_t>({198}),
+           makeFlatVector<std::string>({"2024-01-01"})}),
+      result);
+
+  // A filter on a data column drops rows the footer does not know about.
+  SubfieldFilters filters;
+  filters[Subfield("c0")] = exec::greaterThan(50);
+  dataSource = connector->createDataSource(
+      outputType,
+      makeTableHandle(std::move(filters)),
+      assignments,
+      connectorQueryCtx.get());
+  dataSource->addSplit(split);
+  ASSERT_EQ(dataSource->aggregateFromMetadata(aggregates), nullptr);
+
+  // A filter on the partition key that drops the split makes no rows.
+  SubfieldFilters partitionFilters;
+  partitionFilters[Subfield("ds")] = exec::equal("2024-01-02");
+  dataSource = connector->createDataSource(
+      outputType,
+      makeTableHandle(std::move(partitionFilters)),
+      assignments,
+      connectorQueryCtx.get());
+  dataSource->addSplit(split);
+  result = dataSource->aggregateFromMetadata(aggregates);
+  ASSERT_NE(result, nullptr);
+  ASSERT_EQ(result->size(), 0);
+}
+
 } // namespace
 } // namespace facebook::velox::connector::hive
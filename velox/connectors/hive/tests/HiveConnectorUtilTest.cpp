@@ -16,6 +16,7 @@
 
 #include "velox/connectors/hive/HiveConnectorUtil.h"
 #include <gtest/gtest.h>
+#include "velox/common/base/tests/GTestUtils.h"
 #include "velox/connectors/hive/HiveConfig.h"
 #include "velox/connectors/hive/HiveConnectorSplit.h"
 #include "velox/connectors/hive/TableHandle.h"
@@ -337,6 +338,79 @@ TEST_F(HiveConnectorUtilTest, cacheRetention) {
   }
 }
 
+TEST_F(HiveConnectorUtilTest, cachePolicy) {
+  using Kind = io::CachePolicy::Kind;
+  ASSERT_EQ(hive::parseCachePolicy("default").kind, Kind::kDefault);
+  ASSERT_EQ(hive::parseCachePolicy("pin").kind, Kind::kPin);
+  ASSERT_EQ(hive::parseCachePolicy("never-cache").kind, Kind::kNeverCache);
+  const auto ttl = hive::parseCachePolicy("ttl=3600");
+  ASSERT_EQ(ttl.kind, Kind::kTtl);
+  ASSERT_EQ(ttl.ttlSecs, 3600);
+  VELOX_ASSERT_THROW(
+      hive::parseCachePolicy("ttl=0"), "Invalid cache policy TTL");
+  VELOX_ASSERT_THROW(
+      hive::parseCachePolicy("ttl=x"), "Invalid cache policy TTL");
+  VELOX_ASSERT_THROW(hive::parseCachePolicy("forever"), "Invalid cache policy");
+
+  config::ConfigBase sessionProperties({});
+  auto hiveConfig =
+      std::make_shared<hive::HiveConfig>(std::make_shared<config::ConfigBase>(
+          std::unordered_map<std::string, std::string>()));
+  auto connectorQueryCtx = std::make_unique<connector::ConnectorQueryCtx>(
+      pool_.get(),
+      pool_.get(),
+      &sessionProperties,
+      nullptr,
+      common::PrefixSortConfig(),
+      nullptr,
+      nullptr,
+      "query.HiveConnectorUtilTest",
+      "task.HiveConnectorUtilTest",
+      "planNodeId.HiveConnectorUtilTest",
+      0,
+      "");
+  auto hiveSplit = std::make_shared<hive::HiveConnectorSplit>(
+      "testConnectorId", "/tmp/", FileFormat::DWRF);
+
+  auto configure = [&](const std::unordered_map<std::string, std::string>&
+                           tableParameters) {
+    auto tableHandle = std::make_shared<hive::HiveTableHandle>(
+        "testConnectorId",
+        "testTable",
+        false,
+        common::SubfieldFilters{},
+        nullptr,
+        nullptr,
+        tableParameters);
+    dwio::common::ReaderOptions readerOptions(pool_.get());
+    configureReaderOptions(
+        hiveConfig,
+        connectorQueryCtx.get(),
+        tableHandle,
+        hiveSplit,
+        readerOptions);
+    return readerOptions;
+  };
+
+  const auto defaultOptions = configure({});
+  ASSERT_EQ(defaultOptions.cachePolicy("/c0").kind, Kind::kDefault);
+  ASSERT_FALSE(defaultOptions.noCacheRetention());
+
+  const auto readerOptions = configure(
+      {{"cache.policy", "ttl=60"},
+       {"cache.policy.key", "pin"},
+       {"cache.policy.payload", "never-cache"}});
+  ASSERT_EQ(readerOptions.cachePolicy().kind, Kind::kTtl);
+  ASSERT_EQ(readerOptions.cachePolicy("/c0").ttlSecs, 60);
+  ASSERT_EQ(readerOptions.cachePolicy("/key").kind, Kind::kPin);
+  ASSERT_EQ(readerOptions.cachePolicy("/key/0").kind, Kind::kPin);
+  ASSERT_EQ(readerOptions.cachePolicy("/payload").kind, Kind::kNeverCache);
+  ASSERT_FALSE(readerOptions.noCacheRetention());
+
+  const auto neverCacheOptions = configure({{"cache.policy", "never-cache"}});
+  ASSERT_TRUE(neverCacheOptions.noCacheRetention());
+}
+
 TEST_F(HiveConnectorUtilTest, configureRowReaderOptions) {
   auto split =
       std::make_shared<hive::HiveConnectorSplit>("", "", FileFormat::UNKNOWN);
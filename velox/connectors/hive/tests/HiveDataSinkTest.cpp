@@ -520,7 +520,8 @@ TEST_F(HiveDataSinkTest, basic) {
       "spilledBytes[0B] spilledRows[0] spilledPartitions[0] spilledFiles[0] "
       "spillFillTimeNanos[0ns] spillSortTimeNanos[0ns] spillExtractVectorTime[0ns] spillSerializationTimeNanos[0ns] "
       "spillWrites[0] spillFlushTimeNanos[0ns] spillWriteTimeNanos[0ns] "
-      "maxSpillExceededLimitCount[0] spillReadBytes[0B] spillReads[0] "
+      "spillWriteWaitTimeNanos[0ns] maxSpillExceededLimitCount[0] "
+      "spillReadBytes[0B] spillReads[0] "
       "spillReadTimeNanos[0ns] spillReadDeserializationTimeNanos[0ns]");
 
   const int numBatches = 10;
@@ -571,7 +572,8 @@ TEST_F(HiveDataSinkTest, basicBucket) {
       "spilledBytes[0B] spilledRows[0] spilledPartitions[0] spilledFiles[0] "
       "spillFillTimeNanos[0ns] spillSortTimeNanos[0ns] spillExtractVectorTime[0ns] spillSerializationTimeNanos[0ns] "
       "spillWrites[0] spillFlushTimeNanos[0ns] spillWriteTimeNanos[0ns] "
-      "maxSpillExceededLimitCount[0] spillReadBytes[0B] spillReads[0] "
+      "spillWriteWaitTimeNanos[0ns] maxSpillExceededLimitCount[0] "
+      "spillReadBytes[0B] spillReads[0] "
       "spillReadTimeNanos[0ns] spillReadDeserializationTimeNanos[0ns]");
 
   const int numBatches = 10;
@@ -596,6 +598,109 @@ TEST_F(HiveDataSinkTest, basicBucket) {
   verifyWrittenData(outputDirectory->getPath(), numBuckets);
 }
 
+TEST_F(HiveDataSinkTest, closeColdWriters) {
+  const auto outputDirectory = TempDirectoryPath::create();
+  connectorSessionProperties_->set(
+      HiveConfig::kMaxOpenWritersMemoryBytesSession, "1B");
+  const auto rowType = ROW({"c0", "p"}, {BIGINT(), INTEGER()});
+  auto dataSink = createDataSink(
+      rowType,
+      outputDirectory->getPath(),
+      dwio::common::FileFormat::DWRF,
+      {"p"});
+
+  // Each batch goes to one of 'numPartitions' partitions in turn, so the
+  // writer of each partition is closed and reopened once.
+  const int numPartitions = 4;
+  const int numBatches = 2 * numPartitions;
+  std::vector<RowVectorPtr> vectors;
+  for (int i = 0; i < numBatches; ++i) {
+    vectors.push_back(makeRowVector(
+        {"c0", "p"},
+        {makeFlatVector<int64_t>(100, [&](auto row) { return i * 100 + row; }),
+         makeFlatVector<int32_t>(
+             100, [&](auto /*row*/) { return i % numPartitions; })}));
+    dataSink->appendData(vectors.back());
+    ASSERT_EQ(dataSink->stats().numOpenWriters, 1);
+  }
+  ASSERT_TRUE(dataSink->finish());
+  const auto partitions = dataSink->close();
+  ASSERT_EQ(partitions.size(), numPartitions);
+  for (const auto& partition : partitions) {
+    const auto update = folly::parseJson(partition);
+    ASSERT_EQ(update["fileWriteInfos"].size(), 2);
+    ASSERT_EQ(update["rowCount"].asInt(), 200);
+  }
+  ASSERT_EQ(dataSink->stats().numWrittenFiles, numBatches);
+
+  const auto filePaths = listFiles(outputDirectory->getPath());
+  ASSERT_EQ(filePaths.size(), numBatches);
+  std::vector<std::shared_ptr<connector::ConnectorSplit>> splits;
+  for (const auto& filePath : filePaths) {
+    splits.push_back(makeHiveConnectorSplit(filePath));
+  }
+  createDuckDbTable(vectors);
+  HiveConnectorTestBase::assertQuery(
+      PlanBuilder().tableScan(ROW({"c0"}, {BIGINT()})).planNode(),
+      splits,
+      "SELECT c0 FROM tmp");
+}
+
+TEST_F(HiveDataSinkTest, asyncFileClose) {
+  const auto outputDirectory = TempDirectoryPath::create();
+  connectorSessionProperties_->set(
+      HiveConfig::kAsyncFileCloseEnabledSession, "true");
+  const auto rowType = ROW({"c0", "p"}, {BIGINT(), INTEGER()});
+  auto dataSink = std::make_shared<HiveDataSink>(
+      rowType,
+      createHiveInsertTableHandle(
+          rowType,
+          outputDirectory->getPath(),
+          dwio::common::FileFormat::DWRF,
+          {"p"}),
+      connectorQueryCtx_.get(),
+      CommitStrategy::kNoCommit,
+      connectorConfig_,
+      spillExecutor_.get());
+
+  const int numPartitions = 4;
+  std::vector<RowVectorPtr> vectors;
+  for (int i = 0; i < numPartitions; ++i) {
+    vectors.push_back(makeRowVector(
+        {"c0", "p"},
+        {makeFlatVector<int64_t>(100, [&](auto row) { return i * 100 + row; }),
+         makeFlatVector<int32_t>(100, [&](auto /*row*/) { return i; })}));
+    dataSink->appendData(vectors.back());
+  }
+  // The files are closed on the executor while finish() returns false.
+  while (!dataSink->finish()) {
+    auto future = dataSink->finishFuture();
+    if (future.valid()) {
+      future.wait();
+    }
+  }
+  const auto partitions = dataSink->close();
+  ASSERT_EQ(partitions.size(), numPartitions);
+  for (const auto& partition : partitions) {
+    const auto update = folly::parseJson(partition);
+    ASSERT_EQ(update["fileWriteInfos"].size(), 1);
+    ASSERT_EQ(update["rowCount"].asInt(), 100);
+  }
+  ASSERT_EQ(dataSink->stats().numWrittenFiles, numPartitions);
+
+  const auto filePaths = listFiles(outputDirectory->getPath());
+  ASSERT_EQ(filePaths.size(), numPartitions);
+  std::vector<std::shared_ptr<connector::ConnectorSplit>> splits;
+  for (const auto& filePath : filePaths) {
+    splits.push_back(makeHiveConnectorSplit(filePath));
+  }
+  createDuckDbTable(vectors);
+  HiveConnectorTestBase::assertQuery(
+      PlanBuilder().tableScan(ROW({"c0"}, {BIGINT()})).planNode(),
+      splits,
+      "SELECT c0 FROM tmp");
+}
+
 TEST_F(HiveDataSinkTest, close) {
   for (bool empty : {true, false}) {
     SCOPED_TRACE(fmt::format("Data sink is empty: {}", empty));
@@ -1068,6 +1173,63 @@ TEST_F(HiveDataSinkTest, sortWriterMemoryReclaimDuringFinish) {
   verifyWrittenData(outputDirectory->getPath(), numBuckets);
 }
 
+TEST_F(HiveDataSinkTest, sortWriterMergesSpilledRunsOnExecutor) {
+  const auto outputDirectory = TempDirectoryPath::create();
+  const int32_t numBuckets = 4;
+  auto bucketProperty = std::make_shared<HiveBucketProperty>(
+      HiveBucketProperty::Kind::kHiveCompatible,
+      numBuckets,
+      std::vector<std::string>{"c0"},
+      std::vector<TypePtr>{BIGINT()},
+      std::vector<std::shared_ptr<const HiveSortingColumn>>{
+          std::make_shared<HiveSortingColumn>(
+              "c1", core::SortOrder{false, false})});
+  std::shared_ptr<TempDirectoryPath> spillDirectory =
+      exec::test::TempDirectoryPath::create();
+  std::unique_ptr<SpillConfig> spillConfig =
+      getSpillConfig(spillDirectory->getPath(), 1 << 30);
+  connectorSessionProperties_->set(
+      HiveConfig::kSortWriterMaxOutputRowsSession, "100");
+  auto connectorQueryCtx = std::make_unique<connector::ConnectorQueryCtx>(
+      opPool_.get(),
+      connectorPool_.get(),
+      connectorSessionProperties_.get(),
+      spillConfig.get(),
+      common::PrefixSortConfig(),
+      nullptr,
+      nullptr,
+      "query.HiveDataSinkTest",
+      "task.HiveDataSinkTest",
+      "planNodeId.HiveDataSinkTest",
+      0,
+      "");
+  setConnectorQueryContext(std::move(connectorQueryCtx));
+  auto dataSink = createDataSink(
+      rowType_,
+      outputDirectory->getPath(),
+      dwio::common::FileFormat::DWRF,
+      {},
+      bucketProperty);
+  const int numBatches{10};
+  const auto vectors = createVectors(500, numBatches);
+  for (int i = 0; i < numBatches; ++i) {
+    dataSink->appendData(vectors[i]);
+    if (i == numBatches / 2) {
+      // Spills the sort buffers so that the output is merged from the spilled
+      // runs.
+      memory::testingRunArbitration();
+    }
+  }
+  while (!dataSink->finish()) {
+  }
+  const auto partitions = dataSink->close();
+  ASSERT_EQ(partitions.size(), numBuckets);
+  ASSERT_FALSE(dataSink->stats().spillStats.empty());
+
+  createDuckDbTable(vectors);
+  verifyWrittenData(outputDirectory->getPath(), numBuckets);
+}
+
 DEBUG_ONLY_TEST_F(HiveDataSinkTest, sortWriterFailureTest) {
   auto vectors = createVectors(500, 10);
 
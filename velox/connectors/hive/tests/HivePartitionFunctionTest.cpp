@@ -777,6 +777,34 @@ TEST_F(HivePartitionFunctionTest, function) {
   }
 }
 
+TEST_F(HivePartitionFunctionTest, flatAndEncodedColumns) {
+  const int bucketCount = 997;
+  std::vector<int> bucketToPartition(bucketCount);
+  std::iota(bucketToPartition.begin(), bucketToPartition.end(), 0);
+  connector::hive::HivePartitionFunction partitionFunction(
+      bucketCount, bucketToPartition, std::vector<column_index_t>{0, 1, 2, 3});
+
+  auto rowType =
+      ROW({"c0", "c1", "c2", "c3"}, {BIGINT(), INTEGER(), DOUBLE(), REAL()});
+  const int vectorSize = 1000;
+  VectorFuzzer fuzzer({.vectorSize = vectorSize, .nullRatio = 0.1}, pool());
+  std::vector<uint32_t> flatPartitions(vectorSize);
+  std::vector<uint32_t> encodedPartitions(vectorSize);
+  for (int i = 0; i < 5; ++i) {
+    auto flat = fuzzer.fuzzRow(rowType);
+    partitionFunction.partition(*flat, flatPartitions);
+
+    // Hash the same values through identity dictionaries.
+    auto indices = makeIndices(vectorSize, [](auto row) { return row; });
+    std::vector<VectorPtr> children;
+    for (const auto& child : flat->children()) {
+      children.push_back(wrapInDictionary(indices, vectorSize, child));
+    }
+    partitionFunction.partition(*makeRowVector(children), encodedPartitions);
+    ASSERT_EQ(flatPartitions, encodedPartitions);
+  }
+}
+
 TEST_F(HivePartitionFunctionTest, unknown) {
   auto values = makeAllNullFlatVector<UnknownValue>(4);
 
@@ -1190,6 +1190,18 @@ class PartitionFunction {
   virtual std::optional<uint32_t> partition(
       const RowVector& input,
       std::vector<uint32_t>& partitions) = 0;
+
+  /// Returns the extra partitions of the rows of the last partition() input
+  /// that go to more than one partition, e.g. the build side rows of skewed
+  /// join keys. Sets 'rows' and 'partitions' to one entry per extra copy of a
+  /// row and returns the number of entries. Only used by PartitionedOutput.
+  virtual vector_size_t extraPartitions(
+      std::vector<vector_size_t>& rows,
+      std::vector<uint32_t>& partitions) {
+    rows.clear();
+    partitions.clear();
+    return 0;
+  }
 };
 
 /// Factory class for creating PartitionFunction instances.
@@ -1762,6 +1774,10 @@ class MergeJoinNode : public AbstractJoinNode {
 
   folly::dynamic serialize() const override;
 
+  bool canSpill(const QueryConfig& queryConfig) const override {
+    return queryConfig.mergeJoinSpillEnabled();
+  }
+
   /// Returns true if the merge join supports this join type, otherwise false.
   static bool isSupported(JoinType joinType);
 
@@ -2417,8 +2433,7 @@ class WindowNode : public PlanNode {
     // No partitioning keys means the whole input is one big partition. In
     // this case, spilling is not helpful because we need to have a full
     // partition in memory to produce results.
-    return !partitionKeys_.empty() && !inputsSorted_ &&
-        queryConfig.windowSpillEnabled();
+    return !partitionKeys_.empty() && queryConfig.windowSpillEnabled();
   }
 
   const RowTypePtr& inputType() const {
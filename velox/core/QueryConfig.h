@@ -64,11 +64,31 @@ class QueryConfig {
   static constexpr const char* kExprTrackCpuUsage =
       "expression.track_cpu_usage";
 
+  /// Whether to evaluate trees of fixed-width arithmetic, comparison, AND and
+  /// OR expressions over flat or constant inputs in one fused loop, without a
+  /// vector per intermediate result. False by default.
+  static constexpr const char* kExprFusionEnabled =
+      "expression.fusion_enabled";
+
+  /// The maximum number of distinct values for which a deterministic function
+  /// caches its results if its only non-constant argument is a string, e.g.
+  /// regexp_like(s, 'pattern'). The cache of an expression is turned off if
+  /// most of the rows of a sample miss it. 0 disables the cache.
+  static constexpr const char* kExprValueCacheMaxEntries =
+      "expression.value_cache_max_entries";
+
   /// Whether to track CPU usage for stages of individual operators. True by
   /// default. Can be expensive when processing small batches, e.g. < 10K rows.
   static constexpr const char* kOperatorTrackCpuUsage =
       "track_operator_cpu_usage";
 
+  /// Whether to count the CPU cycles, instructions, cache misses and branch
+  /// misses of the calls of individual operators with perf_event counters.
+  /// Reported as operator runtime stats. Needs Linux and a
+  /// perf_event_paranoid setting that allows it, ignored otherwise.
+  static constexpr const char* kOperatorTrackPerfCounters =
+      "track_operator_perf_counters";
+
   /// Flags used to configure the CAST operator:
 
   static constexpr const char* kLegacyCast = "legacy_cast";
@@ -122,18 +142,86 @@ class QueryConfig {
   static constexpr const char* kMinExchangeOutputBatchBytes =
       "min_exchange_output_batch_bytes";
 
+  /// If true, the exchange client requests data first from the sources with
+  /// the most bytes buffered at the producers and splits the free space of
+  /// the exchange queue evenly among the sources with buffered data, so that
+  /// one source with a large backlog does not delay the requests to the
+  /// others. Otherwise, the sources are requested in the order of their
+  /// responses.
+  static constexpr const char* kExchangePrioritizeBufferedSourcesEnabled =
+      "exchange_prioritize_buffered_sources_enabled";
+
   static constexpr const char* kMaxPartialAggregationMemory =
       "max_partial_aggregation_memory";
 
   static constexpr const char* kMaxExtendedPartialAggregationMemory =
       "max_extended_partial_aggregation_memory";
 
+  /// If not zero, each driver thread caches up to this many bytes of memory
+  /// reservation per operator memory pool while running an operator, so that
+  /// most allocations and frees skip the pool's reservation lock. The cached
+  /// bytes count as used by the pool and are released at the end of each
+  /// operator call.
+  static constexpr const char* kDriverReservationCacheBytes =
+      "driver_reservation_cache_bytes";
+
   static constexpr const char* kAbandonPartialAggregationMinRows =
       "abandon_partial_aggregation_min_rows";
 
   static constexpr const char* kAbandonPartialAggregationMinPct =
       "abandon_partial_aggregation_min_pct";
 
+  /// If true, a partial grouped aggregation that feeds a PartitionedOutput
+  /// and runs on several drivers is followed by a local hash repartition on
+  /// the grouping keys and an intermediate aggregation. The partial results of
+  /// all drivers of the task are merged before they are shuffled.
+  static constexpr const char* kPartialAggregationLocalMergeEnabled =
+      "partial_aggregation_local_merge_enabled";
+
+  /// If true, a partial aggregation that finds its input clustered on the
+  /// grouping keys flushes its groups after each input batch instead of
+  /// accumulating them until the memory limit is reached.
+  static constexpr const char* kPartialAggregationClusteredFlushEnabled =
+      "partial_aggregation_clustered_flush_enabled";
+
+  /// If true, a single aggregation with grouping keys whose aggregates are all
+  /// distinct over the same columns is planned as an aggregation grouping on
+  /// the grouping keys and the distinct columns followed by a non-distinct
+  /// aggregation.
+  static constexpr const char* kDistinctAggregationRewriteEnabled =
+      "distinct_aggregation_rewrite_enabled";
+
+  /// Number of output batches a final or single aggregation extracts in
+  /// parallel on the query executor. Values of 1 or less extract the output
+  /// one batch at a time on the driver thread.
+  static constexpr const char* kAggregationParallelOutputBatches =
+      "aggregation_parallel_output_batches";
+
+  /// Number of input rows an abandoned partial aggregation passes through
+  /// before it tries aggregating again. 0 means that an abandoned partial
+  /// aggregation stays abandoned.
+  static constexpr const char* kPartialAggregationReprobeRows =
+      "partial_aggregation_reprobe_rows";
+
+  /// If true, operators share what they observe with the later operators of
+  /// the same plan node in the query, e.g. in the later tasks of a stage. A
+  /// partial aggregation of a plan node that another one abandoned starts
+  /// abandoned.
+  static constexpr const char* kRuntimeFeedbackEnabled =
+      "runtime_feedback_enabled";
+
+  /// If true, a final OrderBy of a task with more than one driver is planned
+  /// as a partial OrderBy on each driver followed by a local merge of the
+  /// sorted runs.
+  static constexpr const char* kOrderByParallelSortEnabled =
+      "order_by_parallel_sort_enabled";
+
+  /// If true, a local gather below a Window with partition keys is replaced
+  /// by a local repartition on the partition keys, so that the partitions are
+  /// evaluated on all drivers of the task.
+  static constexpr const char* kWindowLocalPartitionEnabled =
+      "window_local_partition_enabled";
+
   static constexpr const char* kAbandonPartialTopNRowNumberMinRows =
       "abandon_partial_topn_row_number_min_rows";
 
@@ -156,6 +244,13 @@ class QueryConfig {
   /// OutputBufferManager::kContinuePct % of this.
   static constexpr const char* kMaxOutputBufferSize = "max_output_buffer_size";
 
+  /// If true and the task has a spill directory, a broadcast output buffer
+  /// that reaches the continue threshold of kMaxOutputBufferSize writes the
+  /// pages it keeps only for the destinations that have not joined yet to a
+  /// local file. The late-joining destinations read them back from the file.
+  static constexpr const char* kBroadcastOutputSpillEnabled =
+      "broadcast_output_spill_enabled";
+
   /// Preferred size of batches in bytes to be returned by operators from
   /// Operator::getOutput. It is used when an estimate of average row size is
   /// known. Otherwise kPreferredOutputBatchRows is used.
@@ -175,6 +270,33 @@ class QueryConfig {
   /// output rows.
   static constexpr const char* kMaxOutputBatchRows = "max_output_batch_rows";
 
+  /// If true, operators size their output batches at runtime from the
+  /// observed retained size of their output rows, targeting
+  /// kAdaptiveOutputBatchTargetBytes per batch. The target grows when the
+  /// downstream operator spends less than kAdaptiveOutputBatchMinCpuNanos per
+  /// batch. Applies to the operators that size their output from
+  /// kPreferredOutputBatchRows or kPreferredOutputBatchBytes.
+  static constexpr const char* kAdaptiveOutputBatchSizingEnabled =
+      "adaptive_output_batch_sizing_enabled";
+
+  /// The retained bytes of an output batch to target with adaptive output
+  /// batch sizing. Defaults to a cache friendly size.
+  static constexpr const char* kAdaptiveOutputBatchTargetBytes =
+      "adaptive_output_batch_target_bytes";
+
+  /// The downstream CPU time per batch below which adaptive output batch
+  /// sizing grows the output batches to amortize per-batch overhead.
+  static constexpr const char* kAdaptiveOutputBatchMinCpuNanos =
+      "adaptive_output_batch_min_cpu_nanos";
+
+  /// If the fraction of the rows of an input batch of FilterProject that pass
+  /// the filter is below this, the passing rows of the projected columns are
+  /// copied to dense vectors before evaluating the projections. The output
+  /// then has dense columns instead of dictionaries over the input. 0 disables
+  /// the copy.
+  static constexpr const char* kFilterCompactionSelectivity =
+      "filter_compaction_selectivity";
+
   /// TableScan operator will exit getOutput() method after this many
   /// milliseconds even if it has no data to return yet. Zero means 'no time
   /// limit'.
@@ -220,6 +342,10 @@ class QueryConfig {
   static constexpr const char* kTopNRowNumberSpillEnabled =
       "topn_row_number_spill_enabled";
 
+  /// MergeJoin spilling flag, only applies if "spill_enabled" flag is set.
+  static constexpr const char* kMergeJoinSpillEnabled =
+      "merge_join_spill_enabled";
+
   /// The max row numbers to fill and spill for each spill run. This is used to
   /// cap the memory used for spilling. If it is zero, then there is no limit
   /// and spilling might run out of memory.
@@ -254,6 +380,35 @@ class QueryConfig {
   static constexpr const char* kSpillPrefixSortEnabled =
       "spill_prefixsort_enabled";
 
+  /// If true, sorted spill files store the normalized prefix sort key of each
+  /// row, so that merging the spilled runs compares rows by memcmp. The key
+  /// size is bounded by 'kPrefixSortNormalizedKeyMaxBytes'.
+  static constexpr const char* kSpillMergePrefixKeyEnabled =
+      "spill_merge_prefix_key_enabled";
+
+  /// If true, each page of a hash build spill file only holds rows of one
+  /// partition of the next spill level. A restored partition that is spilled
+  /// again then moves the unread pages to the next level partitions without
+  /// deserializing them.
+  static constexpr const char* kSpillPageRoutingEnabled =
+      "spill_page_routing_enabled";
+
+  /// The weight of the query in sharing the spill IO bandwidth with the other
+  /// spilling queries if the process-wide spill IO scheduler is set up. A query
+  /// with twice the weight gets twice the bandwidth while both are spilling.
+  static constexpr const char* kSpillIoWeight = "spill_io_weight";
+
+  /// If true, each block written to a spill file carries a CRC32C checksum
+  /// which is verified when the block is read back.
+  static constexpr const char* kSpillChecksumEnabled =
+      "spill_checksum_enabled";
+
+  /// If true, the spill files are encrypted with AES-256-GCM using a random key
+  /// per file which is only kept in memory. The reader also verifies the
+  /// authentication tag of each block.
+  static constexpr const char* kSpillEncryptionEnabled =
+      "spill_encryption_enabled";
+
   /// Specifies spill write buffer size in bytes. The spiller tries to buffer
   /// serialized spill data up to the specified size before write to storage
   /// underneath for io efficiency. If it is set to zero, then spill write
@@ -272,6 +427,24 @@ class QueryConfig {
   static constexpr const char* kSpillFileCreateConfig =
       "spill_file_create_config";
 
+  /// If true, spill files store each column of a batch as a separately
+  /// serialized and compressed chunk, so that readers can load a subset of
+  /// the columns.
+  static constexpr const char* kSpillColumnarFormatEnabled =
+      "spill_columnar_format_enabled";
+
+  /// If true, spill writers hand the serialized data over to the spill
+  /// executor for file write and serialize the next buffer meanwhile. At most
+  /// one write per spill file is in flight.
+  static constexpr const char* kSpillAsyncWriteEnabled =
+      "spill_async_write_enabled";
+
+  /// If not zero, the spiller samples the hash distribution of the rows to
+  /// spill and uses the fewest partition bits, up to the configured ones,
+  /// that keep the estimated largest partition within this size in bytes.
+  static constexpr const char* kSpillPartitionTargetSize =
+      "spill_partition_target_size";
+
   /// Default offset spill start partition bit. It is used with
   /// 'kJoinSpillPartitionBits' or 'kAggregationSpillPartitionBits' together to
   /// calculate the spilling partition number for join spill or aggregation
@@ -351,6 +524,71 @@ class QueryConfig {
   static constexpr const char* kMinTableRowsForParallelJoinBuild =
       "min_table_rows_for_parallel_join_build";
 
+  /// If true, the hash join build makes Bloom filters over the integer join
+  /// keys. The probe side pushes these down to the table scan as dynamic
+  /// filters when the join keys have too many distinct values for exact value
+  /// filters.
+  static constexpr const char* kHashJoinBloomFilterEnabled =
+      "hash_join_bloom_filter_enabled";
+
+  /// The maximum number of build side rows for which the hash join build makes
+  /// Bloom filters over the join keys. Each filter takes about 2 bytes per row.
+  static constexpr const char* kHashJoinBloomFilterMaxEntries =
+      "hash_join_bloom_filter_max_entries";
+
+  /// Target size in bytes of one radix partition of a hash join table. If the
+  /// table is larger, the build inserts the rows one partition at a time and
+  /// the probe visits the probe rows grouped by partition so that the working
+  /// set stays cache resident. 0 disables radix partitioning.
+  static constexpr const char* kHashJoinRadixPartitionBytes =
+      "hash_join_radix_partition_bytes";
+
+  /// Number of probe rows ahead of the row being probed for which the hash
+  /// join probe prefetches the hash table bucket. Applies to tables in hash
+  /// mode. 0 disables the prefetch pipeline. At most 63.
+  static constexpr const char* kHashProbePrefetchDistance =
+      "hash_probe_prefetch_distance";
+
+  /// If true, the hash join probe outputs the build side columns as lazy
+  /// vectors that are extracted from the hash table only for the rows that
+  /// are accessed downstream. Not used if the join can spill.
+  static constexpr const char* kHashProbeLateMaterializationEnabled =
+      "hash_probe_late_materialization_enabled";
+
+  /// If the build side of a hash join has at most this many rows, a local
+  /// repartition that feeds the probe side stops hashing and passes its input
+  /// to the probe drivers round robin. The probe drivers share one hash table,
+  /// so the join does not need the repartition, but the operators above the
+  /// join must not depend on it. 0 disables this.
+  static constexpr const char* kHashJoinSkipProbeRepartitionMaxBuildRows =
+      "hash_join_skip_probe_repartition_max_build_rows";
+
+  /// If true, hash joins of a query share the tables they build. A join whose
+  /// build side is the same as that of an earlier join of the query probes the
+  /// table built by the earlier join instead of building its own. Joins that
+  /// share tables don't spill. Builds that read table scans are not shared and
+  /// builds fed by exchanges must be broadcast.
+  static constexpr const char* kHashJoinTableCacheEnabled =
+      "hash_join_table_cache_enabled";
+
+  /// If true, a hash join build with multiple keys whose value ids don't fit in
+  /// a 64 bit normalized key may use a 128 bit normalized key instead of
+  /// falling back to hashing and comparing the key columns.
+  static constexpr const char* kHashJoinWideNormalizedKeyEnabled =
+      "hash_join_wide_normalized_key_enabled";
+
+  /// If greater than 0, a hash join build finds the keys that have at least
+  /// this percentage of the build rows and reports them as hot keys. The hot
+  /// key hashes can be used to spread skewed keys over several partitions.
+  static constexpr const char* kHashJoinHotKeyMinPct =
+      "hash_join_hot_key_min_pct";
+
+  /// If greater than 0, a nested loop join with a join condition evaluates the
+  /// condition over blocks of several probe rows times a build vector, with up
+  /// to this many rows per block, instead of one probe row at a time.
+  static constexpr const char* kNestedLoopJoinFilterBlockRows =
+      "nested_loop_join_filter_block_rows";
+
   /// If set to true, then during execution of tasks, the output vectors of
   /// every operator are validated for consistency. This is an expensive check
   /// so should only be used for debugging. It can help debug issues where
@@ -367,6 +605,12 @@ class QueryConfig {
   static constexpr const char* kEnableExpressionEvaluationCache =
       "enable_expression_evaluation_cache";
 
+  /// If true, the vector pools of the operators of a driver share their
+  /// recycled vectors, so that a vector released by one operator can be reused
+  /// by another. Requires the expression evaluation cache to be enabled.
+  static constexpr const char* kDriverVectorPoolSharingEnabled =
+      "driver_vector_pool_sharing_enabled";
+
   /// For a given shared subexpression, the maximum distinct sets of inputs we
   /// cache results for. Lambdas can call the same expression with different
   /// inputs many times, causing the results we cache to explode in size.
@@ -378,12 +622,32 @@ class QueryConfig {
   static constexpr const char* kMaxSplitPreloadPerDriver =
       "max_split_preload_per_driver";
 
+  /// Number of splits per driver, queued behind the preloaded ones, whose
+  /// file metadata is prefetched by the connector. These splits are preloaded
+  /// once a preload slot frees up. Set to 0 to disable metadata prefetch.
+  static constexpr const char* kMaxSplitMetadataPrefetchPerDriver =
+      "max_split_metadata_prefetch_per_driver";
+
   /// If not zero, specifies the cpu time slice limit in ms that a driver thread
   /// can continuously run without yielding. If it is zero, then there is no
   /// limit.
   static constexpr const char* kDriverCpuTimeSliceLimitMs =
       "driver_cpu_time_slice_limit_ms";
 
+  /// If true, a Driver whose operator is blocked on a future that is already
+  /// realized checks the operator again on thread instead of going off thread
+  /// and being enqueued again. Experimental.
+  static constexpr const char* kDriverContinueOnReadyFutureEnabled =
+      "driver_continue_on_ready_future_enabled";
+
+  /// If set, the priority the Drivers of the query are added to the executor
+  /// with, from -128 (lowest) to 127 (highest). Used only if the executor has
+  /// more than one priority. With driver_cpu_time_slice_limit_ms, a Driver of
+  /// a lower priority query gives up its thread at the end of its time slice
+  /// to the queued Drivers of higher priority queries.
+  static constexpr const char* kDriverSchedulingPriority =
+      "driver_scheduling_priority";
+
   /// Maximum number of bytes to use for the normalized key in prefix-sort. Use
   /// 0 to disable prefix-sort.
   static constexpr const char* kPrefixSortNormalizedKeyMaxBytes =
@@ -500,11 +764,70 @@ class QueryConfig {
   static constexpr const char* kTableScanScaleUpMemoryUsageRatio =
       "table_scan_scale_up_memory_usage_ratio";
 
+  /// If not zero, the table scan splits added to a task are divided into
+  /// splits of about this many bytes if their connector supports it, so that
+  /// the scan drivers share the work of a large file.
+  static constexpr const char* kTableScanSplitMorselBytes =
+      "table_scan_split_morsel_bytes";
+
+  /// If not zero, a task in grouped execution starts a split group while
+  /// another one runs only if the query memory usage plus the average usage
+  /// of its running split groups stays below this ratio of the query memory
+  /// capacity. The value is in the range of [0, 1].
+  static constexpr const char* kGroupedExecutionMemoryUsageRatio =
+      "grouped_execution_memory_usage_ratio";
+
   /// Specifies the shuffle compression kind which is defined by
   /// CompressionKind. If it is CompressionKind_NONE, then no compression.
   static constexpr const char* kShuffleCompressionKind =
       "shuffle_compression_codec";
 
+  /// If true, the PartitionedOutput operator writes a Presto page column of a
+  /// primitive type as a dictionary block if the first input vector added to
+  /// the page is a dictionary whose values are reused. Each value of the
+  /// input dictionaries is added once per page.
+  static constexpr const char* kShuffleDictionaryEncodingEnabled =
+      "shuffle_dictionary_encoding_enabled";
+
+  /// If true, each destination of the PartitionedOutput operator picks the
+  /// codec of its Presto pages from a sample of every 32nd page instead of
+  /// using kShuffleCompressionKind: no compression, LZ4 or ZSTD, depending on
+  /// the compression ratio of the sample and the CPU load. The receivers
+  /// decompress the pages with the codec named in the page.
+  static constexpr const char* kShuffleAdaptiveCompressionEnabled =
+      "shuffle_adaptive_compression_enabled";
+
+  /// If true, the PartitionedOutput operator sorts the rows of each input
+  /// batch sent to a destination by the partition keys before serializing
+  /// them, so that sort based shuffles receive runs of rows ordered by the
+  /// keys. Rows with equal keys keep their input order. Has no effect if a
+  /// partition key is not orderable.
+  static constexpr const char* kShufflePartialSortEnabled =
+      "shuffle_partial_sort_enabled";
+
+  /// If true, the Exchange operator sizes the serialized pages it coalesces
+  /// into one output batch by the ratio of the deserialized to the serialized
+  /// bytes of the previous batches, so that the output batches are close to
+  /// kPreferredOutputBatchBytes after deserialization. Otherwise, the
+  /// serialized bytes of one output batch are up to kPreferredOutputBatchBytes.
+  static constexpr const char* kExchangeAdaptiveBatchSizeEnabled =
+      "exchange_adaptive_batch_size_enabled";
+
+  /// If true, the Exchange operator returns an output batch as soon as the
+  /// rows deserialized from the received pages reach
+  /// kPreferredOutputBatchBytes, and deserializes the remaining pages in the
+  /// next calls. Each consumed page is released right away. Otherwise, all
+  /// the pages received together are deserialized into one output batch.
+  static constexpr const char* kExchangeStreamingDeserializationEnabled =
+      "exchange_streaming_deserialization_enabled";
+
+  /// If true, the vectors deserialized by the Exchange operator from
+  /// uncompressed Presto pages reference the received page memory instead of
+  /// copying it where the layout allows, see
+  /// PrestoVectorSerde::PrestoOptions::zeroCopyDeserialize.
+  static constexpr const char* kExchangeZeroCopyDeserializationEnabled =
+      "exchange_zero_copy_deserialization_enabled";
+
   bool selectiveNimbleReaderEnabled() const {
     return get<bool>(kSelectiveNimbleReaderEnabled, false);
   }
@@ -546,6 +869,10 @@ class QueryConfig {
     return get<uint64_t>(kMaxExtendedPartialAggregationMemory, kDefault);
   }
 
+  uint64_t driverReservationCacheBytes() const {
+    return get<uint64_t>(kDriverReservationCacheBytes, 0);
+  }
+
   int32_t abandonPartialAggregationMinRows() const {
     return get<int32_t>(kAbandonPartialAggregationMinRows, 100'000);
   }
@@ -554,6 +881,38 @@ class QueryConfig {
     return get<int32_t>(kAbandonPartialAggregationMinPct, 80);
   }
 
+  bool partialAggregationLocalMergeEnabled() const {
+    return get<bool>(kPartialAggregationLocalMergeEnabled, false);
+  }
+
+  bool partialAggregationClusteredFlushEnabled() const {
+    return get<bool>(kPartialAggregationClusteredFlushEnabled, false);
+  }
+
+  bool distinctAggregationRewriteEnabled() const {
+    return get<bool>(kDistinctAggregationRewriteEnabled, false);
+  }
+
+  int32_t aggregationParallelOutputBatches() const {
+    return get<int32_t>(kAggregationParallelOutputBatches, 1);
+  }
+
+  int64_t partialAggregationReprobeRows() const {
+    return get<int64_t>(kPartialAggregationReprobeRows, 0);
+  }
+
+  bool runtimeFeedbackEnabled() const {
+    return get<bool>(kRuntimeFeedbackEnabled, false);
+  }
+
+  bool orderByParallelSortEnabled() const {
+    return get<bool>(kOrderByParallelSortEnabled, false);
+  }
+
+  bool windowLocalPartitionEnabled() const {
+    return get<bool>(kWindowLocalPartitionEnabled, false);
+  }
+
   int32_t abandonPartialTopNRowNumberMinRows() const {
     return get<int32_t>(kAbandonPartialTopNRowNumberMinRows, 100'000);
   }
@@ -582,6 +941,10 @@ class QueryConfig {
     return get<uint64_t>(kMaxOutputBufferSize, kDefault);
   }
 
+  bool broadcastOutputSpillEnabled() const {
+    return get<bool>(kBroadcastOutputSpillEnabled, false);
+  }
+
   uint64_t maxLocalExchangeBufferSize() const {
     static constexpr uint64_t kDefault = 32UL << 20;
     return get<uint64_t>(kMaxLocalExchangeBufferSize, kDefault);
@@ -608,6 +971,10 @@ class QueryConfig {
     return get<uint64_t>(kMinExchangeOutputBatchBytes, kDefault);
   }
 
+  bool exchangePrioritizeBufferedSourcesEnabled() const {
+    return get<bool>(kExchangePrioritizeBufferedSourcesEnabled, false);
+  }
+
   uint64_t preferredOutputBatchBytes() const {
     static constexpr uint64_t kDefault = 10UL << 20;
     return get<uint64_t>(kPreferredOutputBatchBytes, kDefault);
@@ -626,6 +993,23 @@ class QueryConfig {
     return maxBatchRows;
   }
 
+  double filterCompactionSelectivity() const {
+    return get<double>(kFilterCompactionSelectivity, 0.0);
+  }
+
+  bool adaptiveOutputBatchSizingEnabled() const {
+    return get<bool>(kAdaptiveOutputBatchSizingEnabled, false);
+  }
+
+  uint64_t adaptiveOutputBatchTargetBytes() const {
+    static constexpr uint64_t kDefault = 1UL << 20;
+    return get<uint64_t>(kAdaptiveOutputBatchTargetBytes, kDefault);
+  }
+
+  uint64_t adaptiveOutputBatchMinCpuNanos() const {
+    return get<uint64_t>(kAdaptiveOutputBatchMinCpuNanos, 50'000);
+  }
+
   uint32_t tableScanGetOutputTimeLimitMs() const {
     return get<uint64_t>(kTableScanGetOutputTimeLimitMs, 5'000);
   }
@@ -708,6 +1092,10 @@ class QueryConfig {
     return get<bool>(kTopNRowNumberSpillEnabled, true);
   }
 
+  bool mergeJoinSpillEnabled() const {
+    return get<bool>(kMergeJoinSpillEnabled, true);
+  }
+
   int32_t maxSpillLevel() const {
     return get<int32_t>(kMaxSpillLevel, 1);
   }
@@ -741,6 +1129,28 @@ class QueryConfig {
     return get<bool>(kSpillPrefixSortEnabled, false);
   }
 
+  bool spillMergePrefixKeyEnabled() const {
+    return get<bool>(kSpillMergePrefixKeyEnabled, false);
+  }
+
+  bool spillPageRoutingEnabled() const {
+    return get<bool>(kSpillPageRoutingEnabled, false);
+  }
+
+  uint32_t spillIoWeight() const {
+    const auto weight = get<uint32_t>(kSpillIoWeight, 1);
+    VELOX_USER_CHECK_GT(weight, 0, "{} must be positive", kSpillIoWeight);
+    return weight;
+  }
+
+  bool spillChecksumEnabled() const {
+    return get<bool>(kSpillChecksumEnabled, false);
+  }
+
+  bool spillEncryptionEnabled() const {
+    return get<bool>(kSpillEncryptionEnabled, false);
+  }
+
   uint64_t spillWriteBufferSize() const {
     // The default write buffer size set to 1MB.
     return get<uint64_t>(kSpillWriteBufferSize, 1L << 20);
@@ -755,6 +1165,20 @@ class QueryConfig {
     return get<std::string>(kSpillFileCreateConfig, "");
   }
 
+  bool spillColumnarFormatEnabled() const {
+    return get<bool>(kSpillColumnarFormatEnabled, false);
+  }
+
+  bool spillAsyncWriteEnabled() const {
+    return get<bool>(kSpillAsyncWriteEnabled, false);
+  }
+
+  uint64_t spillPartitionTargetSize() const {
+    return config::toCapacity(
+        get<std::string>(kSpillPartitionTargetSize, "0B"),
+        config::CapacityUnit::BYTE);
+  }
+
   int32_t minSpillableReservationPct() const {
     constexpr int32_t kDefaultPct = 5;
     return get<int32_t>(kMinSpillableReservationPct, kDefaultPct);
@@ -835,10 +1259,22 @@ class QueryConfig {
     return get<bool>(kExprTrackCpuUsage, false);
   }
 
+  bool exprFusionEnabled() const {
+    return get<bool>(kExprFusionEnabled, false);
+  }
+
+  uint32_t exprValueCacheMaxEntries() const {
+    return get<uint32_t>(kExprValueCacheMaxEntries, 0);
+  }
+
   bool operatorTrackCpuUsage() const {
     return get<bool>(kOperatorTrackCpuUsage, true);
   }
 
+  bool operatorTrackPerfCounters() const {
+    return get<bool>(kOperatorTrackPerfCounters, false);
+  }
+
   uint32_t taskWriterCount() const {
     return get<uint32_t>(kTaskWriterCount, 4);
   }
@@ -856,6 +1292,46 @@ class QueryConfig {
     return get<uint32_t>(kMinTableRowsForParallelJoinBuild, 1'000);
   }
 
+  bool hashJoinBloomFilterEnabled() const {
+    return get<bool>(kHashJoinBloomFilterEnabled, false);
+  }
+
+  uint32_t hashJoinBloomFilterMaxEntries() const {
+    return get<uint32_t>(kHashJoinBloomFilterMaxEntries, 8'000'000);
+  }
+
+  uint64_t hashJoinRadixPartitionBytes() const {
+    return get<uint64_t>(kHashJoinRadixPartitionBytes, 0);
+  }
+
+  int32_t hashProbePrefetchDistance() const {
+    return get<int32_t>(kHashProbePrefetchDistance, 0);
+  }
+
+  bool hashProbeLateMaterializationEnabled() const {
+    return get<bool>(kHashProbeLateMaterializationEnabled, false);
+  }
+
+  uint64_t hashJoinSkipProbeRepartitionMaxBuildRows() const {
+    return get<uint64_t>(kHashJoinSkipProbeRepartitionMaxBuildRows, 0);
+  }
+
+  bool hashJoinTableCacheEnabled() const {
+    return get<bool>(kHashJoinTableCacheEnabled, false);
+  }
+
+  bool hashJoinWideNormalizedKeyEnabled() const {
+    return get<bool>(kHashJoinWideNormalizedKeyEnabled, false);
+  }
+
+  int32_t hashJoinHotKeyMinPct() const {
+    return get<int32_t>(kHashJoinHotKeyMinPct, 0);
+  }
+
+  int32_t nestedLoopJoinFilterBlockRows() const {
+    return get<int32_t>(kNestedLoopJoinFilterBlockRows, 0);
+  }
+
   bool validateOutputFromOperators() const {
     return get<bool>(kValidateOutputFromOperators, false);
   }
@@ -864,6 +1340,10 @@ class QueryConfig {
     return get<bool>(kEnableExpressionEvaluationCache, true);
   }
 
+  bool driverVectorPoolSharingEnabled() const {
+    return get<bool>(kDriverVectorPoolSharingEnabled, false);
+  }
+
   uint32_t maxSharedSubexprResultsCached() const {
     // 10 was chosen as a default as there are cases where a shared
     // subexpression can be called in 2 different places and a particular
@@ -884,10 +1364,32 @@ class QueryConfig {
     return get<int32_t>(kMaxSplitPreloadPerDriver, 2);
   }
 
+  int32_t maxSplitMetadataPrefetchPerDriver() const {
+    return get<int32_t>(kMaxSplitMetadataPrefetchPerDriver, 0);
+  }
+
   uint32_t driverCpuTimeSliceLimitMs() const {
     return get<uint32_t>(kDriverCpuTimeSliceLimitMs, 0);
   }
 
+  bool driverContinueOnReadyFutureEnabled() const {
+    return get<bool>(kDriverContinueOnReadyFutureEnabled, false);
+  }
+
+  std::optional<int8_t> driverSchedulingPriority() const {
+    const auto priority = get<int32_t>(kDriverSchedulingPriority);
+    if (!priority.has_value()) {
+      return std::nullopt;
+    }
+    VELOX_USER_CHECK(
+        priority.value() >= std::numeric_limits<int8_t>::min() &&
+            priority.value() <= std::numeric_limits<int8_t>::max(),
+        "{} must be between -128 and 127: {}",
+        kDriverSchedulingPriority,
+        priority.value());
+    return priority.value();
+  }
+
   uint32_t prefixSortNormalizedKeyMaxBytes() const {
     return get<uint32_t>(kPrefixSortNormalizedKeyMaxBytes, 128);
   }
@@ -926,10 +1428,48 @@ class QueryConfig {
     return get<double>(kTableScanScaleUpMemoryUsageRatio, 0.7);
   }
 
+  uint64_t tableScanSplitMorselBytes() const {
+    return get<uint64_t>(kTableScanSplitMorselBytes, 0);
+  }
+
+  double groupedExecutionMemoryUsageRatio() const {
+    const auto ratio = get<double>(kGroupedExecutionMemoryUsageRatio, 0);
+    VELOX_USER_CHECK(
+        ratio >= 0 && ratio <= 1,
+        "{} must be in the range of [0, 1]: {}",
+        kGroupedExecutionMemoryUsageRatio,
+        ratio);
+    return ratio;
+  }
+
   std::string shuffleCompressionKind() const {
     return get<std::string>(kShuffleCompressionKind, "none");
   }
 
+  bool shuffleDictionaryEncodingEnabled() const {
+    return get<bool>(kShuffleDictionaryEncodingEnabled, false);
+  }
+
+  bool shuffleAdaptiveCompressionEnabled() const {
+    return get<bool>(kShuffleAdaptiveCompressionEnabled, false);
+  }
+
+  bool shufflePartialSortEnabled() const {
+    return get<bool>(kShufflePartialSortEnabled, false);
+  }
+
+  bool exchangeAdaptiveBatchSizeEnabled() const {
+    return get<bool>(kExchangeAdaptiveBatchSizeEnabled, false);
+  }
+
+  bool exchangeStreamingDeserializationEnabled() const {
+    return get<bool>(kExchangeStreamingDeserializationEnabled, false);
+  }
+
+  bool exchangeZeroCopyDeserializationEnabled() const {
+    return get<bool>(kExchangeZeroCopyDeserializationEnabled, false);
+  }
+
   template <typename T>
   T get(const std::string& key, const T& defaultValue) const {
     return config_->get<T>(key, defaultValue);
@@ -69,6 +69,17 @@ QueryCtx::QueryCtx(
   return fmt::format("query.{}.{}", queryId.c_str(), seqNum++);
 }
 
+std::shared_ptr<void> QueryCtx::getOrCreateQueryState(
+    const std::string& key,
+    const std::function<std::shared_ptr<void>()>& factory) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = queryStates_.find(key);
+  if (it == queryStates_.end()) {
+    it = queryStates_.emplace(key, factory()).first;
+  }
+  return it->second;
+}
+
 void QueryCtx::maybeSetReclaimer() {
   VELOX_CHECK_NOT_NULL(pool_);
   VELOX_CHECK(!underArbitration_);
@@ -19,6 +19,7 @@
 #include <folly/Executor.h>
 #include <folly/executors/CPUThreadPoolExecutor.h>
 #include "velox/common/caching/AsyncDataCache.h"
+#include "velox/common/memory/BatchArena.h"
 #include "velox/common/memory/Memory.h"
 #include "velox/core/QueryConfig.h"
 #include "velox/vector/DecodedVector.h"
@@ -113,6 +114,15 @@ class QueryCtx : public std::enable_shared_from_this<QueryCtx> {
     return queryId_;
   }
 
+  /// Returns the query-scoped state registered under 'key', creating it with
+  /// 'factory' on first access. Operators of different tasks of the same query
+  /// use this to share state such as built hash tables. The state lives until
+  /// the query context is destroyed and is released before the query memory
+  /// pool.
+  std::shared_ptr<void> getOrCreateQueryState(
+      const std::string& key,
+      const std::function<std::shared_ptr<void>()>& factory);
+
   /// Checks if the associated query is under memory arbitration or not. The
   /// function returns true if it is and set future which is fulfilled when the
   /// memory arbitration finishes.
@@ -224,6 +234,10 @@ class QueryCtx : public std::enable_shared_from_this<QueryCtx> {
   std::atomic<uint64_t> numTracedBytes_{0};
 
   mutable std::mutex mutex_;
+  // Query-scoped state shared by the tasks of this query. Declared after
+  // 'pool_' so that the state, which may hold memory from 'pool_', is
+  // destroyed first.
+  std::unordered_map<std::string, std::shared_ptr<void>> queryStates_;
   // Indicates if this query is under memory arbitration or not.
   bool underArbitration_{false};
   std::vector<ContinuePromise> arbitrationPromises_;
@@ -232,13 +246,19 @@ class QueryCtx : public std::enable_shared_from_this<QueryCtx> {
 // Represents the state of one thread of query execution.
 class ExecCtx {
  public:
-  ExecCtx(memory::MemoryPool* pool, QueryCtx* queryCtx)
+  /// If 'vectorPoolCache' is set, the vector pool recycles vectors through
+  /// the cache shared with other ExecCtxs used by the same thread.
+  ExecCtx(
+      memory::MemoryPool* pool,
+      QueryCtx* queryCtx,
+      std::shared_ptr<VectorPool::Cache> vectorPoolCache = nullptr)
       : pool_(pool),
         queryCtx_(queryCtx),
         optimizationParams_(queryCtx),
         vectorPool_(
             optimizationParams_.exprEvalCacheEnabled
-                ? std::make_unique<VectorPool>(pool)
+                ? std::make_unique<VectorPool>(
+                      pool, std::move(vectorPoolCache))
                 : nullptr) {}
 
   struct OptimizationParams {
@@ -390,6 +410,66 @@ class ExecCtx {
     return optimizationParams_;
   }
 
+  /// Returns the arena for scratch memory of the batch being evaluated, e.g.
+  /// temporary buffers of a vector function. The arena is reset after the
+  /// outermost BatchScope ends, so its memory must not escape the batch.
+  memory::BatchArena* batchArena() {
+    if (batchArena_ == nullptr) {
+      batchArena_ = std::make_unique<memory::BatchArena>(pool_);
+    }
+    return batchArena_.get();
+  }
+
+  /// State derived from a vector, e.g. an index of the keys of a map vector,
+  /// shared by the functions that read the same vector in one batch.
+  struct BatchVectorState {
+    /// Keeps the vector alive so that its address is not reused in the batch.
+    VectorPtr vector;
+    std::shared_ptr<void> state;
+    /// The number of calls to batchVectorState() for the vector.
+    int32_t numUses{0};
+  };
+
+  /// Returns the state for the base vector of 'vector' in the batch being
+  /// evaluated, adding an empty one on first use. Returns nullptr outside of
+  /// a BatchScope. The states are dropped when the outermost scope ends.
+  BatchVectorState* batchVectorState(const VectorPtr& vector) {
+    if (batchScopeDepth_ == 0) {
+      return nullptr;
+    }
+    auto& entry = batchVectorStates_[vector->wrappedVector()];
+    if (entry.vector == nullptr) {
+      entry.vector = vector;
+    }
+    ++entry.numUses;
+    return &entry;
+  }
+
+  /// Scope of the evaluation of one batch, e.g. one ExprSet::eval call.
+  /// Scopes may nest. The batch arena and the batch vector states are reset
+  /// when the outermost scope ends.
+  class BatchScope {
+   public:
+    explicit BatchScope(ExecCtx& execCtx) : execCtx_(execCtx) {
+      ++execCtx_.batchScopeDepth_;
+    }
+
+    ~BatchScope() {
+      if (--execCtx_.batchScopeDepth_ == 0) {
+        if (execCtx_.batchArena_ != nullptr) {
+          execCtx_.batchArena_->reset();
+        }
+        execCtx_.batchVectorStates_.clear();
+      }
+    }
+
+    BatchScope(const BatchScope&) = delete;
+    BatchScope& operator=(const BatchScope&) = delete;
+
+   private:
+    ExecCtx& execCtx_;
+  };
+
  private:
   // Pool for all Buffers for this thread.
   memory::MemoryPool* const pool_;
@@ -403,6 +483,10 @@ class ExecCtx {
   // and operators.
   std::vector<std::unique_ptr<SelectivityVector>> selectivityVectorPool_;
   std::unique_ptr<VectorPool> vectorPool_;
+  // Created on first use.
+  std::unique_ptr<memory::BatchArena> batchArena_;
+  int32_t batchScopeDepth_{0};
+  std::unordered_map<const BaseVector*, BatchVectorState> batchVectorStates_;
 };
 
 } // namespace facebook::velox::core
@@ -16,11 +16,15 @@
 
 #include <folly/executors/QueuedImmediateExecutor.h>
 
+#include "velox/common/caching/FileIds.h"
+#include "velox/common/caching/PeerCache.h"
 #include "velox/common/process/TraceContext.h"
 #include "velox/common/time/Timer.h"
 #include "velox/dwio/common/CacheInputStream.h"
 #include "velox/dwio/common/CachedBufferedInput.h"
 
+DECLARE_int32(cache_prefetch_min_pct);
+
 using ::facebook::velox::common::Region;
 
 namespace facebook::velox::dwio::common {
@@ -146,6 +150,18 @@ google::protobuf::int64 CacheInputStream::ByteCount() const {
   return static_cast<google::protobuf::int64>(position_);
 }
 
+cache::AsyncDataCache* CacheInputStream::decompressedCache(
+    uint64_t offset,
+    cache::RawFileCacheKey& key) const {
+  // Data that is not retained raw is not worth retaining decompressed.
+  if (noCacheRetention_ || !cache_->options().cacheDecompressed ||
+      offset >= region_.length) {
+    return nullptr;
+  }
+  key = cache::RawFileCacheKey{fileNum_, region_.offset + offset};
+  return cache_;
+}
+
 void CacheInputStream::seekToPosition(PositionProvider& seekPosition) {
   position_ = seekPosition.next();
 }
@@ -234,6 +250,7 @@ void CacheInputStream::loadSync(const Region& region) {
       // Hit memory cache.
       ioStats_->ramHit().increment(hitSize);
     }
+    applyCachePolicy(*entry);
     if (!entry->isExclusive()) {
       return;
     }
@@ -246,18 +263,66 @@ void CacheInputStream::loadSync(const Region& region) {
       return;
     }
     const auto ranges = makeRanges(entry, region.length);
+    if (loadFromPeer(region, ranges)) {
+      entry->setExclusiveToShared(!noCacheRetention_, predictsReuse());
+      return;
+    }
     uint64_t storageReadUs{0};
     {
       MicrosecondTimer timer(&storageReadUs);
       input_->read(ranges, region.offset, LogType::FILE);
     }
+    if (auto* latencyModel = bufferedInput_->latencyModel()) {
+      latencyModel->record(region.length, storageReadUs);
+    }
     ioStats_->read().increment(region.length);
     ioStats_->queryThreadIoLatency().increment(storageReadUs);
     ioStats_->incTotalScanTime(storageReadUs * 1'000);
-    entry->setExclusiveToShared(!noCacheRetention_);
+    entry->setExclusiveToShared(!noCacheRetention_, predictsReuse());
   } while (pin_.empty());
 }
 
+bool CacheInputStream::loadFromPeer(
+    const velox::common::Region& region,
+    const std::vector<folly::Range<char*>>& ranges) {
+  auto* peerCache = cache_->peerCache();
+  if (peerCache == nullptr) {
+    return false;
+  }
+  uint64_t peerReadUs{0};
+  {
+    MicrosecondTimer timer(&peerReadUs);
+    if (!peerCache->read(fileIds().string(fileNum_), region.offset, ranges)) {
+      return false;
+    }
+  }
+  ioStats_->peerRead().increment(region.length);
+  ioStats_->queryThreadIoLatency().increment(peerReadUs);
+  return true;
+}
+
+void CacheInputStream::applyCachePolicy(
+    cache::AsyncDataCacheEntry& entry) const {
+  switch (cachePolicy_.kind) {
+    case io::CachePolicy::Kind::kPin:
+      entry.setKeepResident(true);
+      break;
+    case io::CachePolicy::Kind::kTtl:
+      // The time to live counts from the first read, not the last.
+      if (entry.expireTimeSec() == 0) {
+        entry.setExpireTimeSec(getCurrentTimeSec() + cachePolicy_.ttlSecs);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+bool CacheInputStream::predictsReuse() const {
+  return tracker_ != nullptr && !trackingId_.empty() &&
+      tracker_->predictsReuse(trackingId_, FLAGS_cache_prefetch_min_pct);
+}
+
 void CacheInputStream::clearCachePin() {
   if (pin_.empty()) {
     return;
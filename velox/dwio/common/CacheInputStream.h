@@ -20,6 +20,7 @@
 #include "velox/common/caching/ScanTracker.h"
 #include "velox/common/caching/SsdCache.h"
 #include "velox/common/io/IoStatistics.h"
+#include "velox/common/io/Options.h"
 #include "velox/dwio/common/InputStream.h"
 #include "velox/dwio/common/SeekableInputStream.h"
 
@@ -55,6 +56,9 @@ class CacheInputStream : public SeekableInputStream {
   void seekToPosition(PositionProvider& position) override;
   std::string getName() const override;
   size_t positionSize() const override;
+  cache::AsyncDataCache* decompressedCache(
+      uint64_t offset,
+      cache::RawFileCacheKey& key) const override;
 
   /// Returns a copy of 'this', ranging over the same bytes. The clone is
   /// initially positioned at the position of 'this' and can be moved
@@ -78,6 +82,7 @@ class CacheInputStream : public SeekableInputStream {
         groupId_,
         loadQuantum_);
     copy->position_ = position_;
+    copy->cachePolicy_ = cachePolicy_;
     return copy;
   }
 
@@ -98,6 +103,11 @@ class CacheInputStream : public SeekableInputStream {
     prefetchPct_ = pct;
   }
 
+  /// Sets the retention of the cache entries read through 'this'.
+  void setCachePolicy(io::CachePolicy policy) {
+    cachePolicy_ = policy;
+  }
+
   bool testingNoCacheRetention() const {
     return noCacheRetention_;
   }
@@ -119,6 +129,19 @@ class CacheInputStream : public SeekableInputStream {
       const velox::common::Region& region,
       cache::AsyncDataCacheEntry& entry);
 
+  // Returns true if there is a peer cache and the peer that owns the file
+  // served 'region' into 'ranges'.
+  bool loadFromPeer(
+      const velox::common::Region& region,
+      const std::vector<folly::Range<char*>>& ranges);
+
+  // Marks 'entry' for retention per 'cachePolicy_'.
+  void applyCachePolicy(cache::AsyncDataCacheEntry& entry) const;
+
+  // True if 'tracker_' predicts that the data of 'trackingId_' is read again.
+  // Decides SSD admission of the loaded entries.
+  bool predictsReuse() const;
+
   // Invoked to clear the cache pin of the accessed cache entry and mark it as
   // immediate evictable if 'noCacheRetention_' flag is set.
   void clearCachePin();
@@ -135,6 +158,7 @@ class CacheInputStream : public SeekableInputStream {
   // unpinning. This applies to sequential reads where second access
   // to the page is not expected.
   const bool noCacheRetention_;
+  io::CachePolicy cachePolicy_;
   // The region of 'input' 'this' ranges over.
   const velox::common::Region region_;
   const uint64_t fileNum_;
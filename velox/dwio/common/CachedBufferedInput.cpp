@@ -15,8 +15,11 @@
  */
 
 #include "velox/dwio/common/CachedBufferedInput.h"
+#include "velox/common/caching/FileIds.h"
+#include "velox/common/caching/PeerCache.h"
 #include "velox/common/memory/Allocation.h"
 #include "velox/common/process/TraceContext.h"
+#include "velox/common/time/Timer.h"
 #include "velox/dwio/common/CacheInputStream.h"
 
 DECLARE_int32(cache_prefetch_min_pct);
@@ -52,17 +55,20 @@ std::unique_ptr<SeekableInputStream> CachedBufferedInput::enqueue(
   if (tracker_ != nullptr) {
     tracker_->recordReference(id, region.length, fileNum_, groupId_);
   }
+  const auto cachePolicy = options_.cachePolicy(region.label);
   auto stream = std::make_unique<CacheInputStream>(
       this,
       ioStats_.get(),
       region,
       input_,
       fileNum_,
-      options_.noCacheRetention(),
+      options_.noCacheRetention() ||
+          cachePolicy.kind == io::CachePolicy::Kind::kNeverCache,
       tracker_,
       id,
       groupId_,
       options_.loadQuantum());
+  stream->setCachePolicy(cachePolicy);
   requests_.back().stream = stream.get();
   return stream;
 }
@@ -238,7 +244,7 @@ std::vector<int32_t> CachedBufferedInput::groupRequests(
   if (requests.empty() || (requests.size() < 2 && !prefetch)) {
     return {};
   }
-  const int32_t maxDistance = kSsd ? 20000 : options_.maxCoalesceDistance();
+  const int32_t maxDistance = kSsd ? 20000 : options_.coalesceDistance();
 
   // Combine adjacent short reads.
   int64_t coalescedBytes = 0;
@@ -369,10 +375,12 @@ class DwioCoalescedLoad : public DwioCoalescedLoadBase {
       std::shared_ptr<IoStatistics> ioStats,
       uint64_t groupId,
       std::vector<CacheRequest*> requests,
-      int32_t maxCoalesceDistance)
+      int32_t maxCoalesceDistance,
+      std::shared_ptr<io::IoLatencyModel> latencyModel)
       : DwioCoalescedLoadBase(cache, ioStats, groupId, std::move(requests)),
         input_(std::move(input)),
-        maxCoalesceDistance_(maxCoalesceDistance) {}
+        maxCoalesceDistance_(maxCoalesceDistance),
+        latencyModel_(std::move(latencyModel)) {}
 
   std::vector<CachePin> loadData(bool prefetch) override {
     std::vector<CachePin> pins;
@@ -389,6 +397,11 @@ class DwioCoalescedLoad : public DwioCoalescedLoadBase {
     if (pins.empty()) {
       return pins;
     }
+    auto* peerCache = cache_.peerCache();
+    const auto fileName = peerCache != nullptr
+        ? fileIds().string(keys_[0].fileNum)
+        : std::string();
+    int64_t peerBytes = 0;
     auto stats = cache::readPins(
         pins,
         maxCoalesceDistance_,
@@ -399,14 +412,41 @@ class DwioCoalescedLoad : public DwioCoalescedLoadBase {
             int32_t /*end*/,
             uint64_t offset,
             const std::vector<folly::Range<char*>>& buffers) {
-          input_->read(buffers, offset, LogType::FILE);
+          if (peerCache != nullptr &&
+              peerCache->read(fileName, offset, buffers)) {
+            for (const auto& buffer : buffers) {
+              if (buffer.data() != nullptr) {
+                peerBytes += buffer.size();
+              }
+            }
+            return;
+          }
+          uint64_t readUs{0};
+          {
+            MicrosecondTimer timer(&readUs);
+            input_->read(buffers, offset, LogType::FILE);
+          }
+          if (latencyModel_ != nullptr) {
+            uint64_t readBytes = 0;
+            for (const auto& buffer : buffers) {
+              readBytes += buffer.size();
+            }
+            latencyModel_->record(readBytes, readUs);
+          }
         });
+    if (peerBytes > 0) {
+      stats.payloadBytes -= peerBytes;
+      if (ioStats_ != nullptr) {
+        ioStats_->peerRead().increment(peerBytes);
+      }
+    }
     updateStats(stats, prefetch, false);
     return pins;
   }
 
   std::shared_ptr<ReadFileInputStream> input_;
   const int32_t maxCoalesceDistance_;
+  const std::shared_ptr<io::IoLatencyModel> latencyModel_;
 };
 
 // Represents a CoalescedLoad from local SSD cache.
@@ -461,7 +501,8 @@ void CachedBufferedInput::readRegion(
         ioStats_,
         groupId_,
         requests,
-        options_.maxCoalesceDistance());
+        options_.coalesceDistance(),
+        options_.latencyModel());
   }
   allCoalescedLoads_.push_back(load);
   coalescedLoads_.withWLock([&](auto& loads) {
@@ -533,7 +574,7 @@ std::unique_ptr<SeekableInputStream> CachedBufferedInput::read(
     uint64_t length,
     LogType /*logType*/) const {
   VELOX_CHECK_LE(offset + length, fileSize_);
-  return std::make_unique<CacheInputStream>(
+  auto stream = std::make_unique<CacheInputStream>(
       const_cast<CachedBufferedInput*>(this),
       ioStats_.get(),
       Region{offset, length},
@@ -544,6 +585,8 @@ std::unique_ptr<SeekableInputStream> CachedBufferedInput::read(
       TrackingId(),
       0,
       options_.loadQuantum());
+  stream->setCachePolicy(options_.cachePolicy());
+  return stream;
 }
 
 bool CachedBufferedInput::prefetch(Region region) {
@@ -161,6 +161,11 @@ class CachedBufferedInput : public BufferedInput {
     return cache_;
   }
 
+  /// Returns the model to record storage reads in or nullptr if none.
+  io::IoLatencyModel* latencyModel() const {
+    return options_.latencyModel().get();
+  }
+
   /// Returns the CoalescedLoad that contains the correlated loads for 'stream'
   /// or nullptr if none. Returns nullptr on all but first call for 'stream'
   /// since the load is to be triggered by the first access.
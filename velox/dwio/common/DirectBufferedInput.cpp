@@ -129,7 +129,7 @@ std::vector<int32_t> DirectBufferedInput::groupRequests(
     // eligible to prefetch. This will be loaded by itself on first use.
     return {};
   }
-  const int32_t maxDistance = options_.maxCoalesceDistance();
+  const int32_t maxDistance = options_.coalesceDistance();
   const auto loadQuantum = options_.loadQuantum();
   // If reading densely accessed, coalesce into large for best throughput, if
   // for sparse, coalesce to quantum to reduce overread. Not all sparse access
@@ -184,7 +184,13 @@ void DirectBufferedInput::readRegion(
     return;
   }
   auto load = std::make_shared<DirectCoalescedLoad>(
-      input_, ioStats_, groupId_, requests, *pool_, options_.loadQuantum());
+      input_,
+      ioStats_,
+      groupId_,
+      requests,
+      *pool_,
+      options_.loadQuantum(),
+      options_.latencyModel());
   coalescedLoads_.push_back(load);
   streamToCoalescedLoad_.withWLock([&](auto& loads) {
     for (auto& request : requests) {
@@ -309,6 +315,9 @@ std::vector<cache::CachePin> DirectCoalescedLoad::loadData(bool prefetch) {
     MicrosecondTimer timer(&usecs);
     input_->read(buffers, requests_[0].region.offset, LogType::FILE);
   }
+  if (latencyModel_ != nullptr) {
+    latencyModel_->record(size + overread, usecs);
+  }
 
   ioStats_->read().increment(size + overread);
   ioStats_->incRawBytesRead(size);
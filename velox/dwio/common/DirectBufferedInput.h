@@ -55,12 +55,14 @@ class DirectCoalescedLoad : public cache::CoalescedLoad {
       uint64_t groupId,
       const std::vector<LoadRequest*>& requests,
       memory::MemoryPool& pool,
-      int32_t loadQuantum)
+      int32_t loadQuantum,
+      std::shared_ptr<io::IoLatencyModel> latencyModel = nullptr)
       : CoalescedLoad({}, {}),
         ioStats_(ioStats),
         groupId_(groupId),
         input_(std::move(input)),
         loadQuantum_(loadQuantum),
+        latencyModel_(std::move(latencyModel)),
         pool_(pool) {
     VELOX_DCHECK(
         std::is_sorted(requests.begin(), requests.end(), [](auto* x, auto* y) {
@@ -98,6 +100,7 @@ class DirectCoalescedLoad : public cache::CoalescedLoad {
   const uint64_t groupId_;
   const std::shared_ptr<ReadFileInputStream> input_;
   const int32_t loadQuantum_;
+  const std::shared_ptr<io::IoLatencyModel> latencyModel_;
   memory::MemoryPool& pool_;
   std::vector<LoadRequest> requests_;
 };
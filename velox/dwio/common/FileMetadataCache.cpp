@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/common/FileMetadataCache.h"
+
+#include <gflags/gflags.h>
+
+DECLARE_uint64(velox_file_metadata_cache_bytes);
+
+namespace facebook::velox::dwio::common {
+
+// static
+FileMetadataCache* FileMetadataCache::getInstance() {
+  if (FLAGS_velox_file_metadata_cache_bytes == 0) {
+    return nullptr;
+  }
+  static FileMetadataCache instance(FLAGS_velox_file_metadata_cache_bytes);
+  return &instance;
+}
+
+// static
+std::optional<std::string> FileMetadataCache::makeKey(
+    FileFormat format,
+    const ReadFile& file,
+    std::optional<int64_t> modificationTime) {
+  if (!modificationTime.has_value()) {
+    return std::nullopt;
+  }
+  const auto name = file.getName();
+  if (name.empty()) {
+    return std::nullopt;
+  }
+  return fmt::format(
+      "{}:{}:{}:{}",
+      toString(format),
+      file.size(),
+      modificationTime.value(),
+      name);
+}
+
+std::shared_ptr<const void> FileMetadataCache::getImpl(
+    const std::string& key) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    ++numMisses_;
+    return nullptr;
+  }
+  ++numHits_;
+  lru_.splice(lru_.begin(), lru_, it->second);
+  return it->second->metadata;
+}
+
+void FileMetadataCache::put(
+    const std::string& key,
+    std::shared_ptr<const void> metadata,
+    uint64_t bytes) {
+  VELOX_CHECK_NOT_NULL(metadata);
+  if (bytes > capacityBytes_) {
+    return;
+  }
+  // The replaced and evicted metadata are freed outside of the lock.
+  std::shared_ptr<const void> replaced;
+  std::list<Entry> evicted;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      bytes_ -= it->second->bytes;
+      replaced = std::move(it->second->metadata);
+      lru_.erase(it->second);
+      entries_.erase(it);
+    }
+    lru_.push_front(Entry{key, std::move(metadata), bytes});
+    entries_[key] = lru_.begin();
+    bytes_ += bytes;
+    while (bytes_ > capacityBytes_) {
+      auto& victim = lru_.back();
+      bytes_ -= victim.bytes;
+      entries_.erase(victim.key);
+      evicted.splice(evicted.end(), lru_, std::prev(lru_.end()));
+      ++numEvictions_;
+    }
+  }
+}
+
+void FileMetadataCache::clear() {
+  std::list<Entry> entries;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    entries.swap(lru_);
+    entries_.clear();
+    bytes_ = 0;
+  }
+}
+
+FileMetadataCache::Stats FileMetadataCache::stats() const {
+  std::lock_guard<std::mutex> l(mutex_);
+  Stats stats;
+  stats.numHits = numHits_;
+  stats.numMisses = numMisses_;
+  stats.numEvictions = numEvictions_;
+  stats.numEntries = entries_.size();
+  stats.bytes = bytes_;
+  return stats;
+}
+
+} // namespace facebook::velox::dwio::common
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <list>
+#include <mutex>
+
+#include <folly/container/F14Map.h>
+
+#include "velox/common/file/File.h"
+#include "velox/dwio/common/Options.h"
+
+namespace facebook::velox::dwio::common {
+
+/// Process-wide cache of parsed file footers, e.g. the Parquet FileMetaData
+/// thrift or the DWRF PostScript and Footer protobufs. The splits of a file
+/// and the queries over it share one parsed copy instead of each reader
+/// fetching and parsing the footer again. Cached metadata is immutable and
+/// stays alive while a reader uses it, also after it is evicted. Entries are
+/// accounted by an estimate of their memory and evicted in LRU order when the
+/// total exceeds the capacity.
+class FileMetadataCache {
+ public:
+  struct Stats {
+    uint64_t numHits{0};
+    uint64_t numMisses{0};
+    uint64_t numEvictions{0};
+    uint64_t numEntries{0};
+    uint64_t bytes{0};
+  };
+
+  explicit FileMetadataCache(uint64_t capacityBytes)
+      : capacityBytes_(capacityBytes) {
+    VELOX_CHECK_GT(capacityBytes_, 0);
+  }
+
+  /// Returns the process-wide cache, or nullptr if
+  /// --velox_file_metadata_cache_bytes is 0. The capacity is set on first
+  /// use.
+  static FileMetadataCache* getInstance();
+
+  /// Returns the key of the metadata of 'file' in 'format'. The key covers the
+  /// file name, size and 'modificationTime', so that a rewritten file does not
+  /// hit the metadata of its earlier version. Returns std::nullopt if
+  /// 'modificationTime' is not known or 'file' has no name.
+  static std::optional<std::string> makeKey(
+      FileFormat format,
+      const ReadFile& file,
+      std::optional<int64_t> modificationTime);
+
+  /// Returns the metadata cached under 'key' or nullptr. 'T' must be the type
+  /// the metadata was put with. The type is implied by the file format in the
+  /// key.
+  template <typename T>
+  std::shared_ptr<const T> get(const std::string& key) {
+    return std::static_pointer_cast<const T>(getImpl(key));
+  }
+
+  /// Caches 'metadata' under 'key'. 'bytes' is the estimated memory of
+  /// 'metadata'. Replaces a previous entry for 'key'. Does nothing if 'bytes'
+  /// is over the capacity.
+  void put(
+      const std::string& key,
+      std::shared_ptr<const void> metadata,
+      uint64_t bytes);
+
+  /// Drops all entries.
+  void clear();
+
+  Stats stats() const;
+
+ private:
+  struct Entry {
+    std::string key;
+    std::shared_ptr<const void> metadata;
+    uint64_t bytes;
+  };
+
+  std::shared_ptr<const void> getImpl(const std::string& key);
+
+  const uint64_t capacityBytes_;
+
+  mutable std::mutex mutex_;
+  // Entries with the most recently used first.
+  std::list<Entry> lru_;
+  folly::F14FastMap<std::string, std::list<Entry>::iterator> entries_;
+  uint64_t bytes_{0};
+  uint64_t numHits_{0};
+  uint64_t numMisses_{0};
+  uint64_t numEvictions_{0};
+};
+
+} // namespace facebook::velox::dwio::common
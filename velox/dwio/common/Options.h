@@ -108,6 +108,10 @@ struct TableParameter {
   /// string.
   static constexpr const char* kSerializationNullFormat =
       "serialization.null.format";
+  /// If present in the table parameters, sets the retention of the table data
+  /// in the cache. One of 'pin', 'ttl=<seconds>' or 'never-cache'. A column
+  /// gets its own policy with the parameter 'cache.policy.<column name>'.
+  static constexpr const char* kCachePolicy = "cache.policy";
 };
 
 /// Implicit row number column to be added.  This column will be removed in the
@@ -477,6 +481,14 @@ class ReaderOptions : public io::ReaderOptions {
     return *this;
   }
 
+  /// Sets the retriever of the column and footer keys of files written with
+  /// modular encryption, e.g. Parquet.
+  ReaderOptions& setKeyRetriever(
+      std::shared_ptr<encryption::KeyRetriever> keyRetriever) {
+    keyRetriever_ = std::move(keyRetriever);
+    return *this;
+  }
+
   ReaderOptions& setFooterEstimatedSize(uint64_t size) {
     footerEstimatedSize_ = size;
     return *this;
@@ -539,6 +551,10 @@ class ReaderOptions : public io::ReaderOptions {
     return decrypterFactory_;
   }
 
+  const std::shared_ptr<encryption::KeyRetriever>& keyRetriever() const {
+    return keyRetriever_;
+  }
+
   uint64_t footerEstimatedSize() const {
     return footerEstimatedSize_;
   }
@@ -599,12 +615,23 @@ class ReaderOptions : public io::ReaderOptions {
     selectiveNimbleReaderEnabled_ = value;
   }
 
+  /// Sets the modification time of the file. Readers share the parsed footer
+  /// of the file through FileMetadataCache only if it is known.
+  void setFileModificationTime(std::optional<int64_t> modificationTime) {
+    fileModificationTime_ = modificationTime;
+  }
+
+  std::optional<int64_t> fileModificationTime() const {
+    return fileModificationTime_;
+  }
+
  private:
   uint64_t tailLocation_;
   FileFormat fileFormat_;
   RowTypePtr fileSchema_;
   SerDeOptions serDeOptions_;
   std::shared_ptr<encryption::DecrypterFactory> decrypterFactory_;
+  std::shared_ptr<encryption::KeyRetriever> keyRetriever_;
   uint64_t footerEstimatedSize_{kDefaultFooterEstimatedSize};
   uint64_t filePreloadThreshold_{kDefaultFilePreloadThreshold};
   bool fileColumnNamesReadAsLowerCase_{false};
@@ -615,6 +642,7 @@ class ReaderOptions : public io::ReaderOptions {
   const tz::TimeZone* sessionTimezone_{nullptr};
   bool adjustTimestampToTimezone_{false};
   bool selectiveNimbleReaderEnabled_{false};
+  std::optional<int64_t> fileModificationTime_;
 };
 
 struct WriterOptions {
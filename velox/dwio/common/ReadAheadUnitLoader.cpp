@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/common/ReadAheadUnitLoader.h"
+
+#include <atomic>
+#include <map>
+#include <numeric>
+
+#include "velox/common/base/AsyncSource.h"
+#include "velox/common/base/Exceptions.h"
+#include "velox/dwio/common/MeasureTime.h"
+
+namespace facebook::velox::dwio::common {
+
+namespace {
+
+class ReadAheadUnitLoader : public UnitLoader {
+ public:
+  ReadAheadUnitLoader(
+      std::vector<std::unique_ptr<LoadUnit>> loadUnits,
+      std::shared_ptr<folly::Executor> executor,
+      uint32_t maxLookahead,
+      uint64_t maxLookaheadBytes,
+      memory::MemoryPool* pool,
+      std::function<void(std::chrono::high_resolution_clock::duration)>
+          blockedOnIoCallback)
+      : loadUnits_{std::move(loadUnits)},
+        executor_{std::move(executor)},
+        maxLookahead_{maxLookahead},
+        maxLookaheadBytes_{maxLookaheadBytes},
+        pool_{pool},
+        blockedOnIoCallback_{std::move(blockedOnIoCallback)} {}
+
+  ~ReadAheadUnitLoader() override {
+    // The loads in flight reference the units.
+    for (auto& [unit, load] : loads_) {
+      load.source->close();
+    }
+  }
+
+  LoadUnit& getLoadedUnit(uint32_t unit) override {
+    VELOX_CHECK_LT(unit, loadUnits_.size(), "Unit out of range");
+
+    // Frees the units before 'unit' and the ones loaded ahead of a unit
+    // before a seek that are not ahead of 'unit'.
+    for (auto it = loads_.begin(); it != loads_.end();) {
+      if (it->first < unit || it->first > unit + maxLookahead_) {
+        release(it->first, it->second);
+        it = loads_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+
+    auto it = loads_.find(unit);
+    if (it == loads_.end()) {
+      it = loads_.emplace(unit, makeLoad(unit, 0, false)).first;
+    }
+    // Starts the next loads before waiting for 'unit'.
+    readAhead(unit);
+
+    auto& load = it->second;
+    if (!load.done) {
+      if (load.source->hasValue()) {
+        load.source->move();
+      } else {
+        auto measure = measureTimeIfCallback(blockedOnIoCallback_);
+        load.source->move();
+      }
+      load.done = true;
+    }
+    return *loadUnits_[unit];
+  }
+
+  void onRead(uint32_t unit, uint64_t rowOffsetInUnit, uint64_t /* rowCount */)
+      override {
+    VELOX_CHECK_LT(unit, loadUnits_.size(), "Unit out of range");
+    VELOX_CHECK_LT(
+        rowOffsetInUnit, loadUnits_[unit]->getNumRows(), "Row out of range");
+  }
+
+  void onSeek(uint32_t unit, uint64_t rowOffsetInUnit) override {
+    VELOX_CHECK_LT(unit, loadUnits_.size(), "Unit out of range");
+    VELOX_CHECK_LE(
+        rowOffsetInUnit, loadUnits_[unit]->getNumRows(), "Row out of range");
+  }
+
+ private:
+  struct Load {
+    std::shared_ptr<AsyncSource<bool>> source;
+    // Set once the unit is loaded, on whichever thread loaded it.
+    std::shared_ptr<std::atomic_bool> loaded;
+    // IO size of the unit if it counts against 'maxLookaheadBytes_'.
+    uint64_t ioSize{0};
+    // True once getLoadedUnit() has waited for the load.
+    bool done{false};
+  };
+
+  Load makeLoad(uint32_t unit, uint64_t ioSize, bool async) {
+    Load load;
+    load.ioSize = ioSize;
+    load.loaded = std::make_shared<std::atomic_bool>(false);
+    load.source = std::make_shared<AsyncSource<bool>>(
+        [loadUnit = loadUnits_[unit].get(), loaded = load.loaded]() {
+          loadUnit->load();
+          *loaded = true;
+          return std::make_unique<bool>(true);
+        });
+    if (async) {
+      executor_->add([source = load.source]() { source->prepare(); });
+    }
+    return load;
+  }
+
+  // Schedules the loads of the units after 'unit' that are within the
+  // lookahead and the memory caps.
+  void readAhead(uint32_t unit) {
+    const uint64_t lastUnit =
+        std::min<uint64_t>(unit + maxLookahead_, loadUnits_.size() - 1);
+    uint64_t bytesAhead = 0;
+    for (uint64_t next = unit + 1; next <= lastUnit; ++next) {
+      auto it = loads_.find(next);
+      if (it != loads_.end()) {
+        bytesAhead += it->second.ioSize;
+        continue;
+      }
+      // The sizes are only needed if more than the next unit may be loaded
+      // ahead. The unit is not loading, so it is safe to ask for its size.
+      const uint64_t ioSize =
+          maxLookahead_ > 1 ? loadUnits_[next]->getIoSize() : 0;
+      if (next > unit + 1 &&
+          (bytesAhead + ioSize > maxLookaheadBytes_ || !fitsInMemory(ioSize))) {
+        break;
+      }
+      loads_.emplace(next, makeLoad(next, ioSize, true));
+      bytesAhead += ioSize;
+    }
+  }
+
+  bool fitsInMemory(uint64_t ioSize) const {
+    if (pool_ == nullptr) {
+      return true;
+    }
+    auto* root = pool_->root();
+    const auto capacity = root->maxCapacity();
+    return capacity == memory::kMaxMemory ||
+        root->usedBytes() + static_cast<int64_t>(ioSize) <= capacity;
+  }
+
+  void release(uint32_t unit, Load& load) {
+    // Waits for a load in flight and cancels one that has not started.
+    load.source->close();
+    if (*load.loaded) {
+      loadUnits_[unit]->unload();
+    }
+  }
+
+  const std::vector<std::unique_ptr<LoadUnit>> loadUnits_;
+  const std::shared_ptr<folly::Executor> executor_;
+  const uint32_t maxLookahead_;
+  const uint64_t maxLookaheadBytes_;
+  memory::MemoryPool* const pool_;
+  const std::function<void(std::chrono::high_resolution_clock::duration)>
+      blockedOnIoCallback_;
+  // The units that are loaded or loading, by unit index.
+  std::map<uint32_t, Load> loads_;
+};
+
+} // namespace
+
+ReadAheadUnitLoaderFactory::ReadAheadUnitLoaderFactory(
+    std::shared_ptr<folly::Executor> executor,
+    uint32_t maxLookahead,
+    uint64_t maxLookaheadBytes,
+    memory::MemoryPool* pool,
+    std::function<void(std::chrono::high_resolution_clock::duration)>
+        blockedOnIoCallback)
+    : executor_{std::move(executor)},
+      maxLookahead_{maxLookahead},
+      maxLookaheadBytes_{maxLookaheadBytes},
+      pool_{pool},
+      blockedOnIoCallback_{std::move(blockedOnIoCallback)} {
+  VELOX_CHECK_NOT_NULL(executor_);
+  VELOX_CHECK_GT(maxLookahead_, 0);
+}
+
+std::unique_ptr<UnitLoader> ReadAheadUnitLoaderFactory::create(
+    std::vector<std::unique_ptr<LoadUnit>> loadUnits,
+    uint64_t rowsToSkip) {
+  const auto totalRows = std::accumulate(
+      loadUnits.cbegin(), loadUnits.cend(), 0UL, [](uint64_t sum, auto& unit) {
+        return sum + unit->getNumRows();
+      });
+  VELOX_CHECK_LE(
+      rowsToSkip,
+      totalRows,
+      "Can only skip up to the past-the-end row of the file.");
+  return std::make_unique<ReadAheadUnitLoader>(
+      std::move(loadUnits),
+      executor_,
+      maxLookahead_,
+      maxLookaheadBytes_,
+      pool_,
+      blockedOnIoCallback_);
+}
+
+} // namespace facebook::velox::dwio::common
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+
+#include <folly/Executor.h>
+
+#include "velox/common/memory/MemoryPool.h"
+#include "velox/dwio/common/UnitLoader.h"
+
+namespace facebook::velox::dwio::common {
+
+/// Creates unit loaders that load the units after the one being read on
+/// 'executor', so that the reader does not wait for IO when it moves to the
+/// next unit. Up to 'maxLookahead' units past the current one are loaded
+/// ahead. The next unit is always loaded ahead. The ones after it are loaded
+/// only while the IO size of the units loaded ahead is within
+/// 'maxLookaheadBytes' and, if 'pool' is set, while the root of 'pool' has
+/// room for the unit under its max capacity.
+class ReadAheadUnitLoaderFactory : public UnitLoaderFactory {
+ public:
+  ReadAheadUnitLoaderFactory(
+      std::shared_ptr<folly::Executor> executor,
+      uint32_t maxLookahead,
+      uint64_t maxLookaheadBytes,
+      memory::MemoryPool* pool,
+      std::function<void(std::chrono::high_resolution_clock::duration)>
+          blockedOnIoCallback);
+
+  ~ReadAheadUnitLoaderFactory() override = default;
+
+  std::unique_ptr<UnitLoader> create(
+      std::vector<std::unique_ptr<LoadUnit>> loadUnits,
+      uint64_t rowsToSkip) override;
+
+ private:
+  const std::shared_ptr<folly::Executor> executor_;
+  const uint32_t maxLookahead_;
+  const uint64_t maxLookaheadBytes_;
+  memory::MemoryPool* const pool_;
+  const std::function<void(std::chrono::high_resolution_clock::duration)>
+      blockedOnIoCallback_;
+};
+
+} // namespace facebook::velox::dwio::common
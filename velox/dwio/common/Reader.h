@@ -21,6 +21,8 @@
 #include <optional>
 #include <string>
 
+#include <folly/Range.h>
+
 #include "velox/dwio/common/InputStream.h"
 #include "velox/dwio/common/Mutation.h"
 #include "velox/dwio/common/Options.h"
@@ -80,6 +82,20 @@ class RowReader {
    */
   virtual int64_t nextReadSize(uint64_t size) = 0;
 
+  /**
+   * Reads the rows at 'rowNumbers' into 'result', for point lookups of a few
+   * rows by row number. The row numbers are relative to the beginning of the
+   * file like nextRowNumber() and must be increasing. Rows that do not pass
+   * the filters are left out of 'result'. Readers with a row index seek to
+   * the row group of each row instead of reading the rows before it.
+   * @return number of rows in 'result'.
+   */
+  virtual uint64_t readRows(
+      folly::Range<const uint64_t*> /*rowNumbers*/,
+      velox::VectorPtr& /*result*/) {
+    VELOX_UNSUPPORTED("readRows() is not supported by this reader");
+  }
+
   /**
    * Update current reader statistics. The set of updated values is
    * implementation specific and depends on a format of a file being read.
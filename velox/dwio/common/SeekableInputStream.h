@@ -21,6 +21,11 @@
 #include "velox/dwio/common/PositionProvider.h"
 #include "velox/dwio/common/wrap/zero-copy-stream-wrapper.h"
 
+namespace facebook::velox::cache {
+class AsyncDataCache;
+struct RawFileCacheKey;
+} // namespace facebook::velox::cache
+
 namespace facebook::velox::dwio::common {
 
 void printBuffer(std::ostream& out, const char* buffer, uint64_t length);
@@ -49,6 +54,16 @@ class SeekableInputStream : public google::protobuf::io::ZeroCopyInputStream {
   }
 
   void readFully(char* buffer, size_t bufferSize);
+
+  // Returns the cache to keep the decompressed form of the compressed chunk
+  // that starts 'offset' bytes into this stream in and sets 'key' to the file
+  // key of the chunk. Returns nullptr if decompressed chunks of this stream
+  // are not cached.
+  virtual cache::AsyncDataCache* decompressedCache(
+      uint64_t /*offset*/,
+      cache::RawFileCacheKey& /*key*/) const {
+    return nullptr;
+  }
 };
 
 /**
@@ -22,13 +22,15 @@ SortingWriter::SortingWriter(
     std::unique_ptr<exec::SortBuffer> sortBuffer,
     vector_size_t maxOutputRowsConfig,
     uint64_t maxOutputBytesConfig,
-    uint64_t outputTimeSliceLimitMs)
+    uint64_t outputTimeSliceLimitMs,
+    folly::Executor* executor)
     : outputWriter_(std::move(writer)),
       maxOutputRowsConfig_(maxOutputRowsConfig),
       maxOutputBytesConfig_(maxOutputBytesConfig),
       finishTimeSliceLimitMs_(outputTimeSliceLimitMs),
       sortPool_(sortBuffer->pool()),
       canReclaim_(sortBuffer->canSpill()),
+      executor_(executor),
       sortBuffer_(std::move(sortBuffer)) {
   VELOX_CHECK_GT(maxOutputRowsConfig_, 0);
   VELOX_CHECK_GT(maxOutputBytesConfig_, 0);
@@ -39,6 +41,7 @@ SortingWriter::SortingWriter(
 }
 
 SortingWriter::~SortingWriter() {
+  waitForPrefetch();
   sortPool_->release();
 }
 
@@ -73,10 +76,12 @@ bool SortingWriter::finish() {
   RowVectorPtr output{nullptr};
   do {
     if (getCurrentTimeMs() - startTimeMs > finishTimeSliceLimitMs_) {
+      waitForPrefetch();
       return false;
     }
-    output = sortBuffer_->getOutput(maxOutputBatchRows);
+    output = nextOutput(maxOutputBatchRows);
     if (output != nullptr) {
+      prefetchOutput(maxOutputBatchRows);
       outputWriter_->write(output);
     }
   } while (output != nullptr);
@@ -96,6 +101,7 @@ void SortingWriter::close() {
 void SortingWriter::abort() {
   setState(State::kAborted);
 
+  waitForPrefetch();
   sortBuffer_.reset();
   sortPool_->release();
   outputWriter_->abort();
@@ -153,6 +159,33 @@ vector_size_t SortingWriter::outputBatchRows() {
   return std::min(estimatedMaxOutputRows, maxOutputRowsConfig_);
 }
 
+RowVectorPtr SortingWriter::nextOutput(vector_size_t maxOutputRows) {
+  if (!pendingOutput_.has_value()) {
+    return sortBuffer_->getOutput(maxOutputRows);
+  }
+  auto output = std::move(pendingOutput_.value()).get();
+  pendingOutput_.reset();
+  return output;
+}
+
+void SortingWriter::prefetchOutput(vector_size_t maxOutputRows) {
+  VELOX_CHECK(!pendingOutput_.has_value());
+  // Only the merge of spilled runs is worth moving off the writer thread. The
+  // output of an in-memory sort is a copy out of the sorted rows.
+  if (executor_ == nullptr || !sortBuffer_->hasSpilled()) {
+    return;
+  }
+  pendingOutput_ = folly::via(executor_, [this, maxOutputRows]() {
+    return sortBuffer_->getOutput(maxOutputRows);
+  });
+}
+
+void SortingWriter::waitForPrefetch() {
+  if (pendingOutput_.has_value()) {
+    pendingOutput_->wait();
+  }
+}
+
 std::unique_ptr<memory::MemoryReclaimer> SortingWriter::MemoryReclaimer::create(
     SortingWriter* writer) {
   return std::unique_ptr<memory::MemoryReclaimer>(new MemoryReclaimer(writer));
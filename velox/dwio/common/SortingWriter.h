@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <folly/Executor.h>
+#include <folly/futures/Future.h>
+
 #include "velox/dwio/common/Writer.h"
 #include "velox/exec/MemoryReclaimer.h"
 #include "velox/exec/SortBuffer.h"
@@ -23,6 +26,9 @@
 namespace facebook::velox::dwio::common {
 
 /// Sorting Writer object is used to write sorted data into a single file.
+/// If 'executor' is set and the sort buffer has spilled, the next output batch
+/// is merged from the spilled runs on 'executor' while the previous one is
+/// written, so that the merge and the file writer run in parallel.
 class SortingWriter : public Writer {
  public:
   SortingWriter(
@@ -30,7 +36,8 @@ class SortingWriter : public Writer {
       std::unique_ptr<exec::SortBuffer> sortBuffer,
       vector_size_t maxOutputRowsConfig,
       uint64_t maxOutputBytesConfig,
-      uint64_t outputTimeSliceLimitMs);
+      uint64_t outputTimeSliceLimitMs,
+      folly::Executor* executor = nullptr);
 
   ~SortingWriter() override;
 
@@ -78,14 +85,30 @@ class SortingWriter : public Writer {
 
   vector_size_t outputBatchRows();
 
+  // Returns the next sorted output batch, waiting for the one merged on
+  // 'executor_' if any.
+  RowVectorPtr nextOutput(vector_size_t maxOutputRows);
+
+  // Starts merging the next output batch on 'executor_' if the sort buffer has
+  // spilled.
+  void prefetchOutput(vector_size_t maxOutputRows);
+
+  // Waits for the merge started by prefetchOutput() to complete.
+  void waitForPrefetch();
+
   const std::unique_ptr<Writer> outputWriter_;
   const vector_size_t maxOutputRowsConfig_;
   const uint64_t maxOutputBytesConfig_;
   const uint64_t finishTimeSliceLimitMs_;
   memory::MemoryPool* const sortPool_;
   const bool canReclaim_;
+  folly::Executor* const executor_;
 
   std::unique_ptr<exec::SortBuffer> sortBuffer_;
+  // The output batch being merged on 'executor_'. Never pending outside of
+  // finish() so that the sort buffer is not touched concurrently with memory
+  // reclaim.
+  std::optional<folly::Future<RowVectorPtr>> pendingOutput_;
 };
 
 } // namespace facebook::velox::dwio::common
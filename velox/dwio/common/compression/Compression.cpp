@@ -15,13 +15,18 @@
  */
 
 #include "velox/dwio/common/compression/Compression.h"
+#include "velox/common/base/Counters.h"
+#include "velox/common/base/StatsReporter.h"
 #include "velox/common/compression/LzoDecompressor.h"
+#include "velox/common/time/Timer.h"
 #include "velox/dwio/common/IntCodecCommon.h"
 #include "velox/dwio/common/compression/PagedInputStream.h"
 
+#include <folly/Synchronized.h>
 #include <folly/logging/xlog.h>
 #include <lz4.h>
 #include <snappy.h>
+#include <unordered_map>
 #include <zlib.h>
 #include <zstd.h>
 #include <zstd_errors.h>
@@ -610,8 +615,97 @@ bool ZlibDecompressionStream::readOrSkip(const void** data, int32_t* size) {
   return true;
 }
 
+// Decompresses on a hardware accelerator and falls back to the CPU for the
+// chunks the accelerator fails on, e.g. when its queues are full or the chunk
+// uses a format feature it does not support.
+class HardwareDecompressor : public Decompressor {
+ public:
+  HardwareDecompressor(
+      std::unique_ptr<Decompressor> hardware,
+      std::unique_ptr<Decompressor> cpu,
+      uint64_t blockSize,
+      const std::string& streamDebugInfo)
+      : Decompressor{blockSize, streamDebugInfo},
+        hardware_{std::move(hardware)},
+        cpu_{std::move(cpu)} {}
+
+  uint64_t decompress(
+      const char* src,
+      uint64_t srcLength,
+      char* dest,
+      uint64_t destLength) override {
+    try {
+      uint64_t timeUs{0};
+      uint64_t length;
+      {
+        MicrosecondTimer timer(&timeUs);
+        length = hardware_->decompress(src, srcLength, dest, destLength);
+      }
+      RECORD_METRIC_VALUE(kMetricHardwareDecompressedBytes, length);
+      RECORD_METRIC_VALUE(kMetricHardwareDecompressTimeUs, timeUs);
+      return length;
+    } catch (const std::exception& e) {
+      RECORD_METRIC_VALUE(kMetricHardwareDecompressFallbackCount);
+      XLOG_EVERY_N(WARNING, 1000)
+          << "Hardware decompression failed, decompressing on CPU: "
+          << e.what() << " Info: " << streamDebugInfo_;
+      return cpu_->decompress(src, srcLength, dest, destLength);
+    }
+  }
+
+  std::pair<int64_t, bool> getDecompressedLength(
+      const char* src,
+      uint64_t srcLength) const override {
+    return cpu_->getDecompressedLength(src, srcLength);
+  }
+
+ private:
+  const std::unique_ptr<Decompressor> hardware_;
+  const std::unique_ptr<Decompressor> cpu_;
+};
+
+folly::Synchronized<
+    std::unordered_map<CompressionKind, HardwareDecompressorFactory>>&
+hardwareDecompressorFactories() {
+  static folly::Synchronized<
+      std::unordered_map<CompressionKind, HardwareDecompressorFactory>>
+      factories;
+  return factories;
+}
+
+std::unique_ptr<Decompressor> createHardwareDecompressor(
+    CompressionKind kind,
+    uint64_t blockSize,
+    const CompressionOptions& options,
+    const std::string& streamDebugInfo) {
+  HardwareDecompressorFactory factory;
+  {
+    auto factories = hardwareDecompressorFactories().rlock();
+    auto it = factories->find(kind);
+    if (it == factories->end()) {
+      return nullptr;
+    }
+    factory = it->second;
+  }
+  return factory(blockSize, options, streamDebugInfo);
+}
 } // namespace
 
+void registerHardwareDecompressor(
+    CompressionKind kind,
+    HardwareDecompressorFactory factory) {
+  VELOX_USER_CHECK_NE(
+      kind,
+      CompressionKind::CompressionKind_NONE,
+      "Uncompressed streams have no decompressor");
+  auto factories = hardwareDecompressorFactories().wlock();
+  if (factory) {
+    (*factories)[kind] = std::move(factory);
+  } else {
+    factories->erase(kind);
+  }
+}
+
 std::unique_ptr<Compressor> createCompressor(
     CompressionKind kind,
     const CompressionOptions& options) {
@@ -652,6 +746,11 @@ std::unique_ptr<dwio::common::SeekableInputStream> createDecompressor(
     const Decrypter* decrypter,
     bool useRawDecompression,
     size_t compressedLength) {
+  std::unique_ptr<Decompressor> hardware;
+  if (kind != CompressionKind::CompressionKind_NONE) {
+    hardware =
+        createHardwareDecompressor(kind, blockSize, options, streamDebugInfo);
+  }
   std::unique_ptr<Decompressor> decompressor;
   switch (static_cast<int64_t>(kind)) {
     case CompressionKind::CompressionKind_NONE:
@@ -661,7 +760,7 @@ std::unique_ptr<dwio::common::SeekableInputStream> createDecompressor(
       // decompressor remain as nullptr
       break;
     case CompressionKind::CompressionKind_ZLIB:
-      if (!decrypter) {
+      if (!decrypter && !hardware) {
         // When file is not encrypted, we can use zlib streaming codec to avoid
         // copying data
         return std::make_unique<ZlibDecompressionStream>(
@@ -678,7 +777,7 @@ std::unique_ptr<dwio::common::SeekableInputStream> createDecompressor(
           blockSize, options.format.zlib.windowBits, streamDebugInfo, false);
       break;
     case CompressionKind::CompressionKind_GZIP:
-      if (!decrypter) {
+      if (!decrypter && !hardware) {
         // When file is not encrypted, we can use zlib streaming codec to avoid
         // copying data
         return std::make_unique<ZlibDecompressionStream>(
@@ -717,6 +816,13 @@ std::unique_ptr<dwio::common::SeekableInputStream> createDecompressor(
     default:
       DWIO_RAISE("Unknown compression codec ", kind);
   }
+  if (hardware) {
+    decompressor = std::make_unique<HardwareDecompressor>(
+        std::move(hardware),
+        std::move(decompressor),
+        blockSize,
+        streamDebugInfo);
+  }
   return std::make_unique<PagedInputStream>(
       std::move(input),
       pool,
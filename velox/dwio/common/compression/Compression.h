@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "velox/common/compression/Compression.h"
 #include "velox/dwio/common/SeekableInputStream.h"
 #include "velox/dwio/common/encryption/Encryption.h"
@@ -89,6 +91,21 @@ struct CompressionOptions {
   uint32_t compressionThreshold;
 };
 
+/// Creates a decompressor backed by a hardware accelerator, e.g. Intel IAA or
+/// QAT. Returns nullptr if no accelerator is available for the stream.
+using HardwareDecompressorFactory =
+    std::function<std::unique_ptr<Decompressor>(
+        uint64_t blockSize,
+        const CompressionOptions& options,
+        const std::string& streamDebugInfo)>;
+
+/// Registers 'factory' to decompress the streams of 'kind' made by
+/// createDecompressor(). The chunks the hardware decompressor fails on are
+/// decompressed on the CPU. An empty 'factory' unregisters the previous one.
+void registerHardwareDecompressor(
+    facebook::velox::common::CompressionKind kind,
+    HardwareDecompressorFactory factory);
+
 /**
  * Create a decompressor for the given compression kind.
  * @param kind The compression type to implement
@@ -17,6 +17,48 @@
 #include "velox/dwio/common/compression/PagedInputStream.h"
 
 namespace facebook::velox::dwio::common::compression {
+namespace {
+// Copies the first 'size' bytes of the memory of 'entry' to or from 'buffer'.
+template <bool kToEntry>
+void copyEntryData(
+    cache::AsyncDataCacheEntry& entry,
+    char* buffer,
+    uint64_t size) {
+  if (entry.tinyData() != nullptr) {
+    if constexpr (kToEntry) {
+      ::memcpy(entry.tinyData(), buffer, size);
+    } else {
+      ::memcpy(buffer, entry.tinyData(), size);
+    }
+    return;
+  }
+  const auto& allocation = entry.data();
+  for (auto i = 0; i < allocation.numRuns() && size > 0; ++i) {
+    const auto run = allocation.runAt(i);
+    const auto bytes = std::min<uint64_t>(run.numBytes(), size);
+    if constexpr (kToEntry) {
+      ::memcpy(run.data<char>(), buffer, bytes);
+    } else {
+      ::memcpy(buffer, run.data<char>(), bytes);
+    }
+    buffer += bytes;
+    size -= bytes;
+  }
+}
+
+// Returns the memory of 'entry' if its first 'size' bytes are contiguous,
+// nullptr otherwise.
+char* contiguousEntryData(cache::AsyncDataCacheEntry& entry, uint64_t size) {
+  if (entry.tinyData() != nullptr) {
+    return entry.tinyData();
+  }
+  const auto& allocation = entry.data();
+  if (allocation.numRuns() == 1 && allocation.runAt(0).numBytes() >= size) {
+    return allocation.runAt(0).data<char>();
+  }
+  return nullptr;
+}
+} // namespace
 
 void PagedInputStream::prepareOutputBuffer(uint64_t uncompressedLength) {
   if (!outputBuffer_ || uncompressedLength > outputBuffer_->capacity()) {
@@ -128,8 +170,9 @@ bool PagedInputStream::readOrSkip(const void** data, int32_t* size) {
     return true;
   }
 
-  // release previous decryption buffer
+  // release previous decryption buffer and cache entry
   decryptionBuffer_ = nullptr;
+  outputPin_.clear();
 
   if (state_ == State::HEADER || remainingLength_ == 0) {
     readHeader();
@@ -185,17 +228,22 @@ bool PagedInputStream::readOrSkip(const void** data, int32_t* size) {
       *size = decompressedLength;
       outputBufferPtr_ = nullptr;
     } else {
-      prepareOutputBuffer(decompressedLength);
-      outputBufferLength_ = decompressor_->decompress(
-          input,
-          remainingLength_,
-          outputBuffer_->data(),
-          outputBuffer_->capacity());
+      const char* output =
+          exact ? decompressWithCache(input, decompressedLength) : nullptr;
+      if (output == nullptr) {
+        prepareOutputBuffer(decompressedLength);
+        outputBufferLength_ = decompressor_->decompress(
+            input,
+            remainingLength_,
+            outputBuffer_->data(),
+            outputBuffer_->capacity());
+        output = outputBuffer_->data();
+      }
       if (data) {
-        *data = outputBuffer_->data();
+        *data = output;
       }
       *size = static_cast<int32_t>(outputBufferLength_);
-      outputBufferPtr_ = outputBuffer_->data() + outputBufferLength_;
+      outputBufferPtr_ = output + outputBufferLength_;
     }
     // release decryption buffer
     decryptionBuffer_ = nullptr;
@@ -212,6 +260,71 @@ bool PagedInputStream::readOrSkip(const void** data, int32_t* size) {
   return true;
 }
 
+const char* PagedInputStream::decompressWithCache(
+    const char* input,
+    uint64_t decompressedLength) {
+  // The plaintext of encrypted streams is not shared between readers.
+  if (decrypter_ != nullptr || decompressedLength == 0) {
+    return nullptr;
+  }
+  cache::RawFileCacheKey key;
+  auto* cache = input_->decompressedCache(lastHeaderOffset_, key);
+  if (cache == nullptr) {
+    return nullptr;
+  }
+  cache::CachePin pin;
+  try {
+    pin = cache->findOrCreate(
+        cache::decodedCacheKey(key), decompressedLength, nullptr);
+  } catch (const VeloxException&) {
+    // No memory for the entry. Decompress without caching.
+    return nullptr;
+  }
+  // Empty if another reader is decompressing the same chunk.
+  if (pin.empty()) {
+    return nullptr;
+  }
+  auto* entry = pin.checkedEntry();
+  auto* entryData = contiguousEntryData(*entry, decompressedLength);
+  if (!entry->isExclusive()) {
+    outputBufferLength_ = decompressedLength;
+    if (entryData != nullptr) {
+      outputPin_ = std::move(pin);
+      return entryData;
+    }
+    prepareOutputBuffer(decompressedLength);
+    copyEntryData<false>(*entry, outputBuffer_->data(), decompressedLength);
+    return outputBuffer_->data();
+  }
+  if (entryData != nullptr) {
+    // Decompresses straight into the entry and returns views into it.
+    outputBufferLength_ = decompressor_->decompress(
+        input, remainingLength_, entryData, decompressedLength);
+    if (outputBufferLength_ == decompressedLength) {
+      entry->setExclusiveToShared(/*ssdSavable=*/false);
+      outputPin_ = std::move(pin);
+      return entryData;
+    }
+    // The entry is removed when the exclusive pin is dropped.
+    prepareOutputBuffer(outputBufferLength_);
+    ::memcpy(outputBuffer_->data(), entryData, outputBufferLength_);
+    return outputBuffer_->data();
+  }
+  prepareOutputBuffer(decompressedLength);
+  outputBufferLength_ = decompressor_->decompress(
+      input,
+      remainingLength_,
+      outputBuffer_->data(),
+      outputBuffer_->capacity());
+  // An exclusive pin that is dropped without being made shared removes the
+  // entry.
+  if (outputBufferLength_ == decompressedLength) {
+    copyEntryData<true>(*entry, outputBuffer_->data(), decompressedLength);
+    entry->setExclusiveToShared(/*ssdSavable=*/false);
+  }
+  return outputBuffer_->data();
+}
+
 void PagedInputStream::BackUp(int32_t count) {
   VELOX_CHECK_GE(count, 0);
   if (pendingSkip_ > 0) {
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "velox/common/caching/AsyncDataCache.h"
 #include "velox/dwio/common/SeekableInputStream.h"
 #include "velox/dwio/common/compression/Compression.h"
 
@@ -114,6 +115,16 @@ class PagedInputStream : public dwio::common::SeekableInputStream {
 
   void clearDecompressionState();
 
+  // Returns the decompressed form of the chunk at 'input' from the cache of
+  // 'input_', if 'input_' has one, and decompresses and caches the chunk on a
+  // miss. The result points into the cache entry, pinned in 'outputPin_', if
+  // the entry memory is contiguous and into 'outputBuffer_' otherwise. Sets
+  // 'outputBufferLength_' to its size. Returns nullptr if the chunk could not
+  // go through the cache and still needs to be decompressed.
+  const char* decompressWithCache(
+      const char* input,
+      uint64_t decompressedLength);
+
   enum class State { HEADER, START, ORIGINAL, END };
 
   // make sure input is contiguous for decompression/decryption
@@ -141,6 +152,10 @@ class PagedInputStream : public dwio::common::SeekableInputStream {
   // unencrypted output
   std::unique_ptr<folly::IOBuf> decryptionBuffer_{nullptr};
 
+  // Pin on the cache entry the current chunk is returned from. Keeps the views
+  // into the entry valid until the next chunk is read.
+  cache::CachePin outputPin_;
+
   // the current state
   State state_{State::HEADER};
 
@@ -99,6 +99,17 @@ class DecrypterFactory {
   virtual std::unique_ptr<Decrypter> create(EncryptionProvider provider) = 0;
 };
 
+/// Retrieves the keys of files written with modular encryption, e.g. Parquet,
+/// from the key metadata stored in the file.
+class KeyRetriever {
+ public:
+  virtual ~KeyRetriever() = default;
+
+  /// Returns the key for 'keyMetadata', or an empty string if the key is not
+  /// available to the reader.
+  virtual std::string getKey(const std::string& keyMetadata) = 0;
+};
+
 class DummyDecrypter : public Decrypter {
  public:
   void setKey(const std::string& /* unused */) override {}
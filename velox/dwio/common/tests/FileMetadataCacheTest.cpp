@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/common/FileMetadataCache.h"
+
+#include <gtest/gtest.h>
+
+using namespace facebook::velox;
+using namespace facebook::velox::dwio::common;
+
+TEST(FileMetadataCacheTest, makeKey) {
+  InMemoryReadFile file(std::string(100, 'x'));
+  ASSERT_FALSE(FileMetadataCache::makeKey(FileFormat::DWRF, file, std::nullopt)
+                   .has_value());
+  const auto key = FileMetadataCache::makeKey(FileFormat::DWRF, file, 1);
+  ASSERT_TRUE(key.has_value());
+  ASSERT_EQ(key, FileMetadataCache::makeKey(FileFormat::DWRF, file, 1));
+  ASSERT_NE(key, FileMetadataCache::makeKey(FileFormat::DWRF, file, 2));
+  ASSERT_NE(key, FileMetadataCache::makeKey(FileFormat::PARQUET, file, 1));
+  InMemoryReadFile longerFile(std::string(101, 'x'));
+  ASSERT_NE(key, FileMetadataCache::makeKey(FileFormat::DWRF, longerFile, 1));
+}
+
+TEST(FileMetadataCacheTest, getAndPut) {
+  FileMetadataCache cache(1'000);
+  ASSERT_EQ(cache.get<std::string>("a"), nullptr);
+  cache.put("a", std::make_shared<const std::string>("metadata a"), 100);
+  auto a = cache.get<std::string>("a");
+  ASSERT_NE(a, nullptr);
+  ASSERT_EQ(*a, "metadata a");
+
+  cache.put("a", std::make_shared<const std::string>("new metadata a"), 200);
+  ASSERT_EQ(*cache.get<std::string>("a"), "new metadata a");
+  // The replaced metadata stays valid for its user.
+  ASSERT_EQ(*a, "metadata a");
+
+  // Over the capacity, not cached.
+  cache.put("b", std::make_shared<const std::string>("metadata b"), 2'000);
+  ASSERT_EQ(cache.get<std::string>("b"), nullptr);
+
+  auto stats = cache.stats();
+  ASSERT_EQ(stats.numHits, 2);
+  ASSERT_EQ(stats.numMisses, 2);
+  ASSERT_EQ(stats.numEntries, 1);
+  ASSERT_EQ(stats.bytes, 200);
+
+  cache.clear();
+  ASSERT_EQ(cache.get<std::string>("a"), nullptr);
+  ASSERT_EQ(cache.stats().bytes, 0);
+}
+
+TEST(FileMetadataCacheTest, evict) {
+  FileMetadataCache cache(1'000);
+  for (auto i = 0; i < 4; ++i) {
+    cache.put(
+        std::to_string(i),
+        std::make_shared<const std::string>(std::to_string(i)),
+        300);
+  }
+  // The least recently used entry is evicted.
+  ASSERT_EQ(cache.get<std::string>("0"), nullptr);
+  ASSERT_NE(cache.get<std::string>("1"), nullptr);
+  auto stats = cache.stats();
+  ASSERT_EQ(stats.numEvictions, 1);
+  ASSERT_EQ(stats.numEntries, 3);
+  ASSERT_EQ(stats.bytes, 900);
+
+  // "1" was used last, so "2" is evicted next.
+  cache.put("4", std::make_shared<const std::string>("4"), 300);
+  ASSERT_NE(cache.get<std::string>("1"), nullptr);
+  ASSERT_EQ(cache.get<std::string>("2"), nullptr);
+  ASSERT_NE(cache.get<std::string>("3"), nullptr);
+  ASSERT_NE(cache.get<std::string>("4"), nullptr);
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/io/IoLatencyModel.h"
+
+#include <gtest/gtest.h>
+
+using namespace facebook::velox::io;
+
+TEST(IoLatencyModelTest, fit) {
+  IoLatencyModel model;
+  double latencyUs;
+  double bytesPerUs;
+  // 10ms to first byte and 100 bytes per microsecond, i.e. 100MB/s.
+  for (auto i = 0; i < IoLatencyModel::kMinSamples - 1; ++i) {
+    const uint64_t bytes = (i + 1) * 100'000;
+    model.record(bytes, 10'000 + bytes / 100);
+  }
+  ASSERT_FALSE(model.fit(latencyUs, bytesPerUs));
+  ASSERT_EQ(model.coalesceDistance(512 << 10), 512 << 10);
+
+  model.record(2'000'000, 10'000 + 20'000);
+  ASSERT_TRUE(model.fit(latencyUs, bytesPerUs));
+  ASSERT_NEAR(latencyUs, 10'000, 1);
+  ASSERT_NEAR(bytesPerUs, 100, 0.01);
+  // A gap of 1MB takes as long to read as a separate request.
+  ASSERT_NEAR(model.coalesceDistance(512 << 10), 1'000'000, 200);
+}
+
+TEST(IoLatencyModelTest, bounds) {
+  IoLatencyModel slow;
+  IoLatencyModel fast;
+  for (auto i = 0; i < IoLatencyModel::kMinSamples; ++i) {
+    const uint64_t bytes = (i + 1) * 100'000;
+    // 1s to first byte and 10us on local disk.
+    slow.record(bytes, 1'000'000 + bytes / 100);
+    fast.record(bytes, 10 + bytes / 1'000);
+  }
+  constexpr int32_t kDistance = 512 << 10;
+  ASSERT_EQ(
+      slow.coalesceDistance(kDistance),
+      kDistance * IoLatencyModel::kMaxDistanceFactor);
+  ASSERT_EQ(
+      fast.coalesceDistance(kDistance),
+      kDistance / IoLatencyModel::kMaxDistanceFactor);
+}
+
+TEST(IoLatencyModelTest, sameSizeReads) {
+  IoLatencyModel model;
+  for (auto i = 0; i < 2 * IoLatencyModel::kMinSamples; ++i) {
+    model.record(1 << 20, 1'000 + i);
+  }
+  double latencyUs;
+  double bytesPerUs;
+  // All reads of one size do not separate latency from throughput.
+  ASSERT_FALSE(model.fit(latencyUs, bytesPerUs));
+  ASSERT_EQ(model.coalesceDistance(512 << 10), 512 << 10);
+}
+
+TEST(IoLatencyModelTest, forPath) {
+  auto s3 = IoLatencyModel::forPath("s3://bucket/a.orc");
+  ASSERT_EQ(s3, IoLatencyModel::forPath("s3://other/b.orc"));
+  ASSERT_NE(s3, IoLatencyModel::forPath("hdfs://host/a.orc"));
+  ASSERT_EQ(
+      IoLatencyModel::forPath("/tmp/a.orc"),
+      IoLatencyModel::forPath("/data/b.orc"));
+  ASSERT_NE(s3, IoLatencyModel::forPath("/tmp/a.orc"));
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/executors/ManualExecutor.h>
+#include <gtest/gtest.h>
+
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/common/memory/Memory.h"
+#include "velox/dwio/common/ReadAheadUnitLoader.h"
+#include "velox/dwio/common/tests/utils/UnitLoaderTestTools.h"
+
+using namespace facebook::velox;
+using facebook::velox::dwio::common::LoadUnit;
+using facebook::velox::dwio::common::ReadAheadUnitLoaderFactory;
+using facebook::velox::dwio::common::test::getUnitsLoadedWithFalse;
+using facebook::velox::dwio::common::test::LoadUnitMock;
+using facebook::velox::dwio::common::test::ReaderMock;
+
+class ReadAheadUnitLoaderTest : public testing::Test {
+ protected:
+  static void SetUpTestCase() {
+    memory::MemoryManager::testingSetInstance({});
+  }
+
+  const std::shared_ptr<folly::ManualExecutor> executor_{
+      std::make_shared<folly::ManualExecutor>()};
+};
+
+TEST_F(ReadAheadUnitLoaderTest, loadsNextUnitAhead) {
+  size_t blockedOnIoCount = 0;
+  ReadAheadUnitLoaderFactory factory(
+      executor_, 1, 0, nullptr, [&](auto) { ++blockedOnIoCount; });
+  ReaderMock readerMock{{10, 20, 30}, {0, 0, 0}, factory, 0};
+
+  EXPECT_TRUE(readerMock.read(3)); // Unit: 0, rows: 0-2, load(0)
+  EXPECT_EQ(readerMock.unitsLoaded(), std::vector<bool>({true, false, false}));
+  EXPECT_EQ(blockedOnIoCount, 1);
+  executor_->drain(); // load(1)
+  EXPECT_EQ(readerMock.unitsLoaded(), std::vector<bool>({true, true, false}));
+
+  EXPECT_TRUE(readerMock.read(7)); // Unit: 0, rows: 3-9
+  EXPECT_TRUE(readerMock.read(14)); // Unit: 1, rows: 0-13, unload(0)
+  EXPECT_EQ(readerMock.unitsLoaded(), std::vector<bool>({false, true, false}));
+  EXPECT_EQ(blockedOnIoCount, 1);
+  executor_->drain(); // load(2)
+  EXPECT_EQ(readerMock.unitsLoaded(), std::vector<bool>({false, true, true}));
+
+  EXPECT_TRUE(readerMock.read(6)); // Unit: 1, rows: 14-19
+  EXPECT_TRUE(readerMock.read(30)); // Unit: 2, rows: 0-29, unload(1)
+  EXPECT_EQ(readerMock.unitsLoaded(), std::vector<bool>({false, false, true}));
+  EXPECT_EQ(blockedOnIoCount, 1);
+
+  EXPECT_FALSE(readerMock.read(30)); // No more data
+}
+
+TEST_F(ReadAheadUnitLoaderTest, waitsForLoadNotStarted) {
+  size_t blockedOnIoCount = 0;
+  ReadAheadUnitLoaderFactory factory(
+      executor_, 1, 0, nullptr, [&](auto) { ++blockedOnIoCount; });
+  ReaderMock readerMock{{10, 20}, {0, 0}, factory, 0};
+
+  EXPECT_TRUE(readerMock.read(10)); // Unit: 0, rows: 0-9, load(0)
+  // The executor has not run the load of unit 1, so the reader loads it.
+  EXPECT_TRUE(readerMock.read(10)); // Unit: 1, rows: 0-9, load(1)
+  EXPECT_EQ(readerMock.unitsLoaded(), std::vector<bool>({false, true}));
+  EXPECT_EQ(blockedOnIoCount, 2);
+  executor_->drain();
+  EXPECT_EQ(readerMock.unitsLoaded(), std::vector<bool>({false, true}));
+}
+
+TEST_F(ReadAheadUnitLoaderTest, capsLookaheadBytes) {
+  ReadAheadUnitLoaderFactory factory(executor_, 2, 100, nullptr, nullptr);
+  ReaderMock readerMock{{10, 10, 10, 10}, {50, 60, 50, 40}, factory, 0};
+
+  // Unit 1 is always loaded ahead, unit 2 would go over the cap.
+  EXPECT_TRUE(readerMock.read(10)); // Unit: 0, rows: 0-9, load(0)
+  executor_->drain(); // load(1)
+  EXPECT_EQ(
+      readerMock.unitsLoaded(),
+      std::vector<bool>({true, true, false, false}));
+
+  EXPECT_TRUE(readerMock.read(10)); // Unit: 1, rows: 0-9, unload(0)
+  executor_->drain(); // load(2), load(3)
+  EXPECT_EQ(
+      readerMock.unitsLoaded(), std::vector<bool>({false, true, true, true}));
+}
+
+TEST_F(ReadAheadUnitLoaderTest, capsLookaheadMemory) {
+  constexpr int64_t kMB = 1 << 20;
+  auto rootPool = memory::memoryManager()->addRootPool("readAhead", 8 * kMB);
+  auto leafPool = rootPool->addLeafChild("leaf");
+  auto* buffer = leafPool->allocate(4 * kMB);
+
+  ReadAheadUnitLoaderFactory factory(
+      executor_, 2, std::numeric_limits<uint64_t>::max(), leafPool.get(), {});
+  ReaderMock readerMock{{10, 10, 10}, {kMB, 5 * kMB, 5 * kMB}, factory, 0};
+
+  // Unit 2 does not fit in the memory left in the root pool.
+  EXPECT_TRUE(readerMock.read(10)); // Unit: 0, rows: 0-9, load(0)
+  executor_->drain(); // load(1)
+  EXPECT_EQ(readerMock.unitsLoaded(), std::vector<bool>({true, true, false}));
+  leafPool->free(buffer, 4 * kMB);
+}
+
+TEST_F(ReadAheadUnitLoaderTest, seekDropsLoadsAhead) {
+  size_t blockedOnIoCount = 0;
+  ReadAheadUnitLoaderFactory factory(
+      executor_, 1, 0, nullptr, [&](auto) { ++blockedOnIoCount; });
+  ReaderMock readerMock{{10, 20, 30}, {0, 0, 0}, factory, 0};
+
+  EXPECT_TRUE(readerMock.read(3)); // Unit: 0, rows: 0-2, load(0)
+  executor_->drain(); // load(1)
+  EXPECT_EQ(readerMock.unitsLoaded(), std::vector<bool>({true, true, false}));
+
+  readerMock.seek(35);
+  EXPECT_TRUE(readerMock.read(3)); // Unit: 2, unload(0), unload(1), load(2)
+  EXPECT_EQ(readerMock.unitsLoaded(), std::vector<bool>({false, false, true}));
+  EXPECT_EQ(blockedOnIoCount, 2);
+
+  readerMock.seek(0);
+  EXPECT_TRUE(readerMock.read(3)); // Unit: 0, unload(2), load(0)
+  EXPECT_EQ(readerMock.unitsLoaded(), std::vector<bool>({true, false, false}));
+  EXPECT_EQ(blockedOnIoCount, 3);
+  executor_->drain(); // load(1)
+  EXPECT_EQ(readerMock.unitsLoaded(), std::vector<bool>({true, true, false}));
+}
+
+TEST_F(ReadAheadUnitLoaderTest, unitOutOfRange) {
+  ReadAheadUnitLoaderFactory factory(executor_, 1, 0, nullptr, nullptr);
+  std::vector<std::atomic_bool> unitsLoaded(getUnitsLoadedWithFalse(1));
+  std::vector<std::unique_ptr<LoadUnit>> units;
+  units.push_back(std::make_unique<LoadUnitMock>(10, 0, unitsLoaded, 0));
+
+  auto unitLoader = factory.create(std::move(units), 0);
+  unitLoader->getLoadedUnit(0);
+
+  VELOX_ASSERT_THROW(unitLoader->getLoadedUnit(1), "Unit out of range");
+}
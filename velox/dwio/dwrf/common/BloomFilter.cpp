@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/dwrf/common/BloomFilter.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "velox/common/base/Exceptions.h"
+
+namespace facebook::velox::dwrf {
+namespace {
+
+// Seed and constants of the Murmur3 64 bit hash of the ORC Java writer.
+constexpr uint64_t kMurmurSeed = 104729;
+constexpr uint64_t kMurmurC1 = 0x87c37b91114253d5ULL;
+constexpr uint64_t kMurmurC2 = 0x4cf5ad432745937fULL;
+constexpr uint64_t kMurmurM = 5;
+constexpr uint64_t kMurmurN1 = 0x52dce729;
+
+inline uint64_t rotateLeft(uint64_t value, int32_t shift) {
+  return (value << shift) | (value >> (64 - shift));
+}
+
+// Java '>>' on longs, i.e. with sign extension.
+inline uint64_t shiftRightArithmetic(uint64_t value, int32_t shift) {
+  return static_cast<uint64_t>(static_cast<int64_t>(value) >> shift);
+}
+
+inline uint64_t mixBlock(uint64_t block) {
+  block *= kMurmurC1;
+  block = rotateLeft(block, 31);
+  return block * kMurmurC2;
+}
+
+inline uint64_t finalMix(uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+inline uint64_t loadLittleEndian(const uint8_t* data, size_t size) {
+  uint64_t result = 0;
+  for (size_t i = 0; i < size; ++i) {
+    result |= static_cast<uint64_t>(data[i]) << (8 * i);
+  }
+  return result;
+}
+} // namespace
+
+BloomFilter::BloomFilter(uint64_t expectedEntries, double fpp) {
+  VELOX_CHECK_GT(expectedEntries, 0);
+  VELOX_CHECK(fpp > 0.0 && fpp < 1.0, "Invalid false positive rate {}", fpp);
+  const double ln2 = std::log(2.0);
+  const auto optimalBits = static_cast<int64_t>(
+      -static_cast<double>(expectedEntries) * std::log(fpp) / (ln2 * ln2));
+  // Rounds up to a multiple of 64 bits like the Java writers do.
+  const auto numBits = optimalBits + (64 - optimalBits % 64);
+  numHashFunctions_ = std::max<int32_t>(
+      1,
+      static_cast<int32_t>(
+          std::round(static_cast<double>(numBits) / expectedEntries * ln2)));
+  bits_.resize(numBits / 64);
+}
+
+BloomFilter::BloomFilter(const proto::BloomFilter& bloomFilter)
+    : numHashFunctions_(bloomFilter.numhashfunctions()) {
+  VELOX_CHECK_GT(numHashFunctions_, 0, "Invalid Bloom filter");
+  if (bloomFilter.bitset_size() > 0) {
+    bits_.assign(bloomFilter.bitset().begin(), bloomFilter.bitset().end());
+  } else {
+    const auto& bytes = bloomFilter.utf8bitset();
+    VELOX_CHECK_EQ(bytes.size() % 8, 0, "Invalid Bloom filter bitset size");
+    bits_.resize(bytes.size() / 8);
+    const auto* data = reinterpret_cast<const uint8_t*>(bytes.data());
+    for (size_t i = 0; i < bits_.size(); ++i) {
+      bits_[i] = loadLittleEndian(data + i * 8, 8);
+    }
+  }
+  VELOX_CHECK(!bits_.empty(), "Empty Bloom filter bitset");
+}
+
+void BloomFilter::reset() {
+  std::fill(bits_.begin(), bits_.end(), 0);
+}
+
+void BloomFilter::toProto(proto::BloomFilter& bloomFilter) const {
+  bloomFilter.set_numhashfunctions(numHashFunctions_);
+  auto* bitset = bloomFilter.mutable_bitset();
+  bitset->Reserve(bits_.size());
+  for (auto word : bits_) {
+    bitset->Add(word);
+  }
+}
+
+// static
+int64_t BloomFilter::hashLong(int64_t value) {
+  auto key = static_cast<uint64_t>(value);
+  key = ~key + (key << 21);
+  key ^= shiftRightArithmetic(key, 24);
+  key = key + (key << 3) + (key << 8);
+  key ^= shiftRightArithmetic(key, 14);
+  key = key + (key << 2) + (key << 4);
+  key ^= shiftRightArithmetic(key, 28);
+  key += key << 31;
+  return static_cast<int64_t>(key);
+}
+
+// static
+int64_t BloomFilter::hashBytes(std::string_view value) {
+  const auto* data = reinterpret_cast<const uint8_t*>(value.data());
+  const size_t length = value.size();
+  const size_t numBlocks = length / 8;
+  uint64_t hash = kMurmurSeed;
+  for (size_t i = 0; i < numBlocks; ++i) {
+    hash ^= mixBlock(loadLittleEndian(data + i * 8, 8));
+    hash = rotateLeft(hash, 27) * kMurmurM + kMurmurN1;
+  }
+  const size_t tailSize = length - numBlocks * 8;
+  if (tailSize > 0) {
+    hash ^= mixBlock(loadLittleEndian(data + numBlocks * 8, tailSize));
+  }
+  hash ^= length;
+  return static_cast<int64_t>(finalMix(hash));
+}
+
+void BloomFilter::addHash(int64_t hash) {
+  const auto hash1 = static_cast<uint32_t>(hash);
+  const auto hash2 = static_cast<uint32_t>(static_cast<uint64_t>(hash) >> 32);
+  const auto bitCount = numBits();
+  const auto numHashFunctions = static_cast<uint32_t>(numHashFunctions_);
+  for (uint32_t i = 1; i <= numHashFunctions; ++i) {
+    auto combined = static_cast<int32_t>(hash1 + i * hash2);
+    if (combined < 0) {
+      combined = ~combined;
+    }
+    const uint64_t position = static_cast<uint64_t>(combined) % bitCount;
+    bits_[position / 64] |= 1ULL << (position % 64);
+  }
+}
+
+bool BloomFilter::testHash(int64_t hash) const {
+  const auto hash1 = static_cast<uint32_t>(hash);
+  const auto hash2 = static_cast<uint32_t>(static_cast<uint64_t>(hash) >> 32);
+  const auto bitCount = numBits();
+  const auto numHashFunctions = static_cast<uint32_t>(numHashFunctions_);
+  for (uint32_t i = 1; i <= numHashFunctions; ++i) {
+    auto combined = static_cast<int32_t>(hash1 + i * hash2);
+    if (combined < 0) {
+      combined = ~combined;
+    }
+    const uint64_t position = static_cast<uint64_t>(combined) % bitCount;
+    if ((bits_[position / 64] & (1ULL << (position % 64))) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace facebook::velox::dwrf
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "velox/dwio/dwrf/common/wrap/dwrf-proto-wrapper.h"
+
+namespace facebook::velox::dwrf {
+
+/// Bloom filter of the values of a column in one index stride. The bit layout
+/// and the hash functions are those of the ORC and DWRF Java writers, so that
+/// the filters they write can be tested and the filters written here can be
+/// read by them: integers are hashed with Thomas Wang's 64 bit integer hash and
+/// strings with the 64 bit variant of Murmur3 used by ORC.
+class BloomFilter {
+ public:
+  /// Creates an empty filter sized for 'expectedEntries' distinct values at a
+  /// false positive probability of 'fpp'.
+  BloomFilter(uint64_t expectedEntries, double fpp);
+
+  /// Creates a filter from its serialized form. Accepts both the 'bitset' and
+  /// the little endian 'utf8bitset' representation.
+  explicit BloomFilter(const proto::BloomFilter& bloomFilter);
+
+  void addLong(int64_t value) {
+    addHash(hashLong(value));
+  }
+
+  void addBytes(std::string_view value) {
+    addHash(hashBytes(value));
+  }
+
+  /// Returns false if 'value' was definitely not added to the filter.
+  bool testLong(int64_t value) const {
+    return testHash(hashLong(value));
+  }
+
+  /// Returns false if 'value' was definitely not added to the filter.
+  bool testBytes(std::string_view value) const {
+    return testHash(hashBytes(value));
+  }
+
+  /// Clears all the bits but keeps the size of the filter.
+  void reset();
+
+  void toProto(proto::BloomFilter& bloomFilter) const;
+
+  uint64_t numBits() const {
+    return bits_.size() * 64;
+  }
+
+  int32_t numHashFunctions() const {
+    return numHashFunctions_;
+  }
+
+  static int64_t hashLong(int64_t value);
+
+  static int64_t hashBytes(std::string_view value);
+
+ private:
+  void addHash(int64_t hash);
+
+  bool testHash(int64_t hash) const;
+
+  int32_t numHashFunctions_;
+  std::vector<uint64_t> bits_;
+};
+
+} // namespace facebook::velox::dwrf
@@ -47,6 +47,11 @@ class Config : public config::ConfigBase {
   static Entry<float> DICTIONARY_NUMERIC_KEY_SIZE_THRESHOLD;
   static Entry<float> DICTIONARY_STRING_KEY_SIZE_THRESHOLD;
   static Entry<bool> DICTIONARY_SORT_KEYS;
+  /// Number of non-null values of the first stripe after which string columns
+  /// check whether their dictionary is worth keeping and otherwise switch to
+  /// direct encoding without building the dictionary for the rest of the
+  /// stripe. 0 makes the decision only when the first stripe is flushed.
+  static Entry<uint32_t> DICTIONARY_STRING_SAMPLE_ROWS;
   static Entry<float> ENTROPY_KEY_STRING_SIZE_THRESHOLD;
   static Entry<uint32_t> ENTROPY_STRING_MIN_SAMPLES;
   static Entry<float> ENTROPY_STRING_DICT_SAMPLE_FRACTION;
@@ -77,6 +82,11 @@ class Config : public config::ConfigBase {
   /// stripes.
   static Entry<uint64_t> RAW_DATA_SIZE_PER_BATCH;
   static Entry<bool> MAP_STATISTICS;
+  /// Top level columns to write per stride Bloom filters for. Only integer and
+  /// string columns are supported.
+  static Entry<const std::vector<uint32_t>> BLOOM_FILTER_COLS;
+  /// False positive probability of the Bloom filters.
+  static Entry<float> BLOOM_FILTER_FPP;
 
   /// Maximum stripe size in orc writer.
   static constexpr const char* kOrcWriterMaxStripeSize =
@@ -15,6 +15,9 @@
  */
 
 #include "velox/dwio/dwrf/common/RLEv2.h"
+
+#include <folly/lang/Bits.h>
+
 #include "velox/dwio/common/SeekableInputStream.h"
 #include "velox/dwio/dwrf/common/Common.h"
 
@@ -107,6 +110,97 @@ inline uint32_t getClosestFixedBits(uint32_t n) {
   }
 }
 
+namespace {
+
+template <int32_t kBytes>
+inline uint64_t loadBigEndian(const char* input) {
+  if constexpr (kBytes == 1) {
+    return static_cast<uint8_t>(*input);
+  } else if constexpr (kBytes == 2) {
+    return folly::Endian::big(folly::loadUnaligned<uint16_t>(input));
+  } else if constexpr (kBytes == 4) {
+    return folly::Endian::big(folly::loadUnaligned<uint32_t>(input));
+  } else if constexpr (kBytes == 8) {
+    return folly::Endian::big(folly::loadUnaligned<uint64_t>(input));
+  } else {
+    uint64_t value = 0;
+    for (int32_t i = 0; i < kBytes; ++i) {
+      value = (value << 8) | static_cast<uint8_t>(input[i]);
+    }
+    return value;
+  }
+}
+
+template <int32_t kBytes>
+void unpackBytes(const char* input, uint64_t numValues, int64_t* output) {
+  for (uint64_t i = 0; i < numValues; ++i) {
+    output[i] = static_cast<int64_t>(loadBigEndian<kBytes>(input));
+    input += kBytes;
+  }
+}
+
+// Unpacks up to 'numValues' MSB first 'bitWidth' bit values from the
+// 'numBytes' bytes at 'input', which start on a byte boundary. Byte aligned
+// widths are loaded directly, the others with one unaligned 64 bit load per
+// value, so that values whose load would cross the end of 'input' are left to
+// the caller. Returns the number of unpacked values.
+uint64_t unpackBigEndian(
+    const char* input,
+    uint64_t numBytes,
+    uint64_t numValues,
+    uint32_t bitWidth,
+    int64_t* output) {
+  if (bitWidth % 8 == 0) {
+    numValues = std::min<uint64_t>(numValues, numBytes / (bitWidth / 8));
+    switch (bitWidth / 8) {
+      case 1:
+        unpackBytes<1>(input, numValues, output);
+        break;
+      case 2:
+        unpackBytes<2>(input, numValues, output);
+        break;
+      case 3:
+        unpackBytes<3>(input, numValues, output);
+        break;
+      case 4:
+        unpackBytes<4>(input, numValues, output);
+        break;
+      case 5:
+        unpackBytes<5>(input, numValues, output);
+        break;
+      case 6:
+        unpackBytes<6>(input, numValues, output);
+        break;
+      case 7:
+        unpackBytes<7>(input, numValues, output);
+        break;
+      case 8:
+        unpackBytes<8>(input, numValues, output);
+        break;
+      default:
+        return 0;
+    }
+    return numValues;
+  }
+  // A value starts at most 7 bits into its first byte, so any width up to 57
+  // bits fits in one 64 bit load.
+  if (bitWidth > 57 || numBytes < sizeof(uint64_t)) {
+    return 0;
+  }
+  const uint64_t lastStartBit = (numBytes - sizeof(uint64_t)) * 8 + 7;
+  numValues = std::min<uint64_t>(numValues, lastStartBit / bitWidth + 1);
+  const auto shift = 64 - bitWidth;
+  uint64_t bit = 0;
+  for (uint64_t i = 0; i < numValues; ++i) {
+    const auto word = loadBigEndian<8>(input + bit / 8);
+    output[i] = static_cast<int64_t>((word << (bit % 8)) >> shift);
+    bit += bitWidth;
+  }
+  return numValues;
+}
+
+} // namespace
+
 template <bool isSigned>
 int64_t RleDecoderV2<isSigned>::readLongBE(uint64_t bsz) {
   int64_t ret = 0, val;
@@ -119,6 +213,46 @@ int64_t RleDecoderV2<isSigned>::readLongBE(uint64_t bsz) {
   return ret;
 }
 
+template <bool isSigned>
+void RleDecoderV2<isSigned>::unpackLongs(
+    int64_t* data,
+    uint64_t numValues,
+    uint64_t fb) {
+  auto& bufferStart = dwio::common::IntDecoder<isSigned>::bufferStart_;
+  uint64_t i = 0;
+  while (i < numValues) {
+    if (bitsLeft_ == 0) {
+      const auto numUnpacked = unpackBigEndian(
+          bufferStart,
+          dwio::common::IntDecoder<isSigned>::bufferEnd_ - bufferStart,
+          numValues - i,
+          fb,
+          data + i);
+      if (numUnpacked > 0) {
+        const auto numBits = numUnpacked * fb;
+        bufferStart += numBits / 8;
+        if (numBits % 8 != 0) {
+          curByte_ = static_cast<unsigned char>(*bufferStart++);
+          bitsLeft_ = 8 - numBits % 8;
+        }
+        i += numUnpacked;
+        continue;
+      }
+    }
+    // Values that start within a byte or cross into the next buffer.
+    data[i++] = readPackedLong(fb);
+  }
+}
+
+template void RleDecoderV2<true>::unpackLongs(
+    int64_t* data,
+    uint64_t numValues,
+    uint64_t fb);
+template void RleDecoderV2<false>::unpackLongs(
+    int64_t* data,
+    uint64_t numValues,
+    uint64_t fb);
+
 template <bool isSigned>
 RleDecoderV2<isSigned>::RleDecoderV2(
     std::unique_ptr<dwio::common::SeekableInputStream> input,
@@ -19,6 +19,7 @@
 #include "velox/common/memory/Memory.h"
 #include "velox/dwio/common/Adaptor.h"
 #include "velox/dwio/common/DataBuffer.h"
+#include "velox/dwio/common/DecoderUtil.h"
 #include "velox/dwio/common/IntDecoder.h"
 #include "velox/dwio/common/exception/Exception.h"
 
@@ -62,6 +63,12 @@ class RleDecoderV2 : public dwio::common::IntDecoder<isSigned> {
   template <bool hasNulls, typename Visitor>
   void readWithVisitor(const uint64_t* nulls, Visitor visitor) {
     skipPending();
+    if constexpr (!hasNulls && Visitor::dense) {
+      if (dwio::common::useFastPath<Visitor, hasNulls>(visitor)) {
+        bulkRead(visitor);
+        return;
+      }
+    }
     int32_t current = visitor.start();
     this->template skip<hasNulls>(current, 0, nulls);
 
@@ -160,37 +167,78 @@ class RleDecoderV2 : public dwio::common::IntDecoder<isSigned> {
       uint64_t len,
       uint64_t fb,
       const uint64_t* nulls = nullptr) {
+    if (!nulls) {
+      unpackLongs(data + offset, len, fb);
+      return len;
+    }
     uint64_t ret = 0;
-
-    // TODO: unroll to improve performance
     for (uint64_t i = offset; i < (offset + len); i++) {
       // skip null positions
-      if (nulls && bits::isBitNull(nulls, i)) {
+      if (bits::isBitNull(nulls, i)) {
         continue;
       }
-      uint64_t result = 0;
-      uint64_t bitsLeftToRead = fb;
-      while (bitsLeftToRead > bitsLeft_) {
-        result <<= bitsLeft_;
-        result |= curByte_ & ((1 << bitsLeft_) - 1);
-        bitsLeftToRead -= bitsLeft_;
-        curByte_ = readByte();
-        bitsLeft_ = 8;
-      }
-
-      // handle the left over bits
-      if (bitsLeftToRead > 0) {
-        result <<= bitsLeftToRead;
-        bitsLeft_ -= static_cast<uint32_t>(bitsLeftToRead);
-        result |= (curByte_ >> bitsLeft_) & ((1 << bitsLeftToRead) - 1);
-      }
-      data[i] = static_cast<int64_t>(result);
+      data[i] = readPackedLong(fb);
       ++ret;
     }
 
     return ret;
   }
 
+  // Reads the next 'fb' bit value bit by bit.
+  int64_t readPackedLong(uint64_t fb) {
+    uint64_t result = 0;
+    uint64_t bitsLeftToRead = fb;
+    while (bitsLeftToRead > bitsLeft_) {
+      result <<= bitsLeft_;
+      result |= curByte_ & ((1 << bitsLeft_) - 1);
+      bitsLeftToRead -= bitsLeft_;
+      curByte_ = readByte();
+      bitsLeft_ = 8;
+    }
+
+    // handle the left over bits
+    if (bitsLeftToRead > 0) {
+      result <<= bitsLeftToRead;
+      bitsLeft_ -= static_cast<uint32_t>(bitsLeftToRead);
+      result |= (curByte_ >> bitsLeft_) & ((1 << bitsLeftToRead) - 1);
+    }
+    return static_cast<int64_t>(result);
+  }
+
+  // Reads 'numValues' 'fb' bit values into 'data'. The values that start on a
+  // byte boundary and end within the current buffer are unpacked in bulk, the
+  // rest bit by bit.
+  void unpackLongs(int64_t* data, uint64_t numValues, uint64_t fb);
+
+  // Decodes all rows of a dense visitor in bulk and hands them to the
+  // visitor's processRun, which applies the filter and hook to the batch.
+  template <typename Visitor>
+  void bulkRead(Visitor& visitor) {
+    using T = typename Visitor::DataType;
+    constexpr bool hasFilter =
+        !std::is_same_v<typename Visitor::FilterType, common::AlwaysTrue>;
+    constexpr bool hasHook =
+        !std::is_same_v<typename Visitor::HookType, dwio::common::NoHook>;
+    const auto numRows = visitor.numRows();
+    auto* values = visitor.rawValues(numRows);
+    auto* filterHits = hasFilter ? visitor.outputRows(numRows) : nullptr;
+    if constexpr (std::is_same_v<T, int64_t>) {
+      doNext(values, numRows, nullptr);
+    } else {
+      constexpr int32_t kBatchSize = 256;
+      int64_t batch[kBatchSize];
+      for (int32_t i = 0; i < numRows; i += kBatchSize) {
+        const auto numInBatch = std::min<int32_t>(kBatchSize, numRows - i);
+        doNext(batch, numInBatch, nullptr);
+        std::copy(batch, batch + numInBatch, values + i);
+      }
+    }
+    int32_t numValues = 0;
+    visitor.template processRun<hasFilter, hasHook, false>(
+        values, numRows, nullptr, filterHits, values, numValues);
+    visitor.setNumValues(hasFilter ? numValues : numRows);
+  }
+
   uint64_t nextShortRepeats(
       int64_t* data,
       uint64_t offset,
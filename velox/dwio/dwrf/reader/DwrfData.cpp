@@ -17,14 +17,71 @@
 #include "velox/dwio/dwrf/reader/DwrfData.h"
 
 #include "velox/dwio/common/BufferUtil.h"
+#include "velox/dwio/dwrf/common/BloomFilter.h"
+#include "velox/dwio/dwrf/common/wrap/orc-proto-wrapper.h"
 
 namespace facebook::velox::dwrf {
+namespace {
+
+// Returns true if 'filter' passes only a few non-null values that can be
+// looked up in a Bloom filter.
+bool isBloomFilterTestable(const common::Filter* filter) {
+  if (filter == nullptr || filter->nullAllowed()) {
+    return false;
+  }
+  switch (filter->kind()) {
+    case common::FilterKind::kBigintRange:
+      return static_cast<const common::BigintRange*>(filter)->isSingleValue();
+    case common::FilterKind::kBytesRange:
+      return static_cast<const common::BytesRange*>(filter)->isSingleValue();
+    case common::FilterKind::kBigintValuesUsingHashTable:
+    case common::FilterKind::kBigintValuesUsingBitmask:
+    case common::FilterKind::kBytesValues:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Collects the values passing 'filter' into 'longs' or 'bytes'. 'bytes' point
+// into 'filter'.
+void bloomFilterValues(
+    const common::Filter& filter,
+    std::vector<int64_t>& longs,
+    std::vector<std::string_view>& bytes) {
+  switch (filter.kind()) {
+    case common::FilterKind::kBigintRange:
+      longs.push_back(static_cast<const common::BigintRange&>(filter).lower());
+      break;
+    case common::FilterKind::kBytesRange:
+      bytes.push_back(static_cast<const common::BytesRange&>(filter).lower());
+      break;
+    case common::FilterKind::kBigintValuesUsingHashTable:
+      longs = static_cast<const common::BigintValuesUsingHashTable&>(filter)
+                  .values();
+      break;
+    case common::FilterKind::kBigintValuesUsingBitmask:
+      longs =
+          static_cast<const common::BigintValuesUsingBitmask&>(filter).values();
+      break;
+    case common::FilterKind::kBytesValues:
+      for (const auto& value :
+           static_cast<const common::BytesValues&>(filter).values()) {
+        bytes.push_back(value);
+      }
+      break;
+    default:
+      VELOX_UNREACHABLE();
+  }
+}
+} // namespace
 
 DwrfData::DwrfData(
     std::shared_ptr<const dwio::common::TypeWithId> fileType,
     StripeStreams& stripe,
     const StreamLabels& streamLabels,
-    FlatMapContext flatMapContext)
+    FlatMapContext flatMapContext,
+    const common::ScanSpec* scanSpec)
     : memoryPool_(stripe.getMemoryPool()),
       fileType_(std::move(fileType)),
       flatMapContext_(std::move(flatMapContext)),
@@ -47,6 +104,18 @@ DwrfData::DwrfData(
       encodingKey.forKind(proto::Stream_Kind_ROW_INDEX),
       streamLabels.label(),
       false);
+
+  // Bloom filters are only read for the filters known at construct time, so
+  // that the columns without point lookups don't pay for reading them.
+  if (scanSpec && isBloomFilterTestable(scanSpec->filter())) {
+    // ORC and DWRF number the Bloom filter stream differently.
+    const auto bloomFilterKind = stripe.format() == DwrfFormat::kOrc
+        ? static_cast<proto::Stream_Kind>(
+              proto::orc::Stream_Kind_BLOOM_FILTER_UTF8)
+        : proto::Stream_Kind_BLOOM_FILTER_UTF8;
+    bloomFilterStream_ = stripe.getStream(
+        encodingKey.forKind(bloomFilterKind), streamLabels.label(), false);
+  }
 }
 
 uint64_t DwrfData::skipNulls(uint64_t numValues, bool /*nullsOnly*/) {
@@ -91,6 +160,14 @@ void DwrfData::ensureRowGroupIndex() {
   }
 }
 
+bool DwrfData::ensureBloomFilters() {
+  if (bloomFilterStream_) {
+    bloomFilters_ = ProtoUtils::readProto<proto::BloomFilterIndex>(
+        std::move(bloomFilterStream_));
+  }
+  return bloomFilters_ != nullptr;
+}
+
 dwio::common::PositionProvider DwrfData::seekToRowGroup(int64_t index) {
   ensureRowGroupIndex();
 
@@ -165,6 +242,36 @@ void DwrfData::filterRowGroups(
         scanSpec.metadataFilterNodeAt(i), std::vector<uint64_t>(nwords));
   }
 
+  std::vector<int64_t> bloomFilterLongs;
+  std::vector<std::string_view> bloomFilterBytes;
+  const bool useBloomFilters = isBloomFilterTestable(filter) &&
+      ensureBloomFilters() &&
+      bloomFilters_->bloomfilter_size() == index_->entry_size();
+  if (useBloomFilters) {
+    bloomFilterValues(*filter, bloomFilterLongs, bloomFilterBytes);
+  }
+  // Returns false if no value passing 'filter' is in the Bloom filter of
+  // stride 'i'.
+  const auto testBloomFilter = [&](int32_t i) {
+    const auto& bloomFilterProto = bloomFilters_->bloomfilter(i);
+    if (bloomFilterProto.bitset_size() == 0 &&
+        bloomFilterProto.utf8bitset().empty()) {
+      return true;
+    }
+    const BloomFilter bloomFilter(bloomFilterProto);
+    for (auto value : bloomFilterLongs) {
+      if (bloomFilter.testLong(value)) {
+        return true;
+      }
+    }
+    for (auto value : bloomFilterBytes) {
+      if (bloomFilter.testBytes(value)) {
+        return true;
+      }
+    }
+    return false;
+  };
+
   for (auto i = 0; i < index_->entry_size(); ++i) {
     const auto& entry = index_->entry(i);
     const auto columnStats = buildColumnStatisticsFromProto(
@@ -176,6 +283,12 @@ void DwrfData::filterRowGroups(
       bits::setBit(result.filterResult.data(), i);
       continue;
     }
+    if (useBloomFilters && !testBloomFilter(i)) {
+      VLOG(1) << "Drop stride " << i << " on Bloom filter of "
+              << scanSpec.toString();
+      bits::setBit(result.filterResult.data(), i);
+      continue;
+    }
 
     for (int j = 0; j < scanSpec.numMetadataFilters(); ++j) {
       auto* metadataFilter = scanSpec.metadataFilterAt(j);
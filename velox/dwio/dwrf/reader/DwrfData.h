@@ -32,11 +32,14 @@ namespace facebook::velox::dwrf {
 // DWRF specific functions shared between all readers.
 class DwrfData : public dwio::common::FormatData {
  public:
+  /// Loads the Bloom filters of the column if the filter of 'scanSpec' can be
+  /// tested against them.
   DwrfData(
       std::shared_ptr<const dwio::common::TypeWithId> fileType,
       StripeStreams& stripe,
       const StreamLabels& streamLabels,
-      FlatMapContext flatMapContext);
+      FlatMapContext flatMapContext,
+      const common::ScanSpec* scanSpec = nullptr);
 
   void readNulls(
       vector_size_t numValues,
@@ -92,6 +95,10 @@ class DwrfData : public dwio::common::FormatData {
     return *index_;
   }
 
+  // Decodes the Bloom filters of the strides of 'this' if they are loaded and
+  // not already decoded. Returns false if there are no Bloom filters.
+  bool ensureBloomFilters();
+
  private:
   static std::vector<uint64_t> toPositionsInner(
       const proto::RowIndexEntry& entry) {
@@ -105,6 +112,8 @@ class DwrfData : public dwio::common::FormatData {
   std::unique_ptr<BooleanRleDecoder> notNullDecoder_;
   std::unique_ptr<dwio::common::SeekableInputStream> indexStream_;
   std::unique_ptr<proto::RowIndex> index_;
+  std::unique_ptr<dwio::common::SeekableInputStream> bloomFilterStream_;
+  std::unique_ptr<proto::BloomFilterIndex> bloomFilters_;
   int64_t stripeRows_;
   // Number of rows in a row group. Last row group may have fewer rows.
   uint32_t rowsPerRowGroup_;
@@ -132,9 +141,9 @@ class DwrfParams : public dwio::common::FormatParams {
 
   std::unique_ptr<dwio::common::FormatData> toFormatData(
       const std::shared_ptr<const dwio::common::TypeWithId>& type,
-      const common::ScanSpec& /*scanSpec*/) override {
+      const common::ScanSpec& scanSpec) override {
     return std::make_unique<DwrfData>(
-        type, stripeStreams_, streamLabels_, flatMapContext_);
+        type, stripeStreams_, streamLabels_, flatMapContext_, &scanSpec);
   }
 
   StripeStreams& stripeStreams() {
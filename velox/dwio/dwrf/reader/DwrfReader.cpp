@@ -16,6 +16,7 @@
 
 #include "velox/dwio/dwrf/reader/DwrfReader.h"
 
+#include <algorithm>
 #include <chrono>
 
 #include "velox/dwio/common/OnDemandUnitLoader.h"
@@ -471,6 +472,107 @@ uint64_t DwrfRowReader::skipRows(uint64_t numberOfRowsToSkip) {
   return previousRow_ - initialRow;
 }
 
+void DwrfRowReader::seekToStride(uint32_t stripe, uint64_t stride) {
+  const uint64_t rowInStripe = stride * getReader().footer().rowIndexStride();
+  if (stripe != currentStripe_ || currentUnit_ == nullptr ||
+      currentRowInStripe_ > rowInStripe) {
+    seekToRow(firstRowOfStripe_[stripe]);
+    loadCurrentStripe();
+    // The strides to skip are computed for the stripe when reading its first
+    // row, which may not be read after the seek below.
+    recomputeStridesToSkip_ = true;
+  }
+  if (currentRowInStripe_ == rowInStripe) {
+    return;
+  }
+  if (!getSelectiveColumnReader()) {
+    seekToRow(firstRowOfStripe_[stripe] + rowInStripe);
+    return;
+  }
+  nextRowNumber_.reset();
+  getSelectiveColumnReader()->seekToRowGroup(stride);
+  currentRowInStripe_ = rowInStripe;
+  previousRow_ = firstRowOfStripe_[stripe] + rowInStripe;
+  unitLoader_->onSeek(stripe - firstStripe_, rowInStripe);
+}
+
+uint64_t DwrfRowReader::readRows(
+    folly::Range<const uint64_t*> rowNumbers,
+    VectorPtr& result) {
+  VELOX_CHECK_NOT_NULL(result, "readRows() expects a non-null result");
+  result->resize(0);
+  if (rowNumbers.empty() || emptyFile()) {
+    return 0;
+  }
+  const auto& fileFooter = getReader().footer();
+  const auto strideSize = fileFooter.rowIndexStride();
+  const uint64_t endRow = firstRowOfStripe_[stripeCeiling_ - 1] +
+      fileFooter.stripes(stripeCeiling_ - 1).numberOfRows();
+  VELOX_USER_CHECK_GE(
+      rowNumbers.front(),
+      firstRowOfStripe_[firstStripe_],
+      "Row number out of range");
+  VELOX_USER_CHECK_LT(rowNumbers.back(), endRow, "Row number out of range");
+  for (size_t i = 1; i < rowNumbers.size(); ++i) {
+    VELOX_USER_CHECK_LT(
+        rowNumbers[i - 1], rowNumbers[i], "Row numbers must be increasing");
+  }
+
+  VectorPtr batch = BaseVector::create(result->type(), 0, result->pool());
+  std::vector<uint64_t> deletedRows;
+  // The rows before 'readTo' have been read or skipped by the stride stats.
+  uint64_t readTo = 0;
+  size_t i = 0;
+  while (i < rowNumbers.size()) {
+    if (rowNumbers[i] < readTo) {
+      ++i;
+      continue;
+    }
+    const auto row = rowNumbers[i];
+    const auto stripeIt = std::upper_bound(
+        firstRowOfStripe_.begin() + firstStripe_,
+        firstRowOfStripe_.begin() + stripeCeiling_,
+        row);
+    const uint32_t stripe = stripeIt - firstRowOfStripe_.begin() - 1;
+    const auto stripeStart = firstRowOfStripe_[stripe];
+    const uint64_t stride =
+        strideSize > 0 ? (row - stripeStart) / strideSize : 0;
+    uint64_t groupEnd = stripeStart + fileFooter.stripes(stripe).numberOfRows();
+    if (strideSize > 0) {
+      groupEnd = std::min(groupEnd, stripeStart + (stride + 1) * strideSize);
+    }
+    auto end = i + 1;
+    while (end < rowNumbers.size() && rowNumbers[end] < groupEnd) {
+      ++end;
+    }
+
+    seekToStride(stripe, stride);
+    const auto lastRow = rowNumbers[end - 1];
+    auto nextRow = nextRowNumber();
+    while (nextRow != kAtEnd && nextRow <= lastRow) {
+      const auto readSize = nextReadSize(lastRow + 1 - nextRow);
+      deletedRows.assign(bits::nwords(readSize), ~0ULL);
+      for (; i < end && rowNumbers[i] < nextRow + readSize; ++i) {
+        if (rowNumbers[i] >= nextRow) {
+          bits::clearBit(deletedRows.data(), rowNumbers[i] - nextRow);
+        }
+      }
+      dwio::common::Mutation mutation;
+      mutation.deletedRows = deletedRows.data();
+      next(readSize, batch, &mutation);
+      if (batch->size() > 0) {
+        // The lazy vectors in 'batch' are only valid until the next seek.
+        batch->loadedVector();
+        result->append(batch.get());
+      }
+      nextRow = nextRowNumber();
+    }
+    readTo = nextRow == kAtEnd ? endRow : nextRow;
+    i = end;
+  }
+  return result->size();
+}
+
 void DwrfRowReader::checkSkipStrides(uint64_t strideSize) {
   if (!getSelectiveColumnReader() || strideSize == 0 ||
       currentRowInStripe_ % strideSize != 0) {
@@ -139,6 +139,14 @@ class DwrfRowReader : public StrideIndexProvider,
 
   int64_t nextReadSize(uint64_t size) override;
 
+  /// Reads the rows at 'rowNumbers' one row group at a time. Each row group
+  /// with rows to read is positioned to through the row index and the rows
+  /// in it are read in one batch, with the rows in between deleted through a
+  /// mutation. Requires the selective reader.
+  uint64_t readRows(
+      folly::Range<const uint64_t*> rowNumbers,
+      VectorPtr& result) override;
+
   std::shared_ptr<const RowType> type() const {
     if (columnSelector_) {
       return columnSelector_->getSchema();
@@ -160,6 +168,10 @@ class DwrfRowReader : public StrideIndexProvider,
 
   void checkSkipStrides(uint64_t strideSize);
 
+  // Positions 'this' at the first row of 'stride' in 'stripe'. Seeks the
+  // column readers to the row group instead of skipping the rows before it.
+  void seekToStride(uint32_t stripe, uint64_t stride);
+
   void readNext(
       uint64_t rowsToRead,
       const dwio::common::Mutation*,
@@ -19,6 +19,7 @@
 #include <fmt/format.h>
 
 #include "velox/common/process/TraceContext.h"
+#include "velox/dwio/common/FileMetadataCache.h"
 #include "velox/dwio/common/Mutation.h"
 #include "velox/dwio/common/exception/Exception.h"
 
@@ -100,20 +101,86 @@ std::unique_ptr<FooterWrapper> parseFooter(
   return std::make_unique<FooterWrapper>(impl);
 }
 
+std::unique_ptr<PostScript> copyPostScript(const PostScript& ps) {
+  if (ps.format() == DwrfFormat::kDwrf) {
+    return std::make_unique<PostScript>(proto::PostScript(*ps.getDwrfPtr()));
+  }
+  return std::make_unique<PostScript>(
+      proto::orc::PostScript(*ps.getOrcPtr()));
+}
+
 } // namespace
 
+// The parsed tail of a file shared between readers through
+// FileMetadataCache. 'footer' points into 'arena'.
+struct ReaderBase::FileTail {
+  std::shared_ptr<google::protobuf::Arena> arena;
+  std::unique_ptr<PostScript> postScript;
+  FooterWrapper footer;
+  uint64_t psLength;
+};
+
 ReaderBase::ReaderBase(
     const dwio::common::ReaderOptions& options,
     std::unique_ptr<dwio::common::BufferedInput> input)
     : options_{options},
       input_(std::move(input)),
-      fileLength_(input_->getReadFile()->size()),
-      arena_(std::make_unique<google::protobuf::Arena>()) {
+      fileLength_(input_->getReadFile()->size()) {
   process::TraceContext trace("ReaderBase::ReaderBase");
   // TODO: make a config
   DWIO_ENSURE(fileLength_ > 0, "ORC file is empty");
   VELOX_CHECK_GE(fileLength_, 4, "File size too small");
 
+  auto* metadataCache = dwio::common::FileMetadataCache::getInstance();
+  const auto metadataKey = metadataCache == nullptr
+      ? std::nullopt
+      : dwio::common::FileMetadataCache::makeKey(
+            fileFormat(),
+            *input_->getReadFile(),
+            options_.fileModificationTime());
+  std::shared_ptr<const FileTail> tail;
+  if (metadataKey.has_value()) {
+    tail = metadataCache->get<FileTail>(metadataKey.value());
+  }
+  if (tail != nullptr) {
+    initializeTail(*tail);
+  } else {
+    readTail();
+    if (metadataKey.has_value()) {
+      const auto bytes = arena_->SpaceUsed() + psLength_ + sizeof(FileTail);
+      metadataCache->put(
+          metadataKey.value(),
+          std::make_shared<const FileTail>(FileTail{
+              arena_, copyPostScript(*postScript_), *footer_, psLength_}),
+          bytes);
+    }
+  }
+
+  schema_ = std::dynamic_pointer_cast<const RowType>(
+      convertType(*footer_, 0, options_.fileColumnNamesReadAsLowerCase()));
+  VELOX_CHECK_NOT_NULL(schema_, "invalid schema");
+
+  // initialize file decrypter
+  handler_ =
+      DecryptionHandler::create(*footer_, options_.decrypterFactory().get());
+}
+
+void ReaderBase::initializeTail(const FileTail& tail) {
+  arena_ = tail.arena;
+  postScript_ = copyPostScript(*tail.postScript);
+  footer_ = std::make_unique<FooterWrapper>(tail.footer);
+  psLength_ = tail.psLength;
+  footerBufferOverread_ = 0;
+  // The footer was not read, so loadCache() reads the stripe metadata cache
+  // from the file.
+  stripeMetadataCacheBuffer_ =
+      AlignedBuffer::allocate<char>(0, &options_.memoryPool());
+  stripeMetadataCacheBufferSize_ = 0;
+}
+
+void ReaderBase::readTail() {
+  arena_ = std::make_shared<google::protobuf::Arena>();
+
   const auto preloadFile = fileLength_ <= options_.filePreloadThreshold();
   const int64_t footerBufSize =
       std::min(fileLength_, options_.footerEstimatedSize());
@@ -205,14 +272,6 @@ ReaderBase::ReaderBase(
 
   stripeMetadataCacheBuffer_ = footerBuffer;
   stripeMetadataCacheBufferSize_ = footerOffset;
-
-  schema_ = std::dynamic_pointer_cast<const RowType>(
-      convertType(*footer_, 0, options_.fileColumnNamesReadAsLowerCase()));
-  VELOX_CHECK_NOT_NULL(schema_, "invalid schema");
-
-  // initialize file decrypter
-  handler_ =
-      DecryptionHandler::create(*footer_, options_.decrypterFactory().get());
 }
 
 void ReaderBase::loadCache() {
@@ -253,6 +253,15 @@ class ReaderBase {
   }
 
  private:
+  struct FileTail;
+
+  // Reads and parses the post script and footer of the file.
+  void readTail();
+
+  // Initializes the post script and footer from 'tail' shared by another
+  // reader of the same file.
+  void initializeTail(const FileTail& tail);
+
   static std::shared_ptr<const Type> convertType(
       const FooterWrapper& footer,
       uint32_t index = 0,
@@ -273,7 +282,8 @@ class ReaderBase {
   BufferPtr stripeMetadataCacheBuffer_;
   int32_t stripeMetadataCacheBufferSize_;
   int32_t footerBufferOverread_;
-  std::unique_ptr<google::protobuf::Arena> arena_;
+  // Shared with FileMetadataCache if the footer is cached.
+  std::shared_ptr<google::protobuf::Arena> arena_;
   std::unique_ptr<PostScript> postScript_;
   std::unique_ptr<FooterWrapper> footer_;
   std::unique_ptr<encryption::DecryptionHandler> handler_;
@@ -85,6 +85,9 @@ std::vector<KeyNode<T>> getKeyNodes(
   common::ScanSpec* valuesSpec = nullptr;
   std::unordered_map<KeyValue<T>, common::ScanSpec*, KeyValueHash<T>>
       childSpecs;
+  // Keys selected by subscripts in 'scanSpec'.  The streams of the other keys
+  // are neither loaded nor decoded.
+  typename KeyPredicate<T>::Lookup selectedKeys;
   if (!asStruct) {
     keysSpec = scanSpec.getOrCreateChild(common::ScanSpec::kMapKeysFieldName);
     valuesSpec =
@@ -92,6 +95,9 @@ std::vector<KeyNode<T>> getKeyNodes(
     VELOX_CHECK(!valuesSpec->hasFilter());
     keysSpec->setProjectOut(true);
     valuesSpec->setProjectOut(true);
+    for (auto& feature : scanSpec.flatMapFeatureSelection()) {
+      selectedKeys.insert(parseKeyValue<T>(feature));
+    }
   } else {
     for (auto& c : scanSpec.children()) {
       T key;
@@ -125,6 +131,9 @@ std::vector<KeyNode<T>> getKeyNodes(
           // Column not selected in 'scanSpec', skipping it.
           return;
         } else {
+          if (!selectedKeys.empty() && selectedKeys.count(key) == 0) {
+            return; // Subscript pruning
+          }
           if (keysSpec && keysSpec->filter() &&
               !common::applyFilter(*keysSpec->filter(), key.get())) {
             return; // Subfield pruning
@@ -150,6 +159,11 @@ std::vector<KeyNode<T>> getKeyNodes(
             key, sequence, std::move(reader), std::move(inMapDecoder));
       });
 
+  if (auto callback = params.flatMapContext().keySelectionCallback) {
+    callback(FlatMapKeySelectionStats{
+        .totalKeys = processed.size(), .selectedKeys = keyNodes.size()});
+  }
+
   VLOG(1) << "[Flat-Map] Initialized a flat-map column reader for node "
           << fileType->id() << ", keys=" << keyNodes.size()
           << ", streams=" << streams;
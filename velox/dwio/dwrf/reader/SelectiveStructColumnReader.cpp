@@ -68,7 +68,8 @@ SelectiveStructColumnReader::SelectiveStructColumnReader(
         FlatMapContext{
             .sequence = encodingKey.sequence(),
             .inMapDecoder = nullptr,
-            .keySelectionCallback = nullptr});
+            .keySelectionCallback =
+                params.flatMapContext().keySelectionCallback});
     addChild(SelectiveDwrfReader::build(
         childRequestedType, childFileType, childParams, *childSpec));
     childSpec->setSubscript(children_.size() - 1);
@@ -2098,7 +2098,8 @@ struct IntegerColumnWriterTypedTestCase {
       const std::function<bool(size_t, size_t)>& genNulls,
       const std::function<void(ColumnWriter&, size_t, size_t)>& postProcess,
       size_t repetitionCount = 1,
-      size_t flushCount = 1)
+      size_t flushCount = 1,
+      uint32_t dictionarySampleRows = 0)
       : size{size},
         writeDirect{writeDirect},
         dictionaryWriteThreshold{dictionaryWriteThreshold},
@@ -3309,6 +3310,7 @@ struct StringColumnWriterTestCase {
   const std::function<void(ColumnWriter&, size_t, size_t)> postProcess;
   const size_t repetitionCount;
   const size_t flushCount;
+  const uint32_t dictionarySampleRows;
   const std::shared_ptr<const Type> type;
 
   StringColumnWriterTestCase(
@@ -3334,6 +3336,7 @@ struct StringColumnWriterTestCase {
         postProcess{postProcess},
         repetitionCount{repetitionCount},
         flushCount{flushCount},
+        dictionarySampleRows{dictionarySampleRows},
         type{CppToType<folly::StringPiece>::create()} {}
 
   virtual ~StringColumnWriterTestCase() = default;
@@ -3393,6 +3396,7 @@ struct StringColumnWriterTestCase {
     config->set(
         Config::DICTIONARY_STRING_KEY_SIZE_THRESHOLD,
         dictionaryKeyEfficiencyThreshold);
+    config->set(Config::DICTIONARY_STRING_SAMPLE_ROWS, dictionarySampleRows);
     WriterContext context{config, memory::memoryManager()->addRootPool()};
     context.initBuffer();
     // Register root node.
@@ -4227,6 +4231,78 @@ TEST_F(ColumnWriterTest, StringColumnWriterAbandonLowValueDictionaries) {
   }
 }
 
+TEST_F(ColumnWriterTest, StringColumnWriterSampleDictionaries) {
+  struct TestCase : public StringColumnWriterTestCase {
+    TestCase(
+        size_t size,
+        bool writeDirect,
+        size_t finalDictionarySize,
+        const std::function<std::string(size_t, size_t, size_t)>& genData,
+        const std::function<void(ColumnWriter&, size_t, size_t)>& postProcess,
+        uint32_t dictionarySampleRows,
+        size_t repetitionCount = 10,
+        size_t flushCount = 1)
+        : StringColumnWriterTestCase{
+              size,
+              writeDirect,
+              /* dictionaryKeyEfficiencyThreshold */ 0.4f,
+              /* entropyKeyEfficiencyThreshold */ 0.0f,
+              finalDictionarySize,
+              genData,
+              false,
+              noNullsWithStride,
+              postProcess,
+              repetitionCount,
+              flushCount,
+              dictionarySampleRows} {}
+  };
+
+  std::vector<TestRunner> testCases{
+      // Each batch has distinct values, so the first batch alone does not fit
+      // dictionary encoding even though the whole stripe would.
+      TestCase{
+          1000,
+          /* writeDirect */ true,
+          /* finalDictionarySize */ 0,
+          generateStringRange,
+          checkAbandonDict(
+              abandonNthWriteForStripe(0, 0),
+              /* force */ false,
+              noSuccess),
+          /* dictionarySampleRows */ 500},
+      // The encoding chosen on the sample carries over to the next stripes.
+      TestCase{
+          1000,
+          /* writeDirect */ true,
+          /* finalDictionarySize */ 0,
+          generateStringRange,
+          noPostProcessing,
+          /* dictionarySampleRows */ 500,
+          /* repCount */ 2,
+          /* stripeCount */ 3},
+      // The sample spans enough batches to see the repeats.
+      TestCase{
+          1000,
+          /* writeDirect */ false,
+          /* finalDictionarySize */ 1000,
+          generateStringRange,
+          noPostProcessing,
+          /* dictionarySampleRows */ 3000},
+      // Sampling is off, the decision is made on the whole stripe.
+      TestCase{
+          1000,
+          /* writeDirect */ false,
+          /* finalDictionarySize */ 1000,
+          generateStringRange,
+          noPostProcessing,
+          /* dictionarySampleRows */ 0},
+  };
+
+  for (const auto& testCase : testCases) {
+    testCase.runTest();
+  }
+}
+
 TEST_F(ColumnWriterTest, IntDictWriterDirectValueOverflow) {
   auto config = std::make_shared<Config>();
   WriterContext context{
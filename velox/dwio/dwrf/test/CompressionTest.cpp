@@ -17,6 +17,8 @@
 #include "velox/dwio/dwrf/common/Compression.h"
 #include "velox/common/base/VeloxException.h"
 #include "velox/common/base/tests/GTestUtils.h"
+#include "velox/common/caching/AsyncDataCache.h"
+#include "velox/common/memory/MmapAllocator.h"
 #include "velox/dwio/common/encryption/TestProvider.h"
 #include "velox/dwio/dwrf/common/wrap/dwrf-proto-wrapper.h"
 #include "velox/dwio/dwrf/test/OrcTest.h"
@@ -450,6 +452,177 @@ TEST_P(CompressionTest, getCompressionBufferOOM) {
   }
 }
 
+namespace {
+// Array stream whose decompressed chunks are cached in 'cache' as if the
+// stream were read from the file with id 'fileNum'.
+class CachedArrayInputStream : public SeekableArrayInputStream {
+ public:
+  CachedArrayInputStream(
+      const char* data,
+      uint64_t length,
+      uint64_t fileNum,
+      facebook::velox::cache::AsyncDataCache* cache)
+      : SeekableArrayInputStream(data, length),
+        fileNum_(fileNum),
+        cache_(cache) {}
+
+  facebook::velox::cache::AsyncDataCache* decompressedCache(
+      uint64_t offset,
+      facebook::velox::cache::RawFileCacheKey& key) const override {
+    key = facebook::velox::cache::RawFileCacheKey{fileNum_, offset};
+    return cache_;
+  }
+
+ private:
+  const uint64_t fileNum_;
+  facebook::velox::cache::AsyncDataCache* const cache_;
+};
+} // namespace
+
+TEST(DecompressedCacheTest, zstd) {
+  using namespace facebook::velox::cache;
+  MemoryManager::testingSetInstance({});
+  auto pool = memoryManager()->addLeafPool();
+  MemorySink memSink(DEFAULT_MEM_STREAM_SIZE, {.pool = pool.get()});
+  // Chunks above the tiny entry size so that the entries span page runs.
+  constexpr uint64_t kBlock = 16 << 10;
+  constexpr size_t kDataSize = 16 * kBlock;
+  std::vector<char> data(kDataSize);
+  generateRandomData(data.data(), kDataSize, true);
+  compressAndVerify(
+      CompressionKind_ZSTD,
+      memSink,
+      kBlock,
+      *pool,
+      data.data(),
+      kDataSize,
+      nullptr);
+
+  auto allocator = std::make_shared<MmapAllocator>(
+      MmapAllocator::Options{.capacity = 64L << 20});
+  auto cache = AsyncDataCache::create(
+      allocator.get(),
+      nullptr,
+      AsyncDataCache::Options(0.7, 0.125, 1 << 24, false, true));
+  StringIdLease file(fileIds(), std::string_view("decompressedCacheTest"));
+  int64_t numChunks = 0;
+  for (auto pass = 0; pass < 2; ++pass) {
+    SCOPED_TRACE(fmt::format("pass {}", pass));
+    auto stream = createDecompressor(
+        CompressionKind_ZSTD,
+        std::make_unique<CachedArrayInputStream>(
+            memSink.data(), memSink.size(), file.id(), cache.get()),
+        kBlock,
+        *pool,
+        "Test Compression");
+    const char* buffer;
+    int32_t size;
+    size_t pos = 0;
+    while (stream->Next(reinterpret_cast<const void**>(&buffer), &size)) {
+      ASSERT_LE(pos + size, kDataSize);
+      ASSERT_EQ(::memcmp(buffer, data.data() + pos, size), 0);
+      // Backing up returns the rest of the same window, also when it is a
+      // view into a cache entry.
+      const int32_t backUp = size / 2;
+      stream->BackUp(backUp);
+      const char* rest;
+      int32_t restSize;
+      ASSERT_TRUE(
+          stream->Next(reinterpret_cast<const void**>(&rest), &restSize));
+      ASSERT_EQ(restSize, backUp);
+      ASSERT_EQ(rest, buffer + size - backUp);
+      pos += size;
+    }
+    ASSERT_EQ(pos, kDataSize);
+
+    const auto stats = cache->refreshStats();
+    if (pass == 0) {
+      numChunks = stats.numNew;
+      ASSERT_GT(numChunks, 0);
+      ASSERT_EQ(stats.numHit, 0);
+    } else {
+      // The second read returns every chunk from the cache.
+      ASSERT_EQ(stats.numNew, numChunks);
+      ASSERT_EQ(stats.numHit, numChunks);
+    }
+  }
+  cache->shutdown();
+}
+
+namespace {
+// Hardware decompressor that fails every chunk, as if its queues were full.
+class FailingDecompressor
+    : public facebook::velox::dwio::common::compression::Decompressor {
+ public:
+  FailingDecompressor(
+      uint64_t blockSize,
+      const std::string& streamDebugInfo,
+      int32_t& numCalls)
+      : Decompressor{blockSize, streamDebugInfo}, numCalls_{numCalls} {}
+
+  uint64_t decompress(const char*, uint64_t, char*, uint64_t) override {
+    ++numCalls_;
+    VELOX_FAIL("Accelerator queue full");
+  }
+
+ private:
+  int32_t& numCalls_;
+};
+} // namespace
+
+TEST(HardwareDecompressorTest, fallbackToCpu) {
+  namespace compression = facebook::velox::dwio::common::compression;
+  MemoryManager::testingSetInstance({});
+  auto pool = memoryManager()->addLeafPool();
+  constexpr uint64_t kBlock = 16 << 10;
+  constexpr size_t kDataSize = 4 * kBlock;
+  std::vector<char> data(kDataSize);
+  generateRandomData(data.data(), kDataSize, true);
+  for (auto kind : {CompressionKind_ZSTD, CompressionKind_ZLIB}) {
+    SCOPED_TRACE(compressionKindToString(kind));
+    MemorySink memSink(DEFAULT_MEM_STREAM_SIZE, {.pool = pool.get()});
+    compressAndVerify(
+        kind, memSink, kBlock, *pool, data.data(), kDataSize, nullptr);
+    for (bool available : {true, false}) {
+      int32_t numCalls = 0;
+      compression::registerHardwareDecompressor(
+          kind,
+          [&](uint64_t blockSize,
+              const compression::CompressionOptions& /*options*/,
+              const std::string& streamDebugInfo)
+              -> std::unique_ptr<compression::Decompressor> {
+            if (!available) {
+              return nullptr;
+            }
+            return std::make_unique<FailingDecompressor>(
+                blockSize, streamDebugInfo, numCalls);
+          });
+      auto stream = createDecompressor(
+          kind,
+          std::make_unique<SeekableArrayInputStream>(
+              memSink.data(), memSink.size()),
+          kBlock,
+          *pool,
+          "Test Compression");
+      const char* buffer;
+      int32_t size;
+      size_t pos = 0;
+      while (stream->Next(reinterpret_cast<const void**>(&buffer), &size)) {
+        ASSERT_LE(pos + size, kDataSize);
+        ASSERT_EQ(::memcmp(buffer, data.data() + pos, size), 0);
+        pos += size;
+      }
+      ASSERT_EQ(pos, kDataSize);
+      if (available) {
+        ASSERT_GT(numCalls, 0);
+      } else {
+        ASSERT_EQ(numCalls, 0);
+      }
+      compression::registerHardwareDecompressor(kind, nullptr);
+    }
+  }
+}
+
 VELOX_INSTANTIATE_TEST_SUITE_P(
     TestCompression,
     RecordPositionTest,
@@ -15,6 +15,7 @@
  */
 
 #include <folly/Random.h>
+#include <folly/executors/CPUThreadPoolExecutor.h>
 #include <random>
 #include "velox/common/base/SpillConfig.h"
 #include "velox/common/base/tests/GTestUtils.h"
@@ -1634,6 +1635,50 @@ TEST_F(E2EWriterTest, fuzzFlatmap) {
   }
 }
 
+TEST_F(E2EWriterTest, parallelEncoding) {
+  auto type = ROW({
+      {"bool_val", BOOLEAN()},
+      {"int_val", INTEGER()},
+      {"long_val", BIGINT()},
+      {"double_val", DOUBLE()},
+      {"string_val", VARCHAR()},
+      {"array_val", ARRAY(REAL())},
+      {"map_val", MAP(INTEGER(), VARCHAR())},
+      {"row_val", ROW({{"a", BIGINT()}, {"b", VARCHAR()}})},
+  });
+  auto config = std::make_shared<dwrf::Config>();
+  // Small compression blocks make the columns compress concurrently.
+  config->set<uint64_t>(dwrf::Config::COMPRESSION_BLOCK_SIZE, 1'024);
+  config->set<uint64_t>(dwrf::Config::COMPRESSION_BLOCK_SIZE_MIN, 1'024);
+  auto batches = E2EWriterTestUtil::generateBatches(
+      type, 10, 1'000, folly::Random::rand32(), *leafPool_);
+
+  auto writeFile = [&](std::shared_ptr<folly::Executor> executor) {
+    auto sink = std::make_unique<MemorySink>(
+        200 * 1024 * 1024,
+        dwio::common::FileSink::Options{.pool = leafPool_.get()});
+    auto sinkPtr = sink.get();
+    dwrf::WriterOptions options;
+    options.config = config;
+    options.schema = type;
+    options.memoryPool = rootPool_.get();
+    options.encodingExecutor = std::move(executor);
+    dwrf::Writer writer{std::move(sink), options};
+    for (const auto& batch : batches) {
+      writer.write(batch);
+    }
+    writer.close();
+    return std::string(sinkPtr->data(), sinkPtr->size());
+  };
+
+  // The columns are independent, so the file does not depend on the order in
+  // which they are encoded.
+  const auto expected = writeFile(nullptr);
+  const auto actual =
+      writeFile(std::make_shared<folly::CPUThreadPoolExecutor>(4));
+  ASSERT_EQ(expected, actual);
+}
+
 TEST_F(E2EWriterTest, memoryConfigError) {
   const auto type = ROW(
       {{"int_val", INTEGER()},
@@ -147,4 +147,50 @@ TEST_F(IndexBuilderTest, RemovePresentStreamPositions) {
   }
 }
 
+TEST_F(IndexBuilderTest, BloomFilter) {
+  BloomFilter bloomFilter{2'000, 0.01};
+  EXPECT_EQ(bloomFilter.numBits() % 64, 0);
+  EXPECT_GT(bloomFilter.numHashFunctions(), 1);
+  for (int64_t i = 0; i < 1'000; ++i) {
+    bloomFilter.addLong(i * 7);
+    bloomFilter.addBytes(std::to_string(i * 7));
+  }
+
+  auto expectContents = [](const BloomFilter& filter) {
+    int32_t numFalsePositives = 0;
+    for (int64_t i = 0; i < 7'000; ++i) {
+      if (i % 7 == 0) {
+        EXPECT_TRUE(filter.testLong(i));
+        EXPECT_TRUE(filter.testBytes(std::to_string(i)));
+      } else {
+        numFalsePositives += filter.testLong(i);
+        numFalsePositives += filter.testBytes(std::to_string(i));
+      }
+    }
+    // 12'000 absent values at a false positive rate of 1%.
+    EXPECT_LT(numFalsePositives, 300);
+  };
+  expectContents(bloomFilter);
+
+  proto::BloomFilter bloomFilterProto;
+  bloomFilter.toProto(bloomFilterProto);
+  EXPECT_EQ(bloomFilterProto.bitset_size() * 64, bloomFilter.numBits());
+  expectContents(BloomFilter{bloomFilterProto});
+
+  // ORC writers may store the bits as little endian bytes instead.
+  proto::BloomFilter utf8BloomFilterProto;
+  utf8BloomFilterProto.set_numhashfunctions(bloomFilter.numHashFunctions());
+  auto* bytes = utf8BloomFilterProto.mutable_utf8bitset();
+  for (auto word : bloomFilterProto.bitset()) {
+    for (int32_t i = 0; i < 8; ++i) {
+      bytes->push_back(static_cast<char>(word >> (8 * i)));
+    }
+  }
+  expectContents(BloomFilter{utf8BloomFilterProto});
+
+  bloomFilter.reset();
+  EXPECT_FALSE(bloomFilter.testLong(7));
+  EXPECT_FALSE(bloomFilter.testBytes("7"));
+}
+
 } // namespace facebook::velox::dwrf
@@ -2622,6 +2622,39 @@ TEST_F(TestReader, selectiveFlatMapFastPathAllInlinedStringKeys) {
   assertEqualVectors(batch, row);
 }
 
+TEST_F(TestReader, selectiveFlatMapFeatureSelection) {
+  auto maps = makeMapVector<std::string, int64_t>(
+      {{{"a", 0}, {"b", 0}, {"c", 0}}, {{"a", 1}, {"c", 1}}, {{"b", 2}}});
+  auto row = makeRowVector({"c0"}, {maps});
+  auto config = std::make_shared<dwrf::Config>();
+  config->set(dwrf::Config::FLATTEN_MAP, true);
+  config->set(dwrf::Config::MAP_FLAT_COLS, {0});
+  auto [writer, reader] = createWriterReader({row}, pool(), config);
+  auto schema = asRowType(row->type());
+  auto spec = std::make_shared<common::ScanSpec>("<root>");
+  spec->addAllChildFields(*schema);
+  spec->childByName("c0")->setFlatMapFeatureSelection({"a", "c"});
+  uint64_t totalKeys = 0;
+  uint64_t selectedKeys = 0;
+  RowReaderOptions rowReaderOpts;
+  rowReaderOpts.setScanSpec(spec);
+  rowReaderOpts.setKeySelectionCallback(
+      [&](dwio::common::flatmap::FlatMapKeySelectionStats stats) {
+        totalKeys += stats.totalKeys;
+        selectedKeys += stats.selectedKeys;
+      });
+  auto rowReader = reader->createRowReader(rowReaderOpts);
+  VectorPtr batch = BaseVector::create(schema, 0, pool());
+  ASSERT_EQ(rowReader->next(10, batch), 3);
+  auto expected = makeRowVector(
+      {"c0"},
+      {makeMapVector<std::string, int64_t>(
+          {{{"a", 0}, {"c", 0}}, {{"a", 1}, {"c", 1}}, {}})});
+  assertEqualVectors(expected, batch);
+  EXPECT_EQ(totalKeys, 3);
+  EXPECT_EQ(selectedKeys, 2);
+}
+
 TEST_F(TestReader, skipLongString) {
   // c0 in long_string.dwrf has 25 rows of 200,000,000 character long strings,
   // whose values are repeated 'a' to 'y' respectively.
@@ -2665,3 +2698,130 @@ TEST_F(TestReader, skipLongString) {
     validate(batch);
   }
 }
+
+TEST_F(TestReader, bloomFilterSkipsStrides) {
+  // Even values only. The stride stats cover the odd values in between, so
+  // only the Bloom filters can tell that they are absent.
+  constexpr int32_t kSize = 1'000;
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < kSize; ++i) {
+    strings.push_back(fmt::format("s{}", 2 * i));
+  }
+  auto batch = makeRowVector({
+      makeFlatVector<int64_t>(kSize, [](auto i) { return 2 * i; }),
+      makeFlatVector(strings),
+  });
+  auto config = std::make_shared<dwrf::Config>();
+  config->set(dwrf::Config::ROW_INDEX_STRIDE, 100u);
+  config->set<const std::vector<uint32_t>>(
+      dwrf::Config::BLOOM_FILTER_COLS, {0, 1});
+  config->set(dwrf::Config::BLOOM_FILTER_FPP, 0.0001f);
+  auto [writer, reader] = createWriterReader({batch}, pool(), config);
+  auto schema = asRowType(batch->type());
+
+  auto read = [&](const std::string& column,
+                  std::unique_ptr<common::Filter> filter,
+                  int64_t& skippedStrides) {
+    auto spec = std::make_shared<common::ScanSpec>("<root>");
+    spec->addAllChildFields(*schema);
+    spec->childByName(column)->setFilter(std::move(filter));
+    RowReaderOptions rowReaderOpts;
+    rowReaderOpts.setScanSpec(spec);
+    auto rowReader = reader->createRowReader(rowReaderOpts);
+    auto actual = BaseVector::create(schema, 0, pool());
+    vector_size_t numRows = 0;
+    while (rowReader->next(kSize, actual) > 0) {
+      numRows += actual->size();
+    }
+    dwio::common::RuntimeStatistics stats;
+    rowReader->updateRuntimeStats(stats);
+    skippedStrides = stats.skippedStrides;
+    return numRows;
+  };
+
+  int64_t skippedStrides;
+  ASSERT_EQ(
+      read("c0", common::createBigintValues({101}, false), skippedStrides), 0);
+  ASSERT_EQ(skippedStrides, 10);
+  ASSERT_EQ(
+      read("c0", common::createBigintValues({101, 301}, false), skippedStrides),
+      0);
+  ASSERT_EQ(skippedStrides, 10);
+  ASSERT_EQ(
+      read("c0", common::createBigintValues({100, 301}, false), skippedStrides),
+      1);
+  ASSERT_EQ(skippedStrides, 9);
+  ASSERT_EQ(
+      read(
+          "c1",
+          std::make_unique<common::BytesValues>(
+              std::vector<std::string>{"s101", "s1001"}, false),
+          skippedStrides),
+      0);
+  ASSERT_EQ(skippedStrides, 10);
+  ASSERT_EQ(
+      read(
+          "c1",
+          std::make_unique<common::BytesValues>(
+              std::vector<std::string>{"s100"}, false),
+          skippedStrides),
+      1);
+}
+
+TEST_F(TestReader, readRowsByRowNumber) {
+  constexpr int32_t kSize = 1'000;
+  auto batch = makeRowVector({
+      makeFlatVector<int64_t>(kSize, folly::identity),
+      makeFlatVector<std::string>(
+          kSize, [](auto i) { return fmt::format("s{}", i); }),
+  });
+  auto config = std::make_shared<dwrf::Config>();
+  config->set(dwrf::Config::ROW_INDEX_STRIDE, 100u);
+  auto [writer, reader] = createWriterReader({batch}, pool(), config);
+  auto schema = asRowType(batch->type());
+
+  auto read = [&](const std::vector<uint64_t>& rowNumbers,
+                  std::unique_ptr<common::Filter> filter = nullptr) {
+    auto spec = std::make_shared<common::ScanSpec>("<root>");
+    spec->addAllChildFields(*schema);
+    if (filter) {
+      spec->childByName("c0")->setFilter(std::move(filter));
+    }
+    RowReaderOptions rowReaderOpts;
+    rowReaderOpts.setScanSpec(spec);
+    auto rowReader = reader->createRowReader(rowReaderOpts);
+    VectorPtr result = BaseVector::create(schema, 0, pool());
+    rowReader->readRows(rowNumbers, result);
+    // The reader can still be read on from the last row read.
+    VectorPtr rest = BaseVector::create(schema, 0, pool());
+    rowReader->next(1, rest);
+    return std::make_pair(result, rest);
+  };
+
+  auto expected = [&](const std::vector<int64_t>& rows) {
+    return makeRowVector({
+        makeFlatVector<int64_t>(rows),
+        makeFlatVector<std::string>(
+            rows.size(), [&](auto i) { return fmt::format("s{}", rows[i]); }),
+    });
+  };
+
+  auto [result, rest] = read({3, 250, 251, 299, 700, 999});
+  assertEqualVectors(expected({3, 250, 251, 299, 700, 999}), result);
+  EXPECT_EQ(rest->size(), 0);
+
+  std::tie(result, rest) = read({0, 100, 550});
+  assertEqualVectors(expected({0, 100, 550}), result);
+  assertEqualVectors(expected({551}), rest);
+
+  // The rows not passing the filter are left out.
+  std::tie(result, rest) =
+      read({5, 120, 130, 640}, common::createBigintValues({120, 640}, false));
+  assertEqualVectors(expected({120, 640}), result);
+
+  std::tie(result, rest) = read({});
+  EXPECT_EQ(result->size(), 0);
+
+  VELOX_ASSERT_THROW(read({10, 5}), "Row numbers must be increasing");
+  VELOX_ASSERT_THROW(read({1'000}), "Row number out of range");
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/Benchmark.h>
+#include <folly/Random.h>
+#include <folly/init/Init.h>
+#include "velox/common/memory/Memory.h"
+#include "velox/dwio/common/SeekableInputStream.h"
+#include "velox/dwio/dwrf/common/DecoderUtil.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::dwrf;
+
+namespace {
+
+constexpr uint64_t kNumValues = 1'000'000;
+constexpr uint64_t kMaxRunLength = 512;
+constexpr size_t kBatchSize = 1'000;
+
+// Code of a fixed bit width in the header of a RLEv2 run.
+uint32_t encodeBitWidth(uint32_t width) {
+  if (width <= 24) {
+    return width - 1;
+  }
+  switch (width) {
+    case 26:
+      return 24;
+    case 28:
+      return 25;
+    case 30:
+      return 26;
+    case 32:
+      return 27;
+    case 40:
+      return 28;
+    case 48:
+      return 29;
+    case 56:
+      return 30;
+    default:
+      return 31;
+  }
+}
+
+void appendVarint(std::vector<unsigned char>& out, uint64_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<unsigned char>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<unsigned char>(value));
+}
+
+// Packs 'values' MSB first with 'width' bits each.
+void appendPacked(
+    std::vector<unsigned char>& out,
+    const uint64_t* values,
+    uint64_t numValues,
+    uint32_t width) {
+  uint64_t bitBuffer = 0;
+  uint32_t numBits = 0;
+  for (uint64_t i = 0; i < numValues; ++i) {
+    for (int32_t bit = width - 1; bit >= 0; --bit) {
+      bitBuffer = (bitBuffer << 1) | ((values[i] >> bit) & 1);
+      if (++numBits == 8) {
+        out.push_back(static_cast<unsigned char>(bitBuffer));
+        bitBuffer = 0;
+        numBits = 0;
+      }
+    }
+  }
+  if (numBits > 0) {
+    out.push_back(static_cast<unsigned char>(bitBuffer << (8 - numBits)));
+  }
+}
+
+// Unsigned DIRECT runs of random 'width' bit values.
+std::vector<unsigned char> makeDirectRuns(uint32_t width) {
+  folly::Random::DefaultGenerator rng(width);
+  std::vector<unsigned char> bytes;
+  std::vector<uint64_t> values(kMaxRunLength);
+  for (uint64_t row = 0; row < kNumValues; row += kMaxRunLength) {
+    const auto runLength = std::min(kMaxRunLength, kNumValues - row);
+    for (uint64_t i = 0; i < runLength; ++i) {
+      values[i] = width == 64 ? folly::Random::rand64(rng)
+                              : folly::Random::rand64(rng) >> (64 - width);
+    }
+    bytes.push_back(
+        0x40 | (encodeBitWidth(width) << 1) | ((runLength - 1) >> 8));
+    bytes.push_back((runLength - 1) & 0xff);
+    appendPacked(bytes, values.data(), runLength, width);
+  }
+  return bytes;
+}
+
+// Unsigned increasing DELTA runs with random 'width' bit deltas.
+std::vector<unsigned char> makeDeltaRuns(uint32_t width) {
+  folly::Random::DefaultGenerator rng(width);
+  std::vector<unsigned char> bytes;
+  std::vector<uint64_t> deltas(kMaxRunLength);
+  uint64_t value = 0;
+  for (uint64_t row = 0; row < kNumValues; row += kMaxRunLength) {
+    const auto runLength = std::min(kMaxRunLength, kNumValues - row);
+    for (uint64_t i = 0; i < runLength - 2; ++i) {
+      deltas[i] = folly::Random::rand64(rng) >> (64 - width);
+    }
+    bytes.push_back(
+        0xc0 | (encodeBitWidth(width) << 1) | ((runLength - 1) >> 8));
+    bytes.push_back((runLength - 1) & 0xff);
+    appendVarint(bytes, value);
+    // The delta base is zigzag encoded and must not be 0.
+    appendVarint(bytes, 2);
+    appendPacked(bytes, deltas.data(), runLength - 2, width);
+    value += 1;
+    for (uint64_t i = 0; i < runLength - 2; ++i) {
+      value += deltas[i];
+    }
+  }
+  return bytes;
+}
+
+void decode(const std::vector<unsigned char>& bytes) {
+  auto pool = memory::memoryManager()->addLeafPool();
+  auto rle = createRleDecoder</*isSigned=*/false>(
+      std::make_unique<dwio::common::SeekableArrayInputStream>(
+          bytes.data(), bytes.size()),
+      RleVersion_2,
+      *pool,
+      true,
+      dwio::common::LONG_BYTE_SIZE);
+  std::vector<int64_t> data(kBatchSize);
+  for (uint64_t row = 0; row < kNumValues; row += kBatchSize) {
+    rle->next(data.data(), kBatchSize, nullptr);
+    folly::doNotOptimizeAway(data[0]);
+  }
+}
+
+} // namespace
+
+#define DECODE_BENCHMARK(kind, width)    \
+  BENCHMARK(kind##_##width, iters) {     \
+    std::vector<unsigned char> bytes;    \
+    BENCHMARK_SUSPEND {                  \
+      bytes = make##kind##Runs(width);   \
+    }                                    \
+    for (size_t i = 0; i < iters; ++i) { \
+      decode(bytes);                     \
+    }                                    \
+  }
+
+DECODE_BENCHMARK(Direct, 3)
+DECODE_BENCHMARK(Direct, 8)
+DECODE_BENCHMARK(Direct, 11)
+DECODE_BENCHMARK(Direct, 16)
+DECODE_BENCHMARK(Direct, 24)
+DECODE_BENCHMARK(Direct, 30)
+DECODE_BENCHMARK(Direct, 32)
+DECODE_BENCHMARK(Direct, 64)
+
+BENCHMARK_DRAW_LINE();
+
+DECODE_BENCHMARK(Delta, 2)
+DECODE_BENCHMARK(Delta, 5)
+DECODE_BENCHMARK(Delta, 8)
+DECODE_BENCHMARK(Delta, 13)
+
+int32_t main(int32_t argc, char* argv[]) {
+  folly::Init init{&argc, &argv};
+  memory::MemoryManager::initialize({});
+  folly::runBenchmarks();
+  return 0;
+}
@@ -673,6 +673,69 @@ TEST_F(RLEv2Test, bitsLeftByPreviousStream) {
   }
 };
 
+TEST_F(RLEv2Test, directRunsAllBitWidths) {
+  // Encoded bit widths of DIRECT runs and their 5 bit codes.
+  const std::vector<std::pair<uint32_t, uint32_t>> widths = {
+      {1, 0},   {2, 1},   {3, 2},   {5, 4},   {7, 6},   {8, 7},
+      {11, 10}, {13, 12}, {16, 15}, {17, 16}, {24, 23}, {26, 24},
+      {28, 25}, {30, 26}, {32, 27}, {40, 28}, {48, 29}, {56, 30},
+      {64, 31}};
+  std::vector<unsigned char> bytes;
+  std::vector<int64_t> values;
+  uint64_t seed = 1;
+  for (const auto& [width, code] : widths) {
+    // Two runs per width, one of the maximum length of 512 values.
+    for (const uint64_t runLength : {512, 37}) {
+      bytes.push_back(0x40 | (code << 1) | ((runLength - 1) >> 8));
+      bytes.push_back((runLength - 1) & 0xff);
+      uint64_t bitBuffer = 0;
+      uint32_t numBits = 0;
+      for (uint64_t i = 0; i < runLength; ++i) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        const uint64_t zigzag = width == 64 ? seed : seed >> (64 - width);
+        values.push_back(
+            static_cast<int64_t>(zigzag >> 1) ^
+            -static_cast<int64_t>(zigzag & 1));
+        for (int32_t bit = width - 1; bit >= 0; --bit) {
+          bitBuffer = (bitBuffer << 1) | ((zigzag >> bit) & 1);
+          if (++numBits == 8) {
+            bytes.push_back(static_cast<unsigned char>(bitBuffer));
+            bitBuffer = 0;
+            numBits = 0;
+          }
+        }
+      }
+      if (numBits > 0) {
+        bytes.push_back(static_cast<unsigned char>(bitBuffer << (8 - numBits)));
+      }
+    }
+  }
+
+  auto pool = memory::memoryManager()->addLeafPool();
+  // Small blocks make values straddle the buffers of the stream.
+  for (const uint64_t blockSize : {0, 7, 100}) {
+    for (const size_t batchSize : {1, 13, 1000}) {
+      auto rle = createRleDecoder<true>(
+          std::make_unique<dwio::common::SeekableArrayInputStream>(
+              bytes.data(), bytes.size(), blockSize),
+          RleVersion_2,
+          *pool,
+          true,
+          dwio::common::LONG_BYTE_SIZE);
+      std::vector<int64_t> data(values.size());
+      for (size_t i = 0; i < values.size(); i += batchSize) {
+        rle->next(
+            data.data() + i, std::min(batchSize, values.size() - i), nullptr);
+      }
+      for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(values[i], data[i])
+            << "Output wrong at " << i << ", block size " << blockSize
+            << ", batch size " << batchSize;
+      }
+    }
+  }
+}
+
 class RLEv1Test : public testing::Test {
  protected:
   static void SetUpTestCase() {
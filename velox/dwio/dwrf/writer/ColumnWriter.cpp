@@ -15,8 +15,11 @@
  */
 
 #include "velox/dwio/dwrf/writer/ColumnWriter.h"
+#include <numeric>
+#include <optional>
 #include <velox/dwio/common/exception/Exception.h>
 #include "velox/dwio/common/ChainedBuffer.h"
+#include "velox/dwio/common/ExecutorBarrier.h"
 #include "velox/dwio/dwrf/common/EncoderUtil.h"
 #include "velox/dwio/dwrf/writer/DictionaryEncodingUtils.h"
 #include "velox/dwio/dwrf/writer/EntropyEncodingSelector.h"
@@ -35,7 +38,12 @@ namespace facebook::velox::dwrf {
 WriterContext::LocalDecodedVector BaseColumnWriter::decode(
     const VectorPtr& slice,
     const common::Ranges& ranges) {
-  auto& selected = context_.getSharedSelectivityVector(slice->size());
+  // The shared selectivity vector can't be used by the columns encoded in
+  // parallel.
+  std::optional<SelectivityVector> localSelected;
+  auto& selected = context_.encodingExecutor() != nullptr
+      ? localSelected.emplace(slice->size())
+      : context_.getSharedSelectivityVector(slice->size());
   // initialize
   selected.clearAll();
   for (auto& range : ranges.getRanges()) {
@@ -225,6 +233,7 @@ class IntegerColumnWriter : public BaseColumnWriter {
           context_.shareFlatMapDictionaries() ? 0 : sequence_);
       initStreamWriters(useDictionaryEncoding_);
     }
+    maybeEnableBloomFilter();
     reset();
   }
 
@@ -302,6 +311,7 @@ class IntegerColumnWriter : public BaseColumnWriter {
     // Add entry with stats for either case.
     indexBuilder_->addEntry(*indexStatsBuilder_);
     indexStatsBuilder_->reset();
+    addBloomFilterEntry();
     BaseColumnWriter::recordPosition();
     // TODO: the only way useDictionaryEncoding_ right now is
     // through abandonDictionary, so we already have the stream initialization
@@ -512,10 +522,14 @@ uint64_t IntegerColumnWriter<T>::writeDict(
   writeNulls(decodedVector, ranges);
   // make sure we have enough space
   rows_.reserve(rows_.size() + ranges.size());
+  auto* bloomFilter = bloomFilter_.get();
   auto processRow = [&](vector_size_t pos) {
     T value = decodedVector.valueAt<T>(pos);
     rows_.unsafeAppend(dictEncoder_.addKey(value));
     statsBuilder.addValues(value);
+    if (bloomFilter) {
+      bloomFilter->addLong(value);
+    }
   };
 
   uint64_t nullCount = 0;
@@ -558,6 +572,13 @@ uint64_t IntegerColumnWriter<T>::writeDirect(
       dynamic_cast<IntegerStatisticsBuilder&>(*indexStatsBuilder_),
       slice,
       ranges);
+  if (bloomFilter_) {
+    for (auto& pos : ranges) {
+      if (!nulls || !bits::isBitNull(nulls, pos)) {
+        bloomFilter_->addLong(vals[pos]);
+      }
+    }
+  }
   auto rawSize = count * sizeof(T) + (ranges.size() - count) * NULL_SIZE;
   indexStatsBuilder_->increaseRawSize(rawSize);
   return rawSize;
@@ -925,12 +946,15 @@ class StringColumnWriter : public BaseColumnWriter {
             getConfig(Config::ENTROPY_STRING_DICT_SAMPLE_FRACTION),
             getConfig(Config::ENTROPY_STRING_THRESHOLD)},
         sort_{getConfig(Config::DICTIONARY_SORT_KEYS)},
+        dictionarySampleRows_{
+            getConfig(Config::DICTIONARY_STRING_SAMPLE_ROWS)},
         useDictionaryEncoding_{useDictionaryEncoding()},
         strideOffsets_{getMemoryPool(MemoryUsageCategory::GENERAL)} {
     VELOX_CHECK(firstStripe_);
     if (!useDictionaryEncoding_) {
       initStreamWriters(useDictionaryEncoding_);
     }
+    maybeEnableBloomFilter();
     reset();
   }
 
@@ -1015,6 +1039,7 @@ class StringColumnWriter : public BaseColumnWriter {
     // Add entry with stats for either case.
     indexBuilder_->addEntry(*indexStatsBuilder_);
     indexStatsBuilder_->reset();
+    addBloomFilterEntry();
     BaseColumnWriter::recordPosition();
     // TODO: the only way useDictionaryEncoding_ right now is
     // through abandonDictionary, so we already have the stream initialization
@@ -1062,6 +1087,13 @@ class StringColumnWriter : public BaseColumnWriter {
       return false;
     }
 
+    abandonDictionary();
+    return true;
+  }
+
+ private:
+  void abandonDictionary() {
+    useDictionaryEncoding_ = false;
     initStreamWriters(useDictionaryEncoding_);
     // Record direct encoding stream starting position.
     recordDirectEncodingStreamPositions(0);
@@ -1069,10 +1101,21 @@ class StringColumnWriter : public BaseColumnWriter {
     dictEncoder_.clear();
     rows_.clear(true);
     strideOffsets_.clear();
-    return true;
   }
 
- private:
+  // Once the first stripe has 'dictionarySampleRows_' values, switches to
+  // direct encoding if the dictionary of these values is not worth keeping.
+  void maybeAbandonDictionaryOnSample() {
+    if (dictionarySampleRows_ == 0 || sampleChecked_ || !firstStripe_ ||
+        rows_.size() < dictionarySampleRows_) {
+      return;
+    }
+    sampleChecked_ = true;
+    if (!shouldKeepDictionary()) {
+      abandonDictionary();
+    }
+  }
+
   uint64_t writeDict(
       DecodedVector& decodedVector,
       const common::Ranges& ranges);
@@ -1198,11 +1241,15 @@ class StringColumnWriter : public BaseColumnWriter {
   size_t finalDictionarySize_;
   EntropyEncodingSelector encodingSelector_;
   const bool sort_;
+  const uint32_t dictionarySampleRows_;
   // This value could change if we are writing with low memory mode or if we
   // determine with the first stripe that the data is not fit for dictionary
   // encoding.
   bool useDictionaryEncoding_;
   bool firstStripe_{true};
+  // True once the dictionary of the first 'dictionarySampleRows_' values has
+  // been checked.
+  bool sampleChecked_{false};
   DataBuffer<size_t> strideOffsets_;
 };
 
@@ -1229,10 +1276,14 @@ uint64_t StringColumnWriter::writeDict(
   rows_.reserve(rows_.size() + ranges.size());
   size_t strideIndex = strideOffsets_.size() - 1;
   uint64_t rawSize = 0;
+  auto* bloomFilter = bloomFilter_.get();
   auto processRow = [&](size_t pos) {
     auto sp = decodedVector.valueAt<StringView>(pos);
     rows_.unsafeAppend(dictEncoder_.addKey(sp, strideIndex));
     statsBuilder.addValues(sp);
+    if (bloomFilter) {
+      bloomFilter->addBytes(std::string_view(sp.data(), sp.size()));
+    }
     rawSize += sp.size();
   };
 
@@ -1256,6 +1307,7 @@ uint64_t StringColumnWriter::writeDict(
     rawSize += nullCount * NULL_SIZE;
   }
   statsBuilder.increaseRawSize(rawSize);
+  maybeAbandonDictionaryOnSample();
   return rawSize;
 }
 
@@ -1273,11 +1325,15 @@ uint64_t StringColumnWriter::writeDirect(
   lengths.reserve(ranges.size());
 
   uint64_t rawSize = 0;
+  auto* bloomFilter = bloomFilter_.get();
   auto processRow = [&](size_t pos) {
     auto sp = decodedVector.valueAt<StringView>(pos);
     auto size = sp.size();
     dataDirect_->write(sp.data(), size);
     statsBuilder.addValues(sp);
+    if (bloomFilter) {
+      bloomFilter->addBytes(std::string_view(sp.data(), size));
+    }
     rawSize += size;
     lengths.unsafeAppend(size);
   };
@@ -1739,6 +1795,12 @@ class StructColumnWriter : public BaseColumnWriter {
       const RowVector* rowSlice,
       const common::Ranges& ranges,
       uint64_t nullCount);
+
+  // Writes the root columns on the encoding executor of the context and
+  // returns their total raw size.
+  uint64_t writeChildrenInParallel(
+      const RowVector* rowSlice,
+      const common::Ranges& ranges);
 };
 
 uint64_t StructColumnWriter::writeChildrenAndStats(
@@ -1747,8 +1809,13 @@ uint64_t StructColumnWriter::writeChildrenAndStats(
     uint64_t nullCount) {
   uint64_t rawSize = 0;
   if (ranges.size() > 0) {
-    for (size_t i = 0; i < children_.size(); ++i) {
-      rawSize += children_.at(i)->write(rowSlice->childAt(i), ranges);
+    if (isRoot() && context_.encodingExecutor() != nullptr &&
+        children_.size() > 1) {
+      rawSize = writeChildrenInParallel(rowSlice, ranges);
+    } else {
+      for (size_t i = 0; i < children_.size(); ++i) {
+        rawSize += children_.at(i)->write(rowSlice->childAt(i), ranges);
+      }
     }
   }
   if (nullCount) {
@@ -1760,6 +1827,37 @@ uint64_t StructColumnWriter::writeChildrenAndStats(
   return rawSize;
 }
 
+uint64_t StructColumnWriter::writeChildrenInParallel(
+    const RowVector* rowSlice,
+    const common::Ranges& ranges) {
+  // Flat map writers create their value writers, streams and dictionaries in
+  // the shared context while writing, so they are written on this thread
+  // after the other columns.
+  const auto& flatMapCols = context_.getConfig(Config::MAP_FLAT_COLS);
+  const bool flattenMap = context_.getConfig(Config::FLATTEN_MAP);
+  std::vector<uint64_t> rawSizes(children_.size(), 0);
+  std::vector<size_t> sequential;
+  {
+    dwio::common::ExecutorBarrier barrier{context_.encodingExecutor()};
+    for (size_t i = 0; i < children_.size(); ++i) {
+      if (flattenMap &&
+          std::find(flatMapCols.begin(), flatMapCols.end(), i) !=
+              flatMapCols.end()) {
+        sequential.push_back(i);
+        continue;
+      }
+      barrier.add([&, i]() {
+        rawSizes[i] = children_[i]->write(rowSlice->childAt(i), ranges);
+      });
+    }
+    barrier.waitAll();
+  }
+  for (auto i : sequential) {
+    rawSizes[i] = children_[i]->write(rowSlice->childAt(i), ranges);
+  }
+  return std::accumulate(rawSizes.begin(), rawSizes.end(), uint64_t{0});
+}
+
 uint64_t StructColumnWriter::write(
     const VectorPtr& slice,
     const common::Ranges& ranges) {
@@ -2136,6 +2234,22 @@ std::unique_ptr<BaseColumnWriter> BaseColumnWriter::create(
     }
   }
 
+  if (type.parent() != nullptr && type.parent()->id() == 0) {
+    const auto& bloomFilterCols = context.getConfig(Config::BLOOM_FILTER_COLS);
+    if (std::find(
+            bloomFilterCols.begin(), bloomFilterCols.end(), type.column()) !=
+        bloomFilterCols.end()) {
+      const auto kind = type.type()->kind();
+      VELOX_USER_CHECK(
+          !type.type()->isDecimal() &&
+              (kind == TypeKind::SMALLINT || kind == TypeKind::INTEGER ||
+               kind == TypeKind::BIGINT || kind == TypeKind::VARCHAR),
+          "BLOOM_FILTER_COLS contains column {} of unsupported type {}",
+          type.column(),
+          type.type()->toString());
+    }
+  }
+
   switch (type.type()->kind()) {
     case TypeKind::BOOLEAN:
       return std::make_unique<ByteRleColumnWriter<bool>>(
@@ -84,6 +84,7 @@ class BaseColumnWriter : public ColumnWriter {
     fileStatsBuilder_->merge(*indexStatsBuilder_, /*ignoreSize=*/true);
     indexBuilder_->addEntry(*indexStatsBuilder_);
     indexStatsBuilder_->reset();
+    addBloomFilterEntry();
     recordPosition();
     for (auto& child : children_) {
       child->createIndexEntry();
@@ -207,6 +208,34 @@ class BaseColumnWriter : public ColumnWriter {
     return 0;
   }
 
+  /// Writes a Bloom filter of each stride if 'this' is a top level column
+  /// listed in Config::BLOOM_FILTER_COLS. Called by the writers that add their
+  /// values to 'bloomFilter_'.
+  void maybeEnableBloomFilter() {
+    if (!isIndexEnabled() || sequence_ != 0 || type_.parent() == nullptr ||
+        type_.parent()->id() != 0) {
+      return;
+    }
+    const auto columns = getConfig(Config::BLOOM_FILTER_COLS);
+    if (std::find(columns.begin(), columns.end(), type_.column()) ==
+        columns.end()) {
+      return;
+    }
+    bloomFilter_ = std::make_unique<BloomFilter>(
+        context_.indexStride(), getConfig(Config::BLOOM_FILTER_FPP));
+    indexBuilder_->setBloomFilterStream(
+        newStream(StreamKind::StreamKind_BLOOM_FILTER_UTF8));
+  }
+
+  /// Adds the Bloom filter of the completed stride to the index and clears it
+  /// for the next stride.
+  void addBloomFilterEntry() {
+    if (bloomFilter_) {
+      indexBuilder_->addBloomFilter(*bloomFilter_);
+      bloomFilter_->reset();
+    }
+  }
+
   virtual void recordPosition() {
     if (onRecordPosition_) {
       onRecordPosition_(*indexBuilder_);
@@ -264,6 +293,8 @@ class BaseColumnWriter : public ColumnWriter {
   std::unique_ptr<StatisticsBuilder> indexStatsBuilder_;
   std::unique_ptr<StatisticsBuilder> fileStatsBuilder_;
   std::unique_ptr<ByteRleEncoder> present_;
+  // Values of the current stride. Set only if Bloom filters are written.
+  std::unique_ptr<BloomFilter> bloomFilter_;
   bool hasNull_ = false;
   // callback used to inject the logic that captures positions for flat map
   // in_map stream
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "velox/dwio/common/OutputStream.h"
+#include "velox/dwio/dwrf/common/BloomFilter.h"
 #include "velox/dwio/dwrf/common/wrap/dwrf-proto-wrapper.h"
 #include "velox/dwio/dwrf/writer/StatisticsBuilder.h"
 
@@ -51,6 +52,23 @@ class IndexBuilder : public PositionRecorder {
     entry_.Clear();
   }
 
+  /// Enables writing the per stride Bloom filters added by addBloomFilter()
+  /// to 'out' on flush().
+  void setBloomFilterStream(std::unique_ptr<BufferedOutputStream> out) {
+    bloomFilterOut_ = std::move(out);
+  }
+
+  bool hasBloomFilters() const {
+    return bloomFilterOut_ != nullptr;
+  }
+
+  /// Adds the Bloom filter of the stride of the entry added by the matching
+  /// addEntry() call.
+  virtual void addBloomFilter(const BloomFilter& bloomFilter) {
+    VELOX_CHECK(hasBloomFilters());
+    bloomFilter.toProto(*bloomFilterIndex_.add_bloomfilter());
+  }
+
   virtual size_t getEntrySize() const {
     const int32_t size = index_.entry_size() + 1;
     VELOX_CHECK_GT(size, 0, "Invalid entry size or missing current entry.");
@@ -63,6 +81,11 @@ class IndexBuilder : public PositionRecorder {
     out_->flush();
     index_.Clear();
     entry_.Clear();
+    if (bloomFilterOut_) {
+      bloomFilterIndex_.SerializeToZeroCopyStream(bloomFilterOut_.get());
+      bloomFilterOut_->flush();
+      bloomFilterIndex_.Clear();
+    }
   }
 
   void capturePresentStreamOffset() {
@@ -101,6 +124,8 @@ class IndexBuilder : public PositionRecorder {
   proto::RowIndex index_;
   proto::RowIndexEntry entry_;
   std::optional<int32_t> presentStreamOffset_;
+  std::unique_ptr<BufferedOutputStream> bloomFilterOut_;
+  proto::BloomFilterIndex bloomFilterIndex_;
 
   friend class IndexBuilderTest;
 };
@@ -177,6 +177,7 @@ Writer::Writer(
       options.adjustTimestampToTimezone,
       std::move(handler));
   auto& context = writerBase_->getContext();
+  context.setEncodingExecutor(options.encodingExecutor);
   VELOX_CHECK_EQ(
       context.getTotalMemoryUsage(),
       0,
@@ -45,6 +45,10 @@ struct WriterOptions : public dwio::common::WriterOptions {
   const tz::TimeZone* sessionTimezone{nullptr};
   bool adjustTimestampToTimezone{false};
   DwrfFormat format{DwrfFormat::kDwrf};
+  /// Optional executor to encode the top level columns in parallel on. Wide
+  /// tables benefit the most. Flat map columns are always encoded on the
+  /// writing thread.
+  std::shared_ptr<folly::Executor> encodingExecutor;
 
   void processConfigs(
       const config::ConfigBase& connectorConfig,
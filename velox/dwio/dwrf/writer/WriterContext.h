@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <folly/Executor.h>
 #include <limits>
+#include <mutex>
 #include "velox/common/base/GTestMacros.h"
 #include "velox/common/time/CpuWallTimer.h"
 #include "velox/dwio/dwrf/common/Common.h"
@@ -258,6 +260,13 @@ class WriterContext : public CompressionBufferPool {
 
   std::unique_ptr<dwio::common::DataBuffer<char>> getBuffer(
       uint64_t size) override {
+    std::lock_guard<std::mutex> l(mutex_);
+    if (compressionBuffer_ == nullptr && encodingExecutor_ != nullptr) {
+      // The shared buffer is in use by a column encoded on another thread.
+      return std::make_unique<dwio::common::DataBuffer<char>>(
+          *generalPool_,
+          std::max<uint64_t>(size, compressionBlockSize_ + PAGE_HEADER_SIZE));
+    }
     VELOX_CHECK_NOT_NULL(compressionBuffer_);
     VELOX_CHECK_GE(compressionBuffer_->size(), size);
     return std::move(compressionBuffer_);
@@ -266,6 +275,11 @@ class WriterContext : public CompressionBufferPool {
   void returnBuffer(
       std::unique_ptr<dwio::common::DataBuffer<char>> buffer) override {
     VELOX_CHECK_NOT_NULL(buffer);
+    std::lock_guard<std::mutex> l(mutex_);
+    if (compressionBuffer_ != nullptr && encodingExecutor_ != nullptr) {
+      // Keeps one buffer and frees the ones allocated for parallel encoding.
+      return;
+    }
     VELOX_CHECK_NULL(compressionBuffer_);
     compressionBuffer_ = std::move(buffer);
   }
@@ -582,6 +596,18 @@ class WriterContext : public CompressionBufferPool {
     return LocalDecodedVector{*this};
   }
 
+  /// Sets the executor to encode the root columns in parallel on. If null, the
+  /// columns are encoded sequentially on the calling thread.
+  void setEncodingExecutor(std::shared_ptr<folly::Executor> executor) {
+    encodingExecutor_ = std::move(executor);
+  }
+
+  const std::shared_ptr<folly::Executor>& encodingExecutor() const {
+    return encodingExecutor_;
+  }
+
+  /// Returns the reusable selectivity vector. Must not be used while the
+  /// columns are encoded in parallel.
   SelectivityVector& getSharedSelectivityVector(velox::vector_size_t size) {
     if (FOLLY_UNLIKELY(selectivityVector_ == nullptr)) {
       selectivityVector_ = std::make_unique<velox::SelectivityVector>(size);
@@ -609,6 +635,7 @@ class WriterContext : public CompressionBufferPool {
   void validateConfigs() const;
 
   std::unique_ptr<velox::DecodedVector> getDecodedVector() {
+    std::lock_guard<std::mutex> l(mutex_);
     if (decodedVectorPool_.empty()) {
       return std::make_unique<velox::DecodedVector>();
     }
@@ -618,6 +645,7 @@ class WriterContext : public CompressionBufferPool {
   }
 
   void releaseDecodedVector(std::unique_ptr<velox::DecodedVector>&& vector) {
+    std::lock_guard<std::mutex> l(mutex_);
     decodedVectorPool_.push_back(std::move(vector));
   }
 
@@ -658,6 +686,10 @@ class WriterContext : public CompressionBufferPool {
   std::function<std::unique_ptr<IndexBuilder>(
       std::unique_ptr<BufferedOutputStream>)>
       indexBuilderFactory_;
+  std::shared_ptr<folly::Executor> encodingExecutor_;
+  // Serializes the access to the compression buffer and the decoded vector
+  // pool from the columns encoded in parallel.
+  std::mutex mutex_;
   std::unique_ptr<dwio::common::DataBuffer<char>> compressionBuffer_;
   // A pool of reusable DecodedVectors.
   std::vector<std::unique_ptr<velox::DecodedVector>> decodedVectorPool_;
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace facebook::velox::parquet {
+
+namespace detail {
+template <int32_t kWidth>
+void decodeByteStreamSplit(const char* data, int32_t numValues, char* out) {
+  // All bytes of a value are written in the same iteration with a constant
+  // stride, so that the compiler turns the loop into SIMD loads and
+  // interleaving shuffles.
+  for (int32_t i = 0; i < numValues; ++i) {
+    for (int32_t byte = 0; byte < kWidth; ++byte) {
+      out[i * kWidth + byte] = data[byte * numValues + i];
+    }
+  }
+}
+} // namespace detail
+
+/// Decodes 'numValues' values of 'width' bytes in BYTE_STREAM_SPLIT encoding
+/// from 'data' into their PLAIN encoding in 'out'. The encoding stores byte 0
+/// of all values, then byte 1 of all values and so on. 'out' must have space
+/// for 'numValues' * 'width' bytes.
+inline void decodeByteStreamSplit(
+    const char* data,
+    int32_t numValues,
+    int32_t width,
+    char* out) {
+  switch (width) {
+    case 2:
+      detail::decodeByteStreamSplit<2>(data, numValues, out);
+      break;
+    case 4:
+      detail::decodeByteStreamSplit<4>(data, numValues, out);
+      break;
+    case 8:
+      detail::decodeByteStreamSplit<8>(data, numValues, out);
+      break;
+    case 16:
+      detail::decodeByteStreamSplit<16>(data, numValues, out);
+      break;
+    default:
+      for (int32_t byte = 0; byte < width; ++byte) {
+        const char* stream = data + static_cast<int64_t>(byte) * numValues;
+        for (int32_t i = 0; i < numValues; ++i) {
+          out[static_cast<int64_t>(i) * width + byte] = stream[i];
+        }
+      }
+  }
+}
+
+} // namespace facebook::velox::parquet
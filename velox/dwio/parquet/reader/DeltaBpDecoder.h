@@ -18,6 +18,7 @@
 
 #include "velox/common/base/BitUtil.h"
 #include "velox/common/base/Exceptions.h"
+#include "velox/dwio/common/BitPackDecoder.h"
 
 namespace facebook::velox::parquet {
 
@@ -201,20 +202,11 @@ class DeltaBpDecoder {
       }
     }
 
-    uint64_t consumedBits =
-        (valuesPerMiniBlock_ - valuesRemainingCurrentMiniBlock_) *
-        deltaBitWidth_;
-    bits::copyBits(
-        reinterpret_cast<const uint64_t*>(bufferStart_),
-        consumedBits,
-        reinterpret_cast<uint64_t*>(&value),
-        0,
-        deltaBitWidth_);
-    // Addition between minDelta_, packed int and lastValue_ should be treated
-    // as unsigned addition. Overflow is as expected.
-    value = static_cast<uint64_t>(minDelta_) + static_cast<uint64_t>(value) +
-        static_cast<uint64_t>(lastValue_);
-    lastValue_ = value;
+    if (valuesRemainingCurrentMiniBlock_ == valuesPerMiniBlock_) {
+      decodeMiniBlock();
+    }
+    value = miniBlockValues_
+        [valuesPerMiniBlock_ - valuesRemainingCurrentMiniBlock_];
     valuesRemainingCurrentMiniBlock_--;
     totalValuesRemaining_--;
 
@@ -224,6 +216,48 @@ class DeltaBpDecoder {
     return value;
   }
 
+  // Unpacks the deltas of the current miniblock and adds them up into
+  // 'miniBlockValues_'. Deltas of up to 32 bits are unpacked with the SIMD
+  // kernels of dwio::common::unpack(). A miniblock is always padded to
+  // 'valuesPerMiniBlock_' values.
+  void decodeMiniBlock() {
+    miniBlockValues_.resize(valuesPerMiniBlock_);
+    auto* values = miniBlockValues_.data();
+    if (deltaBitWidth_ == 0) {
+      std::fill(values, values + valuesPerMiniBlock_, 0);
+    } else if (deltaBitWidth_ <= 32) {
+      miniBlockDeltas_.resize(valuesPerMiniBlock_);
+      auto* input = reinterpret_cast<const uint8_t*>(bufferStart_);
+      auto* deltas = miniBlockDeltas_.data();
+      dwio::common::unpack<uint32_t>(
+          input,
+          bits::nbytes(deltaBitWidth_ * valuesPerMiniBlock_),
+          valuesPerMiniBlock_,
+          deltaBitWidth_,
+          deltas);
+      std::copy(miniBlockDeltas_.begin(), miniBlockDeltas_.end(), values);
+    } else {
+      for (uint64_t i = 0; i < valuesPerMiniBlock_; ++i) {
+        values[i] = 0;
+        bits::copyBits(
+            reinterpret_cast<const uint64_t*>(bufferStart_),
+            i * deltaBitWidth_,
+            &values[i],
+            0,
+            deltaBitWidth_);
+      }
+    }
+    // Addition between minDelta_, packed int and lastValue_ should be treated
+    // as unsigned addition. Overflow is as expected.
+    uint64_t value = lastValue_;
+    const uint64_t minDelta = minDelta_;
+    for (uint64_t i = 0; i < valuesPerMiniBlock_; ++i) {
+      value += minDelta + values[i];
+      values[i] = value;
+    }
+    lastValue_ = value;
+  }
+
   static constexpr int kMaxDeltaBitWidth =
       static_cast<int>(sizeof(int64_t) * 8);
 
@@ -249,6 +283,12 @@ class DeltaBpDecoder {
   uint64_t deltaBitWidth_;
 
   int64_t lastValue_;
+
+  // Values of the current miniblock.
+  std::vector<uint64_t> miniBlockValues_;
+
+  // Unpacked deltas of the current miniblock if at most 32 bits wide.
+  std::vector<uint32_t> miniBlockDeltas_;
 };
 
 } // namespace facebook::velox::parquet
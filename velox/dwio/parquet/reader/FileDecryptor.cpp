@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/parquet/reader/FileDecryptor.h"
+
+#include <folly/String.h>
+#include <thrift/protocol/TCompactProtocol.h> //@manual
+
+#include "velox/dwio/parquet/thrift/ParquetThriftTypes.h"
+#include "velox/dwio/parquet/thrift/ThriftTransport.h"
+#include "velox/dwio/parquet/writer/arrow/EncryptionInternal.h"
+
+namespace facebook::velox::parquet {
+
+using arrow::ParquetCipher;
+using arrow::encryption::AesDecryptor;
+
+namespace {
+
+void checkKeyLength(const std::string& key) {
+  VELOX_USER_CHECK(
+      key.size() == 16 || key.size() == 24 || key.size() == 32,
+      "Invalid Parquet encryption key length: {}",
+      key.size());
+}
+
+int32_t decrypt(
+    AesDecryptor& decryptor,
+    const char* ciphertext,
+    int32_t size,
+    const std::string& key,
+    const std::string& aad,
+    char* plaintext) {
+  try {
+    return decryptor.Decrypt(
+        reinterpret_cast<const uint8_t*>(ciphertext),
+        size,
+        reinterpret_cast<const uint8_t*>(key.data()),
+        key.size(),
+        reinterpret_cast<const uint8_t*>(aad.data()),
+        aad.size(),
+        reinterpret_cast<uint8_t*>(plaintext));
+  } catch (const std::exception& e) {
+    VELOX_FAIL("Failed to decrypt Parquet module: {}", e.what());
+  }
+}
+
+// Decrypts the metadata module of 'size' bytes at 'data', which starts with
+// the length of the module.
+std::string decryptMetadata(
+    const char* data,
+    int32_t size,
+    const std::string& key,
+    const std::string& aad) {
+  AesDecryptor decryptor(
+      ParquetCipher::AES_GCM_V1, key.size(), /*metadata=*/true);
+  VELOX_CHECK_GT(
+      size,
+      decryptor.CiphertextSizeDelta(),
+      "Invalid encrypted Parquet module size");
+  std::string plaintext(size - decryptor.CiphertextSizeDelta(), '\0');
+  plaintext.resize(
+      decrypt(decryptor, data, size, key, aad, plaintext.data()));
+  return plaintext;
+}
+
+std::string columnPath(const thrift::ColumnChunk& chunk) {
+  if (chunk.crypto_metadata.__isset.ENCRYPTION_WITH_COLUMN_KEY) {
+    return folly::join(
+        ".", chunk.crypto_metadata.ENCRYPTION_WITH_COLUMN_KEY.path_in_schema);
+  }
+  return folly::join(".", chunk.meta_data.path_in_schema);
+}
+
+} // namespace
+
+PageDecryptor::PageDecryptor(
+    bool ctrPages,
+    std::string key,
+    const std::string& fileAad,
+    int16_t rowGroupOrdinal,
+    int16_t columnOrdinal,
+    bool hasDictionary)
+    : key_(std::move(key)),
+      headerDecryptor_(std::make_unique<AesDecryptor>(
+          ParquetCipher::AES_GCM_V1,
+          key_.size(),
+          /*metadata=*/true,
+          /*contains_length=*/false)),
+      pageDecryptor_(std::make_unique<AesDecryptor>(
+          ctrPages ? ParquetCipher::AES_GCM_CTR_V1 : ParquetCipher::AES_GCM_V1,
+          key_.size(),
+          /*metadata=*/false)),
+      dictionaryPageHeaderAad_(arrow::encryption::CreateModuleAad(
+          fileAad,
+          arrow::encryption::kDictionaryPageHeader,
+          rowGroupOrdinal,
+          columnOrdinal,
+          -1)),
+      dictionaryPageAad_(arrow::encryption::CreateModuleAad(
+          fileAad,
+          arrow::encryption::kDictionaryPage,
+          rowGroupOrdinal,
+          columnOrdinal,
+          -1)),
+      dataPageHeaderAad_(arrow::encryption::CreateModuleAad(
+          fileAad,
+          arrow::encryption::kDataPageHeader,
+          rowGroupOrdinal,
+          columnOrdinal,
+          0)),
+      dataPageAad_(arrow::encryption::CreateModuleAad(
+          fileAad,
+          arrow::encryption::kDataPage,
+          rowGroupOrdinal,
+          columnOrdinal,
+          0)),
+      hasDictionary_(hasDictionary),
+      dictionaryPending_(hasDictionary) {}
+
+PageDecryptor::~PageDecryptor() = default;
+
+int32_t PageDecryptor::decryptPageHeader(
+    const char* ciphertext,
+    int32_t size,
+    char* plaintext) {
+  const std::string* aad;
+  if (dictionaryPending_) {
+    dictionaryPending_ = false;
+    currentIsDictionary_ = true;
+    aad = &dictionaryPageHeaderAad_;
+  } else {
+    currentIsDictionary_ = false;
+    arrow::encryption::QuickUpdatePageAad(
+        nextPageOrdinal_, &dataPageHeaderAad_);
+    arrow::encryption::QuickUpdatePageAad(nextPageOrdinal_, &dataPageAad_);
+    ++nextPageOrdinal_;
+    aad = &dataPageHeaderAad_;
+  }
+  return decrypt(*headerDecryptor_, ciphertext, size, key_, *aad, plaintext);
+}
+
+int32_t PageDecryptor::decryptPage(
+    const char* ciphertext,
+    int32_t size,
+    char* plaintext) {
+  return decrypt(
+      *pageDecryptor_,
+      ciphertext,
+      size,
+      key_,
+      currentIsDictionary_ ? dictionaryPageAad_ : dataPageAad_,
+      plaintext);
+}
+
+FileDecryptor::FileDecryptor(
+    const thrift::EncryptionAlgorithm& algorithm,
+    std::string footerKeyMetadata,
+    std::shared_ptr<dwio::common::encryption::KeyRetriever> keyRetriever)
+    : footerKeyMetadata_(std::move(footerKeyMetadata)),
+      keyRetriever_(std::move(keyRetriever)) {
+  auto initialize = [&](const auto& aes) {
+    VELOX_USER_CHECK(
+        !aes.__isset.supply_aad_prefix || !aes.supply_aad_prefix,
+        "Encrypted Parquet files with a supplied AAD prefix are not supported");
+    fileAad_ = aes.aad_prefix + aes.aad_file_unique;
+  };
+  if (algorithm.__isset.AES_GCM_V1) {
+    ctrPages_ = false;
+    initialize(algorithm.AES_GCM_V1);
+  } else if (algorithm.__isset.AES_GCM_CTR_V1) {
+    ctrPages_ = true;
+    initialize(algorithm.AES_GCM_CTR_V1);
+  } else {
+    VELOX_UNSUPPORTED("Unsupported Parquet encryption algorithm");
+  }
+}
+
+std::string FileDecryptor::decryptFooter(const char* data, int32_t size) {
+  const auto key = getKey(footerKeyMetadata_);
+  VELOX_USER_CHECK(
+      !key.empty(), "The footer key of the encrypted Parquet file is missing");
+  return decryptMetadata(
+      data, size, key, arrow::encryption::CreateFooterAad(fileAad_));
+}
+
+void FileDecryptor::decryptColumnMetaData(
+    thrift::ColumnChunk& chunk,
+    int16_t rowGroupOrdinal,
+    int16_t columnOrdinal) {
+  if (!chunk.__isset.crypto_metadata ||
+      !chunk.__isset.encrypted_column_metadata) {
+    return;
+  }
+  const auto key = columnKey(chunk);
+  if (key.empty()) {
+    return;
+  }
+  const auto plaintext = decryptMetadata(
+      chunk.encrypted_column_metadata.data(),
+      chunk.encrypted_column_metadata.size(),
+      key,
+      arrow::encryption::CreateModuleAad(
+          fileAad_,
+          arrow::encryption::kColumnMetaData,
+          rowGroupOrdinal,
+          columnOrdinal,
+          -1));
+  auto thriftTransport = std::make_shared<thrift::ThriftBufferedTransport>(
+      plaintext.data(), plaintext.size());
+  auto thriftProtocol = std::make_unique<
+      apache::thrift::protocol::TCompactProtocolT<thrift::ThriftTransport>>(
+      thriftTransport);
+  chunk.meta_data = thrift::ColumnMetaData();
+  chunk.meta_data.read(thriftProtocol.get());
+  chunk.__isset.meta_data = true;
+}
+
+std::unique_ptr<PageDecryptor> FileDecryptor::makePageDecryptor(
+    const thrift::ColumnChunk& chunk,
+    int16_t rowGroupOrdinal,
+    int16_t columnOrdinal) {
+  if (!chunk.__isset.crypto_metadata) {
+    return nullptr;
+  }
+  auto key = columnKey(chunk);
+  VELOX_USER_CHECK(
+      !key.empty(),
+      "The key of encrypted Parquet column {} is missing",
+      columnPath(chunk));
+  const auto& metadata = chunk.meta_data;
+  const bool hasDictionary = metadata.__isset.dictionary_page_offset &&
+      metadata.dictionary_page_offset >= 4;
+  return std::make_unique<PageDecryptor>(
+      ctrPages_,
+      std::move(key),
+      fileAad_,
+      rowGroupOrdinal,
+      columnOrdinal,
+      hasDictionary);
+}
+
+std::string FileDecryptor::columnKey(const thrift::ColumnChunk& chunk) {
+  const auto& cryptoMetadata = chunk.crypto_metadata;
+  if (cryptoMetadata.__isset.ENCRYPTION_WITH_COLUMN_KEY) {
+    return getKey(cryptoMetadata.ENCRYPTION_WITH_COLUMN_KEY.key_metadata);
+  }
+  return getKey(footerKeyMetadata_);
+}
+
+std::string FileDecryptor::getKey(const std::string& keyMetadata) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = keys_.find(keyMetadata);
+  if (it == keys_.end()) {
+    auto key = keyRetriever_ ? keyRetriever_->getKey(keyMetadata) : "";
+    if (!key.empty()) {
+      checkKeyLength(key);
+    }
+    it = keys_.emplace(keyMetadata, std::move(key)).first;
+  }
+  return it->second;
+}
+
+} // namespace facebook::velox::parquet
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "velox/dwio/common/encryption/Encryption.h"
+
+namespace facebook::velox::parquet::arrow::encryption {
+class AesDecryptor;
+} // namespace facebook::velox::parquet::arrow::encryption
+
+namespace facebook::velox::parquet {
+
+namespace thrift {
+class ColumnChunk;
+class EncryptionAlgorithm;
+} // namespace thrift
+
+/// Decrypts the page headers and the pages of an encrypted column chunk. The
+/// pages must be decrypted in file order, see setNextPageOrdinal() for
+/// skipping pages.
+class PageDecryptor {
+ public:
+  /// Bytes in front of the ciphertext of a page: its length and nonce.
+  static constexpr int32_t kPageCiphertextOffset = 16;
+
+  PageDecryptor(
+      bool ctrPages,
+      std::string key,
+      const std::string& fileAad,
+      int16_t rowGroupOrdinal,
+      int16_t columnOrdinal,
+      bool hasDictionary);
+
+  ~PageDecryptor();
+
+  /// Decrypts the header of the next page from the 'size' bytes at
+  /// 'ciphertext', which follow the length of the header module. Writes the
+  /// serialized PageHeader to 'plaintext' and returns its size.
+  int32_t
+  decryptPageHeader(const char* ciphertext, int32_t size, char* plaintext);
+
+  /// Decrypts the 'size' bytes at 'ciphertext' of the page whose header was
+  /// decrypted last. Returns the size of the plaintext written to
+  /// 'plaintext', which may be 'ciphertext + kPageCiphertextOffset' to
+  /// decrypt in place.
+  int32_t decryptPage(const char* ciphertext, int32_t size, char* plaintext);
+
+  /// Sets the ordinal of the next data page in the column chunk after pages
+  /// were skipped without reading their headers.
+  void setNextPageOrdinal(int32_t ordinal) {
+    nextPageOrdinal_ = ordinal;
+  }
+
+  /// Restarts from the first page of the column chunk.
+  void rewind() {
+    dictionaryPending_ = hasDictionary_;
+    nextPageOrdinal_ = 0;
+  }
+
+ private:
+  const std::string key_;
+  const std::unique_ptr<arrow::encryption::AesDecryptor> headerDecryptor_;
+  const std::unique_ptr<arrow::encryption::AesDecryptor> pageDecryptor_;
+  const std::string dictionaryPageHeaderAad_;
+  const std::string dictionaryPageAad_;
+  // The AADs of the data pages. Their last bytes are the page ordinal.
+  std::string dataPageHeaderAad_;
+  std::string dataPageAad_;
+  const bool hasDictionary_;
+  // True until the header of the dictionary page, which comes first, is read.
+  bool dictionaryPending_;
+  bool currentIsDictionary_{false};
+  int32_t nextPageOrdinal_{0};
+};
+
+/// Decrypts the modules of a Parquet file written with modular encryption.
+/// The footer and column keys are retrieved from the key retriever of the
+/// reader options once per file and cached for the lifetime of the reader.
+class FileDecryptor {
+ public:
+  FileDecryptor(
+      const thrift::EncryptionAlgorithm& algorithm,
+      std::string footerKeyMetadata,
+      std::shared_ptr<dwio::common::encryption::KeyRetriever> keyRetriever);
+
+  /// Decrypts the encrypted footer of 'size' bytes at 'data', which follows
+  /// the FileCryptoMetaData. Returns the serialized FileMetaData.
+  std::string decryptFooter(const char* data, int32_t size);
+
+  /// Replaces the meta_data of the encrypted 'chunk' by its decrypted
+  /// encrypted_column_metadata. Leaves 'chunk' as is if the key of the column
+  /// is not available. Its meta_data is then without statistics if the footer
+  /// is in plaintext and unset otherwise.
+  void decryptColumnMetaData(
+      thrift::ColumnChunk& chunk,
+      int16_t rowGroupOrdinal,
+      int16_t columnOrdinal);
+
+  /// Returns the decryptor of the pages of 'chunk', or nullptr if the column
+  /// is not encrypted. Throws if the key of the column is not available.
+  std::unique_ptr<PageDecryptor> makePageDecryptor(
+      const thrift::ColumnChunk& chunk,
+      int16_t rowGroupOrdinal,
+      int16_t columnOrdinal);
+
+ private:
+  // Returns the key of the encrypted 'chunk', or an empty string if it is not
+  // available.
+  std::string columnKey(const thrift::ColumnChunk& chunk);
+
+  std::string getKey(const std::string& keyMetadata);
+
+  // True for AES_GCM_CTR_V1, which encrypts the pages with AES-CTR.
+  bool ctrPages_;
+  std::string fileAad_;
+  const std::string footerKeyMetadata_;
+  const std::shared_ptr<dwio::common::encryption::KeyRetriever> keyRetriever_;
+
+  std::mutex mutex_;
+  // Retrieved keys by key metadata.
+  std::unordered_map<std::string, std::string> keys_;
+};
+
+} // namespace facebook::velox::parquet
@@ -210,6 +210,46 @@ bool ColumnChunkMetaDataPtr::hasDictionaryPageOffset() const {
       thriftColumnChunkPtr(ptr_)->meta_data.__isset.dictionary_page_offset;
 }
 
+bool ColumnChunkMetaDataPtr::hasBloomFilterOffset() const {
+  return hasMetadata() &&
+      thriftColumnChunkPtr(ptr_)->meta_data.__isset.bloom_filter_offset;
+}
+
+int64_t ColumnChunkMetaDataPtr::bloomFilterOffset() const {
+  VELOX_CHECK(hasBloomFilterOffset());
+  return thriftColumnChunkPtr(ptr_)->meta_data.bloom_filter_offset;
+}
+
+bool ColumnChunkMetaDataPtr::hasPageIndex() const {
+  const auto& isset = thriftColumnChunkPtr(ptr_)->__isset;
+  return isset.column_index_offset && isset.column_index_length &&
+      isset.offset_index_offset && isset.offset_index_length;
+}
+
+bool ColumnChunkMetaDataPtr::isEncrypted() const {
+  return thriftColumnChunkPtr(ptr_)->__isset.crypto_metadata;
+}
+
+const thrift::ColumnChunk& ColumnChunkMetaDataPtr::thriftColumnChunk() const {
+  return *thriftColumnChunkPtr(ptr_);
+}
+
+std::pair<int64_t, int32_t> ColumnChunkMetaDataPtr::columnIndexRegion()
+    const {
+  VELOX_CHECK(hasPageIndex());
+  return {
+      thriftColumnChunkPtr(ptr_)->column_index_offset,
+      thriftColumnChunkPtr(ptr_)->column_index_length};
+}
+
+std::pair<int64_t, int32_t> ColumnChunkMetaDataPtr::offsetIndexRegion()
+    const {
+  VELOX_CHECK(hasPageIndex());
+  return {
+      thriftColumnChunkPtr(ptr_)->offset_index_offset,
+      thriftColumnChunkPtr(ptr_)->offset_index_length};
+}
+
 std::unique_ptr<dwio::common::ColumnStatistics>
 ColumnChunkMetaDataPtr::getColumnStatistics(
     const TypePtr type,
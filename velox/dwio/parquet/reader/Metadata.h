@@ -21,6 +21,18 @@
 
 namespace facebook::velox::parquet {
 
+namespace thrift {
+class ColumnChunk;
+class Statistics;
+} // namespace thrift
+
+/// Converts the thrift 'statistics' of 'numRows' values of 'type' to
+/// ColumnStatistics.
+std::unique_ptr<dwio::common::ColumnStatistics> buildColumnStatisticsFromThrift(
+    const thrift::Statistics& statistics,
+    const velox::Type& type,
+    uint64_t numRows);
+
 /// ColumnChunkMetaDataPtr is a proxy around pointer to thrift::ColumnChunk.
 class ColumnChunkMetaDataPtr {
  public:
@@ -37,6 +49,32 @@ class ColumnChunkMetaDataPtr {
   /// Check the presence of the dictionary page offset in ColumnChunk metadata.
   bool hasDictionaryPageOffset() const;
 
+  /// Check the presence of the Bloom filter offset in ColumnChunk metadata.
+  bool hasBloomFilterOffset() const;
+
+  /// The offset of the Bloom filter header in the file.
+  /// Must check for its presence using hasBloomFilterOffset().
+  int64_t bloomFilterOffset() const;
+
+  /// Check the presence of both the ColumnIndex and the OffsetIndex of the
+  /// ColumnChunk.
+  bool hasPageIndex() const;
+
+  /// True if the column chunk is encrypted with the footer key or a column
+  /// key.
+  bool isEncrypted() const;
+
+  /// The thrift ColumnChunk. Used for decrypting the column chunk.
+  const thrift::ColumnChunk& thriftColumnChunk() const;
+
+  /// The <offset, length> of the ColumnIndex in the file.
+  /// Must check for its presence using hasPageIndex().
+  std::pair<int64_t, int32_t> columnIndexRegion() const;
+
+  /// The <offset, length> of the OffsetIndex in the file.
+  /// Must check for its presence using hasPageIndex().
+  std::pair<int64_t, int32_t> offsetIndexRegion() const;
+
   /// Return the ColumnChunk statistics.
   std::unique_ptr<dwio::common::ColumnStatistics> getColumnStatistics(
       const TypePtr type,
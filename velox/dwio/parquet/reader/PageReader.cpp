@@ -19,6 +19,7 @@
 #include "velox/common/testutil/TestValue.h"
 #include "velox/dwio/common/BufferUtil.h"
 #include "velox/dwio/common/ColumnVisitors.h"
+#include "velox/dwio/parquet/reader/ByteStreamSplitDecoder.h"
 #include "velox/dwio/parquet/common/LevelConversion.h"
 #include "velox/dwio/parquet/thrift/ThriftTransport.h"
 
@@ -44,6 +45,9 @@ void PageReader::seekToPage(int64_t row) {
   // 'rowOfPage_' is the row number of the first row of the next page.
   rowOfPage_ += numRowsInPage_;
   for (;;) {
+    if (!pageOffsets_.empty() && row != kRepDefOnly) {
+      skipToPageOfRow(row);
+    }
     if (chunkSize_ <= pageStart_) {
       // This may happen if seeking to exactly end of row group.
       numRepDefsInPage_ = 0;
@@ -81,6 +85,34 @@ void PageReader::seekToPage(int64_t row) {
   }
 }
 
+void PageReader::skipToPageOfRow(int64_t row) {
+  auto it = std::upper_bound(
+      pageOffsets_.begin(),
+      pageOffsets_.end(),
+      row,
+      [](int64_t row, const auto& page) { return row < page.first; });
+  if (it == pageOffsets_.begin()) {
+    return;
+  }
+  const auto [firstRow, offset] = *(it - 1);
+  const auto pageStart = static_cast<int64_t>(pageStart_);
+  // The pages before the first data page, e.g. the dictionary, must be read.
+  if (firstRow <= rowOfPage_ || offset <= pageStart || offset >= chunkSize_ ||
+      pageStart < pageOffsets_[0].second) {
+    return;
+  }
+  dwio::common::skipBytes(
+      offset - pageStart, inputStream_.get(), bufferStart_, bufferEnd_);
+  pageStart_ = offset;
+  rowOfPage_ = firstRow;
+  if (decryptor_) {
+    decryptor_->setNextPageOrdinal(it - 1 - pageOffsets_.begin());
+  }
+  if (hasChunkRepDefs_) {
+    numLeafNullsConsumed_ = rowOfPage_;
+  }
+}
+
 PageHeader PageReader::readPageHeader() {
   TestValue::adjust(
       "facebook::velox::parquet::PageReader::readPageHeader", this);
@@ -91,6 +123,9 @@ PageHeader PageReader::readPageHeader() {
     bufferStart_ = reinterpret_cast<const char*>(buffer);
     bufferEnd_ = bufferStart_ + size;
   }
+  if (decryptor_) {
+    return readEncryptedPageHeader();
+  }
 
   std::shared_ptr<thrift::ThriftTransport> transport =
       std::make_shared<thrift::ThriftStreamingTransport>(
@@ -105,6 +140,28 @@ PageHeader PageReader::readPageHeader() {
   return pageHeader;
 }
 
+PageHeader PageReader::readEncryptedPageHeader() {
+  // The header module starts with the length of the rest of the module.
+  uint32_t length;
+  dwio::common::readBytes(
+      sizeof(length), inputStream_.get(), &length, bufferStart_, bufferEnd_);
+  const auto* ciphertext = readBytes(length, pageBuffer_);
+  dwio::common::ensureCapacity<char>(decryptedPageHeader_, length, &pool_);
+  const auto size = decryptor_->decryptPageHeader(
+      ciphertext, length, decryptedPageHeader_->asMutable<char>());
+
+  std::shared_ptr<thrift::ThriftTransport> transport =
+      std::make_shared<thrift::ThriftBufferedTransport>(
+          decryptedPageHeader_->as<char>(), size);
+  apache::thrift::protocol::TCompactProtocolT<thrift::ThriftTransport> protocol(
+      transport);
+  PageHeader pageHeader;
+  pageHeader.read(&protocol);
+
+  pageDataStart_ = pageStart_ + sizeof(length) + length;
+  return pageHeader;
+}
+
 const char* PageReader::readBytes(int32_t size, BufferPtr& copy) {
   if (bufferEnd_ == bufferStart_) {
     const void* buffer = nullptr;
@@ -129,6 +186,25 @@ const char* PageReader::readBytes(int32_t size, BufferPtr& copy) {
   return copy->as<char>();
 }
 
+const char* PageReader::readPageData(int32_t& size) {
+  const auto* data = readBytes(size, pageBuffer_);
+  if (!decryptor_) {
+    return data;
+  }
+  char* plaintext;
+  if (pageBuffer_ && data == pageBuffer_->as<char>()) {
+    // The page was copied, decrypts it in place.
+    plaintext =
+        pageBuffer_->asMutable<char>() + PageDecryptor::kPageCiphertextOffset;
+  } else {
+    // The page is in the buffers of the input stream, which may be shared.
+    dwio::common::ensureCapacity<char>(pageBuffer_, size, &pool_);
+    plaintext = pageBuffer_->asMutable<char>();
+  }
+  size = decryptor_->decryptPage(data, size, plaintext);
+  return plaintext;
+}
+
 const char* PageReader::decompressData(
     const char* pageData,
     uint32_t compressedSize,
@@ -216,11 +292,10 @@ void PageReader::prepareDataPageV1(const PageHeader& pageHeader, int64_t row) {
 
     return;
   }
-  pageData_ = readBytes(pageHeader.compressed_page_size, pageBuffer_);
-  pageData_ = decompressData(
-      pageData_,
-      pageHeader.compressed_page_size,
-      pageHeader.uncompressed_page_size);
+  int32_t dataSize = pageHeader.compressed_page_size;
+  pageData_ = readPageData(dataSize);
+  pageData_ =
+      decompressData(pageData_, dataSize, pageHeader.uncompressed_page_size);
   auto pageEnd = pageData_ + pageHeader.uncompressed_page_size;
   if (maxRepeat_ > 0) {
     uint32_t repeatLength = readField<int32_t>(pageData_);
@@ -278,7 +353,9 @@ void PageReader::prepareDataPageV2(const PageHeader& pageHeader, int64_t row) {
       pageHeader.data_page_header_v2.repetition_levels_byte_length;
 
   auto bytes = pageHeader.compressed_page_size;
-  pageData_ = readBytes(bytes, pageBuffer_);
+  // The levels are encrypted with the values.
+  int32_t dataSize = bytes;
+  pageData_ = readPageData(dataSize);
 
   if (repeatLength) {
     repeatDecoder_ = std::make_unique<RleDecoder>(
@@ -297,10 +374,10 @@ void PageReader::prepareDataPageV2(const PageHeader& pageHeader, int64_t row) {
   pageData_ += levelsSize;
   if (pageHeader.data_page_header_v2.__isset.is_compressed &&
       pageHeader.data_page_header_v2.is_compressed &&
-      (pageHeader.compressed_page_size - levelsSize > 0)) {
+      (dataSize - levelsSize > 0)) {
     pageData_ = decompressData(
         pageData_,
-        pageHeader.compressed_page_size - levelsSize,
+        dataSize - levelsSize,
         pageHeader.uncompressed_page_size - levelsSize);
   }
   if (row == kRepDefOnly) {
@@ -327,12 +404,13 @@ void PageReader::prepareDictionary(const PageHeader& pageHeader) {
       dictionaryEncoding_ == Encoding::PLAIN_DICTIONARY ||
       dictionaryEncoding_ == Encoding::PLAIN);
 
-  if (codec_ != common::CompressionKind::CompressionKind_NONE) {
-    pageData_ = readBytes(pageHeader.compressed_page_size, pageBuffer_);
-    pageData_ = decompressData(
-        pageData_,
-        pageHeader.compressed_page_size,
-        pageHeader.uncompressed_page_size);
+  if (codec_ != common::CompressionKind::CompressionKind_NONE || decryptor_) {
+    int32_t dataSize = pageHeader.compressed_page_size;
+    pageData_ = readPageData(dataSize);
+    if (codec_ != common::CompressionKind::CompressionKind_NONE) {
+      pageData_ = decompressData(
+          pageData_, dataSize, pageHeader.uncompressed_page_size);
+    }
   }
 
   auto parquetType = type_->parquetType_.value();
@@ -581,6 +659,9 @@ void PageReader::preloadRepDefs() {
   rowOfPage_ = 0;
   numRowsInPage_ = 0;
   pageData_ = nullptr;
+  if (decryptor_) {
+    decryptor_->rewind();
+  }
 }
 
 void PageReader::decodeRepDefs(int32_t numTopLevelRows) {
@@ -673,6 +754,10 @@ void PageReader::makeDecoder() {
       dictionaryIdDecoder_ = std::make_unique<RleBpDataDecoder>(
           pageData_ + 1, pageData_ + encodedDataSize_, pageData_[0]);
       break;
+    case Encoding::BYTE_STREAM_SPLIT:
+      // The values are decoded to PLAIN for the PLAIN decoders.
+      decodeByteStreamSplitPage();
+      FMT_FALLTHROUGH;
     case Encoding::PLAIN:
       switch (parquetType) {
         case thrift::Type::BOOLEAN:
@@ -751,6 +836,36 @@ void PageReader::makeDecoder() {
   }
 }
 
+void PageReader::decodeByteStreamSplitPage() {
+  const auto parquetType = type_->parquetType_.value();
+  int32_t width;
+  switch (parquetType) {
+    case thrift::Type::INT32:
+    case thrift::Type::INT64:
+    case thrift::Type::FLOAT:
+    case thrift::Type::DOUBLE:
+      width = parquetTypeBytes(parquetType);
+      break;
+    case thrift::Type::FIXED_LEN_BYTE_ARRAY:
+      width = type_->typeLength_;
+      break;
+    default:
+      VELOX_UNSUPPORTED(
+          "BYTE_STREAM_SPLIT decoder does not support {}", parquetType);
+  }
+  VELOX_CHECK_GT(width, 0);
+  VELOX_CHECK_EQ(
+      encodedDataSize_ % width,
+      0,
+      "Invalid BYTE_STREAM_SPLIT data size (corrupt data page?)");
+  dwio::common::ensureCapacity<char>(
+      byteStreamSplitData_, encodedDataSize_, &pool_);
+  auto* plainData = byteStreamSplitData_->asMutable<char>();
+  decodeByteStreamSplit(
+      pageData_, encodedDataSize_ / width, width, plainData);
+  pageData_ = plainData;
+}
+
 void PageReader::skip(int64_t numRows) {
   if (!numRows && firstUnvisited_ != rowOfPage_ + numRowsInPage_) {
     // Return if no skip and position not at end of page or before first page.
@@ -897,6 +1012,9 @@ bool PageReader::rowsForPage(
   if (currentVisitorRow_ == numVisitorRows_) {
     return false;
   }
+  if (hasFilter && !prunedRows_.empty() && !skipPrunedRows()) {
+    return false;
+  }
   int32_t numToVisit;
   // Check if the first row to go to is in the current page. If not, seek to the
   // page that contains the row.
@@ -988,6 +1106,41 @@ bool PageReader::rowsForPage(
   return true;
 }
 
+bool PageReader::skipPrunedRows() {
+  for (;;) {
+    const auto rowZero = visitBase_ + visitorRows_[currentVisitorRow_];
+    if (rowZero < rowOfPage_ + numRowsInPage_) {
+      // The decoders are positioned on the page of 'rowZero'.
+      return true;
+    }
+    while (nextPrunedRange_ < prunedRows_.size() &&
+           prunedRows_[nextPrunedRange_].second <= rowZero) {
+      ++nextPrunedRange_;
+    }
+    if (nextPrunedRange_ == prunedRows_.size() ||
+        prunedRows_[nextPrunedRange_].first > rowZero) {
+      return true;
+    }
+    // None of the rows to visit in the range pass the filter. Skip them
+    // without touching the decoders. The next seekToPage() skips the pages
+    // of the range by their headers.
+    const auto end = prunedRows_[nextPrunedRange_].second - visitBase_;
+    if (end > visitorRows_[numVisitorRows_ - 1]) {
+      currentVisitorRow_ = numVisitorRows_;
+    } else {
+      currentVisitorRow_ = std::lower_bound(
+                               visitorRows_ + currentVisitorRow_,
+                               visitorRows_ + numVisitorRows_,
+                               static_cast<vector_size_t>(end)) -
+          visitorRows_;
+    }
+    firstUnvisited_ = visitBase_ + visitorRows_[currentVisitorRow_ - 1] + 1;
+    if (currentVisitorRow_ == numVisitorRows_) {
+      return false;
+    }
+  }
+}
+
 const VectorPtr& PageReader::dictionaryValues(const TypePtr& type) {
   if (!dictionaryValues_) {
     dictionaryValues_ = std::make_shared<FlatVector<StringView>>(
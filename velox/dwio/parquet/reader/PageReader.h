@@ -25,6 +25,7 @@
 #include "velox/dwio/parquet/reader/BooleanDecoder.h"
 #include "velox/dwio/parquet/reader/DeltaBpDecoder.h"
 #include "velox/dwio/parquet/reader/DeltaByteArrayDecoder.h"
+#include "velox/dwio/parquet/reader/FileDecryptor.h"
 #include "velox/dwio/parquet/reader/ParquetTypeWithId.h"
 #include "velox/dwio/parquet/reader/RleBpDataDecoder.h"
 #include "velox/dwio/parquet/reader/StringDecoder.h"
@@ -76,6 +77,32 @@ class PageReader {
   /// Advances 'numRows' top level rows.
   void skip(int64_t numRows);
 
+  /// Sets the ascending, non-overlapping [begin, end) row ranges of the pages
+  /// that have no rows passing the filter of the column according to the page
+  /// index. readWithVisitor() with a filter skips the rows of these pages,
+  /// seeking past the pages without decompressing them. Top level columns
+  /// only.
+  void setPrunedRows(std::vector<std::pair<int64_t, int64_t>> prunedRows) {
+    VELOX_CHECK(isTopLevel_);
+    prunedRows_ = std::move(prunedRows);
+    nextPrunedRange_ = 0;
+  }
+
+  /// Sets the <first row, offset in the column chunk> of each data page from
+  /// the offset index, in row order. Seeking to a row then jumps to its page
+  /// without reading the headers of the pages before it. Top level columns
+  /// only.
+  void setPageOffsets(std::vector<std::pair<int64_t, int64_t>> pageOffsets) {
+    VELOX_CHECK(isTopLevel_);
+    pageOffsets_ = std::move(pageOffsets);
+  }
+
+  /// Sets the decryptor of the page headers and pages of an encrypted column
+  /// chunk.
+  void setDecryptor(std::unique_ptr<PageDecryptor> decryptor) {
+    decryptor_ = std::move(decryptor);
+  }
+
   /// Decodes repdefs for 'numTopLevelRows'. Use getLengthsAndNulls()
   /// to access the lengths and nulls for the different nesting
   /// levels.
@@ -205,6 +232,10 @@ class PageReader {
   void prepareDictionary(const thrift::PageHeader& pageHeader);
   void makeDecoder();
 
+  // Decodes the BYTE_STREAM_SPLIT values of the current page into
+  // 'byteStreamSplitData_' in PLAIN encoding and points 'pageData_' to them.
+  void decodeByteStreamSplitPage();
+
   // For a non-top level leaf, reads the defs and sets 'leafNulls_' and
   // 'numRowsInPage_' accordingly. This is used for non-top level leaves when
   // 'hasChunkRepDefs_' is false.
@@ -215,6 +246,15 @@ class PageReader {
   // straddles buffers. Allocates or resizes 'copy' as needed.
   const char* readBytes(int32_t size, BufferPtr& copy);
 
+  // Reads the 'size' bytes of the current page like readBytes() and decrypts
+  // them if the column chunk is encrypted, setting 'size' to the size of the
+  // plaintext.
+  const char* readPageData(int32_t& size);
+
+  // Reads and decrypts the header of the next page of an encrypted column
+  // chunk.
+  thrift::PageHeader readEncryptedPageHeader();
+
   // Decompresses data starting at 'pageData_', consuming 'compressedsize' and
   // producing up to 'uncompressedSize' bytes. The start of the decoding
   // result is returned. an intermediate copy may be made in 'decompresseddata_'
@@ -259,6 +299,15 @@ class PageReader {
       folly::Range<const vector_size_t*>& rows,
       const uint64_t* FOLLY_NULLABLE& nulls);
 
+  // Advances 'currentVisitorRow_' past the rows to visit that are in
+  // 'prunedRows_' and not on the current page. Returns false if this
+  // leaves no rows to visit.
+  bool skipPrunedRows();
+
+  // Skips the pages before the page containing 'row' by 'pageOffsets_'. Only
+  // skips forward and only after the dictionary page has been read.
+  void skipToPageOfRow(int64_t row);
+
   // Calls the visitor, specialized on the data type since not all visitors
   // apply to all types.
   template <
@@ -440,6 +489,13 @@ class PageReader {
   // Copy of data if data straddles buffer boundary.
   BufferPtr pageBuffer_;
 
+  // Decrypts the page headers and pages if the column chunk is encrypted.
+  std::unique_ptr<PageDecryptor> decryptor_;
+
+  // The decrypted header of the current page if the column chunk is
+  // encrypted.
+  BufferPtr decryptedPageHeader_;
+
   // decompressed data for the page. Rep-def-data in V1, data alone in V2.
   BufferPtr decompressedData_;
 
@@ -447,6 +503,9 @@ class PageReader {
   // contiguous run of bytes.
   const char* pageData_{nullptr};
 
+  // PLAIN encoded values of a BYTE_STREAM_SPLIT page.
+  BufferPtr byteStreamSplitData_;
+
   // Dictionary contents.
   dwio::common::DictionaryValues dictionary_;
   thrift::Encoding::type dictionaryEncoding_;
@@ -481,6 +540,17 @@ class PageReader {
   // Offset of 'visitorRows_[0]' relative too start of ColumnChunk.
   int64_t visitBase_{0};
 
+  // Row ranges of the pages that can't have rows passing the filter. See
+  // setPrunedRows().
+  std::vector<std::pair<int64_t, int64_t>> prunedRows_;
+
+  // Index of the first range in 'prunedRows_' that may end after the rows
+  // visited so far.
+  size_t nextPrunedRange_{0};
+
+  // Start rows and offsets of the data pages. See setPageOffsets().
+  std::vector<std::pair<int64_t, int64_t>> pageOffsets_;
+
   //  Temporary for rewriting rows to access in readWithVisitor when moving
   //  between pages. Initialized from the visitor.
   raw_vector<vector_size_t>* rowsCopy_{nullptr};
@@ -17,15 +17,145 @@
 #include "velox/dwio/parquet/reader/ParquetData.h"
 
 #include "velox/dwio/common/BufferedInput.h"
+#include "velox/dwio/common/StreamUtil.h"
 #include "velox/dwio/parquet/reader/ParquetStatsContext.h"
+#include "velox/dwio/parquet/thrift/ThriftTransport.h"
+
+#include <thrift/protocol/TCompactProtocol.h> // @manual
 
 namespace facebook::velox::parquet {
 
+namespace {
+// Reads a thrift struct of 'size' bytes from 'stream' into 'result'.
+template <typename T>
+void readThrift(
+    dwio::common::SeekableInputStream& stream,
+    int32_t size,
+    T& result) {
+  std::vector<char> copy(size);
+  const char* bufferStart = nullptr;
+  const char* bufferEnd = nullptr;
+  dwio::common::readBytes(size, &stream, copy.data(), bufferStart, bufferEnd);
+  std::shared_ptr<thrift::ThriftTransport> transport =
+      std::make_shared<thrift::ThriftBufferedTransport>(copy.data(), size);
+  apache::thrift::protocol::TCompactProtocolT<thrift::ThriftTransport> protocol(
+      transport);
+  result.read(&protocol);
+}
+
+// Returns the file offset of the first page of 'chunk'.
+uint64_t chunkReadOffset(const ColumnChunkMetaDataPtr& chunk) {
+  if (chunk.hasDictionaryPageOffset() && chunk.dictionaryPageOffset() >= 4) {
+    // this assumes the data pages follow the dict pages directly.
+    return chunk.dictionaryPageOffset();
+  }
+  return chunk.dataPageOffset();
+}
+
+// Bytes to read for a Bloom filter header, which is a few bytes in practice.
+constexpr uint64_t kBloomFilterHeaderBytes = 64;
+
+// Maximum number of values of a filter to look up in a Bloom filter.
+constexpr size_t kMaxBloomFilterProbes = 1'000;
+
+// Returns the values passing 'filter' if it is an equality or IN filter on
+// integers with at most kMaxBloomFilterProbes values.
+std::optional<std::vector<int64_t>> bigintValues(const common::Filter& filter) {
+  switch (filter.kind()) {
+    case common::FilterKind::kBigintRange: {
+      const auto& range = static_cast<const common::BigintRange&>(filter);
+      if (range.isSingleValue()) {
+        return std::vector<int64_t>{range.lower()};
+      }
+      return std::nullopt;
+    }
+    case common::FilterKind::kBigintValuesUsingHashTable: {
+      const auto& values =
+          static_cast<const common::BigintValuesUsingHashTable&>(filter)
+              .values();
+      if (values.size() <= kMaxBloomFilterProbes) {
+        return values;
+      }
+      return std::nullopt;
+    }
+    case common::FilterKind::kBigintValuesUsingBitmask: {
+      const auto& bitmask =
+          static_cast<const common::BigintValuesUsingBitmask&>(filter);
+      if (bitmask.max() - bitmask.min() <
+          static_cast<int64_t>(kMaxBloomFilterProbes)) {
+        return bitmask.values();
+      }
+      return std::nullopt;
+    }
+    default:
+      return std::nullopt;
+  }
+}
+
+// Returns the values passing 'filter' if it is an equality or IN filter on
+// strings with at most kMaxBloomFilterProbes values.
+std::optional<std::vector<std::string_view>> bytesValues(
+    const common::Filter& filter) {
+  switch (filter.kind()) {
+    case common::FilterKind::kBytesRange: {
+      const auto& range = static_cast<const common::BytesRange&>(filter);
+      if (range.isSingleValue()) {
+        return std::vector<std::string_view>{range.lower()};
+      }
+      return std::nullopt;
+    }
+    case common::FilterKind::kBytesValues: {
+      const auto& values =
+          static_cast<const common::BytesValues&>(filter).values();
+      if (values.size() > kMaxBloomFilterProbes) {
+        return std::nullopt;
+      }
+      return std::vector<std::string_view>(values.begin(), values.end());
+    }
+    default:
+      return std::nullopt;
+  }
+}
+
+// True if a Bloom filter of a column of 'type' stored as 'physicalType' can
+// be tested against 'filter'. The values passing 'filter' must have the same
+// plain encoding as the values of the column.
+bool canTestBloomFilter(
+    const common::Filter& filter,
+    thrift::Type::type physicalType,
+    const Type& type) {
+  if (filter.testNull() || type.isDecimal()) {
+    return false;
+  }
+  switch (physicalType) {
+    case thrift::Type::INT32:
+      return type.kind() == TypeKind::INTEGER &&
+          bigintValues(filter).has_value();
+    case thrift::Type::INT64:
+      return type.kind() == TypeKind::BIGINT &&
+          bigintValues(filter).has_value();
+    case thrift::Type::BYTE_ARRAY:
+      return (type.kind() == TypeKind::VARCHAR ||
+              type.kind() == TypeKind::VARBINARY) &&
+          bytesValues(filter).has_value();
+    default:
+      return false;
+  }
+}
+} // namespace
+
 std::unique_ptr<dwio::common::FormatData> ParquetParams::toFormatData(
     const std::shared_ptr<const dwio::common::TypeWithId>& type,
-    const common::ScanSpec& /*scanSpec*/) {
+    const common::ScanSpec& scanSpec) {
   return std::make_unique<ParquetData>(
-      type, metaData_, pool(), sessionTimezone_);
+      type,
+      metaData_,
+      pool(),
+      sessionTimezone_,
+      &scanSpec,
+      bufferedInput_,
+      scanHasFilter_,
+      fileDecryptor_);
 }
 
 void ParquetData::filterRowGroups(
@@ -53,7 +183,9 @@ void ParquetData::filterRowGroups(
   }
   if (scanSpec.filter() || scanSpec.numMetadataFilters() > 0) {
     for (auto i = 0; i < fileMetaDataPtr_.numRowGroups(); ++i) {
-      if (scanSpec.filter() && !rowGroupMatches(i, scanSpec.filter())) {
+      if (scanSpec.filter() &&
+          (!rowGroupMatches(i, scanSpec.filter()) ||
+           !bloomFilterMatches(i, scanSpec.filter()))) {
         bits::setBit(result.filterResult.data(), i);
         continue;
       }
@@ -89,30 +221,160 @@ bool ParquetData::rowGroupMatches(uint32_t rowGroupId, common::Filter* filter) {
   return true;
 }
 
+bool ParquetData::bloomFilterMatches(
+    uint32_t rowGroupId,
+    common::Filter* filter) {
+  if (!bufferedInput_ || !type_->parquetType_.has_value()) {
+    return true;
+  }
+  auto columnChunk =
+      fileMetaDataPtr_.rowGroup(rowGroupId).columnChunk(type_->column());
+  // The Bloom filters of encrypted columns are encrypted.
+  if (!columnChunk.hasBloomFilterOffset() || columnChunk.isEncrypted() ||
+      !canTestBloomFilter(
+          *filter, type_->parquetType_.value(), *type_->type())) {
+    return true;
+  }
+  auto bloomFilter = readBloomFilter(columnChunk.bloomFilterOffset());
+  return testBloomFilter(*filter, type_->parquetType_.value(), bloomFilter);
+}
+
+BlockSplitBloomFilter ParquetData::readBloomFilter(int64_t offset) {
+  const uint64_t fileSize = bufferedInput_->getReadFile()->size();
+  VELOX_CHECK(
+      offset >= 0 && offset < fileSize, "Bloom filter offset out of range");
+  // The size of the Bloom filter is in its header, so the header is read
+  // first.
+  const auto headerLength =
+      std::min<uint64_t>(kBloomFilterHeaderBytes, fileSize - offset);
+  auto stream = bufferedInput_->read(
+      offset, headerLength, dwio::common::LogType::STRIPE_INDEX);
+  std::vector<char> copy(headerLength);
+  const char* bufferStart = nullptr;
+  const char* bufferEnd = nullptr;
+  dwio::common::readBytes(
+      headerLength, stream.get(), copy.data(), bufferStart, bufferEnd);
+  std::shared_ptr<thrift::ThriftTransport> transport =
+      std::make_shared<thrift::ThriftBufferedTransport>(
+          copy.data(), headerLength);
+  apache::thrift::protocol::TCompactProtocolT<thrift::ThriftTransport> protocol(
+      transport);
+  thrift::BloomFilterHeader header;
+  const uint64_t headerSize = header.read(&protocol);
+  VELOX_CHECK_GE(header.numBytes, 0);
+  const uint64_t length = headerSize + header.numBytes;
+  VELOX_CHECK_LE(length, fileSize - offset, "Bloom filter out of range");
+  stream = bufferedInput_->read(
+      offset, length, dwio::common::LogType::STRIPE_INDEX);
+  return BlockSplitBloomFilter::deserialize(stream.get(), pool_);
+}
+
+// static
+bool ParquetData::testBloomFilter(
+    const common::Filter& filter,
+    thrift::Type::type physicalType,
+    const BloomFilter& bloomFilter) {
+  switch (physicalType) {
+    case thrift::Type::INT32:
+    case thrift::Type::INT64: {
+      auto values = bigintValues(filter);
+      if (!values.has_value()) {
+        return true;
+      }
+      for (auto value : values.value()) {
+        uint64_t hash;
+        if (physicalType == thrift::Type::INT64) {
+          hash = bloomFilter.hash(value);
+        } else if (
+            value < std::numeric_limits<int32_t>::min() ||
+            value > std::numeric_limits<int32_t>::max()) {
+          continue;
+        } else {
+          hash = bloomFilter.hash(static_cast<int32_t>(value));
+        }
+        if (bloomFilter.findHash(hash)) {
+          return true;
+        }
+      }
+      return false;
+    }
+    case thrift::Type::BYTE_ARRAY: {
+      auto values = bytesValues(filter);
+      if (!values.has_value()) {
+        return true;
+      }
+      for (auto value : values.value()) {
+        const ByteArray bytes(value);
+        if (bloomFilter.findHash(bloomFilter.hash(&bytes))) {
+          return true;
+        }
+      }
+      return false;
+    }
+    default:
+      return true;
+  }
+}
+
 void ParquetData::enqueueRowGroup(
     uint32_t index,
     dwio::common::BufferedInput& input) {
   auto chunk = fileMetaDataPtr_.rowGroup(index).columnChunk(type_->column());
   streams_.resize(fileMetaDataPtr_.numRowGroups());
+  // The metadata of a column encrypted with a column key is unset if the
+  // footer is encrypted and the key is missing.
+  VELOX_USER_CHECK(
+      chunk.hasMetadata() || !chunk.isEncrypted(),
+      "The key of encrypted Parquet column {} is missing",
+      type_->name_);
   VELOX_CHECK(
       chunk.hasMetadata(),
       "ColumnMetaData does not exist for schema Id ",
       type_->column());
   ;
 
-  uint64_t chunkReadOffset = chunk.dataPageOffset();
-  if (chunk.hasDictionaryPageOffset() && chunk.dictionaryPageOffset() >= 4) {
-    // this assumes the data pages follow the dict pages directly.
-    chunkReadOffset = chunk.dictionaryPageOffset();
+  const auto readOffset = chunkReadOffset(chunk);
+  const auto readSize = rowGroupLoadSize(index);
+  auto id = dwio::common::StreamIdentifier(type_->column());
+  if (readOnDemand(chunk)) {
+    // Not enqueued, so that only the pages that are read are loaded.
+    streams_[index] =
+        input.read(readOffset, readSize, dwio::common::LogType::STREAM);
+  } else {
+    streams_[index] = input.enqueue({readOffset, readSize}, &id);
   }
 
-  uint64_t readSize =
-      (chunk.compression() == common::CompressionKind::CompressionKind_NONE)
-      ? chunk.totalUncompressedSize()
-      : chunk.totalCompressedSize();
+  if (!canUsePageIndex(chunk) ||
+      (!scanSpec_->filter() && !readOnDemand(chunk))) {
+    return;
+  }
+  columnIndexStreams_.resize(streams_.size());
+  offsetIndexStreams_.resize(streams_.size());
+  if (scanSpec_->filter()) {
+    auto [columnIndexOffset, columnIndexLength] = chunk.columnIndexRegion();
+    columnIndexStreams_[index] = input.enqueue(
+        {static_cast<uint64_t>(columnIndexOffset),
+         static_cast<uint64_t>(columnIndexLength)},
+        &id);
+  }
+  auto [offsetIndexOffset, offsetIndexLength] = chunk.offsetIndexRegion();
+  offsetIndexStreams_[index] = input.enqueue(
+      {static_cast<uint64_t>(offsetIndexOffset),
+       static_cast<uint64_t>(offsetIndexLength)},
+      &id);
+}
 
-  auto id = dwio::common::StreamIdentifier(type_->column());
-  streams_[index] = input.enqueue({chunkReadOffset, readSize}, &id);
+bool ParquetData::canUsePageIndex(const ColumnChunkMetaDataPtr& chunk) const {
+  // The page index row numbers are top level rows, so it is only usable for
+  // top level columns. The page index of encrypted columns is encrypted.
+  return scanSpec_ && maxRepeat_ == 0 && maxDefine_ <= 1 &&
+      chunk.hasPageIndex() && !chunk.isEncrypted();
+}
+
+bool ParquetData::readOnDemand(const ColumnChunkMetaDataPtr& chunk) const {
+  // A column without a filter reads only the rows passing the filters of
+  // the other columns.
+  return scanHasFilter_ && canUsePageIndex(chunk) && !scanSpec_->filter();
 }
 
 dwio::common::PositionProvider ParquetData::seekToRowGroup(int64_t index) {
@@ -127,9 +389,111 @@ dwio::common::PositionProvider ParquetData::seekToRowGroup(int64_t index) {
       metadata.compression(),
       metadata.totalCompressedSize(),
       sessionTimezone_);
+  if (metadata.isEncrypted()) {
+    VELOX_USER_CHECK_NOT_NULL(
+        fileDecryptor_, "Reading encrypted Parquet columns needs a decryptor");
+    reader_->setDecryptor(fileDecryptor_->makePageDecryptor(
+        metadata.thriftColumnChunk(),
+        static_cast<int16_t>(index),
+        static_cast<int16_t>(type_->column())));
+  }
+  if (index >= offsetIndexStreams_.size() || !offsetIndexStreams_[index]) {
+    return dwio::common::PositionProvider(empty);
+  }
+  auto offsetIndexStream = std::move(offsetIndexStreams_[index]);
+  thrift::OffsetIndex offsetIndex;
+  readThrift(
+      *offsetIndexStream, metadata.offsetIndexRegion().second, offsetIndex);
+  const auto readOffset = static_cast<int64_t>(chunkReadOffset(metadata));
+  std::vector<std::pair<int64_t, int64_t>> pageOffsets;
+  pageOffsets.reserve(offsetIndex.page_locations.size());
+  for (const auto& location : offsetIndex.page_locations) {
+    if (location.offset < readOffset ||
+        (!pageOffsets.empty() &&
+         (location.first_row_index <= pageOffsets.back().first ||
+          location.offset - readOffset <= pageOffsets.back().second))) {
+      // Not usable if the pages are not in row and file order.
+      pageOffsets.clear();
+      break;
+    }
+    pageOffsets.emplace_back(
+        location.first_row_index, location.offset - readOffset);
+  }
+  if (!pageOffsets.empty()) {
+    reader_->setPageOffsets(std::move(pageOffsets));
+  }
+  if (index < columnIndexStreams_.size() && columnIndexStreams_[index]) {
+    auto pruned = prunedRows(index, offsetIndex);
+    if (!pruned.empty()) {
+      reader_->setPrunedRows(std::move(pruned));
+    }
+  }
   return dwio::common::PositionProvider(empty);
 }
 
+std::vector<std::pair<int64_t, int64_t>> ParquetData::prunedRows(
+    int64_t index,
+    const thrift::OffsetIndex& offsetIndex) {
+  auto columnIndexStream = std::move(columnIndexStreams_[index]);
+  auto* filter = scanSpec_->filter();
+  if (!filter) {
+    return {};
+  }
+  auto chunk = fileMetaDataPtr_.rowGroup(index).columnChunk(type_->column());
+  thrift::ColumnIndex columnIndex;
+  readThrift(
+      *columnIndexStream, chunk.columnIndexRegion().second, columnIndex);
+
+  const auto& locations = offsetIndex.page_locations;
+  const auto numPages = locations.size();
+  if (columnIndex.null_pages.size() != numPages ||
+      columnIndex.min_values.size() != numPages ||
+      columnIndex.max_values.size() != numPages ||
+      (columnIndex.__isset.null_counts &&
+       columnIndex.null_counts.size() != numPages)) {
+    return {};
+  }
+  const auto numRows = fileMetaDataPtr_.rowGroup(index).numRows();
+  const auto& type = type_->type();
+  std::vector<std::pair<int64_t, int64_t>> pruned;
+  for (size_t i = 0; i < numPages; ++i) {
+    const auto begin = locations[i].first_row_index;
+    const auto end =
+        i + 1 < numPages ? locations[i + 1].first_row_index : numRows;
+    if (end <= begin) {
+      continue;
+    }
+    thrift::Statistics pageStats;
+    if (!columnIndex.null_pages[i]) {
+      pageStats.__set_min_value(columnIndex.min_values[i]);
+      pageStats.__set_max_value(columnIndex.max_values[i]);
+    }
+    if (columnIndex.__isset.null_counts) {
+      pageStats.__set_null_count(columnIndex.null_counts[i]);
+    } else if (columnIndex.null_pages[i]) {
+      pageStats.__set_null_count(end - begin);
+    }
+    auto columnStats =
+        buildColumnStatisticsFromThrift(pageStats, *type, end - begin);
+    if (testFilter(filter, columnStats.get(), end - begin, type)) {
+      continue;
+    }
+    if (!pruned.empty() && pruned.back().second == begin) {
+      pruned.back().second = end;
+    } else {
+      pruned.emplace_back(begin, end);
+    }
+  }
+  return pruned;
+}
+
+uint64_t ParquetData::rowGroupLoadSize(uint32_t index) const {
+  auto chunk = fileMetaDataPtr_.rowGroup(index).columnChunk(type_->column());
+  return chunk.compression() == common::CompressionKind::CompressionKind_NONE
+      ? chunk.totalUncompressedSize()
+      : chunk.totalCompressedSize();
+}
+
 std::pair<int64_t, int64_t> ParquetData::getRowGroupRegion(
     uint32_t index) const {
   auto rowGroup = fileMetaDataPtr_.rowGroup(index);
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "velox/dwio/common/BufferUtil.h"
+#include "velox/dwio/parquet/common/BloomFilter.h"
 #include "velox/dwio/parquet/reader/Metadata.h"
 #include "velox/dwio/parquet/reader/PageReader.h"
 
@@ -37,11 +38,17 @@ class ParquetParams : public dwio::common::FormatParams {
       dwio::common::ColumnReaderStatistics& stats,
       const FileMetaDataPtr metaData,
       const tz::TimeZone* sessionTimezone,
-      TimestampPrecision timestampPrecision)
+      TimestampPrecision timestampPrecision,
+      dwio::common::BufferedInput* bufferedInput = nullptr,
+      bool scanHasFilter = false,
+      FileDecryptor* fileDecryptor = nullptr)
       : FormatParams(pool, stats),
         metaData_(metaData),
         sessionTimezone_(sessionTimezone),
-        timestampPrecision_(timestampPrecision) {}
+        timestampPrecision_(timestampPrecision),
+        bufferedInput_(bufferedInput),
+        scanHasFilter_(scanHasFilter),
+        fileDecryptor_(fileDecryptor) {}
   std::unique_ptr<dwio::common::FormatData> toFormatData(
       const std::shared_ptr<const dwio::common::TypeWithId>& type,
       const common::ScanSpec& scanSpec) override;
@@ -54,6 +61,13 @@ class ParquetParams : public dwio::common::FormatParams {
   const FileMetaDataPtr metaData_;
   const tz::TimeZone* sessionTimezone_;
   const TimestampPrecision timestampPrecision_;
+  // Input for reading Bloom filters when filtering row groups. Bloom filters
+  // are not used if nullptr.
+  dwio::common::BufferedInput* const bufferedInput_;
+  // True if some column of the scan has a filter.
+  const bool scanHasFilter_;
+  // Decryptor of the file if it is encrypted, otherwise nullptr.
+  FileDecryptor* const fileDecryptor_;
 };
 
 /// Format-specific data created for each leaf column of a Parquet rowgroup.
@@ -63,18 +77,34 @@ class ParquetData : public dwio::common::FormatData {
       const std::shared_ptr<const dwio::common::TypeWithId>& type,
       const FileMetaDataPtr fileMetadataPtr,
       memory::MemoryPool& pool,
-      const tz::TimeZone* sessionTimezone)
+      const tz::TimeZone* sessionTimezone,
+      const common::ScanSpec* scanSpec = nullptr,
+      dwio::common::BufferedInput* bufferedInput = nullptr,
+      bool scanHasFilter = false,
+      FileDecryptor* fileDecryptor = nullptr)
       : pool_(pool),
         type_(std::static_pointer_cast<const ParquetTypeWithId>(type)),
         fileMetaDataPtr_(fileMetadataPtr),
+        scanSpec_(scanSpec),
+        bufferedInput_(bufferedInput),
+        scanHasFilter_(scanHasFilter),
+        fileDecryptor_(fileDecryptor),
         maxDefine_(type_->maxDefine_),
         maxRepeat_(type_->maxRepeat_),
         rowsInRowGroup_(-1),
         sessionTimezone_(sessionTimezone) {}
 
-  /// Prepares to read data for 'index'th row group.
+  /// Prepares to read data for 'index'th row group. Also prepares to read the
+  /// page index of the column chunk if the column has a filter. If only other
+  /// columns of the scan have filters, the column chunk is not loaded up
+  /// front. Its pages are then read on first use, and the pages without
+  /// surviving rows are skipped by the offset index without being read.
   void enqueueRowGroup(uint32_t index, dwio::common::BufferedInput& input);
 
+  /// Returns the bytes enqueueRowGroup() reads for the column chunk of
+  /// 'index'th row group, not counting the page index.
+  uint64_t rowGroupLoadSize(uint32_t index) const;
+
   /// Positions 'this' at 'index'th row group. loadRowGroup must be called
   /// first. The returned PositionProvider is empty and should not be used.
   /// Other formats may use it.
@@ -203,11 +233,41 @@ class ParquetData : public dwio::common::FormatData {
   // Returns the <offset, length> of the row group.
   std::pair<int64_t, int64_t> getRowGroupRegion(uint32_t index) const;
 
+  /// Returns false if no value passing 'filter' is in 'bloomFilter' of a
+  /// column chunk of 'physicalType'. Returns true if 'filter' is not an
+  /// equality or IN filter on the values in the Bloom filter.
+  static bool testBloomFilter(
+      const common::Filter& filter,
+      thrift::Type::type physicalType,
+      const BloomFilter& bloomFilter);
+
  private:
   /// True if 'filter' may have hits for the column of 'this' according to the
   /// stats in 'rowGroup'.
   bool rowGroupMatches(uint32_t rowGroupId, common::Filter* filter);
 
+  /// False if the Bloom filter of the column chunk in 'rowGroupId'th row group
+  /// has none of the values passing 'filter'. Reads the Bloom filter only if
+  /// 'filter' is an equality or IN filter.
+  bool bloomFilterMatches(uint32_t rowGroupId, common::Filter* filter);
+
+  /// Reads the Bloom filter at 'offset' in the file.
+  BlockSplitBloomFilter readBloomFilter(int64_t offset);
+
+  /// Returns the row ranges of the pages of 'index'th row group that have no
+  /// rows passing the filter according to the page index of the column chunk.
+  std::vector<std::pair<int64_t, int64_t>> prunedRows(
+      int64_t index,
+      const thrift::OffsetIndex& offsetIndex);
+
+  /// True if the column chunk of 'chunk' has a page index usable for
+  /// skipping pages, which requires a top level column.
+  bool canUsePageIndex(const ColumnChunkMetaDataPtr& chunk) const;
+
+  /// True if the column chunk of 'chunk' is read on demand. See
+  /// enqueueRowGroup().
+  bool readOnDemand(const ColumnChunkMetaDataPtr& chunk) const;
+
  protected:
   memory::MemoryPool& pool_;
   std::shared_ptr<const ParquetTypeWithId> type_;
@@ -216,6 +276,27 @@ class ParquetData : public dwio::common::FormatData {
   // ahead of first use, not at construction.
   std::vector<std::unique_ptr<dwio::common::SeekableInputStream>> streams_;
 
+  // Spec of the column of 'this'. nullptr if not known, in which case the
+  // page index is not used.
+  const common::ScanSpec* scanSpec_;
+
+  // Input for reading Bloom filters. nullptr if Bloom filters are not used.
+  dwio::common::BufferedInput* const bufferedInput_;
+
+  // True if some column of the scan has a filter.
+  const bool scanHasFilter_;
+
+  // Decryptor of the file if it is encrypted, otherwise nullptr.
+  FileDecryptor* const fileDecryptor_;
+
+  // Streams for the ColumnIndex and OffsetIndex of this column in each of
+  // 'rowGroups_'. The ColumnIndex is only enqueued if the column has a
+  // filter and the OffsetIndex if the page index is used.
+  std::vector<std::unique_ptr<dwio::common::SeekableInputStream>>
+      columnIndexStreams_;
+  std::vector<std::unique_ptr<dwio::common::SeekableInputStream>>
+      offsetIndexStreams_;
+
   const uint32_t maxDefine_;
   const uint32_t maxRepeat_;
   int64_t rowsInRowGroup_;
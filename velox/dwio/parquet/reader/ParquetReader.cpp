@@ -18,6 +18,8 @@
 
 #include <thrift/protocol/TCompactProtocol.h> //@manual
 
+#include "velox/dwio/common/FileMetadataCache.h"
+#include "velox/dwio/parquet/reader/FileDecryptor.h"
 #include "velox/dwio/parquet/reader/ParquetColumnReader.h"
 #include "velox/dwio/parquet/reader/StructColumnReader.h"
 #include "velox/dwio/parquet/thrift/ThriftTransport.h"
@@ -36,6 +38,18 @@ bool isParquetReservedKeyword(
       ? true
       : false;
 }
+
+// Deserializes 'object' from the 'size' bytes at 'data'. Returns the number
+// of bytes read.
+template <typename T>
+uint32_t readThrift(const char* data, uint64_t size, T& object) {
+  std::shared_ptr<thrift::ThriftTransport> thriftTransport =
+      std::make_shared<thrift::ThriftBufferedTransport>(data, size);
+  auto thriftProtocol = std::make_unique<
+      apache::thrift::protocol::TCompactProtocolT<thrift::ThriftTransport>>(
+      thriftTransport);
+  return object.read(thriftProtocol.get());
+}
 } // namespace
 
 /// Metadata and options for reading Parquet.
@@ -63,6 +77,12 @@ class ReaderBase {
     return *fileMetaData_;
   }
 
+  /// True if the FileMetaData is shared with other readers through
+  /// FileMetadataCache. Shared metadata must not be modified.
+  bool isFileMetaDataShared() const {
+    return fileMetaDataShared_;
+  }
+
   FileMetaDataPtr fileMetaData() const {
     return FileMetaDataPtr(reinterpret_cast<const void*>(fileMetaData_.get()));
   }
@@ -87,8 +107,14 @@ class ReaderBase {
     return version_;
   }
 
+  /// The decryptor of the file if it is encrypted, otherwise nullptr.
+  FileDecryptor* fileDecryptor() const {
+    return fileDecryptor_.get();
+  }
+
   /// Ensures that streams are enqueued and loading for the row group at
-  /// 'currentGroup'. May start loading one or more subsequent groups.
+  /// 'currentGroup'. May start loading one or more subsequent groups, as
+  /// many as fit in the prefetch memory limit together with the current one.
   void scheduleRowGroups(
       const std::vector<uint32_t>& groups,
       int32_t currentGroup,
@@ -104,10 +130,21 @@ class ReaderBase {
   /// the data still exists in the buffered inputs.
   bool isRowGroupBuffered(int32_t rowGroupIndex) const;
 
+  /// Returns the statistics of the column with id 'index' in schemaWithId(),
+  /// merged from the statistics of all the row groups. Returns nullptr for
+  /// non-leaf and repeated columns, and if a row group has no statistics for
+  /// the column. Only integer columns get min and max.
+  std::unique_ptr<dwio::common::ColumnStatistics> columnStatistics(
+      uint32_t index) const;
+
  private:
   // Reads and parses file footer.
   void loadFileMetaData();
 
+  // Decrypts the metadata of the encrypted column chunks whose keys are
+  // available.
+  void decryptColumnMetaData();
+
   void initializeSchema();
 
   void initializeVersion();
@@ -139,7 +176,10 @@ class ReaderBase {
   const dwio::common::ReaderOptions options_;
   std::shared_ptr<velox::dwio::common::BufferedInput> input_;
   uint64_t fileLength_;
-  std::unique_ptr<thrift::FileMetaData> fileMetaData_;
+  std::shared_ptr<thrift::FileMetaData> fileMetaData_;
+  bool fileMetaDataShared_{false};
+  // Set if the file is encrypted. Caches the keys of the file.
+  std::unique_ptr<FileDecryptor> fileDecryptor_;
   RowTypePtr schema_;
   std::shared_ptr<const dwio::common::TypeWithId> schemaWithId_;
 
@@ -168,6 +208,25 @@ ReaderBase::ReaderBase(
 }
 
 void ReaderBase::loadFileMetaData() {
+  // The parsed FileMetaData takes a few times the memory of its compact
+  // thrift encoding.
+  constexpr uint64_t kParsedFooterSizeFactor = 4;
+  auto* cache = dwio::common::FileMetadataCache::getInstance();
+  const auto cacheKey = cache == nullptr
+      ? std::nullopt
+      : dwio::common::FileMetadataCache::makeKey(
+            dwio::common::FileFormat::PARQUET,
+            *input_->getReadFile(),
+            options_.fileModificationTime());
+  if (cacheKey.has_value()) {
+    if (auto cached = cache->get<thrift::FileMetaData>(cacheKey.value())) {
+      // Not modified by 'this', see isFileMetaDataShared().
+      fileMetaData_ = std::const_pointer_cast<thrift::FileMetaData>(cached);
+      fileMetaDataShared_ = true;
+      return;
+    }
+  }
+
   bool preloadFile =
       fileLength_ <= std::max(filePreloadThreshold_, footerEstimatedSize_);
   uint64_t readSize = preloadFile ? fileLength_ : footerEstimatedSize_;
@@ -185,8 +244,12 @@ void ReaderBase::loadFileMetaData() {
   const char* bufferEnd = nullptr;
   dwio::common::readBytes(
       readSize, stream.get(), copy.data(), bufferStart, bufferEnd);
+  // The footer of a file with modular encryption is encrypted if the file
+  // ends with "PARE".
+  const bool encryptedFooter =
+      strncmp(copy.data() + readSize - 4, "PARE", 4) == 0;
   VELOX_CHECK(
-      strncmp(copy.data() + readSize - 4, "PAR1", 4) == 0,
+      encryptedFooter || strncmp(copy.data() + readSize - 4, "PAR1", 4) == 0,
       "No magic bytes found at end of the Parquet file");
 
   uint32_t footerLength;
@@ -208,21 +271,54 @@ void ReaderBase::loadFileMetaData() {
         missingLength, stream.get(), copy.data(), bufferStart, bufferEnd);
   }
 
-  std::shared_ptr<thrift::ThriftTransport> thriftTransport =
-      std::make_shared<thrift::ThriftBufferedTransport>(
-          copy.data() + footerOffsetInBuffer, footerLength);
-  auto thriftProtocol = std::make_unique<
-      apache::thrift::protocol::TCompactProtocolT<thrift::ThriftTransport>>(
-      thriftTransport);
-  fileMetaData_ = std::make_unique<thrift::FileMetaData>();
-  fileMetaData_->read(thriftProtocol.get());
+  const char* footer = copy.data() + footerOffsetInBuffer;
+  fileMetaData_ = std::make_shared<thrift::FileMetaData>();
+  if (encryptedFooter) {
+    // The FileCryptoMetaData is followed by the encrypted FileMetaData.
+    thrift::FileCryptoMetaData cryptoMetaData;
+    const auto cryptoMetaDataLength =
+        readThrift(footer, footerLength, cryptoMetaData);
+    fileDecryptor_ = std::make_unique<FileDecryptor>(
+        cryptoMetaData.encryption_algorithm,
+        cryptoMetaData.key_metadata,
+        options_.keyRetriever());
+    const auto plaintext = fileDecryptor_->decryptFooter(
+        footer + cryptoMetaDataLength, footerLength - cryptoMetaDataLength);
+    readThrift(plaintext.data(), plaintext.size(), *fileMetaData_);
+  } else {
+    readThrift(footer, footerLength, *fileMetaData_);
+    if (fileMetaData_->__isset.encryption_algorithm) {
+      // The footer is in plaintext and signed, and the column chunks are
+      // encrypted.
+      fileDecryptor_ = std::make_unique<FileDecryptor>(
+          fileMetaData_->encryption_algorithm,
+          fileMetaData_->footer_signing_key_metadata,
+          options_.keyRetriever());
+    }
+  }
+  if (fileDecryptor_) {
+    // Not cached since the decrypted metadata depends on the keys of the
+    // reader.
+    decryptColumnMetaData();
+  } else if (cacheKey.has_value()) {
+    cache->put(
+        cacheKey.value(),
+        fileMetaData_,
+        static_cast<uint64_t>(footerLength) * kParsedFooterSizeFactor);
+    fileMetaDataShared_ = true;
+  }
 }
 
-void ReaderBase::initializeSchema() {
-  if (fileMetaData_->__isset.encryption_algorithm) {
-    VELOX_UNSUPPORTED("Encrypted Parquet files are not supported");
+void ReaderBase::decryptColumnMetaData() {
+  for (auto i = 0; i < fileMetaData_->row_groups.size(); ++i) {
+    auto& columns = fileMetaData_->row_groups[i].columns;
+    for (auto j = 0; j < columns.size(); ++j) {
+      fileDecryptor_->decryptColumnMetaData(columns[j], i, j);
+    }
   }
+}
 
+void ReaderBase::initializeSchema() {
   VELOX_CHECK_GT(
       fileMetaData_->schema.size(),
       1,
@@ -883,8 +979,17 @@ void ReaderBase::scheduleRowGroups(
   auto numRowGroupsToLoad = std::min(
       options_.prefetchRowGroups() + 1,
       static_cast<int64_t>(rowGroupIds.size() - currentGroup));
+  const auto memoryLimit = options_.prefetchRowGroupsMemoryLimit();
+  uint64_t loadSize = 0;
   for (auto i = 0; i < numRowGroupsToLoad; i++) {
     auto thisGroup = rowGroupIds[currentGroup + i];
+    if (memoryLimit > 0) {
+      // The current group is loaded even if it alone exceeds the limit.
+      loadSize += reader.rowGroupLoadSize(thisGroup);
+      if (i > 0 && loadSize > memoryLimit) {
+        break;
+      }
+    }
     if (!inputs_[thisGroup]) {
       inputs_[thisGroup] = reader.loadRowGroup(thisGroup, input_);
     }
@@ -952,7 +1057,10 @@ class ParquetRowReader::Impl {
         columnReaderStats_,
         readerBase_->fileMetaData(),
         readerBase->sessionTimezone(),
-        options_.timestampPrecision());
+        options_.timestampPrecision(),
+        &readerBase_->bufferedInput(),
+        options_.scanSpec()->hasFilter(),
+        readerBase_->fileDecryptor());
     requestedType_ = options_.requestedType() ? options_.requestedType()
                                               : readerBase_->schema();
     columnReader_ = ParquetColumnReader::build(
@@ -1002,7 +1110,7 @@ class ParquetRowReader::Impl {
       if (rowGroupInRange && !isExcluded && !isEmpty) {
         rowGroupIds_.push_back(i);
         firstRowOfRowGroup_.push_back(rowNumber);
-      } else if (i != 0) {
+      } else if (i != 0 && !readerBase_->isFileMetaDataShared()) {
         // Clear the metadata of row groups that are not read. This helps reduce
         // the memory consumption. ColumnChunks consume the most memory.
         // Skip the 0th RowGroup as it is used by estimatedRowSize().
@@ -1163,10 +1271,92 @@ ParquetReader::ParquetReader(
     const dwio::common::ReaderOptions& options)
     : readerBase_(std::make_shared<ReaderBase>(std::move(input), options)) {}
 
+std::unique_ptr<dwio::common::ColumnStatistics> ReaderBase::columnStatistics(
+    uint32_t index) const {
+  const dwio::common::TypeWithId* node = schemaWithId_.get();
+  while (node->id() != index) {
+    const dwio::common::TypeWithId* next = nullptr;
+    for (auto i = 0; i < node->size(); ++i) {
+      const auto* child = node->childAt(i).get();
+      if (child->id() <= index && index <= child->maxId()) {
+        next = child;
+        break;
+      }
+    }
+    if (next == nullptr) {
+      return nullptr;
+    }
+    node = next;
+  }
+  const auto* column = static_cast<const ParquetTypeWithId*>(node);
+  if (!column->isLeaf() || column->maxRepeat_ > 0) {
+    return nullptr;
+  }
+  const auto& type = column->type();
+  const auto kind = type->kind();
+  const bool isInteger = !type->isDecimal() &&
+      (kind == TypeKind::TINYINT || kind == TypeKind::SMALLINT ||
+       kind == TypeKind::INTEGER || kind == TypeKind::BIGINT);
+
+  std::optional<uint64_t> valueCount = 0;
+  std::optional<bool> hasNull = false;
+  std::optional<int64_t> min;
+  std::optional<int64_t> max;
+  bool hasMinMax = isInteger;
+  auto metadata = fileMetaData();
+  for (auto i = 0; i < metadata.numRowGroups(); ++i) {
+    auto rowGroup = metadata.rowGroup(i);
+    auto columnChunk = rowGroup.columnChunk(column->column());
+    if (!columnChunk.hasMetadata() || columnChunk.isEncrypted() ||
+        !columnChunk.hasStatistics()) {
+      return nullptr;
+    }
+    auto stats = columnChunk.getColumnStatistics(type, rowGroup.numRows());
+    const auto numValues = stats->getNumberOfValues();
+    valueCount = valueCount.has_value() && numValues.has_value()
+        ? std::optional(*valueCount + *numValues)
+        : std::nullopt;
+    hasNull = hasNull.has_value() && stats->hasNull().has_value()
+        ? std::optional(*hasNull || *stats->hasNull())
+        : std::nullopt;
+    if (!hasMinMax || numValues == 0) {
+      continue;
+    }
+    auto* integerStats =
+        dynamic_cast<const dwio::common::IntegerColumnStatistics*>(stats.get());
+    if (integerStats == nullptr || !integerStats->getMinimum().has_value() ||
+        !integerStats->getMaximum().has_value()) {
+      hasMinMax = false;
+      continue;
+    }
+    const auto rowGroupMin = *integerStats->getMinimum();
+    const auto rowGroupMax = *integerStats->getMaximum();
+    min = min.has_value() ? std::min(*min, rowGroupMin) : rowGroupMin;
+    max = max.has_value() ? std::max(*max, rowGroupMax) : rowGroupMax;
+  }
+  if (!isInteger) {
+    return std::make_unique<dwio::common::ColumnStatistics>(
+        valueCount, hasNull, std::nullopt, std::nullopt);
+  }
+  return std::make_unique<dwio::common::IntegerColumnStatistics>(
+      valueCount,
+      hasNull,
+      std::nullopt,
+      std::nullopt,
+      hasMinMax ? min : std::nullopt,
+      hasMinMax ? max : std::nullopt,
+      std::nullopt);
+}
+
 std::optional<uint64_t> ParquetReader::numberOfRows() const {
   return readerBase_->thriftFileMetaData().num_rows;
 }
 
+std::unique_ptr<dwio::common::ColumnStatistics>
+ParquetReader::columnStatistics(uint32_t index) const {
+  return readerBase_->columnStatistics(index);
+}
+
 const velox::RowTypePtr& ParquetReader::rowType() const {
   return readerBase_->schema();
 }
@@ -91,10 +91,10 @@ class ParquetReader : public dwio::common::Reader {
 
   std::optional<uint64_t> numberOfRows() const override;
 
+  /// Returns the statistics of the column with id 'index' in typeWithId(),
+  /// merged from the row group statistics.
   std::unique_ptr<dwio::common::ColumnStatistics> columnStatistics(
-      uint32_t index) const override {
-    return nullptr;
-  }
+      uint32_t index) const override;
 
   const velox::RowTypePtr& rowType() const override;
 
@@ -26,6 +26,22 @@ class ScanSpec;
 
 namespace facebook::velox::parquet {
 
+namespace {
+uint64_t leafLoadSize(
+    const dwio::common::SelectiveColumnReader& reader,
+    uint32_t index) {
+  auto& children = reader.children();
+  if (children.empty()) {
+    return reader.formatData().as<ParquetData>().rowGroupLoadSize(index);
+  }
+  uint64_t size = 0;
+  for (auto* child : children) {
+    size += leafLoadSize(*child, index);
+  }
+  return size;
+}
+} // namespace
+
 StructColumnReader::StructColumnReader(
     const TypePtr& requestedType,
     const std::shared_ptr<const dwio::common::TypeWithId>& fileType,
@@ -121,6 +137,10 @@ std::shared_ptr<dwio::common::BufferedInput> StructColumnReader::loadRowGroup(
   return newInput;
 }
 
+uint64_t StructColumnReader::rowGroupLoadSize(uint32_t index) const {
+  return leafLoadSize(*this, index);
+}
+
 bool StructColumnReader::isRowGroupBuffered(
     uint32_t index,
     dwio::common::BufferedInput& input) {
@@ -49,6 +49,10 @@ class StructColumnReader : public dwio::common::SelectiveStructColumnReader {
       uint32_t index,
       const std::shared_ptr<dwio::common::BufferedInput>& input);
 
+  /// Returns the bytes loadRowGroup() reads for the leaf columns of 'this'
+  /// in 'index'th row group.
+  uint64_t rowGroupLoadSize(uint32_t index) const;
+
   // No-op in Parquet. All readers switch row groups at the same time, there is
   // no on-demand skipping to a new row group.
   void advanceFieldReader(
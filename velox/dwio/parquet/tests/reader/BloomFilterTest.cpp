@@ -395,3 +395,41 @@ TEST_F(BloomFilterTest, TestBloomFilterHashes) {
         << "Hash with seed 0 Error: " << i;
   }
 }
+
+TEST_F(BloomFilterTest, testFilter) {
+  BlockSplitBloomFilter bloomFilter(leafPool_.get());
+  bloomFilter.init(1024);
+  for (int64_t i = 0; i < 100; i += 2) {
+    bloomFilter.insertHash(bloomFilter.hash(i));
+  }
+
+  auto test = [&](const common::Filter& filter) {
+    return ParquetData::testBloomFilter(
+        filter, thrift::Type::INT64, bloomFilter);
+  };
+  EXPECT_TRUE(test(common::BigintRange(10, 10, false)));
+  EXPECT_FALSE(test(common::BigintRange(11, 11, false)));
+  // Ranges are not tested against the Bloom filter.
+  EXPECT_TRUE(test(common::BigintRange(11, 11'000, false)));
+  EXPECT_TRUE(test(common::BigintValuesUsingHashTable(
+      42, 2'000'000, {42, 1'001, 2'000'000}, false)));
+  EXPECT_FALSE(test(common::BigintValuesUsingHashTable(
+      1'000, 2'000'000, {1'000, 1'001, 2'000'000}, false)));
+
+  BlockSplitBloomFilter stringBloomFilter(leafPool_.get());
+  stringBloomFilter.init(1024);
+  for (const auto& value : {"apple", "banana", "cherry"}) {
+    const ByteArray bytes{std::string_view(value)};
+    stringBloomFilter.insertHash(stringBloomFilter.hash(&bytes));
+  }
+  auto testString = [&](const common::Filter& filter) {
+    return ParquetData::testBloomFilter(
+        filter, thrift::Type::BYTE_ARRAY, stringBloomFilter);
+  };
+  EXPECT_TRUE(testString(
+      common::BytesRange("apple", false, false, "apple", false, false, false)));
+  EXPECT_FALSE(testString(
+      common::BytesRange("grape", false, false, "grape", false, false, false)));
+  EXPECT_TRUE(testString(common::BytesValues({"kiwi", "cherry"}, false)));
+  EXPECT_FALSE(testString(common::BytesValues({"kiwi", "lemon"}, false)));
+}
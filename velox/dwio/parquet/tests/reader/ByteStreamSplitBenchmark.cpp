@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/parquet/reader/ByteStreamSplitDecoder.h"
+
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace facebook::velox::parquet;
+
+namespace {
+constexpr int32_t kNumValues = 1'000'000;
+
+// Compares decoding a BYTE_STREAM_SPLIT page of 'width' byte values with
+// reading a PLAIN page, which is a copy of the values.
+class ByteStreamSplitBenchmark {
+ public:
+  explicit ByteStreamSplitBenchmark(int32_t width)
+      : width_(width),
+        encoded_(kNumValues * width),
+        decoded_(kNumValues * width) {
+    std::mt19937 rng(1);
+    for (auto& byte : encoded_) {
+      byte = static_cast<char>(rng());
+    }
+  }
+
+  void plain() {
+    std::memcpy(decoded_.data(), encoded_.data(), encoded_.size());
+    folly::doNotOptimizeAway(decoded_.data());
+  }
+
+  void byteStreamSplit() {
+    decodeByteStreamSplit(encoded_.data(), kNumValues, width_, decoded_.data());
+    folly::doNotOptimizeAway(decoded_.data());
+  }
+
+ private:
+  const int32_t width_;
+  std::vector<char> encoded_;
+  std::vector<char> decoded_;
+};
+
+void plain(uint32_t iterations, int32_t width) {
+  folly::BenchmarkSuspender suspender;
+  ByteStreamSplitBenchmark benchmark(width);
+  suspender.dismiss();
+  for (auto i = 0; i < iterations; ++i) {
+    benchmark.plain();
+  }
+}
+
+void byteStreamSplit(uint32_t iterations, int32_t width) {
+  folly::BenchmarkSuspender suspender;
+  ByteStreamSplitBenchmark benchmark(width);
+  suspender.dismiss();
+  for (auto i = 0; i < iterations; ++i) {
+    benchmark.byteStreamSplit();
+  }
+}
+} // namespace
+
+BENCHMARK_NAMED_PARAM(plain, float, 4);
+BENCHMARK_RELATIVE_NAMED_PARAM(byteStreamSplit, float, 4);
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(plain, double, 8);
+BENCHMARK_RELATIVE_NAMED_PARAM(byteStreamSplit, double, 8);
+BENCHMARK_DRAW_LINE();
+BENCHMARK_NAMED_PARAM(plain, fixed16, 16);
+BENCHMARK_RELATIVE_NAMED_PARAM(byteStreamSplit, fixed16, 16);
+
+int main(int argc, char** argv) {
+  folly::Init init{&argc, &argv};
+  folly::runBenchmarks();
+  return 0;
+}
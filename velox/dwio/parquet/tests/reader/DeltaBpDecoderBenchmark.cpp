@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/parquet/reader/DeltaBpDecoder.h"
+
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+
+#include <random>
+#include <vector>
+
+using namespace facebook::velox::parquet;
+
+namespace {
+constexpr int32_t kValuesPerBlock = 128;
+constexpr int32_t kMiniBlocksPerBlock = 4;
+constexpr int32_t kValuesPerMiniBlock = kValuesPerBlock / kMiniBlocksPerBlock;
+constexpr int32_t kNumBlocks = 8'000;
+constexpr int32_t kNumValues = kNumBlocks * kValuesPerBlock + 1;
+
+void putVlq(uint64_t value, std::vector<char>& out) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<char>(value));
+}
+
+// Writes a DELTA_BINARY_PACKED page of 'kNumValues' values, all of whose
+// deltas are packed with 'bitWidth' bits.
+std::vector<char> encodeDeltas(uint8_t bitWidth) {
+  std::mt19937_64 rng(1);
+  const uint64_t mask = (1UL << bitWidth) - 1;
+  std::vector<char> data;
+  putVlq(kValuesPerBlock, data);
+  putVlq(kMiniBlocksPerBlock, data);
+  putVlq(kNumValues, data);
+  // The first value and the minimum deltas are zig-zag encoded zeros.
+  putVlq(0, data);
+  std::vector<uint64_t> packed;
+  for (auto block = 0; block < kNumBlocks; ++block) {
+    putVlq(0, data);
+    for (auto i = 0; i < kMiniBlocksPerBlock; ++i) {
+      data.push_back(static_cast<char>(bitWidth));
+    }
+    for (auto i = 0; i < kMiniBlocksPerBlock; ++i) {
+      packed.assign(bitWidth / 2 + 1, 0);
+      for (auto j = 0; j < kValuesPerMiniBlock; ++j) {
+        const uint64_t delta = rng() & mask;
+        const uint64_t bit = j * bitWidth;
+        packed[bit / 64] |= delta << (bit % 64);
+        if (bit % 64 + bitWidth > 64) {
+          packed[bit / 64 + 1] |= delta >> (64 - bit % 64);
+        }
+      }
+      const auto* bytes = reinterpret_cast<const char*>(packed.data());
+      data.insert(
+          data.end(), bytes, bytes + kValuesPerMiniBlock * bitWidth / 8);
+    }
+  }
+  // Padding for the word sized reads of the decoder.
+  data.resize(data.size() + sizeof(uint64_t));
+  return data;
+}
+
+void decodeDeltas(uint32_t iterations, uint8_t bitWidth) {
+  folly::BenchmarkSuspender suspender;
+  const auto data = encodeDeltas(bitWidth);
+  std::vector<int64_t> values(kNumValues);
+  suspender.dismiss();
+  for (auto i = 0; i < iterations; ++i) {
+    DeltaBpDecoder decoder(data.data());
+    decoder.readValues(values.data(), kNumValues);
+    folly::doNotOptimizeAway(values.data());
+  }
+}
+} // namespace
+
+BENCHMARK_NAMED_PARAM(decodeDeltas, width1, 1);
+BENCHMARK_NAMED_PARAM(decodeDeltas, width4, 4);
+BENCHMARK_NAMED_PARAM(decodeDeltas, width8, 8);
+BENCHMARK_NAMED_PARAM(decodeDeltas, width13, 13);
+BENCHMARK_NAMED_PARAM(decodeDeltas, width16, 16);
+BENCHMARK_NAMED_PARAM(decodeDeltas, width24, 24);
+BENCHMARK_NAMED_PARAM(decodeDeltas, width32, 32);
+BENCHMARK_NAMED_PARAM(decodeDeltas, width48, 48);
+
+int main(int argc, char** argv) {
+  folly::Init init{&argc, &argv};
+  folly::runBenchmarks();
+  return 0;
+}
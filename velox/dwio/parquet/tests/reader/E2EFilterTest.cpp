@@ -133,6 +133,45 @@ TEST_F(E2EFilterTest, integerDirect) {
       20);
 }
 
+TEST_F(E2EFilterTest, pageIndex) {
+  options_.enableDictionary = false;
+  options_.dataPageSize = 4 * 1024;
+  options_.enablePageIndex = true;
+
+  // Ascending values give pages with narrow min/max ranges so that filters
+  // skip pages by the page index.
+  testWithTypes(
+      "int_val:int,"
+      "long_val:bigint,"
+      "double_val:double",
+      [&]() {
+        makeIntDistribution<int32_t>("int_val", 0, 100, 2'000, 0, 0, 0, true);
+        makeIntDistribution<int64_t>(
+            "long_val", 0, 1'000, 3'000, 0, 0, 0, false);
+      },
+      true,
+      {"int_val", "long_val", "double_val"},
+      20);
+}
+
+TEST_F(E2EFilterTest, pageIndexPayloadColumns) {
+  options_.dataPageSize = 4 * 1024;
+  options_.enablePageIndex = true;
+
+  // Only 'int_val' is filtered. The other columns are read on demand and jump
+  // over the pages without passing rows, also after a dictionary page.
+  testWithTypes(
+      "int_val:int,"
+      "long_val:bigint,"
+      "string_val:string",
+      [&]() {
+        makeIntDistribution<int32_t>("int_val", 0, 100, 2'000, 0, 0, 0, true);
+      },
+      true,
+      {"int_val"},
+      20);
+}
+
 TEST_F(E2EFilterTest, integerDeltaBinaryPack) {
   options_.enableDictionary = false;
   options_.encoding =
@@ -331,6 +370,28 @@ TEST_F(E2EFilterTest, floatAndDoubleDirect) {
       20);
 }
 
+TEST_F(E2EFilterTest, floatAndDoubleByteStreamSplit) {
+  options_.enableDictionary = false;
+  options_.dataPageSize = 4 * 1024;
+  options_.encoding =
+      facebook::velox::parquet::arrow::Encoding::BYTE_STREAM_SPLIT;
+
+  testWithTypes(
+      "float_val:float,"
+      "double_val:double,"
+      "float_val2:float,"
+      "double_val2:double,"
+      "float_null:float",
+      [&]() {
+        makeAllNulls("float_null");
+        makeQuantizedFloat<float>("float_val2", 200, true);
+        makeQuantizedFloat<double>("double_val2", 522, true);
+      },
+      true,
+      {"float_val", "double_val", "float_val2", "double_val2", "float_null"},
+      20);
+}
+
 TEST_F(E2EFilterTest, floatAndDouble) {
   // float_val and double_val may be direct since the
   // values are random.float_val2 and double_val2 are expected to be
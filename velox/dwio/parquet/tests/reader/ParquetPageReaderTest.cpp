@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "velox/dwio/parquet/reader/ByteStreamSplitDecoder.h"
 #include "velox/dwio/parquet/reader/PageReader.h"
 #include "velox/dwio/parquet/tests/ParquetTestBase.h"
 
@@ -108,3 +109,22 @@ TEST(CompressionOptionsTest, testCompressionOptions) {
       options.format.zlib.windowBits,
       dwio::common::compression::Compressor::PARQUET_ZLIB_WINDOW_BITS);
 }
+
+TEST(ByteStreamSplitTest, decode) {
+  for (auto width : {2, 3, 4, 8, 12, 16}) {
+    constexpr int32_t kNumValues = 43;
+    std::vector<char> plain(kNumValues * width);
+    for (auto i = 0; i < plain.size(); ++i) {
+      plain[i] = static_cast<char>(i * 7 + width);
+    }
+    std::vector<char> encoded(plain.size());
+    for (auto i = 0; i < kNumValues; ++i) {
+      for (auto byte = 0; byte < width; ++byte) {
+        encoded[byte * kNumValues + i] = plain[i * width + byte];
+      }
+    }
+    std::vector<char> decoded(plain.size());
+    decodeByteStreamSplit(encoded.data(), kNumValues, width, decoded.data());
+    EXPECT_EQ(plain, decoded) << "width " << width;
+  }
+}
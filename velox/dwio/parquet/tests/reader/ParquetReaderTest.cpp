@@ -1130,6 +1130,37 @@ TEST_F(ParquetReaderTest, prefetchRowGroups) {
   }
 }
 
+TEST_F(ParquetReaderTest, prefetchRowGroupsMemoryLimit) {
+  auto rowType = ROW({"id"}, {BIGINT()});
+  const std::string sample(getExampleFilePath("multiple_row_groups.parquet"));
+  const int numRowGroups = 4;
+
+  dwio::common::ReaderOptions readerOptions{leafPool_.get()};
+  readerOptions.setFilePreloadThreshold(0);
+  readerOptions.setPrefetchRowGroups(numRowGroups);
+  // Less than one row group. Only the row group being read is loaded.
+  readerOptions.setPrefetchRowGroupsMemoryLimit(1);
+
+  auto reader = createReader(sample, readerOptions);
+  RowReaderOptions rowReaderOpts;
+  rowReaderOpts.setScanSpec(makeScanSpec(rowType));
+  auto rowReader = reader->createRowReader(rowReaderOpts);
+  auto parquetRowReader = dynamic_cast<ParquetRowReader*>(rowReader.get());
+
+  constexpr int kBatchSize = 1000;
+  auto result = BaseVector::create(rowType, kBatchSize, pool_.get());
+  uint64_t numRows = 0;
+  for (int i = 0; i < numRowGroups; i++) {
+    EXPECT_TRUE(parquetRowReader->isRowGroupBuffered(i));
+    for (int j = i + 1; j < numRowGroups; j++) {
+      EXPECT_FALSE(parquetRowReader->isRowGroupBuffered(j));
+    }
+    numRows += parquetRowReader->next(kBatchSize, result);
+    parquetRowReader->nextRowNumber();
+  }
+  EXPECT_EQ(numRows, reader->numberOfRows());
+}
+
 TEST_F(ParquetReaderTest, testEmptyRowGroups) {
   // empty_row_groups.parquet contains empty row groups
   const std::string sample(getExampleFilePath("empty_row_groups.parquet"));
@@ -24,6 +24,7 @@
 #include "velox/dwio/parquet/RegisterParquetWriter.h" // @manual
 #include "velox/dwio/parquet/reader/PageReader.h"
 #include "velox/dwio/parquet/tests/ParquetTestBase.h"
+#include "velox/dwio/parquet/writer/arrow/Encryption.h"
 #include "velox/exec/Cursor.h"
 #include "velox/exec/tests/utils/AssertQueryBuilder.h"
 #include "velox/exec/tests/utils/PlanBuilder.h"
@@ -81,6 +82,26 @@ class ParquetWriterTest : public ParquetTestBase {
   inline static const std::string kHiveConnectorId = "test-hive";
 };
 
+class TestKeyRetriever : public dwio::common::encryption::KeyRetriever {
+ public:
+  explicit TestKeyRetriever(std::unordered_map<std::string, std::string> keys)
+      : keys_(std::move(keys)) {}
+
+  std::string getKey(const std::string& keyMetadata) override {
+    ++numCalls_;
+    auto it = keys_.find(keyMetadata);
+    return it == keys_.end() ? "" : it->second;
+  }
+
+  int32_t numCalls() const {
+    return numCalls_;
+  }
+
+ private:
+  const std::unordered_map<std::string, std::string> keys_;
+  int32_t numCalls_{0};
+};
+
 std::vector<CompressionKind> params = {
     CompressionKind::CompressionKind_NONE,
     CompressionKind::CompressionKind_SNAPPY,
@@ -147,6 +168,147 @@ TEST_F(ParquetWriterTest, compression) {
   assertReadWithReaderAndExpected(schema, *rowReader, data, *leafPool_);
 };
 
+TEST_F(ParquetWriterTest, arrowBuffersFromMemoryPool) {
+  auto schema = ROW({"c0", "c1"}, {BIGINT(), VARCHAR()});
+  const int64_t kRows = 10'000;
+  const auto data = makeRowVector({
+      makeFlatVector<int64_t>(kRows, [](auto row) { return row; }),
+      makeFlatVector<std::string>(
+          kRows, [](auto row) { return fmt::format("value {}", row % 100); }),
+  });
+
+  auto sink = std::make_unique<MemorySink>(
+      200 * 1024 * 1024,
+      dwio::common::FileSink::Options{.pool = leafPool_.get()});
+  auto sinkPtr = sink.get();
+  facebook::velox::parquet::WriterOptions writerOptions;
+  writerOptions.memoryPool = leafPool_.get();
+  auto writerPool = rootPool_->addAggregateChild("arrowBuffersFromMemoryPool");
+  auto writer = std::make_unique<facebook::velox::parquet::Writer>(
+      std::move(sink), writerOptions, writerPool, schema);
+  writer->write(data);
+  writer->close();
+
+  // The column writers allocate their buffers from the '.arrow' leaf pool.
+  int64_t arrowPeakBytes = 0;
+  writerPool->visitChildren([&](memory::MemoryPool* child) {
+    if (child->name().find(".arrow") != std::string::npos) {
+      arrowPeakBytes = child->peakBytes();
+    }
+    return true;
+  });
+  EXPECT_GT(arrowPeakBytes, 0);
+  writer.reset();
+  EXPECT_EQ(writerPool->usedBytes(), 0);
+
+  dwio::common::ReaderOptions readerOptions{leafPool_.get()};
+  auto reader = createReaderInMemory(*sinkPtr, readerOptions);
+  ASSERT_EQ(reader->numberOfRows(), kRows);
+  auto rowReader = createRowReaderWithSchema(std::move(reader), schema);
+  assertReadWithReaderAndExpected(schema, *rowReader, data, *leafPool_);
+}
+
+TEST_F(ParquetWriterTest, encryption) {
+  using facebook::velox::parquet::arrow::ColumnEncryptionProperties;
+  using facebook::velox::parquet::arrow::ColumnPathToEncryptionPropertiesMap;
+  using facebook::velox::parquet::arrow::FileEncryptionProperties;
+
+  auto schema = ROW({"c0", "c1", "c2"}, {BIGINT(), VARCHAR(), DOUBLE()});
+  const int64_t kRows = 10'000;
+  const auto data = makeRowVector({
+      makeFlatVector<int64_t>(kRows, [](auto row) { return row; }),
+      makeFlatVector<std::string>(
+          kRows, [](auto row) { return fmt::format("value {}", row % 100); }),
+      makeFlatVector<double>(kRows, [](auto row) { return row * 0.5; }),
+  });
+  const std::string footerKey(16, 'f');
+  const std::string columnKey(16, 'c');
+
+  for (const bool plaintextFooter : {false, true}) {
+    SCOPED_TRACE(fmt::format("plaintextFooter: {}", plaintextFooter));
+    // 'c0' is not encrypted, 'c1' is encrypted with a column key and 'c2'
+    // with the footer key.
+    ColumnPathToEncryptionPropertiesMap encryptedColumns;
+    encryptedColumns["c1"] = ColumnEncryptionProperties::Builder("c1")
+                                 .key(columnKey)
+                                 ->key_metadata("column")
+                                 ->build();
+    encryptedColumns["c2"] =
+        ColumnEncryptionProperties::Builder("c2").build();
+    FileEncryptionProperties::Builder encryptionBuilder(footerKey);
+    encryptionBuilder.footer_key_metadata("footer")->encrypted_columns(
+        encryptedColumns);
+    if (plaintextFooter) {
+      encryptionBuilder.set_plaintext_footer();
+    }
+
+    auto sink = std::make_unique<MemorySink>(
+        200 * 1024 * 1024,
+        dwio::common::FileSink::Options{.pool = leafPool_.get()});
+    auto sinkPtr = sink.get();
+    facebook::velox::parquet::WriterOptions writerOptions;
+    writerOptions.memoryPool = leafPool_.get();
+    writerOptions.compressionKind = CompressionKind::CompressionKind_SNAPPY;
+    writerOptions.encryptionProperties = encryptionBuilder.build();
+    auto writer = std::make_unique<facebook::velox::parquet::Writer>(
+        std::move(sink), writerOptions, rootPool_, schema);
+    writer->write(data);
+    writer->close();
+
+    // All keys are available.
+    auto keyRetriever = std::make_shared<TestKeyRetriever>(
+        std::unordered_map<std::string, std::string>{
+            {"footer", footerKey}, {"column", columnKey}});
+    dwio::common::ReaderOptions readerOptions{leafPool_.get()};
+    readerOptions.setKeyRetriever(keyRetriever);
+    auto reader = createReaderInMemory(*sinkPtr, readerOptions);
+    ASSERT_EQ(reader->numberOfRows(), kRows);
+    ASSERT_EQ(*reader->rowType(), *schema);
+    auto rowReader = createRowReaderWithSchema(std::move(reader), schema);
+    assertReadWithReaderAndExpected(schema, *rowReader, data, *leafPool_);
+    // Each key is retrieved once.
+    EXPECT_EQ(keyRetriever->numCalls(), 2);
+
+    // The column key is missing. The other columns are readable.
+    readerOptions.setKeyRetriever(std::make_shared<TestKeyRetriever>(
+        std::unordered_map<std::string, std::string>{{"footer", footerKey}}));
+    auto partialSchema = ROW({"c0", "c2"}, {BIGINT(), DOUBLE()});
+    rowReader = createRowReaderWithSchema(
+        createReaderInMemory(*sinkPtr, readerOptions), partialSchema);
+    assertReadWithReaderAndExpected(
+        partialSchema,
+        *rowReader,
+        makeRowVector({"c0", "c2"}, {data->childAt(0), data->childAt(2)}),
+        *leafPool_);
+    rowReader = createRowReaderWithSchema(
+        createReaderInMemory(*sinkPtr, readerOptions), schema);
+    auto result = BaseVector::create(schema, 0, leafPool_.get());
+    VELOX_ASSERT_THROW(
+        rowReader->next(1'000, result),
+        "The key of encrypted Parquet column c1 is missing");
+  }
+
+  // The footer key of a file with an encrypted footer is missing.
+  auto sink = std::make_unique<MemorySink>(
+      200 * 1024 * 1024,
+      dwio::common::FileSink::Options{.pool = leafPool_.get()});
+  auto sinkPtr = sink.get();
+  facebook::velox::parquet::WriterOptions writerOptions;
+  writerOptions.memoryPool = leafPool_.get();
+  writerOptions.encryptionProperties =
+      FileEncryptionProperties::Builder(footerKey)
+          .footer_key_metadata("footer")
+          ->build();
+  auto writer = std::make_unique<facebook::velox::parquet::Writer>(
+      std::move(sink), writerOptions, rootPool_, schema);
+  writer->write(data);
+  writer->close();
+  dwio::common::ReaderOptions readerOptions{leafPool_.get()};
+  VELOX_ASSERT_THROW(
+      createReaderInMemory(*sinkPtr, readerOptions),
+      "The footer key of the encrypted Parquet file is missing");
+}
+
 TEST_F(ParquetWriterTest, toggleDataPageVersion) {
   auto schema = ROW({"c0"}, {INTEGER()});
   const int64_t kRows = 1;
@@ -17,6 +17,7 @@
 #include "velox/dwio/parquet/writer/Writer.h"
 #include <arrow/c/bridge.h>
 #include <arrow/io/interfaces.h>
+#include <arrow/memory_pool.h>
 #include <arrow/table.h>
 #include "velox/common/base/Pointers.h"
 #include "velox/common/config/Config.h"
@@ -97,7 +98,111 @@ class ArrowDataBufferSink : public ::arrow::io::OutputStream {
   int64_t bytesFlushed_ = 0;
 };
 
+// Arrow memory pool allocating from a Velox memory pool. The buffers of the
+// Arrow column writers, e.g. pages, levels and dictionaries, are then
+// accounted in the writer's memory pool.
+class ArrowMemoryPool : public ::arrow::MemoryPool {
+ public:
+  explicit ArrowMemoryPool(std::shared_ptr<memory::MemoryPool> pool)
+      : pool_(std::move(pool)) {}
+
+  ::arrow::Status Allocate(int64_t size, int64_t alignment, uint8_t** out)
+      override {
+    ARROW_RETURN_NOT_OK(checkAlignment(alignment));
+    if (size == 0) {
+      *out = zeroSizeArea();
+      return ::arrow::Status::OK();
+    }
+    try {
+      *out = reinterpret_cast<uint8_t*>(pool_->allocate(size));
+    } catch (const VeloxException& e) {
+      return ::arrow::Status::OutOfMemory(e.message());
+    }
+    bytesAllocated_ += size;
+    totalBytesAllocated_ += size;
+    ++numAllocations_;
+    return ::arrow::Status::OK();
+  }
+
+  ::arrow::Status Reallocate(
+      int64_t oldSize,
+      int64_t newSize,
+      int64_t alignment,
+      uint8_t** ptr) override {
+    if (oldSize == 0) {
+      return Allocate(newSize, alignment, ptr);
+    }
+    if (newSize == 0) {
+      Free(*ptr, oldSize, alignment);
+      *ptr = zeroSizeArea();
+      return ::arrow::Status::OK();
+    }
+    ARROW_RETURN_NOT_OK(checkAlignment(alignment));
+    try {
+      *ptr = reinterpret_cast<uint8_t*>(
+          pool_->reallocate(*ptr, oldSize, newSize));
+    } catch (const VeloxException& e) {
+      return ::arrow::Status::OutOfMemory(e.message());
+    }
+    bytesAllocated_ += newSize - oldSize;
+    if (newSize > oldSize) {
+      totalBytesAllocated_ += newSize - oldSize;
+    }
+    ++numAllocations_;
+    return ::arrow::Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size, int64_t /*alignment*/) override {
+    if (size == 0) {
+      return;
+    }
+    pool_->free(buffer, size);
+    bytesAllocated_ -= size;
+  }
+
+  int64_t bytes_allocated() const override {
+    return bytesAllocated_;
+  }
+
+  int64_t total_bytes_allocated() const override {
+    return totalBytesAllocated_;
+  }
+
+  int64_t num_allocations() const override {
+    return numAllocations_;
+  }
+
+  std::string backend_name() const override {
+    return "velox";
+  }
+
+ private:
+  // Zero sized buffers point here, as in the Arrow memory pools.
+  static uint8_t* zeroSizeArea() {
+    alignas(memory::MemoryAllocator::kMaxAlignment) static uint8_t area[1];
+    return area;
+  }
+
+  ::arrow::Status checkAlignment(int64_t alignment) const {
+    if (pool_->alignment() % alignment != 0) {
+      return ::arrow::Status::Invalid(
+          "Alignment ",
+          alignment,
+          " is not supported by memory pool ",
+          pool_->name());
+    }
+    return ::arrow::Status::OK();
+  }
+
+  const std::shared_ptr<memory::MemoryPool> pool_;
+  std::atomic<int64_t> bytesAllocated_{0};
+  std::atomic<int64_t> totalBytesAllocated_{0};
+  std::atomic<int64_t> numAllocations_{0};
+};
+
 struct ArrowContext {
+  // Declared first to outlive the buffers of the other members.
+  std::unique_ptr<ArrowMemoryPool> pool;
   std::unique_ptr<FileWriter> writer;
   std::shared_ptr<::arrow::Schema> schema;
   std::shared_ptr<WriterProperties> properties;
@@ -128,9 +233,11 @@ namespace {
 
 std::shared_ptr<WriterProperties> getArrowParquetWriterOptions(
     const parquet::WriterOptions& options,
-    const std::unique_ptr<DefaultFlushPolicy>& flushPolicy) {
+    const std::unique_ptr<DefaultFlushPolicy>& flushPolicy,
+    ::arrow::MemoryPool* pool) {
   auto builder = WriterProperties::Builder();
   WriterProperties::Builder* properties = &builder;
+  properties = properties->memory_pool(pool);
   if (!options.enableDictionary) {
     properties = properties->disable_dictionary();
   }
@@ -147,6 +254,12 @@ std::shared_ptr<WriterProperties> getArrowParquetWriterOptions(
       static_cast<int64_t>(flushPolicy->rowsInRowGroup()));
   properties = properties->codec_options(options.codecOptions);
   properties = properties->enable_store_decimal_as_integer();
+  if (options.enablePageIndex) {
+    properties = properties->enable_write_page_index();
+  }
+  if (options.encryptionProperties) {
+    properties = properties->encryption(options.encryptionProperties);
+  }
   if (options.useParquetDataPageV2.value_or(false)) {
     properties =
         properties->data_page_version(arrow::ParquetDataPageVersion::V2);
@@ -269,6 +382,7 @@ Writer::Writer(
     RowTypePtr schema)
     : pool_(std::move(pool)),
       generalPool_{pool_->addLeafChild(".general")},
+      arrowPool_{pool_->addLeafChild(".arrow")},
       stream_(std::make_shared<ArrowDataBufferSink>(
           std::move(sink),
           *generalPool_,
@@ -288,8 +402,9 @@ Writer::Writer(
   options_.timestampTimeZone = options.parquetWriteTimestampTimeZone;
   common::testutil::TestValue::adjust(
       "facebook::velox::parquet::Writer::Writer", &options_);
-  arrowContext_->properties =
-      getArrowParquetWriterOptions(options, flushPolicy_);
+  arrowContext_->pool = std::make_unique<ArrowMemoryPool>(arrowPool_);
+  arrowContext_->properties = getArrowParquetWriterOptions(
+      options, flushPolicy_, arrowContext_->pool.get());
   setMemoryReclaimers();
   writeInt96AsTimestamp_ = options.writeInt96AsTimestamp;
 }
@@ -318,7 +433,7 @@ void Writer::flush() {
           arrowContext_->writer,
           FileWriter::Open(
               *arrowContext_->schema.get(),
-              ::arrow::default_memory_pool(),
+              arrowContext_->pool.get(),
               stream_,
               arrowContext_->properties,
               arrowProperties));
@@ -454,6 +569,7 @@ void Writer::setMemoryReclaimers() {
   // TODO https://github.com/facebookincubator/velox/issues/8190
   pool_->setReclaimer(exec::MemoryReclaimer::create());
   generalPool_->setReclaimer(exec::MemoryReclaimer::create());
+  arrowPool_->setReclaimer(exec::MemoryReclaimer::create());
 }
 
 std::unique_ptr<dwio::common::Writer> ParquetWriterFactory::createWriter(
@@ -31,6 +31,10 @@
 
 namespace facebook::velox::parquet {
 
+namespace arrow {
+class FileEncryptionProperties;
+} // namespace arrow
+
 using facebook::velox::parquet::arrow::util::CodecOptions;
 
 class ArrowDataBufferSink;
@@ -109,6 +113,11 @@ struct WriterOptions : public dwio::common::WriterOptions {
   std::optional<std::string> parquetWriteTimestampTimeZone;
   bool writeInt96AsTimestamp = false;
   std::optional<bool> useParquetDataPageV2;
+  /// Writes the ColumnIndex and OffsetIndex of the column chunks. Readers use
+  /// these to skip pages that can't match a filter.
+  bool enablePageIndex = false;
+  /// Encrypts the file with Parquet modular encryption if set.
+  std::shared_ptr<arrow::FileEncryptionProperties> encryptionProperties;
 
   // Parsing session and hive configs.
 
@@ -178,6 +187,8 @@ class Writer : public dwio::common::Writer {
   // Pool for 'stream_'.
   std::shared_ptr<memory::MemoryPool> pool_;
   std::shared_ptr<memory::MemoryPool> generalPool_;
+  // Pool for the buffers of the Arrow column writers.
+  std::shared_ptr<memory::MemoryPool> arrowPool_;
 
   // Temporary Arrow stream for capturing the output.
   std::shared_ptr<ArrowDataBufferSink> stream_;
@@ -222,6 +222,31 @@ class Aggregate {
       const std::vector<VectorPtr>& args,
       bool mayPushdown) = 0;
 
+  // Returns true if raw input added by addSingleGroupRawInput() can be taken
+  // out of the accumulator again with removeSingleGroupRawInput(). Window
+  // frames that slide forward then update the accumulator with the rows
+  // entering and leaving the frame instead of aggregating the frame for each
+  // row.
+  virtual bool supportsRemoveInput() const {
+    return false;
+  }
+
+  // Removes raw input that was added to the single accumulator by
+  // addSingleGroupRawInput(). Called only if supportsRemoveInput() is true.
+  // The accumulator is not required to track whether any non-null input is
+  // left, e.g. sum keeps a 0 after all its input is removed. The caller is
+  // expected to use the result for no input when the remaining input is all
+  // null.
+  // @param group Pointer to the start of the group row.
+  // @param rows Rows of the 'args' to remove from the accumulator.
+  // @param args Raw input to remove from the accumulator.
+  virtual void removeSingleGroupRawInput(
+      char* /*group*/,
+      const SelectivityVector& /*rows*/,
+      const std::vector<VectorPtr>& /*args*/) {
+    VELOX_UNSUPPORTED("removeSingleGroupRawInput not supported");
+  }
+
   // Extracts final results (used for final and single aggregations).
   // @param groups Pointers to the start of the group rows.
   // @param numGroups Number of groups to extract results from.
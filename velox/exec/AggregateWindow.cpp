@@ -66,6 +66,10 @@ class AggregateWindowFunction : public exec::WindowFunction {
         resultType,
         config);
     aggregate_->setAllocator(stringAllocator_);
+    // The accumulator tracks no null state after removals, so the frames
+    // whose first argument is all null are detected by counting nulls here.
+    removeInputSupported_ =
+        aggregate_->supportsRemoveInput() && argIndices_.size() <= 1;
 
     // Aggregate initialization.
     // Row layout is:
@@ -116,6 +120,7 @@ class AggregateWindowFunction : public exec::WindowFunction {
     partition_ = partition;
 
     previousFrameMetadata_.reset();
+    slidingFrame_.reset();
   }
 
   void apply(
@@ -155,6 +160,7 @@ class AggregateWindowFunction : public exec::WindowFunction {
         aggregateInitialized_ = true;
       }
 
+      slidingFrame_.reset();
       fillArgVectors(startRow, frameMetadata.lastRow);
       incrementalAggregation(
           validRows,
@@ -163,7 +169,17 @@ class AggregateWindowFunction : public exec::WindowFunction {
           rawFrameEnds,
           resultOffset,
           result);
+    } else if (removeInputSupported_ && frameMetadata.slidingFrames) {
+      slidingAggregation(
+          validRows,
+          frameMetadata.firstRow,
+          frameMetadata.lastRow,
+          rawFrameStarts,
+          rawFrameEnds,
+          resultOffset,
+          result);
     } else {
+      slidingFrame_.reset();
       fillArgVectors(frameMetadata.firstRow, frameMetadata.lastRow);
       simpleAggregation(
           validRows,
@@ -193,6 +209,17 @@ class AggregateWindowFunction : public exec::WindowFunction {
 
     // Resume incremental aggregation from the prior block.
     bool usePreviousAggregate;
+
+    // If the frame starts and ends are both non-decreasing, then each frame
+    // can be computed from the previous one by adding the rows that enter it
+    // and removing the rows that leave it.
+    bool slidingFrames;
+  };
+
+  // The rows [start, end) of the partition in the accumulator.
+  struct SlidingFrame {
+    vector_size_t start;
+    vector_size_t end;
   };
 
   bool handleAllEmptyFrames(
@@ -223,8 +250,10 @@ class AggregateWindowFunction : public exec::WindowFunction {
     vector_size_t fixedFrameStartRow = firstRow;
     vector_size_t lastRow = rawFrameEnds[firstValidRow];
     vector_size_t prevFrameEnds = lastRow;
+    vector_size_t prevFrameStarts = firstRow;
 
     bool incrementalAggregation = true;
+    bool slidingFrames = true;
     validRows.applyToSelected([&](auto i) {
       firstRow = std::min(firstRow, rawFrameStarts[i]);
       lastRow = std::max(lastRow, rawFrameEnds[i]);
@@ -234,7 +263,10 @@ class AggregateWindowFunction : public exec::WindowFunction {
       // ii) The frame end values are non-decreasing.
       incrementalAggregation &= (rawFrameStarts[i] == fixedFrameStartRow);
       incrementalAggregation &= rawFrameEnds[i] >= prevFrameEnds;
+      slidingFrames &= rawFrameStarts[i] >= prevFrameStarts &&
+          rawFrameEnds[i] >= prevFrameEnds;
       prevFrameEnds = rawFrameEnds[i];
+      prevFrameStarts = rawFrameStarts[i];
     });
 
     bool usePreviousAggregate = false;
@@ -251,7 +283,12 @@ class AggregateWindowFunction : public exec::WindowFunction {
       }
     }
 
-    return {firstRow, lastRow, incrementalAggregation, usePreviousAggregate};
+    return {
+        firstRow,
+        lastRow,
+        incrementalAggregation,
+        usePreviousAggregate,
+        slidingFrames};
   }
 
   void fillArgVectors(vector_size_t firstRow, vector_size_t lastRow) {
@@ -312,6 +349,102 @@ class AggregateWindowFunction : public exec::WindowFunction {
     setEmptyFramesResult(validRows, resultOffset, emptyResult_, result);
   }
 
+  // Computes the aggregate of each frame from the previous frame, which may be
+  // in the previous block, by removing the rows that left the frame and adding
+  // the rows that entered it. This is O(1) per row on average for frames that
+  // slide forward, e.g. ROWS BETWEEN k PRECEDING AND CURRENT ROW.
+  void slidingAggregation(
+      const SelectivityVector& validRows,
+      vector_size_t minFrame,
+      vector_size_t maxFrame,
+      const vector_size_t* frameStartsVector,
+      const vector_size_t* frameEndsVector,
+      vector_size_t resultOffset,
+      const VectorPtr& result) {
+    const auto firstValidRow = validRows.begin();
+    if (slidingFrame_.has_value() &&
+        (frameStartsVector[firstValidRow] < slidingFrame_->start ||
+         frameEndsVector[firstValidRow] + 1 < slidingFrame_->end)) {
+      slidingFrame_.reset();
+    }
+    // The rows of the previous frame that leave it may come before this block.
+    const auto argsStart = slidingFrame_.has_value()
+        ? std::min(slidingFrame_->start, minFrame)
+        : minFrame;
+    fillArgVectors(argsStart, maxFrame);
+
+    SelectivityVector rows;
+    rows.resize(maxFrame + 1 - argsStart);
+    static auto kSingleGroup = std::vector<vector_size_t>{0};
+
+    validRows.applyToSelected([&](auto i) {
+      const auto frameStart = frameStartsVector[i];
+      const auto frameEnd = frameEndsVector[i] + 1;
+      if (!slidingFrame_.has_value() || frameStart >= slidingFrame_->end) {
+        aggregate_->clear();
+        aggregate_->initializeNewGroups(&rawSingleGroupRow_, kSingleGroup);
+        aggregateInitialized_ = true;
+        slidingFrame_ = SlidingFrame{frameStart, frameStart};
+        numNonNullFrameRows_ = 0;
+      }
+      if (frameStart > slidingFrame_->start) {
+        updateSlidingFrame(
+            rows,
+            slidingFrame_->start - argsStart,
+            frameStart - argsStart,
+            /*remove=*/true);
+      }
+      if (frameEnd > slidingFrame_->end) {
+        updateSlidingFrame(
+            rows,
+            slidingFrame_->end - argsStart,
+            frameEnd - argsStart,
+            /*remove=*/false);
+      }
+      slidingFrame_ = SlidingFrame{frameStart, frameEnd};
+
+      if (numNonNullFrameRows_ == 0) {
+        result->copy(emptyResult_.get(), resultOffset + i, 0, 1);
+        return;
+      }
+      BaseVector::prepareForReuse(aggregateResultVector_, 1);
+      aggregate_->extractValues(
+          &rawSingleGroupRow_, 1, &aggregateResultVector_);
+      result->copy(aggregateResultVector_.get(), resultOffset + i, 0, 1);
+    });
+
+    // Set null values for empty (non valid) frames in the output block.
+    setEmptyFramesResult(validRows, resultOffset, emptyResult_, result);
+  }
+
+  // Adds or removes the rows [begin, end) of 'argVectors_' to or from the
+  // accumulator.
+  void updateSlidingFrame(
+      SelectivityVector& rows,
+      vector_size_t begin,
+      vector_size_t end,
+      bool remove) {
+    rows.clearAll();
+    rows.setValidRange(begin, end, true);
+    rows.updateBounds();
+
+    int64_t numNonNullRows = end - begin;
+    if (!argVectors_.empty() && argVectors_[0]->mayHaveNulls()) {
+      rows.applyToSelected([&](auto row) {
+        numNonNullRows -= argVectors_[0]->isNullAt(row);
+      });
+    }
+    if (remove) {
+      aggregate_->removeSingleGroupRawInput(
+          rawSingleGroupRow_, rows, argVectors_);
+      numNonNullFrameRows_ -= numNonNullRows;
+    } else {
+      aggregate_->addSingleGroupRawInput(
+          rawSingleGroupRow_, rows, argVectors_, false);
+      numNonNullFrameRows_ += numNonNullRows;
+    }
+  }
+
   void simpleAggregation(
       const SelectivityVector& validRows,
       vector_size_t minFrame,
@@ -389,6 +522,15 @@ class AggregateWindowFunction : public exec::WindowFunction {
   // to optimize aggregate computation and reading argument vectors.
   std::optional<FrameMetadata> previousFrameMetadata_;
 
+  // True if sliding frames are computed by removing the rows that leave the
+  // frame from the accumulator.
+  bool removeInputSupported_{false};
+
+  // The frame in the accumulator for sliding aggregation and its number of
+  // rows whose first argument is not null.
+  std::optional<SlidingFrame> slidingFrame_;
+  int64_t numNonNullFrameRows_{0};
+
   // Stores default result value for empty frame aggregation. Window functions
   // return the default value of an aggregate (aggregation with no rows) for
   // empty frames. e.g. count for empty frames should return 0 and not null.
@@ -89,7 +89,11 @@ DriverCtx::DriverCtx(
       splitGroupId(_splitGroupId),
       partitionId(_partitionId),
       task(std::move(_task)),
-      threadDebugInfo({task->queryCtx()->queryId(), task->taskId(), nullptr}) {}
+      threadDebugInfo({task->queryCtx()->queryId(), task->taskId(), nullptr}) {
+  if (queryConfig().driverVectorPoolSharingEnabled()) {
+    vectorPoolCache = VectorPool::makeCache();
+  }
+}
 
 const core::QueryConfig& DriverCtx::queryConfig() const {
   return task->queryCtx()->queryConfig();
@@ -117,14 +121,12 @@ std::optional<common::SpillConfig> DriverCtx::makeSpillConfig(
   }
   common::GetSpillDirectoryPathCB getSpillDirPathCb =
       [this]() -> std::string_view {
-    return task->getOrCreateSpillDirectory();
+    return task->getOrCreateTieredSpillDirectory();
   };
   const auto& spillFilePrefix =
       fmt::format("{}_{}_{}", pipelineId, driverId, operatorId);
   common::UpdateAndCheckSpillLimitCB updateAndCheckSpillLimitCb =
-      [this](uint64_t bytes) {
-        task->queryCtx()->updateSpilledBytesAndCheckLimit(bytes);
-      };
+      [this](uint64_t bytes) { task->updateSpilledBytes(bytes); };
   return common::SpillConfig(
       std::move(getSpillDirPathCb),
       std::move(updateAndCheckSpillLimitCb),
@@ -144,7 +146,16 @@ std::optional<common::SpillConfig> DriverCtx::makeSpillConfig(
       queryConfig.spillPrefixSortEnabled()
           ? std::optional<common::PrefixSortConfig>(prefixSortConfig())
           : std::nullopt,
-      queryConfig.spillFileCreateConfig());
+      queryConfig.spillFileCreateConfig(),
+      queryConfig.spillColumnarFormatEnabled(),
+      queryConfig.spillAsyncWriteEnabled(),
+      queryConfig.spillPartitionTargetSize(),
+      queryConfig.spillMergePrefixKeyEnabled(),
+      queryConfig.spillPageRoutingEnabled(),
+      common::SpillIoShare{
+          task->queryCtx()->queryId(), queryConfig.spillIoWeight()},
+      queryConfig.spillChecksumEnabled(),
+      queryConfig.spillEncryptionEnabled());
 }
 
 std::atomic_uint64_t BlockingState::numBlockedDrivers_{0};
@@ -240,8 +251,14 @@ void Driver::enqueue(std::shared_ptr<Driver> driver) {
   if (driver->closed_) {
     return;
   }
-  driver->task()->queryCtx()->executor()->add(
-      [driver]() { Driver::run(driver); });
+  auto* executor = driver->task()->queryCtx()->executor();
+  if (driver->schedulingPriority_.has_value() &&
+      executor->getNumPriorities() > 1) {
+    const auto priority = driver->schedulingPriority_.value();
+    executor->addWithPriority([driver]() { Driver::run(driver); }, priority);
+    return;
+  }
+  executor->add([driver]() { Driver::run(driver); });
 }
 
 void Driver::init(
@@ -250,10 +267,16 @@ void Driver::init(
   VELOX_CHECK_NULL(ctx_);
   ctx_ = std::move(ctx);
   cpuSliceMs_ = task()->driverCpuTimeSliceLimitMs();
+  continueOnReadyFuture_ =
+      ctx_->queryConfig().driverContinueOnReadyFutureEnabled();
+  schedulingPriority_ = ctx_->queryConfig().driverSchedulingPriority();
   VELOX_CHECK(operators_.empty());
   operators_ = std::move(operators);
   curOperatorId_ = operators_.size() - 1;
   trackOperatorCpuUsage_ = ctx_->queryConfig().operatorTrackCpuUsage();
+  trackOperatorPerfCounters_ =
+      ctx_->queryConfig().operatorTrackPerfCounters();
+  reservationCacheBytes_ = ctx_->queryConfig().driverReservationCacheBytes();
 }
 
 void Driver::initializeOperators() {
@@ -362,6 +385,10 @@ void Driver::enqueueInternal() {
     Operator::NonReclaimableSectionGuard nonReclaimableGuard(operatorPtr); \
     RuntimeStatWriterScopeGuard statsWriterGuard(operatorPtr);             \
     threadNumVeloxThrow() = 0;                                             \
+    std::optional<memory::ScopedReservationCache> reservationCache;        \
+    if (reservationCacheBytes_ > 0) {                                      \
+      reservationCache.emplace(reservationCacheBytes_);                    \
+    }                                                                      \
     opCallStatus_.start(operatorId, operatorMethod);                       \
     ExceptionContextSetter exceptionContext(                               \
         {addContextOnException, operatorPtr, true});                       \
@@ -478,6 +505,22 @@ bool Driver::checkUnderArbitration(ContinueFuture* future) {
   return task()->queryCtx()->checkUnderArbitration(future);
 }
 
+bool Driver::continueOnReadyFuture(
+    size_t blockedOperatorId,
+    ContinueFuture& future) {
+  if (!continueOnReadyFuture_ || blockingReason_ == BlockingReason::kYield ||
+      !future.valid() || !future.isReady() ||
+      numReadyFutureContinues_ >= kMaxReadyFutureContinues) {
+    return false;
+  }
+  ++numReadyFutureContinues_;
+  future = ContinueFuture::makeEmpty();
+  blockingReason_ = BlockingReason::kNotBlocked;
+  operators_[blockedOperatorId]->addRuntimeStat(
+      kReadyFutureContinues, RuntimeCounter(1));
+  return true;
+}
+
 StopReason Driver::runInternal(
     std::shared_ptr<Driver>& self,
     std::shared_ptr<BlockingState>& blockingState,
@@ -525,6 +568,7 @@ StopReason Driver::runInternal(
 
     const int32_t numOperators = operators_.size();
     ContinueFuture future = ContinueFuture::makeEmpty();
+    numReadyFutureContinues_ = 0;
 
     for (;;) {
       for (int32_t i = numOperators - 1; i >= 0; --i) {
@@ -570,6 +614,11 @@ StopReason Driver::runInternal(
         });
 
         if (blockingReason_ != BlockingReason::kNotBlocked) {
+          if (continueOnReadyFuture(i, future)) {
+            // Checks 'op' again.
+            ++i;
+            continue;
+          }
           return blockDriver(self, i, std::move(future), blockingState, guard);
         }
 
@@ -584,6 +633,10 @@ StopReason Driver::runInternal(
                 kOpMethodIsBlocked);
           });
           if (blockingReason_ != BlockingReason::kNotBlocked) {
+            if (continueOnReadyFuture(i + 1, future)) {
+              ++i;
+              continue;
+            }
             return blockDriver(
                 self, i + 1, std::move(future), blockingState, guard);
           }
@@ -607,6 +660,9 @@ StopReason Driver::runInternal(
                   kOpMethodGetOutput);
               if (intermediateResult) {
                 validateOperatorOutputResult(intermediateResult, *op);
+                if (auto* batchSizer = op->outputBatchSizer()) {
+                  batchSizer->recordOutput(*intermediateResult);
+                }
                 resultBytes = intermediateResult->estimateFlatSize();
                 {
                   auto lockedStats = op->stats().wlock();
@@ -617,6 +673,9 @@ StopReason Driver::runInternal(
             });
             pushdownFilters(i);
             if (intermediateResult) {
+              auto* batchSizer = op->outputBatchSizer();
+              const uint64_t addInputStartCpuNanos =
+                  batchSizer != nullptr ? process::threadCpuNanos() : 0;
               withDeltaCpuWallTimer(
                   nextOp, &OperatorStats::addInputTiming, [&]() {
                     {
@@ -635,6 +694,10 @@ StopReason Driver::runInternal(
                         curOperatorId_ + 1,
                         kOpMethodAddInput);
                   });
+              if (batchSizer != nullptr) {
+                batchSizer->recordDownstreamCpu(
+                    process::threadCpuNanos() - addInputStartCpuNanos);
+              }
               // The next iteration will see if operators_[i + 1] has
               // output now that it got input.
               i += 2;
@@ -659,6 +722,10 @@ StopReason Driver::runInternal(
                     kOpMethodIsBlocked);
               });
               if (blockingReason_ != BlockingReason::kNotBlocked) {
+                if (continueOnReadyFuture(i, future)) {
+                  ++i;
+                  continue;
+                }
                 return blockDriver(
                     self, i, std::move(future), blockingState, guard);
               }
@@ -700,6 +767,9 @@ StopReason Driver::runInternal(
                 kOpMethodGetOutput);
             if (result) {
               validateOperatorOutputResult(result, *op);
+              if (auto* batchSizer = op->outputBatchSizer()) {
+                batchSizer->recordOutput(*result);
+              }
 
               {
                 auto lockedStats = op->stats().wlock();
@@ -1039,24 +1109,57 @@ void Driver::withDeltaCpuWallTimer(
     Operator* op,
     TimingMemberPtr opTimingMember,
     Func&& opFunction) {
+  process::ThreadPerfCounters* perfCounters{nullptr};
+  process::PerfCounts perfCountsBefore;
+  if (trackOperatorPerfCounters_) {
+    perfCounters = process::ThreadPerfCounters::get();
+    if (perfCounters != nullptr && !perfCounters->read(perfCountsBefore)) {
+      perfCounters = nullptr;
+    }
+  }
+
   // If 'trackOperatorCpuUsage_' is true, create and initialize the timer object
   // to track cpu and wall time of the opFunction.
   if (!trackOperatorCpuUsage_) {
-    return opFunction();
+    opFunction();
+  } else {
+    // The delta CpuWallTiming object would be recorded to the corresponding
+    // opTimingMember upon destruction of the timer when withDeltaCpuWallTimer
+    // ends. The timer is created on the stack to avoid heap allocation
+    auto f = [op, opTimingMember, this](const CpuWallTiming& elapsedTime) {
+      auto elapsedSelfTime = processLazyIoStats(*op, elapsedTime);
+      op->stats().withWLock([&](auto& lockedStats) {
+        (lockedStats.*opTimingMember).add(elapsedSelfTime);
+      });
+    };
+    DeltaCpuWallTimer<decltype(f)> timer(std::move(f));
+
+    opFunction();
   }
 
-  // The delta CpuWallTiming object would be recorded to the corresponding
-  // opTimingMember upon destruction of the timer when withDeltaCpuWallTimer
-  // ends. The timer is created on the stack to avoid heap allocation
-  auto f = [op, opTimingMember, this](const CpuWallTiming& elapsedTime) {
-    auto elapsedSelfTime = processLazyIoStats(*op, elapsedTime);
-    op->stats().withWLock([&](auto& lockedStats) {
-      (lockedStats.*opTimingMember).add(elapsedSelfTime);
-    });
-  };
-  DeltaCpuWallTimer<decltype(f)> timer(std::move(f));
+  if (perfCounters != nullptr) {
+    recordPerfCounts(*op, *perfCounters, perfCountsBefore);
+  }
+}
 
-  opFunction();
+void Driver::recordPerfCounts(
+    Operator& op,
+    const process::ThreadPerfCounters& perfCounters,
+    const process::PerfCounts& before) {
+  process::PerfCounts after;
+  if (!perfCounters.read(after)) {
+    return;
+  }
+  const auto delta = after - before;
+  op.stats().withWLock([&](auto& lockedStats) {
+    lockedStats.addRuntimeStat(kPerfCycles, RuntimeCounter(delta.cycles));
+    lockedStats.addRuntimeStat(
+        kPerfInstructions, RuntimeCounter(delta.instructions));
+    lockedStats.addRuntimeStat(
+        kPerfCacheMisses, RuntimeCounter(delta.cacheMisses));
+    lockedStats.addRuntimeStat(
+        kPerfBranchMisses, RuntimeCounter(delta.branchMisses));
+  });
 }
 
 void Driver::validateOperatorOutputResult(
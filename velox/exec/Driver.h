@@ -25,6 +25,7 @@
 #include "velox/common/base/Counters.h"
 #include "velox/common/base/StatsReporter.h"
 #include "velox/common/base/TraceConfig.h"
+#include "velox/common/process/PerfCounters.h"
 #include "velox/common/time/CpuWallTimer.h"
 #include "velox/core/PlanFragment.h"
 #include "velox/core/QueryCtx.h"
@@ -285,6 +286,9 @@ struct DriverCtx {
   /// auxiliary operator such as the aggregation operator used by the table
   /// writer to generate the columns stats.
   std::unordered_map<int32_t, std::string> tracedOperatorMap;
+  /// The recycled vectors shared by the vector pools of the operators of this
+  /// driver. Set if driver vector pool sharing is enabled.
+  std::shared_ptr<VectorPool::Cache> vectorPoolCache;
 
   DriverCtx(
       std::shared_ptr<Task> _task,
@@ -412,6 +416,18 @@ class Driver : public std::enable_shared_from_this<Driver> {
   /// memory arbitration finishes.
   bool checkUnderArbitration(ContinueFuture* future);
 
+  /// The runtime stat counting the times an operator was blocked on a future
+  /// that was already realized and the Driver stayed on thread.
+  static inline const std::string kReadyFutureContinues{
+      "readyFutureContinues"};
+
+  /// The runtime stats of the hardware events counted during the calls of an
+  /// operator if QueryConfig::operatorTrackPerfCounters() is true.
+  static inline const std::string kPerfCycles{"perfCycles"};
+  static inline const std::string kPerfInstructions{"perfInstructions"};
+  static inline const std::string kPerfCacheMisses{"perfCacheMisses"};
+  static inline const std::string kPerfBranchMisses{"perfBranchMisses"};
+
   void initializeOperatorStats(std::vector<OperatorStats>& stats);
 
   /// Close operators and add operator stats to the task.
@@ -541,6 +557,13 @@ class Driver : public std::enable_shared_from_this<Driver> {
       TimingMemberPtr opTimingMember,
       Func&& opFunction);
 
+  // Adds the hardware events counted by 'perfCounters' since 'before' to the
+  // runtime stats of 'op'.
+  void recordPerfCounts(
+      Operator& op,
+      const process::ThreadPerfCounters& perfCounters,
+      const process::PerfCounts& before);
+
   // Adjusts 'timing' by removing the lazy load wall time, CPU time, and input
   // bytes accrued since last time timing information was recorded for 'op'. The
   // accrued lazy load times are credited to the source operator of 'this'. The
@@ -564,8 +587,32 @@ class Driver : public std::enable_shared_from_this<Driver> {
   // If not zero, specifies the driver cpu time slice.
   size_t cpuSliceMs_{0};
 
+  // The most times the Driver continues on thread after an operator returned
+  // a realized future, so that one that keeps doing so cannot hold the thread.
+  static constexpr int32_t kMaxReadyFutureContinues = 100;
+
+  // Returns true if 'future', on which the operator at 'blockedOperatorId' is
+  // blocked, is already realized and the Driver can check the operator again
+  // instead of going off thread and being enqueued again. Clears 'future' and
+  // 'blockingReason_' if so. Not used for kYield.
+  bool continueOnReadyFuture(size_t blockedOperatorId, ContinueFuture& future);
+
+  // True if QueryConfig::driverContinueOnReadyFutureEnabled() is set.
+  bool continueOnReadyFuture_{false};
+
+  // The number of continueOnReadyFuture() calls that returned true since the
+  // Driver went on thread.
+  int32_t numReadyFutureContinues_{0};
+
+  // If set, the priority the Driver is added to the executor with.
+  std::optional<int8_t> schedulingPriority_;
+
   bool operatorsInitialized_{false};
 
+  // If not zero, the bytes of memory reservation cached per operator pool
+  // during each operator call. See ScopedReservationCache.
+  int64_t reservationCacheBytes_{0};
+
   std::atomic_bool closed_{false};
 
   OpCallStatus opCallStatus_;
@@ -587,6 +634,9 @@ class Driver : public std::enable_shared_from_this<Driver> {
 
   bool trackOperatorCpuUsage_;
 
+  // True if the hardware events of the operator calls are counted.
+  bool trackOperatorPerfCounters_{false};
+
   // Indicates that a DriverAdapter can rearrange Operators. Set to false at end
   // of DriverFactory::createDriver().
   bool isAdaptable_{true};
@@ -721,6 +771,19 @@ struct DriverFactory {
     return false;
   }
 
+  /// Returns true if the pipeline produces into a local exchange. The function
+  /// sets the plan node id of the exchange in 'planNodeId'.
+  bool outputsToLocalExchange(core::PlanNodeId& planNodeId) const {
+    VELOX_CHECK(!planNodes.empty());
+    if (auto exchangeNode =
+            std::dynamic_pointer_cast<const core::LocalPartitionNode>(
+                planNodes.back())) {
+      planNodeId = exchangeNode->id();
+      return true;
+    }
+    return false;
+  }
+
   /// Returns plan node IDs for which Hash Join Bridges must be created based
   /// on this pipeline.
   std::vector<core::PlanNodeId> needsHashJoinBridges() const;
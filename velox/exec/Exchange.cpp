@@ -23,14 +23,25 @@ namespace {
 std::unique_ptr<VectorSerde::Options> getVectorSerdeOptions(
     const core::QueryConfig& queryConfig,
     VectorSerde::Kind kind) {
-  std::unique_ptr<VectorSerde::Options> options =
-      kind == VectorSerde::Kind::kPresto
-      ? std::make_unique<serializer::presto::PrestoVectorSerde::PrestoOptions>()
-      : std::make_unique<VectorSerde::Options>();
+  std::unique_ptr<VectorSerde::Options> options;
+  if (kind == VectorSerde::Kind::kPresto) {
+    auto prestoOptions =
+        std::make_unique<serializer::presto::PrestoVectorSerde::PrestoOptions>();
+    prestoOptions->zeroCopyDeserialize =
+        queryConfig.exchangeZeroCopyDeserializationEnabled();
+    options = std::move(prestoOptions);
+  } else {
+    options = std::make_unique<VectorSerde::Options>();
+  }
   options->compressionKind =
       common::stringToCompressionKind(queryConfig.shuffleCompressionKind());
   return options;
 }
+
+// The bounds of the estimated deserialized bytes per serialized byte, which
+// keep a few outlier batches from making the next ones tiny or huge.
+constexpr double kMinOutputBytesPerInputByte{0.25};
+constexpr double kMaxOutputBytesPerInputByte{16};
 } // namespace
 
 Exchange::Exchange(
@@ -45,8 +56,10 @@ Exchange::Exchange(
           operatorId,
           exchangeNode->id(),
           operatorType),
-      preferredOutputBatchBytes_{
-          driverCtx->queryConfig().preferredOutputBatchBytes()},
+      adaptiveBatchSize_{
+          driverCtx->queryConfig().exchangeAdaptiveBatchSizeEnabled()},
+      streamingDeserialization_{
+          driverCtx->queryConfig().exchangeStreamingDeserializationEnabled()},
       serdeKind_{exchangeNode->serdeKind()},
       serdeOptions_{getVectorSerdeOptions(
           operatorCtx_->driverCtx()->queryConfig(),
@@ -112,7 +125,7 @@ BlockingReason Exchange::isBlocked(ContinueFuture* future) {
 
   ContinueFuture dataFuture;
   currentPages_ = exchangeClient_->next(
-      driverId_, preferredOutputBatchBytes_, &atEnd_, &dataFuture);
+      driverId_, maxInputBatchBytes(), &atEnd_, &dataFuture);
   if (!currentPages_.empty() || atEnd_) {
     if (atEnd_ && noMoreSplits_) {
       const auto numSplits = stats_.rlock()->numSplits;
@@ -150,22 +163,39 @@ RowVectorPtr Exchange::getOutput() {
   uint64_t rawInputBytes{0};
   vector_size_t resultOffset = 0;
   if (getSerde()->supportsAppendInDeserialize()) {
-    for (const auto& page : currentPages_) {
-      rawInputBytes += page->size();
-
-      auto inputStream = page->prepareStreamForDeserialize();
+    bool batchFull = false;
+    while (currentPageIndex_ < currentPages_.size() && !batchFull) {
+      if (currentInputStream_ == nullptr) {
+        currentInputStream_ =
+            currentPages_[currentPageIndex_]->prepareStreamForDeserialize();
+      }
 
-      while (!inputStream->atEnd()) {
+      while (!currentInputStream_->atEnd() && !batchFull) {
+        const auto startPosition = currentInputStream_->tellp();
         getSerde()->deserialize(
-            inputStream.get(),
+            currentInputStream_.get(),
             pool(),
             outputType_,
             &result_,
             resultOffset,
             serdeOptions_.get());
+        rawInputBytes += currentInputStream_->tellp() - startPosition;
         resultOffset = result_->size();
+        batchFull = streamingDeserialization_ &&
+            result_->estimateFlatSize() >= outputBatchBytes();
+      }
+
+      if (currentInputStream_->atEnd()) {
+        // Releases the page as soon as it is consumed.
+        currentInputStream_.reset();
+        currentPages_[currentPageIndex_].reset();
+        ++currentPageIndex_;
       }
     }
+    if (currentPageIndex_ == currentPages_.size()) {
+      currentPages_.clear();
+      currentPageIndex_ = 0;
+    }
   } else {
     VELOX_CHECK(
         getSerde()->kind() == VectorSerde::Kind::kCompactRow ||
@@ -193,21 +223,49 @@ RowVectorPtr Exchange::getOutput() {
     // We expect the row-wise deserialization to consume all the input into one
     // output vector.
     VELOX_CHECK(inputStream->atEnd());
+    currentPages_.clear();
   }
-  currentPages_.clear();
 
+  const auto outputBytes = result_->estimateFlatSize();
+  updateBatchSizeEstimate(rawInputBytes, outputBytes);
   {
     auto lockedStats = stats_.wlock();
     lockedStats->rawInputBytes += rawInputBytes;
     lockedStats->rawInputPositions += result_->size();
-    lockedStats->addInputVector(result_->estimateFlatSize(), result_->size());
+    lockedStats->addInputVector(outputBytes, result_->size());
   }
 
   return result_;
 }
 
+uint32_t Exchange::maxInputBatchBytes() const {
+  const uint64_t outputBytes = outputBatchBytes();
+  uint64_t maxBytes = outputBytes;
+  if (outputBytesPerInputByte_ > 0) {
+    maxBytes = std::max<uint64_t>(1, outputBytes / outputBytesPerInputByte_);
+  }
+  return std::min<uint64_t>(maxBytes, std::numeric_limits<uint32_t>::max());
+}
+
+void Exchange::updateBatchSizeEstimate(
+    uint64_t inputBytes,
+    uint64_t outputBytes) {
+  if (!adaptiveBatchSize_ || inputBytes == 0) {
+    return;
+  }
+  const auto ratio = std::clamp(
+      static_cast<double>(outputBytes) / inputBytes,
+      kMinOutputBytesPerInputByte,
+      kMaxOutputBytesPerInputByte);
+  // Averages with the previous estimate to smooth out batch to batch noise.
+  outputBytesPerInputByte_ = outputBytesPerInputByte_ == 0
+      ? ratio
+      : (outputBytesPerInputByte_ + ratio) / 2;
+}
+
 void Exchange::close() {
   SourceOperator::close();
+  currentInputStream_.reset();
   currentPages_.clear();
   result_ = nullptr;
   if (exchangeClient_) {
@@ -78,7 +78,22 @@ class Exchange : public SourceOperator {
   // operator's stats.
   void recordExchangeClientStats();
 
-  const uint64_t preferredOutputBatchBytes_;
+  // Returns the max serialized bytes of the pages to deserialize into one
+  // output batch.
+  uint32_t maxInputBatchBytes() const;
+
+  // Updates 'outputBytesPerInputByte_' with the 'outputBytes' deserialized
+  // from 'inputBytes'.
+  void updateBatchSizeEstimate(uint64_t inputBytes, uint64_t outputBytes);
+
+  // True if the serialized bytes of an output batch adapt to the
+  // deserialization ratio of the previous batches.
+  const bool adaptiveBatchSize_;
+
+  // True if getOutput() returns as soon as the deserialized rows reach
+  // outputBatchBytes() and deserializes the rest of 'currentPages_'
+  // in the next calls.
+  const bool streamingDeserialization_;
 
   const VectorSerde::Kind serdeKind_;
 
@@ -102,7 +117,14 @@ class Exchange : public SourceOperator {
   RowVectorPtr result_;
 
   std::vector<std::unique_ptr<SerializedPage>> currentPages_;
+  // The page of 'currentPages_' being deserialized and its input stream. The
+  // pages before it are consumed and released.
+  size_t currentPageIndex_{0};
+  std::unique_ptr<ByteInputStream> currentInputStream_;
   bool atEnd_{false};
+  // The estimated deserialized bytes per serialized byte of the received
+  // pages. 0 until the first batch is deserialized.
+  double outputBytesPerInputByte_{0};
   std::default_random_engine rng_{std::random_device{}()};
 };
 
@@ -71,7 +71,7 @@ void ExchangeClient::noMoreRemoteTasks() {
 
 void ExchangeClient::close() {
   std::vector<std::shared_ptr<ExchangeSource>> sources;
-  std::queue<ProducingSource> producingSources;
+  std::deque<ProducingSource> producingSources;
   std::queue<std::shared_ptr<ExchangeSource>> emptySources;
   {
     std::lock_guard<std::mutex> l(queue_->mutex());
@@ -195,12 +195,15 @@ void ExchangeClient::request(std::vector<RequestSpec>&& requestSpecs) {
                 }
                 if (!response.atEnd) {
                   if (!response.remainingBytes.empty()) {
+                    int64_t totalRemainingBytes = 0;
                     for (auto bytes : response.remainingBytes) {
                       VELOX_CHECK_GT(bytes, 0);
+                      totalRemainingBytes += bytes;
                     }
-                    self->producingSources_.push(
+                    self->producingSources_.push_back(
                         {std::move(spec.source),
-                         std::move(response.remainingBytes)});
+                         std::move(response.remainingBytes),
+                         totalRemainingBytes});
                   } else {
                     self->emptySources_.push(std::move(spec.source));
                   }
@@ -241,6 +244,10 @@ ExchangeClient::pickSourcesToRequestLocked() {
   }
   int64_t availableSpace =
       maxQueuedBytes_ - queue_->totalBytes() - totalPendingBytes_;
+  if (prioritizeBufferedSources_) {
+    pickBufferedSourcesLocked(availableSpace, requestSpecs);
+    availableSpace = 0;
+  }
   while (availableSpace > 0 && !producingSources_.empty()) {
     auto& source = producingSources_.front().source;
     int64_t requestBytes = 0;
@@ -257,7 +264,7 @@ ExchangeClient::pickSourcesToRequestLocked() {
     }
     VELOX_CHECK(source->shouldRequestLocked());
     requestSpecs.push_back({std::move(source), requestBytes});
-    producingSources_.pop();
+    producingSources_.pop_front();
     totalPendingBytes_ += requestBytes;
   }
   if (queue_->totalBytes() == 0 && totalPendingBytes_ == 0 &&
@@ -270,12 +277,47 @@ ExchangeClient::pickSourcesToRequestLocked() {
               << " bytes, exceeding capacity " << maxQueuedBytes_;
     VELOX_CHECK(source->shouldRequestLocked());
     requestSpecs.push_back({std::move(source), requestBytes});
-    producingSources_.pop();
+    producingSources_.pop_front();
     totalPendingBytes_ += requestBytes;
   }
   return requestSpecs;
 }
 
+void ExchangeClient::pickBufferedSourcesLocked(
+    int64_t availableSpace,
+    std::vector<RequestSpec>& requestSpecs) {
+  if (availableSpace <= 0 || producingSources_.empty()) {
+    return;
+  }
+  std::stable_sort(
+      producingSources_.begin(),
+      producingSources_.end(),
+      [](const ProducingSource& left, const ProducingSource& right) {
+        return left.totalRemainingBytes > right.totalRemainingBytes;
+      });
+  const int64_t share = availableSpace / producingSources_.size();
+  std::deque<ProducingSource> notRequested;
+  for (auto& producing : producingSources_) {
+    int64_t requestBytes = 0;
+    for (auto bytes : producing.remainingBytes) {
+      if (requestBytes + bytes > availableSpace ||
+          (requestBytes > 0 && requestBytes + bytes > share)) {
+        break;
+      }
+      requestBytes += bytes;
+    }
+    if (requestBytes == 0) {
+      notRequested.push_back(std::move(producing));
+      continue;
+    }
+    VELOX_CHECK(producing.source->shouldRequestLocked());
+    requestSpecs.push_back({std::move(producing.source), requestBytes});
+    availableSpace -= requestBytes;
+    totalPendingBytes_ += requestBytes;
+  }
+  producingSources_ = std::move(notRequested);
+}
+
 ExchangeClient::~ExchangeClient() {
   close();
 }
@@ -36,10 +36,12 @@ class ExchangeClient : public std::enable_shared_from_this<ExchangeClient> {
       int32_t numberOfConsumers,
       uint64_t minOutputBatchBytes,
       memory::MemoryPool* pool,
-      folly::Executor* executor)
+      folly::Executor* executor,
+      bool prioritizeBufferedSources = false)
       : taskId_{std::move(taskId)},
         destination_(destination),
         maxQueuedBytes_{maxQueuedBytes},
+        prioritizeBufferedSources_{prioritizeBufferedSources},
         pool_(pool),
         executor_(executor),
         queue_(std::make_shared<ExchangeQueue>(
@@ -113,16 +115,28 @@ class ExchangeClient : public std::enable_shared_from_this<ExchangeClient> {
   struct ProducingSource {
     std::shared_ptr<ExchangeSource> source;
     std::vector<int64_t> remainingBytes;
+    // Sum of 'remainingBytes'.
+    int64_t totalRemainingBytes;
   };
 
   std::vector<RequestSpec> pickSourcesToRequestLocked();
 
+  // Adds requests for up to 'availableSpace' bytes from 'producingSources_'
+  // to 'requestSpecs' if 'prioritizeBufferedSources_' is true. The sources
+  // with the most buffered bytes go first. Each source gets up to an equal
+  // share of 'availableSpace', but at least its first page, so that the
+  // requests in flight are spread over the sources.
+  void pickBufferedSourcesLocked(
+      int64_t availableSpace,
+      std::vector<RequestSpec>& requestSpecs);
+
   void request(std::vector<RequestSpec>&& requestSpecs);
 
   // Handy for ad-hoc logging.
   const std::string taskId_;
   const int destination_;
   const int64_t maxQueuedBytes_;
+  const bool prioritizeBufferedSources_;
   memory::MemoryPool* const pool_;
   folly::Executor* const executor_;
   const std::shared_ptr<ExchangeQueue> queue_;
@@ -136,7 +150,7 @@ class ExchangeClient : public std::enable_shared_from_this<ExchangeClient> {
 
   // A queue of sources that have returned non-empty response from the latest
   // request.
-  std::queue<ProducingSource> producingSources_;
+  std::deque<ProducingSource> producingSources_;
   // A queue of sources that returned empty response from the latest request.
   std::queue<std::shared_ptr<ExchangeSource>> emptySources_;
 };
@@ -22,10 +22,16 @@ SerializedPage::SerializedPage(
     std::unique_ptr<folly::IOBuf> iobuf,
     std::function<void(folly::IOBuf&)> onDestructionCb,
     std::optional<int64_t> numRows)
-    : iobuf_(std::move(iobuf)),
+    : iobuf_(
+          iobuf.release(),
+          [onDestructionCb = std::move(onDestructionCb)](folly::IOBuf* iobuf) {
+            if (onDestructionCb) {
+              onDestructionCb(*iobuf);
+            }
+            delete iobuf;
+          }),
       iobufBytes_(chainBytes(*iobuf_.get())),
-      numRows_(numRows),
-      onDestructionCb_(onDestructionCb) {
+      numRows_(numRows) {
   VELOX_CHECK_NOT_NULL(iobuf_);
   for (auto& buf : *iobuf_) {
     int32_t bufSize = buf.size();
@@ -36,14 +42,10 @@ SerializedPage::SerializedPage(
   }
 }
 
-SerializedPage::~SerializedPage() {
-  if (onDestructionCb_) {
-    onDestructionCb_(*iobuf_.get());
-  }
-}
+SerializedPage::~SerializedPage() = default;
 
 std::unique_ptr<ByteInputStream> SerializedPage::prepareStreamForDeserialize() {
-  return std::make_unique<BufferInputStream>(std::move(ranges_));
+  return std::make_unique<BufferInputStream>(std::move(ranges_), iobuf_);
 }
 
 void ExchangeQueue::noMoreSources() {
@@ -23,7 +23,10 @@ namespace facebook::velox::exec {
 /// in Presto wire format.
 class SerializedPage {
  public:
-  /// Construct from IOBuf chain.
+  /// Construct from IOBuf chain. 'onDestructionCb' is called once the IOBuf
+  /// is no longer referenced, primarily to free externally allocated memory
+  /// backing the IOBuf. The caller is responsible to pass in proper cleanup
+  /// logic to prevent any memory leak.
   explicit SerializedPage(
       std::unique_ptr<folly::IOBuf> iobuf,
       std::function<void(folly::IOBuf&)> onDestructionCb = nullptr,
@@ -41,7 +44,9 @@ class SerializedPage {
   }
 
   /// Makes 'input' ready for deserializing 'this' with
-  /// VectorStreamGroup::read().
+  /// VectorStreamGroup::read(). The stream holds on to the memory of 'this',
+  /// so that the deserialized vectors may reference it, see
+  /// ByteInputStream::memoryOwner().
   std::unique_ptr<ByteInputStream> prepareStreamForDeserialize();
 
   std::unique_ptr<folly::IOBuf> getIOBuf() const {
@@ -60,20 +65,16 @@ class SerializedPage {
   // Buffers containing the serialized data. The memory is owned by 'iobuf_'.
   std::vector<ByteRange> ranges_;
 
-  // IOBuf holding the data in 'ranges_.
-  std::unique_ptr<folly::IOBuf> iobuf_;
+  // IOBuf holding the data in 'ranges_. It is shared with the streams
+  // returned by prepareStreamForDeserialize() and invokes the destruction
+  // callback when the last of them is gone.
+  std::shared_ptr<folly::IOBuf> iobuf_;
 
   // Number of payload bytes in 'iobuf_'.
   const int64_t iobufBytes_;
 
   // Number of payload rows, if provided.
   const std::optional<int64_t> numRows_;
-
-  // Callback that will be called on destruction of the SerializedPage,
-  // primarily used to free externally allocated memory backing folly::IOBuf
-  // from caller. Caller is responsible to pass in proper cleanup logic to
-  // prevent any memory leak.
-  std::function<void(folly::IOBuf&)> onDestructionCb_;
 };
 
 /// Queue of results retrieved from source. Owned by shared_ptr by
@@ -97,6 +97,22 @@ void FilterProject::initialize() {
       }
     }
   }
+
+  compactionSelectivity_ =
+      operatorCtx_->driverCtx()->queryConfig().filterCompactionSelectivity();
+  if (hasFilter_ && compactionSelectivity_ > 0) {
+    const auto inputType = project_ ? project_->sources()[0]->outputType()
+                                    : filter_->sources()[0]->outputType();
+    compactedChannels_.resize(inputType->size(), false);
+    for (const auto& projection : identityProjections_) {
+      compactedChannels_[projection.inputChannel] = true;
+    }
+    for (auto i = 1; i < numExprs_; ++i) {
+      for (auto* field : exprs_->expr(i)->distinctFields()) {
+        compactedChannels_[inputType->getChildIdx(field->name())] = true;
+      }
+    }
+  }
   filter_.reset();
   project_.reset();
 }
@@ -157,6 +173,11 @@ RowVectorPtr FilterProject::getOutput() {
 
   bool allRowsSelected = (numOut == size);
 
+  if (!allRowsSelected && shouldCompact(numOut)) {
+    rows->setFromBits(filterEvalCtx_.selectedBits->as<uint64_t>(), size);
+    return compactAndProject(numOut, *rows, evalCtx);
+  }
+
   // evaluate projections (if present)
   std::vector<VectorPtr> results;
   if (!isIdentityProjection_) {
@@ -181,6 +202,46 @@ std::vector<VectorPtr> FilterProject::project(
   return results;
 }
 
+bool FilterProject::shouldCompact(vector_size_t numOut) const {
+  return numOut < compactionSelectivity_ * input_->size();
+}
+
+RowVectorPtr FilterProject::compactAndProject(
+    vector_size_t numOut,
+    const SelectivityVector& rows,
+    EvalCtx& evalCtx) {
+  const auto& indices = filterEvalCtx_.selectedIndices;
+  const auto* rawIndices = indices->as<vector_size_t>();
+  LocalSelectivityVector localOutRows(*operatorCtx_->execCtx(), numOut);
+  auto* outRows = localOutRows.get();
+  outRows->setAll();
+
+  std::vector<VectorPtr> children(input_->childrenSize());
+  for (auto i = 0; i < children.size(); ++i) {
+    if (!compactedChannels_[i]) {
+      // Not read after the filter.
+      children[i] = BaseVector::wrapInDictionary(
+          nullptr, indices, numOut, input_->childAt(i));
+      continue;
+    }
+    const auto source = evalCtx.ensureFieldLoaded(i, rows);
+    children[i] = BaseVector::create(source->type(), numOut, pool());
+    children[i]->copy(source.get(), *outRows, rawIndices);
+  }
+  input_ = std::make_shared<RowVector>(
+      pool(), input_->type(), nullptr, numOut, std::move(children));
+  addRuntimeStat(kNumCompactedBatches, RuntimeCounter(1));
+
+  std::vector<VectorPtr> results;
+  if (!isIdentityProjection_) {
+    EvalCtx compactedCtx(operatorCtx_->execCtx(), exprs_.get(), input_.get());
+    exprs_->eval(1, numExprs_, true, *outRows, compactedCtx, results);
+  }
+  auto output = fillOutput(numOut, nullptr, results);
+  input_ = nullptr;
+  return output;
+}
+
 vector_size_t FilterProject::filter(
     EvalCtx& evalCtx,
     const SelectivityVector& allRows) {
@@ -73,6 +73,10 @@ class FilterProject : public Operator {
 
   void initialize() override;
 
+  /// Runtime stat with the number of batches whose passing rows were copied
+  /// to dense vectors before the projections.
+  static inline const std::string kNumCompactedBatches{"numCompactedBatches"};
+
  private:
   // Tests if 'numProcessedRows_' equals to the length of input_ and clears
   // outstanding references to input_ if done. Returns true if getOutput
@@ -92,6 +96,18 @@ class FilterProject : public Operator {
       const SelectivityVector& rows,
       EvalCtx& evalCtx);
 
+  // Returns true if the 'numOut' passing rows of 'input_' are to be copied to
+  // dense vectors before evaluating the projections.
+  bool shouldCompact(vector_size_t numOut) const;
+
+  // Copies the passing rows of the output and projected columns of 'input_'
+  // to dense vectors, evaluates the projections on them and returns the
+  // output. 'rows' are the passing rows.
+  RowVectorPtr compactAndProject(
+      vector_size_t numOut,
+      const SelectivityVector& rows,
+      EvalCtx& evalCtx);
+
   // If true exprs_[0] is a filter and the other expressions are projections
   const bool hasFilter_{false};
 
@@ -117,5 +133,12 @@ class FilterProject : public Operator {
   // will load c1 only for rows where f(c0) is true. However, c1 identity
   // projection needs all rows.
   std::vector<column_index_t> multiplyReferencedFieldIndices_;
+
+  // See QueryConfig::filterCompactionSelectivity().
+  double compactionSelectivity_{0};
+
+  // True for the input columns that are in the output or referenced by a
+  // projection. These are copied when compacting the passing rows.
+  std::vector<bool> compactedChannels_;
 };
 } // namespace facebook::velox::exec
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "velox/exec/GroupingSet.h"
+#include "velox/common/base/AsyncSource.h"
 #include "velox/common/testutil/TestValue.h"
 #include "velox/exec/Task.h"
 
@@ -73,7 +74,13 @@ GroupingSet::GroupingSet(
       rows_(operatorCtx->pool()),
       isAdaptive_(queryConfig_.hashAdaptivityEnabled()),
       pool_(*operatorCtx->pool()),
-      spillStats_(spillStats) {
+      spillStats_(spillStats),
+      outputExecutor_(
+          !isPartial_ && queryConfig_.aggregationParallelOutputBatches() > 1
+              ? operatorCtx->task()->queryCtx()->executor()
+              : nullptr),
+      numParallelOutputBatches_(
+          queryConfig_.aggregationParallelOutputBatches()) {
   VELOX_CHECK_NOT_NULL(nonReclaimableSection_);
   VELOX_CHECK(pool_.trackUsage());
 
@@ -260,6 +267,10 @@ void GroupingSet::addInputForActiveRows(
 
   auto* groups = lookup_->hits.data();
   const auto& newGroups = lookup_->newGroups;
+  // If all rows are in one group, the aggregates are updated as for a global
+  // aggregation, which accumulates into a single accumulator without loading
+  // a group for each row.
+  char* singleGroup = singleGroupOfInput();
 
   for (auto i = 0; i < aggregates_.size(); ++i) {
     if (!aggregates_[i].sortingKeys.empty()) {
@@ -295,7 +306,15 @@ void GroupingSet::addInputForActiveRows(
     // this.
     const bool canPushdown = (&rows == &activeRows_) && mayPushdown &&
         mayPushdown_[i] && areAllLazyNotLoaded(tempVectors_);
-    if (isRawInput_) {
+    if (singleGroup != nullptr) {
+      if (isRawInput_) {
+        function->addSingleGroupRawInput(
+            singleGroup, rows, tempVectors_, canPushdown);
+      } else {
+        function->addSingleGroupIntermediateResults(
+            singleGroup, rows, tempVectors_, canPushdown);
+      }
+    } else if (isRawInput_) {
       function->addRawInput(groups, rows, tempVectors_, canPushdown);
     } else {
       function->addIntermediateResults(groups, rows, tempVectors_, canPushdown);
@@ -311,6 +330,18 @@ void GroupingSet::addInputForActiveRows(
   }
 }
 
+char* GroupingSet::singleGroupOfInput() const {
+  const auto& rows = lookup_->rows;
+  const auto* hits = lookup_->hits.data();
+  char* group = hits[rows[0]];
+  for (auto i = 1; i < rows.size(); ++i) {
+    if (hits[rows[i]] != group) {
+      return nullptr;
+    }
+  }
+  return group;
+}
+
 void GroupingSet::addRemainingInput() {
   activeRows_.resize(remainingInput_->size());
   activeRows_.clearAll();
@@ -740,6 +771,12 @@ bool GroupingSet::getOutput(
     RowVectorPtr& result) {
   TestValue::adjust("facebook::velox::exec::GroupingSet::getOutput", this);
 
+  if (!pendingOutputs_.empty()) {
+    result = std::move(pendingOutputs_.front());
+    pendingOutputs_.pop_front();
+    return true;
+  }
+
   if (isGlobal_) {
     return getGlobalAggregationOutput(iterator, result);
   }
@@ -753,6 +790,10 @@ bool GroupingSet::getOutput(
   }
   VELOX_CHECK(!isDistinct());
 
+  if (canGetOutputInParallel(result)) {
+    return getOutputInParallel(maxOutputRows, maxOutputBytes, iterator, result);
+  }
+
   // @lint-ignore CLANGTIDY
   char* groups[maxOutputRows];
   const int32_t numGroups = table_
@@ -770,6 +811,127 @@ bool GroupingSet::getOutput(
   return true;
 }
 
+bool GroupingSet::canGetOutputInParallel(const RowVectorPtr& result) const {
+  if (outputExecutor_ == nullptr || table_ == nullptr ||
+      sortedAggregations_ != nullptr) {
+    return false;
+  }
+  for (const auto& aggregation : distinctAggregations_) {
+    if (aggregation != nullptr) {
+      return false;
+    }
+  }
+  for (const auto& aggregate : aggregates_) {
+    if (!aggregate.function->isFixedSize()) {
+      return false;
+    }
+  }
+  for (const auto& type : result->type()->asRow().children()) {
+    if (!type->isFixedWidth()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+namespace {
+// Waits for all 'steps' to finish, also in case of error, because the steps
+// reference the groups and result vectors of the caller. Keeps the last error
+// in 'error'.
+void syncExtractSteps(
+    std::vector<std::shared_ptr<AsyncSource<bool>>>& steps,
+    std::exception_ptr& error) {
+  for (auto& step : steps) {
+    try {
+      step->move();
+    } catch (const std::exception&) {
+      error = std::current_exception();
+    }
+  }
+  steps.clear();
+}
+} // namespace
+
+bool GroupingSet::getOutputInParallel(
+    int32_t maxOutputRows,
+    int32_t maxOutputBytes,
+    RowContainerIterator& iterator,
+    RowVectorPtr& result) {
+  std::vector<std::vector<char*>> batches;
+  for (auto i = 0; i < numParallelOutputBatches_; ++i) {
+    std::vector<char*> groups(maxOutputRows);
+    const auto numGroups = table_->rows()->listRows(
+        &iterator, maxOutputRows, maxOutputBytes, groups.data());
+    if (numGroups == 0) {
+      break;
+    }
+    groups.resize(numGroups);
+    batches.push_back(std::move(groups));
+  }
+  if (batches.empty()) {
+    table_->clear(/*freeTable=*/true);
+    return false;
+  }
+
+  // Allocates the result vectors and their nulls on the driver thread so that
+  // the extraction steps do not allocate. The first batch goes to 'result'.
+  std::vector<RowVectorPtr> results(batches.size());
+  for (auto i = 0; i < batches.size(); ++i) {
+    const auto numGroups = batches[i].size();
+    results[i] = i == 0
+        ? result
+        : BaseVector::create<RowVector>(result->type(), numGroups, &pool_);
+    results[i]->resize(numGroups);
+    for (auto& child : results[i]->children()) {
+      child->resize(numGroups);
+      child->mutableRawNulls();
+    }
+  }
+
+  // Passing driver context directly to avoid cross thread access to thread
+  // local driver thread context.
+  const DriverCtx* driverCtx{nullptr};
+  if (const auto* driverThreadCtx = driverThreadContext()) {
+    driverCtx = driverThreadCtx->driverCtx();
+  }
+
+  std::vector<std::shared_ptr<AsyncSource<bool>>> extractSteps;
+  auto sync = folly::makeGuard([&]() {
+    // This is executed on returning path, possibly in unwinding, so must not
+    // throw.
+    std::exception_ptr error;
+    syncExtractSteps(extractSteps, error);
+  });
+  for (auto i = 1; i < batches.size(); ++i) {
+    extractSteps.push_back(std::make_shared<AsyncSource<bool>>(
+        [this, &groups = batches[i], &batchResult = results[i]]() {
+          extractGroups(
+              table_->rows(),
+              folly::Range<char**>(groups.data(), groups.size()),
+              batchResult);
+          return std::make_unique<bool>(true);
+        }));
+    outputExecutor_->add([driverCtx, step = extractSteps.back()]() {
+      ScopedDriverThreadContext scopedDriverThreadContext(driverCtx);
+      step->prepare();
+    });
+  }
+  extractGroups(
+      table_->rows(),
+      folly::Range<char**>(batches[0].data(), batches[0].size()),
+      result);
+
+  std::exception_ptr error;
+  syncExtractSteps(extractSteps, error);
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+  for (auto i = 1; i < results.size(); ++i) {
+    pendingOutputs_.push_back(std::move(results[i]));
+  }
+  return true;
+}
+
 void GroupingSet::extractGroups(
     RowContainer* rowContainer,
     folly::Range<char**> groups,
@@ -819,6 +981,20 @@ void GroupingSet::resetTable(bool freeTable) {
   }
 }
 
+uint64_t GroupingSet::compactableBytes() const {
+  if (table_ == nullptr || !table_->rows()->canCompact()) {
+    return 0;
+  }
+  return table_->rows()->sparseBytes();
+}
+
+uint64_t GroupingSet::compactTable() {
+  if (compactableBytes() == 0) {
+    return 0;
+  }
+  return table_->compact();
+}
+
 bool GroupingSet::isPartialFull(int64_t maxBytes) {
   VELOX_CHECK(isPartial_);
   if (!table_ || allocatedBytes() <= maxBytes) {
@@ -884,13 +1060,19 @@ void GroupingSet::ensureInputFits(const RowVectorPtr& input) {
       currentUsage * spillConfig_->minSpillableReservationPct / 100;
   const auto availableReservationBytes = pool_.availableReservation();
   const auto tableIncrementBytes = table_->hashTableSizeIncrease(input->size());
+  // Aggregations over sorted inputs store every input row, not only one row
+  // per group, so their memory grows with the input even for a few groups.
+  const auto sortedInputIncrementBytes = sortedAggregations_ != nullptr
+      ? sortedAggregations_->inputSizeIncrement(input->size(), flatBytes)
+      : 0;
   const auto incrementBytes =
       rows->sizeIncrement(input->size(), outOfLineBytes ? flatBytes * 2 : 0) +
-      tableIncrementBytes;
+      tableIncrementBytes + sortedInputIncrementBytes;
 
   // First to check if we have sufficient minimal memory reservation.
   if (availableReservationBytes >= minReservationBytes) {
-    if ((tableIncrementBytes == 0) && (freeRows > input->size()) &&
+    if ((tableIncrementBytes == 0) && (sortedInputIncrementBytes == 0) &&
+        (freeRows > input->size()) &&
         (outOfLineBytes == 0 || outOfLineFreeBytes >= flatBytes * 2)) {
       // Enough free rows for input rows and enough variable length free space
       // for double the flat size of the whole vector. If outOfLineBytes is 0
@@ -1369,7 +1551,18 @@ void GroupingSet::abandonPartialAggregation() {
       false,
       &pool_);
   initializeAggregates(aggregates_, *intermediateRows_, true);
-  table_.reset();
+  // Keeps the empty table with its hashers for resumePartialAggregation().
+  table_->clear(/*freeTable=*/true);
+}
+
+void GroupingSet::resumePartialAggregation() {
+  VELOX_CHECK(abandonedPartialAggregation_);
+  VELOX_CHECK_EQ(table_->rows()->numRows(), 0);
+  abandonedPartialAggregation_ = false;
+  intermediateRows_.reset();
+  intermediateGroups_.clear();
+  intermediateRowNumbers_.clear();
+  initializeAggregates(aggregates_, *table_->rows(), false);
 }
 
 namespace {
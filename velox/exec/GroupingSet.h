@@ -85,6 +85,14 @@ class GroupingSet {
   /// freed but only table content.
   void resetTable(bool freeTable);
 
+  /// Returns the row memory of the hash table that compactTable() can free.
+  /// Returns 0 if the rows can't be moved.
+  uint64_t compactableBytes() const;
+
+  /// Moves the rows of the hash table into dense allocations to free the
+  /// memory of the erased rows without spilling. Returns the freed bytes.
+  uint64_t compactTable();
+
   /// Returns true if 'this' should start producing partial
   /// aggregation results. Checks the memory consumption against
   /// 'maxBytes'. If exceeding 'maxBytes', sees if changing hash mode
@@ -136,6 +144,10 @@ class GroupingSet {
   /// non-productive. Must be called before toIntermediate() is used.
   void abandonPartialAggregation();
 
+  /// Returns to partial aggregation after abandonPartialAggregation(). The
+  /// next input is aggregated in the hash table again.
+  void resumePartialAggregation();
+
   /// Translates the raw input in input to accumulators initialized from a
   /// single input row. Passes grouping keys through.
   void toIntermediate(const RowVectorPtr& input, RowVectorPtr& result);
@@ -184,6 +196,11 @@ class GroupingSet {
 
   void populateTempVectors(int32_t aggregateIndex, const RowVectorPtr& input);
 
+  // Returns the group of all rows in 'lookup_->rows' after a group probe if
+  // they all hit the same group, e.g. for constant keys or input clustered on
+  // the keys. Returns nullptr otherwise.
+  char* singleGroupOfInput() const;
+
   // If the given aggregation has mask, the method returns reference to the
   // selectivity vector from the maskedActiveRows_ (based on the mask channel
   // index for this aggregation), otherwise it returns reference to activeRows_.
@@ -215,6 +232,21 @@ class GroupingSet {
       folly::Range<char**> groups,
       const RowVectorPtr& result);
 
+  // Returns true if the groups of 'table_' can be extracted into 'result' in
+  // parallel. The extraction must not allocate from the shared string
+  // allocator or the output vectors, so all accumulators are fixed size, all
+  // output columns fixed width and there are no sorted or distinct aggregates.
+  bool canGetOutputInParallel(const RowVectorPtr& result) const;
+
+  // Lists up to 'numParallelOutputBatches_' batches of groups and extracts them
+  // in parallel on 'outputExecutor_'. Returns the first batch in 'result' and
+  // queues the others in 'pendingOutputs_'.
+  bool getOutputInParallel(
+      int32_t maxOutputRows,
+      int32_t maxOutputBytes,
+      RowContainerIterator& iterator,
+      RowVectorPtr& result);
+
   // Produces output in if spilling has occurred. First produces data
   // from non-spilled partitions, then merges spill runs and unspilled data
   // form spilled partitions. Returns nullptr when at end. 'maxOutputRows' and
@@ -404,6 +436,16 @@ class GroupingSet {
   std::vector<char*> firstGroup_;
 
   folly::Synchronized<common::SpillStats>* const spillStats_;
+
+  // Executor to extract output batches in parallel on. Null if the output is
+  // extracted on the driver thread only.
+  folly::Executor* const outputExecutor_;
+
+  // The number of output batches to extract in parallel.
+  const int32_t numParallelOutputBatches_;
+
+  // Output batches extracted in parallel and not yet returned by getOutput().
+  std::deque<RowVectorPtr> pendingOutputs_;
 };
 
 class AggregationInputSpiller : public SpillerBase {
@@ -47,6 +47,12 @@ HashAggregation::HashAggregation(
           driverCtx->queryConfig().abandonPartialAggregationMinRows()),
       abandonPartialAggregationMinPct_(
           driverCtx->queryConfig().abandonPartialAggregationMinPct()),
+      partialAggregationReprobeRows_(
+          driverCtx->queryConfig().partialAggregationReprobeRows()),
+      clusteredFlushEnabled_(
+          isPartialOutput_ && !isGlobal_ && !isDistinct_ &&
+          aggregationNode->preGroupedKeys().empty() &&
+          driverCtx->queryConfig().partialAggregationClusteredFlushEnabled()),
       maxPartialAggregationMemoryUsage_(
           driverCtx->queryConfig().maxPartialAggregationMemoryUsage()) {}
 
@@ -116,6 +122,21 @@ void HashAggregation::initialize() {
       &spillStats_);
 
   aggregationNode_.reset();
+
+  if (isPartialOutput_ && !isGlobal_ &&
+      operatorCtx_->driverCtx()->queryConfig().runtimeFeedbackEnabled()) {
+    runtimeFeedback_ =
+        RuntimeFeedback::getInstance(*operatorCtx_->task()->queryCtx());
+    // Another partial aggregation of the plan node saw poor reduction.
+    if (runtimeFeedback_
+            ->get(planNodeId(), RuntimeFeedback::kAbandonedPartialAggregation)
+            .has_value()) {
+      groupingSet_->abandonPartialAggregation();
+      addRuntimeStat(
+          "abandonedPartialAggregationFromFeedback", RuntimeCounter(1));
+      abandonedPartialAggregation_ = true;
+    }
+  }
 }
 
 void HashAggregation::setupGroupingKeyChannelProjections(
@@ -178,9 +199,15 @@ void HashAggregation::addInput(RowVectorPtr input) {
     pushdownChecked_ = true;
   }
   if (abandonedPartialAggregation_) {
-    input_ = input;
-    numInputRows_ += input->size();
-    return;
+    if (partialAggregationReprobeRows_ == 0 ||
+        numAbandonedInputRows_ < partialAggregationReprobeRows_ ||
+        input_ != nullptr) {
+      input_ = input;
+      numInputRows_ += input->size();
+      numAbandonedInputRows_ += input->size();
+      return;
+    }
+    resumePartialAggregation();
   }
   groupingSet_->addInput(input, mayPushdown_);
   numInputRows_ += input->size();
@@ -197,6 +224,9 @@ void HashAggregation::addInput(RowVectorPtr input) {
        groupingSet_->isPartialFull(maxPartialAggregationMemoryUsage_))) {
     partialFull_ = true;
   }
+  if (clusteredFlushEnabled_) {
+    updateClusteredInput();
+  }
 
   if (isDistinct_) {
     newDistincts_ = !groupingSet_->hasSpilled() &&
@@ -214,6 +244,37 @@ void HashAggregation::addInput(RowVectorPtr input) {
   }
 }
 
+bool HashAggregation::isInputClusteredOnKeys() const {
+  const auto& lookup = groupingSet_->hashLookup();
+  const auto& rows = lookup.rows;
+  if (rows.empty()) {
+    return true;
+  }
+  const auto* hits = lookup.hits.data();
+  size_t numRuns = 1;
+  for (auto i = 1; i < rows.size(); ++i) {
+    if (hits[rows[i]] != hits[rows[i - 1]]) {
+      ++numRuns;
+    }
+  }
+  return numRuns <= lookup.newGroups.size() + 1;
+}
+
+void HashAggregation::updateClusteredInput() {
+  if (!isInputClusteredOnKeys()) {
+    numClusteredInputs_ = 0;
+    return;
+  }
+  if (++numClusteredInputs_ < kMinClusteredInputs || partialFull_) {
+    return;
+  }
+  // The groups of the earlier batches are complete, except for the group of
+  // the last row, which is flushed as well. The final aggregation combines
+  // the partial results of a group that spans a batch boundary.
+  partialFull_ = true;
+  clusteredFlush_ = true;
+}
+
 void HashAggregation::updateRuntimeStats() {
   // Report range sizes and number of distinct values for the group-by keys.
   const auto& hashers = groupingSet_->hashLookup().hashers;
@@ -269,16 +330,34 @@ void HashAggregation::resetPartialOutputIfNeed() {
     lockedStats->addRuntimeStat("flushTimes", RuntimeCounter(1));
     lockedStats->addRuntimeStat(
         "partialAggregationPct", RuntimeCounter(aggregationPct));
+    if (clusteredFlush_) {
+      lockedStats->addRuntimeStat("clusteredFlushTimes", RuntimeCounter(1));
+    }
   }
   groupingSet_->resetTable(/*freeTable=*/false);
   partialFull_ = false;
-  if (!finished_) {
+  // A flush for clustered input says nothing about the reduction of the
+  // partial aggregation at its memory limit.
+  if (!finished_ && !clusteredFlush_) {
     maybeIncreasePartialAggregationMemoryUsage(aggregationPct);
   }
+  clusteredFlush_ = false;
   numOutputRows_ = 0;
   numInputRows_ = 0;
 }
 
+void HashAggregation::resumePartialAggregation() {
+  VELOX_CHECK(abandonedPartialAggregation_);
+  VELOX_CHECK_NULL(input_);
+  groupingSet_->resumePartialAggregation();
+  addRuntimeStat("resumedPartialAggregation", RuntimeCounter(1));
+  abandonedPartialAggregation_ = false;
+  numAbandonedInputRows_ = 0;
+  // Measures the reduction from scratch like after a partial output flush.
+  numInputRows_ = 0;
+  numOutputRows_ = 0;
+}
+
 void HashAggregation::maybeIncreasePartialAggregationMemoryUsage(
     double aggregationPct) {
   // If more than this many are unique at full memory, give up on partial agg.
@@ -294,6 +373,10 @@ void HashAggregation::maybeIncreasePartialAggregationMemoryUsage(
     pool()->release();
     addRuntimeStat("abandonedPartialAggregation", RuntimeCounter(1));
     abandonedPartialAggregation_ = true;
+    if (runtimeFeedback_ != nullptr) {
+      runtimeFeedback_->set(
+          planNodeId(), RuntimeFeedback::kAbandonedPartialAggregation, 1);
+    }
     return;
   }
   const int64_t extendedPartialAggregationMemoryUsage = std::min(
@@ -478,8 +561,16 @@ void HashAggregation::reclaim(
     // 'resultIterator_'.
     groupingSet_->spill(resultIterator_);
   } else {
-    // TODO: support fine-grain disk spilling based on 'targetBytes' after
-    // having row container memory compaction support later.
+    // Moving the live rows into dense allocations is much cheaper than
+    // spilling, so try it first if it can free enough memory.
+    if (groupingSet_->compactableBytes() >= targetBytes) {
+      const auto freedBytes = groupingSet_->compactTable();
+      pool()->release();
+      if (freedBytes >= targetBytes) {
+        return;
+      }
+    }
+    // TODO: support fine-grain disk spilling based on 'targetBytes'.
     groupingSet_->spill();
   }
   VELOX_CHECK_EQ(groupingSet_->numRows(), 0);
@@ -17,6 +17,7 @@
 
 #include "velox/exec/GroupingSet.h"
 #include "velox/exec/Operator.h"
+#include "velox/exec/RuntimeFeedback.h"
 
 namespace facebook::velox::exec {
 
@@ -70,6 +71,21 @@ class HashAggregation : public Operator {
   // 'abandonPartialAggregationMinPct_' % of rows are unique.
   bool abandonPartialAggregationEarly(int64_t numOutput) const;
 
+  // Switches back to partial aggregation after it was abandoned with
+  // 'partialAggregationReprobeRows_' set and that many input rows have passed
+  // through since. It is abandoned again when the reduction is still poor.
+  void resumePartialAggregation();
+
+  // Returns true if the rows of each group of the last input batch form a
+  // single run and only the first run may continue a group of an earlier
+  // batch.
+  bool isInputClusteredOnKeys() const;
+
+  // Invoked after each input batch if 'clusteredFlushEnabled_' to count the
+  // consecutive clustered input batches and flush the groups once there are
+  // at least 'kMinClusteredInputs' of them.
+  void updateClusteredInput();
+
   RowVectorPtr getDistinctOutput();
 
   // Setups the projections for accessing grouping keys stored in grouping
@@ -97,6 +113,18 @@ class HashAggregation : public Operator {
   // are unique, the partial aggregation is not worthwhile.
   const int32_t abandonPartialAggregationMinPct_;
 
+  // Number of input rows to pass through an abandoned partial aggregation
+  // before trying partial aggregation again. 0 means never.
+  const int64_t partialAggregationReprobeRows_;
+
+  // Number of consecutive clustered input batches after which a partial
+  // aggregation flushes its groups after each batch.
+  static constexpr int32_t kMinClusteredInputs = 4;
+
+  // True if a partial aggregation flushes its groups after each input batch
+  // when the input is clustered on the grouping keys.
+  const bool clusteredFlushEnabled_;
+
   int64_t maxPartialAggregationMemoryUsage_;
   std::unique_ptr<GroupingSet> groupingSet_;
 
@@ -110,11 +138,23 @@ class HashAggregation : public Operator {
   bool finished_ = false;
   // True if partial aggregation has been found to be non-reducing.
   bool abandonedPartialAggregation_{false};
+  // Input rows passed through since partial aggregation was last abandoned.
+  int64_t numAbandonedInputRows_{0};
+
+  // Set if QueryConfig::runtimeFeedbackEnabled() is true and this is a
+  // grouped partial aggregation.
+  std::shared_ptr<RuntimeFeedback> runtimeFeedback_;
 
   RowContainerIterator resultIterator_;
   bool pushdownChecked_ = false;
   bool mayPushdown_ = false;
 
+  // Number of consecutive input batches clustered on the grouping keys.
+  int32_t numClusteredInputs_{0};
+  // True if the partial output is flushed for clustered input rather than for
+  // reaching the memory limit.
+  bool clusteredFlush_{false};
+
   // Count the number of input rows. It is reset on partial aggregation output
   // flush.
   int64_t numInputRows_ = 0;
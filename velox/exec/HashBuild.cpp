@@ -26,6 +26,13 @@ using facebook::velox::common::testutil::TestValue;
 
 namespace facebook::velox::exec {
 namespace {
+// The minimum number of distinct key hashes tracked for hot key detection.
+constexpr int32_t kMinKeySummaryCapacity = 64;
+
+// The minimum number of build rows for reporting hot keys. Too few rows make
+// every key look hot.
+constexpr int64_t kMinRowsForHotKeyDetection = 10'000;
+
 // Map HashBuild 'state' to the corresponding driver blocking reason.
 BlockingReason fromStateToBlockingReason(HashBuild::State state) {
   switch (state) {
@@ -43,6 +50,66 @@ BlockingReason fromStateToBlockingReason(HashBuild::State state) {
       VELOX_UNREACHABLE(HashBuild::stateName(state));
   }
 }
+
+// Returns true if the probe side of 'joinType' can drop the probe rows without
+// a match on the build side. This must be consistent with the conditions for
+// generating dynamic filters in HashProbe.
+bool canUseKeyBloomFilters(core::JoinType joinType, bool nullAware) {
+  return isInnerJoin(joinType) || isLeftSemiFilterJoin(joinType) ||
+      isRightSemiFilterJoin(joinType) ||
+      (isRightSemiProjectJoin(joinType) && !nullAware) ||
+      isRightJoin(joinType);
+}
+
+template <TypeKind Kind>
+std::shared_ptr<common::Filter> makeKeyBloomFilter(
+    const std::vector<RowContainer*>& rowContainers,
+    int32_t keyIndex,
+    uint64_t numRows) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  constexpr int32_t kBatchSize = 1'024;
+
+  auto bloomFilter = std::make_shared<BloomFilter<>>();
+  bloomFilter->reset(numRows);
+  int64_t min = std::numeric_limits<int64_t>::max();
+  int64_t max = std::numeric_limits<int64_t>::min();
+  std::vector<char*> rows(kBatchSize);
+  for (auto* rowContainer : rowContainers) {
+    const auto column = rowContainer->columnAt(keyIndex);
+    RowContainerIterator iter;
+    int32_t numListed;
+    while ((numListed = rowContainer->listRows(
+                &iter, kBatchSize, rows.data())) > 0) {
+      for (auto i = 0; i < numListed; ++i) {
+        if (RowContainer::isNullAt(rows[i], column)) {
+          continue;
+        }
+        const int64_t value = RowContainer::valueAt<T>(rows[i], column.offset());
+        bloomFilter->insert(common::BigintValuesUsingBloomFilter::hash(value));
+        min = std::min(min, value);
+        max = std::max(max, value);
+      }
+    }
+  }
+  if (min > max) {
+    // All keys are null.
+    return nullptr;
+  }
+  return std::make_shared<common::BigintValuesUsingBloomFilter>(
+      min, max, std::move(bloomFilter), /*nullAllowed=*/false);
+}
+
+// Returns the partition bits of the next spill level to route the spill file
+// pages by if page routing is enabled and the next level is allowed.
+std::optional<HashBitRange> nextLevelPageRoutingBits(
+    const HashBitRange& bits,
+    const common::SpillConfig* spillConfig) {
+  if (!spillConfig->pageRouting ||
+      spillConfig->exceedSpillLevelLimit(bits.end())) {
+    return std::nullopt;
+  }
+  return HashBitRange(bits.end(), bits.end() + spillConfig->numPartitionBits);
+}
 } // namespace
 
 HashBuild::HashBuild(
@@ -55,7 +122,8 @@ HashBuild::HashBuild(
           operatorId,
           joinNode->id(),
           "HashBuild",
-          joinNode->canSpill(driverCtx->queryConfig())
+          joinNode->canSpill(driverCtx->queryConfig()) &&
+                  !canUseHashTableCache(joinNode, driverCtx->queryConfig())
               ? driverCtx->makeSpillConfig(operatorId)
               : std::nullopt),
       joinNode_(std::move(joinNode)),
@@ -65,6 +133,7 @@ HashBuild::HashBuild(
       joinBridge_(operatorCtx_->task()->getHashJoinBridgeLocked(
           operatorCtx_->driverCtx()->splitGroupId,
           planNodeId())),
+      hotKeyMinPct_(driverCtx->queryConfig().hashJoinHotKeyMinPct()),
       keyChannelMap_(joinNode_->rightKeys().size()) {
   VELOX_CHECK(pool()->trackUsage());
   VELOX_CHECK_NOT_NULL(joinBridge_);
@@ -102,8 +171,18 @@ HashBuild::HashBuild(
   }
 
   tableType_ = hashJoinTableType(joinNode_);
+  setupTableCache();
   setupTable();
   setupSpiller();
+  if (hotKeyMinPct_ > 0) {
+    VELOX_USER_CHECK_LE(hotKeyMinPct_, 100);
+    keySummary_ = std::make_unique<
+        functions::ApproxMostFrequentStreamSummary<uint64_t>>();
+    // The counts are overestimated by at most the number of rows divided by
+    // the capacity. This keeps the error under a quarter of the threshold.
+    keySummary_->setCapacity(
+        std::max(kMinKeySummaryCapacity, 400 / hotKeyMinPct_));
+  }
   stateCleared_ = false;
 }
 
@@ -115,6 +194,21 @@ void HashBuild::initialize() {
   }
 }
 
+void HashBuild::setupTableCache() {
+  if (!canUseHashTableCache(
+          joinNode_, operatorCtx_->driverCtx()->queryConfig())) {
+    return;
+  }
+  const auto key = HashTableCache::makeKey(*joinNode_);
+  if (!key.has_value()) {
+    return;
+  }
+  useCachedTable_ = joinBridge_->lookupTableCache(
+      HashTableCache::getInstance(*operatorCtx_->task()->queryCtx()),
+      key.value(),
+      tablePool_);
+}
+
 void HashBuild::setupTable() {
   VELOX_CHECK_NULL(table_);
 
@@ -143,7 +237,11 @@ void HashBuild::setupTable() {
         operatorCtx_->driverCtx()
             ->queryConfig()
             .minTableRowsForParallelJoinBuild(),
-        pool());
+        tablePool(),
+        operatorCtx_->driverCtx()->queryConfig().hashJoinRadixPartitionBytes(),
+        operatorCtx_->driverCtx()
+            ->queryConfig()
+            .hashJoinWideNormalizedKeyEnabled());
   } else {
     // (Left) semi and anti join with no extra filter only needs to know whether
     // there is a match. Hence, no need to store entries with duplicate keys.
@@ -163,7 +261,13 @@ void HashBuild::setupTable() {
           operatorCtx_->driverCtx()
               ->queryConfig()
               .minTableRowsForParallelJoinBuild(),
-          pool());
+          tablePool(),
+          operatorCtx_->driverCtx()
+              ->queryConfig()
+              .hashJoinRadixPartitionBytes(),
+          operatorCtx_->driverCtx()
+              ->queryConfig()
+              .hashJoinWideNormalizedKeyEnabled());
     } else {
       // Ignore null keys
       table_ = HashTable<true>::createForJoin(
@@ -174,7 +278,13 @@ void HashBuild::setupTable() {
           operatorCtx_->driverCtx()
               ->queryConfig()
               .minTableRowsForParallelJoinBuild(),
-          pool());
+          tablePool(),
+          operatorCtx_->driverCtx()
+              ->queryConfig()
+              .hashJoinRadixPartitionBytes(),
+          operatorCtx_->driverCtx()
+              ->queryConfig()
+              .hashJoinWideNormalizedKeyEnabled());
     }
   }
   analyzeKeys_ = table_->hashMode() != BaseHashTable::HashMode::kHash;
@@ -201,9 +311,10 @@ void HashBuild::setupSpiller(SpillPartition* spillPartition) {
 
   const auto* config = spillConfig();
   uint8_t startPartitionBit = config->startPartitionBit;
+  std::vector<SpillReadFile*> spillInputFiles;
   if (spillPartition != nullptr) {
     spillInputReader_ = spillPartition->createUnorderedReader(
-        config->readBufferSize, pool(), &spillStats_);
+        config->readBufferSize, pool(), &spillStats_, &spillInputFiles);
     startPartitionBit =
         spillPartition->id().partitionBitOffset() + config->numPartitionBits;
     // Disable spilling if exceeding the max spill level and the query might run
@@ -228,6 +339,14 @@ void HashBuild::setupSpiller(SpillPartition* spillPartition) {
           startPartitionBit, startPartitionBit + config->numPartitionBits),
       config,
       &spillStats_);
+  if (std::all_of(
+          spillInputFiles.begin(),
+          spillInputFiles.end(),
+          [&](const SpillReadFile* file) {
+            return file->pageRoutingBits() == spiller_->hashBits();
+          })) {
+    spillInputFiles_ = std::move(spillInputFiles);
+  }
 
   const int32_t numPartitions = spiller_->hashBits().numPartitions();
   spillInputIndicesBuffers_.resize(numPartitions);
@@ -365,6 +484,11 @@ void HashBuild::addInput(RowVectorPtr input) {
     return;
   }
 
+  if (keySummary_ != nullptr && !isInputFromSpill() &&
+      activeRows_.hasSelections()) {
+    summarizeKeys();
+  }
+
   spillInput(input);
   if (!activeRows_.hasSelections()) {
     return;
@@ -665,6 +789,13 @@ bool HashBuild::finishHashBuild() {
     }
   };
 
+  if (useCachedTable_) {
+    stats_.wlock()->addRuntimeStat(
+        BaseHashTable::kNumCacheHits, RuntimeCounter(1));
+    joinBridge_->setCachedHashTable();
+    return true;
+  }
+
   if (joinHasNullKeys_ && isAntiJoin(joinType_) && nullAware_ &&
       !joinNode_->filter()) {
     joinBridge_->setAntiJoinHasNullKeys();
@@ -731,8 +862,13 @@ bool HashBuild::finishHashBuild() {
   // TODO: Get accurate signal if parallel join build is going to be applied
   //  from hash table. Currently there is still a chance inside hash table that
   //  it might decide it is not going to trigger parallel join build.
-  const bool allowParallelJoinBuild =
-      !otherTables.empty() && spillPartitions.empty();
+  //
+  // NOTE: the table is also built in parallel if some of the input has been
+  // spilled and when building the table of a restored spill partition, whose
+  // input is split between all the build drivers. The spillers of all the
+  // build drivers have been finalized above, so no memory reclaim can spill the
+  // rows of the table while it is being built.
+  const bool allowParallelJoinBuild = !otherTables.empty();
 
   SCOPE_EXIT {
     // Make a guard to release the unused memory reservation since we have
@@ -740,8 +876,6 @@ bool HashBuild::finishHashBuild() {
     pool()->release();
   };
 
-  // TODO: Re-enable parallel join build with spilling triggered after
-  //  https://github.com/facebookincubator/velox/issues/3567 is fixed.
   CpuWallTiming timing;
   {
     CpuWallTimer cpuWallTimer{timing};
@@ -756,6 +890,8 @@ bool HashBuild::finishHashBuild() {
       BaseHashTable::kBuildWallNanos,
       RuntimeCounter(timing.wallNanos, RuntimeCounter::Unit::kNanos));
 
+  maybeSetupKeyBloomFilters(!spillPartitions.empty());
+  maybeDetectHotKeys(otherBuilds);
   addRuntimeStats();
 
   // Setup spill function for spilling hash table directly from hash join
@@ -853,6 +989,7 @@ void HashBuild::setupSpillInput(HashJoinBridge::SpillInput spillInput) {
 
   table_.reset();
   spiller_.reset();
+  spillInputFiles_.clear();
   spillInputReader_.reset();
 
   // Reset the key and dependent channels as the spilled data columns have
@@ -874,7 +1011,16 @@ void HashBuild::setupSpillInput(HashJoinBridge::SpillInput spillInput) {
 void HashBuild::processSpillInput() {
   checkRunning();
 
-  while (spillInputReader_->nextBatch(spillInput_)) {
+  for (;;) {
+    if (!spillInputFiles_.empty() &&
+        spiller_->state().isAllPartitionSpilled()) {
+      if (!routeSpillInputPages()) {
+        return;
+      }
+    }
+    if (!spillInputReader_->nextBatch(spillInput_)) {
+      break;
+    }
     addInput(std::move(spillInput_));
     if (!isRunning()) {
       return;
@@ -888,6 +1034,131 @@ void HashBuild::processSpillInput() {
   noMoreInputInternal();
 }
 
+bool HashBuild::routeSpillInputPages() {
+  int32_t partition;
+  std::unique_ptr<folly::IOBuf> page;
+  for (auto* file : spillInputFiles_) {
+    while (file->nextPage(partition, page)) {
+      if (partition != SpillWriter::kUnroutedPage) {
+        spiller_->spillPage(partition, std::move(page));
+        continue;
+      }
+      addInput(file->deserializePage(*page));
+      if (!isRunning()) {
+        return false;
+      }
+    }
+  }
+  spillInputFiles_.clear();
+  return true;
+}
+
+void HashBuild::maybeSetupKeyBloomFilters(bool hasSpillData) {
+  const auto& queryConfig = operatorCtx_->driverCtx()->queryConfig();
+  // NOTE: the probe side doesn't push down dynamic filters if there is spilled
+  // data to restore, or the probe input is read from spilled data.
+  if (!queryConfig.hashJoinBloomFilterEnabled() || hasSpillData ||
+      isInputFromSpill() || !canUseKeyBloomFilters(joinType_, nullAware_)) {
+    return;
+  }
+
+  const auto rowContainers = table_->allRows();
+  uint64_t numRows{0};
+  for (const auto* rowContainer : rowContainers) {
+    numRows += rowContainer->numRows();
+  }
+  if (numRows == 0 || numRows > queryConfig.hashJoinBloomFilterMaxEntries()) {
+    return;
+  }
+
+  CpuWallTiming timing;
+  std::vector<std::shared_ptr<common::Filter>> keyBloomFilters(
+      table_->hashers().size());
+  bool hasFilter{false};
+  {
+    CpuWallTimer cpuWallTimer{timing};
+    for (auto i = 0; i < keyBloomFilters.size(); ++i) {
+      switch (table_->hashers()[i]->typeKind()) {
+        case TypeKind::TINYINT:
+          keyBloomFilters[i] = makeKeyBloomFilter<TypeKind::TINYINT>(
+              rowContainers, i, numRows);
+          break;
+        case TypeKind::SMALLINT:
+          keyBloomFilters[i] = makeKeyBloomFilter<TypeKind::SMALLINT>(
+              rowContainers, i, numRows);
+          break;
+        case TypeKind::INTEGER:
+          keyBloomFilters[i] = makeKeyBloomFilter<TypeKind::INTEGER>(
+              rowContainers, i, numRows);
+          break;
+        case TypeKind::BIGINT:
+          keyBloomFilters[i] = makeKeyBloomFilter<TypeKind::BIGINT>(
+              rowContainers, i, numRows);
+          break;
+        default:
+          // TODO Add support for strings.
+          break;
+      }
+      hasFilter |= keyBloomFilters[i] != nullptr;
+    }
+  }
+  if (!hasFilter) {
+    return;
+  }
+  table_->setKeyBloomFilters(std::move(keyBloomFilters));
+  stats_.wlock()->addRuntimeStat(
+      "bloomFilterBuildWallNanos",
+      RuntimeCounter(timing.wallNanos, RuntimeCounter::Unit::kNanos));
+}
+
+void HashBuild::summarizeKeys() {
+  const auto& hashers = table_->hashers();
+  keyHashes_.resize(activeRows_.end());
+  for (auto i = 0; i < hashers.size(); ++i) {
+    hashers[i]->hash(activeRows_, i > 0, keyHashes_);
+  }
+  activeRows_.applyToSelected(
+      [&](auto row) { keySummary_->insert(keyHashes_[row]); });
+  numSummarizedRows_ += activeRows_.countSelected();
+}
+
+void HashBuild::maybeDetectHotKeys(const std::vector<HashBuild*>& otherBuilds) {
+  if (keySummary_ == nullptr || isInputFromSpill()) {
+    return;
+  }
+  for (auto* build : otherBuilds) {
+    VELOX_CHECK_NOT_NULL(build->keySummary_);
+    keySummary_->merge(*build->keySummary_);
+    numSummarizedRows_ += build->numSummarizedRows_;
+  }
+  if (numSummarizedRows_ < kMinRowsForHotKeyDetection) {
+    return;
+  }
+
+  const int64_t minHotKeyRows = numSummarizedRows_ * hotKeyMinPct_ / 100;
+  std::vector<uint64_t> hotKeyHashes;
+  int64_t maxHotKeyRows{0};
+  for (const auto& [hash, count] : keySummary_->topK(keySummary_->size())) {
+    if (count < minHotKeyRows) {
+      break;
+    }
+    hotKeyHashes.push_back(hash);
+    maxHotKeyRows = std::max(maxHotKeyRows, count);
+  }
+  if (hotKeyHashes.empty()) {
+    return;
+  }
+
+  {
+    auto lockedStats = stats_.wlock();
+    lockedStats->addRuntimeStat(
+        BaseHashTable::kNumHotKeys, RuntimeCounter(hotKeyHashes.size()));
+    lockedStats->addRuntimeStat(
+        BaseHashTable::kMaxHotKeyRows, RuntimeCounter(maxHotKeyRows));
+  }
+  table_->setHotKeyHashes(std::move(hotKeyHashes));
+}
+
 void HashBuild::addRuntimeStats() {
   // Report range sizes and number of distinct values for the join keys.
   const auto& hashers = table_->hashers();
@@ -919,6 +1190,10 @@ void HashBuild::addRuntimeStats() {
     lockedStats->runtimeStats[BaseHashTable::kNumTombstones] =
         RuntimeMetric(hashTableStats.numTombstones);
   }
+  if (hashTableStats.numRadixPartitions > 1) {
+    lockedStats->runtimeStats[BaseHashTable::kNumRadixPartitions] =
+        RuntimeMetric(hashTableStats.numRadixPartitions);
+  }
 
   // Add max spilling level stats if spilling has been triggered.
   if (spiller_ != nullptr && spiller_->state().isAnyPartitionSpilled()) {
@@ -932,7 +1207,11 @@ void HashBuild::addRuntimeStats() {
 BlockingReason HashBuild::isBlocked(ContinueFuture* future) {
   switch (state_) {
     case State::kRunning:
-      if (isInputFromSpill()) {
+      if (useCachedTable_ && !noMoreInput_) {
+        // The table is in the hash table cache. Finishes without reading the
+        // build side input.
+        noMoreInput();
+      } else if (isInputFromSpill()) {
         processSpillInput();
       }
       break;
@@ -1154,7 +1433,8 @@ HashBuildSpiller::HashBuildSpiller(
           spillConfig->maxFileSize,
           spillConfig->maxSpillRunRows,
           spillConfig,
-          spillStats),
+          spillStats,
+          nextLevelPageRoutingBits(bits, spillConfig)),
       spillProbeFlag_(needRightSideJoin(joinType)) {
   VELOX_CHECK(container_->accumulators().empty());
 }
@@ -1182,6 +1462,18 @@ void HashBuildSpiller::spill(
   state_.appendToPartition(partition, spillVector);
 }
 
+void HashBuildSpiller::spillPage(
+    uint32_t partition,
+    std::unique_ptr<folly::IOBuf> page) {
+  VELOX_CHECK(!finalized_);
+  VELOX_CHECK(
+      state_.isPartitionSpilled(partition),
+      "Can't spill page to a non-spilling partition: {}, {}",
+      partition,
+      toString());
+  state_.appendPageToPartition(partition, rowType_, std::move(page));
+}
+
 void HashBuildSpiller::extractSpill(
     folly::Range<char**> rows,
     facebook::velox::RowVectorPtr& resultPtr) {
@@ -23,6 +23,7 @@
 #include "velox/exec/UnorderedStreamReader.h"
 #include "velox/exec/VectorHasher.h"
 #include "velox/expression/Expr.h"
+#include "velox/functions/lib/ApproxMostFrequentStreamSummary.h"
 
 namespace facebook::velox::exec {
 class HashBuildSpiller;
@@ -98,9 +99,18 @@ class HashBuild final : public Operator {
   bool isRunning() const;
   void checkRunning() const;
 
+  // Invoked to look up the table of this join in the query's hash table cache
+  // if the join can share its table.
+  void setupTableCache();
+
   // Invoked to set up hash table to build.
   void setupTable();
 
+  // Returns the pool to allocate the hash table from.
+  memory::MemoryPool* tablePool() const {
+    return tablePool_ != nullptr ? tablePool_ : pool();
+  }
+
   // Invoked when operator has finished processing the build input and wait for
   // all the other drivers to finish the processing. The last driver that
   // reaches to the hash build barrier, is responsible to build the hash table
@@ -182,6 +192,12 @@ class HashBuild final : public Operator {
   // Invoked to process data from spill input reader on restoring.
   void processSpillInput();
 
+  // Moves the unread pages of 'spillInputFiles_' to the partitions of
+  // 'spiller_' as is after all the partitions have been spilled. The pages that
+  // are not routed by the partition bits of 'spiller_' are deserialized and
+  // added as input instead. Returns false if the operator stops running.
+  bool routeSpillInputPages();
+
   // Set up for null-aware and regular anti-join with filter processing.
   void setupFilterForAntiJoins(
       const folly::F14FastMap<column_index_t, column_index_t>& keyChannelMap);
@@ -196,6 +212,21 @@ class HashBuild final : public Operator {
 
   void addRuntimeStats();
 
+  // Invoked by the last build driver after the join table has been built to
+  // make Bloom filters over the integer join keys if enabled by the query
+  // config. The filters are attached to 'table_' and pushed down by the probe
+  // side as dynamic filters when the join keys have too many distinct values
+  // for exact value filters.
+  void maybeSetupKeyBloomFilters(bool hasSpillData);
+
+  // Adds the key hashes of 'activeRows_' to 'keySummary_'.
+  void summarizeKeys();
+
+  // Invoked by the last build driver to find the hot keys of the build input
+  // from the key summaries of all build drivers if hot key detection is on.
+  // The hot keys are set on 'table_' and reported in runtime stats.
+  void maybeDetectHotKeys(const std::vector<HashBuild*>& otherBuilds);
+
   // Indicates if this hash build operator is under non-reclaimable state or
   // not.
   bool nonReclaimableState() const;
@@ -258,6 +289,21 @@ class HashBuild final : public Operator {
   // Temporary space for hash numbers.
   raw_vector<uint64_t> hashes_;
 
+  // The minimum percentage of the build rows that makes a key hot. 0 if hot
+  // key detection is off.
+  const int32_t hotKeyMinPct_;
+
+  // Approximate counts of the most frequent key hashes of the input. Set if
+  // hot key detection is on.
+  std::unique_ptr<functions::ApproxMostFrequentStreamSummary<uint64_t>>
+      keySummary_;
+
+  // The number of rows added to 'keySummary_'.
+  int64_t numSummarizedRows_{0};
+
+  // Temporary space for the key hashes added to 'keySummary_'.
+  raw_vector<uint64_t> keyHashes_;
+
   // Set of active rows during addInput().
   SelectivityVector activeRows_;
 
@@ -265,6 +311,14 @@ class HashBuild final : public Operator {
   // at least one entry with null join keys.
   bool joinHasNullKeys_{false};
 
+  // True if the table of this join is found in the query's hash table cache.
+  // The operator then skips its input.
+  bool useCachedTable_{false};
+
+  // The hash table cache pool if this join builds the table for the cache.
+  // Null otherwise.
+  memory::MemoryPool* tablePool_{nullptr};
+
   // The type used to spill hash table which might attach a boolean column to
   // record the probed flag if 'needProbedFlagSpill_' is true.
   RowTypePtr spillType_;
@@ -281,6 +335,9 @@ class HashBuild final : public Operator {
 
   // Used to read input from previously spilled data for restoring.
   std::unique_ptr<UnorderedStreamReader<BatchStream>> spillInputReader_;
+  // The files read by 'spillInputReader_' if their pages are routed by the
+  // partition bits of 'spiller_', see common::SpillConfig::pageRouting.
+  std::vector<SpillReadFile*> spillInputFiles_;
   // Vector used to read from spilled input with type of 'spillType_'.
   RowVectorPtr spillInput_;
 
@@ -329,6 +386,10 @@ class HashBuildSpiller : public SpillerBase {
   /// Invoked to spill a given partition from the input vector 'spillVector'.
   void spill(uint32_t partition, const RowVectorPtr& spillVector);
 
+  /// Invoked to spill a serialized 'page' read from a spill file whose pages
+  /// are routed by hashBits() to a given partition as is.
+  void spillPage(uint32_t partition, std::unique_ptr<folly::IOBuf> page);
+
  private:
   void extractSpill(folly::Range<char**> rows, RowVectorPtr& resultPtr)
       override;
@@ -53,6 +53,12 @@ RowTypePtr hashJoinTableType(
   return ROW(std::move(names), std::move(types));
 }
 
+HashJoinBridge::~HashJoinBridge() {
+  if (tableCacheBuilder_) {
+    tableCache_->abandon(tableCacheKey_);
+  }
+}
+
 void HashJoinBridge::start() {
   std::lock_guard<std::mutex> l(mutex_);
   started_ = true;
@@ -66,6 +72,16 @@ void HashJoinBridge::addBuilder() {
 }
 
 void HashJoinBridge::reclaim() {
+  std::shared_ptr<HashTableCache> tableCache;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    tableCache = tableCache_;
+  }
+  if (tableCache != nullptr) {
+    // Frees the cached tables of the query that no probe uses.
+    tableCache->evictUnused();
+  }
+
   std::lock_guard<std::mutex> l(mutex_);
   VELOX_CHECK(tableSpillFunc_ == nullptr || !probeStarted_);
   if (tableSpillFunc_ == nullptr) {
@@ -224,9 +240,25 @@ void HashJoinBridge::setHashTable(
       tableSpillFunc_ = std::move(tableSpillFunc);
     }
     const auto spillPartitionIdSet = toSpillPartitionIdSet(spillPartitionSet);
+    if (spillPartitionSet.empty() && spillPartitionSets_.empty() &&
+        !restoringSpillPartitionId_.has_value()) {
+      int64_t numRows{0};
+      for (const auto* rowContainer : table->allRows()) {
+        numRows += rowContainer->numRows();
+      }
+      numBuildRows_ = numRows;
+    }
+    std::shared_ptr<BaseHashTable> sharedTable;
+    if (tableCacheBuilder_ && spillPartitionSet.empty()) {
+      sharedTable =
+          tableCache_->put(tableCacheKey_, std::move(table), hasNullKeys);
+      tableCacheBuilder_ = false;
+    } else {
+      sharedTable = std::move(table);
+    }
     appendSpilledHashTablePartitionsLocked(std::move(spillPartitionSet));
     buildResult_ = HashBuildResult(
-        std::move(table),
+        std::move(sharedTable),
         std::move(restoringSpillPartitionId_),
         spillPartitionIdSet,
         hasNullKeys);
@@ -287,6 +319,44 @@ void HashJoinBridge::setAntiJoinHasNullKeys() {
   notify(std::move(promises));
 }
 
+bool HashJoinBridge::lookupTableCache(
+    const std::shared_ptr<HashTableCache>& cache,
+    const std::string& key,
+    memory::MemoryPool*& tablePool) {
+  VELOX_CHECK_NOT_NULL(cache);
+  std::lock_guard<std::mutex> l(mutex_);
+  VELOX_CHECK(!started_);
+  if (tableCache_ == nullptr) {
+    tableCache_ = cache;
+    tableCacheKey_ = key;
+    cachedTable_ = tableCache_->get(tableCacheKey_, tableCacheBuilder_);
+  }
+  VELOX_CHECK_EQ(tableCacheKey_, key);
+  if (tableCacheBuilder_) {
+    tablePool = tableCache_->pool();
+  }
+  return cachedTable_.has_value();
+}
+
+void HashJoinBridge::setCachedHashTable() {
+  std::vector<ContinuePromise> promises;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    VELOX_CHECK(started_);
+    VELOX_CHECK(cachedTable_.has_value());
+    VELOX_CHECK(!buildResult_.has_value());
+    int64_t numRows{0};
+    for (const auto* rowContainer : cachedTable_->table->allRows()) {
+      numRows += rowContainer->numRows();
+    }
+    numBuildRows_ = numRows;
+    buildResult_ = HashBuildResult(
+        cachedTable_->table, std::nullopt, {}, cachedTable_->hasNullKeys);
+    promises = std::move(promises_);
+  }
+  notify(std::move(promises));
+}
+
 std::optional<HashJoinBridge::HashBuildResult> HashJoinBridge::tableOrFuture(
     ContinueFuture* future) {
   std::lock_guard<std::mutex> l(mutex_);
@@ -377,6 +447,31 @@ bool isLeftNullAwareJoinWithFilter(
       joinNode->isNullAware() && (joinNode->filter() != nullptr);
 }
 
+bool canUseHashTableCache(
+    const std::shared_ptr<const core::HashJoinNode>& joinNode,
+    const core::QueryConfig& queryConfig) {
+  if (!queryConfig.hashJoinTableCacheEnabled() || joinNode->isNullAware()) {
+    return false;
+  }
+  if (!joinNode->isInnerJoin() && !joinNode->isLeftJoin() &&
+      !joinNode->isLeftSemiFilterJoin() && !joinNode->isLeftSemiProjectJoin() &&
+      !joinNode->isAntiJoin()) {
+    return false;
+  }
+  std::vector<const core::PlanNode*> nodes{joinNode->sources()[1].get()};
+  while (!nodes.empty()) {
+    const auto* node = nodes.back();
+    nodes.pop_back();
+    if (dynamic_cast<const core::TableScanNode*>(node) != nullptr) {
+      return false;
+    }
+    for (const auto& source : node->sources()) {
+      nodes.push_back(source.get());
+    }
+  }
+  return true;
+}
+
 uint64_t HashJoinMemoryReclaimer::reclaim(
     memory::MemoryPool* pool,
     uint64_t targetBytes,
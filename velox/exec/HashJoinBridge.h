@@ -17,6 +17,7 @@
 
 #include "velox/exec/HashBitRange.h"
 #include "velox/exec/HashTable.h"
+#include "velox/exec/HashTableCache.h"
 #include "velox/exec/JoinBridge.h"
 #include "velox/exec/MemoryReclaimer.h"
 #include "velox/exec/Spill.h"
@@ -37,6 +38,8 @@ using HashJoinTableSpillFunc =
 /// the same name.
 class HashJoinBridge : public JoinBridge {
  public:
+  ~HashJoinBridge() override;
+
   void start() override;
 
   /// Invoked by HashBuild operator ctor to add to this bridge by incrementing
@@ -63,6 +66,22 @@ class HashJoinBridge : public JoinBridge {
 
   void setAntiJoinHasNullKeys();
 
+  /// Invoked by HashBuild operator ctor if the table of this join can be
+  /// shared through the query's hash table cache. Only the first call looks up
+  /// 'key' in 'cache', the later calls return the same result. Returns true if
+  /// there is a cached table. Then HashBuild operators skip their input and the
+  /// last one calls setCachedHashTable(). Otherwise, if this join builds the
+  /// table for the cache, sets 'tablePool' to the pool to allocate the table
+  /// from, and setHashTable() adds the table to the cache.
+  bool lookupTableCache(
+      const std::shared_ptr<HashTableCache>& cache,
+      const std::string& key,
+      memory::MemoryPool*& tablePool);
+
+  /// Invoked by the last HashBuild operator to hand over the table found by
+  /// lookupTableCache() to the probe operators.
+  void setCachedHashTable();
+
   /// Represents the result of HashBuild operators. In case of an anti join, a
   /// build side entry with a null in a join key makes the join return nothing.
   /// In this case, HashBuild operators finishes early without processing all
@@ -125,12 +144,36 @@ class HashJoinBridge : public JoinBridge {
   /// 'spillPartition' will be set to null in the returned SpillInput.
   std::optional<SpillInput> spillInputOrFuture(ContinueFuture* future);
 
+  /// Returns the number of rows in the built table. Returns std::nullopt until
+  /// the table is built or if some of the build side input was spilled. May be
+  /// called from any thread, e.g. by a LocalPartition feeding the probe.
+  std::optional<int64_t> numBuildRows() const {
+    const auto numRows = numBuildRows_.load();
+    if (numRows < 0) {
+      return std::nullopt;
+    }
+    return numRows;
+  }
+
  private:
   void appendSpilledHashTablePartitionsLocked(
       SpillPartitionSet&& spillPartitionSet);
 
   uint32_t numBuilders_{0};
 
+  // Number of rows in the table of the first 'buildResult_'. -1 if not known.
+  std::atomic<int64_t> numBuildRows_{-1};
+
+  // The query's hash table cache if the table of this join is shared through
+  // it, and the key of the table in the cache.
+  std::shared_ptr<HashTableCache> tableCache_;
+  std::string tableCacheKey_;
+  // The table found in 'tableCache_'.
+  std::optional<HashTableCache::Entry> cachedTable_;
+  // True if this join builds the table for 'tableCache_' and hasn't added it
+  // yet.
+  bool tableCacheBuilder_{false};
+
   // The result of the build side. It is set by the last build operator when
   // build is done.
   std::optional<HashBuildResult> buildResult_;
@@ -173,6 +216,15 @@ class HashJoinBridge : public JoinBridge {
 bool isLeftNullAwareJoinWithFilter(
     const std::shared_ptr<const core::HashJoinNode>& joinNode);
 
+/// Returns true if the table built for 'joinNode' can be shared with other
+/// joins of the query through the query's hash table cache. This requires the
+/// cache to be enabled, a join type that doesn't update the table while
+/// probing and a build side without table scans, whose input depends on the
+/// splits of the task. Joins that use the cache don't spill.
+bool canUseHashTableCache(
+    const std::shared_ptr<const core::HashJoinNode>& joinNode,
+    const core::QueryConfig& queryConfig);
+
 class HashJoinMemoryReclaimer final : public MemoryReclaimer {
  public:
   static std::unique_ptr<memory::MemoryReclaimer> create(
@@ -32,6 +32,30 @@ static inline uint32_t localExchangeHash(uint32_t rawHash) {
 }
 } // namespace
 
+folly::dynamic HotKeyPartitioning::serialize() const {
+  folly::dynamic obj = folly::dynamic::object;
+  // Hashes are stored as signed since folly::dynamic has no unsigned ints.
+  folly::dynamic hashArray = folly::dynamic::array;
+  for (auto hash : hashes) {
+    hashArray.push_back(static_cast<int64_t>(hash));
+  }
+  obj["hashes"] = std::move(hashArray);
+  obj["numPartitions"] = numPartitions;
+  obj["replicate"] = replicate;
+  return obj;
+}
+
+// static
+HotKeyPartitioning HotKeyPartitioning::deserialize(const folly::dynamic& obj) {
+  HotKeyPartitioning hotKeys;
+  for (const auto& hash : obj["hashes"]) {
+    hotKeys.hashes.push_back(static_cast<uint64_t>(hash.asInt()));
+  }
+  hotKeys.numPartitions = obj["numPartitions"].asInt();
+  hotKeys.replicate = obj["replicate"].asBool();
+  return hotKeys;
+}
+
 HashPartitionFunction::HashPartitionFunction(
     bool localExchange,
     int numPartitions,
@@ -73,6 +97,15 @@ void HashPartitionFunction::init(
   }
 }
 
+void HashPartitionFunction::setHotKeys(const HotKeyPartitioning& hotKeys) {
+  VELOX_USER_CHECK_GE(hotKeys.numPartitions, 1);
+  VELOX_USER_CHECK_LE(hotKeys.numPartitions, numPartitions_);
+  hotKeyHashes_.clear();
+  hotKeyHashes_.insert(hotKeys.hashes.begin(), hotKeys.hashes.end());
+  numHotKeyPartitions_ = hotKeys.numPartitions;
+  replicateHotKeys_ = hotKeys.replicate;
+}
+
 std::optional<uint32_t> HashPartitionFunction::partition(
     const RowVector& input,
     std::vector<uint32_t>& partitions) {
@@ -118,14 +151,55 @@ std::optional<uint32_t> HashPartitionFunction::partition(
     }
   }
 
+  extraRows_.clear();
+  extraPartitions_.clear();
+  if (!hotKeyHashes_.empty() && numHotKeyPartitions_ > 1) {
+    spreadHotKeys(partitions);
+  }
   return std::nullopt;
 }
 
+void HashPartitionFunction::spreadHotKeys(std::vector<uint32_t>& partitions) {
+  const auto size = hashes_.size();
+  for (auto i = 0; i < size; ++i) {
+    if (!hotKeyHashes_.contains(hashes_[i])) {
+      continue;
+    }
+    if (replicateHotKeys_) {
+      for (auto j = 1; j < numHotKeyPartitions_; ++j) {
+        extraRows_.push_back(i);
+        extraPartitions_.push_back((partitions[i] + j) % numPartitions_);
+      }
+    } else {
+      const auto offset = hotKeyCounter_++ % numHotKeyPartitions_;
+      partitions[i] = (partitions[i] + offset) % numPartitions_;
+    }
+  }
+}
+
+vector_size_t HashPartitionFunction::extraPartitions(
+    std::vector<vector_size_t>& rows,
+    std::vector<uint32_t>& partitions) {
+  rows.swap(extraRows_);
+  partitions.swap(extraPartitions_);
+  extraRows_.clear();
+  extraPartitions_.clear();
+  return rows.size();
+}
+
 std::unique_ptr<core::PartitionFunction> HashPartitionFunctionSpec::create(
     int numPartitions,
     bool localExchange) const {
-  return std::make_unique<exec::HashPartitionFunction>(
+  auto function = std::make_unique<exec::HashPartitionFunction>(
       localExchange, numPartitions, inputType_, keyChannels_, constValues_);
+  if (hotKeys_.has_value()) {
+    // Local exchange does not replicate rows to more than one partition.
+    VELOX_USER_CHECK(
+        !localExchange || !hotKeys_->replicate,
+        "Replicated hot keys are not supported in local exchange");
+    function->setHotKeys(hotKeys_.value());
+  }
+  return function;
 }
 
 std::string HashPartitionFunctionSpec::toString() const {
@@ -143,6 +217,13 @@ std::string HashPartitionFunctionSpec::toString() const {
     }
   }
 
+  if (hotKeys_.has_value()) {
+    return fmt::format(
+        "HASH({}) with {} hot keys over {} partitions",
+        keys.str(),
+        hotKeys_->hashes.size(),
+        hotKeys_->numPartitions);
+  }
   return fmt::format("HASH({})", keys.str());
 }
 
@@ -158,6 +239,9 @@ folly::dynamic HashPartitionFunctionSpec::serialize() const {
     constValues.emplace_back(value);
   }
   obj["constants"] = ISerializable::serialize(constValues);
+  if (hotKeys_.has_value()) {
+    obj["hotKeys"] = hotKeys_->serialize();
+  }
   return obj;
 }
 
@@ -177,7 +261,14 @@ core::PartitionFunctionSpecPtr HashPartitionFunctionSpec::deserialize(
   for (const auto& value : constTypeExprs) {
     constValues.emplace_back(value->toConstantVector(pool));
   }
+  std::optional<HotKeyPartitioning> hotKeys;
+  if (obj.count("hotKeys")) {
+    hotKeys = HotKeyPartitioning::deserialize(obj["hotKeys"]);
+  }
   return std::make_shared<HashPartitionFunctionSpec>(
-      ISerializable::deserialize<RowType>(obj["inputType"]), keys, constValues);
+      ISerializable::deserialize<RowType>(obj["inputType"]),
+      keys,
+      constValues,
+      std::move(hotKeys));
 }
 } // namespace facebook::velox::exec
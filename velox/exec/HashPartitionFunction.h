@@ -15,12 +15,39 @@
  */
 #pragma once
 
+#include <folly/container/F14Set.h>
 #include <velox/exec/HashBitRange.h>
 #include <velox/exec/VectorHasher.h>
 #include "velox/core/PlanNode.h"
 
 namespace facebook::velox::exec {
 
+/// Join keys whose rows are spread over more than one partition to balance a
+/// skewed join. The keys are identified by the hash of the partition key
+/// columns, which is the hash HashBuild reports in
+/// BaseHashTable::hotKeyHashes(). The probe side sends the rows of a hot key
+/// round robin to 'numPartitions' partitions and the build side replicates
+/// them to all of these, so that each probe row meets all build rows of its
+/// key. Not valid for joins that report unmatched build rows (right and full
+/// joins).
+struct HotKeyPartitioning {
+  /// Hashes of the hot keys.
+  std::vector<uint64_t> hashes;
+
+  /// The number of consecutive partitions, starting at the hash partition of
+  /// a key, that the rows of a hot key are spread over.
+  uint32_t numPartitions{1};
+
+  /// If true, each row of a hot key goes to all of the 'numPartitions'
+  /// partitions. This is for the build side of a join. Otherwise each row
+  /// goes to one of them, which is for the probe side.
+  bool replicate{false};
+
+  folly::dynamic serialize() const;
+
+  static HotKeyPartitioning deserialize(const folly::dynamic& obj);
+};
+
 /// Calculates partition number for each row of the specified vector using a
 /// hash function. The constructor with hashBitRange parameter requires both
 /// hashBitRange and keyChannels to be non-empty. The constructor with
@@ -48,10 +75,17 @@ class HashPartitionFunction : public core::PartitionFunction {
       const RowVector& input,
       std::vector<uint32_t>& partitions) override;
 
+  vector_size_t extraPartitions(
+      std::vector<vector_size_t>& rows,
+      std::vector<uint32_t>& partitions) override;
+
   int numPartitions() const {
     return numPartitions_;
   }
 
+  /// Spreads the rows of the keys in 'hotKeys' over more than one partition.
+  void setHotKeys(const HotKeyPartitioning& hotKeys);
+
  private:
   void init(
       const RowTypePtr& inputType,
@@ -61,8 +95,24 @@ class HashPartitionFunction : public core::PartitionFunction {
   const bool localExchange_;
   const int numPartitions_;
   const std::optional<HashBitRange> hashBitRange_ = std::nullopt;
+  // Moves the rows of hot keys to their spread partitions after partition()
+  // has assigned the hash partitions.
+  void spreadHotKeys(std::vector<uint32_t>& partitions);
+
   std::vector<std::unique_ptr<VectorHasher>> hashers_;
 
+  // Hashes of the hot keys. Empty if there are none.
+  folly::F14FastSet<uint64_t> hotKeyHashes_;
+  uint32_t numHotKeyPartitions_{1};
+  bool replicateHotKeys_{false};
+  // Counter for sending the rows of hot keys round robin to their partitions.
+  uint64_t hotKeyCounter_{0};
+
+  // Rows of the last input that are replicated to more partitions and their
+  // extra partitions. Returned by extraPartitions().
+  std::vector<vector_size_t> extraRows_;
+  std::vector<uint32_t> extraPartitions_;
+
   // Reusable memory.
   SelectivityVector rows_;
   raw_vector<uint64_t> hashes_;
@@ -78,10 +128,12 @@ class HashPartitionFunctionSpec : public core::PartitionFunctionSpec {
   HashPartitionFunctionSpec(
       RowTypePtr inputType,
       std::vector<column_index_t> keyChannels,
-      std::vector<VectorPtr> constValues = {})
+      std::vector<VectorPtr> constValues = {},
+      std::optional<HotKeyPartitioning> hotKeys = std::nullopt)
       : inputType_{std::move(inputType)},
         keyChannels_{std::move(keyChannels)},
-        constValues_{std::move(constValues)} {}
+        constValues_{std::move(constValues)},
+        hotKeys_{std::move(hotKeys)} {}
 
   std::unique_ptr<core::PartitionFunction> create(
       int numPartitions,
@@ -99,5 +151,6 @@ class HashPartitionFunctionSpec : public core::PartitionFunctionSpec {
   const RowTypePtr inputType_;
   const std::vector<column_index_t> keyChannels_;
   const std::vector<VectorPtr> constValues_;
+  const std::optional<HotKeyPartitioning> hotKeys_;
 };
 } // namespace facebook::velox::exec
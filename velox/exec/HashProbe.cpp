@@ -16,6 +16,7 @@
 
 #include "velox/exec/HashProbe.h"
 #include "velox/common/base/Counters.h"
+#include "velox/common/base/SimdUtil.h"
 #include "velox/common/base/StatsReporter.h"
 #include "velox/common/testutil/TestValue.h"
 #include "velox/exec/OperatorUtils.h"
@@ -82,6 +83,117 @@ void extractColumns(
   }
 }
 
+template <TypeKind Kind>
+void addValuesToHook(const BaseVector& values, RowSet rows, ValueHook* hook) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  const auto* flat = values.asUnchecked<FlatVector<T>>();
+  for (auto row : rows) {
+    if (flat->isNullAt(row)) {
+      if (hook->acceptsNulls()) {
+        hook->addNull(row);
+      }
+      continue;
+    }
+    if constexpr (std::is_same_v<T, StringView>) {
+      const auto value = flat->valueAt(row);
+      hook->addValue(row, folly::StringPiece(value.data(), value.size()));
+    } else {
+      hook->addValueTyped(row, flat->valueAt(row));
+    }
+  }
+}
+
+// Loads a build side column of the join output from the rows of the join
+// table. The rows pointers are owned by the loader. 'table' is kept alive
+// until the column is loaded.
+class BuildColumnLoader : public VectorLoader {
+ public:
+  BuildColumnLoader(
+      std::shared_ptr<BaseHashTable> table,
+      BufferPtr tableRows,
+      column_index_t column,
+      TypePtr type,
+      memory::MemoryPool* pool)
+      : table_(std::move(table)),
+        tableRows_(std::move(tableRows)),
+        column_(column),
+        type_(std::move(type)),
+        pool_(pool) {}
+
+ protected:
+  void loadInternal(
+      RowSet rows,
+      ValueHook* hook,
+      vector_size_t resultSize,
+      VectorPtr* result) override {
+    const auto* tableRows = tableRows_->as<char*>();
+    std::vector<char*> selectedRows;
+    if (rows.size() != resultSize) {
+      // Extracts only 'rows'. The other positions are set to null.
+      selectedRows.resize(resultSize, nullptr);
+      for (auto row : rows) {
+        selectedRows[row] = tableRows[row];
+      }
+      tableRows = selectedRows.data();
+    }
+    if (hook != nullptr) {
+      auto values = BaseVector::create(type_, resultSize, pool_);
+      table_->extractColumn(
+          folly::Range<char* const*>(tableRows, resultSize), column_, values);
+      switch (type_->kind()) {
+        case TypeKind::BOOLEAN:
+          addValuesToHook<TypeKind::BOOLEAN>(*values, rows, hook);
+          break;
+        case TypeKind::TINYINT:
+          addValuesToHook<TypeKind::TINYINT>(*values, rows, hook);
+          break;
+        case TypeKind::SMALLINT:
+          addValuesToHook<TypeKind::SMALLINT>(*values, rows, hook);
+          break;
+        case TypeKind::INTEGER:
+          addValuesToHook<TypeKind::INTEGER>(*values, rows, hook);
+          break;
+        case TypeKind::BIGINT:
+          addValuesToHook<TypeKind::BIGINT>(*values, rows, hook);
+          break;
+        case TypeKind::HUGEINT:
+          addValuesToHook<TypeKind::HUGEINT>(*values, rows, hook);
+          break;
+        case TypeKind::REAL:
+          addValuesToHook<TypeKind::REAL>(*values, rows, hook);
+          break;
+        case TypeKind::DOUBLE:
+          addValuesToHook<TypeKind::DOUBLE>(*values, rows, hook);
+          break;
+        case TypeKind::VARCHAR:
+        case TypeKind::VARBINARY:
+          addValuesToHook<TypeKind::VARCHAR>(*values, rows, hook);
+          break;
+        default:
+          VELOX_UNSUPPORTED(
+              "ValueHook is not supported for build side column of type {}",
+              type_->toString());
+      }
+      return;
+    }
+    auto& child = *result;
+    if (!child || !BaseVector::isVectorWritable(child) ||
+        !child->isFlatEncoding()) {
+      child = BaseVector::create(type_, resultSize, pool_);
+    }
+    child->resize(resultSize);
+    table_->extractColumn(
+        folly::Range<char* const*>(tableRows, resultSize), column_, child);
+  }
+
+ private:
+  const std::shared_ptr<BaseHashTable> table_;
+  const BufferPtr tableRows_;
+  const column_index_t column_;
+  const TypePtr type_;
+  memory::MemoryPool* const pool_;
+};
+
 BlockingReason fromStateToBlockingReason(ProbeOperatorState state) {
   switch (state) {
     case ProbeOperatorState::kRunning:
@@ -129,7 +241,8 @@ HashProbe::HashProbe(
           operatorId,
           joinNode->id(),
           "HashProbe",
-          joinNode->canSpill(driverCtx->queryConfig())
+          joinNode->canSpill(driverCtx->queryConfig()) &&
+                  !canUseHashTableCache(joinNode, driverCtx->queryConfig())
               ? driverCtx->makeSpillConfig(operatorId)
               : std::nullopt),
       outputBatchSize_{outputBatchRows()},
@@ -159,6 +272,8 @@ void HashProbe::initialize() {
 
   VELOX_CHECK_NULL(lookup_);
   lookup_ = std::make_unique<HashLookup>(hashers_);
+  lookup_->prefetchDistance =
+      operatorCtx_->driverCtx()->queryConfig().hashProbePrefetchDistance();
   auto buildType = joinNode_->sources()[1]->outputType();
   auto tableType = makeTableType(buildType.get(), joinNode_->rightKeys());
   if (joinNode_->filter()) {
@@ -188,6 +303,14 @@ void HashProbe::initialize() {
     }
   }
 
+  // The rows of the table must stay valid until the lazy columns are loaded,
+  // which is not guaranteed if the table can be spilled.
+  lateMaterializeBuildColumns_ = !tableOutputProjections_.empty() &&
+      !canSpill() &&
+      operatorCtx_->driverCtx()
+          ->queryConfig()
+          .hashProbeLateMaterializationEnabled();
+
   if (numIdentityProjections == probeType_->size() &&
       tableOutputProjections_.empty()) {
     isIdentityProjection_ = true;
@@ -196,6 +319,14 @@ void HashProbe::initialize() {
   if (nullAware_) {
     filterTableResult_.resize(1);
   }
+
+  // Only the matching rows matter for inner and semi filter joins without a
+  // filter, so rows with a null key and rows with a key that is not in the
+  // table can be dropped alike.
+  lookupLazyKey_ = keyChannels_.size() == 1 && !filter_ && !nullAware_ &&
+      (joinType_ == core::JoinType::kInner ||
+       joinType_ == core::JoinType::kLeftSemiFilter) &&
+      projectedInputColumns_.count(keyChannels_[0]) == 0;
 }
 
 void HashProbe::initializeFilter(
@@ -430,8 +561,9 @@ void HashProbe::asyncWaitForHashTable() {
        isRightSemiFilterJoin(joinType_) ||
        (isRightSemiProjectJoin(joinType_) && !nullAware_) ||
        isRightJoin(joinType_)) &&
-      table_->hashMode() != BaseHashTable::HashMode::kHash && !isSpillInput() &&
-      !hasMoreSpillData()) {
+      (table_->hashMode() != BaseHashTable::HashMode::kHash ||
+       table_->hasKeyBloomFilters()) &&
+      !isSpillInput() && !hasMoreSpillData()) {
     // Find out whether there are any upstream operators that can accept dynamic
     // filters on all or a subset of the join keys. Create dynamic filters to
     // push down.
@@ -445,11 +577,20 @@ void HashProbe::asyncWaitForHashTable() {
         this, keyChannels_);
 
     for (auto i = 0; i < keyChannels_.size(); ++i) {
-      if (channels.find(keyChannels_[i]) != channels.end()) {
+      if (channels.find(keyChannels_[i]) == channels.end()) {
+        continue;
+      }
+      if (table_->hashMode() != BaseHashTable::HashMode::kHash) {
         if (auto filter = buildHashers[i]->getFilter(/*nullAllowed=*/false)) {
           dynamicFilters_.emplace(keyChannels_[i], std::move(filter));
+          continue;
         }
       }
+      // Fall back to the Bloom filter made by the hash build if the key has
+      // too many distinct values for an exact filter.
+      if (auto filter = table_->keyBloomFilter(i)) {
+        dynamicFilters_.emplace(keyChannels_[i], std::move(filter));
+      }
     }
     hasGeneratedDynamicFilters_ = !dynamicFilters_.empty();
   }
@@ -631,10 +772,13 @@ void HashProbe::clearDynamicFilters() {
   // The join can be completely replaced with a pushed down filter when the
   // following conditions are met:
   //  * hash table has a single key with unique values,
-  //  * build side has no dependent columns.
+  //  * build side has no dependent columns,
+  //  * the pushed down filter is exact, i.e. not a Bloom filter.
   if (keyChannels_.size() == 1 && !table_->hasDuplicateKeys() &&
       tableOutputProjections_.empty() && !filter_ && !dynamicFilters_.empty() &&
-      !isRightJoin(joinType_)) {
+      !isRightJoin(joinType_) &&
+      dynamicFilters_.begin()->second->kind() !=
+          common::FilterKind::kBigintValuesUsingBloomFilter) {
     canReplaceWithDynamicFilter_ = true;
   }
 
@@ -657,6 +801,41 @@ void HashProbe::decodeAndDetectNonNullKeys() {
   }
 }
 
+bool HashProbe::tryLookupLazyKey() {
+  if (!lookupLazyKey_ || needToSpillInput() ||
+      table_->hashMode() == BaseHashTable::HashMode::kHash) {
+    return false;
+  }
+  const auto& key = input_->childAt(keyChannels_[0]);
+  const auto& hasher = table_->hashers()[0];
+  if (!key->isLazy() || key->asUnchecked<LazyVector>()->isLoaded() ||
+      !hasher->canLookupValueIdsFromLazy()) {
+    return false;
+  }
+
+  const auto numInput = input_->size();
+  nonNullInputRows_.resize(numInput);
+  nonNullInputRows_.setAll();
+  lookup_->reset(numInput);
+  // Also deselects the rows with a key that is not in the table.
+  const auto numNullKeys = hasher->lookupValueIdsFromLazy(
+      *key->asUnchecked<LazyVector>(), nonNullInputRows_, lookup_->hashes);
+  {
+    auto lockedStats = stats_.wlock();
+    lockedStats->numNullKeys += numNullKeys;
+  }
+  activeRows_ = nonNullInputRows_;
+
+  auto& rows = lookup_->rows;
+  rows.resize(activeRows_.countSelected());
+  simd::indicesOfSetBits(
+      activeRows_.allBits(),
+      activeRows_.begin(),
+      activeRows_.end(),
+      rows.data());
+  return true;
+}
+
 void HashProbe::addInput(RowVectorPtr input) {
   if (skipInput_) {
     VELOX_CHECK_NULL(input_);
@@ -713,23 +892,25 @@ void HashProbe::addInput(RowVectorPtr input) {
     return;
   }
 
-  if (!hasDecoded) {
-    decodeAndDetectNonNullKeys();
-  }
-  activeRows_ = nonNullInputRows_;
+  if (hasDecoded || !tryLookupLazyKey()) {
+    if (!hasDecoded) {
+      decodeAndDetectNonNullKeys();
+    }
+    activeRows_ = nonNullInputRows_;
 
-  // Update statistics for null keys in join operator.
-  // Updating here means we will report 0 null keys when build side is empty.
-  // If we want more accurate stats, we will have to decode input vector
-  // even when not needed. So we tradeoff less accurate stats for more
-  // performance.
-  {
-    auto lockedStats = stats_.wlock();
-    lockedStats->numNullKeys +=
-        activeRows_.size() - activeRows_.countSelected();
-  }
+    // Update statistics for null keys in join operator.
+    // Updating here means we will report 0 null keys when build side is
+    // empty. If we want more accurate stats, we will have to decode input
+    // vector even when not needed. So we tradeoff less accurate stats for more
+    // performance.
+    {
+      auto lockedStats = stats_.wlock();
+      lockedStats->numNullKeys +=
+          activeRows_.size() - activeRows_.countSelected();
+    }
 
-  table_->prepareForJoinProbe(*lookup_.get(), input_, activeRows_, false);
+    table_->prepareForJoinProbe(*lookup_.get(), input_, activeRows_, false);
+  }
 
   if (joinIncludesMissesFromLeft(joinType_)) {
     // Make sure to allocate an entry in 'hits' for every input row to allow for
@@ -756,10 +937,38 @@ void HashProbe::addInput(RowVectorPtr input) {
     lookup_->hits.resize(lookup_->rows.back() + 1);
     table_->joinProbe(*lookup_);
   }
+  addProbeRuntimeStats();
 
   resultIter_->reset(*lookup_);
 }
 
+void HashProbe::addProbeRuntimeStats() {
+  auto& probeStats = lookup_->probeStats;
+  if (probeStats.numProbes == 0) {
+    return;
+  }
+  {
+    auto lockedStats = stats_.wlock();
+    lockedStats->addRuntimeStat(
+        BaseHashTable::kNumProbes, RuntimeCounter(probeStats.numProbes));
+    lockedStats->addRuntimeStat(
+        BaseHashTable::kNumProbeBucketLoads,
+        RuntimeCounter(probeStats.numBucketLoads));
+    lockedStats->addRuntimeStat(
+        BaseHashTable::kNumProbeRowLoads,
+        RuntimeCounter(probeStats.numRowLoads));
+    lockedStats->addRuntimeStat(
+        BaseHashTable::kNumTagFalsePositives,
+        RuntimeCounter(probeStats.numTagFalsePositives));
+    if (lookup_->prefetchDistance > 0 &&
+        table_->hashMode() == BaseHashTable::HashMode::kHash) {
+      lockedStats->runtimeStats[BaseHashTable::kProbePrefetchDistance] =
+          RuntimeMetric(lookup_->prefetchDistance);
+    }
+  }
+  probeStats = HashProbeStats{};
+}
+
 void HashProbe::prepareOutput(vector_size_t size) {
   // Try to re-use memory for the output vectors that contain build-side data.
   // We expect output vectors containing probe-side data to be null (reset in
@@ -839,6 +1048,8 @@ void HashProbe::fillOutput(vector_size_t size) {
 
   if (isLeftSemiProjectJoin(joinType_)) {
     fillLeftSemiProjectMatchColumn(size);
+  } else if (lateMaterializeBuildColumns_) {
+    fillLazyBuildColumns(size);
   } else {
     extractColumns(
         table_.get(),
@@ -850,6 +1061,24 @@ void HashProbe::fillOutput(vector_size_t size) {
   }
 }
 
+void HashProbe::fillLazyBuildColumns(vector_size_t size) {
+  // 'outputTableRows_' is reused for the next batch, so the loaders get a copy.
+  auto tableRows = AlignedBuffer::allocate<char*>(size, pool());
+  std::memcpy(
+      tableRows->asMutable<char*>(),
+      outputTableRows_->as<char*>(),
+      size * sizeof(char*));
+  for (const auto& projection : tableOutputProjections_) {
+    const auto& type = outputType_->childAt(projection.outputChannel);
+    output_->childAt(projection.outputChannel) = std::make_shared<LazyVector>(
+        pool(),
+        type,
+        size,
+        std::make_unique<BuildColumnLoader>(
+            table_, tableRows, projection.inputChannel, type, pool()));
+  }
+}
+
 RowVectorPtr HashProbe::getBuildSideOutput() {
   auto* outputTableRows =
       initBuffer<char*>(outputTableRows_, outputTableRowsCapacity_, pool());
@@ -1063,7 +1292,7 @@ RowVectorPtr HashProbe::getOutputInternal(bool toSpillOutput) {
   // there is no extra filter we can process each batch of input in one go.
   auto maxOutputBatchRows = (isLeftSemiOrAntiJoinNoFilter || emptyBuildSide)
       ? inputSize
-      : outputBatchSize_;
+      : outputBatchRows();
   outputTableRowsCapacity_ = maxOutputBatchRows;
   if (filter_) {
     if (isLeftJoin(joinType_) || isFullJoin(joinType_) ||
@@ -1088,8 +1317,7 @@ RowVectorPtr HashProbe::getOutputInternal(bool toSpillOutput) {
       initBuffer<char*>(outputTableRows_, outputTableRowsCapacity_, pool());
 
   int numOutputRows = 0;
-  uint64_t maxOutputBatchBytes =
-      operatorCtx_->driverCtx()->queryConfig().preferredOutputBatchBytes();
+  uint64_t maxOutputBatchBytes = outputBatchBytes();
   for (;;) {
     // If the task owning this operator has been cancelled, there is no point
     // to continue executing this procedure, which may be long in degenerate
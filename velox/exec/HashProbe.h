@@ -285,6 +285,21 @@ class HashProbe : public Operator {
   /// Decode join key inputs and populate 'nonNullInputRows_'.
   void decodeAndDetectNonNullKeys();
 
+  // Looks up the single join key of 'input_' in 'table_' if it is a
+  // LazyVector that is not loaded and 'lookupLazyKey_' is true. The key is
+  // loaded into a ValueHook that looks up the value ids, so it is never
+  // materialized. Sets 'activeRows_' and 'lookup_' as prepareForJoinProbe()
+  // would. Returns false if the key is looked up the regular way.
+  bool tryLookupLazyKey();
+
+  // Sets the build side columns of 'output_' to lazy vectors over the first
+  // 'size' rows of 'outputTableRows_'.
+  void fillLazyBuildColumns(vector_size_t size);
+
+  // Adds the table access counters accumulated in 'lookup_' by the last
+  // joinProbe() to the runtime stats and resets them.
+  void addProbeRuntimeStats();
+
   // Invoked when there is no more input from either upstream task or spill
   // input. If there is remaining spilled data, then the last finished probe
   // operator is responsible for notifying the hash build operators to build the
@@ -391,6 +406,10 @@ class HashProbe : public Operator {
   // down to the upstream operators.
   tsan_atomic<bool> hasGeneratedDynamicFilters_{false};
 
+  // True if the join has a single key which is neither projected nor read by
+  // a filter, so that a lazy key may be loaded straight into the lookup.
+  bool lookupLazyKey_{false};
+
   // True if the join can become a no-op starting with the next batch of input.
   bool canReplaceWithDynamicFilter_{false};
 
@@ -472,6 +491,10 @@ class HashProbe : public Operator {
   // maps from column index in 'table_' to channel in 'output_'.
   std::vector<IdentityProjection> tableOutputProjections_;
 
+  // True if the columns in 'tableOutputProjections_' are output as lazy vectors
+  // that extract the values from 'table_' on first use.
+  bool lateMaterializeBuildColumns_{false};
+
   // Rows of table found by join probe, later filtered by 'filter_'.
   BufferPtr outputTableRows_;
   vector_size_t outputTableRowsCapacity_;
@@ -52,10 +52,16 @@ HashTable<ignoreNullKeys>::HashTable(
     bool isJoinBuild,
     bool hasProbedFlag,
     uint32_t minTableSizeForParallelJoinBuild,
-    memory::MemoryPool* pool)
+    memory::MemoryPool* pool,
+    uint64_t radixPartitionBytes,
+    bool wideNormalizedKeys)
     : BaseHashTable(std::move(hashers)),
       minTableSizeForParallelJoinBuild_(minTableSizeForParallelJoinBuild),
-      isJoinBuild_(isJoinBuild) {
+      radixPartitionBytes_(radixPartitionBytes),
+      isJoinBuild_(isJoinBuild),
+      allowWideNormalizedKeys_(
+          isJoinBuild && wideNormalizedKeys && hashers_.size() > 1),
+      numLowWordKeys_(hashers_.size()) {
   std::vector<TypePtr> keys;
   for (auto& hasher : hashers_) {
     keys.push_back(hasher->type());
@@ -73,7 +79,8 @@ HashTable<ignoreNullKeys>::HashTable(
       isJoinBuild,
       hasProbedFlag,
       hashMode_ != HashMode::kHash,
-      pool);
+      pool,
+      allowWideNormalizedKeys_ && hashMode_ != HashMode::kHash);
   nextOffset_ = rows_->nextOffset();
 }
 
@@ -97,6 +104,15 @@ class ProbeState {
     return row_;
   }
 
+  // Adds the number of buckets and rows loaded since the last preProbe() to
+  // 'stats'.
+  void addStats(bool hit, HashProbeStats& stats) const {
+    ++stats.numProbes;
+    stats.numBucketLoads += numBucketLoads_;
+    stats.numRowLoads += numRowLoads_;
+    stats.numTagFalsePositives += numRowLoads_ - hit;
+  }
+
   // Use one instruction to make 16 copies of the tag being searched for
   template <typename Table>
   inline void preProbe(const Table& table, uint64_t hash, int32_t row) {
@@ -106,6 +122,8 @@ class ProbeState {
     wantedTags_ = BaseHashTable::TagVector::broadcast(tag);
     group_ = nullptr;
     indexInTags_ = kNotSet;
+    numBucketLoads_ = 0;
+    numRowLoads_ = 0;
     __builtin_prefetch(
         reinterpret_cast<uint8_t*>(table.table_) + bucketOffset_);
   }
@@ -118,6 +136,7 @@ class ProbeState {
     tagsInTable_ = BaseHashTable::loadTags(
         reinterpret_cast<uint8_t*>(table.table_), bucketOffset_);
     table.incrementTagLoads();
+    ++numBucketLoads_;
     hits_ = simd::toBitMask(tagsInTable_ == wantedTags_);
     if (hits_) {
       loadNextHit<op>(table, firstKey);
@@ -213,6 +232,7 @@ class ProbeState {
       }
       bucketOffset_ = table.nextBucketOffset(bucketOffset_);
       tagsInTable_ = table.loadTags(bucketOffset_);
+      ++numBucketLoads_;
       hits_ = simd::toBitMask(tagsInTable_ == wantedTags_);
     }
     // Throws here if we have looped through all the buckets in the table.
@@ -220,11 +240,25 @@ class ProbeState {
         "Have looped through all the buckets in table: {}", table.toString());
   }
 
-  template <typename Table>
+  // Returns true if the normalized key below 'group' is the key of 'row' in
+  // 'keys'. 'keys' has two words per row for 128 bit normalized keys, which
+  // are compared with one SIMD compare.
+  template <bool kWide>
+  static FOLLY_ALWAYS_INLINE bool
+  normalizedKeyMatches(char* group, const uint64_t* keys, int32_t row) {
+    if constexpr (kWide) {
+      return simd::memEqual16(
+          group - 2 * sizeof(normalized_key_t), keys + 2 * row);
+    } else {
+      return RowContainer::normalizedKey(group) == keys[row];
+    }
+  }
+
+  template <bool kWide, typename Table>
   FOLLY_ALWAYS_INLINE char* joinNormalizedKeyFullProbe(
       const Table& table,
       const uint64_t* keys) {
-    if (group_ && RowContainer::normalizedKey(group_) == keys[row_]) {
+    if (group_ && normalizedKeyMatches<kWide>(group_, keys, row_)) {
       table.incrementHits();
       return group_;
     }
@@ -238,8 +272,9 @@ class ProbeState {
         }
       } else {
         loadNextHit<Operation::kProbe>(
-            table, -static_cast<int32_t>(sizeof(normalized_key_t)));
-        if (RowContainer::normalizedKey(group_) == keys[row_]) {
+            table,
+            -static_cast<int32_t>((kWide ? 2 : 1) * sizeof(normalized_key_t)));
+        if (normalizedKeyMatches<kWide>(group_, keys, row_)) {
           table.incrementHits();
           return group_;
         }
@@ -247,6 +282,7 @@ class ProbeState {
       }
       bucketOffset_ = table.nextBucketOffset(bucketOffset_);
       ++numProbedBuckets;
+      ++numBucketLoads_;
       tagsInTable_ = BaseHashTable::loadTags(
           reinterpret_cast<uint8_t*>(table.table_), bucketOffset_);
       hits_ = simd::toBitMask(tagsInTable_ == wantedTags_) & kFullMask;
@@ -268,6 +304,7 @@ class ProbeState {
     group_ = table.row(bucketOffset_, hit);
     __builtin_prefetch(group_ + firstKey);
     table.incrementRowLoads();
+    ++numRowLoads_;
   }
 
   template <typename Table>
@@ -297,6 +334,10 @@ class ProbeState {
   // empty and thus determining that the item being inserted is not in
   // the table.
   uint8_t indexInTags_ = kNotSet;
+
+  // Number of buckets and rows loaded since the last preProbe().
+  int32_t numBucketLoads_{0};
+  int32_t numRowLoads_{0};
 };
 
 template <bool ignoreNullKeys>
@@ -371,7 +412,8 @@ bool HashTable<ignoreNullKeys>::compareKeys(
   auto numKeys = hashers_.size();
   int32_t i = 0;
   do {
-    if (rows_->compare(group, inserted, i, CompareFlags{true, true})) {
+    if (rows_->compare(
+            group, inserted, i, CompareFlags{true, true, true})) {
       return false;
     }
   } while (++i < numKeys);
@@ -425,6 +467,12 @@ inline uint64_t mixNormalizedKey(uint64_t k, uint8_t bits) {
   return folly::hasher<uint64_t>()(k);
 }
 
+// Makes the hash number of a 128 bit normalized key.
+inline uint64_t mixWideNormalizedKey(uint64_t high, uint64_t low) {
+  return bits::hashMix(
+      folly::hasher<uint64_t>()(high), folly::hasher<uint64_t>()(low));
+}
+
 void populateNormalizedKeys(HashLookup& lookup, int8_t sizeBits) {
   lookup.normalizedKeys.resize(lookup.rows.back() + 1);
   uint64_t* __restrict hashes = lookup.hashes.data();
@@ -446,6 +494,23 @@ void populateNormalizedKeys(HashLookup& lookup, int8_t sizeBits) {
     hashes[row] = mixNormalizedKey(hash, sizeBits);
   }
 }
+
+// Sets the 128 bit normalized keys in 'lookup' from the low word value ids in
+// 'lookup.hashes' and the high word value ids in 'lookup.highValueIds' and
+// replaces 'lookup.hashes' with the hash numbers of the keys.
+void populateWideNormalizedKeys(HashLookup& lookup) {
+  lookup.normalizedKeys.resize(2 * (lookup.rows.back() + 1));
+  uint64_t* __restrict hashes = lookup.hashes.data();
+  const uint64_t* __restrict highIds = lookup.highValueIds.data();
+  uint64_t* __restrict keys = lookup.normalizedKeys.data();
+  for (auto row : lookup.rows) {
+    const auto low = hashes[row];
+    const auto high = highIds[row];
+    keys[2 * row] = high; // NOLINT
+    keys[2 * row + 1] = low; // NOLINT
+    hashes[row] = mixWideNormalizedKey(high, low);
+  }
+}
 } // namespace
 
 template <bool ignoreNullKeys>
@@ -596,13 +661,24 @@ void HashTable<ignoreNullKeys>::joinProbe(HashLookup& lookup) {
     return;
   }
   if (hashMode_ == HashMode::kNormalizedKey) {
-    populateNormalizedKeys(lookup, sizeBits_);
-    joinNormalizedKeyProbe(lookup);
+    if (hasWideNormalizedKeys()) {
+      populateWideNormalizedKeys(lookup);
+      joinNormalizedKeyProbe<true>(lookup);
+    } else {
+      populateNormalizedKeys(lookup, sizeBits_);
+      joinNormalizedKeyProbe<false>(lookup);
+    }
+    return;
+  }
+  const auto probeRows = radixOrderedRows(lookup);
+  if (lookup.prefetchDistance > 0) {
+    pipelinedJoinProbe(lookup, probeRows);
     return;
   }
   int32_t probeIndex = 0;
-  int32_t numProbes = lookup.rows.size();
-  const vector_size_t* rows = lookup.rows.data();
+  int32_t numProbes = probeRows.size();
+  const vector_size_t* rows = probeRows.data();
+  auto& stats = lookup.probeStats;
   ProbeState state1;
   ProbeState state2;
   ProbeState state3;
@@ -624,12 +700,52 @@ void HashTable<ignoreNullKeys>::joinProbe(HashLookup& lookup) {
     fullProbe<true>(lookup, state2, false);
     fullProbe<true>(lookup, state3, false);
     fullProbe<true>(lookup, state4, false);
+    state1.addStats(lookup.hits[state1.row()] != nullptr, stats);
+    state2.addStats(lookup.hits[state2.row()] != nullptr, stats);
+    state3.addStats(lookup.hits[state3.row()] != nullptr, stats);
+    state4.addStats(lookup.hits[state4.row()] != nullptr, stats);
   }
   for (; probeIndex < numProbes; ++probeIndex) {
     int32_t row = rows[probeIndex];
     state1.preProbe(*this, lookup.hashes[row], row);
     state1.firstProbe(*this, 0);
     fullProbe<true>(lookup, state1, false);
+    state1.addStats(lookup.hits[row] != nullptr, stats);
+  }
+}
+
+template <bool ignoreNullKeys>
+void HashTable<ignoreNullKeys>::pipelinedJoinProbe(
+    HashLookup& lookup,
+    folly::Range<const vector_size_t*> rows) {
+  // A ring of probe states. The state of the i-th row is at i & kStateMask.
+  constexpr int32_t kNumStates = kPrefetchSize;
+  constexpr int32_t kStateMask = kNumStates - 1;
+  static_assert((kNumStates & kStateMask) == 0);
+  const int32_t distance =
+      std::min<int32_t>(lookup.prefetchDistance, kNumStates - 1);
+  // The tags of a row are loaded 'tagLead' rows ahead of the full probe. This
+  // gives the prefetch of the first candidate row time to complete.
+  const int32_t tagLead = distance / 2;
+  const int32_t numProbes = rows.size();
+  const uint64_t* hashes = lookup.hashes.data();
+  auto& stats = lookup.probeStats;
+  ProbeState states[kNumStates];
+  for (int32_t i = 0; i < numProbes + distance; ++i) {
+    if (i < numProbes) {
+      const auto row = rows[i];
+      states[i & kStateMask].preProbe(*this, hashes[row], row);
+    }
+    const int32_t tagIndex = i - distance + tagLead;
+    if (tagIndex >= 0 && tagIndex < numProbes) {
+      states[tagIndex & kStateMask].firstProbe(*this, 0);
+    }
+    const int32_t probeIndex = i - distance;
+    if (probeIndex >= 0) {
+      auto& state = states[probeIndex & kStateMask];
+      fullProbe<true>(lookup, state, false);
+      state.addStats(lookup.hits[state.row()] != nullptr, stats);
+    }
   }
 }
 
@@ -676,16 +792,19 @@ void HashTable<ignoreNullKeys>::arrayJoinProbe(HashLookup& lookup) {
 }
 
 template <bool ignoreNullKeys>
+template <bool kWide>
 void HashTable<ignoreNullKeys>::joinNormalizedKeyProbe(HashLookup& lookup) {
+  const auto probeRows = radixOrderedRows(lookup);
   int32_t probeIndex = 0;
-  int32_t numProbes = lookup.rows.size();
-  const vector_size_t* rows = lookup.rows.data();
+  int32_t numProbes = probeRows.size();
+  const vector_size_t* rows = probeRows.data();
   ProbeState states[kPrefetchSize];
   const uint64_t* keys = lookup.normalizedKeys.data();
   const uint64_t* hashes = lookup.hashes.data();
   char** hits = lookup.hits.data();
+  auto& stats = lookup.probeStats;
   constexpr int32_t kKeyOffset =
-      -static_cast<int32_t>(sizeof(normalized_key_t));
+      -static_cast<int32_t>((kWide ? 2 : 1) * sizeof(normalized_key_t));
   for (; probeIndex + kPrefetchSize <= numProbes; probeIndex += kPrefetchSize) {
     for (int32_t i = 0; i < kPrefetchSize; ++i) {
       int32_t row = rows[probeIndex + i];
@@ -695,14 +814,17 @@ void HashTable<ignoreNullKeys>::joinNormalizedKeyProbe(HashLookup& lookup) {
       states[i].firstProbe(*this, kKeyOffset);
     }
     for (int32_t i = 0; i < kPrefetchSize; ++i) {
-      hits[states[i].row()] = states[i].joinNormalizedKeyFullProbe(*this, keys);
+      const auto row = states[i].row();
+      hits[row] = states[i].joinNormalizedKeyFullProbe<kWide>(*this, keys);
+      states[i].addStats(hits[row] != nullptr, stats);
     }
   }
   for (; probeIndex < numProbes; ++probeIndex) {
     int32_t row = rows[probeIndex];
     states[0].preProbe(*this, lookup.hashes[row], row);
     states[0].firstProbe(*this, 0);
-    hits[row] = states[0].joinNormalizedKeyFullProbe(*this, keys);
+    hits[row] = states[0].joinNormalizedKeyFullProbe<kWide>(*this, keys);
+    states[0].addStats(hits[row] != nullptr, stats);
   }
 }
 
@@ -721,6 +843,7 @@ void HashTable<ignoreNullKeys>::allocateTables(
   sizeBits_ = __builtin_popcountll(sizeMask_);
   checkHashBitsOverlap(spillInputStartPartitionBit);
   bucketOffsetMask_ = sizeMask_ & ~(kBucketSize - 1);
+  setRadixPartitionBits(byteSize);
   // The total size is 8 bytes per slot, in groups of 16 slots with 16 bytes of
   // tags and 16 * 6 bytes of pointers and a padding of 16 bytes to round up the
   // cache line.
@@ -748,6 +871,23 @@ void HashTable<ignoreNullKeys>::clear(bool freeTable) {
   }
   numDistinct_ = 0;
   numTombstones_ = 0;
+  keyBloomFilters_.clear();
+}
+
+template <bool ignoreNullKeys>
+uint64_t HashTable<ignoreNullKeys>::compact() {
+  if (isJoinBuild_ || !otherTables_.empty() || !rows_->canCompact()) {
+    return 0;
+  }
+  const auto freedBytes = rows_->compact();
+  if (table_ != nullptr && capacity_ > 0) {
+    // All modes have 8 bytes per slot.
+    ::memset(table_, 0, capacity_ * sizeof(char*));
+    numTombstones_ = 0;
+    // The moved rows keep their normalized keys.
+    rehash(/*initNormalizedKeys=*/false, kNoSpillInputStartPartitionBit);
+  }
+  return freedBytes;
 }
 
 template <bool ignoreNullKeys>
@@ -795,14 +935,24 @@ bool HashTable<ignoreNullKeys>::hashRows(
   if (rows.empty()) {
     return true;
   }
+  const bool wideKeys = hasWideNormalizedKeys();
   if (!initNormalizedKeys && hashMode_ == HashMode::kNormalizedKey) {
     for (auto i = 0; i < rows.size(); ++i) {
-      hashes[i] =
-          mixNormalizedKey(RowContainer::normalizedKey(rows[i]), sizeBits_);
+      hashes[i] = wideKeys
+          ? mixWideNormalizedKey(
+                RowContainer::normalizedKeyHigh(rows[i]),
+                RowContainer::normalizedKey(rows[i]))
+          : mixNormalizedKey(RowContainer::normalizedKey(rows[i]), sizeBits_);
     }
     return true;
   }
 
+  // The value ids of the keys after 'numLowWordKeys_' for 128 bit normalized
+  // keys.
+  raw_vector<uint64_t> highValueIds;
+  if (wideKeys) {
+    highValueIds.resize(rows.size());
+  }
   for (int32_t i = 0; i < hashers_.size(); ++i) {
     auto& hasher = hashers_[i];
     if (hashMode_ == HashMode::kHash) {
@@ -816,7 +966,7 @@ bool HashTable<ignoreNullKeys>::hashRows(
               column.offset(),
               column.nullByte(),
               ignoreNullKeys ? 0 : column.nullMask(),
-              hashes)) {
+              i < numLowWordKeys_ ? hashes : highValueIds)) {
         // Must reconsider 'hashMode_' and start over.
         return false;
       }
@@ -825,7 +975,12 @@ bool HashTable<ignoreNullKeys>::hashRows(
   if (hashMode_ == HashMode::kNormalizedKey && initNormalizedKeys) {
     for (auto i = 0; i < rows.size(); ++i) {
       RowContainer::normalizedKey(rows[i]) = hashes[i];
-      hashes[i] = mixNormalizedKey(hashes[i], sizeBits_);
+      if (wideKeys) {
+        RowContainer::normalizedKeyHigh(rows[i]) = highValueIds[i];
+        hashes[i] = mixWideNormalizedKey(highValueIds[i], hashes[i]);
+      } else {
+        hashes[i] = mixNormalizedKey(hashes[i], sizeBits_);
+      }
     }
   }
   return true;
@@ -870,6 +1025,96 @@ bool HashTable<ignoreNullKeys>::canApplyParallelJoinBuild() const {
       minTableSizeForParallelJoinBuild_;
 }
 
+template <bool ignoreNullKeys>
+void HashTable<ignoreNullKeys>::setRadixPartitionBits(uint64_t byteSize) {
+  // At most 256 partitions so that a partition number fits in the 1 byte per
+  // row of RowPartitions.
+  constexpr int32_t kMaxRadixBits = 8;
+  radixPartitionBits_ = HashBitRange();
+  if (!isJoinBuild_ || radixPartitionBytes_ == 0 ||
+      byteSize < 2 * radixPartitionBytes_) {
+    return;
+  }
+  const int32_t bucketBits = __builtin_ctzll(kBucketSize);
+  const int32_t numBits = std::min<int32_t>(
+      {kMaxRadixBits,
+       sizeBits_ - bucketBits,
+       63 - __builtin_clzll(byteSize / radixPartitionBytes_)});
+  if (numBits <= 0) {
+    return;
+  }
+  radixPartitionBits_ = HashBitRange(sizeBits_ - numBits, sizeBits_);
+}
+
+template <bool ignoreNullKeys>
+void HashTable<ignoreNullKeys>::radixJoinBuild() {
+  process::TraceContext trace("HashTable::radixJoinBuild");
+  const int32_t numPartitions = radixPartitionBits_.numPartitions();
+  const int64_t partitionBytes = (sizeMask_ + 1) / numPartitions;
+  buildPartitionBounds_.resize(numPartitions + 1);
+  for (auto i = 0; i < numPartitions; ++i) {
+    buildPartitionBounds_[i] = partitionBytes * i;
+  }
+  buildPartitionBounds_.back() = sizeMask_ + 1;
+
+  const auto getTable = [this](size_t i) INLINE_LAMBDA {
+    return i == 0 ? this : otherTables_[i - 1].get();
+  };
+  std::vector<std::unique_ptr<RowPartitions>> rowPartitions;
+  rowPartitions.reserve(1 + otherTables_.size());
+  for (auto i = 0; i < 1 + otherTables_.size(); ++i) {
+    auto* table = getTable(i);
+    rowPartitions.push_back(table->rows()->createRowPartitions(*rows_->pool()));
+    partitionRows(*table, *rowPartitions.back(), /*radix=*/true);
+  }
+
+  std::vector<char*> overflows;
+  for (auto partition = 0; partition < numPartitions; ++partition) {
+    buildJoinPartition(partition, rowPartitions, overflows);
+  }
+
+  // The rows that would have gone past the end of their partition are inserted
+  // without a bound.
+  raw_vector<uint64_t> hashes;
+  hashes.resize(overflows.size());
+  hashRows(
+      folly::Range<char**>(overflows.data(), overflows.size()), false, hashes);
+  insertForJoin(
+      rows_.get(),
+      overflows.data(),
+      hashes.data(),
+      overflows.size(),
+      nullptr,
+      &rows_->stringAllocator());
+}
+
+template <bool ignoreNullKeys>
+folly::Range<const vector_size_t*> HashTable<ignoreNullKeys>::radixOrderedRows(
+    HashLookup& lookup) const {
+  const auto numRows = lookup.rows.size();
+  const auto numPartitions = radixPartitionBits_.numPartitions();
+  if (numPartitions == 1 || numRows < 2 * numPartitions) {
+    return folly::Range<const vector_size_t*>(lookup.rows.data(), numRows);
+  }
+  // Counting sort of the rows on their partition number. 'offsets[i + 1]' is
+  // first the size of partition i and then the start of partition i + 1.
+  std::vector<int32_t> offsets(numPartitions + 1, 0);
+  const auto* hashes = lookup.hashes.data();
+  for (auto row : lookup.rows) {
+    ++offsets[radixPartitionBits_.partition(hashes[row]) + 1];
+  }
+  for (auto i = 1; i < numPartitions; ++i) {
+    offsets[i] += offsets[i - 1];
+  }
+  lookup.partitionedRows.resize(numRows);
+  auto* partitionedRows = lookup.partitionedRows.data();
+  for (auto row : lookup.rows) {
+    partitionedRows[offsets[radixPartitionBits_.partition(hashes[row])]++] =
+        row;
+  }
+  return folly::Range<const vector_size_t*>(partitionedRows, numRows);
+}
+
 template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::parallelJoinBuild() {
   process::TraceContext trace("HashTable::parallelJoinBuild");
@@ -1028,7 +1273,8 @@ int32_t findPartition(
 template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::partitionRows(
     HashTable<ignoreNullKeys>& subtable,
-    RowPartitions& rowPartitions) {
+    RowPartitions& rowPartitions,
+    bool radix) {
   constexpr int32_t kBatch = 1024;
   raw_vector<char*> rows(kBatch);
   raw_vector<uint64_t> hashes(kBatch);
@@ -1037,6 +1283,14 @@ void HashTable<ignoreNullKeys>::partitionRows(
   while (auto numRows = subtable.rows_->listRows(
              &iter, kBatch, RowContainer::kUnlimited, rows.data())) {
     hashRows(folly::Range<char**>(rows.data(), numRows), true, hashes);
+    if (radix) {
+      for (auto i = 0; i < numRows; ++i) {
+        partitions[i] = radixPartitionBits_.partition(hashes[i]);
+      }
+      rowPartitions.appendPartitions(
+          folly::Range<const uint8_t*>(partitions.data(), numRows));
+      continue;
+    }
     VELOX_DCHECK_EQ(
         0,
         buildPartitionBounds_.capacity() %
@@ -1066,7 +1320,9 @@ void HashTable<ignoreNullKeys>::buildJoinPartition(
       buildPartitionBounds_[partition + 1],
       overflow};
   const int partitionNum = partition;
-  auto* allocator = (partitionNum == 0)
+  // A radix join build runs on a single thread and uses the allocator of
+  // 'this' for all partitions.
+  auto* allocator = (partitionNum == 0 || joinInsertAllocators_.empty())
       ? &rows_->stringAllocator()
       : joinInsertAllocators_[partitionNum - 1].get();
   VELOX_CHECK_NOT_NULL(allocator);
@@ -1192,6 +1448,19 @@ void HashTable<ignoreNullKeys>::pushNext(
   rows->appendNextRow(row, next, allocator);
 }
 
+template <bool ignoreNullKeys>
+FOLLY_ALWAYS_INLINE bool HashTable<ignoreNullKeys>::normalizedKeysEqual(
+    char* group,
+    char* inserted) const {
+  if (hasWideNormalizedKeys()) {
+    return simd::memEqual16(
+        group - 2 * sizeof(normalized_key_t),
+        inserted - 2 * sizeof(normalized_key_t));
+  }
+  return RowContainer::normalizedKey(group) ==
+      RowContainer::normalizedKey(inserted);
+}
+
 template <bool ignoreNullKeys>
 template <bool isNormailizedKeyMode>
 FOLLY_ALWAYS_INLINE void HashTable<ignoreNullKeys>::buildFullProbe(
@@ -1217,8 +1486,7 @@ FOLLY_ALWAYS_INLINE void HashTable<ignoreNullKeys>::buildFullProbe(
         *this,
         kKeyOffset,
         [&](char* group, int32_t /*row*/) {
-          if (RowContainer::normalizedKey(group) ==
-              RowContainer::normalizedKey(inserted)) {
+          if (normalizedKeysEqual(group, inserted)) {
             if (nextOffset_ > 0) {
               pushNext(rows, group, inserted, allocator);
             }
@@ -1332,6 +1600,11 @@ void HashTable<ignoreNullKeys>::rehash(
     parallelJoinBuild();
     return;
   }
+  if (isJoinBuild_ && hashMode_ != HashMode::kArray &&
+      radixPartitionBits_.numPartitions() > 1) {
+    radixJoinBuild();
+    return;
+  }
   raw_vector<uint64_t> hashes;
   hashes.resize(kHashBatchSize);
   char* groups[kHashBatchSize];
@@ -1372,6 +1645,7 @@ void HashTable<ignoreNullKeys>::setHashMode(
     rehash(true, spillInputStartPartitionBit);
   } else if (mode == HashMode::kHash) {
     hashMode_ = HashMode::kHash;
+    numLowWordKeys_ = hashers_.size();
     for (auto& hasher : hashers_) {
       hasher->resetStats();
     }
@@ -1501,6 +1775,61 @@ uint64_t HashTable<ignoreNullKeys>::setHasherMode(
   return multiplier;
 }
 
+template <bool ignoreNullKeys>
+bool HashTable<ignoreNullKeys>::setWideHasherMode(
+    const std::vector<uint64_t>& rangeSizes,
+    const std::vector<uint64_t>& distinctSizes) {
+  const auto numKeys = hashers_.size();
+  std::vector<bool> useRange(numKeys);
+  std::vector<uint64_t> sizes(numKeys);
+  for (auto i = 0; i < numKeys; ++i) {
+    if (rangeSizes[i] != VectorHasher::kRangeTooLarge &&
+        (distinctSizes[i] == VectorHasher::kRangeTooLarge ||
+         rangeSizes[i] <= distinctSizes[i] * 20)) {
+      useRange[i] = true;
+      sizes[i] = rangeSizes[i];
+    } else if (distinctSizes[i] != VectorHasher::kRangeTooLarge) {
+      sizes[i] = distinctSizes[i];
+    } else {
+      return false;
+    }
+  }
+  // The leading keys go in the low word as long as their product fits and
+  // the rest go in the high word. Each word must have at least one key.
+  int32_t split = 0;
+  uint64_t lowProduct = 1;
+  for (; split < numKeys - 1; ++split) {
+    const auto product = safeMul(lowProduct, sizes[split]);
+    if (product == VectorHasher::kRangeTooLarge) {
+      break;
+    }
+    lowProduct = product;
+  }
+  if (split == 0) {
+    return false;
+  }
+  uint64_t highProduct = 1;
+  for (auto i = split; i < numKeys; ++i) {
+    highProduct = safeMul(highProduct, sizes[i]);
+    if (highProduct == VectorHasher::kRangeTooLarge) {
+      return false;
+    }
+  }
+
+  uint64_t multiplier = 1;
+  for (auto i = 0; i < numKeys; ++i) {
+    if (i == split) {
+      multiplier = 1;
+    }
+    multiplier = useRange[i]
+        ? hashers_[i]->enableValueRange(multiplier, reservePct())
+        : hashers_[i]->enableValueIds(multiplier, reservePct());
+    VELOX_CHECK_NE(multiplier, VectorHasher::kRangeTooLarge);
+  }
+  numLowWordKeys_ = split;
+  return true;
+}
+
 template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::clearUseRange(std::vector<bool>& useRange) {
   for (auto i = 0; i < hashers_.size(); ++i) {
@@ -1526,6 +1855,7 @@ void HashTable<ignoreNullKeys>::decideHashMode(
     return;
   }
   disableRangeArrayHash_ |= disableRangeArrayHash;
+  numLowWordKeys_ = hashers_.size();
   if (numDistinct_ && !isJoinBuild_) {
     if (!analyze()) {
       setHashMode(HashMode::kHash, numNew, spillInputStartPartitionBit);
@@ -1584,6 +1914,12 @@ void HashTable<ignoreNullKeys>::decideHashMode(
   }
   if (distinctsWithReserve == VectorHasher::kRangeTooLarge &&
       rangesWithReserve == VectorHasher::kRangeTooLarge) {
+    if (allowWideNormalizedKeys_ &&
+        setWideHasherMode(rangeSizes, distinctSizes)) {
+      setHashMode(
+          HashMode::kNormalizedKey, numNew, spillInputStartPartitionBit);
+      return;
+    }
     setHashMode(HashMode::kHash, numNew, spillInputStartPartitionBit);
     return;
   }
@@ -1621,8 +1957,9 @@ template <bool ignoreNullKeys>
 std::string HashTable<ignoreNullKeys>::toString() {
   std::stringstream out;
   out << "[HashTable keys: " << hashers_.size()
-      << " hash mode: " << modeString(hashMode_) << " capacity: " << capacity_
-      << " distinct count: " << numDistinct_
+      << " hash mode: " << modeString(hashMode_)
+      << (hasWideNormalizedKeys() ? " (128 bit)" : "")
+      << " capacity: " << capacity_ << " distinct count: " << numDistinct_
       << " tombstones count: " << numTombstones_ << "]";
   if (table_ == nullptr) {
     out << " (no table)";
@@ -2089,6 +2426,7 @@ int32_t HashTable<true>::listNullKeyRows(
 
 template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::erase(folly::Range<char**> rows) {
+  VELOX_CHECK(!hasWideNormalizedKeys());
   auto numRows = rows.size();
   raw_vector<uint64_t> hashes;
   hashes.resize(numRows);
@@ -2281,6 +2619,9 @@ void HashTable<ignoreNullKeys>::prepareForJoinProbe(
   }
 
   lookup.reset(rows.end());
+  if (hasWideNormalizedKeys()) {
+    lookup.highValueIds.resize(rows.end());
+  }
 
   const auto mode = hashMode();
   for (auto i = 0; i < hashers.size(); ++i) {
@@ -2288,7 +2629,10 @@ void HashTable<ignoreNullKeys>::prepareForJoinProbe(
     if (mode != BaseHashTable::HashMode::kHash) {
       auto& key = input->childAt(hasher->channel());
       hashers_[i]->lookupValueIds(
-          *key, rows, lookup.scratchMemory, lookup.hashes);
+          *key,
+          rows,
+          lookup.scratchMemory,
+          i < numLowWordKeys_ ? lookup.hashes : lookup.highValueIds);
     } else {
       hasher->hash(rows, i > 0, lookup.hashes);
     }
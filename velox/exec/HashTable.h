@@ -17,6 +17,7 @@
 
 #include "velox/common/base/Portability.h"
 #include "velox/common/memory/MemoryAllocator.h"
+#include "velox/exec/HashBitRange.h"
 #include "velox/exec/Operator.h"
 #include "velox/exec/RowContainer.h"
 #include "velox/exec/VectorHasher.h"
@@ -54,6 +55,20 @@ struct TableInsertPartitionInfo {
 };
 
 /// Contains input and output parameters for groupProbe and joinProbe APIs.
+/// Counters of the table accesses made by HashTable::joinProbe in kHash and
+/// kNormalizedKey modes. The average probe chain length is 'numBucketLoads' /
+/// 'numProbes' and the tag false positive rate is 'numTagFalsePositives' /
+/// 'numRowLoads'.
+struct HashProbeStats {
+  int64_t numProbes{0};
+  /// Number of 16 slot buckets whose tags were compared.
+  int64_t numBucketLoads{0};
+  /// Number of rows whose keys were compared after a tag match.
+  int64_t numRowLoads{0};
+  /// Number of rows loaded after a tag match that did not match the key.
+  int64_t numTagFalsePositives{0};
+};
+
 struct HashLookup {
   explicit HashLookup(const std::vector<std::unique_ptr<VectorHasher>>& h)
       : hashers(h) {}
@@ -80,6 +95,11 @@ struct HashLookup {
   /// the row number.
   raw_vector<uint64_t> hashes;
 
+  /// Value IDs of the keys in the high word of a 128 bit normalized key. Only
+  /// used by joinProbe if the table has wide normalized keys. 'hashes' then
+  /// has the value ids of the keys in the low word. Index is the row number.
+  raw_vector<uint64_t> highValueIds;
+
   /// Results of groupProbe and joinProbe APIs.
 
   /// Contains one entry for each row in 'rows'. Index is the row number.
@@ -93,8 +113,23 @@ struct HashLookup {
   std::vector<vector_size_t> newGroups;
 
   /// If using valueIds, list of concatenated valueIds. 1:1 with 'hashes'.
-  /// Populated by groupProbe and joinProbe.
+  /// Populated by groupProbe and joinProbe. With wide normalized keys, there
+  /// are two words per row, the high word at 2 * row and the low word at 2 *
+  /// row + 1, in the order these are stored below a row in the table.
   raw_vector<uint64_t> normalizedKeys;
+
+  /// Scratch memory used by joinProbe to hold 'rows' grouped by the radix
+  /// partition of their hash number if the join table is radix partitioned.
+  raw_vector<vector_size_t> partitionedRows;
+
+  /// Number of rows ahead of the row being probed for which joinProbe in kHash
+  /// mode prefetches the table bucket. The tags of a row are compared half way
+  /// to the probe so that the first candidate row is also prefetched. 0 probes
+  /// 4 rows at a time without a pipeline.
+  int32_t prefetchDistance{0};
+
+  /// Accumulated by joinProbe. Reset by the caller.
+  HashProbeStats probeStats;
 };
 
 struct HashTableStats {
@@ -103,6 +138,8 @@ struct HashTableStats {
   int64_t numDistinct{0};
   /// Counts the number of tombstone table slots.
   int64_t numTombstones{0};
+  /// Number of radix partitions of a join table. 1 if not radix partitioned.
+  int64_t numRadixPartitions{1};
 };
 
 class BaseHashTable {
@@ -132,6 +169,23 @@ class BaseHashTable {
 
   /// The same as above but only reported by the HashBuild operator.
   static inline const std::string kBuildWallNanos{"hashtable.buildWallNanos"};
+  static inline const std::string kNumRadixPartitions{
+      "hashtable.numRadixPartitions"};
+  static inline const std::string kNumCacheHits{"hashtable.numCacheHits"};
+  static inline const std::string kNumHotKeys{"hashtable.numHotKeys"};
+  static inline const std::string kMaxHotKeyRows{"hashtable.maxHotKeyRows"};
+
+  /// The same as above but only reported by the HashProbe operator. See
+  /// HashProbeStats.
+  static inline const std::string kNumProbes{"hashtable.numProbes"};
+  static inline const std::string kNumProbeBucketLoads{
+      "hashtable.numProbeBucketLoads"};
+  static inline const std::string kNumProbeRowLoads{
+      "hashtable.numProbeRowLoads"};
+  static inline const std::string kNumTagFalsePositives{
+      "hashtable.numTagFalsePositives"};
+  static inline const std::string kProbePrefetchDistance{
+      "hashtable.probePrefetchDistance"};
 
   /// Returns the string of the given 'mode'.
   static std::string modeString(HashMode mode);
@@ -302,6 +356,12 @@ class BaseHashTable {
   /// not freed which can be used for flushing a partial group by, for example.
   virtual void clear(bool freeTable) = 0;
 
+  /// Moves the rows of a group by table into dense allocations and rebuilds
+  /// the table over the moved rows. Returns the number of freed row
+  /// allocation bytes, or 0 if the rows can't be moved. Invalidates all
+  /// pointers to the rows and iterators over them.
+  virtual uint64_t compact() = 0;
+
   /// Returns the capacity of the internal hash table which is number of rows
   /// it can stores in a group by or hash join build.
   virtual uint64_t capacity() const = 0;
@@ -411,6 +471,45 @@ class BaseHashTable {
     return offThreadBuildTiming_;
   }
 
+  /// Sets the Bloom filters over the join keys built by the hash build. There
+  /// is one entry per key, which is null if no filter is available for that
+  /// key.
+  void setKeyBloomFilters(
+      std::vector<std::shared_ptr<common::Filter>> keyBloomFilters) {
+    VELOX_CHECK_EQ(keyBloomFilters.size(), hashers_.size());
+    keyBloomFilters_ = std::move(keyBloomFilters);
+  }
+
+  /// Returns true if there is a Bloom filter for at least one join key.
+  bool hasKeyBloomFilters() const {
+    return !keyBloomFilters_.empty();
+  }
+
+  /// Returns the Bloom filter over the values of the 'keyIndex'th join key or
+  /// null if there is none. The filter may pass values that are not in the
+  /// table but never rejects a value that is.
+  std::shared_ptr<common::Filter> keyBloomFilter(int32_t keyIndex) const {
+    if (keyBloomFilters_.empty()) {
+      return nullptr;
+    }
+    return keyBloomFilters_[keyIndex];
+  }
+
+  /// Sets the hashes of the hot join keys found by the hash build. A hot key
+  /// has a large fraction of the build rows.
+  void setHotKeyHashes(std::vector<uint64_t> hotKeyHashes) {
+    hotKeyHashes_ = std::move(hotKeyHashes);
+  }
+
+  /// Returns the hashes of the hot join keys, most frequent first. These are
+  /// the hashes of the key columns computed by VectorHasher::hash() as in
+  /// HashPartitionFunction, so they can be used in a HotKeyPartitioning to
+  /// spread the hot keys over more than one partition. Empty if skew
+  /// detection is off or found no hot keys.
+  const std::vector<uint64_t>& hotKeyHashes() const {
+    return hotKeyHashes_;
+  }
+
   /// Copies the values at 'columnIndex' into 'result' for the 'rows.size' rows
   /// pointed to by 'rows'. If an entry in 'rows' is null, sets corresponding
   /// row in 'result' to null.
@@ -435,6 +534,14 @@ class BaseHashTable {
 
   // Time spent in build outside of the calling thread.
   CpuWallTiming offThreadBuildTiming_;
+
+  // Optional Bloom filters over the join keys. Set by the hash build for use as
+  // dynamic filters on the probe side.
+  std::vector<std::shared_ptr<common::Filter>> keyBloomFilters_;
+
+  // Hashes of the hot join keys. Set by the hash build if skew detection is
+  // on.
+  std::vector<uint64_t> hotKeyHashes_;
 };
 
 FOLLY_ALWAYS_INLINE std::ostream& operator<<(
@@ -459,7 +566,12 @@ class HashTable : public BaseHashTable {
   // second occurrences of a key are to be silently ignored or will
   // not occur. In this case the row does not need a link to the next
   // match. 'hasProbedFlag' adds an extra bit in every row for tracking rows
-  // that matches join condition for right and full outer joins.
+  // that matches join condition for right and full outer joins. If
+  // 'radixPartitionBytes' is non-zero, a join table larger than this is split
+  // into radix partitions of about this size. See 'radixPartitionBits_'. If
+  // 'wideNormalizedKeys' is true, a join table with multiple keys whose value
+  // ids don't fit in 64 bits may use a 128 bit normalized key instead of
+  // kHash mode. This reserves 16 instead of 8 bytes below each row.
   HashTable(
       std::vector<std::unique_ptr<VectorHasher>>&& hashers,
       const std::vector<Accumulator>& accumulators,
@@ -468,7 +580,9 @@ class HashTable : public BaseHashTable {
       bool isJoinBuild,
       bool hasProbedFlag,
       uint32_t minTableSizeForParallelJoinBuild,
-      memory::MemoryPool* pool);
+      memory::MemoryPool* pool,
+      uint64_t radixPartitionBytes = 0,
+      bool wideNormalizedKeys = false);
 
   ~HashTable() override = default;
 
@@ -493,7 +607,9 @@ class HashTable : public BaseHashTable {
       bool allowDuplicates,
       bool hasProbedFlag,
       uint32_t minTableSizeForParallelJoinBuild,
-      memory::MemoryPool* pool) {
+      memory::MemoryPool* pool,
+      uint64_t radixPartitionBytes = 0,
+      bool wideNormalizedKeys = false) {
     return std::make_unique<HashTable>(
         std::move(hashers),
         std::vector<Accumulator>{},
@@ -502,7 +618,9 @@ class HashTable : public BaseHashTable {
         true, // isJoinBuild
         hasProbedFlag,
         minTableSizeForParallelJoinBuild,
-        pool);
+        pool,
+        radixPartitionBytes,
+        wideNormalizedKeys);
   }
 
   void groupProbe(HashLookup& lookup, int8_t spillInputStartPartitionBit)
@@ -543,6 +661,8 @@ class HashTable : public BaseHashTable {
 
   void clear(bool freeTable) override;
 
+  uint64_t compact() override;
+
   int64_t allocatedBytes() const override {
     // For each row: sizeof(char*) per table entry + memory
     // allocated with MemoryAllocator for fixed-width rows and strings.
@@ -563,7 +683,11 @@ class HashTable : public BaseHashTable {
 
   HashTableStats stats() const override {
     return HashTableStats{
-        capacity_, numRehashes_, numDistinct_, numTombstones_};
+        capacity_,
+        numRehashes_,
+        numDistinct_,
+        numTombstones_,
+        radixPartitionBits_.numPartitions()};
   }
 
   bool hasDuplicateKeys() const override {
@@ -574,6 +698,14 @@ class HashTable : public BaseHashTable {
     return hashMode_;
   }
 
+  /// Returns true if the table is in kNormalizedKey mode with 128 bit
+  /// normalized keys. The first 'numLowWordKeys_' keys make the low word and
+  /// the other keys the high word.
+  bool hasWideNormalizedKeys() const {
+    return hashMode_ == HashMode::kNormalizedKey &&
+        numLowWordKeys_ < hashers_.size();
+  }
+
   void decideHashMode(
       int32_t numNew,
       int8_t spillInputStartPartitionBit,
@@ -659,6 +791,12 @@ class HashTable : public BaseHashTable {
         result);
   }
 
+  /// Returns the number of radix partitions of the join table. 1 if the table
+  /// is not radix partitioned.
+  int32_t numRadixPartitions() const {
+    return radixPartitionBits_.numPartitions();
+  }
+
   auto& testingOtherTables() const {
     return otherTables_;
   }
@@ -784,6 +922,16 @@ class HashTable : public BaseHashTable {
   // VectorHashers.
   void clearUseRange(std::vector<bool>& useRange);
 
+  // Splits the keys into two groups whose value ids each fit in 64 bits and
+  // sets the VectorHashers for a 128 bit normalized key. Returns false and
+  // changes nothing if the keys don't fit in 128 bits.
+  bool setWideHasherMode(
+      const std::vector<uint64_t>& rangeSizes,
+      const std::vector<uint64_t>& distinctSizes);
+
+  // Returns true if rows 'group' and 'inserted' have the same normalized key.
+  bool normalizedKeysEqual(char* group, char* inserted) const;
+
   void rehash(bool initNormalizedKeys, int8_t spillInputStartPartitionBit);
 
   uint64_t rehashSize() const {
@@ -858,6 +1006,21 @@ class HashTable : public BaseHashTable {
   // else.
   void parallelJoinBuild();
 
+  // Sets 'radixPartitionBits_' for a join table of 'byteSize' bytes.
+  void setRadixPartitionBits(uint64_t byteSize);
+
+  // Builds a join table partition by partition on the calling thread. Like
+  // parallelJoinBuild(), first assigns a partition to each row and then
+  // inserts all rows of one partition before the next. The partitions are the
+  // top bits of the bucket offset, so that all inserts of a partition go to a
+  // range of buckets that fits in the cache.
+  void radixJoinBuild();
+
+  // Returns 'lookup.rows' grouped by radix partition of their hash number so
+  // that consecutive probes hit the same cache sized range of buckets. Returns
+  // 'lookup.rows' as is if the table is not radix partitioned.
+  folly::Range<const vector_size_t*> radixOrderedRows(HashLookup& lookup) const;
+
   // Inserts the rows in 'partition' from this and 'otherTables' into 'this'.
   // The rows that would have gone past the end of the partition are returned in
   // 'overflow'.
@@ -868,10 +1031,13 @@ class HashTable : public BaseHashTable {
 
   // Assigns a partition to each row of 'subtable' in RowPartitions of
   // subtable's RowContainer. If 'hashMode_' is kNormalizedKeys, records the
-  // normalized key of each row below the row in its container.
+  // normalized key of each row below the row in its container. If 'radix' is
+  // true, the partition is given by 'radixPartitionBits_', otherwise by
+  // 'buildPartitionBounds_'.
   void partitionRows(
       HashTable<ignoreNullKeys>& subtable,
-      RowPartitions& rowPartitions);
+      RowPartitions& rowPartitions,
+      bool radix = false);
 
   // Calculates hashes for 'rows' and returns them in 'hashes'. If
   // 'initNormalizedKeys' is true, the normalized keys are stored below each row
@@ -899,9 +1065,17 @@ class HashTable : public BaseHashTable {
   // Array probe with SIMD.
   void arrayJoinProbe(HashLookup& lookup);
 
-  // Shortcut for probe with normalized keys.
+  // Shortcut for probe with normalized keys. 'kWide' is true for 128 bit
+  // normalized keys.
+  template <bool kWide>
   void joinNormalizedKeyProbe(HashLookup& lookup);
 
+  // Probe in kHash mode that prefetches the buckets of the rows
+  // 'lookup.prefetchDistance' positions ahead of the row being probed.
+  void pipelinedJoinProbe(
+      HashLookup& lookup,
+      folly::Range<const vector_size_t*> rows);
+
   // Returns the total size of the variable size 'columns' in 'row'.
   // NOTE: No checks are done in the method for performance considerations.
   // Caller needs to make sure only variable size columns are inside of
@@ -1038,9 +1212,28 @@ class HashTable : public BaseHashTable {
   // The min table size in row to trigger parallel join table build.
   const uint32_t minTableSizeForParallelJoinBuild_;
 
+  // The target size in bytes of a radix partition of a join table. 0 if radix
+  // partitioning is disabled.
+  const uint64_t radixPartitionBytes_;
+
+  // The bits of the hash number that select the radix partition of a join
+  // table. These are the top bits of the bucket offset, so that each partition
+  // is a contiguous range of about 'radixPartitionBytes_' of 'table_'. Empty if
+  // the table is not radix partitioned.
+  HashBitRange radixPartitionBits_;
+
   int8_t sizeBits_;
   bool isJoinBuild_ = false;
 
+  // True if the table may use a 128 bit normalized key. Only for join builds
+  // with more than one key.
+  const bool allowWideNormalizedKeys_;
+
+  // The number of leading keys whose value ids make the low word of a 128 bit
+  // normalized key. The other keys make the high word. Equal to the number of
+  // keys if the normalized key is one word.
+  int32_t numLowWordKeys_;
+
   // Set at join build time if the table has duplicates, meaning that
   // the join can be cardinality increasing. Atomic for tsan because
   // many threads can set this.
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/HashTableCache.h"
+
+#include <folly/json.h>
+
+namespace facebook::velox::exec {
+namespace {
+const std::string kQueryStateKey{"HashTableCache"};
+
+// Removes the plan node ids from serialized plan 'node' so that the same
+// subtree planned in different stages gives the same key.
+void removePlanNodeIds(folly::dynamic& node) {
+  if (!node.isObject()) {
+    return;
+  }
+  node.erase("id");
+  auto sources = node.get_ptr("sources");
+  if (sources == nullptr || !sources->isArray()) {
+    return;
+  }
+  for (auto& source : *sources) {
+    removePlanNodeIds(source);
+  }
+}
+} // namespace
+
+HashTableCache::HashTableCache(memory::MemoryPool* queryPool)
+    : pool_(queryPool->addLeafChild("HashTableCache")) {}
+
+// static
+std::shared_ptr<HashTableCache> HashTableCache::getInstance(
+    core::QueryCtx& queryCtx) {
+  return std::static_pointer_cast<HashTableCache>(
+      queryCtx.getOrCreateQueryState(kQueryStateKey, [&]() {
+        return std::make_shared<HashTableCache>(queryCtx.pool());
+      }));
+}
+
+// static
+std::optional<std::string> HashTableCache::makeKey(
+    const core::HashJoinNode& joinNode) {
+  folly::dynamic buildPlan;
+  try {
+    buildPlan = joinNode.sources()[1]->serialize();
+  } catch (const std::exception&) {
+    return std::nullopt;
+  }
+  removePlanNodeIds(buildPlan);
+
+  std::stringstream key;
+  key << core::joinTypeName(joinNode.joinType());
+  for (const auto& rightKey : joinNode.rightKeys()) {
+    key << " " << rightKey->name();
+  }
+  if (joinNode.filter() != nullptr) {
+    key << ", filter: " << joinNode.filter()->toString();
+  }
+  if (joinNode.isNullAware()) {
+    key << ", null aware";
+  }
+  key << " " << folly::toJson(buildPlan);
+  return key.str();
+}
+
+std::optional<HashTableCache::Entry> HashTableCache::get(
+    const std::string& key,
+    bool& isBuilder) {
+  isBuilder = false;
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    return it->second;
+  }
+  isBuilder = pendingKeys_.insert(key).second;
+  return std::nullopt;
+}
+
+std::shared_ptr<BaseHashTable> HashTableCache::put(
+    const std::string& key,
+    std::unique_ptr<BaseHashTable> table,
+    bool hasNullKeys) {
+  VELOX_CHECK_NOT_NULL(table);
+  // The deleter keeps the pool alive until the table is freed, which may be
+  // after the cache is gone.
+  std::shared_ptr<BaseHashTable> sharedTable(
+      table.release(), [pool = pool_](BaseHashTable* table) { delete table; });
+
+  std::lock_guard<std::mutex> l(mutex_);
+  VELOX_CHECK_EQ(
+      pendingKeys_.erase(key), 1, "Hash table cache key is not reserved");
+  VELOX_CHECK_EQ(entries_.count(key), 0);
+  entries_.emplace(key, Entry{sharedTable, hasNullKeys});
+  return sharedTable;
+}
+
+void HashTableCache::abandon(const std::string& key) {
+  std::lock_guard<std::mutex> l(mutex_);
+  pendingKeys_.erase(key);
+}
+
+size_t HashTableCache::evictUnused() {
+  std::vector<std::shared_ptr<BaseHashTable>> unusedTables;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      if (it->second.table.use_count() == 1) {
+        unusedTables.push_back(std::move(it->second.table));
+        it = entries_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+  // Frees the tables outside of the lock.
+  const auto numEvicted = unusedTables.size();
+  unusedTables.clear();
+  return numEvicted;
+}
+} // namespace facebook::velox::exec
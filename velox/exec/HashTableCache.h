@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/core/PlanNode.h"
+#include "velox/core/QueryCtx.h"
+#include "velox/exec/HashTable.h"
+
+namespace facebook::velox::exec {
+
+/// Query-scoped cache of built hash join tables. Joins with the same build
+/// side, e.g. the same dimension table joined in several stages of a star
+/// schema query, build the table once and share it between their probes.
+/// Cached tables are allocated from a leaf pool of the query memory pool and
+/// are reference counted: a table stays alive while it is cached or used by a
+/// probe. Unused tables are evicted on memory reclaim.
+class HashTableCache {
+ public:
+  struct Entry {
+    std::shared_ptr<BaseHashTable> table;
+    bool hasNullKeys{false};
+  };
+
+  explicit HashTableCache(memory::MemoryPool* queryPool);
+
+  /// Returns the cache of the query of 'queryCtx', creating it on first use.
+  static std::shared_ptr<HashTableCache> getInstance(core::QueryCtx& queryCtx);
+
+  /// Returns the key under which the table built for 'joinNode' is cached.
+  /// Joins with the same key build identical tables. The key covers the join
+  /// type, keys and filter and the build side plan without plan node ids.
+  /// Returns std::nullopt if the build side plan can't be serialized.
+  static std::optional<std::string> makeKey(
+      const core::HashJoinNode& joinNode);
+
+  /// Returns the cached table for 'key' if there is one. Otherwise, if no
+  /// other task is building the table for 'key', reserves 'key' for the caller
+  /// and sets 'isBuilder' to true. The caller must then call put() or
+  /// abandon(). A caller that is neither served nor the builder builds its own
+  /// table instead of waiting for the other build to finish.
+  std::optional<Entry> get(const std::string& key, bool& isBuilder);
+
+  /// Caches 'table' under 'key' reserved by get(). 'table' must be allocated
+  /// from pool(). Returns the shared table to hand over to the probe.
+  std::shared_ptr<BaseHashTable> put(
+      const std::string& key,
+      std::unique_ptr<BaseHashTable> table,
+      bool hasNullKeys);
+
+  /// Releases 'key' reserved by get() without caching a table.
+  void abandon(const std::string& key);
+
+  /// Drops the cached tables that are not used by any probe. Returns the
+  /// number of dropped tables.
+  size_t evictUnused();
+
+  /// The memory pool to allocate the cached tables from.
+  memory::MemoryPool* pool() const {
+    return pool_.get();
+  }
+
+  size_t numEntries() const {
+    std::lock_guard<std::mutex> l(mutex_);
+    return entries_.size();
+  }
+
+ private:
+  const std::shared_ptr<memory::MemoryPool> pool_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, Entry> entries_;
+  // Keys whose tables are being built.
+  std::unordered_set<std::string> pendingKeys_;
+};
+} // namespace facebook::velox::exec
@@ -16,6 +16,35 @@
 #include "velox/exec/Limit.h"
 
 namespace facebook::velox::exec {
+namespace {
+// Returns true if 'vector' can be sliced without loading or copying. Slicing
+// a lazy vector requires it to be loaded and some encodings do not support
+// slicing.
+bool canSlice(const BaseVector& vector) {
+  switch (vector.encoding()) {
+    case VectorEncoding::Simple::FLAT:
+    case VectorEncoding::Simple::ARRAY:
+    case VectorEncoding::Simple::MAP:
+    case VectorEncoding::Simple::CONSTANT:
+    case VectorEncoding::Simple::DICTIONARY:
+      return true;
+    case VectorEncoding::Simple::ROW:
+      for (const auto& child : vector.asUnchecked<RowVector>()->children()) {
+        if (child && !canSlice(*child)) {
+          return false;
+        }
+      }
+      return true;
+    case VectorEncoding::Simple::LAZY: {
+      const auto* lazy = vector.asUnchecked<LazyVector>();
+      return lazy->isLoaded() && canSlice(*lazy->loadedVector());
+    }
+    default:
+      return false;
+  }
+}
+} // namespace
+
 Limit::Limit(
     int32_t operatorId,
     DriverCtx* driverCtx,
@@ -64,11 +93,17 @@ RowVectorPtr Limit::getOutput() {
     const auto outputSize =
         std::min(inputSize - remainingOffset_, remainingLimit_);
 
-    BufferPtr indices = allocateIndices(outputSize, pool());
-    auto* rawIndices = indices->asMutable<vector_size_t>();
-    std::iota(rawIndices, rawIndices + outputSize, remainingOffset_);
-
-    auto output = fillOutput(outputSize, indices);
+    RowVectorPtr output;
+    if (canSlice(*input_)) {
+      // Shares the buffers of 'input_' and keeps the encodings of the columns.
+      output = std::static_pointer_cast<RowVector>(
+          input_->slice(remainingOffset_, outputSize));
+    } else {
+      BufferPtr indices = allocateIndices(outputSize, pool());
+      auto* rawIndices = indices->asMutable<vector_size_t>();
+      std::iota(rawIndices, rawIndices + outputSize, remainingOffset_);
+      output = fillOutput(outputSize, indices);
+    }
     remainingOffset_ = 0;
     remainingLimit_ -= outputSize;
     input_ = nullptr;
@@ -15,6 +15,7 @@
  */
 
 #include "velox/exec/LocalPartition.h"
+#include "velox/exec/HashJoinBridge.h"
 #include "velox/exec/Task.h"
 
 namespace facebook::velox::exec {
@@ -29,30 +30,36 @@ void notify(std::vector<ContinuePromise>& promises) {
 bool LocalExchangeMemoryManager::increaseMemoryUsage(
     ContinueFuture* future,
     int64_t added) {
-  std::lock_guard<std::mutex> l(mutex_);
-  bufferedBytes_ += added;
-
-  if (bufferedBytes_ >= maxBufferSize_) {
-    promises_.emplace_back("LocalExchangeMemoryManager::updateMemoryUsage");
-    *future = promises_.back().getSemiFuture();
-    return true;
+  if (bufferedBytes_.fetch_add(added) + added < maxBufferSize_) {
+    return false;
   }
 
-  return false;
+  std::lock_guard<std::mutex> l(mutex_);
+  hasBlockedProducers_ = true;
+  // A consumer may have decreased the memory usage before seeing
+  // 'hasBlockedProducers_'.
+  if (bufferedBytes_ < maxBufferSize_) {
+    hasBlockedProducers_ = !promises_.empty();
+    return false;
+  }
+  promises_.emplace_back("LocalExchangeMemoryManager::updateMemoryUsage");
+  *future = promises_.back().getSemiFuture();
+  return true;
 }
 
 std::vector<ContinuePromise> LocalExchangeMemoryManager::decreaseMemoryUsage(
     int64_t removed) {
-  std::vector<ContinuePromise> promises;
-  {
-    std::lock_guard<std::mutex> l(mutex_);
-    bufferedBytes_ -= removed;
+  if (bufferedBytes_.fetch_sub(removed) - removed >= maxBufferSize_ ||
+      !hasBlockedProducers_) {
+    return {};
+  }
 
-    if (bufferedBytes_ < maxBufferSize_) {
-      promises = std::move(promises_);
-    }
+  std::lock_guard<std::mutex> l(mutex_);
+  if (bufferedBytes_ >= maxBufferSize_) {
+    return {};
   }
-  return promises;
+  hasBlockedProducers_ = false;
+  return std::move(promises_);
 }
 
 void LocalExchangeVectorPool::push(const RowVectorPtr& vector, int64_t size) {
@@ -81,22 +88,23 @@ RowVectorPtr LocalExchangeVectorPool::pop() {
 }
 
 void LocalExchangeQueue::addProducer() {
-  queue_.withWLock([&](auto& /*queue*/) {
-    VELOX_CHECK(!noMoreProducers_, "addProducer called after noMoreProducers");
-    ++pendingProducers_;
-  });
+  std::lock_guard<std::mutex> l(mutex_);
+  VELOX_CHECK(!noMoreProducers_, "addProducer called after noMoreProducers");
+  ++pendingProducers_;
 }
 
 void LocalExchangeQueue::noMoreProducers() {
   std::vector<ContinuePromise> consumerPromises;
-  queue_.withWLock([&](auto& queue) {
+  {
+    std::lock_guard<std::mutex> l(mutex_);
     VELOX_CHECK(!noMoreProducers_, "noMoreProducers can be called only once");
     noMoreProducers_ = true;
     if (pendingProducers_ == 0) {
       // No more data will be produced.
+      numWaitingConsumers_ -= consumerPromises_.size();
       consumerPromises = std::move(consumerPromises_);
     }
-  });
+  }
   notify(consumerPromises);
 }
 
@@ -104,27 +112,35 @@ BlockingReason LocalExchangeQueue::enqueue(
     RowVectorPtr input,
     int64_t inputBytes,
     ContinueFuture* future) {
-  std::vector<ContinuePromise> consumerPromises;
-  bool blockedOnConsumer = false;
-  bool isClosed = queue_.withWLock([&](auto& queue) {
-    if (closed_) {
-      return true;
-    }
-    queue.emplace(std::move(input), inputBytes);
-    consumerPromises = std::move(consumerPromises_);
-
-    if (memoryManager_->increaseMemoryUsage(future, inputBytes)) {
-      blockedOnConsumer = true;
-    }
-
-    return false;
-  });
-
-  if (isClosed) {
+  if (closed_) {
     return BlockingReason::kNotBlocked;
   }
+  queue_.enqueue({std::move(input), inputBytes});
+  const bool blockedOnConsumer =
+      memoryManager_->increaseMemoryUsage(future, inputBytes);
+  if (closed_) {
+    // close() may have drained 'queue_' before the enqueue.
+    auto memoryPromises = drain();
+    notify(memoryPromises);
+  }
 
-  notify(consumerPromises);
+  // Pairs with the fence in next() so that either the consumer finds the data
+  // or this sees the consumer waiting.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (numWaitingConsumers_ > 0) {
+    auto consumerPromise = ContinuePromise::makeEmpty();
+    {
+      std::lock_guard<std::mutex> l(mutex_);
+      if (!consumerPromises_.empty()) {
+        consumerPromise = std::move(consumerPromises_.back());
+        consumerPromises_.pop_back();
+        --numWaitingConsumers_;
+      }
+    }
+    if (consumerPromise.valid()) {
+      consumerPromise.setValue();
+    }
+  }
 
   if (blockedOnConsumer) {
     return BlockingReason::kWaitForConsumer;
@@ -135,13 +151,15 @@ BlockingReason LocalExchangeQueue::enqueue(
 
 void LocalExchangeQueue::noMoreData() {
   std::vector<ContinuePromise> consumerPromises;
-  queue_.withWLock([&](auto& queue) {
+  {
+    std::lock_guard<std::mutex> l(mutex_);
     VELOX_CHECK_GT(pendingProducers_, 0);
     --pendingProducers_;
     if (noMoreProducers_ && pendingProducers_ == 0) {
+      numWaitingConsumers_ -= consumerPromises_.size();
       consumerPromises = std::move(consumerPromises_);
     }
-  });
+  }
   notify(consumerPromises);
 }
 
@@ -149,12 +167,20 @@ BlockingReason LocalExchangeQueue::next(
     ContinueFuture* future,
     memory::MemoryPool* pool,
     RowVectorPtr* data) {
-  int64_t size;
-  std::vector<ContinuePromise> memoryPromises;
-  auto blockingReason = queue_.withWLock([&](auto& queue) {
-    *data = nullptr;
-    if (queue.empty()) {
-      if (isFinishedLocked(queue)) {
+  *data = nullptr;
+  if (closed_) {
+    return BlockingReason::kNotBlocked;
+  }
+
+  std::pair<RowVectorPtr, int64_t> item;
+  if (!queue_.try_dequeue(item)) {
+    std::lock_guard<std::mutex> l(mutex_);
+    ++numWaitingConsumers_;
+    // Pairs with the fence in enqueue().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!queue_.try_dequeue(item)) {
+      if (isFinishedLocked()) {
+        --numWaitingConsumers_;
         return BlockingReason::kNotBlocked;
       }
 
@@ -163,27 +189,23 @@ BlockingReason LocalExchangeQueue::next(
 
       return BlockingReason::kWaitForProducer;
     }
+    --numWaitingConsumers_;
+  }
 
-    std::tie(*data, size) = std::move(queue.front());
-    queue.pop();
-
-    memoryPromises = memoryManager_->decreaseMemoryUsage(size);
-
-    return BlockingReason::kNotBlocked;
-  });
+  auto [vector, size] = std::move(item);
+  auto memoryPromises = memoryManager_->decreaseMemoryUsage(size);
   notify(memoryPromises);
-  if (*data != nullptr) {
-    vectorPool_->push(*data, size);
-  }
-  return blockingReason;
+  vectorPool_->push(vector, size);
+  *data = std::move(vector);
+  return BlockingReason::kNotBlocked;
 }
 
-bool LocalExchangeQueue::isFinishedLocked(const Queue& queue) const {
+bool LocalExchangeQueue::isFinishedLocked() const {
   if (closed_) {
     return true;
   }
 
-  if (noMoreProducers_ && pendingProducers_ == 0 && queue.empty()) {
+  if (noMoreProducers_ && pendingProducers_ == 0 && queue_.empty()) {
     return true;
   }
 
@@ -191,31 +213,36 @@ bool LocalExchangeQueue::isFinishedLocked(const Queue& queue) const {
 }
 
 bool LocalExchangeQueue::isFinished() {
-  return queue_.withWLock([&](auto& queue) { return isFinishedLocked(queue); });
+  std::lock_guard<std::mutex> l(mutex_);
+  return isFinishedLocked();
 }
 
 bool LocalExchangeQueue::testingProducersDone() const {
-  return queue_.withRLock(
-      [&](auto& queue) { return noMoreProducers_ && pendingProducers_ == 0; });
+  std::lock_guard<std::mutex> l(mutex_);
+  return noMoreProducers_ && pendingProducers_ == 0;
+}
+
+std::vector<ContinuePromise> LocalExchangeQueue::drain() {
+  std::pair<RowVectorPtr, int64_t> item;
+  int64_t freedBytes = 0;
+  while (queue_.try_dequeue(item)) {
+    freedBytes += item.second;
+  }
+  if (freedBytes == 0) {
+    return {};
+  }
+  return memoryManager_->decreaseMemoryUsage(freedBytes);
 }
 
 void LocalExchangeQueue::close() {
   std::vector<ContinuePromise> consumerPromises;
-  std::vector<ContinuePromise> memoryPromises;
-  queue_.withWLock([&](auto& queue) {
-    uint64_t freedBytes = 0;
-    while (!queue.empty()) {
-      freedBytes += queue.front().second;
-      queue.pop();
-    }
-
-    if (freedBytes) {
-      memoryPromises = memoryManager_->decreaseMemoryUsage(freedBytes);
-    }
-
-    consumerPromises = std::move(consumerPromises_);
+  {
+    std::lock_guard<std::mutex> l(mutex_);
     closed_ = true;
-  });
+    numWaitingConsumers_ -= consumerPromises_.size();
+    consumerPromises = std::move(consumerPromises_);
+  }
+  auto memoryPromises = drain();
   notify(consumerPromises);
   notify(memoryPromises);
 }
@@ -269,7 +296,8 @@ bool LocalExchange::isFinished() {
 LocalPartition::LocalPartition(
     int32_t operatorId,
     DriverCtx* ctx,
-    const std::shared_ptr<const core::LocalPartitionNode>& planNode)
+    const std::shared_ptr<const core::LocalPartitionNode>& planNode,
+    std::optional<core::PlanNodeId> probeJoinNodeId)
     : Operator(
           ctx,
           planNode->outputType(),
@@ -283,7 +311,10 @@ LocalPartition::LocalPartition(
           numPartitions_ == 1 ? nullptr
                               : planNode->partitionFunctionSpec().create(
                                     numPartitions_,
-                                    /*localExchange=*/true)) {
+                                    /*localExchange=*/true)),
+      probeJoinNodeId_(std::move(probeJoinNodeId)),
+      skipRepartitionMaxBuildRows_(
+          ctx->queryConfig().hashJoinSkipProbeRepartitionMaxBuildRows()) {
   VELOX_CHECK(numPartitions_ == 1 || partitionFunction_ != nullptr);
 
   for (auto& queue : queues_) {
@@ -295,6 +326,33 @@ LocalPartition::LocalPartition(
   }
 }
 
+void LocalPartition::initialize() {
+  Operator::initialize();
+  if (probeJoinNodeId_.has_value() && numPartitions_ > 1 &&
+      skipRepartitionMaxBuildRows_ > 0) {
+    probeJoinBridge_ = operatorCtx_->task()->getHashJoinBridge(
+        operatorCtx_->driverCtx()->splitGroupId, probeJoinNodeId_.value());
+  }
+}
+
+bool LocalPartition::skipRepartition() {
+  if (probeJoinBridge_ == nullptr) {
+    return skipRepartition_;
+  }
+  const auto numBuildRows = probeJoinBridge_->numBuildRows();
+  if (!numBuildRows.has_value()) {
+    // The build is not done yet. Check again on the next input.
+    return false;
+  }
+  probeJoinBridge_.reset();
+  if (static_cast<uint64_t>(numBuildRows.value()) <=
+      skipRepartitionMaxBuildRows_) {
+    skipRepartition_ = true;
+    addRuntimeStat("skippedProbeRepartition", RuntimeCounter(1));
+  }
+  return skipRepartition_;
+}
+
 void LocalPartition::allocateIndexBuffers(
     const std::vector<vector_size_t>& sizes) {
   VELOX_CHECK_EQ(indexBuffers_.size(), sizes.size());
@@ -355,9 +413,14 @@ RowVectorPtr LocalPartition::wrapChildren(
 void LocalPartition::addInput(RowVectorPtr input) {
   prepareForInput(input);
 
-  const auto singlePartition = numPartitions_ == 1
-      ? 0
-      : partitionFunction_->partition(*input, partitions_);
+  std::optional<uint32_t> singlePartition;
+  if (numPartitions_ == 1) {
+    singlePartition = 0;
+  } else if (skipRepartition()) {
+    singlePartition = nextQueue_++ % numPartitions_;
+  } else {
+    singlePartition = partitionFunction_->partition(*input, partitions_);
+  }
   if (singlePartition.has_value()) {
     ContinueFuture future;
     auto blockingReason = queues_[singlePartition.value()]->enqueue(
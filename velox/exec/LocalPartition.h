@@ -15,13 +15,17 @@
  */
 #pragma once
 
+#include <folly/concurrency/UnboundedQueue.h>
+
 #include "velox/exec/Operator.h"
 #include "velox/exec/VectorHasher.h"
 
 namespace facebook::velox::exec {
 
 /// Keeps track of the total size in bytes of the data buffered in all
-/// LocalExchangeQueues.
+/// LocalExchangeQueues. The buffered bytes are updated without a lock. The
+/// lock is taken only to block a producer at the limit or to unblock the
+/// blocked producers.
 class LocalExchangeMemoryManager {
  public:
   explicit LocalExchangeMemoryManager(int64_t maxBufferSize)
@@ -48,8 +52,12 @@ class LocalExchangeMemoryManager {
 
  private:
   const int64_t maxBufferSize_;
+  std::atomic<int64_t> bufferedBytes_{0};
+  // True if 'promises_' may be non-empty. Set before a producer checks the
+  // buffered bytes for the last time before blocking, so that a consumer that
+  // decreases the buffered bytes below the limit at the same time sees it.
+  std::atomic_bool hasBlockedProducers_{false};
   std::mutex mutex_;
-  tsan_atomic<int64_t> bufferedBytes_{0};
   std::vector<ContinuePromise> promises_;
 };
 
@@ -77,6 +85,11 @@ class LocalExchangeVectorPool {
 /// must be called after all producers have been registered. A producer calls
 /// 'enqueue' multiple time to put the data and calls 'noMoreData' when done.
 /// Consumers call 'next' repeatedly to fetch the data.
+///
+/// The data is kept in a lock-free multi-producer multi-consumer queue.
+/// Producers and consumers take the lock only to block, to wake up blocked
+/// consumers and to change the producer state. Each enqueue wakes up at most
+/// one blocked consumer.
 class LocalExchangeQueue {
  public:
   LocalExchangeQueue(
@@ -130,22 +143,32 @@ class LocalExchangeQueue {
   bool testingProducersDone() const;
 
  private:
-  using Queue = std::queue<std::pair<RowVectorPtr, int64_t>>;
+  using Queue =
+      folly::UMPMCQueue<std::pair<RowVectorPtr, int64_t>, /*MayBlock=*/false>;
+
+  bool isFinishedLocked() const;
 
-  bool isFinishedLocked(const Queue& queue) const;
+  // Removes all data from 'queue_' and returns the memory promises to fulfill.
+  std::vector<ContinuePromise> drain();
 
   const std::shared_ptr<LocalExchangeMemoryManager> memoryManager_;
   const std::shared_ptr<LocalExchangeVectorPool> vectorPool_;
   const int partition_;
 
-  folly::Synchronized<Queue> queue_;
+  Queue queue_;
+  // The number of consumers that are blocked or about to block. Incremented
+  // before a consumer checks 'queue_' for the last time before blocking, so
+  // that a producer that adds data at the same time sees it.
+  std::atomic_int32_t numWaitingConsumers_{0};
+  std::atomic_bool closed_{false};
+
+  mutable std::mutex mutex_;
   // Satisfied when data becomes available or all producers report that they
   // finished producing, e.g. queue_ is not empty or noMoreProducers_ is true
   // and pendingProducers_ is zero.
   std::vector<ContinuePromise> consumerPromises_;
   int pendingProducers_{0};
   bool noMoreProducers_{false};
-  bool closed_{false};
 };
 
 /// Fetches data for a single partition produced by local exchange from
@@ -187,12 +210,22 @@ class LocalExchange : public SourceOperator {
 
 /// Hash partitions the data using specified keys. The number of partitions is
 /// determined by the number of LocalExchangeQueues(s) found in the task.
+class HashJoinBridge;
+
 class LocalPartition : public Operator {
  public:
+  /// @param probeJoinNodeId Set if 'planNode' is a repartition that feeds the
+  /// probe side of the hash join with this id. If the build side of the join
+  /// turns out to have fewer rows than 'hash_join_skip_probe_repartition_max_
+  /// build_rows', the input is passed to the consumers round robin without
+  /// hashing.
   LocalPartition(
       int32_t operatorId,
       DriverCtx* ctx,
-      const std::shared_ptr<const core::LocalPartitionNode>& planNode);
+      const std::shared_ptr<const core::LocalPartitionNode>& planNode,
+      std::optional<core::PlanNodeId> probeJoinNodeId = std::nullopt);
+
+  void initialize() override;
 
   std::string toString() const override {
     return fmt::format("LocalPartition({})", numPartitions_);
@@ -221,6 +254,10 @@ class LocalPartition : public Operator {
 
   void allocateIndexBuffers(const std::vector<vector_size_t>& sizes);
 
+  // Returns true if the input can skip the repartition because the build side
+  // of the join fed by 'this' is small.
+  bool skipRepartition();
+
   RowVectorPtr wrapChildren(
       const RowVectorPtr& input,
       vector_size_t size,
@@ -239,6 +276,16 @@ class LocalPartition : public Operator {
   /// Reusable buffers for input partitioning.
   std::vector<BufferPtr> indexBuffers_;
   std::vector<vector_size_t*> rawIndices_;
+
+  const std::optional<core::PlanNodeId> probeJoinNodeId_;
+  const uint64_t skipRepartitionMaxBuildRows_;
+
+  // The bridge of the join 'probeJoinNodeId_'. Reset once the decision to
+  // skip the repartition or not is made.
+  std::shared_ptr<HashJoinBridge> probeJoinBridge_;
+  bool skipRepartition_{false};
+  // Next queue to get an input if 'skipRepartition_' is true.
+  size_t nextQueue_{0};
 };
 
 } // namespace facebook::velox::exec
@@ -25,6 +25,7 @@
 #include "velox/exec/GroupId.h"
 #include "velox/exec/HashAggregation.h"
 #include "velox/exec/HashBuild.h"
+#include "velox/exec/HashPartitionFunction.h"
 #include "velox/exec/HashProbe.h"
 #include "velox/exec/IndexLookupJoin.h"
 #include "velox/exec/Limit.h"
@@ -104,8 +105,26 @@ OperatorSupplier makeConsumerSupplier(ConsumerSupplier consumerSupplier) {
   return nullptr;
 }
 
+// Returns the id of the hash join whose probe side is fed by 'localPartition'
+// if 'localPartition' repartitions its input and is the probe source of
+// 'consumerNode'.
+std::optional<core::PlanNodeId> probeJoinNodeId(
+    const core::LocalPartitionNode& localPartition,
+    const std::shared_ptr<const core::PlanNode>& consumerNode) {
+  if (localPartition.type() != core::LocalPartitionNode::Type::kRepartition) {
+    return std::nullopt;
+  }
+  const auto join =
+      std::dynamic_pointer_cast<const core::HashJoinNode>(consumerNode);
+  if (join == nullptr || join->sources()[0].get() != &localPartition) {
+    return std::nullopt;
+  }
+  return join->id();
+}
+
 OperatorSupplier makeConsumerSupplier(
-    const std::shared_ptr<const core::PlanNode>& planNode) {
+    const std::shared_ptr<const core::PlanNode>& planNode,
+    const std::shared_ptr<const core::PlanNode>& consumerNode) {
   if (auto localMerge =
           std::dynamic_pointer_cast<const core::LocalMergeNode>(planNode)) {
     return [localMerge](int32_t operatorId, DriverCtx* ctx) {
@@ -128,9 +147,11 @@ OperatorSupplier makeConsumerSupplier(
             localPartitionNode, operatorId, ctx);
       };
     }
-    return [localPartitionNode](int32_t operatorId, DriverCtx* ctx) {
+    return [localPartitionNode,
+            joinNodeId = probeJoinNodeId(*localPartitionNode, consumerNode)](
+               int32_t operatorId, DriverCtx* ctx) {
       return std::make_unique<LocalPartition>(
-          operatorId, ctx, localPartitionNode);
+          operatorId, ctx, localPartitionNode, joinNodeId);
     };
   }
 
@@ -164,12 +185,324 @@ OperatorSupplier makeConsumerSupplier(
   return Operator::operatorSupplierFromPlanNode(planNode);
 }
 
+// Plan rewrites applied while splitting the plan into pipelines.
+struct PlanRewriteOptions {
+  // Merges partial aggregation results across drivers before the shuffle.
+  bool mergePartialAggregations{false};
+  // Removes the duplicates of distinct aggregations with a separate grouping.
+  bool rewriteDistinctAggregations{false};
+  // Sorts the input of each driver separately and merges the sorted runs.
+  bool parallelOrderBy{false};
+  // Evaluates the window partitions on all drivers.
+  bool parallelWindow{false};
+};
+
+// Returns an intermediate aggregation over a local repartition on the grouping
+// keys of 'planNode' if 'planNode' is a partial aggregation feeding the
+// PartitionedOutput 'consumerNode' whose partial results are worth merging
+// inside the task. Returns nullptr otherwise.
+std::shared_ptr<const core::PlanNode> makePartialAggregationMerge(
+    const std::shared_ptr<const core::PlanNode>& planNode,
+    const std::shared_ptr<const core::PlanNode>& consumerNode) {
+  if (!std::dynamic_pointer_cast<const core::PartitionedOutputNode>(
+          consumerNode)) {
+    return nullptr;
+  }
+  const auto partialAgg =
+      std::dynamic_pointer_cast<const core::AggregationNode>(planNode);
+  if (partialAgg == nullptr ||
+      partialAgg->step() != core::AggregationNode::Step::kPartial ||
+      partialAgg->groupingKeys().empty() ||
+      !partialAgg->preGroupedKeys().empty() ||
+      !partialAgg->globalGroupingSets().empty()) {
+    return nullptr;
+  }
+
+  const auto& outputType = partialAgg->outputType();
+  const auto numGroupingKeys = partialAgg->groupingKeys().size();
+  std::vector<core::AggregationNode::Aggregate> aggregates;
+  aggregates.reserve(partialAgg->aggregates().size());
+  for (auto i = 0; i < partialAgg->aggregates().size(); ++i) {
+    const auto& partialAggregate = partialAgg->aggregates()[i];
+    if (partialAggregate.distinct || !partialAggregate.sortingKeys.empty()) {
+      return nullptr;
+    }
+    const auto& intermediateType = outputType->childAt(numGroupingKeys + i);
+    std::vector<core::TypedExprPtr> inputs{
+        std::make_shared<core::FieldAccessTypedExpr>(
+            intermediateType, partialAgg->aggregateNames()[i])};
+    // Lambda inputs are passed to all aggregation steps.
+    for (const auto& rawInput : partialAggregate.call->inputs()) {
+      if (rawInput->type()->kind() == TypeKind::FUNCTION) {
+        inputs.push_back(rawInput);
+      }
+    }
+
+    core::AggregationNode::Aggregate aggregate;
+    aggregate.call = std::make_shared<core::CallTypedExpr>(
+        intermediateType, std::move(inputs), partialAggregate.call->name());
+    aggregate.rawInputTypes = partialAggregate.rawInputTypes;
+    aggregates.push_back(std::move(aggregate));
+  }
+
+  std::vector<column_index_t> keyChannels;
+  keyChannels.reserve(numGroupingKeys);
+  for (auto i = 0; i < numGroupingKeys; ++i) {
+    keyChannels.push_back(i);
+  }
+  auto localPartition = std::make_shared<core::LocalPartitionNode>(
+      fmt::format("{}.mergeExchange", partialAgg->id()),
+      core::LocalPartitionNode::Type::kRepartition,
+      /*scaleWriter=*/false,
+      std::make_shared<HashPartitionFunctionSpec>(
+          outputType, std::move(keyChannels)),
+      std::vector<core::PlanNodePtr>{partialAgg});
+  return std::make_shared<core::AggregationNode>(
+      fmt::format("{}.merge", partialAgg->id()),
+      core::AggregationNode::Step::kIntermediate,
+      partialAgg->groupingKeys(),
+      std::vector<core::FieldAccessTypedExprPtr>{},
+      partialAgg->aggregateNames(),
+      aggregates,
+      partialAgg->ignoreNullKeys(),
+      std::move(localPartition));
+}
+
+// Returns a non-distinct aggregation over an aggregation that groups on the
+// grouping keys and the distinct inputs of 'planNode' if 'planNode' is a
+// single grouped aggregation whose aggregates are all distinct over the same
+// columns. The duplicates are then removed by a hash table whose memory is
+// accounted for and spilled like any other aggregation instead of by per group
+// set accumulators. Returns nullptr otherwise.
+std::shared_ptr<const core::PlanNode> makeDistinctAggregationRewrite(
+    const std::shared_ptr<const core::PlanNode>& planNode) {
+  const auto aggregation =
+      std::dynamic_pointer_cast<const core::AggregationNode>(planNode);
+  if (aggregation == nullptr ||
+      aggregation->step() != core::AggregationNode::Step::kSingle ||
+      aggregation->groupingKeys().empty() ||
+      !aggregation->preGroupedKeys().empty() ||
+      !aggregation->globalGroupingSets().empty() ||
+      aggregation->groupId().has_value() || aggregation->ignoreNullKeys() ||
+      aggregation->aggregates().empty()) {
+    return nullptr;
+  }
+
+  std::vector<core::FieldAccessTypedExprPtr> distinctKeys;
+  for (const auto& aggregate : aggregation->aggregates()) {
+    if (!aggregate.distinct || aggregate.mask != nullptr ||
+        !aggregate.sortingKeys.empty()) {
+      return nullptr;
+    }
+    std::vector<core::FieldAccessTypedExprPtr> inputs;
+    for (const auto& input : aggregate.call->inputs()) {
+      auto field =
+          std::dynamic_pointer_cast<const core::FieldAccessTypedExpr>(input);
+      if (field == nullptr || !field->isInputColumn()) {
+        return nullptr;
+      }
+      inputs.push_back(std::move(field));
+    }
+    if (distinctKeys.empty()) {
+      distinctKeys = std::move(inputs);
+      continue;
+    }
+    if (inputs.size() != distinctKeys.size()) {
+      return nullptr;
+    }
+    for (auto i = 0; i < inputs.size(); ++i) {
+      if (inputs[i]->name() != distinctKeys[i]->name()) {
+        return nullptr;
+      }
+    }
+  }
+  if (distinctKeys.empty()) {
+    return nullptr;
+  }
+
+  auto groupingKeys = aggregation->groupingKeys();
+  for (const auto& key : distinctKeys) {
+    const bool isGroupingKey = std::any_of(
+        groupingKeys.begin(), groupingKeys.end(), [&](const auto& groupingKey) {
+          return groupingKey->name() == key->name();
+        });
+    if (!isGroupingKey) {
+      groupingKeys.push_back(key);
+    }
+  }
+  auto distinct = std::make_shared<core::AggregationNode>(
+      fmt::format("{}.distinct", aggregation->id()),
+      core::AggregationNode::Step::kSingle,
+      std::move(groupingKeys),
+      std::vector<core::FieldAccessTypedExprPtr>{},
+      std::vector<std::string>{},
+      std::vector<core::AggregationNode::Aggregate>{},
+      /*ignoreNullKeys=*/false,
+      aggregation->sources()[0]);
+
+  auto aggregates = aggregation->aggregates();
+  for (auto& aggregate : aggregates) {
+    aggregate.distinct = false;
+  }
+  return std::make_shared<core::AggregationNode>(
+      aggregation->id(),
+      core::AggregationNode::Step::kSingle,
+      aggregation->groupingKeys(),
+      std::vector<core::FieldAccessTypedExprPtr>{},
+      aggregation->aggregateNames(),
+      std::move(aggregates),
+      /*ignoreNullKeys=*/false,
+      std::move(distinct));
+}
+
+// Returns a local merge over a partial OrderBy with the id of 'planNode' if
+// 'planNode' is a final OrderBy. The partial OrderBy runs on all drivers of
+// the pipeline feeding it and the single driver local merge combines the
+// sorted runs. A gather right below 'planNode' is dropped since it would
+// otherwise limit the partial OrderBy to a single driver. Returns nullptr
+// otherwise.
+std::shared_ptr<const core::PlanNode> makeParallelOrderBy(
+    const std::shared_ptr<const core::PlanNode>& planNode) {
+  const auto orderBy =
+      std::dynamic_pointer_cast<const core::OrderByNode>(planNode);
+  if (orderBy == nullptr || orderBy->isPartial()) {
+    return nullptr;
+  }
+
+  auto source = orderBy->sources()[0];
+  if (const auto gather =
+          std::dynamic_pointer_cast<const core::LocalPartitionNode>(source)) {
+    if (gather->type() == core::LocalPartitionNode::Type::kGather &&
+        gather->sources().size() == 1) {
+      source = gather->sources()[0];
+    }
+  }
+  auto partialOrderBy = std::make_shared<core::OrderByNode>(
+      orderBy->id(),
+      orderBy->sortingKeys(),
+      orderBy->sortingOrders(),
+      /*isPartial=*/true,
+      std::move(source));
+  return std::make_shared<core::LocalMergeNode>(
+      fmt::format("{}.merge", orderBy->id()),
+      orderBy->sortingKeys(),
+      orderBy->sortingOrders(),
+      std::vector<core::PlanNodePtr>{std::move(partialOrderBy)});
+}
+
+// Returns 'planNode' over a local repartition on the partition keys in place
+// of the local gather below it if 'planNode' is a Window with partition keys
+// whose input is not sorted. Rows of the same window partition then go to the
+// same driver, so that the partitions can be evaluated on all drivers.
+// Returns nullptr otherwise.
+std::shared_ptr<const core::PlanNode> makeParallelWindow(
+    const std::shared_ptr<const core::PlanNode>& planNode) {
+  const auto window =
+      std::dynamic_pointer_cast<const core::WindowNode>(planNode);
+  if (window == nullptr || window->partitionKeys().empty() ||
+      window->inputsSorted()) {
+    return nullptr;
+  }
+  const auto gather = std::dynamic_pointer_cast<const core::LocalPartitionNode>(
+      window->sources()[0]);
+  if (gather == nullptr ||
+      gather->type() != core::LocalPartitionNode::Type::kGather) {
+    return nullptr;
+  }
+
+  const auto& inputType = gather->outputType();
+  std::vector<column_index_t> keyChannels;
+  keyChannels.reserve(window->partitionKeys().size());
+  for (const auto& key : window->partitionKeys()) {
+    keyChannels.push_back(inputType->getChildIdx(key->name()));
+  }
+  auto repartition = std::make_shared<core::LocalPartitionNode>(
+      gather->id(),
+      core::LocalPartitionNode::Type::kRepartition,
+      /*scaleWriter=*/false,
+      std::make_shared<HashPartitionFunctionSpec>(
+          inputType, std::move(keyChannels)),
+      gather->sources());
+
+  const auto& outputNames = window->outputType()->names();
+  std::vector<std::string> windowColumnNames(
+      outputNames.begin() + inputType->size(), outputNames.end());
+  return std::make_shared<core::WindowNode>(
+      window->id(),
+      window->partitionKeys(),
+      window->sortingKeys(),
+      window->sortingOrders(),
+      std::move(windowColumnNames),
+      window->windowFunctions(),
+      /*inputsSorted=*/false,
+      std::move(repartition));
+}
+
 void plan(
     const std::shared_ptr<const core::PlanNode>& planNode,
     std::vector<std::shared_ptr<const core::PlanNode>>* currentPlanNodes,
     const std::shared_ptr<const core::PlanNode>& consumerNode,
     OperatorSupplier consumerSupplier,
-    std::vector<std::unique_ptr<DriverFactory>>* driverFactories) {
+    std::vector<std::unique_ptr<DriverFactory>>* driverFactories,
+    const PlanRewriteOptions& rewrites) {
+  // Plans the partial aggregation below the merge in its own pipeline. The
+  // partial aggregation is not merged again since its consumer is the local
+  // exchange.
+  if (rewrites.mergePartialAggregations) {
+    if (auto merge = makePartialAggregationMerge(planNode, consumerNode)) {
+      plan(
+          merge,
+          currentPlanNodes,
+          consumerNode,
+          std::move(consumerSupplier),
+          driverFactories,
+          rewrites);
+      return;
+    }
+  }
+  // The rewritten aggregation has no distinct aggregates, so it is not
+  // rewritten again.
+  if (rewrites.rewriteDistinctAggregations) {
+    if (auto rewritten = makeDistinctAggregationRewrite(planNode)) {
+      plan(
+          rewritten,
+          currentPlanNodes,
+          consumerNode,
+          std::move(consumerSupplier),
+          driverFactories,
+          rewrites);
+      return;
+    }
+  }
+
+  // The rewritten Window is over a repartition, so it is not rewritten again.
+  if (rewrites.parallelWindow) {
+    if (auto rewritten = makeParallelWindow(planNode)) {
+      plan(
+          rewritten,
+          currentPlanNodes,
+          consumerNode,
+          std::move(consumerSupplier),
+          driverFactories,
+          rewrites);
+      return;
+    }
+  }
+
+  // The partial OrderBy below the merge is not rewritten again.
+  if (rewrites.parallelOrderBy) {
+    if (auto merge = makeParallelOrderBy(planNode)) {
+      plan(
+          merge,
+          currentPlanNodes,
+          consumerNode,
+          std::move(consumerSupplier),
+          driverFactories,
+          rewrites);
+      return;
+    }
+  }
+
   if (!currentPlanNodes) {
     driverFactories->push_back(std::make_unique<DriverFactory>());
     currentPlanNodes = &driverFactories->back()->planNodes;
@@ -188,8 +521,9 @@ void plan(
           sources[i],
           mustStartNewPipeline(planNode, i) ? nullptr : currentPlanNodes,
           planNode,
-          makeConsumerSupplier(planNode),
-          driverFactories);
+          makeConsumerSupplier(planNode, consumerNode),
+          driverFactories,
+          rewrites);
     }
   }
 
@@ -314,12 +648,23 @@ void LocalPlanner::plan(
       adapter.inspect(planFragment);
     }
   }
+  detail::PlanRewriteOptions rewrites;
+  rewrites.mergePartialAggregations =
+      queryConfig.partialAggregationLocalMergeEnabled() && maxDrivers > 1 &&
+      !planFragment.isGroupedExecution();
+  rewrites.rewriteDistinctAggregations =
+      queryConfig.distinctAggregationRewriteEnabled();
+  rewrites.parallelOrderBy = queryConfig.orderByParallelSortEnabled() &&
+      maxDrivers > 1 && !planFragment.isGroupedExecution();
+  rewrites.parallelWindow = queryConfig.windowLocalPartitionEnabled() &&
+      maxDrivers > 1 && !planFragment.isGroupedExecution();
   detail::plan(
       planFragment.planNode,
       nullptr,
       nullptr,
       detail::makeConsumerSupplier(consumerSupplier),
-      driverFactories);
+      driverFactories,
+      rewrites);
 
   (*driverFactories)[0]->outputDriver = true;
 
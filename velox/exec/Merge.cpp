@@ -223,7 +223,7 @@ bool SourceStream::pop(std::vector<ContinueFuture>& futures) {
   ++currentSourceRow_;
   if (currentSourceRow_ == data_->size()) {
     // Make sure all current data has been copied out.
-    VELOX_CHECK(!outputRows_.hasSelections());
+    VELOX_CHECK(outputRanges_.empty());
     return fetchMoreData(futures);
   }
 
@@ -231,37 +231,42 @@ bool SourceStream::pop(std::vector<ContinueFuture>& futures) {
 }
 
 void SourceStream::copyToOutput(RowVectorPtr& output) {
-  outputRows_.updateBounds();
-
-  if (!outputRows_.hasSelections()) {
+  if (outputRanges_.empty()) {
     return;
   }
 
-  vector_size_t sourceRow = firstSourceRow_;
-  outputRows_.applyToSelected(
-      [&](auto row) { sourceRows_[row] = sourceRow++; });
-
   for (auto i = 0; i < output->type()->size(); ++i) {
-    output->childAt(i)->copy(
-        data_->childAt(i).get(), outputRows_, sourceRows_.data());
+    output->childAt(i)->copyRanges(data_->childAt(i).get(), outputRanges_);
   }
 
-  outputRows_.clearAll();
+  outputRanges_.clear();
+}
 
-  if (sourceRow == data_->size()) {
-    firstSourceRow_ = 0;
-  } else {
-    firstSourceRow_ = sourceRow;
+void SourceStream::prefetch() {
+  if (nextData_ != nullptr || sourceAtEnd_) {
+    return;
+  }
+
+  // The source keeps the promise for the consumer if it has no data yet. The
+  // future is not needed since fetchMoreData() asks the source again.
+  ContinueFuture future;
+  if (source_->next(nextData_, &future) == BlockingReason::kNotBlocked) {
+    sourceAtEnd_ = nextData_ == nullptr || nextData_->size() == 0;
   }
 }
 
 bool SourceStream::fetchMoreData(std::vector<ContinueFuture>& futures) {
-  ContinueFuture future;
-  auto reason = source_->next(data_, &future);
-  if (reason != BlockingReason::kNotBlocked) {
-    needData_ = true;
-    futures.emplace_back(std::move(future));
-    return true;
+  if (nextData_ != nullptr || sourceAtEnd_) {
+    data_ = std::move(nextData_);
+    nextData_ = nullptr;
+  } else {
+    ContinueFuture future;
+    auto reason = source_->next(data_, &future);
+    if (reason != BlockingReason::kNotBlocked) {
+      needData_ = true;
+      futures.emplace_back(std::move(future));
+      return true;
+    }
   }
 
   atEnd_ = !data_ || data_->size() == 0;
@@ -276,6 +281,7 @@ bool SourceStream::fetchMoreData(std::vector<ContinueFuture>& futures) {
     for (const auto& key : sortingKeys_) {
       keyColumns_.push_back(data_->childAt(key.first).get());
     }
+    prefetch();
   }
   return false;
 }
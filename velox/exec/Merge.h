@@ -89,10 +89,9 @@ class SourceStream final : public MergeStream {
       const std::vector<std::pair<column_index_t, CompareFlags>>& sortingKeys,
       uint32_t outputBatchSize)
       : source_{source},
-        sortingKeys_{sortingKeys},
-        outputRows_(outputBatchSize, false),
-        sourceRows_(outputBatchSize) {
+        sortingKeys_{sortingKeys} {
     keyColumns_.reserve(sortingKeys.size());
+    outputRanges_.reserve(outputBatchSize);
   }
 
   /// Returns true and appends a future to 'futures' if needs to wait for the
@@ -124,7 +123,16 @@ class SourceStream final : public MergeStream {
   /// call 'setOutputRow' before calling 'pop'. The output rows must
   /// monotonically increase in between calls to 'copyToOutput'.
   bool setOutputRow(vector_size_t row) {
-    outputRows_.setValid(row, true);
+    if (!outputRanges_.empty()) {
+      auto& last = outputRanges_.back();
+      if (last.targetIndex + last.count == row &&
+          last.sourceIndex + last.count == currentSourceRow_) {
+        // Consecutive source rows go to consecutive output rows.
+        ++last.count;
+        return currentSourceRow_ == data_->size() - 1;
+      }
+    }
+    outputRanges_.push_back({currentSourceRow_, row, 1});
     return currentSourceRow_ == data_->size() - 1;
   }
 
@@ -136,6 +144,10 @@ class SourceStream final : public MergeStream {
  private:
   bool fetchMoreData(std::vector<ContinueFuture>& futures);
 
+  // Tries to get the batch after 'data_' from 'source_' without blocking, so
+  // that the source can produce more data while 'data_' drains.
+  void prefetch();
+
   MergeSource* source_;
 
   const std::vector<std::pair<column_index_t, CompareFlags>>& sortingKeys_;
@@ -157,14 +169,16 @@ class SourceStream final : public MergeStream {
   /// returned by 'source_->next()'.
   bool needData_{true};
 
-  /// First source row that hasn't been copied out yet.
-  vector_size_t firstSourceRow_{0};
+  /// The batch after 'data_' if prefetched.
+  RowVectorPtr nextData_;
 
-  /// Output row numbers for source rows that haven't been copied out yet.
-  SelectivityVector outputRows_;
+  /// True if the prefetch found 'source_' at end.
+  bool sourceAtEnd_{false};
 
-  /// Reusable memory.
-  std::vector<vector_size_t> sourceRows_;
+  /// Runs of source rows that haven't been copied out yet and their output
+  /// rows. A run of consecutive rows going to consecutive output rows is
+  /// copied with a single range.
+  std::vector<BaseVector::CopyRange> outputRanges_;
 };
 
 // LocalMerge merges its source's output into a single stream of
@@ -29,7 +29,10 @@ MergeJoin::MergeJoin(
           joinNode->outputType(),
           operatorId,
           joinNode->id(),
-          "MergeJoin"),
+          "MergeJoin",
+          joinNode->canSpill(driverCtx->queryConfig())
+              ? driverCtx->makeSpillConfig(operatorId)
+              : std::nullopt),
       outputBatchSize_{outputBatchRows()},
       joinType_{joinNode->joinType()},
       numKeys_{joinNode->leftKeys().size()},
@@ -267,6 +270,87 @@ bool MergeJoin::findEndOfMatch(
   return true;
 }
 
+RowVectorPtr MergeJoin::rightMatchInput(size_t index) {
+  auto& match = rightMatch_.value();
+  if (match.inputs[index] != nullptr) {
+    return match.inputs[index];
+  }
+  if (match.unspilledInput != nullptr && match.unspilledInputIndex == index) {
+    return match.unspilledInput;
+  }
+
+  auto it = match.spilledInputs.find(index);
+  VELOX_CHECK(it != match.spilledInputs.end());
+  // Drops the previously read batch before reading the next one.
+  match.unspilledInput = nullptr;
+  RowVectorPtr batch;
+  for (const auto& fileInfo : it->second) {
+    auto file = SpillReadFile::create(
+        fileInfo, spillConfig_->readBufferSize, pool(), &spillStats_);
+    while (file->nextBatch(batch)) {
+      if (match.unspilledInput == nullptr) {
+        match.unspilledInput = std::move(batch);
+      } else {
+        match.unspilledInput->append(batch.get());
+      }
+    }
+  }
+  VELOX_CHECK_NOT_NULL(match.unspilledInput);
+  match.unspilledInputIndex = index;
+  return match.unspilledInput;
+}
+
+void MergeJoin::reclaim(
+    uint64_t /*targetBytes*/,
+    memory::MemoryReclaimer::Stats& /*stats*/) {
+  VELOX_CHECK(canReclaim());
+  VELOX_CHECK(!nonReclaimableSection_);
+
+  if (!rightMatch_.has_value()) {
+    // Nothing to spill.
+    return;
+  }
+  spillRightMatch();
+}
+
+void MergeJoin::spillRightMatch() {
+  auto& match = rightMatch_.value();
+  for (size_t i = 0; i + 1 < match.inputs.size(); ++i) {
+    auto& input = match.inputs[i];
+    if (input == nullptr || input == currentRight_) {
+      continue;
+    }
+    match.spilledInputs.emplace(i, spillRightInput(input));
+    input = nullptr;
+  }
+  match.unspilledInput = nullptr;
+  pool()->release();
+}
+
+SpillFiles MergeJoin::spillRightInput(const RowVectorPtr& input) {
+  const auto& spillConfig = spillConfig_.value();
+  auto updateAndCheckSpillLimitCb = spillConfig.updateAndCheckSpillLimitCb;
+  SpillWriter writer(
+      asRowType(input->type()),
+      0,
+      {},
+      spillConfig.compressionKind,
+      fmt::format(
+          "{}/{}-merge-join-spill-{}",
+          spillConfig.getSpillDirPathCb(),
+          spillConfig.fileNamePrefix,
+          numSpilledRightInputs_++),
+      spillConfig.maxFileSize,
+      spillConfig.writeBufferSize,
+      spillConfig.fileCreateConfig,
+      updateAndCheckSpillLimitCb,
+      memory::spillMemoryPool(),
+      &spillStats_);
+  IndexRange range{0, input->size()};
+  writer.write(input, folly::Range<IndexRange*>(&range, 1));
+  return writer.finish();
+}
+
 namespace {
 void copyRow(
     const RowVectorPtr& source,
@@ -544,7 +628,7 @@ bool MergeJoin::addToOutputForLeftJoin() {
 
       auto numRights = rightMatch_->inputs.size();
       for (size_t r = firstRightBatch; r < numRights; ++r) {
-        auto right = rightMatch_->inputs[r];
+        auto right = rightMatchInput(r);
         auto rightStart = r == firstRightBatch ? rightStartIndex : 0;
         auto rightEnd =
             r == numRights - 1 ? rightMatch_->endIndex : right->size();
@@ -841,6 +925,10 @@ RowVectorPtr MergeJoin::doGetOutput() {
 
     if (rightInput_) {
       if (!findEndOfMatch(rightMatch_.value(), rightInput_, rightKeys_)) {
+        // Test-only spill path.
+        if (canReclaim() && testingTriggerSpill(pool()->name())) {
+          spillRightMatch();
+        }
         // Continue looking for the end of the match.
         rightInput_ = nullptr;
         return nullptr;
@@ -18,6 +18,7 @@
 
 #include "velox/exec/MergeSource.h"
 #include "velox/exec/Operator.h"
+#include "velox/exec/Spill.h"
 
 namespace facebook::velox::exec {
 
@@ -61,6 +62,17 @@ class MergeJoin : public Operator {
 
   bool isFinished() override;
 
+  /// Only the joins that loop over the left side can read the right side
+  /// batches back from disk. Right joins identify the right-side rows by
+  /// vector in JoinTracker.
+  bool canReclaim() const override {
+    return canSpill() && !isRightJoin(joinType_) &&
+        !isRightSemiFilterJoin(joinType_);
+  }
+
+  void reclaim(uint64_t targetBytes, memory::MemoryReclaimer::Stats& stats)
+      override;
+
   void close() override {
     if (rightSource_) {
       rightSource_->close();
@@ -160,6 +172,15 @@ class MergeJoin : public Operator {
     void setCursor(size_t batchIndex, vector_size_t index) {
       cursor = Cursor{batchIndex, index};
     }
+
+    /// Spill files of the batches in 'inputs' that were spilled under memory
+    /// pressure, keyed by batch index. The spilled batches are null in
+    /// 'inputs'. Only the right side match spills.
+    folly::F14FastMap<size_t, SpillFiles> spilledInputs{};
+
+    /// The last spilled batch read back from disk and its index in 'inputs'.
+    RowVectorPtr unspilledInput{nullptr};
+    size_t unspilledInputIndex{0};
   };
 
   /// Given a partial set of rows with matching keys (match) finds all rows from
@@ -173,6 +194,18 @@ class MergeJoin : public Operator {
       const RowVectorPtr& input,
       const std::vector<column_index_t>& keys);
 
+  /// Returns the batch at 'index' of 'rightMatch_'. Reads the batch back from
+  /// disk if it was spilled.
+  RowVectorPtr rightMatchInput(size_t index);
+
+  /// Spills the batches of 'rightMatch_' to disk except for the last one,
+  /// which is still being searched for the end of the match, and the one
+  /// wrapped by the current output.
+  void spillRightMatch();
+
+  /// Writes 'input' to a new spill file and returns the file.
+  SpillFiles spillRightInput(const RowVectorPtr& input);
+
   /// Ensures `output_` is ready to receive records via `addOutput()` or
   /// `addOutputRowForLeftJoin()`. Initialize vectors using `outputBatchSize_`.
   /// Returns true is the output_ needs to be returned/produced first, and false
@@ -518,5 +551,8 @@ class MergeJoin : public Operator {
 
   // True if all the right side data has been received.
   bool noMoreRightInput_{false};
+
+  // Number of right side batches spilled so far. Used to name the spill files.
+  uint32_t numSpilledRightInputs_{0};
 };
 } // namespace facebook::velox::exec
@@ -56,6 +56,8 @@ NestedLoopJoinProbe::NestedLoopJoinProbe(
           joinNode->id(),
           "NestedLoopJoinProbe"),
       outputBatchSize_{outputBatchRows()},
+      filterBlockRows_{
+          driverCtx->queryConfig().nestedLoopJoinFilterBlockRows()},
       joinNode_(joinNode),
       joinType_(joinNode_->joinType()) {
   auto probeType = joinNode_->sources()[0]->outputType();
@@ -141,6 +143,10 @@ BlockingReason NestedLoopJoinProbe::isBlocked(ContinueFuture* future) {
         return BlockingReason::kWaitForJoinBuild;
       }
       VELOX_CHECK(buildVectors_.has_value());
+      for (const auto& buildVector : buildVectors_.value()) {
+        maxBuildVectorRows_ =
+            std::max(maxBuildVectorRows_, buildVector->size());
+      }
 
       // If we just got build data, check if this is a right or full join where
       // we need to hit track of hits on build records. If it is, initialize the
@@ -273,6 +279,7 @@ bool NestedLoopJoinProbe::advanceProbe() {
   if (hasProbedAllBuildData()) {
     probeRow_ += probeRowCount_;
     probeRowHasMatch_ = false;
+    probeBlockMatched_.clear();
     buildIndex_ = 0;
 
     // If we finished processing the probe side.
@@ -286,6 +293,9 @@ bool NestedLoopJoinProbe::advanceProbe() {
 // Main join loop.
 bool NestedLoopJoinProbe::addToOutput() {
   VELOX_CHECK_NOT_NULL(input_);
+  if (isBlockedFilter()) {
+    return addBlockToOutput();
+  }
 
   // First, create a new output vector. By default, allocate space for
   // outputBatchSize_ rows. The output always generates dictionaries wrapped
@@ -328,7 +338,7 @@ bool NestedLoopJoinProbe::addToOutput() {
     // Iterate over the filter results. For each match, add an output record.
     for (size_t i = buildRow_; i < decodedFilterResult_.size(); ++i) {
       if (isJoinConditionMatch(i)) {
-        addOutputRow(i);
+        addOutputRow(probeRow_, i);
         ++numOutputRows_;
         probeRowHasMatch_ = true;
 
@@ -366,6 +376,84 @@ bool NestedLoopJoinProbe::addToOutput() {
   return true;
 }
 
+bool NestedLoopJoinProbe::addBlockToOutput() {
+  prepareOutput();
+  if (probeBlockMatched_.empty()) {
+    startProbeBlock();
+  }
+
+  while (!hasProbedAllBuildData()) {
+    const auto& currentBuild = buildVectors_.value()[buildIndex_];
+    const auto numBuildRows = currentBuild->size();
+    if (numBuildRows == 0) {
+      ++buildIndex_;
+      buildRow_ = 0;
+      continue;
+    }
+
+    // Evaluates the join condition over the whole probe block times the build
+    // vector at once.
+    if (buildRow_ == 0) {
+      evaluateJoinFilter(currentBuild);
+    }
+
+    for (vector_size_t i = buildRow_; i < decodedFilterResult_.size(); ++i) {
+      if (!isJoinConditionMatch(i)) {
+        continue;
+      }
+      const auto blockRow = i / numBuildRows;
+      const auto buildRow = i % numBuildRows;
+      addOutputRow(probeRow_ + blockRow, buildRow);
+      ++numOutputRows_;
+      probeBlockMatched_[blockRow] = true;
+      if (needsBuildMismatch(joinType_)) {
+        buildMatched_[buildIndex_].setValid(buildRow, true);
+      }
+
+      if (numOutputRows_ == outputBatchSize_) {
+        buildRow_ = i + 1;
+        copyBuildValues(currentBuild);
+        return false;
+      }
+    }
+
+    copyBuildValues(currentBuild);
+    ++buildIndex_;
+    buildRow_ = 0;
+  }
+
+  if (!addProbeBlockMismatchRows()) {
+    return false;
+  }
+  output_->resize(numOutputRows_);
+  return true;
+}
+
+void NestedLoopJoinProbe::startProbeBlock() {
+  const auto numBlockRows = std::max<vector_size_t>(
+      1, filterBlockRows_ / std::max<vector_size_t>(1, maxBuildVectorRows_));
+  probeRowCount_ = std::min(numBlockRows, input_->size() - probeRow_);
+  probeBlockMatched_.assign(probeRowCount_, false);
+  probeBlockMismatchRow_ = 0;
+}
+
+bool NestedLoopJoinProbe::addProbeBlockMismatchRows() {
+  if (!needsProbeMismatch(joinType_)) {
+    return true;
+  }
+  for (; probeBlockMismatchRow_ < probeRowCount_; ++probeBlockMismatchRow_) {
+    if (probeBlockMatched_[probeBlockMismatchRow_]) {
+      continue;
+    }
+    if (numOutputRows_ == outputBatchSize_) {
+      return false;
+    }
+    addProbeMismatchRow(probeRow_ + probeBlockMismatchRow_);
+    ++numOutputRows_;
+  }
+  return true;
+}
+
 void NestedLoopJoinProbe::prepareOutput() {
   if (output_ != nullptr) {
     return;
@@ -432,6 +520,9 @@ RowVectorPtr NestedLoopJoinProbe::getNextCrossProductBatch(
   } else if (isCrossJoin() && isSingleBuildVector()) {
     return genCrossProductSingleBuildVector(
         buildVector, outputType, probeProjections, buildProjections);
+  } else if (isBlockedFilter()) {
+    return genCrossProductProbeBlock(
+        buildVector, outputType, probeProjections, buildProjections);
   } else {
     return genCrossProductMultipleBuildVectors(
         buildVector, outputType, probeProjections, buildProjections);
@@ -468,8 +559,7 @@ RowVectorPtr NestedLoopJoinProbe::genCrossProductSingleBuildVector(
     const std::vector<IdentityProjection>& probeProjections,
     const std::vector<IdentityProjection>& buildProjections) {
   VELOX_CHECK(isSingleBuildVector());
-  std::vector<VectorPtr> projectedChildren(outputType->size());
-  vector_size_t buildRowCount = buildVector->size();
+  const vector_size_t buildRowCount = buildVector->size();
 
   // Calculate how many probe rows we can cover without exceeding
   // outputBatchSize_.
@@ -479,6 +569,17 @@ RowVectorPtr NestedLoopJoinProbe::genCrossProductSingleBuildVector(
     probeRowCount_ =
         std::min(outputBatchSize_ / buildRowCount, input_->size() - probeRow_);
   }
+  return genCrossProductProbeBlock(
+      buildVector, outputType, probeProjections, buildProjections);
+}
+
+RowVectorPtr NestedLoopJoinProbe::genCrossProductProbeBlock(
+    const RowVectorPtr& buildVector,
+    const RowTypePtr& outputType,
+    const std::vector<IdentityProjection>& probeProjections,
+    const std::vector<IdentityProjection>& buildProjections) {
+  std::vector<VectorPtr> projectedChildren(outputType->size());
+  const vector_size_t buildRowCount = buildVector->size();
   size_t numOutputRows = probeRowCount_ * buildRowCount;
 
   // Generate probe dictionary indices.
@@ -541,9 +642,11 @@ RowVectorPtr NestedLoopJoinProbe::genCrossProductMultipleBuildVectors(
       pool(), outputType, nullptr, numOutputRows, std::move(projectedChildren));
 }
 
-void NestedLoopJoinProbe::addOutputRow(vector_size_t buildRow) {
+void NestedLoopJoinProbe::addOutputRow(
+    vector_size_t probeRow,
+    vector_size_t buildRow) {
   // Probe side is always a dictionary; just populate the index.
-  rawProbeOutputIndices_[numOutputRows_] = probeRow_;
+  rawProbeOutputIndices_[numOutputRows_] = probeRow;
 
   // For the build side, we accumulate the ranges to copy, then copy all of them
   // at once. If records are consecutive and can have a single copy range run.
@@ -567,9 +670,9 @@ void NestedLoopJoinProbe::copyBuildValues(const RowVectorPtr& buildVector) {
   }
 }
 
-void NestedLoopJoinProbe::addProbeMismatchRow() {
+void NestedLoopJoinProbe::addProbeMismatchRow(vector_size_t probeRow) {
   // Probe side is always a dictionary; just populate the index.
-  rawProbeOutputIndices_[numOutputRows_] = probeRow_;
+  rawProbeOutputIndices_[numOutputRows_] = probeRow;
 
   // Null out build projections.
   for (const auto& projection : buildProjections_) {
@@ -584,7 +687,7 @@ void NestedLoopJoinProbe::checkProbeMismatchRow() {
   if (needsProbeMismatch(joinType_) && hasProbedAllBuildData() &&
       !probeRowHasMatch_) {
     prepareOutput();
-    addProbeMismatchRow();
+    addProbeMismatchRow(probeRow_);
     ++numOutputRows_;
   }
 }
@@ -61,6 +61,13 @@ namespace facebook::velox::exec {
 /// c) If build side has multiple vectors, take one probe row are at a time,
 /// wrapping it as a constant, and produce it along with build batches.
 ///
+/// If `nested_loop_join_filter_block_rows` is set, joins with a condition
+/// evaluate it over a block of probe rows times one build vector at a time
+/// (probe and build rows wrapped in dictionaries), so that one expression
+/// evaluation covers up to that many rows. All build vectors are processed
+/// for the probe block before moving to the next one, so within a block the
+/// output follows the build vector order.
+///
 /// If needed, buid-side copies are done lazily; it first accumulates the ranges
 /// to be copied, then performs the copies in batch, column-by-column. It
 /// produces at most `outputBatchSize_` records, but it may produce fewer since
@@ -125,6 +132,20 @@ class NestedLoopJoinProbe : public Operator {
   // all probe data has been processed.
   bool addToOutput();
 
+  // Same as addToOutput() for the block of probe rows starting at probeRow_
+  // when the join condition is evaluated in blocks. Adds the probe mismatches
+  // of the block after all build vectors are processed.
+  bool addBlockToOutput();
+
+  // Sets the number of probe rows in the block starting at probeRow_ so that
+  // the block times the largest build vector fits in `filterBlockRows_`.
+  void startProbeBlock();
+
+  // Adds probe mismatch rows for the rows of the current probe block without
+  // a match, starting at `probeBlockMismatchRow_`. Returns false if `output_`
+  // is full before all mismatches are added.
+  bool addProbeBlockMismatchRows();
+
   // Advances 'probeRow_' and resets required state information. Returns true
   // if there is not more probe data to be processed in the current `input_`
   // (and hence a new probe input is required). False otherwise.
@@ -183,12 +204,21 @@ class NestedLoopJoinProbe : public Operator {
       const std::vector<IdentityProjection>& probeProjections,
       const std::vector<IdentityProjection>& buildProjections);
 
+  // Generates the cross product of `probeRowCount_` probe rows starting at
+  // probeRow_ and all rows of buildVector, wrapped in dictionaries. Rows are
+  // ordered by probe row, then by build row.
+  RowVectorPtr genCrossProductProbeBlock(
+      const RowVectorPtr& buildVector,
+      const RowTypePtr& outputType,
+      const std::vector<IdentityProjection>& probeProjections,
+      const std::vector<IdentityProjection>& buildProjections);
+
   // Add a single record to `output_` based on buildRow from buildVector, and
-  // the current probeRow and probe vector (input_). Probe side projections are
+  // probeRow from the current probe vector (input_). Probe side projections are
   // zero-copy (dictionary indices), and build side projections are marked to be
   // copied using `buildCopyRanges_`; they will be copied later on by
   // `copyBuildValues()`.
-  void addOutputRow(vector_size_t buildRow);
+  void addOutputRow(vector_size_t probeRow, vector_size_t buildRow);
 
   // Checks if it is required to add a probe mismatch row, and does it if
   // needed. The caller needs to ensure there is available space in `output_`
@@ -196,8 +226,9 @@ class NestedLoopJoinProbe : public Operator {
   void checkProbeMismatchRow();
 
   // Add a probe mismatch (only for left/full outer joins). The record is based
-  // on the current probeRow and vector (input_) and build projections are null.
-  void addProbeMismatchRow();
+  // on probeRow from the current probe vector (input_) and build projections
+  // are null.
+  void addProbeMismatchRow(vector_size_t probeRow);
 
   // Copies the ranges from buildVector specified by `buildCopyRanges_` to
   // `output_`, one projected column at a time. Clears buildCopyRanges_.
@@ -234,6 +265,11 @@ class NestedLoopJoinProbe : public Operator {
     return joinCondition_ == nullptr;
   }
 
+  // Whether the join condition is evaluated over blocks of probe rows.
+  bool isBlockedFilter() const {
+    return !isCrossJoin() && filterBlockRows_ > 0;
+  }
+
   // If build has a single vector, we can wrap probe and build batches into
   // dictionaries and produce as many combinations of probe and build rows,
   // until `numOutputRows_` is filled.
@@ -275,6 +311,10 @@ class NestedLoopJoinProbe : public Operator {
   // Maximum number of rows in the output batch.
   const vector_size_t outputBatchSize_;
 
+  // Maximum number of cross product rows to evaluate the join condition on at
+  // once. 0 if the condition is evaluated one probe row at a time.
+  const vector_size_t filterBlockRows_;
+
   // The current output batch being populated.
   RowVectorPtr output_;
 
@@ -324,6 +364,13 @@ class NestedLoopJoinProbe : public Operator {
   // outer joins.
   bool probeRowHasMatch_{false};
 
+  // Whether each row of the current probe block has a match. Empty if no
+  // probe block has been started. Only used if isBlockedFilter().
+  std::vector<bool> probeBlockMatched_;
+
+  // Next row of the current probe block to check for a probe mismatch.
+  vector_size_t probeBlockMismatchRow_{0};
+
   // Controls if this is the operator gathering and producing right/full outer
   // join mismatches. This is only set after all probe and build data has been
   // processed, only for right/full outer joins, and only executed in one single
@@ -343,9 +390,14 @@ class NestedLoopJoinProbe : public Operator {
   // Index into `buildVectors_` for the build vector being currently processed.
   size_t buildIndex_{0};
 
-  // Row being currently processed from `buildVectors_[buildIndex_]`.
+  // Row being currently processed from `buildVectors_[buildIndex_]`. If
+  // isBlockedFilter(), the row in the cross product of the probe block and
+  // `buildVectors_[buildIndex_]` instead.
   vector_size_t buildRow_{0};
 
+  // Number of rows of the largest build vector.
+  vector_size_t maxBuildVectorRows_{0};
+
   // Keep track of the build rows that had matches (only used for right or full
   // outer joins).
   std::vector<SelectivityVector> buildMatched_;
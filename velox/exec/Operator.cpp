@@ -26,6 +26,18 @@
 using facebook::velox::common::testutil::TestValue;
 
 namespace facebook::velox::exec {
+namespace {
+std::unique_ptr<OutputBatchSizer> makeOutputBatchSizer(
+    const core::QueryConfig& queryConfig) {
+  if (!queryConfig.adaptiveOutputBatchSizingEnabled()) {
+    return nullptr;
+  }
+  return std::make_unique<OutputBatchSizer>(OutputBatchSizer::Config{
+      queryConfig.adaptiveOutputBatchTargetBytes(),
+      queryConfig.maxOutputBatchRows(),
+      queryConfig.adaptiveOutputBatchMinCpuNanos()});
+}
+} // namespace
 
 OperatorCtx::OperatorCtx(
     DriverCtx* driverCtx,
@@ -41,7 +53,9 @@ OperatorCtx::OperatorCtx(
 core::ExecCtx* OperatorCtx::execCtx() const {
   if (!execCtx_) {
     execCtx_ = std::make_unique<core::ExecCtx>(
-        pool_, driverCtx_->task->queryCtx().get());
+        pool_,
+        driverCtx_->task->queryCtx().get(),
+        driverCtx_->vectorPoolCache);
   }
   return execCtx_.get();
 }
@@ -92,7 +106,8 @@ Operator::Operator(
           operatorId,
           driverCtx->pipelineId,
           std::move(planNodeId),
-          std::move(operatorType)}) {}
+          std::move(operatorType)}),
+      outputBatchSizer_(makeOutputBatchSizer(driverCtx->queryConfig())) {}
 
 void Operator::maybeSetReclaimer() {
   VELOX_CHECK_NULL(pool()->reclaimer());
@@ -339,6 +354,7 @@ void Operator::close() {
   input_ = nullptr;
   results_.clear();
   recordSpillStats();
+  recordVectorPoolStats();
   finishTrace();
 
   // Release the unused memory reservation on close.
@@ -348,6 +364,9 @@ void Operator::close() {
 vector_size_t Operator::outputBatchRows(
     std::optional<uint64_t> averageRowSize) const {
   const auto& queryConfig = operatorCtx_->task()->queryCtx()->queryConfig();
+  if (outputBatchSizer_ != nullptr && outputBatchSizer_->hasOutput()) {
+    return outputBatchSizer_->batchRows(queryConfig.preferredOutputBatchRows());
+  }
   if (!averageRowSize.has_value()) {
     return queryConfig.preferredOutputBatchRows();
   }
@@ -364,6 +383,13 @@ vector_size_t Operator::outputBatchRows(
   return std::max<vector_size_t>(batchSize, 1);
 }
 
+uint64_t Operator::outputBatchBytes() const {
+  if (outputBatchSizer_ != nullptr) {
+    return outputBatchSizer_->batchBytes();
+  }
+  return operatorCtx_->driverCtx()->queryConfig().preferredOutputBatchBytes();
+}
+
 void Operator::recordBlockingTime(uint64_t start, BlockingReason reason) {
   uint64_t now =
       std::chrono::duration_cast<std::chrono::microseconds>(
@@ -436,6 +462,13 @@ void Operator::recordSpillStats() {
             static_cast<int64_t>(lockedSpillStats->spillWriteTimeNanos),
             RuntimeCounter::Unit::kNanos});
   }
+  if (lockedSpillStats->spillWriteWaitTimeNanos != 0) {
+    lockedStats->addRuntimeStat(
+        kSpillWriteWaitTime,
+        RuntimeCounter{
+            static_cast<int64_t>(lockedSpillStats->spillWriteWaitTimeNanos),
+            RuntimeCounter::Unit::kNanos});
+  }
   if (lockedSpillStats->spillRuns != 0) {
     lockedStats->addRuntimeStat(
         kSpillRuns,
@@ -485,6 +518,25 @@ void Operator::recordSpillStats() {
   lockedSpillStats->reset();
 }
 
+void Operator::recordVectorPoolStats() {
+  const auto* vectorPool = operatorCtx_->vectorPoolIfCreated();
+  if (vectorPool == nullptr) {
+    return;
+  }
+  const auto& vectorPoolStats = vectorPool->stats();
+  auto lockedStats = stats_.wlock();
+  if (vectorPoolStats.numHits != 0) {
+    lockedStats->addRuntimeStat(
+        kVectorPoolHits,
+        RuntimeCounter(static_cast<int64_t>(vectorPoolStats.numHits)));
+  }
+  if (vectorPoolStats.numMisses != 0) {
+    lockedStats->addRuntimeStat(
+        kVectorPoolMisses,
+        RuntimeCounter(static_cast<int64_t>(vectorPoolStats.numMisses)));
+  }
+}
+
 std::string Operator::toString() const {
   std::stringstream out;
   out << operatorType() << "[" << planNodeId() << "] " << operatorId();
@@ -21,6 +21,7 @@
 #include "velox/exec/JoinBridge.h"
 #include "velox/exec/OperatorStats.h"
 #include "velox/exec/OperatorTraceWriter.h"
+#include "velox/exec/OutputBatchSizer.h"
 #include "velox/type/Filter.h"
 
 namespace facebook::velox::exec {
@@ -83,6 +84,12 @@ class OperatorCtx {
 
   core::ExecCtx* execCtx() const;
 
+  /// Returns the vector pool of execCtx() or nullptr if execCtx() has not been
+  /// created or has no vector pool.
+  VectorPool* vectorPoolIfCreated() const {
+    return execCtx_ != nullptr ? execCtx_->vectorPool() : nullptr;
+  }
+
   /// Makes an extract of QueryCtx for use in a connector. 'planNodeId'
   /// is the id of the calling TableScan. This and the task id identify the scan
   /// for column access tracking. 'connectorPool' is an aggregate memory pool
@@ -169,9 +176,15 @@ class Operator : public BaseRuntimeStatWriter {
   static inline const std::string kSpillFlushTime{"spillFlushWallNanos"};
   static inline const std::string kSpillWrites{"spillWrites"};
   static inline const std::string kSpillWriteTime{"spillWriteWallNanos"};
+  static inline const std::string kSpillWriteWaitTime{
+      "spillWriteWaitWallNanos"};
   static inline const std::string kSpillRuns{"spillRuns"};
   static inline const std::string kExceededMaxSpillLevel{
       "exceededMaxSpillLevel"};
+  /// The bytes written to the overflow spill directory once the local spill
+  /// tier has used up its quota. See Task::setOverflowSpillDirectory().
+  static inline const std::string kOverflowSpilledBytes{
+      "overflowSpilledBytes"};
   /// The spill read stats.
   static inline const std::string kSpillReadBytes{"spillReadBytes"};
   static inline const std::string kSpillReads{"spillReads"};
@@ -188,6 +201,11 @@ class Operator : public BaseRuntimeStatWriter {
   static inline const std::string kShuffleCompressionKind{
       "shuffleCompressionKind"};
 
+  /// The number of vectors served from and allocated by the vector pool of an
+  /// operator.
+  static inline const std::string kVectorPoolHits{"vectorPoolHits"};
+  static inline const std::string kVectorPoolMisses{"vectorPoolMisses"};
+
   /// 'operatorId' is the initial index of the 'this' in the Driver's list of
   /// Operators. This is used as in index into OperatorStats arrays in the Task.
   /// 'planNodeId' is a query-level unique identifier of the PlanNode to which
@@ -338,6 +356,13 @@ class Operator : public BaseRuntimeStatWriter {
     return stats_;
   }
 
+  /// Returns the sizer of the output batches if adaptive output batch sizing
+  /// is enabled, otherwise nullptr. The driver records the output batches and
+  /// the CPU time of the downstream operator in the sizer.
+  OutputBatchSizer* outputBatchSizer() const {
+    return outputBatchSizer_.get();
+  }
+
   void recordBlockingTime(uint64_t start, BlockingReason reason);
 
   virtual std::string toString() const;
@@ -585,13 +610,23 @@ class Operator : public BaseRuntimeStatWriter {
   /// number of rows at 10K and returns at least one row. The averageRowSize
   /// must not be negative. If the averageRowSize is 0 which is not advised,
   /// returns maxOutputBatchRows. If the averageRowSize is not given, returns
-  /// preferredOutputBatchRows.
+  /// preferredOutputBatchRows. With adaptive output batch sizing, once the
+  /// operator has produced output, sizes the batch from the observed output
+  /// row size instead.
   vector_size_t outputBatchRows(
       std::optional<uint64_t> averageRowSize = std::nullopt) const;
 
+  /// Returns the bytes of the output batch: the adaptive target with adaptive
+  /// output batch sizing, otherwise preferredOutputBatchBytes.
+  uint64_t outputBatchBytes() const;
+
   /// Invoked to record spill stats in operator stats.
   virtual void recordSpillStats();
 
+  /// Invoked on close to record the vector pool hits and misses in operator
+  /// stats.
+  void recordVectorPoolStats();
+
   const std::unique_ptr<OperatorCtx> operatorCtx_;
   const RowTypePtr outputType_;
   /// Contains the disk spilling related configs if spilling is enabled (e.g.
@@ -603,6 +638,9 @@ class Operator : public BaseRuntimeStatWriter {
   folly::Synchronized<OperatorStats> stats_;
   folly::Synchronized<common::SpillStats> spillStats_;
 
+  /// Set if adaptive output batch sizing is enabled.
+  const std::unique_ptr<OutputBatchSizer> outputBatchSizer_;
+
   /// NOTE: only one of the two could be set for an operator for tracing .
   /// 'splitTracer_' is only set for table scan to record the processed split
   /// for now.
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "velox/exec/OperatorSampler.h"
+
+#include <algorithm>
+
+#include "velox/common/process/TraceHistory.h"
+#include "velox/exec/Task.h"
+
+namespace facebook::velox::exec {
+namespace {
+// Returns the label of the latest TraceHistory entry of each thread, keyed on
+// the OS thread id.
+std::unordered_map<uint64_t, std::string> latestTraceLabels() {
+  std::unordered_map<uint64_t, std::string> labels;
+  for (const auto& thread : process::TraceHistory::listAll()) {
+    const process::TraceHistory::Entry* latest{nullptr};
+    for (const auto& entry : thread.entries) {
+      if (latest == nullptr || entry.time > latest->time) {
+        latest = &entry;
+      }
+    }
+    if (latest != nullptr) {
+      labels[thread.osTid] = latest->label;
+    }
+  }
+  return labels;
+}
+} // namespace
+
+void OperatorSampler::sample() {
+  const auto tasks = Task::getRunningTasks();
+  const auto labels = latestTraceLabels();
+  std::vector<Task::OpCallInfo> calls;
+  std::lock_guard<std::mutex> l(mutex_);
+  ++numSamples_;
+  for (const auto& task : tasks) {
+    calls.clear();
+    if (!task->getLongRunningOpCalls(lockTimeout_, 0, calls)) {
+      continue;
+    }
+    auto& querySamples = samples_[task->queryCtx()->queryId()];
+    for (const auto& call : calls) {
+      auto it = labels.find(call.tid);
+      const std::string traceLabel =
+          it == labels.end() ? std::string() : it->second;
+      auto& sample = querySamples[call.opCall + ";" + traceLabel];
+      if (sample.count++ == 0) {
+        sample.opCall = call.opCall;
+        sample.traceLabel = traceLabel;
+      }
+    }
+  }
+}
+
+std::unordered_map<std::string, std::vector<OperatorSampler::Sample>>
+OperatorSampler::samples() const {
+  std::unordered_map<std::string, std::vector<Sample>> result;
+  std::lock_guard<std::mutex> l(mutex_);
+  for (const auto& [queryId, querySamples] : samples_) {
+    auto& samples = result[queryId];
+    samples.reserve(querySamples.size());
+    for (const auto& [_, sample] : querySamples) {
+      samples.push_back(sample);
+    }
+    std::sort(
+        samples.begin(), samples.end(), [](const auto& a, const auto& b) {
+          return a.count > b.count;
+        });
+  }
+  return result;
+}
+
+std::string OperatorSampler::toFlameString() const {
+  std::string out;
+  for (const auto& [queryId, samples] : samples()) {
+    for (const auto& sample : samples) {
+      out += queryId + ";" + sample.opCall;
+      if (!sample.traceLabel.empty()) {
+        out += ";" + sample.traceLabel;
+      }
+      out += " " + std::to_string(sample.count) + "\n";
+    }
+  }
+  return out;
+}
+
+void OperatorSampler::clear() {
+  std::lock_guard<std::mutex> l(mutex_);
+  samples_.clear();
+  numSamples_ = 0;
+}
+
+} // namespace facebook::velox::exec
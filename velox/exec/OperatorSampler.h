@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::velox::exec {
+
+/// Samples which operator call each driver thread of the running tasks is in
+/// and counts the samples per query, operator call and the last trace label
+/// of the thread, see process::TraceHistory. Meant to be called periodically,
+/// e.g. as PeriodicStatsReporter::Options::sampleOperators. The counts are the
+/// flame data of the queries: the operators a query spends its time in have
+/// the most samples.
+class OperatorSampler {
+ public:
+  /// The number of samples of one stack of a query.
+  struct Sample {
+    /// "<operatorType>.<nodeId>::<operatorMethod>".
+    std::string opCall;
+    /// The last label pushed to the TraceHistory of the thread, or empty.
+    std::string traceLabel;
+    uint64_t count{0};
+  };
+
+  explicit OperatorSampler(
+      std::chrono::nanoseconds lockTimeout = std::chrono::milliseconds(10))
+      : lockTimeout_(lockTimeout) {}
+
+  /// Takes one sample of all running tasks. Operator calls are counted once
+  /// they have run for a millisecond. Tasks whose lock is not acquired within
+  /// 'lockTimeout' are skipped.
+  void sample();
+
+  /// Returns the samples of each query id, in descending order of count.
+  std::unordered_map<std::string, std::vector<Sample>> samples() const;
+
+  /// Returns the samples in the folded format of flame graph tools, one
+  /// '<queryId>;<opCall>[;<traceLabel>] <count>' line per stack.
+  std::string toFlameString() const;
+
+  /// The number of calls to sample().
+  uint64_t numSamples() const {
+    std::lock_guard<std::mutex> l(mutex_);
+    return numSamples_;
+  }
+
+  void clear();
+
+ private:
+  const std::chrono::nanoseconds lockTimeout_;
+
+  mutable std::mutex mutex_;
+  // The counts keyed on query id and then on 'opCall;traceLabel'.
+  std::unordered_map<std::string, std::unordered_map<std::string, Sample>>
+      samples_;
+  uint64_t numSamples_{0};
+};
+
+} // namespace facebook::velox::exec
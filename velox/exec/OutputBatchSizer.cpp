@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/OutputBatchSizer.h"
+
+namespace facebook::velox::exec {
+
+OutputBatchSizer::OutputBatchSizer(const Config& config) : config_(config) {
+  VELOX_CHECK_GT(config_.targetBytes, 0);
+  VELOX_CHECK_GT(config_.maxRows, 0);
+}
+
+void OutputBatchSizer::recordOutput(const RowVector& output) {
+  const auto numRows = output.size();
+  if (numRows == 0) {
+    return;
+  }
+  const double rowBytes =
+      static_cast<double>(output.retainedSize()) / numRows;
+  avgRowBytes_ = numOutputRows_ == 0
+      ? rowBytes
+      : kWeight * rowBytes + (1 - kWeight) * avgRowBytes_;
+  numOutputRows_ += numRows;
+}
+
+void OutputBatchSizer::recordDownstreamCpu(uint64_t cpuNanos) {
+  avgBatchCpuNanos_ = avgBatchCpuNanos_ == 0
+      ? cpuNanos
+      : kWeight * cpuNanos + (1 - kWeight) * avgBatchCpuNanos_;
+  if (avgBatchCpuNanos_ < config_.minBatchCpuNanos) {
+    scale_ = std::min(scale_ * kScaleStep, kMaxScale);
+  } else {
+    scale_ = std::max(scale_ / kScaleStep, 1.0);
+  }
+}
+
+vector_size_t OutputBatchSizer::batchRows(vector_size_t defaultRows) const {
+  if (!hasOutput()) {
+    return defaultRows;
+  }
+  if (avgRowBytes_ < 1) {
+    return config_.maxRows;
+  }
+  const double numRows = batchBytes() / avgRowBytes_;
+  if (numRows >= config_.maxRows) {
+    return config_.maxRows;
+  }
+  return std::max<vector_size_t>(numRows, 1);
+}
+
+} // namespace facebook::velox::exec
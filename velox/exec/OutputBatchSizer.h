@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/vector/ComplexVector.h"
+
+namespace facebook::velox::exec {
+
+/// Sizes the output batches of an operator at runtime. The batch targets
+/// 'targetBytes' of retained memory, computed from the observed retained size
+/// of the operator's output rows. The target is scaled by the CPU time the
+/// downstream operator spends per batch: batches that take less than
+/// 'minBatchCpuNanos' to process are dominated by per-batch overhead, so the
+/// target grows up to 'kMaxScale' times. The target shrinks back as the batch
+/// CPU time exceeds the minimum. Not thread safe, used by the driver thread.
+class OutputBatchSizer {
+ public:
+  struct Config {
+    /// The retained bytes of an output batch to target, normally a fraction
+    /// of the CPU cache.
+    uint64_t targetBytes;
+    /// The max number of rows in an output batch.
+    vector_size_t maxRows;
+    /// The min downstream CPU time per batch below which batches grow.
+    uint64_t minBatchCpuNanos;
+  };
+
+  static constexpr double kMaxScale = 4;
+
+  explicit OutputBatchSizer(const Config& config);
+
+  /// Records an output batch of the operator.
+  void recordOutput(const RowVector& output);
+
+  /// Records the CPU time of the downstream operator for the last output
+  /// batch.
+  void recordDownstreamCpu(uint64_t cpuNanos);
+
+  /// Returns true if output batches have been recorded.
+  bool hasOutput() const {
+    return numOutputRows_ > 0;
+  }
+
+  /// Returns the bytes of the next output batch.
+  uint64_t batchBytes() const {
+    return config_.targetBytes * scale_;
+  }
+
+  /// Returns the number of rows of the next output batch, or 'defaultRows' if
+  /// no output has been recorded.
+  vector_size_t batchRows(vector_size_t defaultRows) const;
+
+  /// Returns the average retained bytes per output row.
+  uint64_t averageRowBytes() const {
+    return avgRowBytes_;
+  }
+
+  double scale() const {
+    return scale_;
+  }
+
+ private:
+  // The weight of the latest observation in the moving averages.
+  static constexpr double kWeight = 0.25;
+  // The factor by which the scale changes per downstream batch.
+  static constexpr double kScaleStep = 1.25;
+
+  const Config config_;
+
+  uint64_t numOutputRows_{0};
+  double avgRowBytes_{0};
+  double avgBatchCpuNanos_{0};
+  double scale_{1};
+};
+
+} // namespace facebook::velox::exec
@@ -74,6 +74,41 @@ std::vector<std::shared_ptr<SerializedPage>> ArbitraryBuffer::getPages(
   return pages;
 }
 
+BroadcastSpillFile::BroadcastSpillFile(std::string path)
+    : path_(std::move(path)),
+      fs_(filesystems::getFileSystem(path_, nullptr)),
+      writeFile_(fs_->openFileForWrite(path_)) {}
+
+BroadcastSpillFile::~BroadcastSpillFile() {
+  try {
+    readFile_.reset();
+    writeFile_->close();
+    fs_->remove(path_);
+  } catch (const std::exception& e) {
+    LOG(ERROR) << "Failed to remove broadcast spill file " << path_ << ": "
+               << e.what();
+  }
+}
+
+void BroadcastSpillFile::write(const SerializedPage& page) {
+  pages_.push_back({writeFile_->size(), page.size(), page.numRows()});
+  writeFile_->append(page.getIOBuf());
+}
+
+std::shared_ptr<SerializedPage> BroadcastSpillFile::read(int32_t index) {
+  VELOX_CHECK_LT(index, pages_.size());
+  const auto& page = pages_[index];
+  if (readFile_ == nullptr || readFile_->size() < page.offset + page.size) {
+    writeFile_->flush();
+    readFile_ = fs_->openFileForRead(path_);
+  }
+  auto iobuf = folly::IOBuf::create(page.size);
+  readFile_->pread(page.offset, page.size, iobuf->writableData());
+  iobuf->append(page.size);
+  return std::make_shared<SerializedPage>(
+      std::move(iobuf), nullptr, page.numRows);
+}
+
 std::string ArbitraryBuffer::toString() const {
   return fmt::format(
       "[ARBITRARY_BUFFER PAGES[{}] NO MORE DATA[{}]]",
@@ -176,6 +211,16 @@ DestinationBuffer::Data DestinationBuffer::getData(
     }
     remainingBytes.push_back(data_[i]->size());
   }
+  if (replayFile_ != nullptr) {
+    for (auto page = nextReplayPage_; page < numReplayPages_; ++page) {
+      remainingBytes.push_back(replayFile_->pageSize(page));
+    }
+    for (const auto& page : pendingData_) {
+      if (page != nullptr) {
+        remainingBytes.push_back(page->size());
+      }
+    }
+  }
   if (!atEnd && arbitraryBuffer) {
     arbitraryBuffer->getAvailablePageSizes(remainingBytes);
   }
@@ -191,12 +236,60 @@ void DestinationBuffer::enqueue(std::shared_ptr<SerializedPage> data) {
     return;
   }
 
+  if (replayFile_ != nullptr) {
+    if (data == nullptr && !pendingData_.empty() &&
+        pendingData_.back() == nullptr) {
+      return;
+    }
+    if (data != nullptr) {
+      stats_.recordEnqueue(*data);
+    }
+    pendingData_.push_back(std::move(data));
+    return;
+  }
+
   if (data != nullptr) {
     stats_.recordEnqueue(*data);
   }
   data_.push_back(std::move(data));
 }
 
+void DestinationBuffer::startReplay(
+    std::shared_ptr<BroadcastSpillFile> file,
+    int32_t numPages) {
+  VELOX_CHECK(data_.empty());
+  VELOX_CHECK_NULL(replayFile_);
+  VELOX_CHECK_GT(numPages, 0);
+  replayFile_ = std::move(file);
+  nextReplayPage_ = 0;
+  numReplayPages_ = numPages;
+}
+
+std::vector<std::shared_ptr<SerializedPage>> DestinationBuffer::loadReplayData(
+    uint64_t maxBytes) {
+  std::vector<std::shared_ptr<SerializedPage>> pages;
+  if (replayFile_ == nullptr || !data_.empty()) {
+    return pages;
+  }
+  uint64_t loadedBytes = 0;
+  while (nextReplayPage_ < numReplayPages_ &&
+         (pages.empty() || loadedBytes < maxBytes)) {
+    auto page = replayFile_->read(nextReplayPage_++);
+    loadedBytes += page->size();
+    stats_.recordEnqueue(*page);
+    data_.push_back(page);
+    pages.push_back(std::move(page));
+  }
+  if (nextReplayPage_ == numReplayPages_) {
+    replayFile_ = nullptr;
+    for (auto& page : pendingData_) {
+      data_.push_back(std::move(page));
+    }
+    pendingData_.clear();
+  }
+  return pages;
+}
+
 DataAvailable DestinationBuffer::getAndClearNotify() {
   if (notify_ == nullptr) {
     VELOX_CHECK_NULL(aliveCheck_);
@@ -294,6 +387,14 @@ DestinationBuffer::deleteResults() {
     freed.push_back(std::move(data_[i]));
   }
   data_.clear();
+  for (auto& page : pendingData_) {
+    if (page != nullptr) {
+      stats_.recordDelete(*page);
+      freed.push_back(std::move(page));
+    }
+  }
+  pendingData_.clear();
+  replayFile_ = nullptr;
   return freed;
 }
 
@@ -335,7 +436,12 @@ OutputBuffer::OutputBuffer(
       continueSize_((maxSize_ * kContinuePct) / 100),
       arbitraryBuffer_(
           isArbitrary() ? std::make_unique<ArbitraryBuffer>() : nullptr),
-      numDrivers_(numDrivers) {
+      numDrivers_(numDrivers),
+      broadcastSpillEnabled_(
+          isBroadcast() &&
+          task_->queryCtx()->queryConfig().broadcastOutputSpillEnabled() &&
+          (!task_->spillDirectory().empty() ||
+           task_->hasCreateSpillDirectoryCb())) {
   buffers_.reserve(numDestinations);
   for (int i = 0; i < numDestinations; i++) {
     buffers_.push_back(std::make_unique<DestinationBuffer>());
@@ -365,6 +471,8 @@ void OutputBuffer::updateOutputBuffers(int numBuffers, bool noMoreBuffers) {
     }
 
     noMoreBuffers_ = true;
+    // The destinations replaying spilled pages keep the spill file.
+    broadcastSpillFile_ = nullptr;
     isFinished = isFinishedLocked();
     updateAfterAcknowledgeLocked(dataToBroadcast_, promises);
   }
@@ -397,6 +505,10 @@ void OutputBuffer::addOutputBuffersLocked(int numBuffers) {
   for (int32_t i = buffers_.size(); i < numBuffers; ++i) {
     auto buffer = std::make_unique<DestinationBuffer>();
     if (isBroadcast()) {
+      if (broadcastSpillFile_ != nullptr) {
+        buffer->startReplay(
+            broadcastSpillFile_, broadcastSpillFile_->numPages());
+      }
       for (const auto& data : dataToBroadcast_) {
         buffer->enqueue(data);
       }
@@ -490,9 +602,68 @@ bool OutputBuffer::enqueue(
     callback.notify();
   }
 
+  if (blocked) {
+    maybeSpillBroadcastData();
+  }
   return blocked;
 }
 
+void OutputBuffer::maybeSpillBroadcastData() {
+  if (!broadcastSpillEnabled_) {
+    return;
+  }
+  std::vector<std::shared_ptr<SerializedPage>> spilled;
+  std::vector<ContinuePromise> promises;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    if (noMoreBuffers_ || bufferedBytes_ < continueSize_) {
+      return;
+    }
+    // Only the pages no destination references are spilled. Destinations
+    // acknowledge pages in order, so these are at the start.
+    size_t numSpilled = 0;
+    while (numSpilled < dataToBroadcast_.size() &&
+           dataToBroadcast_[numSpilled].use_count() == 1) {
+      ++numSpilled;
+    }
+    if (numSpilled == 0) {
+      return;
+    }
+    if (broadcastSpillFile_ == nullptr) {
+      const auto& spillDirectory = task_->getOrCreateSpillDirectory();
+      if (spillDirectory.empty()) {
+        return;
+      }
+      broadcastSpillFile_ = std::make_shared<BroadcastSpillFile>(
+          fmt::format("{}/broadcast-output", spillDirectory));
+    }
+    const auto prevBytes = broadcastSpillFile_->bytes();
+    for (auto i = 0; i < numSpilled; ++i) {
+      broadcastSpillFile_->write(*dataToBroadcast_[i]);
+      spilled.push_back(std::move(dataToBroadcast_[i]));
+    }
+    numBroadcastSpilledBytes_ += broadcastSpillFile_->bytes() - prevBytes;
+    dataToBroadcast_.erase(
+        dataToBroadcast_.begin(), dataToBroadcast_.begin() + numSpilled);
+    updateAfterAcknowledgeLocked(spilled, promises);
+  }
+  releaseAfterAcknowledge(spilled, promises);
+}
+
+void OutputBuffer::loadBroadcastReplayLocked(
+    DestinationBuffer& buffer,
+    uint64_t maxBytes) {
+  const auto pages = buffer.loadReplayData(maxBytes);
+  if (pages.empty()) {
+    return;
+  }
+  updateTotalBufferedBytesMsLocked();
+  for (const auto& page : pages) {
+    bufferedBytes_ += page->size();
+    ++bufferedPages_;
+  }
+}
+
 void OutputBuffer::enqueueBroadcastOutputLocked(
     std::unique_ptr<SerializedPage> data,
     std::vector<DataAvailable>& dataAvailableCbs) {
@@ -648,6 +819,7 @@ void OutputBuffer::acknowledge(int destination, int64_t sequence) {
     updateAfterAcknowledgeLocked(freed, promises);
   }
   releaseAfterAcknowledge(freed, promises);
+  maybeSpillBroadcastData();
 }
 
 void OutputBuffer::updateAfterAcknowledgeLocked(
@@ -733,6 +905,9 @@ void OutputBuffer::getData(
     if (buffer) {
       freed = buffer->acknowledge(sequence, true);
       updateAfterAcknowledgeLocked(freed, promises);
+      if (isBroadcast()) {
+        loadBroadcastReplayLocked(*buffer, maxBytes);
+      }
       data = buffer->getData(
           maxBytes, sequence, notify, activeCheck, arbitraryBuffer_.get());
     } else {
@@ -746,6 +921,7 @@ void OutputBuffer::getData(
   if (data.immediate) {
     notify(std::move(data.data), sequence, std::move(data.remainingBytes));
   }
+  maybeSpillBroadcastData();
 }
 
 void OutputBuffer::terminate() {
@@ -848,7 +1024,7 @@ OutputBuffer::Stats OutputBuffer::stats() {
 
   updateTotalBufferedBytesMsLocked();
 
-  return OutputBuffer::Stats(
+  OutputBuffer::Stats stats(
       kind_,
       noMoreBuffers_,
       atEnd_,
@@ -861,6 +1037,8 @@ OutputBuffer::Stats OutputBuffer::stats() {
       getAverageBufferTimeMsLocked(),
       countTopBuffers(bufferStats, numOutputBytes_),
       bufferStats);
+  stats.broadcastSpilledBytes = numBroadcastSpilledBytes_;
+  return stats;
 }
 
 } // namespace facebook::velox::exec
@@ -15,6 +15,8 @@
  */
 #pragma once
 
+#include "velox/common/file/File.h"
+#include "velox/common/file/FileSystems.h"
 #include "velox/core/PlanNode.h"
 #include "velox/exec/ExchangeQueue.h"
 
@@ -90,6 +92,50 @@ class ArbitraryBuffer {
   std::deque<std::shared_ptr<SerializedPage>> pages_;
 };
 
+/// Local file of the broadcast pages kept for the destinations that have not
+/// joined yet, see 'broadcast_output_spill_enabled'. The pages are appended in
+/// broadcast order and read back by the late-joining destinations. The file is
+/// removed when the last reference to 'this' is gone.
+///
+/// NOTE: this class is not thread-safe.
+class BroadcastSpillFile {
+ public:
+  explicit BroadcastSpillFile(std::string path);
+
+  ~BroadcastSpillFile();
+
+  void write(const SerializedPage& page);
+
+  /// Reads back the page 'index' in write order.
+  std::shared_ptr<SerializedPage> read(int32_t index);
+
+  int32_t numPages() const {
+    return pages_.size();
+  }
+
+  int64_t pageSize(int32_t index) const {
+    return pages_[index].size;
+  }
+
+  uint64_t bytes() const {
+    return writeFile_->size();
+  }
+
+ private:
+  struct Page {
+    uint64_t offset;
+    int64_t size;
+    std::optional<int64_t> numRows;
+  };
+
+  const std::string path_;
+  const std::shared_ptr<filesystems::FileSystem> fs_;
+  const std::unique_ptr<WriteFile> writeFile_;
+  // Reopened when a page past its size is read.
+  std::unique_ptr<ReadFile> readFile_;
+  std::vector<Page> pages_;
+};
+
 class DestinationBuffer {
  public:
   /// The data transferred by the destination buffer has two phases:
@@ -131,6 +177,16 @@ class DestinationBuffer {
   /// arbitrary buffer on demand.
   void loadData(ArbitraryBuffer* buffer, uint64_t maxBytes);
 
+  /// Makes 'this' replay the first 'numPages' pages of 'file' before the pages
+  /// enqueued from now on. Used by broadcast output for a destination that
+  /// joins after pages were spilled.
+  void startReplay(std::shared_ptr<BroadcastSpillFile> file, int32_t numPages);
+
+  /// Reads replayed pages of up to 'maxBytes', but at least one, from the
+  /// spill file if there is no unacknowledged data. Returns the pages read.
+  std::vector<std::shared_ptr<SerializedPage>> loadReplayData(
+      uint64_t maxBytes);
+
   struct Data {
     /// The actual data available at this buffer.
     std::vector<std::unique_ptr<folly::IOBuf>> data;
@@ -196,6 +252,15 @@ class DestinationBuffer {
   int64_t notifySequence_{0};
   uint64_t notifyMaxBytes_{0};
   Stats stats_;
+
+  // The spill file to replay pages from, if set by startReplay(). Reset once
+  // all pages are replayed.
+  std::shared_ptr<BroadcastSpillFile> replayFile_;
+  // The next page and the end of the pages to replay from 'replayFile_'.
+  int32_t nextReplayPage_{0};
+  int32_t numReplayPages_{0};
+  // The pages enqueued while replaying. They follow the replayed pages.
+  std::vector<std::shared_ptr<SerializedPage>> pendingData_;
 };
 
 class Task;
@@ -254,6 +319,9 @@ class OutputBuffer {
     /// Stats of the OutputBuffer's destinations.
     std::vector<DestinationBuffer::Stats> buffersStats;
 
+    /// The bytes of broadcast pages spilled for late-joining destinations.
+    int64_t broadcastSpilledBytes{0};
+
     std::string toString() const;
   };
 
@@ -356,6 +424,16 @@ class OutputBuffer {
       std::unique_ptr<SerializedPage> data,
       std::vector<DataAvailable>& dataAvailableCbs);
 
+  // Writes the pages at the start of 'dataToBroadcast_' that no destination
+  // references anymore to 'broadcastSpillFile_' if broadcast spilling is
+  // enabled and the buffered bytes reach 'continueSize_'. Unblocks the
+  // producers if this frees enough memory.
+  void maybeSpillBroadcastData();
+
+  // Adds the pages 'buffer' read back from 'broadcastSpillFile_' to the
+  // buffered bytes.
+  void loadBroadcastReplayLocked(DestinationBuffer& buffer, uint64_t maxBytes);
+
   void enqueueArbitraryOutputLocked(
       std::unique_ptr<SerializedPage> data,
       std::vector<DataAvailable>& dataAvailableCbs);
@@ -403,6 +481,14 @@ class OutputBuffer {
   // after receiving no-more-broadcast-buffers signal.
   std::vector<std::shared_ptr<SerializedPage>> dataToBroadcast_;
 
+  // If true, the pages of 'dataToBroadcast_' are spilled to
+  // 'broadcastSpillFile_' once all current destinations have acknowledged
+  // them. The spill file holds the first pages of the broadcast output and
+  // 'dataToBroadcast_' the rest.
+  const bool broadcastSpillEnabled_;
+  std::shared_ptr<BroadcastSpillFile> broadcastSpillFile_;
+  uint64_t numBroadcastSpilledBytes_{0};
+
   std::mutex mutex_;
   // Actual data size in 'buffers_'.
   int64_t bufferedBytes_{0};
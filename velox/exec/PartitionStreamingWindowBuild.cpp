@@ -22,8 +22,10 @@ PartitionStreamingWindowBuild::PartitionStreamingWindowBuild(
     const std::shared_ptr<const core::WindowNode>& windowNode,
     velox::memory::MemoryPool* pool,
     const common::SpillConfig* spillConfig,
-    tsan_atomic<bool>* nonReclaimableSection)
-    : WindowBuild(windowNode, pool, spillConfig, nonReclaimableSection) {}
+    tsan_atomic<bool>* nonReclaimableSection,
+    folly::Synchronized<common::SpillStats>* spillStats)
+    : WindowBuild(windowNode, pool, spillConfig, nonReclaimableSection),
+      spillStats_(spillStats) {}
 
 void PartitionStreamingWindowBuild::buildNextPartition() {
   partitionStartRows_.push_back(sortedRows_.size());
@@ -32,6 +34,11 @@ void PartitionStreamingWindowBuild::buildNextPartition() {
 }
 
 void PartitionStreamingWindowBuild::addInput(RowVectorPtr input) {
+  // Test-only spill path.
+  if (spillConfig_ != nullptr && testingTriggerSpill(data_->pool()->name())) {
+    spill();
+  }
+
   for (auto i = 0; i < inputChannels_.size(); ++i) {
     decodedInputVectors_[i].decode(*input->childAt(inputChannels_[i]));
   }
@@ -43,6 +50,12 @@ void PartitionStreamingWindowBuild::addInput(RowVectorPtr input) {
       data_->store(decodedInputVectors_[col], row, newRow, col);
     }
 
+    // Partitions are split out when read back from spill.
+    if (spiller_ != nullptr) {
+      inputRows_.push_back(newRow);
+      continue;
+    }
+
     if (previousRow_ != nullptr &&
         compareRowsWithKeys(previousRow_, newRow, partitionKeyInfo_)) {
       buildNextPartition();
@@ -53,15 +66,124 @@ void PartitionStreamingWindowBuild::addInput(RowVectorPtr input) {
   }
 }
 
+void PartitionStreamingWindowBuild::spill() {
+  // The rows of the partition being output are referenced by the Window
+  // operator and stay in memory. The rows after it are spilled.
+  const vector_size_t numKeptRows =
+      currentPartition_ < 0 ? 0 : partitionStartRows_[currentPartition_ + 1];
+  if (numKeptRows == sortedRows_.size() && inputRows_.empty()) {
+    // Nothing to spill.
+    return;
+  }
+
+  if (spiller_ == nullptr) {
+    spiller_ = std::make_unique<SortOutputSpiller>(
+        data_.get(), inputType_, spillConfig_, spillStats_);
+  }
+
+  SpillerBase::SpillRows spillRows(
+      sortedRows_.begin() + numKeptRows,
+      sortedRows_.end(),
+      *memory::spillMemoryPool());
+  spillRows.insert(spillRows.end(), inputRows_.begin(), inputRows_.end());
+  spiller_->spill(spillRows);
+  data_->eraseRows(folly::Range<char**>(spillRows.data(), spillRows.size()));
+
+  sortedRows_.resize(numKeptRows);
+  sortedRows_.shrink_to_fit();
+  partitionStartRows_.resize(currentPartition_ < 0 ? 0 : currentPartition_ + 2);
+  inputRows_.clear();
+  inputRows_.shrink_to_fit();
+  previousRow_ = nullptr;
+  data_->pool()->release();
+}
+
+std::optional<common::SpillStats> PartitionStreamingWindowBuild::spilledStats()
+    const {
+  if (spiller_ == nullptr) {
+    return std::nullopt;
+  }
+  return spiller_->stats();
+}
+
 void PartitionStreamingWindowBuild::noMoreInput() {
+  if (spiller_ != nullptr) {
+    spill();
+
+    VELOX_CHECK_NULL(spillReader_);
+    SpillPartitionSet spillPartitionSet;
+    spiller_->finishSpill(spillPartitionSet);
+    VELOX_CHECK_EQ(spillPartitionSet.size(), 1);
+    spillReader_ = spillPartitionSet.begin()->second->createUnorderedReader(
+        spillConfig_->readBufferSize, data_->pool(), spillStats_);
+    spillDecodedVectors_.resize(inputType_->size());
+    return;
+  }
+
   buildNextPartition();
 
   // Help for last partition related calculations.
   partitionStartRows_.push_back(sortedRows_.size());
 }
 
+void PartitionStreamingWindowBuild::loadNextPartitionFromSpill() {
+  // The Window operator is done with the previous partition.
+  sortedRows_.clear();
+  sortedRows_.shrink_to_fit();
+  data_->clear();
+
+  const auto compareFlags =
+      CompareFlags::equality(CompareFlags::NullHandlingMode::kNullAsValue);
+  for (;;) {
+    if (spillBatch_ == nullptr || spillBatchRow_ == spillBatch_->size()) {
+      if (!spillReader_->nextBatch(spillBatch_)) {
+        spillBatch_ = nullptr;
+        break;
+      }
+      spillBatchRow_ = 0;
+      for (auto i = 0; i < spillDecodedVectors_.size(); ++i) {
+        spillDecodedVectors_[i].decode(*spillBatch_->childAt(i));
+      }
+    }
+
+    if (!sortedRows_.empty()) {
+      bool newPartition = false;
+      for (const auto& [channel, _] : partitionKeyInfo_) {
+        if (data_->compare(
+                sortedRows_.back(),
+                data_->columnAt(channel),
+                spillDecodedVectors_[channel],
+                spillBatchRow_,
+                compareFlags)) {
+          newPartition = true;
+          break;
+        }
+      }
+      if (newPartition) {
+        break;
+      }
+    }
+
+    auto* newRow = data_->newRow();
+    for (auto i = 0; i < spillDecodedVectors_.size(); ++i) {
+      data_->store(spillDecodedVectors_[i], spillBatchRow_, newRow, i);
+    }
+    sortedRows_.push_back(newRow);
+    ++spillBatchRow_;
+  }
+}
+
 std::shared_ptr<WindowPartition>
 PartitionStreamingWindowBuild::nextPartition() {
+  if (spillReader_ != nullptr) {
+    VELOX_CHECK(!sortedRows_.empty(), "No window partitions available");
+    return std::make_shared<WindowPartition>(
+        data_.get(),
+        folly::Range(sortedRows_.data(), sortedRows_.size()),
+        inversedInputChannels_,
+        sortKeyInfo_);
+  }
+
   VELOX_CHECK_GT(
       partitionStartRows_.size(), 0, "No window partitions available");
 
@@ -97,6 +219,15 @@ PartitionStreamingWindowBuild::nextPartition() {
 }
 
 bool PartitionStreamingWindowBuild::hasNextPartition() {
+  if (spillReader_ != nullptr) {
+    loadNextPartitionFromSpill();
+    return !sortedRows_.empty();
+  }
+  if (spiller_ != nullptr) {
+    // The spilled partitions are read back after noMoreInput().
+    return false;
+  }
+
   return partitionStartRows_.size() > 0 &&
       currentPartition_ <
       static_cast<vector_size_t>(partitionStartRows_.size() - 2);
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "velox/exec/Spiller.h"
 #include "velox/exec/WindowBuild.h"
 
 namespace facebook::velox::exec {
@@ -24,23 +25,26 @@ namespace facebook::velox::exec {
 /// sorted by {partition keys + order by keys}. The logic identifies partition
 /// changes when receiving input rows and splits out WindowPartitions for the
 /// Window operator to process.
+///
+/// When spilled, the rows that are not yet handed out to the Window operator
+/// are written to disk in input order, and so are all the rows received after
+/// that. Once all input is received, the partitions are read back from disk
+/// one at a time. This bounds the memory to the partition being output, rather
+/// than to the partition being output plus the buffered input.
 class PartitionStreamingWindowBuild : public WindowBuild {
  public:
   PartitionStreamingWindowBuild(
       const std::shared_ptr<const core::WindowNode>& windowNode,
       velox::memory::MemoryPool* pool,
       const common::SpillConfig* spillConfig,
-      tsan_atomic<bool>* nonReclaimableSection);
+      tsan_atomic<bool>* nonReclaimableSection,
+      folly::Synchronized<common::SpillStats>* spillStats);
 
   void addInput(RowVectorPtr input) override;
 
-  void spill() override {
-    VELOX_UNREACHABLE();
-  }
+  void spill() override;
 
-  std::optional<common::SpillStats> spilledStats() const override {
-    return std::nullopt;
-  }
+  std::optional<common::SpillStats> spilledStats() const override;
 
   void noMoreInput() override;
 
@@ -50,14 +54,21 @@ class PartitionStreamingWindowBuild : public WindowBuild {
 
   bool needsInput() override {
     // No partitions are available or the currentPartition is the last available
-    // one, so can consume input rows.
-    return partitionStartRows_.empty() ||
+    // one, so can consume input rows. After spilling, all the input needs to be
+    // seen before the spilled partitions are read back.
+    return spiller_ != nullptr || partitionStartRows_.empty() ||
         currentPartition_ == partitionStartRows_.size() - 2;
   }
 
  private:
   void buildNextPartition();
 
+  // Reads the next partition from spilled data into 'data_' and
+  // 'sortedRows_'.
+  void loadNextPartitionFromSpill();
+
+  folly::Synchronized<common::SpillStats>* const spillStats_;
+
   // Vector of pointers to each input row in the data_ RowContainer.
   // Rows are erased from data_ when they are output from the
   // Window operator.
@@ -77,6 +88,18 @@ class PartitionStreamingWindowBuild : public WindowBuild {
   // Current partition being output. Used to construct WindowPartitions
   // during resetPartition.
   vector_size_t currentPartition_ = -1;
+
+  // Spiller for the rows that are not yet handed out to the Window operator.
+  // Set on first spill.
+  std::unique_ptr<SortOutputSpiller> spiller_;
+
+  // Reads back the spilled rows in input order after noMoreInput().
+  std::unique_ptr<UnorderedStreamReader<BatchStream>> spillReader_;
+
+  // The batch read from 'spillReader_' and the next row to load from it.
+  RowVectorPtr spillBatch_;
+  vector_size_t spillBatchRow_{0};
+  std::vector<DecodedVector> spillDecodedVectors_;
 };
 
 } // namespace facebook::velox::exec
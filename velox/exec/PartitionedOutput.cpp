@@ -15,7 +15,11 @@
  */
 
 #include "velox/exec/PartitionedOutput.h"
+
+#include <numeric>
+
 #include "velox/exec/OutputBufferManager.h"
+#include "velox/exec/PrefixSort.h"
 #include "velox/exec/Task.h"
 
 namespace facebook::velox::exec {
@@ -23,10 +27,18 @@ namespace {
 std::unique_ptr<VectorSerde::Options> getVectorSerdeOptions(
     const core::QueryConfig& queryConfig,
     VectorSerde::Kind kind) {
-  std::unique_ptr<VectorSerde::Options> options =
-      kind == VectorSerde::Kind::kPresto
-      ? std::make_unique<serializer::presto::PrestoVectorSerde::PrestoOptions>()
-      : std::make_unique<VectorSerde::Options>();
+  std::unique_ptr<VectorSerde::Options> options;
+  if (kind == VectorSerde::Kind::kPresto) {
+    auto prestoOptions = std::make_unique<
+        serializer::presto::PrestoVectorSerde::PrestoOptions>();
+    prestoOptions->appendDictionaries =
+        queryConfig.shuffleDictionaryEncodingEnabled();
+    prestoOptions->adaptiveCompression =
+        queryConfig.shuffleAdaptiveCompressionEnabled();
+    options = std::move(prestoOptions);
+  } else {
+    options = std::make_unique<VectorSerde::Options>();
+  }
   options->compressionKind =
       common::stringToCompressionKind(queryConfig.shuffleCompressionKind());
   options->minCompressionRatio = PartitionedOutput::minCompressionRatio();
@@ -101,7 +113,9 @@ BlockingReason Destination::advance(
     VELOX_CHECK_NOT_NULL(outputUnsafeRow);
     current_->append(*outputUnsafeRow, rows, sizes);
   } else {
-    VELOX_CHECK_EQ(serde_->kind(), VectorSerde::Kind::kPresto);
+    VELOX_CHECK(
+        serde_->kind() == VectorSerde::Kind::kPresto ||
+        serde_->kind() == VectorSerde::Kind::kArrowIpc);
     current_->append(output, rows, scratch);
   }
 
@@ -203,7 +217,8 @@ PartitionedOutput::PartitionedOutput(
       serde_(getNamedVectorSerde(planNode->serdeKind())),
       serdeOptions_(getVectorSerdeOptions(
           operatorCtx_->driverCtx()->queryConfig(),
-          planNode->serdeKind())) {
+          planNode->serdeKind())),
+      sortedRows_(0, memory::StlAllocator<char*>(*pool())) {
   if (!planNode->isPartitioned()) {
     VELOX_USER_CHECK_EQ(numDestinations_, 1);
   }
@@ -211,6 +226,97 @@ PartitionedOutput::PartitionedOutput(
     VELOX_USER_CHECK(keyChannels_.empty());
     VELOX_USER_CHECK_NULL(partitionFunction_);
   }
+  initializeSort(planNode->inputType());
+}
+
+void PartitionedOutput::initializeSort(const RowTypePtr& inputType) {
+  const auto* driverCtx = operatorCtx_->driverCtx();
+  if (!driverCtx->queryConfig().shufflePartialSortEnabled()) {
+    return;
+  }
+
+  std::vector<column_index_t> channels;
+  std::vector<TypePtr> keyTypes;
+  for (const auto channel : keyChannels_) {
+    if (channel == kConstantChannel) {
+      continue;
+    }
+    const auto& type = inputType->childAt(channel);
+    if (!type->isOrderable()) {
+      return;
+    }
+    channels.push_back(channel);
+    keyTypes.push_back(type);
+  }
+  if (channels.empty()) {
+    return;
+  }
+
+  sortKeyChannels_ = std::move(channels);
+  keyTypes.push_back(INTEGER());
+  sortCompareFlags_.assign(
+      keyTypes.size(),
+      CompareFlags{
+          true, // nullsFirst
+          true, // ascending
+          false, // equalsOnly
+          CompareFlags::NullHandlingMode::kNullAsValue});
+  prefixSortConfig_ = driverCtx->prefixSortConfig();
+  sortData_ = std::make_unique<RowContainer>(keyTypes, pool());
+}
+
+void PartitionedOutput::sortDestinationRows() {
+  const auto numInput = input_->size();
+  sortData_->clear();
+  sortInputRows_.resize(numInput);
+  for (auto row = 0; row < numInput; ++row) {
+    sortInputRows_[row] = sortData_->newRow();
+  }
+  const auto newRows = folly::Range(sortInputRows_.data(), numInput);
+
+  const SelectivityVector allRows(numInput);
+  DecodedVector decoded;
+  for (auto i = 0; i < sortKeyChannels_.size(); ++i) {
+    decoded.decode(*input_->childAt(sortKeyChannels_[i]), allRows);
+    sortData_->store(decoded, newRows, i);
+  }
+
+  if (sortRowNumbers_ == nullptr || sortRowNumbers_->size() < numInput) {
+    sortRowNumbers_ = BaseVector::create(INTEGER(), numInput, pool());
+    auto* rawRowNumbers =
+        sortRowNumbers_->asFlatVector<int32_t>()->mutableRawValues();
+    std::iota(rawRowNumbers, rawRowNumbers + numInput, 0);
+  }
+  decoded.decode(*sortRowNumbers_, allRows);
+  sortData_->store(decoded, newRows, sortKeyChannels_.size());
+
+  if (sortedRowNumbers_ == nullptr) {
+    sortedRowNumbers_ = BaseVector::create(INTEGER(), numInput, pool());
+  }
+  for (auto& destination : destinations_) {
+    auto& rows = destination->rows();
+    if (rows.size() < 2) {
+      continue;
+    }
+    sortedRows_.resize(rows.size());
+    for (auto i = 0; i < rows.size(); ++i) {
+      sortedRows_[i] = sortInputRows_[rows[i]];
+    }
+    PrefixSort::sort(
+        sortData_.get(),
+        sortCompareFlags_,
+        prefixSortConfig_,
+        pool(),
+        sortedRows_);
+    sortData_->extractColumn(
+        sortedRows_.data(),
+        rows.size(),
+        sortKeyChannels_.size(),
+        sortedRowNumbers_);
+    const auto* rawRowNumbers =
+        sortedRowNumbers_->asFlatVector<int32_t>()->rawValues();
+    std::copy(rawRowNumbers, rawRowNumbers + rows.size(), rows.data());
+  }
 }
 
 void PartitionedOutput::initializeInput(RowVectorPtr input) {
@@ -297,7 +403,9 @@ void PartitionedOutput::estimateRowSizes() {
     serde_->estimateSerializedSize(
         outputUnsafeRow_.get(), rows, sizePointers_.data());
   } else {
-    VELOX_CHECK_EQ(serde_->kind(), VectorSerde::Kind::kPresto);
+    VELOX_CHECK(
+        serde_->kind() == VectorSerde::Kind::kPresto ||
+        serde_->kind() == VectorSerde::Kind::kArrowIpc);
     serde_->estimateSerializedSize(
         output_.get(), rows, sizePointers_.data(), scratch_);
   }
@@ -348,11 +456,46 @@ void PartitionedOutput::addInput(RowVectorPtr input) {
         destinations_[singlePartition.value()]->addRows(
             IndexRange{0, numInput});
       } else {
-        for (vector_size_t i = 0; i < numInput; ++i) {
-          destinations_[partitions_[i]]->addRow(i);
-        }
+        scatterRows(numInput);
       }
     }
+    const auto numExtra =
+        partitionFunction_->extraPartitions(extraRows_, extraPartitions_);
+    for (vector_size_t i = 0; i < numExtra; ++i) {
+      destinations_[extraPartitions_[i]]->addRow(extraRows_[i]);
+    }
+  }
+
+  if (sortData_ != nullptr) {
+    sortDestinationRows();
+  }
+}
+
+void PartitionedOutput::scatterRows(vector_size_t numRows) {
+  partitionOffsets_.assign(numDestinations_ + 1, 0);
+  for (vector_size_t i = 0; i < numRows; ++i) {
+    ++partitionOffsets_[partitions_[i] + 1];
+  }
+  for (auto i = 0; i < numDestinations_; ++i) {
+    partitionOffsets_[i + 1] += partitionOffsets_[i];
+  }
+
+  // Uses the offsets as write positions, moving the offset of each
+  // destination to the end of its rows.
+  partitionedRows_.resize(numRows);
+  auto* rawRows = partitionedRows_.data();
+  for (vector_size_t i = 0; i < numRows; ++i) {
+    rawRows[partitionOffsets_[partitions_[i]]++] = i;
+  }
+
+  vector_size_t begin = 0;
+  for (auto i = 0; i < numDestinations_; ++i) {
+    const auto end = partitionOffsets_[i];
+    if (end > begin) {
+      destinations_[i]->addRows(
+          folly::Range<const vector_size_t*>(rawRows + begin, end - begin));
+    }
+    begin = end;
   }
 }
 
@@ -486,6 +629,9 @@ void PartitionedOutput::close() {
         RuntimeCounter(static_cast<int64_t>(serdeOptions_->compressionKind)));
   }
   destinations_.clear();
+  sortData_.reset();
+  sortRowNumbers_.reset();
+  sortedRowNumbers_.reset();
 }
 
 } // namespace facebook::velox::exec
@@ -16,8 +16,10 @@
 #pragma once
 
 #include <folly/Random.h>
+#include "velox/common/base/PrefixSortConfig.h"
 #include "velox/exec/Operator.h"
 #include "velox/exec/OutputBufferManager.h"
+#include "velox/exec/RowContainer.h"
 #include "velox/row/CompactRow.h"
 #include "velox/row/UnsafeRowFast.h"
 #include "velox/vector/VectorStream.h"
@@ -48,12 +50,25 @@ class Destination {
     rows_.push_back(row);
   }
 
+  /// The rows added since beginBatch(). May be reordered before the first
+  /// advance() of the batch.
+  raw_vector<vector_size_t>& rows() {
+    return rows_;
+  }
+
   void addRows(const IndexRange& rows) {
     for (auto i = 0; i < rows.size; ++i) {
       rows_.push_back(rows.begin + i);
     }
   }
 
+  /// Appends 'rows' with a single copy.
+  void addRows(folly::Range<const vector_size_t*> rows) {
+    const auto numRows = rows_.size();
+    rows_.resize(numRows + rows.size());
+    std::copy(rows.begin(), rows.end(), rows_.data() + numRows);
+  }
+
   /// Serializes row from 'output' till either 'maxBytes' have been serialized
   /// or
   BlockingReason advance(
@@ -205,6 +220,22 @@ class PartitionedOutput : public Operator {
   // Collect all rows with null keys into nullRows_.
   void collectNullRows();
 
+  // Adds the first 'numRows' input rows to the destinations in 'partitions_'.
+  // Counts the rows of each destination first, then groups the row numbers
+  // by destination in 'partitionedRows_' and adds each group to its
+  // destination with one copy. This writes to one buffer instead of to one
+  // row vector per destination, which thrashes the cache for many
+  // destinations.
+  void scatterRows(vector_size_t numRows);
+
+  // Sets up sorting the rows of each destination by the partition keys if
+  // enabled by the query config and all keys are orderable.
+  void initializeSort(const RowTypePtr& inputType);
+
+  // Sorts the rows of each destination of the current input by the partition
+  // keys. Rows with equal keys keep their input order.
+  void sortDestinationRows();
+
   // If compression in serde is enabled, this is the minimum compression that
   // must be achieved before starting to skip compression. Used for testing.
   inline static float minCompressionRatio_ = 0.8;
@@ -248,8 +279,31 @@ class PartitionedOutput : public Operator {
   SelectivityVector rows_;
   SelectivityVector nullRows_;
   std::vector<uint32_t> partitions_;
+  // The input rows grouped by destination and the per-destination offsets
+  // into them. See scatterRows().
+  raw_vector<vector_size_t> partitionedRows_;
+  std::vector<vector_size_t> partitionOffsets_;
+  // Rows replicated to more than one destination and their extra
+  // destinations. See core::PartitionFunction::extraPartitions().
+  std::vector<vector_size_t> extraRows_;
+  std::vector<uint32_t> extraPartitions_;
   std::vector<DecodedVector> decodedVectors_;
   Scratch scratch_;
+
+  // The non-constant partition key channels to sort the rows of each
+  // destination by. Empty if the rows are not sorted.
+  std::vector<column_index_t> sortKeyChannels_;
+  std::vector<CompareFlags> sortCompareFlags_;
+  common::PrefixSortConfig prefixSortConfig_;
+  // Holds the sort keys of the current input followed by the input row
+  // number, which makes the sort stable and maps the sorted rows back to the
+  // input.
+  std::unique_ptr<RowContainer> sortData_;
+  // The row in 'sortData_' of each input row.
+  std::vector<char*> sortInputRows_;
+  std::vector<char*, memory::StlAllocator<char*>> sortedRows_;
+  VectorPtr sortRowNumbers_;
+  VectorPtr sortedRowNumbers_;
 };
 
 } // namespace facebook::velox::exec
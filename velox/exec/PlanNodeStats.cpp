@@ -242,6 +242,8 @@ folly::dynamic toPlanStatsJson(const facebook::velox::exec::TaskStats& stats) {
       stat["getOutputTiming"] = operatorStat.second->getOutputTiming.toString();
       stat["finishTiming"] = operatorStat.second->finishTiming.toString();
       stat["cpuWallTiming"] = operatorStat.second->cpuWallTiming.toString();
+      stat["cpuNanos"] = operatorStat.second->cpuWallTiming.cpuNanos;
+      stat["wallNanos"] = operatorStat.second->cpuWallTiming.wallNanos;
       stat["blockedWallNanos"] = operatorStat.second->blockedWallNanos;
       stat["peakMemoryBytes"] = operatorStat.second->peakMemoryBytes;
       stat["numMemoryAllocations"] = operatorStat.second->numMemoryAllocations;
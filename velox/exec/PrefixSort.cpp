@@ -164,26 +164,35 @@ PrefixSortLayout PrefixSortLayout::generate(
 
   bool lastPrefixKeyPartial{false};
   for (auto i = 0; i < numKeys; ++i) {
-    const std::optional<uint32_t> encodedSize = PrefixSortEncoder::encodedSize(
+    std::optional<uint32_t> encodedSize = PrefixSortEncoder::encodedSize(
         types[i]->kind(),
         maxStringLengths[i].has_value()
             ? std::min(maxStringLengths[i].value(), maxStringPrefixLength)
             : maxStringPrefixLength,
         columnHasNulls[i]);
+    const bool isString = types[i]->kind() == TypeKind::VARCHAR ||
+        types[i]->kind() == TypeKind::VARBINARY;
+    // A string key that fits in the prefix is encoded in full together with
+    // its size, so that it doesn't need a fallback comparison.
+    const bool completeString = isString && maxStringLengths[i].has_value() &&
+        maxStringLengths[i].value() <= maxStringPrefixLength;
+    if (encodedSize.has_value() && completeString) {
+      encodedSize = encodedSize.value() + sizeof(uint32_t);
+    }
     if (!encodedSize.has_value() ||
         normalizedKeySize + encodedSize.value() > maxNormalizedKeySize) {
       break;
     }
     prefixOffsets.push_back(normalizedKeySize);
-    encoders.push_back({compareFlags[i].ascending, compareFlags[i].nullsFirst});
+    encoders.push_back(
+        {compareFlags[i].ascending,
+         compareFlags[i].nullsFirst,
+         completeString});
     encodeSizes.push_back(encodedSize.value());
     normalizedKeyHasNullByte.push_back(columnHasNulls[i]);
     normalizedKeySize += encodedSize.value();
     ++numNormalizedKeys;
-    if ((types[i]->kind() == TypeKind::VARCHAR ||
-         types[i]->kind() == TypeKind::VARBINARY) &&
-        (!maxStringLengths[i].has_value() ||
-         maxStringPrefixLength < maxStringLengths[i].value())) {
+    if (isString && !completeString) {
       lastPrefixKeyPartial = true;
       break;
     }
@@ -349,13 +358,22 @@ uint32_t PrefixSort::maxRequiredBytes() const {
   const auto numRows = rowContainer_->numRows();
   const auto numPages =
       memory::AllocationTraits::numPages(numRows * sortLayout_.entrySize);
-  // Prefix data size + swap buffer size.
-  return memory::AllocationTraits::pageBytes(numPages) +
+  // Prefix data size + radix sort scratch size + swap buffer size.
+  const auto numBuffers = useRadixSort(numRows) ? 2 : 1;
+  return numBuffers * memory::AllocationTraits::pageBytes(numPages) +
       pool_->preferredSize(checkedPlus<size_t>(
           sortLayout_.entrySize, AlignedBuffer::kPaddedSize)) +
       2 * pool_->alignment();
 }
 
+bool PrefixSort::useRadixSort(size_t numRows) const {
+  return !sortLayout_.hasNonNormalizedKey &&
+      sortLayout_.nonPrefixSortStartIndex == sortLayout_.numNormalizedKeys &&
+      sortLayout_.normalizedBufferSize <=
+      PrefixSortRunner::kMaxRadixSortKeyBytes &&
+      numRows >= PrefixSortRunner::kMinRadixSortEntries;
+}
+
 void PrefixSort::sortInternal(
     std::vector<char*, memory::StlAllocator<char*>>& rows) {
   const auto numRows = rows.size();
@@ -387,7 +405,18 @@ void PrefixSort::sortInternal(
           RuntimeCounter(
               sortLayout_.numNormalizedKeys, RuntimeCounter::Unit::kNone));
     }
-    if (sortLayout_.hasNonNormalizedKey ||
+    if (useRadixSort(numRows)) {
+      memory::ContiguousAllocation scratchAlloc;
+      pool_->allocateContiguous(
+          memory::AllocationTraits::numPages(numRows * entrySize),
+          scratchAlloc);
+      sortRunner.radixSort(
+          prefixBufferStart,
+          prefixBufferEnd,
+          sortLayout_.normalizedBufferSize,
+          scratchAlloc.data<char>());
+    } else if (
+        sortLayout_.hasNonNormalizedKey ||
         sortLayout_.nonPrefixSortStartIndex < sortLayout_.numNormalizedKeys) {
       sortRunner.quickSort(
           prefixBufferStart, prefixBufferEnd, [&](char* lhs, char* rhs) {
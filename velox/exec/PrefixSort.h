@@ -207,6 +207,11 @@ class PrefixSort {
   // swap buffer.
   uint32_t maxRequiredBytes() const;
 
+  // Returns true if 'numRows' rows are sorted with a radix sort on the
+  // normalized keys instead of a quick sort. This requires all keys to be
+  // fully normalized into a short prefix.
+  bool useRadixSort(size_t numRows) const;
+
   void sortInternal(std::vector<char*, memory::StlAllocator<char*>>& rows);
 
   int compareAllNormalizedKeys(char* left, char* right);
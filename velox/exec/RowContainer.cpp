@@ -139,7 +139,8 @@ RowContainer::RowContainer(
     bool isJoinBuild,
     bool hasProbedFlag,
     bool hasNormalizedKeys,
-    memory::MemoryPool* pool)
+    memory::MemoryPool* pool,
+    bool wideNormalizedKey)
     : keyTypes_(keyTypes),
       nullableKeys_(nullableKeys),
       isJoinBuild_(isJoinBuild),
@@ -261,7 +262,8 @@ RowContainer::RowContainer(
     initialNulls_.resize(flagBytes_, 0x0);
   }
   originalNormalizedKeySize_ = hasNormalizedKeys_
-      ? bits::roundUp(sizeof(normalized_key_t), alignment_)
+      ? bits::roundUp(
+            (wideNormalizedKey ? 2 : 1) * sizeof(normalized_key_t), alignment_)
       : 0;
   normalizedKeySize_ = originalNormalizedKeySize_;
   size_t nullOffsetsPos = 0;
@@ -1039,6 +1041,69 @@ void RowContainer::clear() {
   rowColumnsStats_.resize(types_.size());
 }
 
+bool RowContainer::canCompact() const {
+  if (nextOffset_ != 0 || !mutable_) {
+    return false;
+  }
+  for (const auto& accumulator : accumulators_) {
+    if (!accumulator.isFixedSize() || accumulator.usesExternalMemory()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+uint64_t RowContainer::compact() {
+  VELOX_CHECK(canCompact());
+  const int64_t oldBytes = rows_.allocatedBytes();
+  memory::AllocationPool newRows(rows_.pool());
+  newRows.setHugePageThreshold(rows_.hugePageThreshold());
+  int64_t normalizedKeysLeft = numRowsWithNormalizedKey_;
+  int64_t numNewRowsWithNormalizedKey{0};
+  uint64_t numMovedRows{0};
+  // Walks the rows in allocation order like listRows(). The rows with
+  // normalized keys are the first allocated ones and so stay at the start.
+  for (auto i = 0; i < rows_.numRanges(); ++i) {
+    const auto range = rows_.rangeAt(i);
+    auto* data =
+        range.data() + memory::alignmentPadding(range.data(), alignment_);
+    const auto limit = range.size() -
+        (reinterpret_cast<uintptr_t>(data) -
+         reinterpret_cast<uintptr_t>(range.data()));
+    int64_t offset{0};
+    for (;;) {
+      const int32_t keySize =
+          normalizedKeysLeft > 0 ? originalNormalizedKeySize_ : 0;
+      const int32_t rowSize = fixedRowSize_ + keySize;
+      if (offset + rowSize > limit) {
+        break;
+      }
+      char* row = data + offset + keySize;
+      offset += rowSize;
+      if (normalizedKeysLeft > 0) {
+        --normalizedKeysLeft;
+      }
+      if (bits::isBitSet(row, freeFlagOffset_)) {
+        continue;
+      }
+      char* newRow = newRows.allocateFixed(rowSize, alignment_);
+      ::memcpy(newRow, row - keySize, rowSize);
+      if (keySize != 0) {
+        ++numNewRowsWithNormalizedKey;
+      }
+      ++numMovedRows;
+    }
+  }
+  VELOX_CHECK_EQ(numMovedRows, numRows_);
+
+  // The old runs are freed when 'newRows' goes out of scope.
+  rows_.swap(newRows);
+  numRowsWithNormalizedKey_ = numNewRowsWithNormalizedKey;
+  firstFreeRow_ = nullptr;
+  numFreeRows_ = 0;
+  return std::max<int64_t>(0, oldBytes - rows_.allocatedBytes());
+}
+
 void RowContainer::setProbedFlag(char** rows, int32_t numRows) {
   for (auto i = 0; i < numRows; i++) {
     // Row may be null in case of a FULL join.
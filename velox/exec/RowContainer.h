@@ -303,9 +303,10 @@ class RowContainer {
   /// for a probed state of a full or right outer
   /// join. 'hasNormalizedKey' specifies that an extra word is left
   /// below each row for a normalized key that collapses all parts
-  /// into one word for faster comparison. The bulk allocation is done
-  /// from 'allocator'. ContainerRowSerde is used for serializing complex
-  /// type values into the container.
+  /// into one word for faster comparison. If 'wideNormalizedKey' is also
+  /// true, two words are left for a 128 bit normalized key. The bulk
+  /// allocation is done from 'allocator'. ContainerRowSerde is used for
+  /// serializing complex type values into the container.
   RowContainer(
       const std::vector<TypePtr>& keyTypes,
       bool nullableKeys,
@@ -315,7 +316,8 @@ class RowContainer {
       bool isJoinBuild,
       bool hasProbedFlag,
       bool hasNormalizedKey,
-      memory::MemoryPool* pool);
+      memory::MemoryPool* pool,
+      bool wideNormalizedKey = false);
 
   /// Allocates a new row and initializes possible aggregates to null.
   char* newRow();
@@ -722,6 +724,13 @@ class RowContainer {
     return reinterpret_cast<normalized_key_t*>(group)[-1];
   }
 
+  /// Returns the high word of a 128 bit normalized key. This is stored in the
+  /// word below the low word returned by normalizedKey(), so that the two
+  /// words are the 16 bytes below the row.
+  static inline normalized_key_t& normalizedKeyHigh(char* group) {
+    return reinterpret_cast<normalized_key_t*>(group)[-2];
+  }
+
   void disableNormalizedKeys() {
     normalizedKeySize_ = 0;
   }
@@ -799,6 +808,26 @@ class RowContainer {
   /// Resets the state to be as after construction. Frees memory for payload.
   void clear();
 
+  /// Returns true if the rows of 'this' can be relocated by compact(). Rows
+  /// linked into duplicate row lists of a join build or with accumulators that
+  /// keep state outside of fixed size inline values can't be moved.
+  bool canCompact() const;
+
+  /// Returns the bytes of row allocations not occupied by live rows, e.g.
+  /// erased rows on the free list and the unused tail of the last run.
+  uint64_t sparseBytes() const {
+    const int64_t liveBytes = numRows_ * fixedRowSize_ +
+        numRowsWithNormalizedKey_ * originalNormalizedKeySize_;
+    return std::max<int64_t>(0, rows_.allocatedBytes() - liveBytes);
+  }
+
+  /// Moves the live rows into newly allocated densely packed runs and frees
+  /// the old runs. The out of line data of the rows is not moved. Returns the
+  /// number of row allocation bytes freed. Invalidates all pointers to the
+  /// rows of 'this', so the caller must rebuild any structure that refers to
+  /// them, e.g. a hash table.
+  uint64_t compact();
+
   int32_t compareRows(
       const char* left,
       const char* right,
@@ -1146,6 +1175,27 @@ class RowContainer {
     VELOX_DCHECK_LE(maxRows, result->size());
     BufferPtr valuesBuffer = result->mutableValues(maxRows);
     [[maybe_unused]] auto values = valuesBuffer->asMutableRange<T>();
+    if constexpr (!useRowNumbers && !std::is_same_v<T, StringView>) {
+      // Gathers the fixed width values without touching the result nulls per
+      // row. 'rows' rarely has null rows, so these are handled afterwards.
+      bool hasNullRow = false;
+      for (int32_t i = 0; i < numRows; ++i) {
+        if (FOLLY_UNLIKELY(rows[i] == nullptr)) {
+          hasNullRow = true;
+          continue;
+        }
+        values[resultOffset + i] = valueAt<T>(rows[i], offset);
+      }
+      if (hasNullRow) {
+        for (int32_t i = 0; i < numRows; ++i) {
+          result->setNull(resultOffset + i, rows[i] == nullptr);
+        }
+      } else if (result->rawNulls() != nullptr) {
+        bits::fillBits(
+            result->mutableRawNulls(), resultOffset, maxRows, bits::kNotNull);
+      }
+      return;
+    }
     for (int32_t i = 0; i < numRows; ++i) {
       const char* row;
       if constexpr (useRowNumbers) {
@@ -1213,8 +1263,8 @@ class RowContainer {
       return compareComplexType(row, offset, decoded, index) == 0;
     } else if constexpr (
         Kind == TypeKind::VARCHAR || Kind == TypeKind::VARBINARY) {
-      return compareStringAsc(
-                 valueAt<StringView>(row, offset), decoded, index) == 0;
+      return equalsString(
+          valueAt<StringView>(row, offset), decoded.valueAt<StringView>(index));
     } else if constexpr (typeProvidesCustomComparison) {
       return SimpleVector<T>::template comparePrimitiveAscWithCustomComparison<
                  Kind>(
@@ -1252,6 +1302,13 @@ class RowContainer {
       return compareComplexType(row, column.offset(), decoded, index, flags);
     } else if constexpr (
         Kind == TypeKind::VARCHAR || Kind == TypeKind::VARBINARY) {
+      if (flags.equalsOnly) {
+        return equalsString(
+                   valueAt<StringView>(row, column.offset()),
+                   decoded.valueAt<StringView>(index))
+            ? 0
+            : 1;
+      }
       auto result = compareStringAsc(
           valueAt<StringView>(row, column.offset()), decoded, index);
       return flags.ascending ? result : result * -1;
@@ -1319,6 +1376,17 @@ class RowContainer {
         Kind == TypeKind::VARCHAR || Kind == TypeKind::VARBINARY) {
       auto leftValue = valueAt<StringView>(left, leftOffset);
       auto rightValue = valueAt<StringView>(right, rightOffset);
+      if (flags.equalsOnly) {
+        if (!leftValue.sizeAndPrefixEquals(rightValue)) {
+          return 1;
+        }
+        std::string storage;
+        return equalsString(
+                   leftValue,
+                   HashStringAllocator::contiguousString(rightValue, storage))
+            ? 0
+            : 1;
+      }
       auto result = compareStringAsc(leftValue, rightValue);
       return flags.ascending ? result : result * -1;
     } else {
@@ -1416,6 +1484,20 @@ class RowContainer {
 
   static int32_t compareStringAsc(StringView left, StringView right);
 
+  // Returns true if 'left', a string in 'this', is equal to the contiguous
+  // 'right'. The sizes and prefixes held in the StringViews are compared
+  // first, so that most mismatches do not read the characters of 'left'.
+  static bool equalsString(StringView left, StringView right) {
+    if (!left.sizeAndPrefixEquals(right)) {
+      return false;
+    }
+    if (left.isInline()) {
+      return left == right;
+    }
+    std::string storage;
+    return HashStringAllocator::contiguousString(left, storage) == right;
+  }
+
   int32_t compareComplexType(
       const char* row,
       int32_t offset,
@@ -440,6 +440,18 @@ void RowNumber::setupInputSpiller(
 void RowNumber::spill() {
   VELOX_CHECK(spillEnabled());
 
+  if (spillConfig_->partitionTargetSize != 0) {
+    // Uses fewer bits than configured if the spilled partitions are estimated
+    // to fit anyway. The next level still starts after all the configured
+    // bits, so the skipped bits are not reused.
+    const auto numBits = estimateSpillPartitionBits(
+        table_->rows(),
+        spillPartitionBits_,
+        spillConfig_->partitionTargetSize);
+    spillPartitionBits_ = HashBitRange(
+        spillPartitionBits_.begin(), spillPartitionBits_.begin() + numBits);
+  }
+
   const auto spillPartitionSet = spillHashTable();
   VELOX_CHECK_EQ(table_->numDistinct(), 0);
 
@@ -37,9 +37,11 @@ class RowsStreamingWindowBuild : public WindowBuild {
 
   void addInput(RowVectorPtr input) override;
 
-  void spill() override {
-    VELOX_UNREACHABLE();
-  }
+  /// Processed rows are erased as the output is produced, so the build only
+  /// holds about one output batch of rows per partition, which are all
+  /// referenced by the partial partition being output. There is nothing to
+  /// spill.
+  void spill() override {}
 
   std::optional<common::SpillStats> spilledStats() const override {
     return std::nullopt;
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/RuntimeFeedback.h"
+
+namespace facebook::velox::exec {
+namespace {
+const std::string kQueryStateKey{"RuntimeFeedback"};
+
+std::string makeKey(
+    const core::PlanNodeId& planNodeId,
+    const std::string& name) {
+  return fmt::format("{}.{}", planNodeId, name);
+}
+} // namespace
+
+// static
+std::shared_ptr<RuntimeFeedback> RuntimeFeedback::getInstance(
+    core::QueryCtx& queryCtx) {
+  return std::static_pointer_cast<RuntimeFeedback>(
+      queryCtx.getOrCreateQueryState(kQueryStateKey, []() {
+        return std::make_shared<RuntimeFeedback>();
+      }));
+}
+
+void RuntimeFeedback::set(
+    const core::PlanNodeId& planNodeId,
+    const std::string& name,
+    int64_t value) {
+  (*values_.wlock())[makeKey(planNodeId, name)] = value;
+}
+
+std::optional<int64_t> RuntimeFeedback::get(
+    const core::PlanNodeId& planNodeId,
+    const std::string& name) const {
+  auto values = values_.rlock();
+  auto it = values->find(makeKey(planNodeId, name));
+  if (it == values->end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+} // namespace facebook::velox::exec
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <folly/Synchronized.h>
+#include <folly/container/F14Map.h>
+
+#include "velox/core/PlanNode.h"
+#include "velox/core/QueryCtx.h"
+
+namespace facebook::velox::exec {
+
+/// Query-scoped observations of operators, keyed by plan node id and name.
+/// Operators started later, e.g. by the later Tasks of a stage or the Drivers
+/// of a later split group, start from what the earlier operators of the same
+/// plan node found instead of starting cold. Used if
+/// QueryConfig::runtimeFeedbackEnabled() is true.
+class RuntimeFeedback {
+ public:
+  /// Set when a partial aggregation is abandoned for poor reduction.
+  static inline const std::string kAbandonedPartialAggregation{
+      "abandonedPartialAggregation"};
+
+  /// Returns the feedback of the query of 'queryCtx', creating it on first
+  /// use.
+  static std::shared_ptr<RuntimeFeedback> getInstance(core::QueryCtx& queryCtx);
+
+  void set(
+      const core::PlanNodeId& planNodeId,
+      const std::string& name,
+      int64_t value);
+
+  /// Returns the last value set for 'name' of 'planNodeId', if any.
+  std::optional<int64_t> get(
+      const core::PlanNodeId& planNodeId,
+      const std::string& name) const;
+
+ private:
+  folly::Synchronized<folly::F14FastMap<std::string, int64_t>> values_;
+};
+
+} // namespace facebook::velox::exec
@@ -15,6 +15,8 @@
  */
 #include "velox/exec/ScaledScanController.h"
 
+#include "velox/exec/LocalPartition.h"
+
 using facebook::velox::common::testutil::TestValue;
 
 namespace facebook::velox::exec {
@@ -22,11 +24,13 @@ namespace facebook::velox::exec {
 ScaledScanController::ScaledScanController(
     memory::MemoryPool* nodePool,
     uint32_t numDrivers,
-    double scaleUpMemoryUsageRatio)
+    double scaleUpMemoryUsageRatio,
+    std::shared_ptr<LocalExchangeMemoryManager> outputMemoryManager)
     : queryPool_(nodePool->root()),
       nodePool_(nodePool),
       numDrivers_(numDrivers),
       scaleUpMemoryUsageRatio_(scaleUpMemoryUsageRatio),
+      outputMemoryManager_(std::move(outputMemoryManager)),
       driverPromises_(numDrivers_) {
   VELOX_CHECK_NOT_NULL(queryPool_);
   VELOX_CHECK_NOT_NULL(nodePool_);
@@ -122,6 +126,15 @@ void ScaledScanController::tryScaleLocked(
     return;
   }
 
+  if (outputMemoryManager_ != nullptr &&
+      outputMemoryManager_->bufferedBytes() * 2 >=
+          outputMemoryManager_->maxBufferBytes()) {
+    // The consumers do not keep up with the running scan drivers. Another one
+    // would only add to the buffered data.
+    ++numOutputBackedUp_;
+    return;
+  }
+
   const uint64_t peakNodeUsage = nodePool_->peakBytes();
   const uint64_t estimatedPeakNodeUsageAfterScale = std::max(
       estimatedDriverUsage_ * (numRunningDrivers_ + 1),
@@ -185,6 +198,9 @@ bool ScaledScanController::close() {
 }
 
 std::string ScaledScanController::Stats::toString() const {
-  return fmt::format("numRunningDrivers: {}", numRunningDrivers);
+  return fmt::format(
+      "numRunningDrivers: {}, numOutputBackedUp: {}",
+      numRunningDrivers,
+      numOutputBackedUp);
 }
 } // namespace facebook::velox::exec
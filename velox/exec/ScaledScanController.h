@@ -23,17 +23,24 @@ namespace test {
 class ScaledScanControllerTestHelper;
 }
 
+class LocalExchangeMemoryManager;
+
 /// Controller used to scales table scan processing based on the query memory
 /// usage.
 class ScaledScanController {
  public:
   /// 'nodePool' is the table scan node pool. 'numDrivers' is number of the
   /// table scan drivers. 'scaleUpMemoryUsageRatio' specifies the memory usage
-  /// ratio used to make scan scale up decision.
+  /// ratio used to make scan scale up decision. 'outputMemoryManager', if set,
+  /// is of the local exchange the scan pipeline produces into. The scan does
+  /// not scale up while that exchange buffers at least half of its limit, as
+  /// its consumers are then slower than the running scan drivers.
   ScaledScanController(
       memory::MemoryPool* nodePool,
       uint32_t numDrivers,
-      double scaleUpMemoryUsageRatio);
+      double scaleUpMemoryUsageRatio,
+      std::shared_ptr<LocalExchangeMemoryManager> outputMemoryManager =
+          nullptr);
 
   ~ScaledScanController();
 
@@ -59,13 +66,18 @@ class ScaledScanController {
 
   struct Stats {
     uint32_t numRunningDrivers{0};
+    /// The number of scale up decisions skipped because the output local
+    /// exchange was backed up.
+    uint32_t numOutputBackedUp{0};
 
     std::string toString() const;
   };
 
   Stats stats() const {
     std::lock_guard<std::mutex> l(lock_);
-    return {.numRunningDrivers = numRunningDrivers_};
+    return {
+        .numRunningDrivers = numRunningDrivers_,
+        .numOutputBackedUp = numOutputBackedUp_};
   }
 
   /// Invoked by the closed scan operator to close the controller. It returns
@@ -103,6 +115,7 @@ class ScaledScanController {
   memory::MemoryPool* const nodePool_;
   const uint32_t numDrivers_;
   const double scaleUpMemoryUsageRatio_;
+  const std::shared_ptr<LocalExchangeMemoryManager> outputMemoryManager_;
 
   mutable std::mutex lock_;
   uint32_t numRunningDrivers_{1};
@@ -113,6 +126,8 @@ class ScaledScanController {
   // The number of drivers that have reported memory usage.
   uint32_t numDriverReportedUsage_{0};
 
+  uint32_t numOutputBackedUp_{0};
+
   // The driver resume promises with one per each driver index.
   std::vector<std::optional<ContinuePromise>> driverPromises_;
 
@@ -69,6 +69,11 @@ class SortBuffer {
 
   std::optional<uint64_t> estimateOutputRowSize() const;
 
+  /// Returns true if the sort buffer has spilled, regardless of during input or
+  /// output processing. If spilled() is true, it means the sort buffer is in
+  /// minimal memory mode and could not be spilled further.
+  bool hasSpilled() const;
+
  private:
   // Ensures there is sufficient memory reserved to process 'input'.
   void ensureInputFits(const VectorPtr& input);
@@ -104,11 +109,6 @@ class SortBuffer {
   // there is only one hash partition for SortBuffer.
   void finishSpill();
 
-  // Returns true if the sort buffer has spilled, regardless of during input or
-  // output processing. If spilled() is true, it means the sort buffer is in
-  // minimal memory mode and could not be spilled further.
-  bool hasSpilled() const;
-
   const RowTypePtr input_;
 
   const std::vector<CompareFlags> sortCompareFlags_;
@@ -193,6 +193,18 @@ void SortedAggregations::extractForSpill(
       folly::Range(groupRows.data(), groupRows.size()), elementsVector);
 }
 
+int64_t SortedAggregations::inputSizeIncrement(
+    vector_size_t numRows,
+    int64_t variableLengthBytes) const {
+  const auto [freeRows, freeBytes] = inputData_->freeSpace();
+  if (freeRows >= numRows && freeBytes >= variableLengthBytes) {
+    return 0;
+  }
+  // Each input row is also appended to the row pointers of its group.
+  return inputData_->sizeIncrement(numRows, variableLengthBytes) +
+      numRows * sizeof(char*);
+}
+
 void SortedAggregations::clear() {
   inputData_->clear();
 }
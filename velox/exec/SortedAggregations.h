@@ -78,6 +78,12 @@ class SortedAggregations {
       const VectorPtr& input,
       vector_size_t index);
 
+  /// Returns a cap on the extra memory needed to store 'numRows' more input
+  /// rows with up to 'variableLengthBytes' of variable width data. Returns 0 if
+  /// they fit into the free space of the container that stores input rows.
+  int64_t inputSizeIncrement(vector_size_t numRows, int64_t variableLengthBytes)
+      const;
+
   /// Sorts input row for the specified groups, computes aggregations and stores
   /// results in the specified 'result' vector.
   void extractValues(folly::Range<char**> groups, const RowVectorPtr& result);
@@ -50,6 +50,21 @@ int32_t SpillMergeStream::compare(const MergeStream& other) const {
   auto& children = rowVector_->children();
   auto& otherChildren = otherStream.current().children();
   int32_t key = 0;
+  if (prefixKeys_ != nullptr && otherStream.prefixKeys_ != nullptr) {
+    const auto prefix = prefixKeys_->valueAt(index_);
+    const auto otherPrefix =
+        otherStream.prefixKeys_->valueAt(otherStream.index_);
+    VELOX_DCHECK_EQ(prefix.size(), otherPrefix.size());
+    const auto result =
+        std::memcmp(prefix.data(), otherPrefix.data(), prefix.size());
+    if (result != 0) {
+      return result;
+    }
+    key = prefixKeyFallbackIndex_;
+    if (key >= numSortKeys()) {
+      return 0;
+    }
+  }
   if (sortCompareFlags().empty()) {
     do {
       auto result = children[key]
@@ -84,6 +99,7 @@ void SpillMergeStream::close() {
   VELOX_CHECK(!closed_);
   closed_ = true;
   rowVector_.reset();
+  prefixKeys_ = nullptr;
   decoded_.clear();
   rows_.resize(0);
   index_ = 0;
@@ -103,7 +119,15 @@ SpillState::SpillState(
     const std::optional<common::PrefixSortConfig>& prefixSortConfig,
     memory::MemoryPool* pool,
     folly::Synchronized<common::SpillStats>* stats,
-    const std::string& fileCreateConfig)
+    const std::string& fileCreateConfig,
+    bool columnarFormat,
+    folly::Executor* writeExecutor,
+    const std::optional<common::PrefixSortConfig>& prefixKeyConfig,
+    const std::optional<HashBitRange>& pageRoutingBits,
+    uint32_t numPageRoutingKeys,
+    const common::SpillIoShare& ioShare,
+    bool checksumEnabled,
+    bool encryptionEnabled)
     : getSpillDirPathCb_(getSpillDirPathCb),
       updateAndCheckSpillLimitCb_(updateAndCheckSpillLimitCb),
       fileNamePrefix_(fileNamePrefix),
@@ -116,6 +140,14 @@ SpillState::SpillState(
       compressionKind_(compressionKind),
       prefixSortConfig_(prefixSortConfig),
       fileCreateConfig_(fileCreateConfig),
+      columnarFormat_(columnarFormat),
+      writeExecutor_(writeExecutor),
+      prefixKeyConfig_(prefixKeyConfig),
+      pageRoutingBits_(pageRoutingBits),
+      numPageRoutingKeys_(numPageRoutingKeys),
+      ioShare_(ioShare),
+      checksumEnabled_(checksumEnabled),
+      encryptionEnabled_(encryptionEnabled),
       pool_(pool),
       stats_(stats),
       partitionWriters_(maxPartitions_) {}
@@ -151,14 +183,37 @@ uint64_t SpillState::appendToPartition(
   TestValue::adjust(
       "facebook::velox::exec::SpillState::appendToPartition", this);
 
+  auto* writer = ensurePartitionWriter(
+      partition, std::static_pointer_cast<const RowType>(rows->type()));
+
+  const uint64_t bytes = rows->estimateFlatSize();
+  validateSpillBytesSize(bytes);
+  updateSpilledInputBytes(bytes);
+
+  IndexRange range{0, rows->size()};
+  return writer->write(rows, folly::Range<IndexRange*>(&range, 1));
+}
+
+uint64_t SpillState::appendPageToPartition(
+    uint32_t partition,
+    const RowTypePtr& type,
+    std::unique_ptr<folly::IOBuf> page) {
+  VELOX_CHECK(
+      isPartitionSpilled(partition), "Partition {} is not spilled", partition);
+  return ensurePartitionWriter(partition, type)->writePage(std::move(page));
+}
+
+SpillWriter* SpillState::ensurePartitionWriter(
+    uint32_t partition,
+    const RowTypePtr& type) {
   VELOX_CHECK_NOT_NULL(
       getSpillDirPathCb_, "Spill directory callback not specified.");
-  auto spillDir = getSpillDirPathCb_();
-  VELOX_CHECK(!spillDir.empty(), "Spill directory does not exist");
   // Ensure that partition exist before writing.
   if (partitionWriters_.at(partition) == nullptr) {
+    auto spillDir = getSpillDirPathCb_();
+    VELOX_CHECK(!spillDir.empty(), "Spill directory does not exist");
     partitionWriters_[partition] = std::make_unique<SpillWriter>(
-        std::static_pointer_cast<const RowType>(rows->type()),
+        type,
         numSortKeys_,
         sortCompareFlags_,
         compressionKind_,
@@ -168,16 +223,17 @@ uint64_t SpillState::appendToPartition(
         fileCreateConfig_,
         updateAndCheckSpillLimitCb_,
         pool_,
-        stats_);
+        stats_,
+        columnarFormat_,
+        writeExecutor_,
+        prefixKeyConfig_,
+        pageRoutingBits_,
+        numPageRoutingKeys_,
+        ioShare_,
+        checksumEnabled_,
+        encryptionEnabled_);
   }
-
-  const uint64_t bytes = rows->estimateFlatSize();
-  validateSpillBytesSize(bytes);
-  updateSpilledInputBytes(bytes);
-
-  IndexRange range{0, rows->size()};
-  return partitionWriters_[partition]->write(
-      rows, folly::Range<IndexRange*>(&range, 1));
+  return partitionWriters_[partition].get();
 }
 
 SpillWriter* SpillState::partitionWriter(uint32_t partition) const {
@@ -280,13 +336,18 @@ std::unique_ptr<UnorderedStreamReader<BatchStream>>
 SpillPartition::createUnorderedReader(
     uint64_t bufferSize,
     memory::MemoryPool* pool,
-    folly::Synchronized<common::SpillStats>* spillStats) {
+    folly::Synchronized<common::SpillStats>* spillStats,
+    std::vector<SpillReadFile*>* spillFiles) {
   VELOX_CHECK_NOT_NULL(pool);
   std::vector<std::unique_ptr<BatchStream>> streams;
   streams.reserve(files_.size());
   for (auto& fileInfo : files_) {
-    streams.push_back(FileSpillBatchStream::create(
-        SpillReadFile::create(fileInfo, bufferSize, pool, spillStats)));
+    auto spillFile =
+        SpillReadFile::create(fileInfo, bufferSize, pool, spillStats);
+    if (spillFiles != nullptr) {
+      spillFiles->push_back(spillFile.get());
+    }
+    streams.push_back(FileSpillBatchStream::create(std::move(spillFile)));
   }
   files_.clear();
   return std::make_unique<UnorderedStreamReader<BatchStream>>(
@@ -326,6 +387,8 @@ void FileSpillMergeStream::nextBatch() {
     return;
   }
   size_ = rowVector_->size();
+  prefixKeys_ = spillFile_->prefixKeys();
+  prefixKeyFallbackIndex_ = spillFile_->prefixKeyFallbackIndex();
 }
 
 void FileSpillMergeStream::close() {
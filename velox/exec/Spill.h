@@ -133,6 +133,13 @@ class SpillMergeStream : public MergeStream {
 
   // Covers all rows inn 'rowVector_' Set if 'decoded_' is non-empty.
   SelectivityVector rows_;
+
+  // The normalized prefix keys of the rows in 'rowVector_' if the source has
+  // them. Two rows with different prefix keys compare as their prefix keys.
+  const FlatVector<StringView>* prefixKeys_{nullptr};
+
+  // The first sort key to compare if the prefix keys of two rows are equal.
+  uint32_t prefixKeyFallbackIndex_{0};
 };
 
 /// A source of spilled RowVectors coming from a file.
@@ -305,11 +312,13 @@ class SpillPartition {
   /// 'bufferSize' specifies the read size from the storage. If the file
   /// system supports async read mode, then reader allocates two buffers with
   /// one buffer prefetch ahead. 'spillStats' is provided to collect the spill
-  /// stats when reading data from spilled files.
+  /// stats when reading data from spilled files. If 'spillFiles' is set, it
+  /// returns the files read by the streams of the created reader in order.
   std::unique_ptr<UnorderedStreamReader<BatchStream>> createUnorderedReader(
       uint64_t bufferSize,
       memory::MemoryPool* pool,
-      folly::Synchronized<common::SpillStats>* spillStats);
+      folly::Synchronized<common::SpillStats>* spillStats,
+      std::vector<SpillReadFile*>* spillFiles = nullptr);
 
   /// Invoked to create an ordered stream reader from this spill partition.
   /// The created reader will take the ownership of the spill files.
@@ -358,7 +367,16 @@ class SpillState {
       const std::optional<common::PrefixSortConfig>& prefixSortConfig,
       memory::MemoryPool* pool,
       folly::Synchronized<common::SpillStats>* stats,
-      const std::string& fileCreateConfig = {});
+      const std::string& fileCreateConfig = {},
+      bool columnarFormat = false,
+      folly::Executor* writeExecutor = nullptr,
+      const std::optional<common::PrefixSortConfig>& prefixKeyConfig =
+          std::nullopt,
+      const std::optional<HashBitRange>& pageRoutingBits = std::nullopt,
+      uint32_t numPageRoutingKeys = 0,
+      const common::SpillIoShare& ioShare = {},
+      bool checksumEnabled = false,
+      bool encryptionEnabled = false);
 
   /// Indicates if a given 'partition' has been spilled or not.
   bool isPartitionSpilled(uint32_t partition) const {
@@ -405,6 +423,21 @@ class SpillState {
   /// Returns the size to append to partition.
   uint64_t appendToPartition(uint32_t partition, const RowVectorPtr& rows);
 
+  /// Appends a serialized 'page' of 'type' read from a spill file with routed
+  /// pages to 'partition' as is. The rows of 'page' must hash to 'partition'.
+  /// Only supported if 'pageRoutingBits' is set. Returns the size to append
+  /// to partition.
+  uint64_t appendPageToPartition(
+      uint32_t partition,
+      const RowTypePtr& type,
+      std::unique_ptr<folly::IOBuf> page);
+
+  /// The hash bits the pages of the spill files are routed by if set, see
+  /// SpillWriter.
+  const std::optional<HashBitRange>& pageRoutingBits() const {
+    return pageRoutingBits_;
+  }
+
   /// Finishes a sorted run for 'partition'. If write is called for
   /// 'partition' again, the data does not have to be sorted relative to the
   /// data written so far.
@@ -445,6 +478,11 @@ class SpillState {
 
   SpillWriter* partitionWriter(uint32_t partition) const;
 
+  // Returns the writer of 'partition', creating it for 'type' if needed.
+  SpillWriter* ensurePartitionWriter(
+      uint32_t partition,
+      const RowTypePtr& type);
+
   const RowTypePtr type_;
 
   // A callback function that returns the spill directory path.
@@ -465,6 +503,18 @@ class SpillState {
   const common::CompressionKind compressionKind_;
   const std::optional<common::PrefixSortConfig> prefixSortConfig_;
   const std::string fileCreateConfig_;
+  const bool columnarFormat_;
+  // If set, the partition writers write spill files asynchronously on it.
+  folly::Executor* const writeExecutor_;
+  // If set, sorted spill files store the normalized prefix keys of the rows.
+  const std::optional<common::PrefixSortConfig> prefixKeyConfig_;
+  // If set, the pages of the spill files are routed by these hash bits of the
+  // 'numPageRoutingKeys_' leading columns.
+  const std::optional<HashBitRange> pageRoutingBits_;
+  const uint32_t numPageRoutingKeys_;
+  const common::SpillIoShare ioShare_;
+  const bool checksumEnabled_;
+  const bool encryptionEnabled_;
   memory::MemoryPool* const pool_;
   folly::Synchronized<common::SpillStats>* const stats_;
 
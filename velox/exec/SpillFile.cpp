@@ -15,8 +15,13 @@
  */
 
 #include "velox/exec/SpillFile.h"
+#include "velox/common/base/Crc.h"
 #include "velox/common/base/RuntimeMetrics.h"
 #include "velox/common/file/FileSystems.h"
+#include "velox/common/base/SpillIoScheduler.h"
+#include "velox/common/memory/MemoryArbitrator.h"
+#include "velox/exec/PrefixSort.h"
+#include "velox/exec/VectorHasher.h"
 #include "velox/vector/VectorStream.h"
 
 namespace facebook::velox::exec {
@@ -27,21 +32,161 @@ namespace {
 // nanosecond precision, we use this serde option to ensure the serializer
 // preserves precision.
 static const bool kDefaultUseLosslessTimestamp = true;
+
+// The name of the column to store the normalized prefix keys in spill files.
+const std::string kPrefixKeyColumnName{"__prefix_key"};
+
+std::unique_ptr<const PrefixSortLayout> makePrefixKeyLayout(
+    const RowTypePtr& type,
+    uint32_t numSortKeys,
+    const std::vector<CompareFlags>& sortCompareFlags,
+    const std::optional<common::PrefixSortConfig>& prefixKeyConfig) {
+  if (!prefixKeyConfig.has_value() || numSortKeys == 0) {
+    return nullptr;
+  }
+  std::vector<TypePtr> keyTypes;
+  keyTypes.reserve(numSortKeys);
+  for (auto i = 0; i < numSortKeys; ++i) {
+    keyTypes.push_back(type->childAt(i));
+  }
+  auto layout = std::make_unique<const PrefixSortLayout>(
+      PrefixSortLayout::generate(
+          keyTypes,
+          std::vector<bool>(numSortKeys, true),
+          sortCompareFlags.empty()
+              ? std::vector<CompareFlags>(numSortKeys, CompareFlags{})
+              : sortCompareFlags,
+          prefixKeyConfig->maxNormalizedKeyBytes,
+          prefixKeyConfig->maxStringPrefixLength,
+          std::vector<std::optional<uint32_t>>(numSortKeys, std::nullopt)));
+  if (!layout->hasNormalizedKeys) {
+    return nullptr;
+  }
+  return layout;
+}
+
+RowTypePtr withPrefixKeyColumn(const RowTypePtr& type, bool hasPrefixKeys) {
+  if (!hasPrefixKeys) {
+    return type;
+  }
+  auto names = type->names();
+  auto types = type->children();
+  names.push_back(kPrefixKeyColumnName);
+  types.push_back(VARBINARY());
+  return ROW(std::move(names), std::move(types));
+}
+
+template <typename T>
+void encodePrefixKey(
+    const PrefixSortLayout& layout,
+    column_index_t key,
+    const DecodedVector& decoded,
+    vector_size_t row,
+    char* prefix) {
+  std::optional<T> value;
+  if (!decoded.isNullAt(row)) {
+    value = decoded.valueAt<T>(row);
+  }
+  layout.encoders[key].encode(
+      value,
+      prefix + layout.prefixOffsets[key],
+      layout.encodeSizes[key],
+      layout.normalizedKeyHasNullByte[key]);
+}
+
+void encodePrefixKey(
+    TypeKind kind,
+    const PrefixSortLayout& layout,
+    column_index_t key,
+    const DecodedVector& decoded,
+    vector_size_t row,
+    char* prefix) {
+  switch (kind) {
+    case TypeKind::SMALLINT:
+      return encodePrefixKey<int16_t>(layout, key, decoded, row, prefix);
+    case TypeKind::INTEGER:
+      return encodePrefixKey<int32_t>(layout, key, decoded, row, prefix);
+    case TypeKind::BIGINT:
+      return encodePrefixKey<int64_t>(layout, key, decoded, row, prefix);
+    case TypeKind::HUGEINT:
+      return encodePrefixKey<int128_t>(layout, key, decoded, row, prefix);
+    case TypeKind::REAL:
+      return encodePrefixKey<float>(layout, key, decoded, row, prefix);
+    case TypeKind::DOUBLE:
+      return encodePrefixKey<double>(layout, key, decoded, row, prefix);
+    case TypeKind::TIMESTAMP:
+      return encodePrefixKey<Timestamp>(layout, key, decoded, row, prefix);
+    case TypeKind::VARCHAR:
+      [[fallthrough]];
+    case TypeKind::VARBINARY:
+      return encodePrefixKey<StringView>(layout, key, decoded, row, prefix);
+    default:
+      VELOX_UNSUPPORTED(
+          "Spill prefix key does not support type kind: {}",
+          mapTypeKindToName(kind));
+  }
+}
+
+// Returns the routing header of a page of 'pageSize' bytes which holds the
+// rows of routing 'partition'.
+std::unique_ptr<folly::IOBuf> makePageRoutingHeader(
+    int32_t partition,
+    uint64_t pageSize) {
+  VELOX_CHECK_LE(pageSize, std::numeric_limits<int32_t>::max());
+  const int32_t size = pageSize;
+  auto header = folly::IOBuf::create(2 * sizeof(int32_t));
+  std::memcpy(header->writableData(), &partition, sizeof(int32_t));
+  std::memcpy(header->writableData() + sizeof(int32_t), &size, sizeof(int32_t));
+  header->append(2 * sizeof(int32_t));
+  return header;
+}
+
+// Writes 'iobuf' to 'file' once the process-wide spill IO scheduler, if set
+// up, admits it. Returns the written bytes and adds the time of the write
+// without the scheduler wait to 'writeTimeNs'.
+uint64_t scheduleWrite(
+    SpillWriteFile* file,
+    std::unique_ptr<folly::IOBuf> iobuf,
+    const common::SpillIoShare& ioShare,
+    uint64_t& writeTimeNs) {
+  auto* scheduler = common::SpillIoScheduler::instance();
+  if (scheduler != nullptr) {
+    scheduler->accept(
+        ioShare.queryId, ioShare.weight, iobuf->computeChainDataLength());
+  }
+  auto releaseGuard = folly::makeGuard([&]() {
+    if (scheduler != nullptr) {
+      scheduler->release(ioShare.queryId);
+    }
+  });
+  NanosecondTimer timer(&writeTimeNs);
+  return file->write(std::move(iobuf));
+}
 } // namespace
 
 std::unique_ptr<SpillWriteFile> SpillWriteFile::create(
     uint32_t id,
     const std::string& pathPrefix,
-    const std::string& fileCreateConfig) {
-  return std::unique_ptr<SpillWriteFile>(
-      new SpillWriteFile(id, pathPrefix, fileCreateConfig));
+    const std::string& fileCreateConfig,
+    bool checksumEnabled,
+    bool encryptionEnabled) {
+  return std::unique_ptr<SpillWriteFile>(new SpillWriteFile(
+      id, pathPrefix, fileCreateConfig, checksumEnabled, encryptionEnabled));
 }
 
 SpillWriteFile::SpillWriteFile(
     uint32_t id,
     const std::string& pathPrefix,
-    const std::string& fileCreateConfig)
-    : id_(id), path_(fmt::format("{}-{}", pathPrefix, ordinalCounter_++)) {
+    const std::string& fileCreateConfig,
+    bool checksumEnabled,
+    bool encryptionEnabled)
+    : id_(id),
+      path_(fmt::format("{}-{}", pathPrefix, ordinalCounter_++)),
+      checksumEnabled_(checksumEnabled),
+      cipher_(
+          encryptionEnabled ? std::make_unique<SpillFileCipher>(
+                                  SpillFileCipher::makeKey())
+                            : nullptr) {
   auto fs = filesystems::getFileSystem(path_, nullptr);
   file_ = fs->openFileForWrite(
       path_,
@@ -67,9 +212,36 @@ uint64_t SpillWriteFile::size() const {
 }
 
 uint64_t SpillWriteFile::write(std::unique_ptr<folly::IOBuf> iobuf) {
-  auto writtenBytes = iobuf->computeChainDataLength();
-  file_->append(std::move(iobuf));
-  return writtenBytes;
+  if (!checksumEnabled_ && cipher_ == nullptr) {
+    auto writtenBytes = iobuf->computeChainDataLength();
+    file_->append(std::move(iobuf));
+    return writtenBytes;
+  }
+
+  if (cipher_ != nullptr) {
+    iobuf->prependChain(
+        folly::IOBuf::copyBuffer(cipher_->encrypt(numBlocks_, *iobuf)));
+  }
+  ++numBlocks_;
+  uint32_t checksum{0};
+  if (checksumEnabled_) {
+    bits::Crc32c crc;
+    for (const auto& range : *iobuf) {
+      crc.process_bytes(range.data(), range.size());
+    }
+    checksum = crc.checksum();
+  }
+  const auto blockSize = iobuf->computeChainDataLength();
+  VELOX_CHECK_LE(blockSize, std::numeric_limits<int32_t>::max());
+  const int32_t size = blockSize;
+  auto block = folly::IOBuf::create(kBlockHeaderSize);
+  std::memcpy(block->writableData(), &size, sizeof(int32_t));
+  std::memcpy(
+      block->writableData() + sizeof(int32_t), &checksum, sizeof(uint32_t));
+  block->append(kBlockHeaderSize);
+  block->prependChain(std::move(iobuf));
+  file_->append(std::move(block));
+  return kBlockHeaderSize + blockSize;
 }
 
 SpillWriter::SpillWriter(
@@ -83,7 +255,15 @@ SpillWriter::SpillWriter(
     const std::string& fileCreateConfig,
     common::UpdateAndCheckSpillLimitCB& updateAndCheckSpillLimitCb,
     memory::MemoryPool* pool,
-    folly::Synchronized<common::SpillStats>* stats)
+    folly::Synchronized<common::SpillStats>* stats,
+    bool columnarFormat,
+    folly::Executor* writeExecutor,
+    const std::optional<common::PrefixSortConfig>& prefixKeyConfig,
+    const std::optional<HashBitRange>& pageRoutingBits,
+    uint32_t numPageRoutingKeys,
+    const common::SpillIoShare& ioShare,
+    bool checksumEnabled,
+    bool encryptionEnabled)
     : type_(type),
       numSortKeys_(numSortKeys),
       sortCompareFlags_(sortCompareFlags),
@@ -92,6 +272,24 @@ SpillWriter::SpillWriter(
       targetFileSize_(targetFileSize),
       writeBufferSize_(writeBufferSize),
       fileCreateConfig_(fileCreateConfig),
+      columnarFormat_(columnarFormat),
+      serdeOptions_{
+          kDefaultUseLosslessTimestamp,
+          compressionKind_,
+          0.8,
+          /*nullsFirst=*/true},
+      writeExecutor_(writeExecutor),
+      prefixKeyLayout_(makePrefixKeyLayout(
+          type_,
+          numSortKeys_,
+          sortCompareFlags_,
+          prefixKeyConfig)),
+      fileType_(withPrefixKeyColumn(type_, prefixKeyLayout_ != nullptr)),
+      pageRoutingBits_(pageRoutingBits),
+      numPageRoutingKeys_(numPageRoutingKeys),
+      ioShare_(ioShare),
+      checksumEnabled_(checksumEnabled),
+      encryptionEnabled_(encryptionEnabled),
       updateAndCheckSpillLimitCb_(updateAndCheckSpillLimitCb),
       pool_(pool),
       serde_(getNamedVectorSerde(VectorSerde::Kind::kPresto)),
@@ -100,6 +298,23 @@ SpillWriter::SpillWriter(
   // comparison flags, then it must match the number of sorting keys.
   VELOX_CHECK(
       sortCompareFlags_.empty() || sortCompareFlags_.size() == numSortKeys_);
+  if (pageRoutingBits_.has_value()) {
+    VELOX_CHECK(
+        !columnarFormat_,
+        "Spill page routing is not supported with the columnar format");
+    VELOX_CHECK_GT(numPageRoutingKeys_, 0);
+    VELOX_CHECK_LE(numPageRoutingKeys_, type_->size());
+    routingHashers_.reserve(numPageRoutingKeys_);
+    for (auto i = 0; i < numPageRoutingKeys_; ++i) {
+      routingHashers_.push_back(VectorHasher::create(type_->childAt(i), i));
+    }
+  }
+}
+
+SpillWriter::~SpillWriter() {
+  if (pendingWrite_ != nullptr) {
+    pendingWrite_->close();
+  }
 }
 
 SpillWriteFile* SpillWriter::ensureFile() {
@@ -110,7 +325,9 @@ SpillWriteFile* SpillWriter::ensureFile() {
     currentFile_ = SpillWriteFile::create(
         nextFileId_++,
         fmt::format("{}-{}", pathPrefix_, finishedFiles_.size()),
-        fileCreateConfig_);
+        fileCreateConfig_,
+        checksumEnabled_,
+        encryptionEnabled_);
   }
   return currentFile_.get();
 }
@@ -119,6 +336,7 @@ void SpillWriter::closeFile() {
   if (currentFile_ == nullptr) {
     return;
   }
+  waitForPendingWrite();
   currentFile_->finish();
   updateSpilledFileStats(currentFile_->size());
   finishedFiles_.push_back(SpillFileInfo{
@@ -128,7 +346,17 @@ void SpillWriter::closeFile() {
       .size = currentFile_->size(),
       .numSortKeys = numSortKeys_,
       .sortFlags = sortCompareFlags_,
-      .compressionKind = compressionKind_});
+      .compressionKind = compressionKind_,
+      .columnar = columnarFormat_,
+      .prefixKeySize = prefixKeyLayout_ == nullptr
+          ? 0
+          : prefixKeyLayout_->normalizedBufferSize,
+      .prefixKeyFallbackIndex = prefixKeyLayout_ == nullptr
+          ? 0
+          : prefixKeyLayout_->nonPrefixSortStartIndex,
+      .pageRoutingBits = pageRoutingBits_,
+      .checksum = currentFile_->checksumEnabled(),
+      .encryptionKey = currentFile_->encryptionKey()});
   currentFile_.reset();
 }
 
@@ -137,34 +365,81 @@ size_t SpillWriter::numFinishedFiles() const {
 }
 
 uint64_t SpillWriter::flush() {
-  if (batch_ == nullptr) {
+  if (batch_ == nullptr && columnBatches_.empty() && routedBatches_.empty() &&
+      unroutedPages_ == nullptr) {
     return 0;
   }
 
-  auto* file = ensureFile();
-  VELOX_CHECK_NOT_NULL(file);
-
-  IOBufOutputStream out(
-      *pool_, nullptr, std::max<int64_t>(64 * 1024, batch_->size()));
+  std::unique_ptr<folly::IOBuf> iobuf;
   uint64_t flushTimeNs{0};
-  {
+  if (columnarFormat_) {
     NanosecondTimer timer(&flushTimeNs);
-    batch_->flush(&out);
+    iobuf = flushColumns();
+  } else if (pageRoutingBits_.has_value()) {
+    NanosecondTimer timer(&flushTimeNs);
+    iobuf = flushRoutedPages();
+  } else {
+    IOBufOutputStream out(
+        *pool_, nullptr, std::max<int64_t>(64 * 1024, batch_->size()));
+    {
+      NanosecondTimer timer(&flushTimeNs);
+      batch_->flush(&out);
+    }
+    batch_.reset();
+    iobuf = out.getIOBuf();
   }
-  batch_.reset();
 
-  uint64_t writeTimeNs{0};
-  uint64_t writtenBytes{0};
-  auto iobuf = out.getIOBuf();
-  {
-    NanosecondTimer timer(&writeTimeNs);
-    writtenBytes = file->write(std::move(iobuf));
+  if (writeExecutor_ != nullptr) {
+    // Waits for the previous write so that the file is written in order and
+    // at most one serialized buffer is in flight.
+    waitForPendingWrite();
+    auto* file = ensureFile();
+    VELOX_CHECK_NOT_NULL(file);
+    const auto writtenBytes = iobuf->computeChainDataLength();
+    pendingWrite_ = memory::createAsyncMemoryReclaimTask<WriteResult>(
+        [file,
+         flushTimeNs,
+         ioShare = ioShare_,
+         buffer = std::shared_ptr<folly::IOBuf>(std::move(iobuf))]() {
+          auto result = std::make_unique<WriteResult>();
+          result->flushTimeNs = flushTimeNs;
+          result->writeTimeNs = 0;
+          result->writtenBytes = scheduleWrite(
+              file, buffer->clone(), ioShare, result->writeTimeNs);
+          return result;
+        });
+    writeExecutor_->add([source = pendingWrite_]() { source->prepare(); });
+    return writtenBytes;
   }
+
+  auto* file = ensureFile();
+  VELOX_CHECK_NOT_NULL(file);
+  uint64_t writeTimeNs{0};
+  const auto writtenBytes =
+      scheduleWrite(file, std::move(iobuf), ioShare_, writeTimeNs);
   updateWriteStats(writtenBytes, flushTimeNs, writeTimeNs);
   updateAndCheckSpillLimitCb_(writtenBytes);
   return writtenBytes;
 }
 
+void SpillWriter::waitForPendingWrite() {
+  if (pendingWrite_ == nullptr) {
+    return;
+  }
+  auto pendingWrite = std::move(pendingWrite_);
+  std::unique_ptr<WriteResult> result;
+  uint64_t waitTimeNs{0};
+  {
+    NanosecondTimer timer(&waitTimeNs);
+    result = pendingWrite->move();
+  }
+  VELOX_CHECK_NOT_NULL(result);
+  stats_->wlock()->spillWriteWaitTimeNanos += waitTimeNs;
+  updateWriteStats(
+      result->writtenBytes, result->flushTimeNs, result->writeTimeNs);
+  updateAndCheckSpillLimitCb_(result->writtenBytes);
+}
+
 uint64_t SpillWriter::write(
     const RowVectorPtr& rows,
     const folly::Range<IndexRange*>& indices) {
@@ -173,27 +448,237 @@ uint64_t SpillWriter::write(
   uint64_t timeNs{0};
   {
     NanosecondTimer timer(&timeNs);
-    if (batch_ == nullptr) {
-      serializer::presto::PrestoVectorSerde::PrestoOptions options = {
-          kDefaultUseLosslessTimestamp,
-          compressionKind_,
-          0.8,
-          /*nullsFirst=*/true};
-      batch_ = std::make_unique<VectorStreamGroup>(pool_, serde_);
-      batch_->createStreamTree(
-          std::static_pointer_cast<const RowType>(rows->type()),
-          1'000,
-          &options);
+    const auto input =
+        prefixKeyLayout_ == nullptr ? rows : addPrefixKeys(rows, indices);
+    if (columnarFormat_) {
+      appendColumns(input, indices);
+    } else if (pageRoutingBits_.has_value()) {
+      appendRoutedRows(input, indices);
+    } else {
+      if (batch_ == nullptr) {
+        batch_ = std::make_unique<VectorStreamGroup>(pool_, serde_);
+        batch_->createStreamTree(
+            std::static_pointer_cast<const RowType>(input->type()),
+            1'000,
+            &serdeOptions_);
+      }
+      batch_->append(input, indices);
     }
-    batch_->append(rows, indices);
   }
   updateAppendStats(rows->size(), timeNs);
-  if (batch_->size() < writeBufferSize_) {
+  if (bufferedBytes() < writeBufferSize_) {
+    return 0;
+  }
+  return flush();
+}
+
+void SpillWriter::appendColumns(
+    const RowVectorPtr& rows,
+    const folly::Range<IndexRange*>& indices) {
+  const auto numColumns = fileType_->size();
+  if (columnBatches_.empty()) {
+    columnBatches_.reserve(numColumns);
+    for (auto i = 0; i < numColumns; ++i) {
+      auto batch = std::make_unique<VectorStreamGroup>(pool_, serde_);
+      batch->createStreamTree(
+          ROW({fileType_->nameOf(i)}, {fileType_->childAt(i)}),
+          1'000,
+          &serdeOptions_);
+      columnBatches_.push_back(std::move(batch));
+    }
+  }
+  for (auto i = 0; i < numColumns; ++i) {
+    auto column = std::make_shared<RowVector>(
+        pool_,
+        ROW({fileType_->nameOf(i)}, {fileType_->childAt(i)}),
+        nullptr,
+        rows->size(),
+        std::vector<VectorPtr>{rows->childAt(i)});
+    columnBatches_[i]->append(column, indices);
+  }
+}
+
+std::unique_ptr<folly::IOBuf> SpillWriter::flushColumns() {
+  const int32_t numColumns = columnBatches_.size();
+  auto header = folly::IOBuf::create(sizeof(int32_t) * (1 + numColumns));
+  auto* rawHeader = header->writableData();
+  std::memcpy(rawHeader, &numColumns, sizeof(int32_t));
+  header->append(sizeof(int32_t) * (1 + numColumns));
+
+  for (auto i = 0; i < numColumns; ++i) {
+    auto& batch = columnBatches_[i];
+    IOBufOutputStream out(
+        *pool_, nullptr, std::max<int64_t>(64 * 1024, batch->size()));
+    batch->flush(&out);
+    auto chunk = out.getIOBuf();
+    const auto chunkSize = chunk->computeChainDataLength();
+    VELOX_CHECK_LE(chunkSize, std::numeric_limits<int32_t>::max());
+    const int32_t size = chunkSize;
+    std::memcpy(
+        rawHeader + sizeof(int32_t) * (1 + i), &size, sizeof(int32_t));
+    header->prependChain(std::move(chunk));
+  }
+  columnBatches_.clear();
+  return header;
+}
+
+uint64_t SpillWriter::writePage(std::unique_ptr<folly::IOBuf> page) {
+  checkNotFinished();
+  VELOX_CHECK(
+      pageRoutingBits_.has_value(), "Spill writer pages are not routed");
+  VELOX_CHECK_NOT_NULL(page);
+
+  const auto pageSize = page->computeChainDataLength();
+  auto header = makePageRoutingHeader(kUnroutedPage, pageSize);
+  unroutedPageBytes_ += header->length() + pageSize;
+  header->prependChain(std::move(page));
+  if (unroutedPages_ == nullptr) {
+    unroutedPages_ = std::move(header);
+  } else {
+    unroutedPages_->prependChain(std::move(header));
+  }
+  if (bufferedBytes() < writeBufferSize_) {
     return 0;
   }
   return flush();
 }
 
+void SpillWriter::appendRoutedRows(
+    const RowVectorPtr& rows,
+    const folly::Range<IndexRange*>& indices) {
+  SelectivityVector selectedRows(rows->size(), false);
+  for (const auto& range : indices) {
+    selectedRows.setValidRange(range.begin, range.begin + range.size, true);
+  }
+  selectedRows.updateBounds();
+
+  routingHashes_.resize(rows->size());
+  for (auto i = 0; i < routingHashers_.size(); ++i) {
+    routingHashers_[i]->decode(*rows->childAt(i), selectedRows);
+    routingHashers_[i]->hash(selectedRows, i > 0, routingHashes_);
+  }
+
+  const auto numPartitions = pageRoutingBits_->numPartitions();
+  // The ranges of consecutive rows per routing partition.
+  std::vector<std::vector<IndexRange>> partitionRanges(numPartitions);
+  selectedRows.applyToSelected([&](auto row) {
+    auto& ranges =
+        partitionRanges[pageRoutingBits_->partition(routingHashes_[row])];
+    if (!ranges.empty() &&
+        ranges.back().begin + ranges.back().size == row) {
+      ++ranges.back().size;
+    } else {
+      ranges.push_back(IndexRange{row, 1});
+    }
+  });
+
+  routedBatches_.resize(numPartitions);
+  for (auto partition = 0; partition < numPartitions; ++partition) {
+    auto& ranges = partitionRanges[partition];
+    if (ranges.empty()) {
+      continue;
+    }
+    auto& batch = routedBatches_[partition];
+    if (batch == nullptr) {
+      batch = std::make_unique<VectorStreamGroup>(pool_, serde_);
+      batch->createStreamTree(fileType_, 1'000, &serdeOptions_);
+    }
+    batch->append(
+        rows, folly::Range<IndexRange*>(ranges.data(), ranges.size()));
+  }
+}
+
+std::unique_ptr<folly::IOBuf> SpillWriter::flushRoutedPages() {
+  std::unique_ptr<folly::IOBuf> pages;
+  auto addPage = [&](std::unique_ptr<folly::IOBuf> page) {
+    if (pages == nullptr) {
+      pages = std::move(page);
+    } else {
+      pages->prependChain(std::move(page));
+    }
+  };
+  for (int32_t partition = 0; partition < routedBatches_.size(); ++partition) {
+    auto& batch = routedBatches_[partition];
+    if (batch == nullptr) {
+      continue;
+    }
+    IOBufOutputStream out(
+        *pool_, nullptr, std::max<int64_t>(64 * 1024, batch->size()));
+    batch->flush(&out);
+    auto page = out.getIOBuf();
+    auto header =
+        makePageRoutingHeader(partition, page->computeChainDataLength());
+    header->prependChain(std::move(page));
+    addPage(std::move(header));
+  }
+  routedBatches_.clear();
+  if (unroutedPages_ != nullptr) {
+    addPage(std::move(unroutedPages_));
+    unroutedPageBytes_ = 0;
+  }
+  return pages;
+}
+
+RowVectorPtr SpillWriter::addPrefixKeys(
+    const RowVectorPtr& rows,
+    const folly::Range<IndexRange*>& indices) {
+  const auto& layout = *prefixKeyLayout_;
+  const auto prefixSize = layout.normalizedBufferSize;
+  SelectivityVector selectedRows(rows->size(), false);
+  for (const auto& range : indices) {
+    selectedRows.setValidRange(range.begin, range.begin + range.size, true);
+  }
+  selectedRows.updateBounds();
+
+  std::vector<DecodedVector> decodedKeys(layout.numNormalizedKeys);
+  for (auto i = 0; i < layout.numNormalizedKeys; ++i) {
+    decodedKeys[i].decode(*rows->childAt(i), selectedRows);
+  }
+
+  auto prefixKeys = BaseVector::create<FlatVector<StringView>>(
+      VARBINARY(), rows->size(), pool_);
+  std::string prefix(prefixSize, '\0');
+  selectedRows.applyToSelected([&](auto row) {
+    // Clears the padding bytes.
+    std::memset(prefix.data(), 0, prefixSize);
+    for (auto i = 0; i < layout.numNormalizedKeys; ++i) {
+      encodePrefixKey(
+          type_->childAt(i)->kind(),
+          layout,
+          i,
+          decodedKeys[i],
+          row,
+          prefix.data());
+    }
+    prefixKeys->set(row, StringView(prefix.data(), prefixSize));
+  });
+
+  auto children = rows->children();
+  children.push_back(std::move(prefixKeys));
+  return std::make_shared<RowVector>(
+      pool_, fileType_, nullptr, rows->size(), std::move(children));
+}
+
+uint64_t SpillWriter::bufferedBytes() const {
+  if (pageRoutingBits_.has_value()) {
+    uint64_t bytes{unroutedPageBytes_};
+    for (const auto& batch : routedBatches_) {
+      if (batch != nullptr) {
+        bytes += batch->size();
+      }
+    }
+    return bytes;
+  }
+  if (!columnarFormat_) {
+    return batch_ == nullptr ? 0 : batch_->size();
+  }
+  uint64_t bytes{0};
+  for (const auto& batch : columnBatches_) {
+    bytes += batch->size();
+  }
+  return bytes;
+}
+
 void SpillWriter::updateAppendStats(
     uint64_t numRows,
     uint64_t serializationTimeNs) {
@@ -268,7 +753,8 @@ std::unique_ptr<SpillReadFile> SpillReadFile::create(
     const SpillFileInfo& fileInfo,
     uint64_t bufferSize,
     memory::MemoryPool* pool,
-    folly::Synchronized<common::SpillStats>* stats) {
+    folly::Synchronized<common::SpillStats>* stats,
+    const std::vector<column_index_t>& projection) {
   return std::unique_ptr<SpillReadFile>(new SpillReadFile(
       fileInfo.id,
       fileInfo.path,
@@ -278,10 +764,36 @@ std::unique_ptr<SpillReadFile> SpillReadFile::create(
       fileInfo.numSortKeys,
       fileInfo.sortFlags,
       fileInfo.compressionKind,
+      fileInfo.columnar,
+      fileInfo.prefixKeySize,
+      fileInfo.prefixKeyFallbackIndex,
+      fileInfo.pageRoutingBits,
+      fileInfo.checksum,
+      fileInfo.encryptionKey,
+      projection,
       pool,
       stats));
 }
 
+namespace {
+RowTypePtr projectType(
+    const RowTypePtr& type,
+    const std::vector<column_index_t>& projection) {
+  if (projection.empty()) {
+    return type;
+  }
+  std::vector<std::string> names;
+  std::vector<TypePtr> types;
+  names.reserve(projection.size());
+  types.reserve(projection.size());
+  for (auto channel : projection) {
+    names.push_back(type->nameOf(channel));
+    types.push_back(type->childAt(channel));
+  }
+  return ROW(std::move(names), std::move(types));
+}
+} // namespace
+
 SpillReadFile::SpillReadFile(
     uint32_t id,
     const std::string& path,
@@ -291,6 +803,13 @@ SpillReadFile::SpillReadFile(
     uint32_t numSortKeys,
     const std::vector<CompareFlags>& sortCompareFlags,
     common::CompressionKind compressionKind,
+    bool columnar,
+    uint32_t prefixKeySize,
+    uint32_t prefixKeyFallbackIndex,
+    const std::optional<HashBitRange>& pageRoutingBits,
+    bool checksum,
+    const std::string& encryptionKey,
+    const std::vector<column_index_t>& projection,
     memory::MemoryPool* pool,
     folly::Synchronized<common::SpillStats>* stats)
     : id_(id),
@@ -300,6 +819,18 @@ SpillReadFile::SpillReadFile(
       numSortKeys_(numSortKeys),
       sortCompareFlags_(sortCompareFlags),
       compressionKind_(compressionKind),
+      columnar_(columnar),
+      prefixKeySize_(prefixKeySize),
+      prefixKeyFallbackIndex_(prefixKeyFallbackIndex),
+      pageRoutingBits_(pageRoutingBits),
+      checksum_(checksum),
+      cipher_(
+          encryptionKey.empty()
+              ? nullptr
+              : std::make_unique<SpillFileCipher>(encryptionKey)),
+      fileType_(withPrefixKeyColumn(type_, prefixKeySize_ != 0)),
+      projection_(projection),
+      readType_(projectType(type_, projection_)),
       readOptions_{
           kDefaultUseLosslessTimestamp,
           compressionKind_,
@@ -315,7 +846,7 @@ SpillReadFile::SpillReadFile(
 }
 
 bool SpillReadFile::nextBatch(RowVectorPtr& rowVector) {
-  if (input_->atEnd()) {
+  if (atEnd()) {
     recordSpillStats();
     return false;
   }
@@ -323,14 +854,186 @@ bool SpillReadFile::nextBatch(RowVectorPtr& rowVector) {
   uint64_t timeNs{0};
   {
     NanosecondTimer timer{&timeNs};
-    VectorStreamGroup::read(
-        input_.get(), pool_, type_, serde_, &rowVector, &readOptions_);
+    auto* input = recordInput();
+    if (pageRoutingBits_.has_value()) {
+      // Skips the routing partition and the byte size of the page.
+      input->skip(2 * sizeof(int32_t));
+    }
+    if (!columnar_ && prefixKeySize_ == 0 && projection_.empty()) {
+      VectorStreamGroup::read(
+          input, pool_, type_, serde_, &rowVector, &readOptions_);
+    } else {
+      std::vector<VectorPtr> columns;
+      vector_size_t numRows;
+      if (columnar_) {
+        numRows = readColumns(input, columns);
+      } else {
+        RowVectorPtr batch;
+        VectorStreamGroup::read(
+            input, pool_, fileType_, serde_, &batch, &readOptions_);
+        numRows = batch->size();
+        columns = batch->children();
+      }
+      rowVector = makeReadBatch(columns, numRows);
+    }
   }
   stats_->wlock()->spillDeserializationTimeNanos += timeNs;
   common::updateGlobalSpillDeserializationTimeNs(timeNs);
   return true;
 }
 
+bool SpillReadFile::nextPage(
+    int32_t& partition,
+    std::unique_ptr<folly::IOBuf>& page) {
+  VELOX_CHECK(
+      pageRoutingBits_.has_value(),
+      "Spill file {} has no routed pages",
+      path_);
+  if (atEnd()) {
+    return false;
+  }
+  auto* input = recordInput();
+  partition = input->read<int32_t>();
+  const auto pageSize = input->read<int32_t>();
+  page = folly::IOBuf::create(pageSize);
+  input->readBytes(page->writableData(), pageSize);
+  page->append(pageSize);
+  return true;
+}
+
+RowVectorPtr SpillReadFile::deserializePage(const folly::IOBuf& page) {
+  std::vector<ByteRange> ranges;
+  for (const auto& range : page) {
+    ranges.push_back(ByteRange{
+        const_cast<uint8_t*>(range.data()),
+        static_cast<int32_t>(range.size()),
+        0});
+  }
+  BufferInputStream input(std::move(ranges));
+
+  RowVectorPtr rowVector;
+  uint64_t timeNs{0};
+  {
+    NanosecondTimer timer{&timeNs};
+    VectorStreamGroup::read(
+        &input, pool_, fileType_, serde_, &rowVector, &readOptions_);
+    if (prefixKeySize_ != 0 || !projection_.empty()) {
+      auto columns = rowVector->children();
+      rowVector = makeReadBatch(columns, rowVector->size());
+    }
+  }
+  stats_->wlock()->spillDeserializationTimeNanos += timeNs;
+  common::updateGlobalSpillDeserializationTimeNs(timeNs);
+  return rowVector;
+}
+
+vector_size_t SpillReadFile::readColumns(
+    ByteInputStream* input,
+    std::vector<VectorPtr>& columns) {
+  const auto numColumns = input->read<int32_t>();
+  VELOX_CHECK_EQ(numColumns, static_cast<int32_t>(fileType_->size()));
+  std::vector<int32_t> chunkSizes(numColumns);
+  for (auto& chunkSize : chunkSizes) {
+    chunkSize = input->read<int32_t>();
+  }
+
+  columns.resize(numColumns);
+  std::vector<bool> needed(numColumns, projection_.empty());
+  for (auto channel : projection_) {
+    needed[channel] = true;
+  }
+  if (prefixKeySize_ != 0) {
+    needed.back() = true;
+  }
+  vector_size_t numRows{0};
+  for (auto i = 0; i < numColumns; ++i) {
+    if (!needed[i]) {
+      input->skip(chunkSizes[i]);
+      continue;
+    }
+    RowVectorPtr column;
+    VectorStreamGroup::read(
+        input,
+        pool_,
+        ROW({fileType_->nameOf(i)}, {fileType_->childAt(i)}),
+        serde_,
+        &column,
+        &readOptions_);
+    numRows = column->size();
+    columns[i] = column->childAt(0);
+  }
+  return numRows;
+}
+
+bool SpillReadFile::atEnd() const {
+  if (blockInput_ != nullptr && !blockInput_->atEnd()) {
+    return false;
+  }
+  return input_->atEnd();
+}
+
+ByteInputStream* SpillReadFile::recordInput() {
+  if (!framed()) {
+    return input_.get();
+  }
+  if (blockInput_ == nullptr || blockInput_->atEnd()) {
+    loadBlock();
+  }
+  return blockInput_.get();
+}
+
+void SpillReadFile::loadBlock() {
+  const auto blockSize = input_->read<int32_t>();
+  const auto checksum = input_->read<uint32_t>();
+  VELOX_CHECK_GE(blockSize, 0, "Corrupt block size in spill file {}", path_);
+  if (block_ == nullptr || block_->capacity() < blockSize) {
+    block_ = AlignedBuffer::allocate<uint8_t>(blockSize, pool_);
+  }
+  // The block is read once into 'block_', then verified and decrypted in place
+  // and deserialized from there.
+  auto* data = block_->asMutable<uint8_t>();
+  input_->readBytes(data, blockSize);
+  if (checksum_) {
+    bits::Crc32c crc;
+    crc.process_bytes(data, blockSize);
+    VELOX_CHECK_EQ(
+        crc.checksum(),
+        checksum,
+        "Checksum mismatch of block {} in spill file {}",
+        numBlocks_,
+        path_);
+  }
+  int32_t dataSize = blockSize;
+  if (cipher_ != nullptr) {
+    dataSize -= SpillFileCipher::kTagSize;
+    VELOX_CHECK_GE(dataSize, 0, "Corrupt block size in spill file {}", path_);
+    cipher_->decrypt(numBlocks_, data, dataSize, data + dataSize);
+  }
+  ++numBlocks_;
+  blockInput_ = std::make_unique<BufferInputStream>(
+      std::vector<ByteRange>{ByteRange{data, dataSize, 0}});
+}
+
+RowVectorPtr SpillReadFile::makeReadBatch(
+    std::vector<VectorPtr>& columns,
+    vector_size_t numRows) {
+  if (prefixKeySize_ != 0) {
+    prefixKeys_ = std::move(columns.back());
+    columns.pop_back();
+  }
+  std::vector<VectorPtr> children;
+  if (projection_.empty()) {
+    children = std::move(columns);
+  } else {
+    children.reserve(projection_.size());
+    for (auto channel : projection_) {
+      children.push_back(std::move(columns[channel]));
+    }
+  }
+  return std::make_shared<RowVector>(
+      pool_, readType_, nullptr, numRows, std::move(children));
+}
+
 void SpillReadFile::recordSpillStats() {
   VELOX_CHECK(input_->atEnd());
   const auto readStats = input_->stats();
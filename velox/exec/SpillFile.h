@@ -18,12 +18,17 @@
 
 #include <folly/container/F14Set.h>
 
+#include "velox/common/base/AsyncSource.h"
+#include "velox/common/base/PrefixSortConfig.h"
 #include "velox/common/base/SpillConfig.h"
 #include "velox/common/base/SpillStats.h"
 #include "velox/common/compression/Compression.h"
 #include "velox/common/file/File.h"
 #include "velox/common/file/FileInputStream.h"
 #include "velox/common/file/FileSystems.h"
+#include "velox/common/memory/RawVector.h"
+#include "velox/exec/HashBitRange.h"
+#include "velox/exec/SpillFileCipher.h"
 #include "velox/exec/TreeOfLosers.h"
 #include "velox/exec/UnorderedStreamReader.h"
 #include "velox/serializers/PrestoSerializer.h"
@@ -32,15 +37,28 @@
 #include "velox/vector/VectorStream.h"
 
 namespace facebook::velox::exec {
+struct PrefixSortLayout;
+class VectorHasher;
 
 /// Represents a spill file for writing the serialized spilled data into a disk
 /// file.
+///
+/// If 'checksumEnabled' or 'encryptionEnabled' is true, each write is framed
+/// as a block which starts with its byte size and the CRC32C checksum of the
+/// written block, or zero if the checksum is disabled. If the encryption is
+/// enabled, the block is encrypted with a random key of the file and ends with
+/// the authentication tag, see SpillFileCipher.
 class SpillWriteFile {
  public:
+  /// The byte size of the header of a framed block.
+  static constexpr int32_t kBlockHeaderSize{sizeof(int32_t) + sizeof(uint32_t)};
+
   static std::unique_ptr<SpillWriteFile> create(
       uint32_t id,
       const std::string& pathPrefix,
-      const std::string& fileCreateConfig);
+      const std::string& fileCreateConfig,
+      bool checksumEnabled = false,
+      bool encryptionEnabled = false);
 
   uint32_t id() const {
     return id_;
@@ -55,6 +73,15 @@ class SpillWriteFile {
 
   uint64_t write(std::unique_ptr<folly::IOBuf> iobuf);
 
+  bool checksumEnabled() const {
+    return checksumEnabled_;
+  }
+
+  /// The encryption key of the file. Empty if the file is not encrypted.
+  std::string encryptionKey() const {
+    return cipher_ == nullptr ? std::string() : cipher_->key();
+  }
+
   WriteFile* file() {
     return file_.get();
   }
@@ -68,12 +95,19 @@ class SpillWriteFile {
   SpillWriteFile(
       uint32_t id,
       const std::string& pathPrefix,
-      const std::string& fileCreateConfig);
+      const std::string& fileCreateConfig,
+      bool checksumEnabled,
+      bool encryptionEnabled);
 
   // The spill file id which is monotonically increasing and unique for each
   // associated spill partition.
   const uint32_t id_;
   const std::string path_;
+  const bool checksumEnabled_;
+  // Encrypts the written blocks. Null if the file is not encrypted.
+  const std::unique_ptr<SpillFileCipher> cipher_;
+  // The number of written blocks if the writes are framed.
+  uint64_t numBlocks_{0};
 
   std::unique_ptr<WriteFile> file_;
   // Byte size of the backing file. Set when finishing writing.
@@ -90,6 +124,23 @@ struct SpillFileInfo {
   uint32_t numSortKeys;
   std::vector<CompareFlags> sortFlags;
   common::CompressionKind compressionKind;
+  /// True if the file is written in the columnar layout, see SpillWriter.
+  bool columnar{false};
+  /// The byte size of the normalized sort key prefix stored with each row. 0
+  /// if the file has no prefix keys, see SpillWriter.
+  uint32_t prefixKeySize{0};
+  /// The first sort key to compare if the prefix keys of two rows are equal.
+  /// Equals 'numSortKeys' if the prefix keys cover all the sort keys.
+  uint32_t prefixKeyFallbackIndex{0};
+  /// The hash bits the pages of the file are routed by, see SpillWriter. Not
+  /// set if the pages are written without the routing header.
+  std::optional<HashBitRange> pageRoutingBits;
+  /// True if the blocks of the file carry a CRC32C checksum, see
+  /// SpillWriteFile.
+  bool checksum{false};
+  /// The key the blocks of the file are encrypted with. Empty if the file is
+  /// not encrypted.
+  std::string encryptionKey;
 };
 
 using SpillFiles = std::vector<SpillFileInfo>;
@@ -110,6 +161,37 @@ class SpillWriter {
   ///
   /// When writing sorted spill runs, the caller is responsible for buffering
   /// and sorting the data. write is called multiple times, followed by flush().
+  ///
+  /// If 'columnarFormat' is true, each column of a flushed batch is serialized
+  /// and compressed as a separate chunk. The batch starts with the number of
+  /// columns and the byte size of each chunk, so that a reader can skip the
+  /// columns it doesn't need. The compression of a chunk is skipped if it
+  /// doesn't reach the min compression ratio, so the decision is made per
+  /// column.
+  ///
+  /// If 'writeExecutor' is set, the serialized data is written to file on
+  /// 'writeExecutor' while the caller goes on to buffer and serialize the next
+  /// write. A flush waits for the previous write to finish before it starts
+  /// the next one, so there is at most one write in flight.
+  ///
+  /// If 'prefixKeyConfig' is set and 'numSortKeys' is not zero, the leading
+  /// sort keys that support prefix sort are encoded into a normalized key
+  /// which is stored with each row as an extra column. The merge of sorted
+  /// spill files then compares rows by memcmp on the normalized keys.
+  ///
+  /// If 'pageRoutingBits' is set, the rows are buffered per partition of
+  /// 'pageRoutingBits' computed from the hash of the 'numPageRoutingKeys'
+  /// leading columns, and each flushed page holds the rows of one partition.
+  /// Each page starts with its partition number and byte size so that a
+  /// reader can move it to another file without deserializing it, see
+  /// SpillReadFile::nextPage(). Does not apply to the columnar format.
+  ///
+  /// If the process-wide common::SpillIoScheduler is set up, each file write
+  /// waits for the scheduler to admit it with 'ioShare'.
+  ///
+  /// If 'checksumEnabled' or 'encryptionEnabled' is true, each file write is
+  /// checksummed or encrypted as a block, see SpillWriteFile. The reader
+  /// verifies the checksum and the authentication tag of each block.
   SpillWriter(
       const RowTypePtr& type,
       const uint32_t numSortKeys,
@@ -121,7 +203,22 @@ class SpillWriter {
       const std::string& fileCreateConfig,
       common::UpdateAndCheckSpillLimitCB& updateAndCheckSpillLimitCb,
       memory::MemoryPool* pool,
-      folly::Synchronized<common::SpillStats>* stats);
+      folly::Synchronized<common::SpillStats>* stats,
+      bool columnarFormat = false,
+      folly::Executor* writeExecutor = nullptr,
+      const std::optional<common::PrefixSortConfig>& prefixKeyConfig =
+          std::nullopt,
+      const std::optional<HashBitRange>& pageRoutingBits = std::nullopt,
+      uint32_t numPageRoutingKeys = 0,
+      const common::SpillIoShare& ioShare = {},
+      bool checksumEnabled = false,
+      bool encryptionEnabled = false);
+
+  ~SpillWriter();
+
+  /// The page routing header partition number of the pages whose rows are not
+  /// grouped by the routing bits, e.g. pages moved from another file.
+  static constexpr int32_t kUnroutedPage{-1};
 
   /// Adds 'rows' for the positions in 'indices' into 'this'. The indices
   /// must produce a view where the rows are sorted if sorting is desired.
@@ -132,6 +229,12 @@ class SpillWriter {
       const RowVectorPtr& rows,
       const folly::Range<IndexRange*>& indices);
 
+  /// Appends a serialized 'page' read by SpillReadFile::nextPage() from a file
+  /// of the same type. Only supported if the pages are routed. The page is
+  /// written as is with the kUnroutedPage routing header. Returns the size to
+  /// write.
+  uint64_t writePage(std::unique_ptr<folly::IOBuf> page);
+
   /// Closes the current output file if any. Subsequent calls to write will
   /// start a new one.
   void finishFile();
@@ -162,10 +265,40 @@ class SpillWriter {
   // Closes the current open spill file pointed by 'currentFile_'.
   void closeFile();
 
-  // Writes data from 'batch_' to the current output file. Returns the actual
-  // written size.
+  // Writes data from 'batch_' or 'columnBatches_' to the current output file.
+  // Returns the actual written size.
   uint64_t flush();
 
+  // Waits for the write in flight if any and updates the write stats.
+  void waitForPendingWrite();
+
+  // Appends the columns of 'rows' to 'columnBatches_' in columnar format.
+  void appendColumns(
+      const RowVectorPtr& rows,
+      const folly::Range<IndexRange*>& indices);
+
+  // Serializes 'columnBatches_' into a columnar batch and clears them.
+  std::unique_ptr<folly::IOBuf> flushColumns();
+
+  // Returns the serialized size of the buffered data.
+  uint64_t bufferedBytes() const;
+
+  // Appends the rows in 'indices' to the batch in 'routedBatches_' of their
+  // routing partition.
+  void appendRoutedRows(
+      const RowVectorPtr& rows,
+      const folly::Range<IndexRange*>& indices);
+
+  // Serializes 'routedBatches_' and 'unroutedPages_' into pages with the
+  // routing header and clears them.
+  std::unique_ptr<folly::IOBuf> flushRoutedPages();
+
+  // Returns 'rows' with the normalized prefix keys of the rows in 'indices'
+  // added as the last column.
+  RowVectorPtr addPrefixKeys(
+      const RowVectorPtr& rows,
+      const folly::Range<IndexRange*>& indices);
+
   // Invoked to increment the number of spilled files and the file size.
   void updateSpilledFileStats(uint64_t fileSize);
 
@@ -186,6 +319,18 @@ class SpillWriter {
   const uint64_t targetFileSize_;
   const uint64_t writeBufferSize_;
   const std::string fileCreateConfig_;
+  const bool columnarFormat_;
+  const serializer::presto::PrestoVectorSerde::PrestoOptions serdeOptions_;
+  folly::Executor* const writeExecutor_;
+  // The layout of the prefix keys. Null if the rows are written without them.
+  const std::unique_ptr<const PrefixSortLayout> prefixKeyLayout_;
+  // The written type which is 'type_' plus the prefix key column if any.
+  const RowTypePtr fileType_;
+  const std::optional<HashBitRange> pageRoutingBits_;
+  const uint32_t numPageRoutingKeys_;
+  const common::SpillIoShare ioShare_;
+  const bool checksumEnabled_;
+  const bool encryptionEnabled_;
 
   // Updates the aggregated spill bytes of this query, and throws if exceeds
   // the max spill bytes limit.
@@ -197,8 +342,26 @@ class SpillWriter {
   bool finished_{false};
   uint32_t nextFileId_{0};
   std::unique_ptr<VectorStreamGroup> batch_;
+  // The buffered data per column in columnar format.
+  std::vector<std::unique_ptr<VectorStreamGroup>> columnBatches_;
+  // The buffered data per routing partition if the pages are routed.
+  std::vector<std::unique_ptr<VectorStreamGroup>> routedBatches_;
+  // The pages added by writePage() and their byte size.
+  std::unique_ptr<folly::IOBuf> unroutedPages_;
+  uint64_t unroutedPageBytes_{0};
+  // Used to compute the routing partitions of the written rows.
+  std::vector<std::unique_ptr<VectorHasher>> routingHashers_;
+  raw_vector<uint64_t> routingHashes_;
   std::unique_ptr<SpillWriteFile> currentFile_;
   SpillFiles finishedFiles_;
+
+  struct WriteResult {
+    uint64_t writtenBytes;
+    uint64_t flushTimeNs;
+    uint64_t writeTimeNs;
+  };
+  // The write to 'currentFile_' in flight on 'writeExecutor_'.
+  std::shared_ptr<AsyncSource<WriteResult>> pendingWrite_;
 };
 
 /// Represents a spill file for read which turns the serialized spilled data
@@ -210,11 +373,15 @@ class SpillWriter {
 /// rmdir() call.
 class SpillReadFile {
  public:
+  /// Reads the columns of the spilled data in 'projection' in that order. If
+  /// 'projection' is empty, reads all the columns. Columnar files only load
+  /// the projected columns while the other files read all of them.
   static std::unique_ptr<SpillReadFile> create(
       const SpillFileInfo& fileInfo,
       uint64_t bufferSize,
       memory::MemoryPool* pool,
-      folly::Synchronized<common::SpillStats>* stats);
+      folly::Synchronized<common::SpillStats>* stats,
+      const std::vector<column_index_t>& projection = {});
 
   uint32_t id() const {
     return id_;
@@ -230,6 +397,37 @@ class SpillReadFile {
 
   bool nextBatch(RowVectorPtr& rowVector);
 
+  /// Reads the next serialized page of a file with routed pages as is into
+  /// 'page' and its routing partition into 'partition'. The partition is
+  /// SpillWriter::kUnroutedPage if the rows of the page are not grouped by
+  /// pageRoutingBits(). Returns false at the end of the file.
+  ///
+  /// NOTE: the read stats are recorded by the nextBatch() call that reaches
+  /// the end of the file.
+  bool nextPage(int32_t& partition, std::unique_ptr<folly::IOBuf>& page);
+
+  /// Deserializes a 'page' returned by nextPage() into a batch as returned by
+  /// nextBatch().
+  RowVectorPtr deserializePage(const folly::IOBuf& page);
+
+  /// The hash bits the pages of the file are routed by. Not set if the file
+  /// has no routed pages.
+  const std::optional<HashBitRange>& pageRoutingBits() const {
+    return pageRoutingBits_;
+  }
+
+  /// Returns the normalized prefix keys of the rows of the last batch returned
+  /// by nextBatch(). Null if the file has no prefix keys.
+  const FlatVector<StringView>* prefixKeys() const {
+    return prefixKeys_ == nullptr ? nullptr
+                                  : prefixKeys_->asFlatVector<StringView>();
+  }
+
+  /// The first sort key to compare if the prefix keys of two rows are equal.
+  uint32_t prefixKeyFallbackIndex() const {
+    return prefixKeyFallbackIndex_;
+  }
+
   /// Returns the file size in bytes.
   uint64_t size() const {
     return size_;
@@ -249,12 +447,47 @@ class SpillReadFile {
       uint32_t numSortKeys,
       const std::vector<CompareFlags>& sortCompareFlags,
       common::CompressionKind compressionKind,
+      bool columnar,
+      uint32_t prefixKeySize,
+      uint32_t prefixKeyFallbackIndex,
+      const std::optional<HashBitRange>& pageRoutingBits,
+      bool checksum,
+      const std::string& encryptionKey,
+      const std::vector<column_index_t>& projection,
       memory::MemoryPool* pool,
       folly::Synchronized<common::SpillStats>* stats);
 
+  // True if the file is framed in blocks, see SpillWriteFile.
+  bool framed() const {
+    return checksum_ || cipher_ != nullptr;
+  }
+
+  // Returns true if all the data of the file has been read.
+  bool atEnd() const;
+
+  // Returns the stream to read the next record from. If the file is framed,
+  // loads the next block once the current one is read.
+  ByteInputStream* recordInput();
+
+  // Reads the next block of a framed file into 'block_', verifies its checksum
+  // and decrypts it in place.
+  void loadBlock();
+
   // Invoked to record spill read stats at the end of read input.
   void recordSpillStats();
 
+  // Reads the projected columns and the prefix keys of the next columnar
+  // batch into 'columns'. The other columns are left null.
+  vector_size_t readColumns(
+      ByteInputStream* input,
+      std::vector<VectorPtr>& columns);
+
+  // Sets 'prefixKeys_' from 'columns' of 'fileType_' and returns a RowVector
+  // of 'readType_' with the projected ones.
+  RowVectorPtr makeReadBatch(
+      std::vector<VectorPtr>& columns,
+      vector_size_t numRows);
+
   // The spill file id which is monotonically increasing and unique for each
   // associated spill partition.
   const uint32_t id_;
@@ -266,11 +499,31 @@ class SpillReadFile {
   const uint32_t numSortKeys_;
   const std::vector<CompareFlags> sortCompareFlags_;
   const common::CompressionKind compressionKind_;
+  const bool columnar_;
+  const uint32_t prefixKeySize_;
+  const uint32_t prefixKeyFallbackIndex_;
+  const std::optional<HashBitRange> pageRoutingBits_;
+  const bool checksum_;
+  // Decrypts the blocks of the file. Null if the file is not encrypted.
+  const std::unique_ptr<SpillFileCipher> cipher_;
+  // The written type which is 'type_' plus the prefix key column if any.
+  const RowTypePtr fileType_;
+  // The spilled columns to read. Empty if reading all of them.
+  const std::vector<column_index_t> projection_;
+  // The type of the read batches with the columns in 'projection_'.
+  const RowTypePtr readType_;
   const serializer::presto::PrestoVectorSerde::PrestoOptions readOptions_;
   memory::MemoryPool* const pool_;
   VectorSerde* const serde_;
   folly::Synchronized<common::SpillStats>* const stats_;
 
   std::unique_ptr<common::FileInputStream> input_;
+  // The current block of a framed file and the stream over its data.
+  BufferPtr block_;
+  std::unique_ptr<BufferInputStream> blockInput_;
+  // The number of read blocks of a framed file.
+  uint64_t numBlocks_{0};
+  // The prefix keys of the last read batch.
+  VectorPtr prefixKeys_;
 };
 } // namespace facebook::velox::exec
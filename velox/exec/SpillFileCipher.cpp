@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/SpillFileCipher.h"
+
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+
+#include "velox/common/base/Exceptions.h"
+
+namespace facebook::velox::exec {
+namespace {
+constexpr int32_t kNonceSize{12};
+
+// Returns the nonce of block 'blockIndex'.
+std::array<uint8_t, kNonceSize> makeNonce(uint64_t blockIndex) {
+  std::array<uint8_t, kNonceSize> nonce{};
+  std::memcpy(nonce.data(), &blockIndex, sizeof(blockIndex));
+  return nonce;
+}
+} // namespace
+
+// static
+std::string SpillFileCipher::makeKey() {
+  std::string key(kKeySize, '\0');
+  VELOX_CHECK_EQ(
+      RAND_bytes(reinterpret_cast<uint8_t*>(key.data()), kKeySize),
+      1,
+      "Failed to generate a spill file encryption key");
+  return key;
+}
+
+SpillFileCipher::SpillFileCipher(const std::string& key)
+    : key_(key), ctx_(EVP_CIPHER_CTX_new()) {
+  VELOX_CHECK_EQ(key_.size(), kKeySize);
+  VELOX_CHECK_NOT_NULL(ctx_, "Failed to create the spill file cipher");
+}
+
+SpillFileCipher::~SpillFileCipher() {
+  EVP_CIPHER_CTX_free(ctx_);
+}
+
+std::string SpillFileCipher::encrypt(uint64_t blockIndex, folly::IOBuf& data) {
+  const auto nonce = makeNonce(blockIndex);
+  VELOX_CHECK_EQ(
+      EVP_EncryptInit_ex(
+          ctx_,
+          EVP_aes_256_gcm(),
+          nullptr,
+          reinterpret_cast<const uint8_t*>(key_.data()),
+          nonce.data()),
+      1);
+  int length;
+  // GCM is a stream mode, so the blocks are encrypted in place.
+  auto* buf = &data;
+  do {
+    VELOX_CHECK(!buf->isSharedOne());
+    VELOX_CHECK_EQ(
+        EVP_EncryptUpdate(
+            ctx_,
+            buf->writableData(),
+            &length,
+            buf->data(),
+            buf->length()),
+        1);
+    buf = buf->next();
+  } while (buf != &data);
+  uint8_t unused[kTagSize];
+  VELOX_CHECK_EQ(EVP_EncryptFinal_ex(ctx_, unused, &length), 1);
+  std::string tag(kTagSize, '\0');
+  VELOX_CHECK_EQ(
+      EVP_CIPHER_CTX_ctrl(ctx_, EVP_CTRL_GCM_GET_TAG, kTagSize, tag.data()),
+      1);
+  return tag;
+}
+
+void SpillFileCipher::decrypt(
+    uint64_t blockIndex,
+    uint8_t* data,
+    int32_t size,
+    const uint8_t* tag) {
+  const auto nonce = makeNonce(blockIndex);
+  VELOX_CHECK_EQ(
+      EVP_DecryptInit_ex(
+          ctx_,
+          EVP_aes_256_gcm(),
+          nullptr,
+          reinterpret_cast<const uint8_t*>(key_.data()),
+          nonce.data()),
+      1);
+  int length;
+  VELOX_CHECK_EQ(EVP_DecryptUpdate(ctx_, data, &length, data, size), 1);
+  VELOX_CHECK_EQ(
+      EVP_CIPHER_CTX_ctrl(
+          ctx_, EVP_CTRL_GCM_SET_TAG, kTagSize, const_cast<uint8_t*>(tag)),
+      1);
+  uint8_t unused[kTagSize];
+  VELOX_CHECK_EQ(
+      EVP_DecryptFinal_ex(ctx_, unused, &length),
+      1,
+      "Spill file block {} failed the authentication",
+      blockIndex);
+}
+} // namespace facebook::velox::exec
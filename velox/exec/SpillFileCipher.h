@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <folly/io/IOBuf.h>
+
+struct evp_cipher_ctx_st;
+
+namespace facebook::velox::exec {
+
+/// Encrypts and authenticates the blocks of a spill file with AES-256-GCM.
+/// Each spill file has its own random key which is only kept in memory in
+/// SpillFileInfo, as a spill file is only read by the process that wrote it.
+/// The nonce of a block is its index in the file, so that a key never
+/// encrypts two blocks with the same nonce.
+class SpillFileCipher {
+ public:
+  static constexpr int32_t kKeySize{32};
+  static constexpr int32_t kTagSize{16};
+
+  /// Returns a new random key.
+  static std::string makeKey();
+
+  explicit SpillFileCipher(const std::string& key);
+
+  ~SpillFileCipher();
+
+  const std::string& key() const {
+    return key_;
+  }
+
+  /// Encrypts 'data' in place as block 'blockIndex' and returns the
+  /// authentication tag of kTagSize bytes.
+  std::string encrypt(uint64_t blockIndex, folly::IOBuf& data);
+
+  /// Decrypts the 'size' bytes at 'data' in place as block 'blockIndex'. Throws
+  /// if the block does not match the authentication 'tag'.
+  void decrypt(
+      uint64_t blockIndex,
+      uint8_t* data,
+      int32_t size,
+      const uint8_t* tag);
+
+ private:
+  const std::string key_;
+  evp_cipher_ctx_st* const ctx_;
+};
+} // namespace facebook::velox::exec
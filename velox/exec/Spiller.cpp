@@ -37,7 +37,8 @@ SpillerBase::SpillerBase(
     uint64_t targetFileSize,
     uint64_t maxSpillRunRows,
     const common::SpillConfig* spillConfig,
-    folly::Synchronized<common::SpillStats>* spillStats)
+    folly::Synchronized<common::SpillStats>* spillStats,
+    const std::optional<HashBitRange>& pageRoutingBits)
     : container_(container),
       executor_(spillConfig->executor),
       bits_(bits),
@@ -57,7 +58,19 @@ SpillerBase::SpillerBase(
           spillConfig->prefixSortConfig,
           memory::spillMemoryPool(),
           spillStats,
-          spillConfig->fileCreateConfig) {
+          spillConfig->fileCreateConfig,
+          spillConfig->columnarFormat,
+          spillConfig->asyncWrite ? spillConfig->executor : nullptr,
+          spillConfig->mergePrefixKeys
+              ? std::optional<common::PrefixSortConfig>(
+                    spillConfig->prefixSortConfig.value_or(
+                        common::PrefixSortConfig()))
+              : std::nullopt,
+          spillConfig->columnarFormat ? std::nullopt : pageRoutingBits,
+          pageRoutingBits.has_value() ? container->keyTypes().size() : 0,
+          spillConfig->ioShare,
+          spillConfig->checksumEnabled,
+          spillConfig->encryptionEnabled) {
   TestValue::adjust("facebook::velox::exec::SpillerBase", this);
 
   spillRuns_.reserve(state_.maxPartitions());
@@ -454,4 +467,52 @@ void SortOutputSpiller::runSpill(bool lastRun) {
     }
   }
 }
+
+uint8_t estimateSpillPartitionBits(
+    RowContainer* container,
+    const HashBitRange& bits,
+    uint64_t targetPartitionBytes,
+    int32_t maxSampleRows) {
+  VELOX_CHECK_GT(maxSampleRows, 0);
+  const auto numRows = container->numRows();
+  if (numRows == 0 || bits.numBits() == 0 ||
+      container->keyTypes().empty()) {
+    return bits.numBits();
+  }
+
+  std::vector<char*> rows(std::min<int64_t>(maxSampleRows, numRows));
+  RowContainerIterator iterator;
+  const auto numSampleRows = container->listRows(
+      &iterator, rows.size(), RowContainer::kUnlimited, rows.data());
+  if (numSampleRows == 0) {
+    return bits.numBits();
+  }
+  auto rowSet = folly::Range<char**>(rows.data(), numSampleRows);
+  std::vector<uint64_t> hashes(numSampleRows);
+  for (auto i = 0; i < container->keyTypes().size(); ++i) {
+    container->hash(i, rowSet, i > 0, hashes.data());
+  }
+
+  // Sampled bytes per partition with all the bits in 'bits'.
+  std::vector<uint64_t> partitionBytes(bits.numPartitions(), 0);
+  for (auto i = 0; i < numSampleRows; ++i) {
+    partitionBytes[bits.partition(hashes[i])] += container->rowSize(rows[i]);
+  }
+  const double scale = static_cast<double>(numRows) / numSampleRows;
+
+  // With fewer bits, the partition number is the low bits of the partition
+  // number with all the bits.
+  for (uint8_t numBits = 0; numBits < bits.numBits(); ++numBits) {
+    const auto numPartitions = 1 << numBits;
+    std::vector<uint64_t> bytes(numPartitions, 0);
+    for (auto partition = 0; partition < partitionBytes.size(); ++partition) {
+      bytes[partition & (numPartitions - 1)] += partitionBytes[partition];
+    }
+    const auto maxBytes = *std::max_element(bytes.begin(), bytes.end());
+    if (maxBytes * scale <= targetPartitionBytes) {
+      return numBits;
+    }
+  }
+  return bits.numBits();
+}
 } // namespace facebook::velox::exec
@@ -50,6 +50,8 @@ class SpillerBase {
   std::string toString() const;
 
  protected:
+  // If 'pageRoutingBits' is set, the spill file pages are routed by these hash
+  // bits of the keys of 'container', see SpillWriter.
   SpillerBase(
       RowContainer* container,
       RowTypePtr rowType,
@@ -59,7 +61,8 @@ class SpillerBase {
       uint64_t targetFileSize,
       uint64_t maxSpillRunRows,
       const common::SpillConfig* spillConfig,
-      folly::Synchronized<common::SpillStats>* spillStats);
+      folly::Synchronized<common::SpillStats>* spillStats,
+      const std::optional<HashBitRange>& pageRoutingBits = std::nullopt);
 
   // Invoked to spill. If 'startRowIter' is not null, then we only spill rows
   // from row container starting at the offset pointed by 'startRowIter'.
@@ -274,4 +277,17 @@ class SortOutputSpiller : public SpillerBase {
     return std::string(kType);
   }
 };
+
+/// Estimates the number of partition bits to spill the rows of 'container'
+/// with. Hashes the keys of up to 'maxSampleRows' rows and scales the sampled
+/// row sizes per partition up to all the rows in 'container'. Returns the
+/// fewest bits in 'bits', starting from the low end, for which the estimated
+/// largest partition is no larger than 'targetPartitionBytes'. Returns
+/// 'bits.numBits()' if no such number exists, e.g. for a skewed key, which is
+/// then handled by recursive spilling.
+uint8_t estimateSpillPartitionBits(
+    RowContainer* container,
+    const HashBitRange& bits,
+    uint64_t targetPartitionBytes,
+    int32_t maxSampleRows = 4'096);
 } // namespace facebook::velox::exec
@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 #include "velox/exec/TableScan.h"
+
+#include <deque>
+
 #include "velox/common/testutil/TestValue.h"
 #include "velox/common/time/Timer.h"
 #include "velox/exec/Task.h"
@@ -39,6 +42,8 @@ TableScan::TableScan(
       driverCtx_(driverCtx),
       maxSplitPreloadPerDriver_(
           driverCtx_->queryConfig().maxSplitPreloadPerDriver()),
+      maxSplitMetadataPrefetchPerDriver_(
+          driverCtx_->queryConfig().maxSplitMetadataPrefetchPerDriver()),
       maxReadBatchSize_(driverCtx_->queryConfig().maxOutputBatchRows()),
       connectorPool_(driverCtx_->task->addConnectorPoolLocked(
           planNodeId(),
@@ -389,6 +394,57 @@ void TableScan::preload(
       });
 }
 
+// Preloads at most 'maxPreloads' splits at a time on 'executor'. Splits added
+// past the limit are preloaded in order as earlier preloads finish. A split
+// that is read before its turn has been made by the Driver and its preload
+// does nothing. Shared with the preloads on the executor, which may outlive
+// the TableScan.
+class TableScan::PreloadQueue
+    : public std::enable_shared_from_this<PreloadQueue> {
+ public:
+  PreloadQueue(folly::Executor* executor, int32_t maxPreloads)
+      : executor_(executor), maxPreloads_(maxPreloads) {}
+
+  void add(std::shared_ptr<connector::ConnectorSplit> split) {
+    {
+      std::lock_guard<std::mutex> l(mutex_);
+      if (numPreloads_ >= maxPreloads_) {
+        pending_.push_back(std::move(split));
+        return;
+      }
+      ++numPreloads_;
+    }
+    start(std::move(split));
+  }
+
+ private:
+  void start(std::shared_ptr<connector::ConnectorSplit> split) {
+    executor_->add([self = shared_from_this(),
+                    connectorSplit = std::move(split)]() mutable {
+      connectorSplit->dataSource->prepare();
+      connectorSplit.reset();
+      std::shared_ptr<connector::ConnectorSplit> next;
+      {
+        std::lock_guard<std::mutex> l(self->mutex_);
+        if (self->pending_.empty()) {
+          --self->numPreloads_;
+          return;
+        }
+        next = std::move(self->pending_.front());
+        self->pending_.pop_front();
+      }
+      self->start(std::move(next));
+    });
+  }
+
+  folly::Executor* const executor_;
+  const int32_t maxPreloads_;
+
+  std::mutex mutex_;
+  int32_t numPreloads_{0};
+  std::deque<std::shared_ptr<connector::ConnectorSplit>> pending_;
+};
+
 void TableScan::checkPreload() {
   auto* executor = connector_->executor();
   if (maxSplitPreloadPerDriver_ == 0 || !executor ||
@@ -396,9 +452,47 @@ void TableScan::checkPreload() {
     return;
   }
   if (dataSource_->allPrefetchIssued()) {
-    maxPreloadedSplits_ = driverCtx_->task->numDrivers(driverCtx_->driver) *
-        maxSplitPreloadPerDriver_;
-    if (!splitPreloader_) {
+    const auto numDrivers = driverCtx_->task->numDrivers(driverCtx_->driver);
+    const bool prefetchMetadata = maxSplitMetadataPrefetchPerDriver_ > 0 &&
+        connector_->supportsSplitMetadataPrefetch();
+    maxPreloadedSplits_ = numDrivers * maxSplitPreloadPerDriver_;
+    if (prefetchMetadata) {
+      maxPreloadedSplits_ += numDrivers * maxSplitMetadataPrefetchPerDriver_;
+    }
+    if (!splitPreloader_ && prefetchMetadata) {
+      // The metadata of all the splits in the preload window is fetched in
+      // parallel. The preloads, which also load the first row groups or
+      // stripes, are limited to 'maxSplitPreloadPerDriver_' per driver.
+      auto queue = std::make_shared<PreloadQueue>(
+          executor, numDrivers * maxSplitPreloadPerDriver_);
+      splitPreloader_ =
+          [executor, queue, this](
+              const std::shared_ptr<connector::ConnectorSplit>& split) {
+            preload(split);
+
+            executor->add([connector = connector_,
+                           table = tableHandle_,
+                           ctx = operatorCtx_->createConnectorQueryCtx(
+                               split->connectorId,
+                               planNodeId(),
+                               connectorPool_),
+                           task = operatorCtx_->task(),
+                           queue,
+                           connectorSplit = split]() mutable {
+              if (!task->isCancelled()) {
+                try {
+                  connector->prefetchSplitMetadata(
+                      table, connectorSplit, ctx.get());
+                } catch (const std::exception& e) {
+                  // The error, if any, surfaces when the split is read.
+                  VLOG(1) << "Failed to prefetch metadata of "
+                          << connectorSplit->toString() << ": " << e.what();
+                }
+              }
+              queue->add(std::move(connectorSplit));
+            });
+          };
+    } else if (!splitPreloader_) {
       splitPreloader_ =
           [executor,
            this](const std::shared_ptr<connector::ConnectorSplit>& split) {
@@ -79,6 +79,10 @@ class TableScan : public SourceOperator {
   // of the Task's split queue for 'this' when getting splits.
   void checkPreload();
 
+  // Limits the number of splits preloaded at a time when the splits queued
+  // behind them get their metadata prefetched. Defined in TableScan.cpp.
+  class PreloadQueue;
+
   // Sets 'split->dataSource' to be an AsyncSource that makes a DataSource to
   // read 'split'. This source will be prepared in the background on the
   // executor of the connector. If the DataSource is needed before prepare is
@@ -99,6 +103,7 @@ class TableScan : public SourceOperator {
           columnHandles_;
   DriverCtx* const driverCtx_;
   const int32_t maxSplitPreloadPerDriver_{0};
+  const int32_t maxSplitMetadataPrefetchPerDriver_{0};
   const vector_size_t maxReadBatchSize_;
   memory::MemoryPool* const connectorPool_;
   const std::shared_ptr<connector::Connector> connector_;
@@ -194,8 +194,13 @@ RowVectorPtr TableWriter::getOutput() {
   }
 
   if (!finishDataSink()) {
-    blockingReason_ = BlockingReason::kYield;
-    blockingFuture_ = ContinueFuture{folly::Unit{}};
+    blockingFuture_ = dataSink_->finishFuture();
+    if (blockingFuture_.valid()) {
+      blockingReason_ = BlockingReason::kWaitForConnector;
+    } else {
+      blockingReason_ = BlockingReason::kYield;
+      blockingFuture_ = ContinueFuture{folly::Unit{}};
+    }
     return nullptr;
   }
 
@@ -279,6 +284,10 @@ void TableWriter::updateStats(const connector::DataSink::Stats& stats) {
   {
     auto lockedStats = stats_.wlock();
     lockedStats->physicalWrittenBytes = stats.numWrittenBytes;
+    if (stats.numOpenWriters != 0) {
+      lockedStats->addRuntimeStat(
+          "numOpenWriters", RuntimeCounter(stats.numOpenWriters));
+    }
     if (!closed_) {
       // NOTE: the other stats is only set when hive data sink is closed.
       VELOX_CHECK_EQ(stats.numWrittenFiles, 0);
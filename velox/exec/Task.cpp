@@ -19,6 +19,7 @@
 #include <string>
 
 #include "velox/common/base/Counters.h"
+#include "velox/common/base/SpillStats.h"
 #include "velox/common/base/StatsReporter.h"
 #include "velox/common/file/FileSystems.h"
 #include "velox/common/testutil/TestValue.h"
@@ -472,17 +473,70 @@ const std::string& Task::getOrCreateSpillDirectory() {
   return spillDirectory_;
 }
 
-void Task::removeSpillDirectoryIfExists() {
-  if (spillDirectory_.empty() || !spillDirectoryCreated_) {
-    return;
+const std::string& Task::getOrCreateTieredSpillDirectory() {
+  if (overflowSpillDirectory_.empty()) {
+    return getOrCreateSpillDirectory();
+  }
+  if (!spillOverflowed_) {
+    if (!common::localSpillQuotaExceeded()) {
+      return getOrCreateSpillDirectory();
+    }
+    spillOverflowed_ = true;
+  }
+  if (overflowSpillDirectoryCreated_) {
+    return overflowSpillDirectory_;
+  }
+
+  std::lock_guard<std::mutex> l(spillDirCreateMutex_);
+  if (overflowSpillDirectoryCreated_) {
+    return overflowSpillDirectory_;
   }
   try {
-    auto fs = filesystems::getFileSystem(spillDirectory_, nullptr);
-    fs->rmdir(spillDirectory_);
+    auto fileSystem =
+        filesystems::getFileSystem(overflowSpillDirectory_, nullptr);
+    fileSystem->mkdir(overflowSpillDirectory_);
   } catch (const std::exception& e) {
-    LOG(ERROR) << "Failed to remove spill directory '" << spillDirectory_
-               << "' for Task " << taskId() << ": " << e.what();
+    VELOX_FAIL(
+        "Failed to create overflow spill directory '{}' for Task {}: {}",
+        overflowSpillDirectory_,
+        taskId(),
+        e.what());
+  }
+  overflowSpillDirectoryCreated_ = true;
+  return overflowSpillDirectory_;
+}
+
+void Task::updateSpilledBytes(uint64_t bytes) {
+  queryCtx_->updateSpilledBytesAndCheckLimit(bytes);
+  if (spillOverflowed_) {
+    addThreadLocalRuntimeStat(
+        Operator::kOverflowSpilledBytes,
+        RuntimeCounter(bytes, RuntimeCounter::Unit::kBytes));
+    return;
   }
+  localSpilledBytes_ += bytes;
+  common::updateLocalSpilledBytes(bytes);
+}
+
+void Task::removeSpillDirectoryIfExists() {
+  // The spill files on the local tier go away with the spill directory.
+  common::updateLocalSpilledBytes(-static_cast<int64_t>(localSpilledBytes_));
+  localSpilledBytes_ = 0;
+
+  auto removeDirectory = [&](const std::string& directory, bool created) {
+    if (directory.empty() || !created) {
+      return;
+    }
+    try {
+      auto fs = filesystems::getFileSystem(directory, nullptr);
+      fs->rmdir(directory);
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Failed to remove spill directory '" << directory
+                 << "' for Task " << taskId() << ": " << e.what();
+    }
+  };
+  removeDirectory(spillDirectory_, spillDirectoryCreated_);
+  removeDirectory(overflowSpillDirectory_, overflowSpillDirectoryCreated_);
 }
 
 uint64_t Task::driverCpuTimeSliceLimitMs() const {
@@ -705,8 +759,12 @@ RowVectorPtr Task::next(ContinueFuture* future) {
   // drivers.
   const auto numDrivers = drivers_.size();
 
+  // Empty futures, unlike default constructed ones, are not allocated.
   std::vector<ContinueFuture> futures;
-  futures.resize(numDrivers);
+  futures.reserve(numDrivers);
+  for (auto i = 0; i < numDrivers; ++i) {
+    futures.push_back(ContinueFuture::makeEmpty());
+  }
 
   for (;;) {
     int runnableDrivers = 0;
@@ -720,7 +778,7 @@ RowVectorPtr Task::next(ContinueFuture* future) {
         continue;
       }
 
-      if (!futures[i].isReady()) {
+      if (futures[i].valid() && !futures[i].isReady()) {
         // This driver is still blocked.
         ++blockedDrivers;
         continue;
@@ -743,7 +801,9 @@ RowVectorPtr Task::next(ContinueFuture* future) {
         return result;
       }
 
-      if (driverFuture.valid()) {
+      // A driver blocked on a realized future is run again in the next round
+      // without a callback on the future.
+      if (driverFuture.valid() && !driverFuture.isReady()) {
         driverBlockingStates_[i]->setDriverFuture(driverFuture);
       }
 
@@ -760,7 +820,7 @@ RowVectorPtr Task::next(ContinueFuture* future) {
         } else {
           std::vector<ContinueFuture> notReadyFutures;
           for (auto& continueFuture : futures) {
-            if (!continueFuture.isReady()) {
+            if (continueFuture.valid() && !continueFuture.isReady()) {
               notReadyFutures.emplace_back(std::move(continueFuture));
             }
           }
@@ -1126,13 +1186,35 @@ void Task::createSplitGroupStateLocked(uint32_t splitGroupId) {
     addNestedLoopJoinBridgesLocked(
         splitGroupId, factory->needsNestedLoopJoinBridges());
     addCustomJoinBridgesLocked(splitGroupId, factory->planNodes);
+  }
 
+  // The scaled scan controllers are added after the local exchanges they may
+  // produce into.
+  if (!queryCtx_->queryConfig().tableScanScaledProcessingEnabled()) {
+    return;
+  }
+  for (auto pipeline = 0; pipeline < numPipelines; ++pipeline) {
+    auto& factory = driverFactories_[pipeline];
+    if (factory->groupedExecution != groupedExecutionDrivers) {
+      continue;
+    }
     core::PlanNodeId tableScanNodeId;
-    if (queryCtx_->queryConfig().tableScanScaledProcessingEnabled() &&
-        factory->needsTableScan(tableScanNodeId)) {
+    if (factory->needsTableScan(tableScanNodeId)) {
       VELOX_CHECK(!tableScanNodeId.empty());
+      core::PlanNodeId outputNodeId;
+      std::shared_ptr<LocalExchangeMemoryManager> outputMemoryManager;
+      if (factory->outputsToLocalExchange(outputNodeId)) {
+        auto& localExchanges = splitGroupStates_[splitGroupId].localExchanges;
+        auto it = localExchanges.find(outputNodeId);
+        if (it != localExchanges.end()) {
+          outputMemoryManager = it->second.memoryManager;
+        }
+      }
       addScaledScanControllerLocked(
-          splitGroupId, tableScanNodeId, factory->numDrivers);
+          splitGroupId,
+          tableScanNodeId,
+          factory->numDrivers,
+          std::move(outputMemoryManager));
     }
   }
 }
@@ -1281,6 +1363,10 @@ void Task::ensureSplitGroupsAreBeingProcessedLocked() {
 
   while (numRunningSplitGroups_ < concurrentSplitGroups_ and
          not queuedSplitGroups_.empty()) {
+    if (!hasMemoryForSplitGroupLocked()) {
+      ++taskStats_.numDeferredSplitGroups;
+      break;
+    }
     const uint32_t splitGroupId = queuedSplitGroups_.front();
     queuedSplitGroups_.pop();
 
@@ -1306,6 +1392,24 @@ void Task::ensureSplitGroupsAreBeingProcessedLocked() {
   }
 }
 
+bool Task::hasMemoryForSplitGroupLocked() const {
+  // A running split group always finishes and starts the next one, so the
+  // first one is never held back.
+  if (numRunningSplitGroups_ == 0) {
+    return true;
+  }
+  const auto ratio =
+      queryCtx_->queryConfig().groupedExecutionMemoryUsageRatio();
+  if (ratio == 0) {
+    return true;
+  }
+  auto* queryPool = queryCtx_->pool();
+  const uint64_t splitGroupBytes =
+      pool_->reservedBytes() / numRunningSplitGroups_;
+  return queryPool->reservedBytes() + splitGroupBytes <
+      queryPool->maxCapacity() * ratio;
+}
+
 void Task::setMaxSplitSequenceId(
     const core::PlanNodeId& planNodeId,
     long maxSequenceId) {
@@ -1323,7 +1427,7 @@ bool Task::addSplitWithSequence(
     const core::PlanNodeId& planNodeId,
     exec::Split&& split,
     long sequenceId) {
-  std::unique_ptr<ContinuePromise> promise;
+  std::vector<ContinuePromise> promises;
   bool added = false;
   bool isTaskRunning;
   {
@@ -1335,14 +1439,14 @@ bool Task::addSplitWithSequence(
       // duplicate splits would be ignored.
       auto& splitsState = getPlanNodeSplitsStateLocked(planNodeId);
       if (sequenceId > splitsState.maxSequenceId) {
-        promise = addSplitLocked(splitsState, std::move(split));
+        addDividedSplitLocked(splitsState, std::move(split), promises);
         added = true;
       }
     }
   }
 
-  if (promise) {
-    promise->setValue();
+  for (auto& promise : promises) {
+    promise.setValue();
   }
 
   if (!isTaskRunning) {
@@ -1356,18 +1460,18 @@ bool Task::addSplitWithSequence(
 
 void Task::addSplit(const core::PlanNodeId& planNodeId, exec::Split&& split) {
   bool isTaskRunning;
-  std::unique_ptr<ContinuePromise> promise;
+  std::vector<ContinuePromise> promises;
   {
     std::lock_guard<std::timed_mutex> l(mutex_);
     isTaskRunning = isRunningLocked();
     if (isTaskRunning) {
-      promise = addSplitLocked(
-          getPlanNodeSplitsStateLocked(planNodeId), std::move(split));
+      addDividedSplitLocked(
+          getPlanNodeSplitsStateLocked(planNodeId), std::move(split), promises);
     }
   }
 
-  if (promise) {
-    promise->setValue();
+  for (auto& promise : promises) {
+    promise.setValue();
   }
 
   if (!isTaskRunning) {
@@ -1391,6 +1495,30 @@ void Task::addRemoteSplit(
   }
 }
 
+void Task::addDividedSplitLocked(
+    SplitsState& splitsState,
+    exec::Split&& split,
+    std::vector<ContinuePromise>& promises) {
+  std::vector<std::shared_ptr<connector::ConnectorSplit>> parts;
+  const auto morselBytes = queryCtx_->queryConfig().tableScanSplitMorselBytes();
+  if (morselBytes > 0 && splitsState.sourceIsTableScan &&
+      split.hasConnectorSplit()) {
+    parts = split.connectorSplit->divide(morselBytes);
+  }
+  if (parts.empty()) {
+    if (auto promise = addSplitLocked(splitsState, std::move(split))) {
+      promises.push_back(std::move(*promise));
+    }
+    return;
+  }
+  for (auto& part : parts) {
+    if (auto promise = addSplitLocked(
+            splitsState, exec::Split(std::move(part), split.groupId))) {
+      promises.push_back(std::move(*promise));
+    }
+  }
+}
+
 std::unique_ptr<ContinuePromise> Task::addSplitLocked(
     SplitsState& splitsState,
     exec::Split&& split) {
@@ -1662,7 +1790,8 @@ std::shared_ptr<ScaledScanController> Task::getScaledScanControllerLocked(
 void Task::addScaledScanControllerLocked(
     uint32_t splitGroupId,
     const core::PlanNodeId& planNodeId,
-    uint32_t numDrivers) {
+    uint32_t numDrivers,
+    std::shared_ptr<LocalExchangeMemoryManager> outputMemoryManager) {
   VELOX_CHECK(queryCtx_->queryConfig().tableScanScaledProcessingEnabled());
 
   auto& splitGroupState = splitGroupStates_[splitGroupId];
@@ -1672,7 +1801,8 @@ void Task::addScaledScanControllerLocked(
       std::make_shared<ScaledScanController>(
           getOrAddNodePool(planNodeId),
           numDrivers,
-          queryCtx_->queryConfig().tableScanScaleUpMemoryUsageRatio()));
+          queryCtx_->queryConfig().tableScanScaleUpMemoryUsageRatio(),
+          std::move(outputMemoryManager)));
 }
 
 void Task::splitFinished(bool fromTableScan, int64_t splitWeight) {
@@ -3006,7 +3136,8 @@ void Task::createExchangeClientLocked(
       numberOfConsumers,
       queryCtx()->queryConfig().minExchangeOutputBatchBytes(),
       addExchangeClientPool(planNodeId, pipelineId),
-      queryCtx()->executor());
+      queryCtx()->executor(),
+      queryCtx()->queryConfig().exchangePrioritizeBufferedSourcesEnabled());
   exchangeClientByPlanNode_.emplace(planNodeId, exchangeClients_[pipelineId]);
 }
 
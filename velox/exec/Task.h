@@ -116,6 +116,13 @@ class Task : public std::enable_shared_from_this<Task> {
     spillDirectoryCallback_ = std::move(spillDirectoryCallback);
   }
 
+  /// Specifies the directory to spill to once the process wide local spill
+  /// tier has used up its quota, e.g. a directory on remote storage. See
+  /// common::setLocalSpillQuota(). The directory is created on first use.
+  void setOverflowSpillDirectory(const std::string& overflowSpillDirectory) {
+    overflowSpillDirectory_ = overflowSpillDirectory;
+  }
+
   /// Returns human-friendly representation of the plan augmented with runtime
   /// statistics. The implementation invokes exec::printPlanWithStats().
   ///
@@ -696,6 +703,24 @@ class Task : public std::enable_shared_from_this<Task> {
   /// folder could not be created.
   const std::string& getOrCreateSpillDirectory();
 
+  const std::string& overflowSpillDirectory() const {
+    return overflowSpillDirectory_;
+  }
+
+  /// Returns the directory for a new spill file writer. This is the spill
+  /// directory until the local spill tier has used up its quota, and the
+  /// overflow spill directory after that if one is set. Once a task overflows,
+  /// its new writers stay on the overflow directory. Ensures that the returned
+  /// directory is created. Is thread safe.
+  const std::string& getOrCreateTieredSpillDirectory();
+
+  /// Records 'bytes' written to spill files by this task. The bytes count
+  /// against the local spill tier quota until the task overflows, and are
+  /// reported as the 'overflowSpilledBytes' runtime stat of the spilling
+  /// operator after that. Writers opened before the overflow finish on the
+  /// local tier, so the quota is a soft limit.
+  void updateSpilledBytes(uint64_t bytes);
+
   /// True if produces output via OutputBufferManager.
   bool hasPartitionedOutput() const {
     return numDriversInPartitionedOutput_ > 0;
@@ -798,10 +823,13 @@ class Task : public std::enable_shared_from_this<Task> {
   void initTaskPool();
 
   // Creates a scaled scan controller for a given table scan node.
+  // 'outputMemoryManager' is of the local exchange the scan pipeline produces
+  // into, if any.
   void addScaledScanControllerLocked(
       uint32_t splitGroupId,
       const core::PlanNodeId& planNodeId,
-      uint32_t numDrivers);
+      uint32_t numDrivers,
+      std::shared_ptr<LocalExchangeMemoryManager> outputMemoryManager);
 
   // Creates new instance of memory pool for a plan node, stores it in the task
   // to ensure lifetime and returns a raw pointer.
@@ -942,6 +970,11 @@ class Task : public std::enable_shared_from_this<Task> {
   // processed. If yes, creates split group state and Drivers and runs them.
   void ensureSplitGroupsAreBeingProcessedLocked();
 
+  // Returns true if the query has the memory for one more split group per
+  // QueryConfig::groupedExecutionMemoryUsageRatio(). The memory of a split
+  // group is estimated as the average of the running ones.
+  bool hasMemoryForSplitGroupLocked() const;
+
   void driverClosedLocked();
 
   // Returns true if Task is in kRunning state, but all output drivers finished
@@ -970,6 +1003,14 @@ class Task : public std::enable_shared_from_this<Task> {
       SplitsState& splitsState,
       exec::Split&& split);
 
+  // Adds 'split' with addSplitLocked(), divided if it is a table scan split
+  // and QueryConfig::tableScanSplitMorselBytes() is set. Appends the promises
+  // to fulfill to 'promises'.
+  void addDividedSplitLocked(
+      SplitsState& splitsState,
+      exec::Split&& split,
+      std::vector<ContinuePromise>& promises);
+
   std::unique_ptr<ContinuePromise> addSplitToStoreLocked(
       SplitsStore& splitsStore,
       exec::Split&& split);
@@ -1275,6 +1316,18 @@ class Task : public std::enable_shared_from_this<Task> {
   // Indicates whether the spill directory has been created.
   std::atomic<bool> spillDirectoryCreated_{false};
 
+  // Directory to spill to once the local spill tier has used up its quota.
+  std::string overflowSpillDirectory_;
+
+  // Indicates whether the overflow spill directory has been created.
+  std::atomic<bool> overflowSpillDirectoryCreated_{false};
+
+  // True once this task spills to 'overflowSpillDirectory_'.
+  std::atomic<bool> spillOverflowed_{false};
+
+  // Bytes this task has written to spill files on the local spill tier.
+  std::atomic_uint64_t localSpilledBytes_{0};
+
   // Stores unconsumed preloading splits to ensure they are closed promptly.
   folly::F14FastSet<std::shared_ptr<connector::ConnectorSplit>>
       preloadingSplits_;
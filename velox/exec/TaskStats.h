@@ -54,6 +54,10 @@ struct TaskStats {
   int32_t numRunningSplits{0};
   int32_t numQueuedSplits{0};
   std::unordered_set<int32_t> completedSplitGroups;
+  /// The number of times a queued split group was not started because the
+  /// query was short of memory. See
+  /// QueryConfig::groupedExecutionMemoryUsageRatio().
+  uint64_t numDeferredSplitGroups{0};
 
   /// Table scan split stats.
   int32_t numRunningTableScanSplits{0};
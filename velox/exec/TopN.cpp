@@ -14,9 +14,12 @@
  * limitations under the License.
  */
 #include <folly/container/F14Map.h>
+#include <numeric>
 
 #include "velox/exec/ContainerRowSerde.h"
+#include "velox/exec/Driver.h"
 #include "velox/exec/TopN.h"
+#include "velox/type/Filter.h"
 #include "velox/vector/FlatVector.h"
 
 namespace facebook::velox::exec {
@@ -31,6 +34,11 @@ TopN::TopN(
           topNNode->id(),
           "TopN"),
       count_(topNNode->count()),
+      firstKeyChannel_(
+          exprToChannel(topNNode->sortingKeys()[0].get(), outputType_)),
+      firstKeyAscending_(topNNode->sortingOrders()[0].isAscending()),
+      firstKeyNullsFirst_(topNNode->sortingOrders()[0].isNullsFirst()),
+      firstKeyKind_(outputType_->childAt(firstKeyChannel_)->kind()),
       data_(std::make_unique<RowContainer>(outputType_->children(), pool())),
       comparator_(
           outputType_,
@@ -66,7 +74,9 @@ void TopN::addInput(RowVectorPtr input) {
   // Maps passed rows of 'data_' to the corresponding input row number. These
   // input rows of non-key columns are later stored into data_.
   folly::F14FastMap<void*, vector_size_t> passedRows;
-  for (auto row = 0; row < input->size(); ++row) {
+  const auto numCandidateRows = selectCandidateRows(input->size());
+  for (auto i = 0; i < numCandidateRows; ++i) {
+    const auto row = candidateRows_[i];
     char* newRow = nullptr;
     if (topRows_.size() < count_) {
       newRow = data_->newRow();
@@ -104,6 +114,123 @@ void TopN::addInput(RowVectorPtr input) {
       }
     }
   }
+
+  maybePushdownThreshold();
+}
+
+std::optional<int64_t> TopN::firstKeyThreshold() const {
+  if (topRows_.size() < count_) {
+    return std::nullopt;
+  }
+  const char* topRow = topRows_.top();
+  const auto& column = data_->columnAt(firstKeyChannel_);
+  if (RowContainer::isNullAt(topRow, column)) {
+    return std::nullopt;
+  }
+  switch (firstKeyKind_) {
+    case TypeKind::TINYINT:
+      return RowContainer::valueAt<int8_t>(topRow, column.offset());
+    case TypeKind::SMALLINT:
+      return RowContainer::valueAt<int16_t>(topRow, column.offset());
+    case TypeKind::INTEGER:
+      return RowContainer::valueAt<int32_t>(topRow, column.offset());
+    case TypeKind::BIGINT:
+      return RowContainer::valueAt<int64_t>(topRow, column.offset());
+    default:
+      return std::nullopt;
+  }
+}
+
+vector_size_t TopN::selectCandidateRows(vector_size_t numRows) {
+  candidateRows_.resize(numRows);
+  const auto threshold = firstKeyThreshold();
+  if (!threshold.has_value()) {
+    std::iota(candidateRows_.begin(), candidateRows_.end(), 0);
+    return numRows;
+  }
+  switch (firstKeyKind_) {
+    case TypeKind::TINYINT:
+      return selectCandidateRows<int8_t>(numRows, threshold.value());
+    case TypeKind::SMALLINT:
+      return selectCandidateRows<int16_t>(numRows, threshold.value());
+    case TypeKind::INTEGER:
+      return selectCandidateRows<int32_t>(numRows, threshold.value());
+    case TypeKind::BIGINT:
+      return selectCandidateRows<int64_t>(numRows, threshold.value());
+    default:
+      VELOX_UNREACHABLE();
+  }
+}
+
+template <typename T>
+vector_size_t TopN::selectCandidateRows(
+    vector_size_t numRows,
+    int64_t threshold) {
+  const auto& decoded = decodedVectors_[firstKeyChannel_];
+  const T typedThreshold = threshold;
+  auto* rows = candidateRows_.data();
+  vector_size_t numCandidateRows = 0;
+  // Rows with the same first key as the threshold are kept for the comparison
+  // on all keys. The loops over flat values without nulls are branch free.
+  if (decoded.isIdentityMapping() && !decoded.mayHaveNulls()) {
+    const auto* values = decoded.data<T>();
+    if (firstKeyAscending_) {
+      for (auto row = 0; row < numRows; ++row) {
+        rows[numCandidateRows] = row;
+        numCandidateRows += values[row] <= typedThreshold;
+      }
+    } else {
+      for (auto row = 0; row < numRows; ++row) {
+        rows[numCandidateRows] = row;
+        numCandidateRows += values[row] >= typedThreshold;
+      }
+    }
+    return numCandidateRows;
+  }
+  // Null keys are left to the comparison on all keys.
+  for (auto row = 0; row < numRows; ++row) {
+    rows[numCandidateRows] = row;
+    if (decoded.isNullAt(row)) {
+      ++numCandidateRows;
+      continue;
+    }
+    const auto value = decoded.valueAt<T>(row);
+    numCandidateRows +=
+        firstKeyAscending_ ? value <= typedThreshold : value >= typedThreshold;
+  }
+  return numCandidateRows;
+}
+
+void TopN::maybePushdownThreshold() {
+  if (canPushdownThreshold_.has_value() && !canPushdownThreshold_.value()) {
+    return;
+  }
+  const auto threshold = firstKeyThreshold();
+  if (!threshold.has_value() || threshold == pushedThreshold_) {
+    return;
+  }
+  if (!canPushdownThreshold_.has_value()) {
+    canPushdownThreshold_ = operatorCtx_->driverCtx()
+                                ->driver->canPushdownFilters(
+                                    this, {firstKeyChannel_})
+                                .count(firstKeyChannel_) > 0;
+    if (!canPushdownThreshold_.value()) {
+      return;
+    }
+  }
+  // Null keys pass if they sort before all values.
+  if (firstKeyAscending_) {
+    dynamicFilters_[firstKeyChannel_] = std::make_shared<common::BigintRange>(
+        std::numeric_limits<int64_t>::min(),
+        threshold.value(),
+        firstKeyNullsFirst_);
+  } else {
+    dynamicFilters_[firstKeyChannel_] = std::make_shared<common::BigintRange>(
+        threshold.value(),
+        std::numeric_limits<int64_t>::max(),
+        firstKeyNullsFirst_);
+  }
+  pushedThreshold_ = threshold;
 }
 
 RowVectorPtr TopN::getOutput() {
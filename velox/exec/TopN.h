@@ -44,8 +44,40 @@ class TopN : public Operator {
   bool isFinished() override;
 
  private:
+  // Returns the first sorting key of the current top row if 'topRows_' is full
+  // and the first sorting key is an integer. Rows with a worse first key can't
+  // enter 'topRows_'.
+  std::optional<int64_t> firstKeyThreshold() const;
+
+  // Sets 'candidateRows_' to the rows of the input that may enter 'topRows_'
+  // and returns their number. Drops the rows whose first sorting key is worse
+  // than firstKeyThreshold() with a single pass over the decoded key values,
+  // before the remaining rows are compared to the top row on all keys.
+  vector_size_t selectCandidateRows(vector_size_t numRows);
+
+  template <typename T>
+  vector_size_t selectCandidateRows(vector_size_t numRows, int64_t threshold);
+
+  // Publishes firstKeyThreshold() as a dynamic filter on the first sorting
+  // key if it changed and the upstream operators accept the filter, e.g. to
+  // let a TableScan skip the stripes whose stats do not pass it.
+  void maybePushdownThreshold();
+
   const int32_t count_;
 
+  // Channel, order and type kind of the first sorting key.
+  const column_index_t firstKeyChannel_;
+  const bool firstKeyAscending_;
+  const bool firstKeyNullsFirst_;
+  const TypeKind firstKeyKind_;
+
+  // Whether the threshold on the first key can be pushed down. Set on the
+  // first input since the Driver isn't set up at construction.
+  std::optional<bool> canPushdownThreshold_;
+  std::optional<int64_t> pushedThreshold_;
+
+  std::vector<vector_size_t> candidateRows_;
+
   bool finished_ = false;
   uint32_t numRowsReturned_ = 0;
 
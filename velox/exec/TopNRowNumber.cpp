@@ -116,6 +116,7 @@ TopNRowNumber::TopNRowNumber(
       limit_{node->limit()},
       generateRowNumber_{node->generateRowNumber()},
       numPartitionKeys_{node->partitionKeys().size()},
+      inlineTopRows_{numPartitionKeys_ > 0 && limit_ <= kMaxInlineLimit},
       inputChannels_{reorderInputChannels(
           node->inputType(),
           node->partitionKeys(),
@@ -146,7 +147,8 @@ TopNRowNumber::TopNRowNumber(
   if (numKeys > 0) {
     Accumulator accumulator{
         true,
-        sizeof(TopRows),
+        inlineTopRows_ ? static_cast<int32_t>(limit_ * sizeof(char*))
+                       : static_cast<int32_t>(sizeof(TopRows)),
         false,
         1,
         nullptr,
@@ -208,9 +210,15 @@ void TopNRowNumber::addInput(RowVectorPtr input) {
     // Process input rows. For each row, lookup the partition. If number of rows
     // in that partition is less than limit, add the new row. Otherwise, check
     // if row should replace an existing row or be discarded.
-    for (auto i = 0; i < numInput; ++i) {
-      auto& partition = partitionAt(lookup_->hits[i]);
-      processInputRow(i, partition);
+    if (inlineTopRows_) {
+      for (auto i = 0; i < numInput; ++i) {
+        processInlineInputRow(i, inlineRowsAt(lookup_->hits[i]));
+      }
+    } else {
+      for (auto i = 0; i < numInput; ++i) {
+        auto& partition = partitionAt(lookup_->hits[i]);
+        processInputRow(i, partition);
+      }
     }
 
     if (abandonPartialEarly()) {
@@ -243,6 +251,13 @@ bool TopNRowNumber::abandonPartialEarly() const {
 }
 
 void TopNRowNumber::initializeNewPartitions() {
+  if (inlineTopRows_) {
+    for (auto index : lookup_->newGroups) {
+      std::fill_n(inlineRowsAt(lookup_->hits[index]), limit_, nullptr);
+    }
+    return;
+  }
+
   for (auto index : lookup_->newGroups) {
     new (lookup_->hits[index] + partitionOffset_)
         TopRows(table_->stringAllocator(), comparator_);
@@ -277,6 +292,40 @@ void TopNRowNumber::processInputRow(vector_size_t index, TopRows& partition) {
   topRows.push(newRow);
 }
 
+void TopNRowNumber::processInlineInputRow(vector_size_t index, char** rows) {
+  const auto numRows = numInlineRows(rows);
+
+  // Find the position of the new row among the rows sorted best first. Rows
+  // equal to the new row stay ahead of it.
+  vector_size_t position = numRows;
+  for (auto i = 0; i < numRows; ++i) {
+    if (comparator_(decodedVectors_, index, rows[i])) {
+      position = i;
+      break;
+    }
+  }
+
+  if (position == limit_) {
+    // Drop this input row.
+    return;
+  }
+
+  char* newRow = nullptr;
+  if (numRows < limit_) {
+    newRow = data_->newRow();
+    std::copy_backward(rows + position, rows + numRows, rows + numRows + 1);
+  } else {
+    // Replace the last row and reuse its memory.
+    newRow = data_->initializeRow(rows[limit_ - 1], true /* reuse */);
+    std::copy_backward(rows + position, rows + limit_ - 1, rows + limit_);
+  }
+  rows[position] = newRow;
+
+  for (auto col = 0; col < decodedVectors_.size(); ++col) {
+    data_->store(decodedVectors_[col], index, newRow, col);
+  }
+}
+
 void TopNRowNumber::noMoreInput() {
   Operator::noMoreInput();
 
@@ -318,13 +367,13 @@ void TopNRowNumber::updateEstimatedOutputRowSize() {
   }
 }
 
-TopNRowNumber::TopRows* TopNRowNumber::nextPartition() {
+bool TopNRowNumber::nextPartition() {
   if (!table_) {
     if (!currentPartition_) {
       currentPartition_ = 0;
-      return singlePartition_.get();
+      return true;
     }
-    return nullptr;
+    return false;
   }
 
   if (!currentPartition_) {
@@ -335,7 +384,7 @@ TopNRowNumber::TopRows* TopNRowNumber::nextPartition() {
         partitions_.data());
     if (numPartitions_ == 0) {
       // No more partitions.
-      return nullptr;
+      return false;
     }
 
     currentPartition_ = 0;
@@ -347,7 +396,7 @@ TopNRowNumber::TopRows* TopNRowNumber::nextPartition() {
     }
   }
 
-  return &currentPartition();
+  return true;
 }
 
 TopNRowNumber::TopRows& TopNRowNumber::currentPartition() {
@@ -360,13 +409,32 @@ TopNRowNumber::TopRows& TopNRowNumber::currentPartition() {
   return partitionAt(partitions_[currentPartition_.value()]);
 }
 
+vector_size_t TopNRowNumber::currentPartitionSize() {
+  if (inlineTopRows_) {
+    return numInlineRows(inlineRowsAt(partitions_[currentPartition_.value()]));
+  }
+  return currentPartition().rows.size();
+}
+
 void TopNRowNumber::appendPartitionRows(
-    TopRows& partition,
     vector_size_t start,
     vector_size_t size,
     vector_size_t outputOffset,
     FlatVector<int64_t>* rowNumbers) {
+  if (inlineTopRows_) {
+    auto* rows = inlineRowsAt(partitions_[currentPartition_.value()]);
+    for (auto i = 0; i < size; ++i) {
+      if (rowNumbers) {
+        // Row numbers start with 1.
+        rowNumbers->set(outputOffset + i, start + i + 1);
+      }
+      outputRows_[outputOffset + i] = rows[start + i];
+    }
+    return;
+  }
+
   // Append 'size' partition rows in reverse order starting from 'start' row.
+  auto& partition = currentPartition();
   auto rowNumber = partition.rows.size() - start;
   for (auto i = 0; i < size; ++i) {
     const auto index = outputOffset + size - i - 1;
@@ -433,34 +501,32 @@ RowVectorPtr TopNRowNumber::getOutputFromMemory() {
 
   vector_size_t offset = 0;
   if (remainingRowsInPartition_ > 0) {
-    auto& partition = currentPartition();
-    auto start = partition.rows.size() - remainingRowsInPartition_;
+    auto start = currentPartitionSize() - remainingRowsInPartition_;
     const auto numRows =
         std::min<vector_size_t>(outputBatchSize_, remainingRowsInPartition_);
-    appendPartitionRows(partition, start, numRows, offset, rowNumbers);
+    appendPartitionRows(start, numRows, offset, rowNumbers);
     offset += numRows;
     remainingRowsInPartition_ -= numRows;
   }
 
   while (offset < outputBatchSize_) {
-    auto* partition = nextPartition();
-    if (!partition) {
+    if (!nextPartition()) {
       break;
     }
 
-    auto numRows = partition->rows.size();
+    auto numRows = currentPartitionSize();
     if (offset + numRows > outputBatchSize_) {
       remainingRowsInPartition_ = offset + numRows - outputBatchSize_;
 
       // Add a subset of partition rows.
       numRows -= remainingRowsInPartition_;
-      appendPartitionRows(*partition, 0, numRows, offset, rowNumbers);
+      appendPartitionRows(0, numRows, offset, rowNumbers);
       offset += numRows;
       break;
     }
 
     // Add all partition rows.
-    appendPartitionRows(*partition, 0, numRows, offset, rowNumbers);
+    appendPartitionRows(0, numRows, offset, rowNumbers);
     offset += numRows;
     remainingRowsInPartition_ = 0;
   }
@@ -633,7 +699,7 @@ void TopNRowNumber::close() {
     allocator_.reset();
   };
 
-  if (table_ == nullptr) {
+  if (table_ == nullptr || inlineTopRows_) {
     return;
   }
 
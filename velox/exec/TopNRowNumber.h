@@ -70,6 +70,10 @@ class TopNRowNumber : public Operator {
   void reclaim(uint64_t targetBytes, memory::MemoryReclaimer::Stats& stats)
       override;
 
+  /// Maximum limit for which the top rows of each partition are kept inline in
+  /// the hash table rows instead of in a per-partition heap.
+  static constexpr int32_t kMaxInlineLimit = 8;
+
  private:
   // A priority queue to keep track of top 'limit' rows for a given partition.
   struct TopRows {
@@ -94,23 +98,46 @@ class TopNRowNumber : public Operator {
     return *reinterpret_cast<TopRows*>(group + partitionOffset_);
   }
 
+  // Returns the 'limit_' slots for the top rows of 'group' if
+  // 'inlineTopRows_'. The rows are sorted best first. Unused slots are null.
+  char** inlineRowsAt(char* group) {
+    return reinterpret_cast<char**>(group + partitionOffset_);
+  }
+
+  vector_size_t numInlineRows(char* const* rows) const {
+    vector_size_t numRows = 0;
+    while (numRows < limit_ && rows[numRows] != nullptr) {
+      ++numRows;
+    }
+    return numRows;
+  }
+
   // Decodes and potentially loads input if lazy vector.
   void prepareInput(RowVectorPtr& input);
 
   // Adds input row to a partition or discards the row.
   void processInputRow(vector_size_t index, TopRows& partition);
 
-  // Returns next partition to add to output or nullptr if there are no
-  // partitions left.
-  TopRows* nextPartition();
+  // Adds input row to the inline top 'rows' of a partition or discards the
+  // row.
+  void processInlineInputRow(vector_size_t index, char** rows);
+
+  // Advances to the next partition to add to output. Returns false if there
+  // are no partitions left.
+  bool nextPartition();
 
   // Returns partition that was partially added to the previous output batch.
+  // Not used if 'inlineTopRows_'.
   TopRows& currentPartition();
 
-  // Appends partition rows to outputRows_ and optionally populates row
-  // numbers.
+  // Returns the number of rows kept for the current partition. The rows added
+  // to output are removed from heap-based partitions, but not from inline
+  // ones.
+  vector_size_t currentPartitionSize();
+
+  // Appends 'size' rows of the current partition starting from 'start' row to
+  // outputRows_ and optionally populates row numbers.
   void appendPartitionRows(
-      TopRows& partition,
       vector_size_t start,
       vector_size_t size,
       vector_size_t outputOffset,
@@ -161,6 +188,11 @@ class TopNRowNumber : public Operator {
 
   const size_t numPartitionKeys_;
 
+  // True if the top rows of each partition are kept inline in the hash table
+  // row. This avoids a heap allocation per partition when there are many
+  // partitions and a small limit.
+  const bool inlineTopRows_;
+
   // Input columns in the order of: partition keys, sorting keys, the rest.
   const std::vector<column_index_t> inputChannels_;
 
@@ -184,7 +216,7 @@ class TopNRowNumber : public Operator {
 
   // Hash table to keep track of partitions. Not used if there are no
   // partitioning keys. For each partition, stores an instance of TopRows
-  // struct.
+  // struct or the inline top rows if 'inlineTopRows_'.
   std::unique_ptr<BaseHashTable> table_;
 
   std::unique_ptr<HashLookup> lookup_;
@@ -19,6 +19,29 @@
 #include "velox/vector/FlatVector.h"
 
 namespace facebook::velox::exec {
+namespace {
+// Returns true if a slice of 'vector' references only the sliced rows of its
+// buffers. A slice of a dictionary keeps all of its base vector, which creates
+// the efficiency problems described in UnnestChannelEncoding::wrap().
+bool canSliceWithoutCopy(const BaseVector& vector) {
+  switch (vector.encoding()) {
+    case VectorEncoding::Simple::FLAT:
+    case VectorEncoding::Simple::ARRAY:
+    case VectorEncoding::Simple::MAP:
+      return true;
+    case VectorEncoding::Simple::ROW:
+      for (const auto& child : vector.asUnchecked<RowVector>()->children()) {
+        if (child && !canSliceWithoutCopy(*child)) {
+          return false;
+        }
+      }
+      return true;
+    default:
+      return false;
+  }
+}
+} // namespace
+
 Unnest::Unnest(
     int32_t operatorId,
     DriverCtx* driverCtx,
@@ -222,6 +245,10 @@ const Unnest::UnnestChannelEncoding Unnest::generateEncodingForChannel(
   // Make dictionary index for elements column since they may be out of order.
   vector_size_t index = 0;
   bool identityMapping = true;
+  // True while the elements so far are a contiguous range of the base vector
+  // without nulls.
+  bool contiguous = true;
+  vector_size_t nextElement = -1;
   VELOX_DCHECK_GT(range.size, 0);
 
   range.forEachRow(
@@ -236,26 +263,41 @@ const Unnest::UnnestChannelEncoding Unnest::generateEncodingForChannel(
               unnestSize < end) {
             identityMapping = false;
           }
-          auto currentUnnestSize = std::min(end, unnestSize);
-          for (auto i = start; i < currentUnnestSize; i++) {
-            rawElementIndices[index++] = offset + i;
+          const auto currentUnnestSize = std::min(end, unnestSize);
+          if (currentUnnestSize > start) {
+            if (nextElement >= 0 && nextElement != offset + start) {
+              contiguous = false;
+            }
+            std::iota(
+                rawElementIndices + index,
+                rawElementIndices + index + currentUnnestSize - start,
+                offset + start);
+            index += currentUnnestSize - start;
+            nextElement = offset + currentUnnestSize;
           }
 
-          for (auto i = std::max(start, currentUnnestSize); i < end; ++i) {
-            bits::setNull(rawNulls, index++, true);
+          const auto nullsStart = std::max(start, currentUnnestSize);
+          if (nullsStart < end) {
+            contiguous = false;
+            bits::fillBits(
+                rawNulls, index, index + end - nullsStart, bits::kNull);
+            index += end - nullsStart;
           }
         } else if (size > 0) {
           identityMapping = false;
-
-          for (auto i = start; i < end; ++i) {
-            bits::setNull(rawNulls, index++, true);
-          }
+          contiguous = false;
+          bits::fillBits(rawNulls, index, index + size, bits::kNull);
+          index += size;
         }
       },
       rawMaxSizes_,
       firstRowStart_);
 
-  return {elementIndices, nulls, identityMapping};
+  std::optional<vector_size_t> sliceOffset;
+  if (contiguous && !identityMapping) {
+    sliceOffset = rawElementIndices[0];
+  }
+  return {elementIndices, nulls, identityMapping, sliceOffset};
 }
 
 VectorPtr Unnest::generateOrdinalityVector(const RowRange& range) {
@@ -327,6 +369,11 @@ VectorPtr Unnest::UnnestChannelEncoding::wrap(
     return base;
   }
 
+  if (sliceOffset.has_value() && canSliceWithoutCopy(*base)) {
+    // A slice shares the buffers of 'base' instead of copying the range.
+    return base->slice(sliceOffset.value(), wrapSize);
+  }
+
   const auto result =
       BaseVector::wrapInDictionary(nulls, indices, wrapSize, base);
 
@@ -350,32 +397,4 @@ VectorPtr Unnest::UnnestChannelEncoding::wrap(
 bool Unnest::isFinished() {
   return noMoreInput_ && input_ == nullptr;
 }
-
-void Unnest::RowRange::forEachRow(
-    std::function<void(
-        vector_size_t /*row*/,
-        vector_size_t /*start*/,
-        vector_size_t /*size*/)> func,
-    const vector_size_t* const rawMaxSizes,
-    vector_size_t firstRowStart) const {
-  // Process the first row.
-  const auto firstRowEnd = size == 1 && lastRowEnd.has_value()
-      ? lastRowEnd.value()
-      : rawMaxSizes[start];
-  func(start, firstRowStart, firstRowEnd - firstRowStart);
-
-  // Process the middle rows.
-  for (auto row = start + 1; row < start + size - 1; ++row) {
-    func(row, 0, rawMaxSizes[row]);
-  }
-
-  // Process the last row if exists.
-  if (size > 1) {
-    if (lastRowEnd.has_value()) {
-      func(start + size - 1, 0, lastRowEnd.value());
-    } else {
-      func(start + size - 1, 0, rawMaxSizes[start + size - 1]);
-    }
-  }
-}
 } // namespace facebook::velox::exec
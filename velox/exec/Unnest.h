@@ -69,13 +69,31 @@ class Unnest : public Operator {
     // @param rawMaxSizes Used to compute the end of each row.
     // @param firstRowStart The index to start processing the first row. Same
     // with Unnest member firstRowStart_.
+    template <typename Func>
     void forEachRow(
-        std::function<void(
-            vector_size_t /*row*/,
-            vector_size_t /*start*/,
-            vector_size_t /*size*/)> func,
+        Func func,
         const vector_size_t* const rawMaxSizes,
-        vector_size_t firstRowStart) const;
+        vector_size_t firstRowStart) const {
+      // Process the first row.
+      const auto firstRowEnd = size == 1 && lastRowEnd.has_value()
+          ? lastRowEnd.value()
+          : rawMaxSizes[start];
+      func(start, firstRowStart, firstRowEnd - firstRowStart);
+
+      // Process the middle rows.
+      for (auto row = start + 1; row < start + size - 1; ++row) {
+        func(row, 0, rawMaxSizes[row]);
+      }
+
+      // Process the last row if exists.
+      if (size > 1) {
+        if (lastRowEnd.has_value()) {
+          func(start + size - 1, 0, lastRowEnd.value());
+        } else {
+          func(start + size - 1, 0, rawMaxSizes[start + size - 1]);
+        }
+      }
+    }
 
     // First input row to be included in the output.
     const vector_size_t start;
@@ -110,6 +128,10 @@ class Unnest : public Operator {
     BufferPtr indices;
     BufferPtr nulls;
     bool identityMapping;
+    // Set if the elements are a contiguous range of the base vector without
+    // nulls, e.g. a large array split across output batches. The range starts
+    // at 'sliceOffset'.
+    std::optional<vector_size_t> sliceOffset;
 
     VectorPtr wrap(const VectorPtr& base, vector_size_t wrapSize) const;
   };
@@ -75,6 +75,12 @@ uint64_t hashOne(DecodedVector& decoded, vector_size_t index) {
     }
   }
 }
+
+template <typename T>
+bool hasSimdPaddedValues(const DecodedVector& decoded) {
+  const auto* flat = decoded.base()->asFlatVector<T>();
+  return flat != nullptr && flat->hasSimdPaddedValues();
+}
 } // namespace
 
 template <bool typeProvidesCustomComparison, TypeKind Kind>
@@ -92,19 +98,23 @@ void VectorHasher::hashValues(
     });
   } else if (
       !decoded_.isIdentityMapping() &&
-      rows.countSelected() > decoded_.base()->size()) {
-    cachedHashes_.resize(decoded_.base()->size());
-    std::fill(cachedHashes_.begin(), cachedHashes_.end(), kNullHash);
+      (decoded_.base() == hashedDictionaryValues_.get() ||
+       rows.countSelected() > decoded_.base()->size())) {
+    if (decoded_.base() != hashedDictionaryValues_.get()) {
+      hashedDictionaryValues_ = dictionaryValues_;
+      dictionaryHashes_.resize(decoded_.base()->size());
+      std::fill(dictionaryHashes_.begin(), dictionaryHashes_.end(), kNullHash);
+    }
     rows.applyToSelected([&](vector_size_t row) {
       if (decoded_.isNullAt(row)) {
         result[row] = mix ? bits::hashMix(result[row], kNullHash) : kNullHash;
         return;
       }
       auto baseIndex = decoded_.index(row);
-      uint64_t hash = cachedHashes_[baseIndex];
+      uint64_t hash = dictionaryHashes_[baseIndex];
       if (hash == kNullHash) {
         hash = hashOne<typeProvidesCustomComparison, Kind>(decoded_, row);
-        cachedHashes_[baseIndex] = hash;
+        dictionaryHashes_[baseIndex] = hash;
       }
       result[row] = mix ? bits::hashMix(result[row], hash) : hash;
     });
@@ -421,9 +431,13 @@ void VectorHasher::lookupValueIdsTyped(
       });
     }
   } else if (decoded.isIdentityMapping()) {
-    if (Kind == TypeKind::BIGINT && isRange_) {
+    // The SIMD loop loads full batches past the last selected row.
+    if (Kind == TypeKind::BIGINT && isRange_ &&
+        hasSimdPaddedValues<int64_t>(decoded)) {
       lookupIdsRangeSimd<int64_t>(decoded, rows, result);
-    } else if (Kind == TypeKind::INTEGER && isRange_) {
+    } else if (
+        Kind == TypeKind::INTEGER && isRange_ &&
+        hasSimdPaddedValues<int32_t>(decoded)) {
       lookupIdsRangeSimd<int32_t>(decoded, rows, result);
     } else {
       rows.applyToSelected([&](vector_size_t row) INLINE_LAMBDA {
@@ -541,6 +555,83 @@ void VectorHasher::lookupValueIds(
       result.data());
 }
 
+// Sets the value ids of the values loaded into it. Removes the rows with a
+// null or a value without an id from 'rows'.
+class VectorHasher::ValueIdHook final : public ValueHook {
+ public:
+  ValueIdHook(
+      const VectorHasher& hasher,
+      SelectivityVector& rows,
+      uint64_t* result)
+      : hasher_(hasher), rows_(rows), result_(result) {}
+
+  bool acceptsNulls() const override {
+    return true;
+  }
+
+  void addNull(vector_size_t row) override {
+    rows_.setValid(row, false);
+    ++numNulls_;
+  }
+
+  void addValue(vector_size_t row, int64_t value) override {
+    setId(row, hasher_.lookupValueId(value));
+  }
+
+  void addValue(vector_size_t row, folly::StringPiece value) override {
+    setId(row, hasher_.lookupValueId(StringView(value.data(), value.size())));
+  }
+
+  vector_size_t numNulls() const {
+    return numNulls_;
+  }
+
+ private:
+  void setId(vector_size_t row, uint64_t id) {
+    if (id == kUnmappable) {
+      rows_.setValid(row, false);
+      return;
+    }
+    const auto multiplier = hasher_.multiplier_;
+    result_[row] = multiplier == 1 ? id : result_[row] + multiplier * id;
+  }
+
+  const VectorHasher& hasher_;
+  SelectivityVector& rows_;
+  uint64_t* const result_;
+  vector_size_t numNulls_{0};
+};
+
+bool VectorHasher::canLookupValueIdsFromLazy() const {
+  switch (typeKind_) {
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+    case TypeKind::VARCHAR:
+    case TypeKind::VARBINARY:
+      return !type_->providesCustomComparison();
+    default:
+      return false;
+  }
+}
+
+vector_size_t VectorHasher::lookupValueIdsFromLazy(
+    const LazyVector& values,
+    SelectivityVector& rows,
+    raw_vector<uint64_t>& result) const {
+  VELOX_CHECK(canLookupValueIdsFromLazy());
+  VELOX_CHECK(!values.isLoaded());
+  VELOX_CHECK_EQ(values.size(), rows.size());
+  VELOX_CHECK(rows.isAllSelected());
+  ValueIdHook hook(*this, rows, result.data());
+  raw_vector<vector_size_t> rowNumbers;
+  values.load(
+      RowSet(velox::iota(rows.size(), rowNumbers), rows.size()), &hook);
+  rows.updateBounds();
+  return hook.numNulls();
+}
+
 void VectorHasher::hash(
     const SelectivityVector& rows,
     bool mix,
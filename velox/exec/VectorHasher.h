@@ -171,6 +171,13 @@ class VectorHasher {
         type_->toString(),
         vector.type()->toString());
     decoded_.decode(vector, rows);
+    const auto* loaded = vector.loadedVector();
+    if (loaded->encoding() == VectorEncoding::Simple::DICTIONARY &&
+        loaded->valueVector().get() == decoded_.base()) {
+      dictionaryValues_ = loaded->valueVector();
+    } else {
+      dictionaryValues_ = nullptr;
+    }
   }
 
   DecodedVector& decodedVector() {
@@ -235,6 +242,19 @@ class VectorHasher {
       ScratchMemory& scratchMemory,
       raw_vector<uint64_t>& result) const;
 
+  // Returns true if lookupValueIdsFromLazy() supports the type of 'this'.
+  bool canLookupValueIdsFromLazy() const;
+
+  // Same as lookupValueIds() for all the rows of 'values', a LazyVector that
+  // is not loaded. Loads 'values' into a ValueHook that looks up the value
+  // ids, so that the values are not materialized. Removes the rows with a
+  // null value from 'rows' too and returns their number. 'values' cannot be
+  // read after this.
+  vector_size_t lookupValueIdsFromLazy(
+      const LazyVector& values,
+      SelectivityVector& rows,
+      raw_vector<uint64_t>& result) const;
+
   // Returns true if either range or distinct values have not overflowed.
   bool mayUseValueIds() const {
     return hasRange_ || !distinctOverflow_;
@@ -315,6 +335,8 @@ class VectorHasher {
   }
 
  private:
+  class ValueIdHook;
+
   static constexpr uint32_t kStringASRangeMaxSize = 7;
   static constexpr uint32_t kStringBufferUnitSize = 1024;
   static constexpr uint64_t kMaxDistinctStringsBytes = 1 << 20;
@@ -550,6 +572,17 @@ class VectorHasher {
   DecodedVector decoded_;
   raw_vector<uint64_t> cachedHashes_;
 
+  // The values of the single level dictionary vector decoded last, nullptr
+  // if not a dictionary. Holding these keeps 'hashedDictionaryValues_' from
+  // being freed and reallocated at the same address.
+  VectorPtr dictionaryValues_;
+  // The dictionary values whose hashes are in 'dictionaryHashes_'. Batches
+  // over the same values, e.g. the dictionary of a Parquet column chunk, hash
+  // each distinct value once.
+  VectorPtr hashedDictionaryValues_;
+  // Hashes of 'hashedDictionaryValues_' by index. kNullHash if not computed.
+  raw_vector<uint64_t> dictionaryHashes_;
+
   // Single precomputed hash for constant partition keys.
   uint64_t precomputedHash_{0};
 
@@ -52,7 +52,11 @@ Window::Window(
           windowNode_, pool(), spillConfig, &nonReclaimableSection_);
     } else {
       windowBuild_ = std::make_unique<PartitionStreamingWindowBuild>(
-          windowNode, pool(), spillConfig, &nonReclaimableSection_);
+          windowNode,
+          pool(),
+          spillConfig,
+          &nonReclaimableSection_,
+          &spillStats_);
     }
   } else {
     windowBuild_ = std::make_unique<SortWindowBuild>(
@@ -36,6 +36,27 @@ WindowPartition::WindowPartition(
   for (auto index : inputMapping_) {
     columns_.emplace_back(data_->columnAt(index));
   }
+
+  for (const auto& [channel, sortOrder] : sortKeyInfo_) {
+    const auto& type = data_->columnTypes()[channel];
+    int32_t bytewiseSize = 0;
+    if (!type->providesCustomComparison()) {
+      switch (type->kind()) {
+        case TypeKind::BOOLEAN:
+        case TypeKind::TINYINT:
+        case TypeKind::SMALLINT:
+        case TypeKind::INTEGER:
+        case TypeKind::BIGINT:
+        case TypeKind::HUGEINT:
+        case TypeKind::TIMESTAMP:
+          bytewiseSize = type->cppSizeInBytes();
+          break;
+        default:
+          break;
+      }
+    }
+    peerKeys_.push_back({channel, data_->columnAt(channel), bytewiseSize});
+  }
 }
 
 WindowPartition::WindowPartition(
@@ -173,34 +194,40 @@ WindowPartition::extractNulls(
                    : std::nullopt;
 }
 
-bool WindowPartition::compareRowsWithSortKeys(const char* lhs, const char* rhs)
-    const {
+bool WindowPartition::isPeer(const char* lhs, const char* rhs) const {
   if (lhs == rhs) {
-    return false;
+    return true;
   }
-  for (auto& key : sortKeyInfo_) {
-    if (auto result = data_->compare(
-            lhs,
-            rhs,
-            key.first,
-            {key.second.isNullsFirst(), key.second.isAscending(), false})) {
-      return result < 0;
+  for (const auto& key : peerKeys_) {
+    if (key.bytewiseSize > 0) {
+      // Compares the values of integer-like keys without dispatching on the
+      // type.
+      const bool lhsNull = RowContainer::isNullAt(lhs, key.column);
+      if (lhsNull != RowContainer::isNullAt(rhs, key.column)) {
+        return false;
+      }
+      if (!lhsNull &&
+          memcmp(
+              lhs + key.column.offset(),
+              rhs + key.column.offset(),
+              key.bytewiseSize) != 0) {
+        return false;
+      }
+    } else if (
+        data_->compare(
+            lhs, rhs, key.channel, CompareFlags{.equalsOnly = true}) != 0) {
+      return false;
     }
   }
-  return false;
+  return true;
 }
 
 vector_size_t WindowPartition::findPeerRowEndIndex(
     vector_size_t startRow,
-    vector_size_t lastRow,
-    const std::function<bool(const char*, const char*)>& peerCompare) {
+    vector_size_t lastRow) {
+  const auto* start = partition_[startRow - startRow_];
   auto peerEnd = startRow;
-  while (peerEnd <= lastRow) {
-    if (peerCompare(
-            partition_[startRow - startRow_],
-            partition_[peerEnd - startRow_])) {
-      break;
-    }
+  while (peerEnd <= lastRow && isPeer(start, partition_[peerEnd - startRow_])) {
     ++peerEnd;
   }
   return peerEnd;
@@ -219,10 +246,6 @@ std::pair<vector_size_t, vector_size_t> WindowPartition::computePeerBuffers(
     vector_size_t prevPeerEnd,
     vector_size_t* rawPeerStarts,
     vector_size_t* rawPeerEnds) {
-  const auto peerCompare = [&](const char* lhs, const char* rhs) -> bool {
-    return compareRowsWithSortKeys(lhs, rhs);
-  };
-
   VELOX_CHECK_LE(end, numRows() + startRow_);
 
   auto lastPartitionRow = numRows() + startRow_ - 1;
@@ -232,14 +255,14 @@ std::pair<vector_size_t, vector_size_t> WindowPartition::computePeerBuffers(
   size_t next = start;
   size_t index{0};
   if (partial_ && start > 0) {
-    const auto peerGroup = peerCompare(previousRow_, partition_[0]);
+    const auto peerGroup = !isPeer(previousRow_, partition_[0]);
 
     // The first row is the last row in previous batch so delete it after used
     // for the first peer group detection.
     removePreviousRow();
 
     if (!peerGroup) {
-      peerEnd = findPeerRowEndIndex(start, lastPartitionRow, peerCompare);
+      peerEnd = findPeerRowEndIndex(start, lastPartitionRow);
 
       for (; next < std::min(end, peerEnd); ++next, ++index) {
         rawPeerStarts[index] = peerStart;
@@ -261,7 +284,7 @@ std::pair<vector_size_t, vector_size_t> WindowPartition::computePeerBuffers(
       // Compute peerStart and peerEnd rows for the first row of the partition
       // or when past the previous peerGroup.
       peerStart = next;
-      peerEnd = findPeerRowEndIndex(peerStart, lastPartitionRow, peerCompare);
+      peerEnd = findPeerRowEndIndex(peerStart, lastPartitionRow);
     }
 
     rawPeerStarts[index] = peerStart;
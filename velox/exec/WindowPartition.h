@@ -181,13 +181,14 @@ class WindowPartition {
       bool partial,
       bool complete);
 
-  bool compareRowsWithSortKeys(const char* lhs, const char* rhs) const;
+  // Returns true if 'lhs' and 'rhs' have equal values of all the ORDER BY
+  // keys.
+  bool isPeer(const char* lhs, const char* rhs) const;
 
   // Finds the index of the last peer row in range of ['startRow', 'lastRow'].
   vector_size_t findPeerRowEndIndex(
       vector_size_t startRow,
-      vector_size_t lastRow,
-      const std::function<bool(const char*, const char*)>& peerCompare);
+      vector_size_t lastRow);
 
   // Removes 'numRows' from 'data_' and 'rows_'.
   void eraseRows(vector_size_t numRows);
@@ -268,6 +269,18 @@ class WindowPartition {
   // ORDER BY column info for this partition.
   const std::vector<std::pair<column_index_t, core::SortOrder>> sortKeyInfo_;
 
+  // An ORDER BY key for finding peer rows.
+  struct PeerKey {
+    column_index_t channel;
+    RowColumn column;
+    // The size of the values if they are equal if and only if their bytes are
+    // equal, e.g. integers, or 0 if RowContainer::compare() must be used.
+    int32_t bytewiseSize;
+  };
+
+  // The ORDER BY keys in the order of 'sortKeyInfo_'.
+  std::vector<PeerKey> peerKeys_;
+
   // Copy of the input RowColumn objects that are used for
   // accessing the partition row columns. These RowColumn objects
   // index into RowContainer data_ above and can retrieve the column values.
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/WorkStealingExecutor.h"
+
+#include <fmt/format.h>
+#include <folly/system/ThreadName.h>
+#include <glog/logging.h>
+
+#include "velox/common/base/Exceptions.h"
+#include "velox/common/base/SuccinctPrinter.h"
+#include "velox/common/process/ProcessBase.h"
+
+namespace facebook::velox::exec {
+namespace {
+// The executor and queue of the current thread if it is a thread of a
+// WorkStealingExecutor.
+thread_local const WorkStealingExecutor* currentExecutor{nullptr};
+thread_local int32_t currentThreadIndex{-1};
+} // namespace
+
+std::string WorkStealingExecutor::Stats::toString() const {
+  return fmt::format(
+      "localAdds {} remoteAdds {} steals {} cpu high {} medium {} low {}",
+      numLocalAdds,
+      numRemoteAdds,
+      numSteals,
+      succinctNanos(cpuNanos[0]),
+      succinctNanos(cpuNanos[1]),
+      succinctNanos(cpuNanos[2]));
+}
+
+WorkStealingExecutor::WorkStealingExecutor(
+    int32_t numThreads,
+    std::string threadNamePrefix)
+    : threadNamePrefix_(std::move(threadNamePrefix)) {
+  VELOX_CHECK_GT(numThreads, 0);
+  queues_.reserve(numThreads);
+  for (auto i = 0; i < numThreads; ++i) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+  threads_.reserve(numThreads);
+  for (auto i = 0; i < numThreads; ++i) {
+    threads_.emplace_back([this, i]() { run(i); });
+  }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    stop_ = true;
+  }
+  workAvailable_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void WorkStealingExecutor::addWithPriority(
+    folly::Func func,
+    int8_t priority) {
+  int32_t queueIndex;
+  if (currentExecutor == this) {
+    queueIndex = currentThreadIndex;
+    ++numLocalAdds_;
+  } else {
+    queueIndex = nextQueue_++ % queues_.size();
+    ++numRemoteAdds_;
+  }
+  {
+    auto& queue = *queues_[queueIndex];
+    std::lock_guard<std::mutex> l(queue.mutex);
+    queue.funcs[level(priority)].push_back(std::move(func));
+  }
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    ++numPendingAtLevel_[level(priority)];
+    ++numPending_;
+  }
+  workAvailable_.notify_one();
+}
+
+folly::Func WorkStealingExecutor::next(
+    int32_t threadIndex,
+    int32_t& funcLevel) {
+  const int32_t numQueues = queues_.size();
+  for (auto level = 0; level < kNumLevels; ++level) {
+    if (numPendingAtLevel_[level] == 0) {
+      continue;
+    }
+    for (auto i = 0; i < numQueues; ++i) {
+      auto& queue = *queues_[(threadIndex + i) % numQueues];
+      std::lock_guard<std::mutex> l(queue.mutex);
+      auto& funcs = queue.funcs[level];
+      if (funcs.empty()) {
+        continue;
+      }
+      // The owner takes the oldest function. A thief takes the newest, which
+      // is the least likely to be taken by the owner soon.
+      folly::Func func;
+      if (i == 0) {
+        func = std::move(funcs.front());
+        funcs.pop_front();
+      } else {
+        func = std::move(funcs.back());
+        funcs.pop_back();
+        ++numSteals_;
+      }
+      --numPendingAtLevel_[level];
+      --numPending_;
+      funcLevel = level;
+      return func;
+    }
+  }
+  return nullptr;
+}
+
+void WorkStealingExecutor::run(int32_t threadIndex) {
+  folly::setThreadName(fmt::format("{}{}", threadNamePrefix_, threadIndex));
+  currentExecutor = this;
+  currentThreadIndex = threadIndex;
+  for (;;) {
+    int32_t funcLevel;
+    if (auto func = next(threadIndex, funcLevel)) {
+      const auto startCpuNanos = process::threadCpuNanos();
+      try {
+        func();
+      } catch (const std::exception& e) {
+        LOG(ERROR) << "Function in WorkStealingExecutor threw: " << e.what();
+      }
+      cpuNanos_[funcLevel] += process::threadCpuNanos() - startCpuNanos;
+      continue;
+    }
+    std::unique_lock<std::mutex> l(mutex_);
+    workAvailable_.wait(l, [&]() { return stop_ || numPending_ > 0; });
+    if (stop_ && numPending_ == 0) {
+      return;
+    }
+  }
+}
+
+WorkStealingExecutor::Stats WorkStealingExecutor::stats() const {
+  Stats stats;
+  stats.numLocalAdds = numLocalAdds_;
+  stats.numRemoteAdds = numRemoteAdds_;
+  stats.numSteals = numSteals_;
+  for (auto i = 0; i < kNumLevels; ++i) {
+    stats.cpuNanos[i] = cpuNanos_[i];
+  }
+  return stats;
+}
+
+} // namespace facebook::velox::exec
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <folly/Executor.h>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace facebook::velox::exec {
+
+/// An executor for Drivers with a run queue per thread instead of one shared
+/// queue. A function added from one of its threads, e.g. a Driver enqueued
+/// again by a callback of an operator on that thread, goes to the queue of
+/// that thread and is likely to run where its data is in cache. Functions
+/// added from other threads are distributed round robin. A thread with an
+/// empty queue takes functions from the other queues. To be used as the
+/// executor of a QueryCtx.
+///
+/// There are 3 priority levels: high for priorities above MID_PRI, medium for
+/// MID_PRI and low for lower priorities. A thread runs a function of a higher
+/// level from any queue before one of a lower level from its own queue, so
+/// high priority Drivers take over the threads at their next time slice.
+class WorkStealingExecutor : public folly::Executor {
+ public:
+  struct Stats {
+    /// The number of functions added from a thread of 'this'.
+    uint64_t numLocalAdds{0};
+    /// The number of functions added from other threads.
+    uint64_t numRemoteAdds{0};
+    /// The number of functions run by a thread other than the one whose queue
+    /// they were added to.
+    uint64_t numSteals{0};
+    /// The thread CPU time of the functions run at each priority level, from
+    /// high to low.
+    std::array<uint64_t, 3> cpuNanos{};
+
+    std::string toString() const;
+  };
+
+  explicit WorkStealingExecutor(
+      int32_t numThreads,
+      std::string threadNamePrefix = "Driver");
+
+  /// Runs the functions still queued and joins the threads. Functions may be
+  /// added meanwhile only from the threads of 'this'.
+  ~WorkStealingExecutor() override;
+
+  void add(folly::Func func) override {
+    addWithPriority(std::move(func), MID_PRI);
+  }
+
+  void addWithPriority(folly::Func func, int8_t priority) override;
+
+  uint8_t getNumPriorities() const override {
+    return kNumLevels;
+  }
+
+  int32_t numThreads() const {
+    return threads_.size();
+  }
+
+  Stats stats() const;
+
+ private:
+  static constexpr int32_t kNumLevels = 3;
+
+  struct Queue {
+    std::mutex mutex;
+    // The functions of each priority level, from high to low.
+    std::array<std::deque<folly::Func>, kNumLevels> funcs;
+  };
+
+  static int32_t level(int8_t priority) {
+    return priority > MID_PRI ? 0 : (priority == MID_PRI ? 1 : 2);
+  }
+
+  // The loop of the thread at 'threadIndex'.
+  void run(int32_t threadIndex);
+
+  // Returns the first function of the highest non-empty level of the queue of
+  // 'threadIndex' or, if that level is empty, of the next non-empty queue.
+  // Sets 'funcLevel' to the level of the function. Returns nullptr if all are
+  // empty.
+  folly::Func next(int32_t threadIndex, int32_t& funcLevel);
+
+  const std::string threadNamePrefix_;
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> threads_;
+
+  // Guards 'stop_' and the increments of 'numPending_' so that a thread
+  // waiting for work is not missed.
+  std::mutex mutex_;
+  std::condition_variable workAvailable_;
+  bool stop_{false};
+
+  // The number of queued functions across all queues.
+  std::atomic<int64_t> numPending_{0};
+  // The number of queued functions of each level across all queues.
+  std::array<std::atomic<int64_t>, kNumLevels> numPendingAtLevel_{};
+  std::atomic<uint64_t> nextQueue_{0};
+
+  std::atomic<uint64_t> numLocalAdds_{0};
+  std::atomic<uint64_t> numRemoteAdds_{0};
+  std::atomic<uint64_t> numSteals_{0};
+  std::array<std::atomic<uint64_t>, kNumLevels> cpuNanos_{};
+};
+
+} // namespace facebook::velox::exec
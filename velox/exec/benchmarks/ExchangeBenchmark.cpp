@@ -41,6 +41,10 @@ DEFINE_int64(
     "task-wide buffer in local exchange");
 DEFINE_int64(exchange_buffer_mb, 32, "task-wide buffer in remote exchange");
 DEFINE_int32(dict_pct, 0, "Percentage of columns wrapped in dictionary");
+DEFINE_int32(
+    many_destinations,
+    1024,
+    "Number of destinations in the exchangeFlat10kManyDestinations benchmark");
 // Add the following definitions to allow Clion runs
 DEFINE_bool(gtest_color, false, "");
 DEFINE_string(gtest_filter, "*", "");
@@ -122,7 +126,11 @@ class ExchangeBenchmark : public VectorTestBase {
       int32_t taskWidth,
       int64_t& wallUs,
       PlanNodeStats& partitionedOutputStats,
-      PlanNodeStats& exchangeStats) {
+      PlanNodeStats& exchangeStats,
+      int32_t numDestinations = 0) {
+    if (numDestinations == 0) {
+      numDestinations = width;
+    }
     core::PlanNodePtr plan;
     core::PlanNodeId exchangeId;
     core::PlanNodeId leafPartitionedOutputId;
@@ -145,7 +153,7 @@ class ExchangeBenchmark : public VectorTestBase {
       std::vector<std::string> leafTaskIds;
       auto leafPlan = exec::test::PlanBuilder()
                           .values(vectors, true)
-                          .partitionedOutput({"c0"}, width)
+                          .partitionedOutput({"c0"}, numDestinations)
                           .capturePlanNodeId(leafPartitionedOutputId)
                           .planNode();
 
@@ -169,7 +177,7 @@ class ExchangeBenchmark : public VectorTestBase {
               .capturePlanNodeId(finalAggPartitionedOutputId)
               .planNode();
 
-      for (int i = 0; i < width; i++) {
+      for (int i = 0; i < numDestinations; i++) {
         auto taskId = makeTaskId(iteration, "final-agg", i);
         finalAggSplits.push_back(
             exec::Split(std::make_shared<exec::RemoteConnectorSplit>(taskId)));
@@ -453,6 +461,21 @@ void runBenchmarks() {
     return 1;
   });
 
+  int64_t flat10KManyDestinationsWallUs;
+  PlanNodeStats partitionedOutputStatsFlat10KManyDestinations;
+  PlanNodeStats exchangeStatsFlat10KManyDestinations;
+  folly::addBenchmark(__FILE__, "exchangeFlat10kManyDestinations", [&]() {
+    bm->run(
+        flat10k,
+        FLAGS_width,
+        FLAGS_task_width,
+        flat10KManyDestinationsWallUs,
+        partitionedOutputStatsFlat10KManyDestinations,
+        exchangeStatsFlat10KManyDestinations,
+        FLAGS_many_destinations);
+    return 1;
+  });
+
   int64_t flat50KWallUs;
   PlanNodeStats partitionedOutputStatsFlat50;
   PlanNodeStats exchangeStatsFlat50;
@@ -523,6 +546,29 @@ void runBenchmarks() {
     return 1;
   });
 
+  // One task per run so that all drivers contend on the same local exchange
+  // queues.
+  const std::vector<int32_t> localDriverCounts = {4, 16, 32, 64, 128};
+  std::vector<int64_t> localDriversWallUs(localDriverCounts.size());
+  std::vector<PlanNodeStats> localDriversStats(localDriverCounts.size());
+  std::vector<LocalPartitionWaitStats> localDriversWaitStats(
+      localDriverCounts.size());
+  for (auto i = 0; i < localDriverCounts.size(); ++i) {
+    folly::addBenchmark(
+        __FILE__,
+        fmt::format("localFlat10kDrivers{}", localDriverCounts[i]),
+        [&, i]() {
+          bm->runLocal(
+              flat10k,
+              localDriverCounts[i],
+              1,
+              localDriversWallUs[i],
+              localDriversStats[i],
+              localDriversWaitStats[i]);
+          return 1;
+        });
+  }
+
   folly::runBenchmarks();
 
   std::cout
@@ -533,6 +579,17 @@ void runBenchmarks() {
             << std::endl;
   std::cout << "Exchange: " << exchangeStatsFlat10K.toString() << std::endl;
 
+  std::cout
+      << "---------------------------Flat10KManyDestinations-------------------------"
+      << std::endl;
+  std::cout << "Wall Time (ms): "
+            << succinctMicros(flat10KManyDestinationsWallUs) << std::endl;
+  std::cout << "PartitionOutput: "
+            << partitionedOutputStatsFlat10KManyDestinations.toString()
+            << std::endl;
+  std::cout << "Exchange: "
+            << exchangeStatsFlat10KManyDestinations.toString() << std::endl;
+
   std::cout
       << "----------------------------------Flat50K----------------------------------"
       << std::endl;
@@ -590,6 +647,20 @@ void runBenchmarks() {
       localPartitionWaitStats.wallMs.begin(),
       localPartitionWaitStats.wallMs.end());
   assert(!localPartitionWaitStats.wallMs.empty());
+
+  std::cout
+      << "----------------------------LocalFlat10KByDrivers--------------------------"
+      << std::endl;
+  for (auto i = 0; i < localDriverCounts.size(); ++i) {
+    std::cout << localDriverCounts[i] << " drivers: Wall Time (ms): "
+              << succinctMicros(localDriversWallUs[i])
+              << ", Producer Wait Time (ms): "
+              << localDriversWaitStats[i].totalProducerWaitMs
+              << ", Consumer Wait Time (ms): "
+              << localDriversWaitStats[i].totalConsumerWaitMs << std::endl;
+    std::cout << "LocalPartition: " << localDriversStats[i].toString()
+              << std::endl;
+  }
 }
 
 } // namespace
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <folly/String.h>
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/init/Init.h>
+#include <gflags/gflags.h>
+
+#include "velox/common/base/SuccinctPrinter.h"
+#include "velox/common/file/FileSystems.h"
+#include "velox/common/memory/SharedArbitrator.h"
+#include "velox/common/time/Timer.h"
+#include "velox/exec/tests/utils/ArbitratorTestUtil.h"
+#include "velox/functions/prestosql/aggregates/RegisterAggregateFunctions.h"
+#include "velox/functions/prestosql/registration/RegistrationFunctions.h"
+#include "velox/parse/TypeResolver.h"
+#include "velox/serializers/PrestoSerializer.h"
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+DEFINE_int32(num_queries, 8, "Number of queries run concurrently per round");
+DEFINE_string(
+    query_mix,
+    "join,agg,orderby",
+    "Comma separated kinds of the queries, assigned round robin. Kinds are "
+    "'join', 'agg' and 'orderby'");
+DEFINE_int64(memory_capacity_mb, 512, "Capacity of the shared arbitrator");
+DEFINE_int64(input_size_mb, 64, "Size of the input data of each query");
+DEFINE_int32(num_drivers, 4, "Number of drivers of each query");
+DEFINE_int32(num_threads, 32, "Number of threads of the driver executor");
+DEFINE_int32(num_rounds, 3, "Number of rounds");
+
+using namespace facebook;
+using namespace facebook::velox;
+using namespace facebook::velox::exec;
+using namespace facebook::velox::exec::test;
+
+namespace {
+
+enum class QueryKind { kJoin, kAgg, kOrderBy };
+
+std::vector<QueryKind> parseQueryMix(const std::string& mix) {
+  std::vector<std::string> names;
+  folly::split(',', mix, names, true);
+  std::vector<QueryKind> kinds;
+  for (const auto& name : names) {
+    if (name == "join") {
+      kinds.push_back(QueryKind::kJoin);
+    } else if (name == "agg") {
+      kinds.push_back(QueryKind::kAgg);
+    } else if (name == "orderby") {
+      kinds.push_back(QueryKind::kOrderBy);
+    } else {
+      VELOX_USER_FAIL("Unknown query kind in --query_mix: {}", name);
+    }
+  }
+  VELOX_USER_CHECK(!kinds.empty(), "--query_mix is empty");
+  return kinds;
+}
+
+// The totals of one round over all its queries.
+struct RoundStats {
+  uint64_t wallNanos{0};
+  int32_t numFailed{0};
+  // Time the operators spent waiting for memory arbitration.
+  uint64_t arbitrationWaitNanos{0};
+  // Time the tasks were paused for reclaiming their memory.
+  uint64_t reclaimMs{0};
+  uint64_t spilledBytes{0};
+  uint64_t spillWriteNanos{0};
+  uint64_t spillReadBytes{0};
+  uint64_t spillReadNanos{0};
+  memory::MemoryArbitrator::Stats arbitratorStats;
+
+  void add(const TaskStats& taskStats) {
+    reclaimMs += taskStats.memoryReclaimMs;
+    for (const auto& pipeline : taskStats.pipelineStats) {
+      for (const auto& op : pipeline.operatorStats) {
+        spilledBytes += op.spilledBytes;
+        arbitrationWaitNanos +=
+            sum(op, memory::SharedArbitrator::kMemoryArbitrationWallNanos);
+        spillWriteNanos += sum(op, Operator::kSpillWriteTime);
+        spillReadBytes += sum(op, Operator::kSpillReadBytes);
+        spillReadNanos += sum(op, Operator::kSpillReadTime);
+      }
+    }
+  }
+
+  std::string toString() const {
+    const auto bandwidth = [](uint64_t bytes, uint64_t nanos) {
+      return nanos == 0
+          ? std::string("n/a")
+          : succinctBytes(bytes * 1'000'000'000.0 / nanos) + "/s";
+    };
+    return fmt::format(
+        "wall {} failed {} arbitration wait {} reclaim {} spilled {} "
+        "spill write {} spill read {} ({}) arbitrator [{}]",
+        succinctNanos(wallNanos),
+        numFailed,
+        succinctNanos(arbitrationWaitNanos),
+        succinctMillis(reclaimMs),
+        succinctBytes(spilledBytes),
+        bandwidth(spilledBytes, spillWriteNanos),
+        bandwidth(spillReadBytes, spillReadNanos),
+        succinctBytes(spillReadBytes),
+        arbitratorStats.toString());
+  }
+
+ private:
+  static uint64_t sum(const OperatorStats& stats, const std::string& name) {
+    auto it = stats.runtimeStats.find(name);
+    return it == stats.runtimeStats.end() ? 0 : it->second.sum;
+  }
+};
+
+// Runs rounds of concurrent spilling queries against a shared arbitrator of
+// fixed capacity and reports the arbitration and spill costs of each round.
+class MemoryArbitrationBenchmark : public velox::test::VectorTestBase {
+ public:
+  MemoryArbitrationBenchmark()
+      : kinds_(parseQueryMix(FLAGS_query_mix)),
+        memoryManager_(createMemoryManager(FLAGS_memory_capacity_mb << 20)),
+        executor_(std::make_unique<folly::CPUThreadPoolExecutor>(
+            FLAGS_num_threads)) {
+    const auto rowType = ROW(
+        {{"c0", INTEGER()},
+         {"c1", INTEGER()},
+         {"c2", VARCHAR()},
+         {"c3", VARCHAR()}});
+    VectorFuzzer::Options opts;
+    opts.vectorSize = 1024;
+    opts.nullRatio = 0;
+    opts.stringVariableLength = false;
+    opts.stringLength = 1024;
+    opts.allowLazyVector = false;
+    vectors_ = createVectors(rowType, FLAGS_input_size_mb << 20, opts);
+  }
+
+  RoundStats runRound() {
+    const auto statsBefore = memoryManager_->arbitrator()->stats();
+    std::mutex mutex;
+    RoundStats round;
+    {
+      NanosecondTimer timer(&round.wallNanos);
+      std::vector<std::thread> threads;
+      threads.reserve(FLAGS_num_queries);
+      for (auto i = 0; i < FLAGS_num_queries; ++i) {
+        threads.emplace_back([&, i]() {
+          auto task = runQuery(kinds_[i % kinds_.size()]);
+          std::lock_guard<std::mutex> l(mutex);
+          if (task == nullptr) {
+            ++round.numFailed;
+          } else {
+            round.add(task->taskStats());
+          }
+        });
+      }
+      for (auto& thread : threads) {
+        thread.join();
+      }
+    }
+    round.arbitratorStats = memoryManager_->arbitrator()->stats() - statsBefore;
+    return round;
+  }
+
+ private:
+  // Returns the task of the query or nullptr if the query failed, e.g. was
+  // aborted by the arbitrator.
+  std::shared_ptr<Task> runQuery(QueryKind kind) {
+    auto queryCtx = newQueryCtx(memoryManager_.get(), executor_.get());
+    try {
+      switch (kind) {
+        case QueryKind::kJoin:
+          return runHashJoinTask(
+                     vectors_,
+                     queryCtx,
+                     false,
+                     FLAGS_num_drivers,
+                     pool(),
+                     true)
+              .task;
+        case QueryKind::kAgg:
+          return runAggregateTask(
+                     vectors_,
+                     queryCtx,
+                     false,
+                     true,
+                     FLAGS_num_drivers,
+                     pool(),
+                     nullptr)
+              .task;
+        case QueryKind::kOrderBy:
+          return runOrderByTask(
+                     vectors_,
+                     queryCtx,
+                     false,
+                     FLAGS_num_drivers,
+                     pool(),
+                     true)
+              .task;
+      }
+    } catch (const std::exception& e) {
+      LOG(WARNING) << "Query failed: " << e.what();
+    }
+    return nullptr;
+  }
+
+  const std::vector<QueryKind> kinds_;
+  const std::unique_ptr<memory::MemoryManager> memoryManager_;
+  const std::unique_ptr<folly::CPUThreadPoolExecutor> executor_;
+  std::vector<RowVectorPtr> vectors_;
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+  folly::Init init{&argc, &argv};
+  memory::SharedArbitrator::registerFactory();
+  memory::MemoryManager::initialize({});
+  filesystems::registerLocalFileSystem();
+  functions::prestosql::registerAllScalarFunctions();
+  aggregate::prestosql::registerAllAggregateFunctions();
+  parse::registerTypeResolver();
+  if (!isRegisteredVectorSerde()) {
+    serializer::presto::PrestoVectorSerde::registerVectorSerde();
+  }
+  if (!isRegisteredNamedVectorSerde(VectorSerde::Kind::kPresto)) {
+    serializer::presto::PrestoVectorSerde::registerNamedVectorSerde();
+  }
+
+  RoundStats total;
+  {
+    MemoryArbitrationBenchmark benchmark;
+    for (auto i = 0; i < FLAGS_num_rounds; ++i) {
+      const auto round = benchmark.runRound();
+      std::cout << "Round " << i << ": " << round.toString() << std::endl;
+      total.wallNanos += round.wallNanos;
+      total.numFailed += round.numFailed;
+      total.arbitrationWaitNanos += round.arbitrationWaitNanos;
+      total.reclaimMs += round.reclaimMs;
+      total.spilledBytes += round.spilledBytes;
+      total.spillWriteNanos += round.spillWriteNanos;
+      total.spillReadBytes += round.spillReadBytes;
+      total.spillReadNanos += round.spillReadNanos;
+    }
+  }
+  std::cout << "Total: " << total.toString() << std::endl;
+  return 0;
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+
+#include "velox/common/file/FileSystems.h"
+#include "velox/common/memory/Memory.h"
+#include "velox/exec/SpillFile.h"
+#include "velox/exec/tests/utils/TempDirectoryPath.h"
+#include "velox/serializers/PrestoSerializer.h"
+#include "velox/vector/fuzzer/VectorFuzzer.h"
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+using namespace facebook;
+using namespace facebook::velox;
+using namespace facebook::velox::exec;
+
+namespace {
+
+// Writes and reads back 1GB of spilled rows with and without the block
+// checksums and the encryption to measure their cost per GB.
+class SpillFileBenchmark : public velox::test::VectorTestBase {
+ public:
+  void setup() {
+    VectorFuzzer::Options opts;
+    opts.vectorSize = 10'000;
+    opts.stringLength = 64;
+    opts.nullRatio = 0;
+    VectorFuzzer fuzzer(opts, pool());
+    rowType_ = ROW({"a", "b", "c"}, {BIGINT(), DOUBLE(), VARCHAR()});
+    batch_ = fuzzer.fuzzInputFlatRow(rowType_);
+    tempDirectory_ = exec::test::TempDirectoryPath::create();
+  }
+
+  void run(bool checksum, bool encryption) {
+    constexpr uint64_t kTotalBytes{1ULL << 30};
+    common::UpdateAndCheckSpillLimitCB updateSpilledBytesCb =
+        [](uint64_t) {};
+    folly::Synchronized<common::SpillStats> stats;
+    SpillFiles files;
+    {
+      SpillWriter writer(
+          rowType_,
+          0,
+          {},
+          common::CompressionKind_NONE,
+          tempDirectory_->getPath() + "/spill",
+          kTotalBytes,
+          1 << 20,
+          "",
+          updateSpilledBytesCb,
+          pool(),
+          &stats,
+          /*columnarFormat=*/false,
+          /*writeExecutor=*/nullptr,
+          /*prefixKeyConfig=*/std::nullopt,
+          /*pageRoutingBits=*/std::nullopt,
+          /*numPageRoutingKeys=*/0,
+          /*ioShare=*/{},
+          checksum,
+          encryption);
+      IndexRange range{0, batch_->size()};
+      uint64_t writtenBytes{0};
+      while (writtenBytes < kTotalBytes) {
+        writtenBytes += writer.write(batch_, folly::Range(&range, 1));
+      }
+      files = writer.finish();
+    }
+    for (const auto& fileInfo : files) {
+      auto file = SpillReadFile::create(fileInfo, 1 << 20, pool(), &stats);
+      RowVectorPtr batch;
+      while (file->nextBatch(batch)) {
+        folly::doNotOptimizeAway(batch);
+      }
+      auto fs = filesystems::getFileSystem(fileInfo.path, nullptr);
+      fs->remove(fileInfo.path);
+    }
+  }
+
+ private:
+  RowTypePtr rowType_;
+  RowVectorPtr batch_;
+  std::shared_ptr<exec::test::TempDirectoryPath> tempDirectory_;
+};
+
+std::unique_ptr<SpillFileBenchmark> bm;
+
+BENCHMARK(plain) {
+  bm->run(false, false);
+}
+
+BENCHMARK_RELATIVE(checksum) {
+  bm->run(true, false);
+}
+
+BENCHMARK_RELATIVE(encryption) {
+  bm->run(false, true);
+}
+
+BENCHMARK_RELATIVE(checksumAndEncryption) {
+  bm->run(true, true);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  folly::Init init{&argc, &argv};
+  memory::MemoryManager::initialize({});
+  filesystems::registerLocalFileSystem();
+  if (!isRegisteredNamedVectorSerde(VectorSerde::Kind::kPresto)) {
+    serializer::presto::PrestoVectorSerde::registerNamedVectorSerde();
+  }
+
+  bm = std::make_unique<SpillFileBenchmark>();
+  bm->setup();
+
+  folly::runBenchmarks();
+
+  bm.reset();
+
+  return 0;
+}
@@ -270,6 +270,40 @@ BENCHMARK(computeValueIdsDictionaryForFiltering) {
   }
 }
 
+namespace {
+// Hashes strings of 'length' bytes that share a prefix of 'length' - 4
+// bytes.
+void benchmarkHashStrings(int32_t length) {
+  folly::BenchmarkSuspender suspender;
+  vector_size_t size = 1'000;
+  BenchmarkBase base;
+  const std::string prefix(length - 4, 'x');
+  std::vector<std::string> strings(size);
+  for (auto i = 0; i < size; ++i) {
+    strings[i] = prefix + fmt::format("{:04}", i);
+  }
+  auto values = base.vectorMaker().flatVector(strings);
+  VectorHasher hasher(VARCHAR(), 0);
+  raw_vector<uint64_t> hashes(size);
+  SelectivityVector rows(size);
+  suspender.dismiss();
+
+  for (int i = 0; i < 10'000; i++) {
+    hasher.decode(*values, rows);
+    hasher.hash(rows, false, hashes);
+    folly::doNotOptimizeAway(hashes);
+  }
+}
+} // namespace
+
+BENCHMARK(hashInlineStrings) {
+  benchmarkHashStrings(10);
+}
+
+BENCHMARK_RELATIVE(hashLongStrings) {
+  benchmarkHashStrings(50);
+}
+
 int main(int argc, char** argv) {
   folly::Init init{&argc, &argv};
   memory::MemoryManager::initialize({});
@@ -181,7 +181,10 @@ TopNRowNumberFuzzer::makeDefaultPlan(
   std::vector<std::string> projectFields = allKeys;
   projectFields.emplace_back("row_number");
 
-  int32_t limit = randInt(1, FLAGS_batch_size);
+  // Small limits keep the top rows inline in the hash table rows. Cover them
+  // as often as the heap-based partitions.
+  int32_t limit =
+      randInt(0, 1) ? randInt(1, 8) : randInt(1, FLAGS_batch_size);
   auto plan = test::PlanBuilder()
                   .values(input)
                   .topNRowNumber(partitionKeys, sortKeys, limit, true)
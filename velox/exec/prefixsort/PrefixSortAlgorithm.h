@@ -15,9 +15,11 @@
  */
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "velox/common/base/Exceptions.h"
 #include "velox/common/base/SimdUtil.h"
@@ -159,6 +161,69 @@ class PrefixSortRunner {
         compare);
   }
 
+  // Maximum number of key bytes and minimum number of entries for PrefixSort
+  // to use radixSort instead of quickSort. Each key byte that is not the same
+  // in all entries costs a pass over the entries, which only pays off for
+  // short keys and many entries.
+  static const uint32_t kMaxRadixSortKeyBytes = 16;
+  static const uint64_t kMinRadixSortEntries = 2'048;
+
+  /// Sorts the entries in [start, end) on their first 'keyBytes' bytes with a
+  /// least significant byte first radix sort. The keys are ordered as
+  /// sequences of uint64_t words in native byte order, like the normalized
+  /// keys of PrefixSort. 'keyBytes' must be a multiple of 8 and at most
+  /// kMaxRadixSortKeyBytes. 'scratch' must have room for all entries in
+  /// [start, end). The sort is stable and skips the bytes that are the same in
+  /// all entries, e.g. the padding of the normalized keys.
+  void radixSort(char* start, char* end, uint32_t keyBytes, char* scratch)
+      const {
+    VELOX_CHECK(end >= start, "Invalid sort range.");
+    VELOX_CHECK_EQ(keyBytes % sizeof(uint64_t), 0);
+    VELOX_CHECK_LE(keyBytes, kMaxRadixSortKeyBytes);
+    VELOX_CHECK_LE(keyBytes, entrySize_);
+    const uint64_t numEntries = (end - start) / entrySize_;
+    if (numEntries < 2) {
+      return;
+    }
+    const uint32_t numWords = keyBytes / sizeof(uint64_t);
+
+    // Counts the values of all key bytes in a single pass.
+    std::vector<std::array<uint64_t, 256>> counts(keyBytes);
+    for (auto* entry = start; entry < end; entry += entrySize_) {
+      for (uint32_t i = 0; i < keyBytes; ++i) {
+        ++counts[i][radixDigit(entry, numWords, i)];
+      }
+    }
+
+    char* source = start;
+    char* target = scratch;
+    for (uint32_t i = 0; i < keyBytes; ++i) {
+      auto& count = counts[i];
+      // 'source' is a permutation of the entries, so its first entry has the
+      // byte value shared by all entries if there is one.
+      if (count[radixDigit(source, numWords, i)] == numEntries) {
+        continue;
+      }
+      uint64_t offset = 0;
+      for (auto& value : count) {
+        const auto numValues = value;
+        value = offset;
+        offset += numValues;
+      }
+      auto* const sourceEnd = source + numEntries * entrySize_;
+      for (auto* entry = source; entry < sourceEnd; entry += entrySize_) {
+        simd::memcpy(
+            target + count[radixDigit(entry, numWords, i)]++ * entrySize_,
+            entry,
+            entrySize_);
+      }
+      std::swap(source, target);
+    }
+    if (source != start) {
+      simd::memcpy(start, source, numEntries * entrySize_);
+    }
+  }
+
   /// For testing only.
   template <typename TCompare>
   FOLLY_ALWAYS_INLINE static char* testingMedian3(
@@ -183,6 +248,15 @@ class PrefixSortRunner {
     simd::memcpy(*rhs, swapBuffer_, entrySize_);
   }
 
+  // Returns the 'byte'-th least significant byte of the key of 'entry' made
+  // of 'numWords' words, the first word being the most significant.
+  FOLLY_ALWAYS_INLINE static uint8_t
+  radixDigit(const char* entry, uint32_t numWords, uint32_t byte) {
+    const auto word = reinterpret_cast<const uint64_t*>(
+        entry)[numWords - 1 - byte / sizeof(uint64_t)];
+    return (word >> (8 * (byte % sizeof(uint64_t)))) & 0xff;
+  }
+
   FOLLY_ALWAYS_INLINE void rangeSwap(
       const detail::PrefixSortIterator& start1,
       const detail::PrefixSortIterator& start2,
@@ -27,8 +27,15 @@ namespace facebook::velox::exec::prefixsort {
 /// Provides encode/decode methods for PrefixSort.
 class PrefixSortEncoder {
  public:
-  PrefixSortEncoder(bool ascending, bool nullsFirst)
-      : ascending_(ascending), nullsFirst_(nullsFirst){};
+  /// If 'encodeStringSize' is true, string values are encoded in full with
+  /// their sizes appended, see encodeNoNulls(StringView).
+  PrefixSortEncoder(
+      bool ascending,
+      bool nullsFirst,
+      bool encodeStringSize = false)
+      : ascending_(ascending),
+        nullsFirst_(nullsFirst),
+        encodeStringSize_(encodeStringSize){};
 
   /// Encode native primitive types(such as uint64_t, int64_t, uint32_t,
   /// int32_t, uint16_t, int16_t, float, double, Timestamp).
@@ -71,6 +78,10 @@ class PrefixSortEncoder {
     return nullsFirst_;
   }
 
+  bool encodeStringSize() const {
+    return encodeStringSize_;
+  }
+
   /// @return For supported types, returns the encoded size, assume nullable.
   ///         For not supported types, returns 'std::nullopt'.
   FOLLY_ALWAYS_INLINE static std::optional<uint32_t> encodedSize(
@@ -105,6 +116,7 @@ class PrefixSortEncoder {
  private:
   const bool ascending_;
   const bool nullsFirst_;
+  const bool encodeStringSize_;
 };
 
 /// Assuming that value is little-endian encoded, means:
@@ -281,12 +293,21 @@ FOLLY_ALWAYS_INLINE void PrefixSortEncoder::encodeNoNulls(
 /// The string prefix is formatted as 'null byte + string content + padding
 /// zeros'. If `!ascending_`, the bits for both the content and padding zeros
 /// need to be inverted.
+///
+/// If 'encodeStringSize_' is set, the caller guarantees that the whole string
+/// fits in 'encodeSize' minus 4 bytes, and the string size is appended as a
+/// big-endian uint32_t after the padding zeros. Two strings with the same
+/// padded content differ only by trailing zeros, and then the shorter one is
+/// smaller, so the padded content and the size together order the strings
+/// exactly and no fallback comparison is needed.
 template <>
 FOLLY_ALWAYS_INLINE void PrefixSortEncoder::encodeNoNulls(
     StringView value,
     char* dest,
     uint32_t encodeSize) const {
-  const uint32_t copySize = std::min<uint32_t>(value.size(), encodeSize);
+  const uint32_t prefixSize =
+      encodeStringSize_ ? encodeSize - sizeof(uint32_t) : encodeSize;
+  const uint32_t copySize = std::min<uint32_t>(value.size(), prefixSize);
   if (value.isInline() ||
       HashStringAllocator::headerOf(value.data())->size() >= value.size()) {
     // The string is inline or all in one piece out of line.
@@ -299,15 +320,20 @@ FOLLY_ALWAYS_INLINE void PrefixSortEncoder::encodeNoNulls(
     stream.ByteInputStream::readBytes(dest, copySize);
   }
 
-  if (value.size() < encodeSize) {
-    std::memset(dest + value.size(), 0, encodeSize - value.size());
+  if (value.size() < prefixSize) {
+    std::memset(dest + value.size(), 0, prefixSize - value.size());
   }
 
   if (!ascending_) {
-    for (auto i = 0; i < encodeSize; ++i) {
+    for (auto i = 0; i < prefixSize; ++i) {
       dest[i] = ~dest[i];
     }
   }
+
+  if (encodeStringSize_) {
+    VELOX_DCHECK_LE(value.size(), prefixSize);
+    encodeNoNulls<uint32_t>(value.size(), dest + prefixSize, sizeof(uint32_t));
+  }
 }
 
 } // namespace facebook::velox::exec::prefixsort
@@ -32,18 +32,31 @@ class PrefixSortAlgorithmBenchmark {
     rng_.seed(seed);
   }
 
-  void runQuickSort(std::vector<int64_t> vec) {
+  // Sorts 'vec' as entries of 'entrySize' bytes that are all key.
+  void runQuickSort(std::vector<int64_t> vec, uint32_t entrySize = 8) {
     char* start = (char*)vec.data();
-    uint32_t entrySize = sizeof(int64_t);
     auto swapBuffer = AlignedBuffer::allocate<char>(entrySize, pool_.get());
     auto sortRunner =
         prefixsort::PrefixSortRunner(entrySize, swapBuffer->asMutable<char>());
     sortRunner.quickSort(
-        start, start + entrySize * vec.size(), [&](char* a, char* b) {
-          return memcmp(a, b, 8);
+        start, start + sizeof(int64_t) * vec.size(), [&](char* a, char* b) {
+          return memcmp(a, b, entrySize);
         });
   }
 
+  void runRadixSort(std::vector<int64_t> vec, uint32_t entrySize = 8) {
+    char* start = (char*)vec.data();
+    std::vector<int64_t> scratch(vec.size());
+    auto swapBuffer = AlignedBuffer::allocate<char>(entrySize, pool_.get());
+    auto sortRunner =
+        prefixsort::PrefixSortRunner(entrySize, swapBuffer->asMutable<char>());
+    sortRunner.radixSort(
+        start,
+        start + sizeof(int64_t) * vec.size(),
+        entrySize,
+        (char*)scratch.data());
+  }
+
   std::vector<int64_t> generateTestVector(int32_t size) {
     std::vector<int64_t> randomTestVec(size);
     std::generate(randomTestVec.begin(), randomTestVec.end(), [&]() {
@@ -70,18 +83,66 @@ BENCHMARK(PrefixSort_algorithm_10k) {
   bm->runQuickSort(data10k);
 }
 
+BENCHMARK_RELATIVE(PrefixSort_radix_10k) {
+  bm->runRadixSort(data10k);
+}
+
 BENCHMARK(PrefixSort_algorithm_100k) {
   bm->runQuickSort(data100k);
 }
 
+BENCHMARK_RELATIVE(PrefixSort_radix_100k) {
+  bm->runRadixSort(data100k);
+}
+
 BENCHMARK(PrefixSort_algorithm_1000k) {
   bm->runQuickSort(data1000k);
 }
 
+BENCHMARK_RELATIVE(PrefixSort_radix_1000k) {
+  bm->runRadixSort(data1000k);
+}
+
 BENCHMARK(PrefixSort_algorithm_10000k) {
   bm->runQuickSort(data10000k);
 }
 
+BENCHMARK_RELATIVE(PrefixSort_radix_10000k) {
+  bm->runRadixSort(data10000k);
+}
+
+BENCHMARK(PrefixSort_algorithm_16B_10k) {
+  bm->runQuickSort(data10k, 16);
+}
+
+BENCHMARK_RELATIVE(PrefixSort_radix_16B_10k) {
+  bm->runRadixSort(data10k, 16);
+}
+
+BENCHMARK(PrefixSort_algorithm_16B_100k) {
+  bm->runQuickSort(data100k, 16);
+}
+
+BENCHMARK_RELATIVE(PrefixSort_radix_16B_100k) {
+  bm->runRadixSort(data100k, 16);
+}
+
+BENCHMARK(PrefixSort_algorithm_16B_1000k) {
+  bm->runQuickSort(data1000k, 16);
+}
+
+BENCHMARK_RELATIVE(PrefixSort_radix_16B_1000k) {
+  bm->runRadixSort(data1000k, 16);
+}
+
+BENCHMARK(PrefixSort_algorithm_16B_10000k) {
+  bm->runQuickSort(data10000k, 16);
+}
+
+BENCHMARK_RELATIVE(PrefixSort_radix_16B_10000k) {
+  bm->runRadixSort(data10000k, 16);
+}
+
 } // namespace
 
 int main(int argc, char** argv) {
@@ -431,6 +431,31 @@ TEST_F(PrefixEncoderTest, encodeString) {
   ASSERT_EQ(std::memcmp(encoded + 1, expectedDesc, kEncodeSize - 1), 0);
 }
 
+TEST_F(PrefixEncoderTest, encodeStringSize) {
+  constexpr uint32_t kEncodeSize = 12;
+  // Strings that differ only by trailing zeros and are equal after padding.
+  const std::vector<StringView> values = {
+      StringView(""),
+      StringView("a"),
+      StringView("a\0", 2),
+      StringView("a\0\0", 3),
+      StringView("ab")};
+  for (const bool ascending : {true, false}) {
+    SCOPED_TRACE(fmt::format("ascending: {}", ascending));
+    const PrefixSortEncoder encoder(ascending, true, true);
+    ASSERT_TRUE(encoder.encodeStringSize());
+    char left[kEncodeSize];
+    char right[kEncodeSize];
+    for (auto i = 0; i + 1 < values.size(); ++i) {
+      encoder.encodeNoNulls(values[i], left, kEncodeSize);
+      encoder.encodeNoNulls(values[i + 1], right, kEncodeSize);
+      const auto result = std::memcmp(left, right, kEncodeSize);
+      ASSERT_EQ(result < 0, ascending);
+      ASSERT_NE(result, 0);
+    }
+  }
+}
+
 TEST_F(PrefixEncoderTest, encodeWithColumnNoNulls) {
   {
     uint64_t ascExpected = 0x8877665544332211;
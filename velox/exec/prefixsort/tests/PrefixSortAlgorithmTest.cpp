@@ -55,6 +55,52 @@ class PrefixSortAlgorithmTest : public testing::Test,
     ASSERT_EQ(data1, data2);
   }
 
+  // Sorts entries of 'numKeyWords' key words followed by the entry index and
+  // checks that radixSort gives the same order as std::stable_sort. The keys
+  // only use the bits in 'keyMask' to get ties and bytes that are the same in
+  // all entries.
+  void testRadixSort(size_t size, uint32_t numKeyWords, uint64_t keyMask) {
+    const uint32_t numWords = numKeyWords + 1;
+    std::vector<uint64_t> data(size * numWords);
+    for (auto i = 0; i < size; ++i) {
+      for (auto j = 0; j < numKeyWords; ++j) {
+        data[i * numWords + j] = folly::Random::rand64() & keyMask;
+      }
+      data[i * numWords + numKeyWords] = i;
+    }
+
+    std::vector<std::vector<uint64_t>> expected;
+    for (auto i = 0; i < size; ++i) {
+      expected.emplace_back(
+          data.begin() + i * numWords, data.begin() + (i + 1) * numWords);
+    }
+    std::stable_sort(
+        expected.begin(), expected.end(), [&](const auto& a, const auto& b) {
+          return std::lexicographical_compare(
+              a.begin(),
+              a.begin() + numKeyWords,
+              b.begin(),
+              b.begin() + numKeyWords);
+        });
+
+    const uint32_t entrySize = numWords * sizeof(uint64_t);
+    std::vector<uint64_t> scratch(data.size());
+    auto swapBuffer = AlignedBuffer::allocate<char>(entrySize, pool());
+    PrefixSortRunner sortRunner(entrySize, swapBuffer->asMutable<char>());
+    char* start = (char*)data.data();
+    sortRunner.radixSort(
+        start,
+        start + entrySize * size,
+        numKeyWords * sizeof(uint64_t),
+        (char*)scratch.data());
+
+    for (auto i = 0; i < size; ++i) {
+      const std::vector<uint64_t> actual(
+          data.begin() + i * numWords, data.begin() + (i + 1) * numWords);
+      ASSERT_EQ(actual, expected[i]) << "at " << i;
+    }
+  }
+
  protected:
   static void SetUpTestCase() {
     memory::MemoryManager::testingSetInstance({});
@@ -70,6 +116,19 @@ TEST_F(PrefixSortAlgorithmTest, quickSort) {
   testQuickSort(PrefixSortRunner::kMediumSort + 1000);
 }
 
+TEST_F(PrefixSortAlgorithmTest, radixSort) {
+  for (const auto numKeyWords : {1, 2}) {
+    SCOPED_TRACE(fmt::format("numKeyWords {}", numKeyWords));
+    testRadixSort(0, numKeyWords, ~0ULL);
+    testRadixSort(1, numKeyWords, ~0ULL);
+    testRadixSort(1'000, numKeyWords, ~0ULL);
+    // Few distinct keys that differ only in some of the bytes.
+    testRadixSort(1'000, numKeyWords, 0xff0000000000000fULL);
+    // All keys equal.
+    testRadixSort(100, numKeyWords, 0);
+  }
+}
+
 TEST_F(PrefixSortAlgorithmTest, testingMedian3) {
   // Generate 3 elements randomly as input data.
   std::vector<int64_t> data1(3);
@@ -811,6 +811,52 @@ TEST_F(AggregationTest, rangeToDistinct) {
       " GROUP BY c0, c1, c2, c3, c4, c5");
 }
 
+// Batches whose rows all fall in one group are aggregated as a single group.
+TEST_F(AggregationTest, singleGroupBatches) {
+  std::vector<RowVectorPtr> batches;
+  for (auto i = 0; i < 10; ++i) {
+    batches.push_back(makeRowVector({
+        makeConstant<int32_t>(i % 3, 100),
+        makeFlatVector<StringView>(
+            100,
+            [&](auto /*row*/) { return StringView(i % 2 == 0 ? "a" : "b"); }),
+        makeFlatVector<int64_t>(
+            100, [&](auto row) { return row * i; }, nullEvery(7)),
+        makeFlatVector<bool>(100, [](auto row) { return row % 3 == 0; }),
+    }));
+  }
+  // A batch with several groups in between.
+  batches.push_back(makeRowVector({
+      makeFlatVector<int32_t>(100, [](auto row) { return row % 4; }),
+      makeFlatVector<StringView>(
+          100, [](auto row) { return StringView(row % 2 == 0 ? "a" : "c"); }),
+      makeFlatVector<int64_t>(100, [](auto row) { return row; }),
+      makeFlatVector<bool>(100, [](auto row) { return row % 2 == 0; }),
+  }));
+  createDuckDbTable(batches);
+
+  auto plan = PlanBuilder()
+                  .values(batches)
+                  .partialAggregation(
+                      {"c0", "c1"},
+                      {"sum(c2)", "count(c2)", "min(c2)", "max(c2)", "avg(c2)"})
+                  .intermediateAggregation()
+                  .finalAggregation()
+                  .planNode();
+  assertQuery(
+      plan,
+      "SELECT c0, c1, sum(c2), count(c2), min(c2), max(c2), avg(c2) "
+      "FROM tmp GROUP BY 1, 2");
+
+  plan = PlanBuilder()
+             .values(batches)
+             .singleAggregation({"c0", "c1"}, {"sum(c2)"}, {"c3"})
+             .planNode();
+  assertQuery(
+      plan,
+      "SELECT c0, c1, sum(c2) FILTER (WHERE c3) FROM tmp GROUP BY 1, 2");
+}
+
 TEST_F(AggregationTest, allKeyTypes) {
   // Covers different key types. Unlike the integer/string tests, the
   // hash table begins life in the generic mode, not array or
@@ -916,6 +962,228 @@ TEST_F(AggregationTest, partialAggregationMemoryLimit) {
           .customStats.count("flushRowCount"));
 }
 
+TEST_F(AggregationTest, partialAggregationClusteredFlush) {
+  // 10 batches sorted on c0 with 10 rows per key, so that keys span batch
+  // boundaries.
+  std::vector<RowVectorPtr> sortedVectors;
+  for (auto i = 0; i < 10; ++i) {
+    sortedVectors.push_back(makeRowVector({
+        makeFlatVector<int32_t>(
+            95, [&](auto row) { return (i * 95 + row) / 10; }),
+        makeFlatVector<int64_t>(95, [](auto row) { return row; }),
+    }));
+  }
+  // Batches with keys that are not clustered.
+  std::vector<RowVectorPtr> unsortedVectors;
+  for (auto i = 0; i < 10; ++i) {
+    unsortedVectors.push_back(makeRowVector({
+        makeFlatVector<int32_t>(95, [](auto row) { return row % 10; }),
+        makeFlatVector<int64_t>(95, [](auto row) { return row; }),
+    }));
+  }
+
+  for (const bool sorted : {true, false}) {
+    const auto& vectors = sorted ? sortedVectors : unsortedVectors;
+    SCOPED_TRACE(fmt::format("sorted: {}", sorted));
+    createDuckDbTable(vectors);
+    core::PlanNodeId aggNodeId;
+    auto task = AssertQueryBuilder(duckDbQueryRunner_)
+                    .config(
+                        QueryConfig::kPartialAggregationClusteredFlushEnabled,
+                        "true")
+                    .plan(PlanBuilder()
+                              .values(vectors)
+                              .partialAggregation(
+                                  {"c0"}, {"sum(c1)", "count(1)"})
+                              .capturePlanNodeId(aggNodeId)
+                              .finalAggregation()
+                              .planNode())
+                    .assertResults(
+                        "SELECT c0, sum(c1), count(1) FROM tmp GROUP BY 1");
+    const auto& stats = toPlanStats(task->taskStats()).at(aggNodeId);
+    if (sorted) {
+      // The first flush comes after 4 clustered batches, then one flush per
+      // batch.
+      ASSERT_EQ(stats.customStats.at("clusteredFlushTimes").sum, 7);
+    } else {
+      ASSERT_EQ(stats.customStats.count("clusteredFlushTimes"), 0);
+    }
+  }
+}
+
+TEST_F(AggregationTest, parallelOutput) {
+  auto vectors = makeVectors(rowType_, 100, 10);
+  createDuckDbTable(vectors);
+
+  struct {
+    std::vector<std::string> aggregates;
+    std::string duckDbAggregates;
+  } testSettings[] = {
+      // Fixed width results extracted in parallel.
+      {{"sum(c1)", "count(c2)", "avg(c3)", "max(c4)"},
+       "sum(c1), count(c2), avg(c3), max(c4)"},
+      // Varchar results are extracted on the driver thread.
+      {{"sum(c1)", "max(c6)"}, "sum(c1), max(c6)"},
+  };
+  for (const auto& testData : testSettings) {
+    SCOPED_TRACE(testData.duckDbAggregates);
+    core::PlanNodeId aggNodeId;
+    auto task =
+        AssertQueryBuilder(duckDbQueryRunner_)
+            .config(QueryConfig::kAggregationParallelOutputBatches, "4")
+            .config(QueryConfig::kPreferredOutputBatchRows, "10")
+            .plan(PlanBuilder()
+                      .values(vectors)
+                      .singleAggregation({"c0"}, testData.aggregates)
+                      .capturePlanNodeId(aggNodeId)
+                      .planNode())
+            .assertResults(fmt::format(
+                "SELECT c0, {} FROM tmp GROUP BY 1",
+                testData.duckDbAggregates));
+    const auto& stats = toPlanStats(task->taskStats()).at(aggNodeId);
+    ASSERT_GT(stats.outputVectors, 1);
+  }
+}
+
+TEST_F(AggregationTest, distinctAggregationRewrite) {
+  std::vector<RowVectorPtr> vectors;
+  for (auto i = 0; i < 5; ++i) {
+    vectors.push_back(makeRowVector({
+        makeFlatVector<int32_t>(100, [](auto row) { return row % 10; }),
+        makeFlatVector<int64_t>(
+            100, [&](auto row) { return (i + row) % 7; }, nullEvery(11)),
+        makeFlatVector<int64_t>(100, [](auto row) { return row; }),
+    }));
+  }
+  createDuckDbTable(vectors);
+
+  struct {
+    std::vector<std::string> aggregates;
+    std::string duckDbAggregates;
+    bool rewritten;
+  } testSettings[] = {
+      {{"count(distinct c1)", "sum(distinct c1)", "min(distinct c1)"},
+       "count(distinct c1), sum(distinct c1), min(distinct c1)",
+       true},
+      // Aggregates must be distinct over the same columns.
+      {{"count(distinct c1)", "count(distinct c2)"},
+       "count(distinct c1), count(distinct c2)",
+       false},
+      {{"count(distinct c1)", "sum(c2)"}, "count(distinct c1), sum(c2)", false},
+  };
+  for (const auto& testData : testSettings) {
+    SCOPED_TRACE(testData.duckDbAggregates);
+    core::PlanNodeId aggNodeId;
+    auto plan = PlanBuilder()
+                    .values(vectors)
+                    .singleAggregation({"c0"}, testData.aggregates)
+                    .capturePlanNodeId(aggNodeId)
+                    .planNode();
+    auto task =
+        AssertQueryBuilder(duckDbQueryRunner_)
+            .config(QueryConfig::kDistinctAggregationRewriteEnabled, "true")
+            .plan(plan)
+            .assertResults(fmt::format(
+                "SELECT c0, {} FROM tmp GROUP BY 1",
+                testData.duckDbAggregates));
+    const auto planStats = toPlanStats(task->taskStats());
+    ASSERT_EQ(planStats.at(aggNodeId).outputRows, 10);
+    ASSERT_EQ(
+        planStats.count(fmt::format("{}.distinct", aggNodeId)),
+        testData.rewritten ? 1 : 0);
+  }
+}
+
+TEST_F(AggregationTest, partialAggregationReprobe) {
+  // 3 batches of unique keys abandon partial aggregation on the second batch,
+  // then keys repeat.
+  std::vector<RowVectorPtr> vectors;
+  for (auto i = 0; i < 13; ++i) {
+    vectors.push_back(makeRowVector({
+        makeFlatVector<int32_t>(
+            100,
+            [&](auto row) { return i < 3 ? 1'000 + i * 100 + row : row % 5; }),
+        makeFlatVector<int64_t>(100, [](auto row) { return row; }),
+    }));
+  }
+  createDuckDbTable(vectors);
+
+  for (const int64_t reprobeRows : {0, 200}) {
+    SCOPED_TRACE(fmt::format("reprobeRows: {}", reprobeRows));
+    core::PlanNodeId aggNodeId;
+    auto task =
+        AssertQueryBuilder(duckDbQueryRunner_)
+            .config(QueryConfig::kAbandonPartialAggregationMinRows, "100")
+            .config(QueryConfig::kAbandonPartialAggregationMinPct, "50")
+            .config(
+                QueryConfig::kPartialAggregationReprobeRows,
+                std::to_string(reprobeRows))
+            .maxDrivers(1)
+            .plan(PlanBuilder()
+                      .values(vectors)
+                      .partialAggregation({"c0"}, {"sum(c1)"})
+                      .capturePlanNodeId(aggNodeId)
+                      .finalAggregation()
+                      .planNode())
+            .assertResults("SELECT c0, sum(c1) FROM tmp GROUP BY 1");
+    const auto& stats = toPlanStats(task->taskStats()).at(aggNodeId);
+    ASSERT_EQ(stats.customStats.at("abandonedPartialAggregation").sum, 1);
+    if (reprobeRows == 0) {
+      ASSERT_EQ(stats.customStats.count("resumedPartialAggregation"), 0);
+      ASSERT_EQ(stats.outputRows, 200 + 1'100);
+    } else {
+      // Resumes after the third and fourth batch passed through.
+      ASSERT_EQ(stats.customStats.at("resumedPartialAggregation").sum, 1);
+      ASSERT_EQ(stats.outputRows, 200 + 200 + 5);
+    }
+  }
+}
+
+TEST_F(AggregationTest, partialAggregationRuntimeFeedback) {
+  std::vector<RowVectorPtr> vectors;
+  for (auto i = 0; i < 5; ++i) {
+    vectors.push_back(makeRowVector({
+        makeFlatVector<int32_t>(100, [&](auto row) { return i * 100 + row; }),
+        makeFlatVector<int64_t>(100, [](auto row) { return row; }),
+    }));
+  }
+  createDuckDbTable(vectors);
+
+  core::PlanNodeId aggNodeId;
+  auto plan = PlanBuilder()
+                  .values(vectors)
+                  .partialAggregation({"c0"}, {"sum(c1)"})
+                  .capturePlanNodeId(aggNodeId)
+                  .finalAggregation()
+                  .planNode();
+  // The tasks of a query share the feedback.
+  auto queryCtx = core::QueryCtx::create(executor_.get());
+  auto runTask = [&]() {
+    auto task =
+        AssertQueryBuilder(plan, duckDbQueryRunner_)
+            .queryCtx(queryCtx)
+            .config(QueryConfig::kAbandonPartialAggregationMinRows, "100")
+            .config(QueryConfig::kAbandonPartialAggregationMinPct, "50")
+            .config(QueryConfig::kRuntimeFeedbackEnabled, "true")
+            .maxDrivers(1)
+            .assertResults("SELECT c0, sum(c1) FROM tmp GROUP BY 1");
+    return toPlanStats(task->taskStats()).at(aggNodeId);
+  };
+
+  const auto firstStats = runTask();
+  ASSERT_EQ(firstStats.customStats.at("abandonedPartialAggregation").sum, 1);
+  ASSERT_EQ(
+      firstStats.customStats.count("abandonedPartialAggregationFromFeedback"),
+      0);
+
+  const auto secondStats = runTask();
+  ASSERT_EQ(secondStats.customStats.count("abandonedPartialAggregation"), 0);
+  ASSERT_EQ(
+      secondStats.customStats.at("abandonedPartialAggregationFromFeedback").sum,
+      1);
+  ASSERT_EQ(secondStats.outputRows, 500);
+}
+
 TEST_F(AggregationTest, partialDistinctWithAbandon) {
   auto vectors = {
       // 1st batch will produce 100 distinct groups from 10 rows.
@@ -1998,6 +2266,17 @@ TEST_F(AggregationTest, spillingForAggrsWithSorting) {
              .planNode();
   testPlan(
       plan, "SELECT c0 % 7, array_agg(c1 ORDER BY c1) FROM tmp GROUP BY 1");
+
+  // A single group with all the input rows and a variable width input.
+  plan = PlanBuilder()
+             .values(vectors)
+             .project({"c0 % 1", "c6", "c1"})
+             .singleAggregation({"p0"}, {"array_agg(c6 ORDER BY c1, c6)"}, {})
+             .capturePlanNodeId(aggrNodeId)
+             .planNode();
+  testPlan(
+      plan,
+      "SELECT c0 % 1, array_agg(c6 ORDER BY c1, c6) FROM tmp GROUP BY 1");
 }
 
 TEST_F(AggregationTest, spillPrefixSortOptimization) {
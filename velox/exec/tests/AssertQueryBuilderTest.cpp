@@ -45,6 +45,19 @@ TEST_F(AssertQueryBuilderTest, serialExecution) {
       .assertResults("VALUES (1), (2), (3)");
 
   AssertQueryBuilder(plan).serialExecution(true).assertResults(data);
+
+  // Several pipelines run on the calling thread.
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto mergePlan =
+      PlanBuilder(planNodeIdGenerator)
+          .localMerge(
+              {"c0"},
+              {PlanBuilder(planNodeIdGenerator).values({data}).planNode(),
+               PlanBuilder(planNodeIdGenerator).values({data}).planNode()})
+          .planNode();
+  AssertQueryBuilder(mergePlan, duckDbQueryRunner_)
+      .serialExecution(true)
+      .assertResults("VALUES (1), (1), (2), (2), (3), (3)", {{0}});
 }
 
 TEST_F(AssertQueryBuilderTest, orderedResults) {
@@ -22,6 +22,7 @@
 #include "velox/common/testutil/TestValue.h"
 #include "velox/dwio/common/tests/utils/BatchMaker.h"
 #include "velox/exec/Cursor.h"
+#include "velox/exec/OperatorSampler.h"
 #include "velox/exec/PlanNodeStats.h"
 #include "velox/exec/Values.h"
 #include "velox/exec/tests/utils/ArbitratorTestUtil.h"
@@ -1056,6 +1057,59 @@ class BlockedNoFutureNodeFactory : public Operator::PlanNodeTranslator {
     return 1;
   }
 };
+
+// Passes its input through. Every other call to isBlocked() returns a future
+// that is already realized.
+class ReadyFutureOperator : public Operator {
+ public:
+  ReadyFutureOperator(
+      DriverCtx* ctx,
+      int32_t id,
+      const std::shared_ptr<const BlockedNoFutureNode>& node)
+      : Operator(ctx, node->outputType(), id, node->id(), "ReadyFuture") {}
+
+  bool needsInput() const override {
+    return !noMoreInput_ && !input_;
+  }
+
+  void addInput(RowVectorPtr input) override {
+    input_ = std::move(input);
+  }
+
+  RowVectorPtr getOutput() override {
+    return std::move(input_);
+  }
+
+  bool isFinished() override {
+    return noMoreInput_ && input_ == nullptr;
+  }
+
+  BlockingReason isBlocked(ContinueFuture* future) override {
+    if (++numIsBlocked_ % 2 == 0) {
+      return BlockingReason::kNotBlocked;
+    }
+    *future = folly::makeSemiFuture();
+    return BlockingReason::kWaitForConsumer;
+  }
+
+ private:
+  int32_t numIsBlocked_{0};
+};
+
+class ReadyFutureNodeFactory : public Operator::PlanNodeTranslator {
+ public:
+  std::unique_ptr<Operator> toOperator(
+      DriverCtx* ctx,
+      int32_t id,
+      const core::PlanNodePtr& node) override {
+    return std::make_unique<ReadyFutureOperator>(
+        ctx, id, std::dynamic_pointer_cast<const BlockedNoFutureNode>(node));
+  }
+
+  std::optional<uint32_t> maxDrivers(const core::PlanNodePtr& node) override {
+    return 1;
+  }
+};
 } // namespace
 
 // Use a node for which driver factory would throw on any driver beyond id 0.
@@ -1102,6 +1156,37 @@ TEST_F(DriverTest, blockedNoFuture) {
       "The operator BlockedNoFuture is blocked but blocking future is not valid");
 }
 
+TEST_F(DriverTest, continueOnReadyFuture) {
+  Operator::registerOperator(std::make_unique<ReadyFutureNodeFactory>());
+
+  std::vector<RowVectorPtr> batches;
+  for (auto i = 0; i < 10; ++i) {
+    batches.push_back(makeRowVector({makeFlatVector<int32_t>({1, 2, 3})}));
+  }
+  core::PlanNodeId nodeId;
+  auto plan = PlanBuilder()
+                  .values(batches)
+                  .addNode([](const core::PlanNodeId& id,
+                              const core::PlanNodePtr& input) {
+                    return std::make_shared<BlockedNoFutureNode>(id, input);
+                  })
+                  .capturePlanNodeId(nodeId)
+                  .planNode();
+  for (const bool enabled : {false, true}) {
+    SCOPED_TRACE(fmt::format("enabled: {}", enabled));
+    auto task = AssertQueryBuilder(plan)
+                    .config(
+                        core::QueryConfig::kDriverContinueOnReadyFutureEnabled,
+                        enabled ? "true" : "false")
+                    .assertResults(batches);
+    const auto planStats = toPlanStats(task->taskStats());
+    const auto& runtimeStats = planStats.at(nodeId).customStats;
+    ASSERT_EQ(
+        runtimeStats.count(Driver::kReadyFutureContinues) > 0, enabled);
+    ASSERT_EQ(runtimeStats.count("blockedWaitForConsumerTimes") > 0, !enabled);
+  }
+}
+
 TEST_F(DriverTest, nonVeloxOperatorException) {
   Operator::registerOperator(
       std::make_unique<ThrowNodeFactory>(std::numeric_limits<uint32_t>::max()));
@@ -1694,6 +1779,63 @@ TEST_F(OpCallStatusTest, basic) {
   waitForAllTasksToBeDeleted();
 };
 
+TEST_F(OpCallStatusTest, sampler) {
+  std::vector<RowVectorPtr> data{
+      makeRowVector({"c0"}, {makeFlatVector<int32_t>({1, 2, 3})})};
+  const int firstNodeId{17};
+  auto planNodeIdGenerator =
+      std::make_shared<core::PlanNodeIdGenerator>(firstNodeId);
+  auto fragment = PlanBuilder(planNodeIdGenerator).values(data).planFragment();
+  auto task = Task::create(
+      "t20",
+      fragment,
+      0,
+      core::QueryCtx::create(
+          driverExecutor_.get(),
+          core::QueryConfig{{}},
+          {},
+          cache::AsyncDataCache::getInstance(),
+          nullptr,
+          nullptr,
+          "sampledQuery"),
+      Task::ExecutionMode::kParallel,
+      [](RowVectorPtr /*unused*/, ContinueFuture* /*unused*/) {
+        return exec::BlockingReason::kNotBlocked;
+      });
+
+  OperatorSampler sampler;
+  std::atomic_bool sampled{false};
+  SCOPED_TESTVALUE_SET(
+      "facebook::velox::exec::Values::getOutput",
+      std::function<void(const exec::Values*)>([&](const exec::Values*) {
+        if (sampled.exchange(true)) {
+          return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        sampler.sample();
+      }));
+
+  task->start(1, 1);
+  ASSERT_TRUE(waitForTaskCompletion(task.get(), 600'000'000));
+  ASSERT_EQ(sampler.numSamples(), 1);
+  const auto samples = sampler.samples();
+  ASSERT_EQ(samples.count("sampledQuery"), 1);
+  const auto& querySamples = samples.at("sampledQuery");
+  ASSERT_EQ(querySamples.size(), 1);
+  ASSERT_EQ(
+      querySamples[0].opCall, fmt::format("Values.{}::getOutput", firstNodeId));
+  ASSERT_EQ(querySamples[0].count, 1);
+  ASSERT_NE(
+      sampler.toFlameString().find(
+          fmt::format("sampledQuery;Values.{}::getOutput", firstNodeId)),
+      std::string::npos);
+
+  sampler.clear();
+  ASSERT_TRUE(sampler.samples().empty());
+  task.reset();
+  waitForAllTasksToBeDeleted();
+}
+
 // This test verifies that TestSuspendedSection dtor won't throw with a
 // terminated task. Otherwise, it might cause server crash in production use
 // case.
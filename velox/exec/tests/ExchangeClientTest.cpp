@@ -287,6 +287,60 @@ TEST_P(ExchangeClientTest, flowControl) {
   client->close();
 }
 
+// Verifies that the sources are drained within the queue limit when the client
+// prioritizes the sources by their buffered bytes.
+TEST_P(ExchangeClientTest, prioritizeBufferedSources) {
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(10'000, [](auto row) { return row; }),
+  });
+
+  auto page = test::toSerializedPage(data, serdeKind_, bufferManager_, pool());
+
+  // Set limit at 3.5 pages.
+  auto client = std::make_shared<ExchangeClient>(
+      "prioritize.buffered.sources",
+      17,
+      page->size() * 3.5,
+      1,
+      kDefaultMinExchangeOutputBatchBytes,
+      pool(),
+      executor(),
+      true);
+
+  // Make 6 tasks with 1 to 6 pages each.
+  std::vector<std::shared_ptr<Task>> tasks;
+  int32_t numPages = 0;
+  for (auto i = 0; i < 6; ++i) {
+    auto taskId = fmt::format("local://t{}", i);
+    auto task = makeTask(taskId);
+
+    bufferManager_->initializeTask(
+        task, core::PartitionedOutputNode::Kind::kPartitioned, 100, 16);
+
+    for (auto j = 0; j <= i; ++j) {
+      enqueue(taskId, 17, data);
+      ++numPages;
+    }
+
+    tasks.push_back(task);
+    client->addRemoteTaskId(taskId);
+  }
+
+  fetchPages(1, *client, numPages);
+
+  const auto stats = client->stats();
+  EXPECT_LE(stats.at("peakBytes").sum, page->size() * 4);
+  EXPECT_EQ(numPages, stats.at("numReceivedPages").sum);
+  EXPECT_EQ(page->size(), stats.at("averageReceivedPageBytes").sum);
+
+  for (auto& task : tasks) {
+    task->requestCancel();
+    bufferManager_->removeTask(task->taskId());
+  }
+
+  client->close();
+}
+
 TEST_P(ExchangeClientTest, largeSinglePage) {
   auto data = {
       makeRowVector({makeFlatVector<int64_t>(10000, folly::identity)}),
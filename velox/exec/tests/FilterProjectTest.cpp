@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "velox/dwio/common/tests/utils/BatchMaker.h"
+#include "velox/exec/FilterProject.h"
 #include "velox/exec/PlanNodeStats.h"
 #include "velox/exec/tests/utils/AssertQueryBuilder.h"
 #include "velox/exec/tests/utils/OperatorTestBase.h"
@@ -300,6 +301,60 @@ TEST_F(FilterProjectTest, filterProjectFused) {
       "SELECT c0, c1, c0 %100 + c1 % 50, c0 % 100 FROM tmp WHERE c0 % 10 < 5");
 }
 
+TEST_F(FilterProjectTest, compaction) {
+  const vector_size_t size = 1'000;
+  auto valueAt = [](auto row) -> int64_t { return row; };
+  std::vector<RowVectorPtr> vectors;
+  std::vector<RowVectorPtr> lazyVectors;
+  for (int32_t i = 0; i < 5; ++i) {
+    vectors.push_back(makeRowVector({
+        makeFlatVector<int64_t>(size, valueAt),
+        makeFlatVector<int64_t>(size, valueAt, nullEvery(7)),
+        makeFlatVector<int64_t>(size, valueAt),
+    }));
+    lazyVectors.push_back(makeRowVector({
+        makeFlatVector<int64_t>(size, valueAt),
+        makeFlatVector<int64_t>(size, valueAt, nullEvery(7)),
+        vectorMaker_.lazyFlatVector<int64_t>(size, valueAt),
+    }));
+  }
+  createDuckDbTable(vectors);
+
+  auto test = [&](const std::string& filter, int64_t numCompactedBatches) {
+    SCOPED_TRACE(filter);
+    core::PlanNodeId projectId;
+    auto plan = PlanBuilder()
+                    .values(lazyVectors)
+                    .filter(filter)
+                    .project({"c0", "c1 + c2 AS e1"})
+                    .capturePlanNodeId(projectId)
+                    .planNode();
+    auto task =
+        AssertQueryBuilder(plan, duckDbQueryRunner_)
+            .config(core::QueryConfig::kFilterCompactionSelectivity, "0.5")
+            .assertResults("SELECT c0, c1 + c2 FROM tmp WHERE " + filter);
+    auto stats = toPlanStats(task->taskStats()).at(projectId).customStats;
+    if (numCompactedBatches == 0) {
+      ASSERT_EQ(stats.count(FilterProject::kNumCompactedBatches), 0);
+    } else {
+      ASSERT_EQ(
+          stats.at(FilterProject::kNumCompactedBatches).sum,
+          numCompactedBatches);
+    }
+  };
+
+  // 10% of the rows pass.
+  test("c0 % 10 = 0", 5);
+  // 90% of the rows pass.
+  test("c0 % 10 > 0", 0);
+
+  // A filter without projections.
+  auto plan = PlanBuilder().values(lazyVectors).filter("c2 < 10").planNode();
+  AssertQueryBuilder(plan, duckDbQueryRunner_)
+      .config(core::QueryConfig::kFilterCompactionSelectivity, "0.5")
+      .assertResults("SELECT * FROM tmp WHERE c2 < 10");
+}
+
 TEST_F(FilterProjectTest, projectAndIdentityOverLazy) {
   // Verify that a lazy column which is a part of both an identity projection
   // and a regular projection is loaded correctly. This is done by running a
@@ -312,6 +312,68 @@ TEST_F(GroupedExecutionTest, groupedExecutionWithOutputBuffer) {
   EXPECT_EQ(18, taskStats.pipelineStats[1].operatorStats[1].inputVectors);
 }
 
+TEST_F(GroupedExecutionTest, memoryBoundedSplitGroups) {
+  auto vectors = makeVectors(10, 1'000);
+  auto filePath = TempFilePath::create();
+  writeToFile(filePath->getPath(), vectors);
+
+  core::PlanNodeId tableScanNodeId;
+  auto planFragment =
+      PlanBuilder()
+          .tableScan(rowType_)
+          .capturePlanNodeId(tableScanNodeId)
+          .localPartitionRoundRobinRow()
+          .partitionedOutput({}, 1, {"c0", "c1", "c2", "c3", "c4", "c5"})
+          .planFragment();
+  planFragment.executionStrategy = core::ExecutionStrategy::kGrouped;
+  planFragment.groupedExecutionLeafNodeIds.emplace(tableScanNodeId);
+  planFragment.numSplitGroups = 10;
+  auto queryCtx = core::QueryCtx::create(
+      executor_.get(),
+      core::QueryConfig(
+          {{core::QueryConfig::kGroupedExecutionMemoryUsageRatio, "0.5"}}),
+      {},
+      cache::AsyncDataCache::getInstance(),
+      memory::memoryManager()->addRootPool("", 64 << 20));
+  auto task = exec::Task::create(
+      "0",
+      std::move(planFragment),
+      0,
+      std::move(queryCtx),
+      Task::ExecutionMode::kParallel);
+  // 3 drivers max and 2 concurrent split groups.
+  task->start(3, 2);
+
+  task->addSplit("0", makeHiveSplitWithGroup(filePath->getPath(), 8));
+  EXPECT_EQ(6, task->numRunningDrivers());
+
+  // Makes the running split group look like it uses more than half of the
+  // query memory, so that the next one does not start.
+  auto leafPool = task->pool()->addLeafChild("memoryBoundedSplitGroups");
+  constexpr int64_t kAllocationBytes = 24 << 20;
+  void* buffer = leafPool->allocate(kAllocationBytes);
+  task->addSplit("0", makeHiveSplitWithGroup(filePath->getPath(), 1));
+  EXPECT_EQ(6, task->numRunningDrivers());
+  EXPECT_GT(task->taskStats().numDeferredSplitGroups, 0);
+  leafPool->free(buffer, kAllocationBytes);
+
+  // The deferred split group starts when the running one finishes.
+  task->noMoreSplitsForGroup("0", 8);
+  waitForFinishedDrivers(task, 6);
+  EXPECT_EQ(6, task->numRunningDrivers());
+  EXPECT_EQ(std::unordered_set<int32_t>({8}), getCompletedSplitGroups(task));
+
+  task->noMoreSplitsForGroup("0", 1);
+  waitForFinishedDrivers(task, 12);
+  EXPECT_EQ(0, task->numRunningDrivers());
+  EXPECT_EQ(std::unordered_set<int32_t>({1, 8}), getCompletedSplitGroups(task));
+
+  task->noMoreSplits("0");
+  auto outputBufferManager = exec::OutputBufferManager::getInstance().lock();
+  outputBufferManager->deleteResults(task->taskId(), 0);
+  EXPECT_EQ(exec::TaskState::kFinished, task->state());
+}
+
 DEBUG_ONLY_TEST_F(
     GroupedExecutionTest,
     groupedExecutionWithHashJoinSpillCheck) {
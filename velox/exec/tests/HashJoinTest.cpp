@@ -222,6 +222,31 @@ DEBUG_ONLY_TEST_P(MultiThreadedHashJoinTest, parallelJoinBuildCheck) {
   ASSERT_EQ(numDrivers_ == 1, !isParallelBuild);
 }
 
+DEBUG_ONLY_TEST_P(MultiThreadedHashJoinTest, parallelJoinBuildWithSpill) {
+  std::atomic<int32_t> numParallelBuilds{0};
+  SCOPED_TESTVALUE_SET(
+      "facebook::velox::exec::HashTable::parallelJoinBuild",
+      std::function<void(void*)>([&](void*) { ++numParallelBuilds; }));
+  HashJoinBuilder(*pool_, duckDbQueryRunner_, driverExecutor_.get())
+      .numDrivers(numDrivers_)
+      .keyTypes({BIGINT(), VARCHAR()})
+      .probeVectors(1600, 5)
+      .buildVectors(1500, 5)
+      .referenceQuery(
+          "SELECT t_k0, t_k1, t_data, u_k0, u_k1, u_data FROM t, u WHERE t_k0 = u_k0 AND t_k1 = u_k1")
+      .config(core::QueryConfig::kMinTableRowsForParallelJoinBuild, "0")
+      .injectSpill(true)
+      .maxSpillLevel(2)
+      .verifier([&](const std::shared_ptr<Task>& /*task*/, bool injectSpill) {
+        if (injectSpill) {
+          // The tables built with spilled input are built in parallel too.
+          ASSERT_EQ(numDrivers_ == 1, numParallelBuilds == 0);
+        }
+        numParallelBuilds = 0;
+      })
+      .run();
+}
+
 DEBUG_ONLY_TEST_P(
     MultiThreadedHashJoinTest,
     raceBetweenTaskTerminateAndTableBuild) {
@@ -3374,6 +3399,68 @@ TEST_F(HashJoinTest, lazyVectors) {
   }
 }
 
+TEST_F(HashJoinTest, lazyKeyLoadedToValueHook) {
+  // The probe key is not projected, so it is read straight into the value id
+  // lookup of the table without being materialized.
+  auto probeVectors = makeBatches(3, [&](int32_t batch) {
+    return makeRowVector({
+        makeFlatVector<int32_t>(
+            1'000,
+            [batch](auto row) { return row + batch * 100; },
+            nullEvery(7)),
+        makeFlatVector<int64_t>(1'000, [](auto row) { return row % 23; }),
+    });
+  });
+  std::vector<RowVectorPtr> buildVectors = {makeRowVector({
+      makeFlatVector<int32_t>(500, [](auto row) { return row * 3; }),
+  })};
+
+  std::vector<std::shared_ptr<TempFilePath>> tempFiles;
+  for (const auto& probeVector : probeVectors) {
+    tempFiles.push_back(TempFilePath::create());
+    writeToFile(tempFiles.back()->getPath(), probeVector);
+  }
+  createDuckDbTable("t", probeVectors);
+  createDuckDbTable("u", buildVectors);
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  core::PlanNodeId probeScanId;
+  core::PlanNodeId joinNodeId;
+  auto plan = PlanBuilder(planNodeIdGenerator)
+                  .tableScan(ROW({"c0", "c1"}, {INTEGER(), BIGINT()}))
+                  .capturePlanNodeId(probeScanId)
+                  .hashJoin(
+                      {"c0"},
+                      {"u0"},
+                      PlanBuilder(planNodeIdGenerator)
+                          .values(buildVectors)
+                          .project({"c0 as u0"})
+                          .planNode(),
+                      "",
+                      {"c1"})
+                  .capturePlanNodeId(joinNodeId)
+                  .planNode();
+
+  SplitInput splits;
+  for (const auto& file : tempFiles) {
+    splits[probeScanId].push_back(
+        exec::Split(makeHiveConnectorSplit(file->getPath())));
+  }
+
+  HashJoinBuilder(*pool_, duckDbQueryRunner_, driverExecutor_.get())
+      .planNode(std::move(plan))
+      .inputSplits(splits)
+      .injectSpill(false)
+      .referenceQuery("SELECT t.c1 FROM t, u WHERE t.c0 = u.c0")
+      .verifier([&](const std::shared_ptr<Task>& task, bool /*unused*/) {
+        const auto& stats =
+            toPlanStats(task->taskStats()).at(joinNodeId).customStats;
+        ASSERT_EQ(stats.count("loadedToValueHook"), 1);
+        EXPECT_GT(stats.at("loadedToValueHook").sum, 0);
+      })
+      .run();
+}
+
 TEST_F(HashJoinTest, lazyVectorNotLoadedInFilter) {
   // Ensure that if lazy vectors are temporarily wrapped during a filter's
   // execution and remain unloaded, the temporary wrap is promptly
@@ -4609,6 +4696,274 @@ TEST_F(HashJoinTest, dynamicFiltersPushDownThroughAgg) {
       .run();
 }
 
+TEST_F(HashJoinTest, bloomFilterDynamicFilters) {
+  const int32_t numRowsProbe = 10'000;
+  // More distinct build keys than VectorHasher tracks, so there is no exact
+  // value filter for the join key.
+  const int32_t numRowsBuild = 2 * VectorHasher::kMaxDistinct;
+
+  std::vector<RowVectorPtr> probeVectors{makeRowVector({
+      makeFlatVector<int64_t>(numRowsProbe, folly::identity),
+      makeFlatVector<int64_t>(numRowsProbe, [](auto row) { return row * 2; }),
+  })};
+  std::shared_ptr<TempFilePath> probeFile = TempFilePath::create();
+  writeToFile(probeFile->getPath(), probeVectors);
+
+  // One in five probe rows has a match.
+  std::vector<RowVectorPtr> buildVectors;
+  for (int i = 0; i < 2; ++i) {
+    buildVectors.push_back(makeRowVector(
+        {"u0"}, {makeFlatVector<int64_t>(numRowsBuild / 2, [i](auto row) {
+          return 5 * (row + i * numRowsBuild / 2);
+        })}));
+  }
+
+  createDuckDbTable("t", probeVectors);
+  createDuckDbTable("u", buildVectors);
+
+  auto probeType = ROW({"c0", "c1"}, {BIGINT(), BIGINT()});
+  for (bool bloomFilterEnabled : {false, true}) {
+    SCOPED_TRACE(fmt::format("bloomFilterEnabled: {}", bloomFilterEnabled));
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    core::PlanNodeId scanNodeId;
+    core::PlanNodeId joinNodeId;
+    auto op = PlanBuilder(planNodeIdGenerator, pool_.get())
+                  .tableScan(probeType)
+                  .capturePlanNodeId(scanNodeId)
+                  .hashJoin(
+                      {"c0"},
+                      {"u0"},
+                      PlanBuilder(planNodeIdGenerator)
+                          .values(buildVectors)
+                          .planNode(),
+                      "",
+                      {"c0", "c1"},
+                      core::JoinType::kInner)
+                  .capturePlanNodeId(joinNodeId)
+                  .planNode();
+
+    SplitInput splitInput = {
+        {scanNodeId, {Split(makeHiveConnectorSplit(probeFile->getPath()))}}};
+    HashJoinBuilder(*pool_, duckDbQueryRunner_, driverExecutor_.get())
+        .planNode(std::move(op))
+        .inputSplits(splitInput)
+        .config(
+            core::QueryConfig::kHashJoinBloomFilterEnabled,
+            bloomFilterEnabled ? "true" : "false")
+        .injectSpill(false)
+        .checkSpillStats(false)
+        .referenceQuery("SELECT c0, c1 FROM t, u WHERE c0 = u0")
+        .verifier([&](const std::shared_ptr<Task>& task, bool /*hasSpill*/) {
+          if (!bloomFilterEnabled) {
+            ASSERT_EQ(0, getFiltersProduced(task, 1).sum);
+            ASSERT_EQ(getInputPositions(task, 1), numRowsProbe);
+            return;
+          }
+          ASSERT_EQ(1, getFiltersProduced(task, 1).sum);
+          ASSERT_EQ(1, getFiltersAccepted(task, 0).sum);
+          // The Bloom filter is not exact so the join is not replaced.
+          ASSERT_EQ(0, getReplacedWithFilterRows(task, 1).sum);
+          ASSERT_LT(getInputPositions(task, 1), numRowsProbe / 2);
+        })
+        .run();
+  }
+}
+
+TEST_F(HashJoinTest, lateMaterializedBuildColumns) {
+  const int32_t numRows = 1'000;
+  std::vector<RowVectorPtr> probeVectors;
+  std::vector<RowVectorPtr> buildVectors;
+  for (int32_t i = 0; i < 3; ++i) {
+    probeVectors.push_back(makeRowVector(
+        {"t0", "t1"},
+        {makeFlatVector<int64_t>(
+             numRows, [i](auto row) { return (row + i * numRows) % 1'500; }),
+         makeFlatVector<int64_t>(numRows, folly::identity)}));
+    buildVectors.push_back(makeRowVector(
+        {"u0", "u1", "u2"},
+        {makeFlatVector<int64_t>(
+             numRows / 2, [i](auto row) { return row + i * numRows / 2; }),
+         makeFlatVector<int64_t>(numRows / 2, [](auto row) { return row * 3; }),
+         makeFlatVector<StringView>(numRows / 2, [](auto row) {
+           return StringView::makeInline(fmt::format("{}", row % 11));
+         })}));
+  }
+  createDuckDbTable("t", probeVectors);
+  createDuckDbTable("u", buildVectors);
+
+  for (bool lateMaterialization : {false, true}) {
+    SCOPED_TRACE(fmt::format("lateMaterialization: {}", lateMaterialization));
+    const auto config = lateMaterialization ? "true" : "false";
+    // A selective filter on one build side column and an aggregation over
+    // another.
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    auto plan = PlanBuilder(planNodeIdGenerator)
+                    .values(probeVectors)
+                    .hashJoin(
+                        {"t0"},
+                        {"u0"},
+                        PlanBuilder(planNodeIdGenerator)
+                            .values(buildVectors)
+                            .planNode(),
+                        "",
+                        {"t1", "u1", "u2"})
+                    .filter("u2 = '7'")
+                    .project({"t1", "u1"})
+                    .planNode();
+    AssertQueryBuilder(plan, duckDbQueryRunner_)
+        .config(core::QueryConfig::kHashProbeLateMaterializationEnabled, config)
+        .assertResults(
+            "SELECT t1, u1 FROM t, u WHERE t0 = u0 AND u2 = '7'");
+
+    planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    plan = PlanBuilder(planNodeIdGenerator)
+               .values(probeVectors)
+               .hashJoin(
+                   {"t0"},
+                   {"u0"},
+                   PlanBuilder(planNodeIdGenerator)
+                       .values(buildVectors)
+                       .planNode(),
+                   "",
+                   {"t1", "u1"})
+               .singleAggregation({"t1"}, {"sum(u1)"})
+               .planNode();
+    AssertQueryBuilder(plan, duckDbQueryRunner_)
+        .config(core::QueryConfig::kHashProbeLateMaterializationEnabled, config)
+        .assertResults("SELECT t1, sum(u1) FROM t, u WHERE t0 = u0 GROUP BY 1");
+  }
+}
+
+TEST_F(HashJoinTest, hotKeyDetection) {
+  // Key 7 has half of the build rows. The other keys are unique.
+  const int32_t numRows = 10'000;
+  std::vector<RowVectorPtr> buildVectors;
+  for (int32_t i = 0; i < 4; ++i) {
+    buildVectors.push_back(makeRowVector(
+        {"u0", "u1"},
+        {makeFlatVector<int64_t>(
+             numRows,
+             [i](auto row) {
+               return row % 2 == 0 ? 7 : 100 + row + i * numRows;
+             }),
+         makeFlatVector<int64_t>(numRows, folly::identity)}));
+  }
+  const std::vector<RowVectorPtr> probeVectors{makeRowVector(
+      {"t0", "t1"},
+      {makeFlatVector<int64_t>(100, folly::identity),
+       makeFlatVector<int64_t>(100, folly::identity)})};
+  createDuckDbTable("t", probeVectors);
+  createDuckDbTable("u", buildVectors);
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  core::PlanNodeId joinId;
+  const auto plan =
+      PlanBuilder(planNodeIdGenerator)
+          .values(probeVectors)
+          .hashJoin(
+              {"t0"},
+              {"u0"},
+              PlanBuilder(planNodeIdGenerator).values(buildVectors).planNode(),
+              "",
+              {"t1", "u1"})
+          .capturePlanNodeId(joinId)
+          .planNode();
+
+  for (int32_t minPct : {0, 10, 60}) {
+    SCOPED_TRACE(fmt::format("minPct: {}", minPct));
+    auto task = AssertQueryBuilder(plan, duckDbQueryRunner_)
+                    .config(
+                        core::QueryConfig::kHashJoinHotKeyMinPct,
+                        std::to_string(minPct))
+                    .assertResults("SELECT t1, u1 FROM t, u WHERE t0 = u0");
+    const auto& stats = toPlanStats(task->taskStats()).at(joinId).customStats;
+    const auto it = stats.find(BaseHashTable::kNumHotKeys);
+    if (minPct == 0 || minPct == 60) {
+      ASSERT_EQ(it, stats.end());
+      continue;
+    }
+    ASSERT_NE(it, stats.end());
+    ASSERT_EQ(it->second.sum, 1);
+    ASSERT_GE(stats.at(BaseHashTable::kMaxHotKeyRows).sum, 2 * numRows);
+  }
+}
+
+TEST_F(HashJoinTest, hashTableCache) {
+  const int32_t numRows = 1'000;
+  std::vector<RowVectorPtr> probeVectors;
+  std::vector<RowVectorPtr> buildVectors;
+  for (int32_t i = 0; i < 3; ++i) {
+    probeVectors.push_back(makeRowVector(
+        {"t0", "t1"},
+        {makeFlatVector<int64_t>(
+             numRows, [i](auto row) { return (row + i * numRows) % 1'500; }),
+         makeFlatVector<int64_t>(numRows, folly::identity)}));
+    buildVectors.push_back(makeRowVector(
+        {"u0", "u1"},
+        {makeFlatVector<int64_t>(
+             numRows / 2, [i](auto row) { return row + i * numRows / 2; }),
+         makeFlatVector<int64_t>(
+             numRows / 2, [](auto row) { return row * 3; })}));
+  }
+  createDuckDbTable("t", probeVectors);
+  createDuckDbTable("u", buildVectors);
+
+  // Plans the same join with different plan node ids, as different stages of
+  // a query would.
+  const auto makePlan = [&](int32_t startId, core::PlanNodeId& joinId) {
+    auto planNodeIdGenerator =
+        std::make_shared<core::PlanNodeIdGenerator>(startId);
+    return PlanBuilder(planNodeIdGenerator)
+        .values(probeVectors)
+        .hashJoin(
+            {"t0"},
+            {"u0"},
+            PlanBuilder(planNodeIdGenerator).values(buildVectors).planNode(),
+            "",
+            {"t1", "u1"})
+        .capturePlanNodeId(joinId)
+        .planNode();
+  };
+  const auto numCacheHits = [](const std::shared_ptr<Task>& task,
+                               const core::PlanNodeId& joinId) {
+    const auto& stats = toPlanStats(task->taskStats()).at(joinId).customStats;
+    const auto it = stats.find(BaseHashTable::kNumCacheHits);
+    return it == stats.end() ? 0 : it->second.sum;
+  };
+
+  for (bool cacheEnabled : {false, true}) {
+    SCOPED_TRACE(fmt::format("cacheEnabled: {}", cacheEnabled));
+    auto queryCtx = core::QueryCtx::create(executor_.get());
+    core::PlanNodeId firstJoinId;
+    core::PlanNodeId secondJoinId;
+    const auto firstPlan = makePlan(0, firstJoinId);
+    const auto secondPlan = makePlan(10, secondJoinId);
+
+    auto task = AssertQueryBuilder(firstPlan, duckDbQueryRunner_)
+                    .queryCtx(queryCtx)
+                    .config(
+                        core::QueryConfig::kHashJoinTableCacheEnabled,
+                        cacheEnabled ? "true" : "false")
+                    .assertResults("SELECT t1, u1 FROM t, u WHERE t0 = u0");
+    ASSERT_EQ(numCacheHits(task, firstJoinId), 0);
+
+    task = AssertQueryBuilder(secondPlan, duckDbQueryRunner_)
+               .queryCtx(queryCtx)
+               .config(
+                   core::QueryConfig::kHashJoinTableCacheEnabled,
+                   cacheEnabled ? "true" : "false")
+               .assertResults("SELECT t1, u1 FROM t, u WHERE t0 = u0");
+    ASSERT_EQ(numCacheHits(task, secondJoinId), cacheEnabled ? 1 : 0);
+    task.reset();
+
+    auto cache = HashTableCache::getInstance(*queryCtx);
+    ASSERT_EQ(cache->numEntries(), cacheEnabled ? 1 : 0);
+    // The table is not used by any join anymore.
+    ASSERT_EQ(cache->evictUnused(), cacheEnabled ? 1 : 0);
+    ASSERT_EQ(cache->numEntries(), 0);
+  }
+}
+
 TEST_F(HashJoinTest, noDynamicFiltersPushDownThroughRightJoin) {
   std::vector<RowVectorPtr> innerBuild = {makeRowVector(
       {"a"},
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "velox/common/base/tests/GTestUtils.h"
 #include "velox/exec/HashPartitionFunction.h"
 #include "velox/exec/OperatorUtils.h"
 #include "velox/vector/tests/utils/VectorTestBase.h"
@@ -250,6 +251,82 @@ TEST_F(HashPartitionFunctionTest, spec) {
   }
 }
 
+TEST_F(HashPartitionFunctionTest, hotKeys) {
+  // Every other row has the hot key 7.
+  const int numRows = 1'000;
+  auto vector = makeRowVector({makeFlatVector<int64_t>(
+      numRows, [](auto row) { return row % 2 == 0 ? 7 : row; })});
+  auto rowType = asRowType(vector->type());
+
+  SelectivityVector rows(numRows);
+  raw_vector<uint64_t> hashes(numRows);
+  auto hasher = VectorHasher::create(BIGINT(), 0);
+  hasher->decode(*vector->childAt(0), rows);
+  hasher->hash(rows, false, hashes);
+  HotKeyPartitioning hotKeys{{hashes[0]}, 3, false};
+
+  const int numPartitions = 8;
+  std::vector<uint32_t> expected(numRows);
+  HashPartitionFunction plain(false, numPartitions, rowType, {0});
+  plain.partition(*vector, expected);
+  const auto hotPartition = expected[0];
+
+  std::vector<vector_size_t> extraRows;
+  std::vector<uint32_t> extraPartitions;
+
+  // The probe side sends the rows of the hot key round robin to 3 partitions.
+  {
+    std::vector<uint32_t> partitions(numRows);
+    HashPartitionFunction function(false, numPartitions, rowType, {0});
+    function.setHotKeys(hotKeys);
+    function.partition(*vector, partitions);
+    std::vector<int32_t> hotKeyCounts(numPartitions);
+    for (auto i = 0; i < numRows; ++i) {
+      if (i % 2 == 0) {
+        ++hotKeyCounts[partitions[i]];
+      } else {
+        ASSERT_EQ(partitions[i], expected[i]);
+      }
+    }
+    for (auto i = 0; i < 3; ++i) {
+      ASSERT_GE(hotKeyCounts[(hotPartition + i) % numPartitions], 166);
+    }
+    ASSERT_EQ(function.extraPartitions(extraRows, extraPartitions), 0);
+  }
+
+  // The build side replicates the rows of the hot key to the same partitions.
+  {
+    std::vector<uint32_t> partitions(numRows);
+    hotKeys.replicate = true;
+    HashPartitionFunction function(false, numPartitions, rowType, {0});
+    function.setHotKeys(hotKeys);
+    function.partition(*vector, partitions);
+    ASSERT_EQ(partitions, expected);
+    ASSERT_EQ(function.extraPartitions(extraRows, extraPartitions), numRows);
+    for (auto i = 0; i < extraRows.size(); ++i) {
+      ASSERT_EQ(extraRows[i] % 2, 0);
+      ASSERT_EQ(
+          extraPartitions[i], (hotPartition + 1 + i % 2) % numPartitions);
+    }
+  }
+
+  Type::registerSerDe();
+  core::ITypedExpr::registerSerDe();
+  auto hashSpec = std::make_unique<exec::HashPartitionFunctionSpec>(
+      rowType,
+      std::vector<column_index_t>{0},
+      std::vector<VectorPtr>{},
+      hotKeys);
+  ASSERT_EQ(
+      "HASH(c0) with 1 hot keys over 3 partitions", hashSpec->toString());
+  auto copy =
+      HashPartitionFunctionSpec::deserialize(hashSpec->serialize(), pool());
+  ASSERT_EQ(hashSpec->toString(), copy->toString());
+  VELOX_ASSERT_THROW(
+      hashSpec->create(numPartitions, true),
+      "Replicated hot keys are not supported in local exchange");
+}
+
 TEST_F(HashPartitionFunctionTest, noKeyAndBitRange) {
   for (bool localExchange : {false, true}) {
     SCOPED_TRACE(fmt::format("localExchange: {}", localExchange));
@@ -137,7 +137,13 @@ class HashTableTest : public testing::TestWithParam<bool>,
             buildType->childAt(channel), channel));
       }
       auto table = HashTable<true>::createForJoin(
-          std::move(keyHashers), dependentTypes, true, false, 1'000, pool());
+          std::move(keyHashers),
+          dependentTypes,
+          true,
+          false,
+          1'000,
+          pool(),
+          radixPartitionBytes_);
 
       makeRows(size, 1, sequence, buildType, batches);
       copyVectorsToTable(batches, startOffset, table.get());
@@ -456,6 +462,7 @@ class HashTableTest : public testing::TestWithParam<bool>,
 
   void testProbe() {
     auto lookup = std::make_unique<HashLookup>(topTable_->hashers());
+    lookup->prefetchDistance = prefetchDistance_;
     const auto batchSize = batches_[0]->size();
     SelectivityVector rows(batchSize);
     const auto mode = topTable_->hashMode();
@@ -510,6 +517,12 @@ class HashTableTest : public testing::TestWithParam<bool>,
         }
       }
     }
+    if (mode != BaseHashTable::HashMode::kArray) {
+      const auto& stats = lookup->probeStats;
+      ASSERT_GT(stats.numProbes, 0);
+      ASSERT_GE(stats.numBucketLoads, stats.numProbes);
+      ASSERT_GE(stats.numRowLoads, stats.numTagFalsePositives);
+    }
   }
 
   // Erases every strideth non-erased item in the hash table.
@@ -586,6 +599,11 @@ class HashTableTest : public testing::TestWithParam<bool>,
   // Spacing between consecutive generated keys. Affects whether
   // Vectorhashers make ranges or ids of distinct values.
   int64_t keySpacing_ = 1;
+  // Target radix partition size of the join table. 0 means no radix
+  // partitioning.
+  uint64_t radixPartitionBytes_ = 0;
+  // Value of HashLookup::prefetchDistance in testProbe().
+  int32_t prefetchDistance_ = 0;
   // Base string for varchar fields when making string vector.
   std::string baseString_;
   std::unique_ptr<folly::CPUThreadPoolExecutor> executor_;
@@ -640,6 +658,35 @@ TEST_P(HashTableTest, mixed6Sparse) {
   testCycle(BaseHashTable::HashMode::kHash, 100000, 9, type, 6);
 }
 
+TEST_P(HashTableTest, pipelinedProbe) {
+  auto type = ROW(
+      {"k1", "k2", "k3", "k4", "k5", "k6"},
+      {BIGINT(), BIGINT(), BIGINT(), BIGINT(), BIGINT(), VARCHAR()});
+  keySpacing_ = 1000;
+  prefetchDistance_ = 16;
+  testCycle(BaseHashTable::HashMode::kHash, 10000, 3, type, 6);
+}
+
+TEST_P(HashTableTest, radixPartitionedJoin) {
+  radixPartitionBytes_ = 4 << 10;
+  keySpacing_ = 1000;
+  {
+    auto type = ROW({"k1", "k2"}, {BIGINT(), BIGINT()});
+    testCycle(BaseHashTable::HashMode::kNormalizedKey, 100000, 1, type, 2);
+    ASSERT_GT(topTable_->numRadixPartitions(), 1);
+    ASSERT_LE(topTable_->numRadixPartitions(), 256);
+  }
+  batches_.clear();
+  rowOfKey_.clear();
+  topTable_.reset();
+  {
+    auto type = ROW(
+        {"key"}, {ROW({"k1", "k2", "k3"}, {BIGINT(), VARCHAR(), BIGINT()})});
+    testCycle(BaseHashTable::HashMode::kHash, 100000, 1, type, 1);
+    ASSERT_GT(topTable_->numRadixPartitions(), 1);
+  }
+}
+
 // It should be safe to call clear() before we insert any data into HashTable
 TEST_P(HashTableTest, clearBeforeInsert) {
   std::vector<std::unique_ptr<VectorHasher>> keyHashers;
@@ -699,6 +746,43 @@ TEST_P(HashTableTest, clearAfterInsert) {
 // Test a specific code path in HashTable::decodeHashMode where
 // rangesWithReserve overflows, distinctsWithReserve fits and bestWithReserve =
 // rangesWithReserve.
+TEST_P(HashTableTest, compact) {
+  constexpr int32_t kNumRows = 10'000;
+  const auto tableType = ROW({"k1", "k2"}, {BIGINT(), VARCHAR()});
+  auto table = createHashTableForAggregation(tableType, 2);
+  auto lookup = std::make_unique<HashLookup>(table->hashers());
+  std::vector<RowVectorPtr> batches;
+  makeRows(kNumRows, 1, 0, tableType, batches);
+  lookup->reset(kNumRows);
+  insertGroups(*batches[0], *lookup, *table);
+  ASSERT_EQ(table->numDistinct(), kNumRows);
+  std::vector<char*> inserted(lookup->hits.begin(), lookup->hits.end());
+
+  // Erases every other group.
+  std::vector<char*> erased;
+  for (auto i = 0; i < kNumRows; i += 2) {
+    erased.push_back(inserted[i]);
+  }
+  table->erase(folly::Range<char**>(erased.data(), erased.size()));
+  ASSERT_EQ(table->numDistinct(), kNumRows / 2);
+
+  const auto allocatedBytes = table->rows()->allocatedBytes();
+  ASSERT_GT(table->compact(), 0);
+  ASSERT_LT(table->rows()->allocatedBytes(), allocatedBytes);
+  ASSERT_EQ(table->numDistinct(), kNumRows / 2);
+  table->checkConsistency();
+
+  // The kept groups are found at their new locations and the erased ones are
+  // added again.
+  lookup->reset(kNumRows);
+  insertGroups(*batches[0], *lookup, *table);
+  ASSERT_EQ(table->numDistinct(), kNumRows);
+  ASSERT_EQ(table->rows()->numRows(), kNumRows);
+  std::unordered_set<char*> hits(lookup->hits.begin(), lookup->hits.end());
+  ASSERT_EQ(hits.size(), kNumRows);
+  table->checkConsistency();
+}
+
 TEST_P(HashTableTest, bestWithReserveOverflow) {
   auto rowType =
       ROW({"a", "b", "c", "d"}, {BIGINT(), BIGINT(), BIGINT(), BIGINT()});
@@ -855,6 +939,71 @@ TEST_P(HashTableTest, regularHashingTableSize) {
   }
 }
 
+TEST_P(HashTableTest, wideNormalizedKeyJoin) {
+  // Two keys with 200K distinct values, each spread over a range of about
+  // 2^40. Neither the ranges nor the value ids of both keys fit in 64 bits but
+  // each key fits in one word of a 128 bit normalized key.
+  constexpr int32_t kNumRows = 200'000;
+  constexpr int64_t kSpacing = 5'000'000;
+  auto build = makeRowVector({
+      makeFlatVector<int64_t>(
+          kNumRows, [&](auto row) { return row * kSpacing; }),
+      makeFlatVector<int64_t>(
+          kNumRows, [&](auto row) { return 7 + (kNumRows - row) * kSpacing; }),
+  });
+  // Odd rows miss the table in the second key.
+  auto probe = makeRowVector({
+      makeFlatVector<int64_t>(
+          kNumRows, [&](auto row) { return row * kSpacing; }),
+      makeFlatVector<int64_t>(
+          kNumRows,
+          [&](auto row) { return 7 + (kNumRows - row) * kSpacing + row % 2; }),
+  });
+
+  for (const bool wideNormalizedKeys : {false, true}) {
+    SCOPED_TRACE(fmt::format("wideNormalizedKeys {}", wideNormalizedKeys));
+    std::vector<std::unique_ptr<VectorHasher>> keyHashers;
+    std::vector<std::unique_ptr<VectorHasher>> probeHashers;
+    for (auto channel = 0; channel < 2; ++channel) {
+      keyHashers.push_back(std::make_unique<VectorHasher>(BIGINT(), channel));
+      probeHashers.push_back(std::make_unique<VectorHasher>(BIGINT(), channel));
+    }
+    auto table = HashTable<true>::createForJoin(
+        std::move(keyHashers),
+        {},
+        true,
+        false,
+        1'000,
+        pool(),
+        0,
+        wideNormalizedKeys);
+    copyVectorsToTable({build}, 0, table.get());
+    table->prepareJoinTable(
+        {}, BaseHashTable::kNoSpillInputStartPartitionBit, executor_.get());
+    ASSERT_EQ(
+        table->hashMode(),
+        wideNormalizedKeys ? BaseHashTable::HashMode::kNormalizedKey
+                           : BaseHashTable::HashMode::kHash);
+    ASSERT_EQ(table->hasWideNormalizedKeys(), wideNormalizedKeys);
+    ASSERT_EQ(table->numDistinct(), kNumRows);
+
+    HashLookup lookup(probeHashers);
+    SelectivityVector rows(kNumRows);
+    table->prepareForJoinProbe(lookup, probe, rows, true);
+    table->joinProbe(lookup);
+    int32_t numHits = 0;
+    for (auto row : lookup.rows) {
+      if (row % 2 == 0) {
+        ASSERT_EQ(lookup.hits[row], rowOfKey_[row]) << row;
+        ++numHits;
+      } else {
+        ASSERT_EQ(lookup.hits[row], nullptr) << row;
+      }
+    }
+    ASSERT_EQ(numHits, kNumRows / 2);
+  }
+}
+
 TEST_P(HashTableTest, listJoinResultsSize) {
   baseString_ =
       "If you count carefully, you will notice there are exactly 105 characters"
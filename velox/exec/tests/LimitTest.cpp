@@ -142,3 +142,35 @@ TEST_F(LimitTest, partialLimitEagerFlush) {
   test(true);
   test(false);
 }
+
+TEST_F(LimitTest, offsetSlicesNestedInput) {
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(100, [](auto row) { return row; }),
+      makeArrayVector<int64_t>(
+          100,
+          [](auto row) { return row % 5; },
+          [](auto row, auto index) { return row + index; }),
+      makeRowVector({makeMapVector<int64_t, int64_t>(
+          100,
+          [](auto row) { return row % 3; },
+          [](auto row) { return row; },
+          [](auto row) { return row * 2; })}),
+  });
+
+  CursorParameters params;
+  params.planNode =
+      PlanBuilder().values({data}).limit(10, 20, false).planNode();
+  auto [cursor, results] = readCursor(params, [](auto /*task*/) {});
+  ASSERT_EQ(results.size(), 1);
+
+  // The output shares the buffers of the input instead of wrapping it in
+  // dictionaries.
+  const auto& output = results[0];
+  ASSERT_EQ(output->childAt(0)->encoding(), VectorEncoding::Simple::FLAT);
+  ASSERT_EQ(output->childAt(1)->encoding(), VectorEncoding::Simple::ARRAY);
+  ASSERT_EQ(output->childAt(2)->encoding(), VectorEncoding::Simple::ROW);
+  ASSERT_EQ(
+      output->childAt(1)->as<ArrayVector>()->elements(),
+      data->childAt(1)->as<ArrayVector>()->elements());
+  velox::test::assertEqualVectors(data->slice(10, 20), output);
+}
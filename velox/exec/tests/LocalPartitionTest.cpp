@@ -928,6 +928,45 @@ TEST_F(
   thread.join();
 }
 
+TEST_F(LocalPartitionTest, skipProbeRepartitionForSmallBuild) {
+  std::vector<RowVectorPtr> probeVectors;
+  for (auto i = 0; i < 10; ++i) {
+    probeVectors.push_back(makeRowVector(
+        {"c0", "c1"},
+        {makeFlatSequence<int64_t>(i * 100, 1'000, 100),
+         makeFlatSequence<int64_t>(0, 100)}));
+  }
+  std::vector<RowVectorPtr> buildVectors = {makeRowVector(
+      {"u0", "u1"},
+      {makeFlatSequence<int64_t>(0, 10, 20),
+       makeFlatSequence<int64_t>(100, 20)})};
+  createDuckDbTable("t", probeVectors);
+  createDuckDbTable("u", buildVectors);
+
+  for (const auto maxBuildRows : {"0", "10", "100"}) {
+    SCOPED_TRACE(fmt::format("maxBuildRows: {}", maxBuildRows));
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    auto plan =
+        PlanBuilder(planNodeIdGenerator)
+            .localPartition(
+                {"c0"},
+                {PlanBuilder(planNodeIdGenerator).values(probeVectors).planNode()})
+            .hashJoin(
+                {"c0"},
+                {"u0"},
+                PlanBuilder(planNodeIdGenerator).values(buildVectors).planNode(),
+                "",
+                {"c0", "c1", "u1"})
+            .planNode();
+    AssertQueryBuilder(plan, duckDbQueryRunner_)
+        .maxDrivers(4)
+        .config(
+            core::QueryConfig::kHashJoinSkipProbeRepartitionMaxBuildRows,
+            maxBuildRows)
+        .assertResults("SELECT c0, c1, u1 FROM t, u WHERE c0 = u0");
+  }
+}
+
 TEST_F(LocalPartitionTest, vectorPool) {
   LocalExchangeVectorPool vectorPool(10);
   std::vector<RowVector*> vectors;
@@ -951,5 +990,57 @@ TEST_F(LocalPartitionTest, vectorPool) {
   ASSERT_FALSE(vectorPool.pop());
 }
 
+TEST_F(LocalPartitionTest, concurrentQueue) {
+  constexpr int32_t kNumProducers = 8;
+  constexpr int32_t kNumConsumers = 8;
+  constexpr int32_t kNumVectorsPerProducer = 1'000;
+  auto memoryManager = std::make_shared<LocalExchangeMemoryManager>(1'000);
+  auto queue = std::make_shared<LocalExchangeQueue>(
+      memoryManager, std::make_shared<LocalExchangeVectorPool>(0), 0);
+  for (auto i = 0; i < kNumProducers; ++i) {
+    queue->addProducer();
+  }
+  queue->noMoreProducers();
+  auto vector = makeRowVector({makeFlatVector<int64_t>({1})});
+
+  std::vector<std::thread> threads;
+  for (auto i = 0; i < kNumProducers; ++i) {
+    threads.emplace_back([&]() {
+      for (auto j = 0; j < kNumVectorsPerProducer; ++j) {
+        ContinueFuture future;
+        if (queue->enqueue(vector, 10, &future) !=
+            BlockingReason::kNotBlocked) {
+          future.wait();
+        }
+      }
+      queue->noMoreData();
+    });
+  }
+  std::atomic_int32_t numReceived{0};
+  for (auto i = 0; i < kNumConsumers; ++i) {
+    threads.emplace_back([&]() {
+      for (;;) {
+        ContinueFuture future;
+        RowVectorPtr data;
+        if (queue->next(&future, pool(), &data) !=
+            BlockingReason::kNotBlocked) {
+          future.wait();
+          continue;
+        }
+        if (data == nullptr) {
+          break;
+        }
+        ++numReceived;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(numReceived, kNumProducers * kNumVectorsPerProducer);
+  ASSERT_EQ(memoryManager->bufferedBytes(), 0);
+  ASSERT_TRUE(queue->isFinished());
+}
+
 } // namespace
 } // namespace facebook::velox::exec::test
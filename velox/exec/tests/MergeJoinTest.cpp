@@ -16,9 +16,12 @@
 
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/common/testutil/TestValue.h"
+#include "velox/exec/PlanNodeStats.h"
+#include "velox/exec/Spill.h"
 #include "velox/exec/tests/utils/AssertQueryBuilder.h"
 #include "velox/exec/tests/utils/HiveConnectorTestBase.h"
 #include "velox/exec/tests/utils/PlanBuilder.h"
+#include "velox/exec/tests/utils/TempDirectoryPath.h"
 
 #include "folly/experimental/EventCount.h"
 
@@ -1221,6 +1224,68 @@ TEST_F(MergeJoinTest, fullOuterJoinWithNullCompare) {
           "SELECT t0, t1, u0, u1 FROM t FULL OUTER JOIN u ON t.t0 = u.u0 and t1 = u1");
 }
 
+TEST_F(MergeJoinTest, spillRightMatch) {
+  // 10 keys with 3 rows each on the left.
+  auto left = makeRowVector(
+      {"t0", "t1"},
+      {makeFlatVector<int32_t>(30, [](auto row) { return row / 3; }),
+       makeFlatVector<int32_t>(30, [](auto row) { return row; })});
+
+  // A run of 200 rows with key 5 that spans 20 batches on the right.
+  std::vector<RowVectorPtr> right;
+  right.push_back(makeRowVector(
+      {"u0", "u1"},
+      {makeFlatVector<int32_t>({1, 3, 5}), makeFlatVector<int32_t>(3, 0)}));
+  for (auto i = 0; i < 20; ++i) {
+    right.push_back(makeRowVector(
+        {"u0", "u1"},
+        {makeConstant<int32_t>(5, 10),
+         makeFlatVector<int32_t>(10, [i](auto row) { return i * 10 + row; })}));
+  }
+  right.push_back(makeRowVector(
+      {"u0", "u1"},
+      {makeFlatVector<int32_t>({5, 7}), makeFlatVector<int32_t>(2, 0)}));
+
+  createDuckDbTable("t", {left});
+  createDuckDbTable("u", right);
+
+  for (auto joinType : {core::JoinType::kInner, core::JoinType::kLeft}) {
+    SCOPED_TRACE(core::joinTypeName(joinType));
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    core::PlanNodeId mergeJoinId;
+    auto rightPlan = PlanBuilder(planNodeIdGenerator).values(right).planNode();
+    auto plan = PlanBuilder(planNodeIdGenerator)
+                    .values({left})
+                    .mergeJoin(
+                        {"t0"},
+                        {"u0"},
+                        rightPlan,
+                        "",
+                        {"t0", "t1", "u1"},
+                        joinType)
+                    .capturePlanNodeId(mergeJoinId)
+                    .planNode();
+    const auto sql = fmt::format(
+        "SELECT t0, t1, u1 FROM t {} JOIN u ON t0 = u0",
+        joinType == core::JoinType::kInner ? "INNER" : "LEFT");
+
+    auto spillDirectory = exec::test::TempDirectoryPath::create();
+    TestScopedSpillInjection scopedSpillInjection(100);
+    auto task = AssertQueryBuilder(plan, duckDbQueryRunner_)
+                    .config(core::QueryConfig::kPreferredOutputBatchRows, "16")
+                    .config(core::QueryConfig::kSpillEnabled, "true")
+                    .config(core::QueryConfig::kMergeJoinSpillEnabled, "true")
+                    .spillDirectory(spillDirectory->getPath())
+                    .assertResults(sql);
+
+    auto taskStats = exec::toPlanStats(task->taskStats());
+    const auto& stats = taskStats.at(mergeJoinId);
+    ASSERT_GT(stats.spilledBytes, 0);
+    ASSERT_GT(stats.spilledRows, 0);
+    ASSERT_GT(stats.spilledFiles, 0);
+  }
+}
+
 TEST_F(MergeJoinTest, complexTypedFilter) {
   constexpr vector_size_t size{1000};
 
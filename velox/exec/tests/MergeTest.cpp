@@ -183,3 +183,43 @@ TEST_F(MergeTest, offByOne) {
       {{core::QueryConfig::kPreferredOutputBatchRows, "6"}});
   assertQueryOrdered(params, "VALUES (0), (1), (2), (3), (4), (5), (10)", {0});
 }
+
+/// Verifies merging sources whose rows interleave in long runs spread across
+/// several input and output batches.
+TEST_F(MergeTest, runs) {
+  // Source i has runs [100 * (3 * k + i), 100 * (3 * k + i) + 100) for k in
+  // [0, 10), in 7 batches.
+  const int32_t numSources = 3;
+  std::vector<std::shared_ptr<const core::PlanNode>> sources;
+  std::vector<RowVectorPtr> allVectors;
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  for (auto i = 0; i < numSources; ++i) {
+    auto data = makeRowVector({
+        makeFlatVector<int64_t>(
+            1'000,
+            [&](auto row) {
+              return 100 * (numSources * (row / 100) + i) + row % 100;
+            }),
+        makeFlatVector<int32_t>(1'000, [&](auto /*row*/) { return i; }),
+    });
+    allVectors.push_back(data);
+    sources.push_back(PlanBuilder(planNodeIdGenerator)
+                          .values(split(data, 7))
+                          .planNode());
+  }
+  createDuckDbTable(allVectors);
+
+  auto plan = PlanBuilder(planNodeIdGenerator)
+                  .localMerge({"c0"}, std::move(sources))
+                  .planNode();
+
+  for (const auto& outputBatchRows : {"1", "64", "1000"}) {
+    SCOPED_TRACE(fmt::format("outputBatchRows: {}", outputBatchRows));
+    CursorParameters params;
+    params.planNode = plan;
+    params.queryCtx = core::QueryCtx::create(executor_.get());
+    params.queryCtx->testingOverrideConfigUnsafe(
+        {{core::QueryConfig::kPreferredOutputBatchRows, outputBatchRows}});
+    assertQueryOrdered(params, "SELECT * FROM tmp ORDER BY c0", {0});
+  }
+}
@@ -399,6 +399,73 @@ TEST_P(MultiFragmentTest, aggregationMultiKey) {
   }
 }
 
+TEST_P(MultiFragmentTest, partialAggregationLocalMerge) {
+  setupSources(10, 1'000);
+  configSettings_[core::QueryConfig::kPartialAggregationLocalMergeEnabled] =
+      "true";
+  auto leafTaskId = makeTaskId("leaf", 0);
+  core::PlanNodeId partialAggNodeId;
+  core::PlanNodeId partitionNodeId;
+  auto partialAggPlan =
+      PlanBuilder()
+          .tableScan(rowType_)
+          .project({"c0 % 10 AS c0", "c1 % 2 AS c1", "c2"})
+          .partialAggregation({"c0", "c1"}, {"sum(c2)", "avg(c2)"})
+          .capturePlanNodeId(partialAggNodeId)
+          .partitionedOutput(
+              {"c0", "c1"}, 3, /*outputLayout=*/{}, GetParam().serdeKind)
+          .capturePlanNodeId(partitionNodeId)
+          .planNode();
+  auto leafTask = makeTask(leafTaskId, partialAggPlan, 0);
+  leafTask->start(4);
+  addHiveSplits(leafTask, filePaths_);
+
+  std::vector<std::shared_ptr<Task>> finalTasks;
+  core::PlanNodePtr finalAggPlan;
+  std::vector<std::string> finalAggTaskIds;
+  for (int i = 0; i < 3; i++) {
+    finalAggPlan =
+        PlanBuilder()
+            .exchange(partialAggPlan->outputType(), GetParam().serdeKind)
+            .finalAggregation(
+                {"c0", "c1"}, {"sum(a0)", "avg(a1)"}, {{BIGINT()}, {BIGINT()}})
+            .partitionedOutput({}, 1, /*outputLayout=*/{}, GetParam().serdeKind)
+            .planNode();
+
+    finalAggTaskIds.push_back(makeTaskId("final-agg", i));
+    auto task = makeTask(finalAggTaskIds.back(), finalAggPlan, i);
+    finalTasks.push_back(task);
+    task->start(1);
+    addRemoteSplits(task, {leafTaskId});
+  }
+
+  auto op = PlanBuilder()
+                .exchange(finalAggPlan->outputType(), GetParam().serdeKind)
+                .planNode();
+  std::vector<Split> finalAggTaskSplits;
+  for (auto finalAggTaskId : finalAggTaskIds) {
+    finalAggTaskSplits.emplace_back(remoteSplit(finalAggTaskId));
+  }
+  test::AssertQueryBuilder(op, duckDbQueryRunner_)
+      .splits(std::move(finalAggTaskSplits))
+      .assertResults(
+          "SELECT c0 % 10, c1 % 2, sum(c2), avg(c2) FROM tmp GROUP BY 1, 2");
+
+  ASSERT_TRUE(waitForTaskCompletion(leafTask.get())) << leafTask->taskId();
+  for (auto& task : finalTasks) {
+    ASSERT_TRUE(waitForTaskCompletion(task.get())) << task->taskId();
+  }
+
+  // The partial results of the 4 drivers are merged, so that each of the 20
+  // groups is shuffled once.
+  auto leafPlanStats = toPlanStats(leafTask->taskStats());
+  const auto& mergeStats = leafPlanStats.at(partialAggNodeId + ".merge");
+  ASSERT_EQ(
+      mergeStats.inputRows, leafPlanStats.at(partialAggNodeId).outputRows);
+  ASSERT_EQ(mergeStats.outputRows, 20);
+  ASSERT_EQ(leafPlanStats.at(partitionNodeId).inputRows, 20);
+}
+
 TEST_P(MultiFragmentTest, distributedTableScan) {
   setupSources(10, 1000);
   // Run the table scan several times to test the caching.
@@ -2663,6 +2730,138 @@ TEST_P(MultiFragmentTest, mergeSmallBatchesInExchange) {
   }
 }
 
+TEST_P(MultiFragmentTest, adaptiveBatchSizeInExchange) {
+  auto data = makeRowVector({makeFlatVector<int32_t>({1, 2, 3})});
+
+  const int32_t numPartitions = 100;
+  auto producerPlan = test::PlanBuilder()
+                          .values({data})
+                          .partitionedOutput(
+                              {"c0"},
+                              numPartitions,
+                              /*outputLayout=*/{},
+                              GetParam().serdeKind)
+                          .planNode();
+  const auto producerTaskId = "local://t1";
+
+  auto plan = test::PlanBuilder()
+                  .exchange(asRowType(data->type()), GetParam().serdeKind)
+                  .planNode();
+
+  auto expected = makeRowVector({
+      makeFlatVector<int32_t>(3'000, [](auto row) { return 1 + row % 3; }),
+  });
+
+  // Returns the number of output batches of the exchange.
+  auto test = [&](bool adaptiveBatchSize) {
+    auto producerTask = makeTask(producerTaskId, producerPlan);
+
+    bufferManager_->initializeTask(
+        producerTask,
+        core::PartitionedOutputNode::Kind::kPartitioned,
+        numPartitions,
+        1);
+
+    auto cleanupGuard = folly::makeGuard([&]() {
+      producerTask->requestCancel();
+      bufferManager_->removeTask(producerTaskId);
+    });
+
+    for (auto i = 0; i < 1'000; ++i) {
+      enqueue(producerTaskId, 17, data);
+    }
+    bufferManager_->noMoreData(producerTaskId);
+
+    auto task =
+        test::AssertQueryBuilder(plan)
+            .split(remoteSplit(producerTaskId))
+            .destination(17)
+            .config(core::QueryConfig::kPreferredOutputBatchBytes, "10000")
+            .config(
+                core::QueryConfig::kExchangeAdaptiveBatchSizeEnabled,
+                adaptiveBatchSize ? "true" : "false")
+            .assertResults(expected);
+
+    auto taskStats = exec::toPlanStats(task->taskStats());
+    return taskStats.at("0").outputVectors;
+  };
+
+  // The tiny pages deserialize into fewer bytes than they are serialized in,
+  // so the adaptive exchange coalesces more of them into each batch.
+  ASSERT_LT(test(true), test(false));
+}
+
+TEST_P(MultiFragmentTest, streamingDeserializationInExchange) {
+  if (GetParam().serdeKind != VectorSerde::Kind::kPresto) {
+    // Only the Presto serde deserializes one serialized page at a time.
+    return;
+  }
+  auto data = makeRowVector(
+      {makeFlatVector<int64_t>(10'000, [](auto row) { return row; })});
+
+  auto producerPlan = test::PlanBuilder()
+                          .values({data})
+                          .partitionedOutput(
+                              {}, 1, /*outputLayout=*/{}, GetParam().serdeKind)
+                          .planNode();
+  const auto producerTaskId = "local://t1";
+
+  auto plan = test::PlanBuilder()
+                  .exchange(asRowType(data->type()), GetParam().serdeKind)
+                  .planNode();
+
+  const int32_t numPages = 10;
+  std::vector<RowVectorPtr> expected(numPages, data);
+
+  // Returns the number of output batches of the exchange.
+  auto test = [&](bool streaming) {
+    auto producerTask = makeTask(producerTaskId, producerPlan);
+    bufferManager_->initializeTask(
+        producerTask, core::PartitionedOutputNode::Kind::kPartitioned, 1, 1);
+
+    auto cleanupGuard = folly::makeGuard([&]() {
+      producerTask->requestCancel();
+      bufferManager_->removeTask(producerTaskId);
+    });
+
+    // Sends all the serialized pages in one page.
+    std::unique_ptr<folly::IOBuf> pages;
+    for (auto i = 0; i < numPages; ++i) {
+      auto iobuf =
+          toSerializedPage(data, GetParam().serdeKind, bufferManager_, pool())
+              ->getIOBuf();
+      if (pages == nullptr) {
+        pages = std::move(iobuf);
+      } else {
+        pages->appendToChain(std::move(iobuf));
+      }
+    }
+    ContinueFuture unused;
+    bufferManager_->enqueue(
+        producerTaskId,
+        0,
+        std::make_unique<SerializedPage>(std::move(pages)),
+        &unused);
+    bufferManager_->noMoreData(producerTaskId);
+
+    auto task =
+        test::AssertQueryBuilder(plan)
+            .split(remoteSplit(producerTaskId))
+            .destination(0)
+            .config(core::QueryConfig::kPreferredOutputBatchBytes, "50000")
+            .config(
+                core::QueryConfig::kExchangeStreamingDeserializationEnabled,
+                streaming ? "true" : "false")
+            .assertResults(expected);
+
+    auto taskStats = exec::toPlanStats(task->taskStats());
+    return taskStats.at("0").outputVectors;
+  };
+
+  ASSERT_EQ(test(false), 1);
+  ASSERT_EQ(test(true), numPages);
+}
+
 TEST_P(MultiFragmentTest, compression) {
   constexpr int32_t kNumRepeats = 1'000'000;
   const auto data = makeRowVector({makeFlatVector<int64_t>({1, 2, 3})});
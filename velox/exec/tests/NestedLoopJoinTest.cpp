@@ -91,7 +91,9 @@ class NestedLoopJoinTest : public HiveConnectorTestBase {
     params.queryCtx = queryCtx;
     params.queryCtx->testingOverrideConfigUnsafe(
         {{core::QueryConfig::kPreferredOutputBatchRows,
-          std::to_string(preferredOutputBatchSize)}});
+          std::to_string(preferredOutputBatchSize)},
+         {core::QueryConfig::kNestedLoopJoinFilterBlockRows,
+          std::to_string(filterBlockRows_)}});
     params.maxDrivers = numDrivers;
     auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
 
@@ -138,6 +140,7 @@ class NestedLoopJoinTest : public HiveConnectorTestBase {
       core::JoinType::kFull,
   };
   std::vector<std::string> outputLayout_{probeKeyName_, buildKeyName_};
+  int32_t filterBlockRows_{0};
   std::string joinConditionStr_{probeKeyName_ + " {} " + buildKeyName_};
   std::string queryStr_{fmt::format(
       "SELECT {0}, {1} FROM t {{}} JOIN u ON t.{0} {{}} u.{1}",
@@ -223,6 +226,36 @@ TEST_F(NestedLoopJoinTest, emptyProbe) {
   runSingleAndMultiDriverTest(probeVectors, buildVectors);
 }
 
+TEST_F(NestedLoopJoinTest, blockedFilter) {
+  auto probeVectors = makeBatches(20, 5, probeType_, pool_.get());
+  auto buildVectors = makeBatches(18, 5, buildType_, pool_.get());
+  for (const auto blockRows : {1, 16, 1'000}) {
+    SCOPED_TRACE(fmt::format("blockRows: {}", blockRows));
+    filterBlockRows_ = blockRows;
+    runSingleAndMultiDriverTest(probeVectors, buildVectors);
+  }
+
+  // Range join over several build vectors.
+  probeVectors = makeBatches(5, [&](int32_t batch) {
+    return makeRowVector(
+        {"t0"}, {makeFlatVector<int64_t>(50, [&](auto row) {
+          return batch * 50 + row;
+        })});
+  });
+  buildVectors = makeBatches(3, [&](int32_t batch) {
+    return makeRowVector(
+        {"u0", "u1"},
+        {makeFlatVector<int64_t>(7, [&](auto row) { return batch * 70 + row; }),
+         makeFlatVector<int64_t>(
+             7, [&](auto row) { return batch * 70 + row * 3; })});
+  });
+  setComparisons({"BETWEEN"});
+  setJoinConditionStr("t0 {} u0 AND u1");
+  setQueryStr("SELECT t0, u0 FROM t {} JOIN u ON t0 {} u0 AND u1");
+  filterBlockRows_ = 20;
+  runSingleAndMultiDriverTest(probeVectors, buildVectors);
+}
+
 TEST_F(NestedLoopJoinTest, emptyBuild) {
   auto probeVectors = makeBatches(20, 5, probeType_, pool_.get());
   auto buildVectors = makeBatches(0, 5, buildType_, pool_.get());
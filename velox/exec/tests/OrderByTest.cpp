@@ -480,6 +480,43 @@ TEST_F(OrderByTest, outputBatchRows) {
   }
 }
 
+TEST_F(OrderByTest, parallelSort) {
+  std::vector<RowVectorPtr> vectors;
+  for (int32_t i = 0; i < 8; ++i) {
+    vectors.push_back(makeRowVector({
+        makeFlatVector<int64_t>(
+            1'000,
+            [&](auto row) { return (row * 7 + i * 13) % 997; },
+            nullEvery(17)),
+        makeFlatVector<int32_t>(1'000, [&](auto row) { return row + i; }),
+    }));
+  }
+  createDuckDbTable(vectors);
+
+  core::PlanNodeId orderById;
+  auto plan = PlanBuilder()
+                  .values(vectors, /*parallelizable=*/true)
+                  .localPartition(std::vector<std::string>{})
+                  .orderBy({"c0 DESC NULLS FIRST", "c1"}, false)
+                  .capturePlanNodeId(orderById)
+                  .planNode();
+  for (const bool parallelSort : {false, true}) {
+    SCOPED_TRACE(fmt::format("parallelSort {}", parallelSort));
+    auto task = AssertQueryBuilder(plan, duckDbQueryRunner_)
+                    .config(
+                        core::QueryConfig::kOrderByParallelSortEnabled,
+                        parallelSort)
+                    .maxDrivers(4)
+                    .assertResults(
+                        "SELECT * FROM tmp ORDER BY c0 DESC NULLS FIRST, c1",
+                        {{0, 1}});
+    const auto planStats = toPlanStats(task->taskStats());
+    ASSERT_EQ(planStats.at(orderById).inputRows, 8'000);
+    ASSERT_EQ(planStats.at(orderById).numDrivers, parallelSort ? 4 : 1);
+    ASSERT_EQ(planStats.count(orderById + ".merge"), parallelSort ? 1 : 0);
+  }
+}
+
 TEST_F(OrderByTest, spill) {
   const auto rowType =
       ROW({"c0", "c1", "c2"}, {INTEGER(), INTEGER(), VARCHAR()});
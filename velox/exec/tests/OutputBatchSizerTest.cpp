@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/OutputBatchSizer.h"
+
+#include <gtest/gtest.h>
+
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+namespace facebook::velox::exec::test {
+namespace {
+class OutputBatchSizerTest : public testing::Test,
+                             public velox::test::VectorTestBase {
+ protected:
+  static void SetUpTestCase() {
+    memory::MemoryManager::testingSetInstance({});
+  }
+};
+
+TEST_F(OutputBatchSizerTest, config) {
+  VELOX_ASSERT_THROW(OutputBatchSizer({0, 1'000, 1'000}), "(0 vs. 0)");
+  VELOX_ASSERT_THROW(OutputBatchSizer({1'000, 0, 1'000}), "(0 vs. 0)");
+}
+
+TEST_F(OutputBatchSizerTest, rowSize) {
+  constexpr uint64_t kTargetBytes = 64 << 10;
+  OutputBatchSizer sizer({kTargetBytes, 10'000, 0});
+  ASSERT_FALSE(sizer.hasOutput());
+  ASSERT_EQ(sizer.batchRows(1'024), 1'024);
+  ASSERT_EQ(sizer.batchBytes(), kTargetBytes);
+
+  auto narrow = makeRowVector({makeFlatVector<int64_t>(
+      1'000, [](auto row) { return row; })});
+  sizer.recordOutput(*narrow);
+  ASSERT_TRUE(sizer.hasOutput());
+  const auto narrowRowBytes = sizer.averageRowBytes();
+  ASSERT_EQ(narrowRowBytes, narrow->retainedSize() / 1'000);
+  ASSERT_EQ(
+      sizer.batchRows(1'024),
+      static_cast<vector_size_t>(
+          kTargetBytes / (narrow->retainedSize() / 1'000.0)));
+
+  // Wide rows move the average row size up and cut the batch rows.
+  std::vector<VectorPtr> columns;
+  for (auto i = 0; i < 20; ++i) {
+    columns.push_back(
+        makeFlatVector<int64_t>(1'000, [](auto row) { return row; }));
+  }
+  auto wide = makeRowVector(columns);
+  for (auto i = 0; i < 20; ++i) {
+    sizer.recordOutput(*wide);
+  }
+  ASSERT_GT(sizer.averageRowBytes(), 10 * narrowRowBytes);
+  ASSERT_LT(sizer.batchRows(1'024), kTargetBytes / (10 * narrowRowBytes));
+  ASSERT_GE(sizer.batchRows(1'024), 1);
+
+  // Empty batches are ignored.
+  const auto rowBytes = sizer.averageRowBytes();
+  sizer.recordOutput(*makeRowVector({makeFlatVector<int64_t>(std::vector<int64_t>{})}));
+  ASSERT_EQ(sizer.averageRowBytes(), rowBytes);
+}
+
+TEST_F(OutputBatchSizerTest, downstreamCpu) {
+  constexpr uint64_t kTargetBytes = 64 << 10;
+  constexpr uint64_t kMinBatchCpuNanos = 100'000;
+  OutputBatchSizer sizer({kTargetBytes, 1'000'000, kMinBatchCpuNanos});
+  sizer.recordOutput(*makeRowVector({makeFlatVector<int64_t>(
+      1'000, [](auto row) { return row; })}));
+  const auto batchRows = sizer.batchRows(1'024);
+
+  // Cheap downstream batches grow the batch up to the max scale.
+  for (auto i = 0; i < 20; ++i) {
+    sizer.recordDownstreamCpu(kMinBatchCpuNanos / 10);
+  }
+  ASSERT_EQ(sizer.scale(), OutputBatchSizer::kMaxScale);
+  ASSERT_EQ(sizer.batchBytes(), kTargetBytes * OutputBatchSizer::kMaxScale);
+  ASSERT_GT(sizer.batchRows(1'024), 3 * batchRows);
+
+  // Expensive downstream batches shrink it back to the target.
+  for (auto i = 0; i < 20; ++i) {
+    sizer.recordDownstreamCpu(kMinBatchCpuNanos * 10);
+  }
+  ASSERT_EQ(sizer.scale(), 1);
+  ASSERT_EQ(sizer.batchRows(1'024), batchRows);
+}
+
+TEST_F(OutputBatchSizerTest, maxRows) {
+  OutputBatchSizer sizer({1 << 30, 10'000, 0});
+  sizer.recordOutput(*makeRowVector({makeFlatVector<int64_t>(
+      1'000, [](auto row) { return row; })}));
+  ASSERT_EQ(sizer.batchRows(1'024), 10'000);
+}
+} // namespace
+} // namespace facebook::velox::exec::test
@@ -21,6 +21,7 @@
 #include "velox/exec/Task.h"
 #include "velox/exec/tests/utils/PlanBuilder.h"
 #include "velox/exec/tests/utils/SerializedPageUtil.h"
+#include "velox/exec/tests/utils/TempDirectoryPath.h"
 #include "velox/serializers/CompactRowSerializer.h"
 #include "velox/serializers/PrestoSerializer.h"
 #include "velox/serializers/UnsafeRowSerializer.h"
@@ -1450,6 +1451,57 @@ TEST_P(OutputBufferManagerWithDifferentSerdeKindsTest, outOfOrderAcks) {
   bufferManager_->removeTask(taskId);
 }
 
+TEST_F(OutputBufferManagerTest, broadcastSpill) {
+  filesystems::registerLocalFileSystem();
+  const auto spillDirectory = exec::test::TempDirectoryPath::create();
+  const auto pageSize = makeSerializedPage(rowType_, 100)->size();
+  const std::string taskId = "t0";
+  auto planFragment = exec::test::PlanBuilder()
+                          .values({std::dynamic_pointer_cast<RowVector>(
+                              BatchMaker::createBatch(rowType_, 100, *pool_))})
+                          .planFragment();
+  auto queryCtx = core::QueryCtx::create(
+      executor_.get(),
+      core::QueryConfig(
+          {{core::QueryConfig::kMaxOutputBufferSize,
+            std::to_string(pageSize * 5 / 2)},
+           {core::QueryConfig::kBroadcastOutputSpillEnabled, "true"}}));
+  auto task = Task::create(
+      taskId,
+      std::move(planFragment),
+      0,
+      std::move(queryCtx),
+      Task::ExecutionMode::kParallel);
+  task->setSpillDirectory(spillDirectory->getPath());
+  bufferManager_->initializeTask(
+      task, PartitionedOutputNode::Kind::kBroadcast, 1, 1);
+
+  // The pages acknowledged by the only destination are kept for the
+  // destinations that join later and get spilled.
+  const int32_t kNumPages = 6;
+  for (int32_t i = 0; i < kNumPages; ++i) {
+    enqueue(taskId, 0, rowType_, 100, true);
+    fetchOneAndAck(taskId, 0, i);
+  }
+  const auto stats = getStats(taskId);
+  ASSERT_GT(stats.broadcastSpilledBytes, 0);
+  ASSERT_LT(stats.bufferedBytes, pageSize * 4);
+
+  // A late-joining destination replays the spilled pages first.
+  bufferManager_->updateOutputBuffers(taskId, 2, false);
+  for (int32_t i = 0; i < kNumPages; ++i) {
+    fetchOneAndAck(taskId, 1, i);
+  }
+  ASSERT_EQ(getStats(taskId).buffersStats[1].pagesSent, kNumPages);
+
+  noMoreData(taskId);
+  fetchEndMarker(taskId, 0, kNumPages);
+  fetchEndMarker(taskId, 1, kNumPages);
+  bufferManager_->updateOutputBuffers(taskId, 2, true);
+  EXPECT_TRUE(bufferManager_->isFinished(taskId));
+  bufferManager_->removeTask(taskId);
+}
+
 TEST_F(OutputBufferManagerTest, errorInQueue) {
   auto queue = std::make_shared<ExchangeQueue>(1, 0);
   queue->setError("Forced failure");
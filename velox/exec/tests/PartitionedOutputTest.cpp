@@ -206,6 +206,125 @@ TEST_P(PartitionedOutputTest, keyChannelNotAtBeginningWithNulls) {
           .count()));
 }
 
+TEST_P(PartitionedOutputTest, manyDestinations) {
+  // This test verifies that the rows scattered to many destinations keep
+  // their input order in each destination.
+  constexpr int32_t kNumDestinations = 300;
+  constexpr vector_size_t kNumRows = 10'000;
+  auto input = makeRowVector(
+      {"p1", "v1"},
+      {makeFlatVector<int32_t>(kNumRows, [](auto row) { return row % 1'000; }),
+       makeFlatVector<int64_t>(kNumRows, [](auto row) { return row; })});
+
+  auto plan = PlanBuilder()
+                  .values({input})
+                  .partitionedOutput(
+                      {"p1"},
+                      kNumDestinations,
+                      std::vector<std::string>{"v1"},
+                      GetParam())
+                  .planNode();
+
+  auto taskId = "local://test-partitioned-output-many-destinations-0";
+  auto task = Task::create(
+      taskId,
+      core::PlanFragment{plan},
+      0,
+      createQueryContext({}),
+      Task::ExecutionMode::kParallel);
+  task->start(1);
+
+  const auto outputType = ROW({"v1"}, {BIGINT()});
+  auto* serde = getNamedVectorSerde(GetParam());
+  std::vector<bool> seen(kNumRows, false);
+  vector_size_t numRows = 0;
+  for (auto destination = 0; destination < kNumDestinations; ++destination) {
+    int64_t previous = -1;
+    for (const auto& page : getAllData(taskId, destination)) {
+      const auto output = IOBufToRowVector(*page, outputType, *pool(), serde);
+      const auto* values = output->childAt(0)->asFlatVector<int64_t>();
+      for (auto i = 0; i < output->size(); ++i) {
+        const auto value = values->valueAt(i);
+        ASSERT_GT(value, previous);
+        ASSERT_FALSE(seen[value]);
+        seen[value] = true;
+        previous = value;
+        ++numRows;
+      }
+    }
+  }
+  ASSERT_EQ(numRows, kNumRows);
+
+  ASSERT_TRUE(waitForTaskCompletion(
+      task.get(),
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::seconds(10))
+          .count()));
+}
+
+TEST_P(PartitionedOutputTest, partialSort) {
+  // This test verifies that the rows of each destination are sorted by the
+  // partition key with the input order kept for equal keys.
+  constexpr int32_t kNumDestinations = 4;
+  constexpr vector_size_t kNumRows = 10'000;
+  auto input = makeRowVector(
+      {"p1", "v1"},
+      {makeFlatVector<int32_t>(
+           kNumRows, [](auto row) { return (kNumRows - row) % 1'000; }),
+       makeFlatVector<int64_t>(kNumRows, [](auto row) { return row; })});
+
+  auto plan = PlanBuilder()
+                  .values({input})
+                  .partitionedOutput(
+                      {"p1"},
+                      kNumDestinations,
+                      std::vector<std::string>{"p1", "v1"},
+                      GetParam())
+                  .planNode();
+
+  auto taskId = "local://test-partitioned-output-partial-sort-0";
+  auto task = Task::create(
+      taskId,
+      core::PlanFragment{plan},
+      0,
+      createQueryContext(
+          {{core::QueryConfig::kShufflePartialSortEnabled, "true"}}),
+      Task::ExecutionMode::kParallel);
+  task->start(1);
+
+  const auto outputType = ROW({"p1", "v1"}, {INTEGER(), BIGINT()});
+  auto* serde = getNamedVectorSerde(GetParam());
+  vector_size_t numRows = 0;
+  for (auto destination = 0; destination < kNumDestinations; ++destination) {
+    int32_t previousKey = -1;
+    int64_t previousValue = -1;
+    for (const auto& page : getAllData(taskId, destination)) {
+      const auto output = IOBufToRowVector(*page, outputType, *pool(), serde);
+      const auto* keys = output->childAt(0)->asFlatVector<int32_t>();
+      const auto* values = output->childAt(1)->asFlatVector<int64_t>();
+      for (auto i = 0; i < output->size(); ++i) {
+        const auto key = keys->valueAt(i);
+        const auto value = values->valueAt(i);
+        ASSERT_GE(key, previousKey);
+        if (key == previousKey) {
+          ASSERT_GT(value, previousValue);
+        }
+        ASSERT_EQ(key, (kNumRows - value) % 1'000);
+        previousKey = key;
+        previousValue = value;
+        ++numRows;
+      }
+    }
+  }
+  ASSERT_EQ(numRows, kNumRows);
+
+  ASSERT_TRUE(waitForTaskCompletion(
+      task.get(),
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::seconds(10))
+          .count()));
+}
+
 VELOX_INSTANTIATE_TEST_SUITE_P(
     PartitionedOutputTest,
     PartitionedOutputTest,
@@ -451,7 +451,9 @@ TEST_F(PrefixSortTest, makeSortLayoutForString) {
       sortLayoutTwoCompleteKeys.nonPrefixSortStartIndex ==
       sortLayoutTwoCompleteKeys.numNormalizedKeys);
   ASSERT_EQ(sortLayoutTwoCompleteKeys.encodeSizes.size(), 2);
-  ASSERT_EQ(sortLayoutTwoCompleteKeys.encodeSizes[0], 10);
+  // The complete string key is encoded with its size.
+  ASSERT_EQ(sortLayoutTwoCompleteKeys.encodeSizes[0], 14);
+  ASSERT_TRUE(sortLayoutTwoCompleteKeys.encoders[0].encodeStringSize());
   ASSERT_EQ(sortLayoutTwoCompleteKeys.encodeSizes[1], 9);
 
   // The last key type is VARBINARY, indicating that only partial data is
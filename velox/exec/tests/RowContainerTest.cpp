@@ -1028,6 +1028,26 @@ TEST_F(RowContainerTest, extractWithNullsAndTargetOffset) {
   }
 }
 
+TEST_F(RowContainerTest, extractFixedWidthNullRows) {
+  std::vector<TypePtr> types = {BIGINT()};
+  auto rowContainer = std::make_unique<RowContainer>(types, pool_.get());
+  auto data = makeFlatVector<int64_t>({1, 2, 3, 4});
+  DecodedVector decoded(*data);
+  auto rows = store(*rowContainer, decoded, data->size());
+
+  // A result with nulls from a previous use is cleared where rows are set.
+  auto result = makeNullableFlatVector<int64_t>(
+      {std::nullopt, std::nullopt, std::nullopt, std::nullopt});
+  rowContainer->extractColumn(rows.data(), rows.size(), 0, result);
+  assertEqualVectors(data, result);
+
+  std::vector<char*> withNullRows = {rows[3], nullptr, rows[0], nullptr};
+  rowContainer->extractColumn(withNullRows.data(), 4, 0, result);
+  assertEqualVectors(
+      makeNullableFlatVector<int64_t>({4, std::nullopt, 1, std::nullopt}),
+      result);
+}
+
 TEST_F(RowContainerTest, storeExtractArrayOfVarchar) {
   // Make a string vector with two rows each having 2 elements.
   // Here it is important, that one of the 1st row's elements has more than 12
@@ -1951,6 +1971,46 @@ TEST_F(RowContainerTest, nans) {
   ASSERT_EQ(rowContainer->compare(rows[0], rows[1], 0, {}), 0);
 }
 
+TEST_F(RowContainerTest, equalStrings) {
+  std::vector<TypePtr> types = {VARCHAR()};
+  auto rowContainer = std::make_unique<RowContainer>(types, pool_.get());
+
+  // Strings with equal sizes and prefixes that differ in the inline part or
+  // in the part out of line, and equal strings.
+  const std::string longString(100, 'x');
+  auto data = makeFlatVector<std::string>({
+      "abcdefgh",
+      "abcdefgi",
+      longString,
+      longString + "a",
+      longString + "b",
+      longString,
+  });
+  auto size = data->size();
+  DecodedVector decoded(*data);
+  auto rows = store(*rowContainer, decoded, size);
+
+  for (auto i = 0; i < size; ++i) {
+    for (auto j = 0; j < size; ++j) {
+      const bool expected = data->valueAt(i) == data->valueAt(j);
+      ASSERT_EQ(
+          expected,
+          rowContainer->equals<false>(
+              rows[i], rowContainer->columnAt(0), decoded, j))
+          << i << ", " << j;
+      ASSERT_EQ(
+          expected,
+          rowContainer->compare(
+              rows[i], rows[j], 0, CompareFlags{true, true, true}) == 0)
+          << i << ", " << j;
+      ASSERT_EQ(
+          expected,
+          rowContainer->compare(rows[i], rows[j], 0, CompareFlags{}) == 0)
+          << i << ", " << j;
+    }
+  }
+}
+
 TEST_F(RowContainerTest, toString) {
   std::vector<TypePtr> keyTypes = {BIGINT(), VARCHAR()};
   std::vector<TypePtr> dependentTypes = {TINYINT(), REAL(), ARRAY(BIGINT())};
@@ -2791,4 +2851,80 @@ TEST_F(RowContainerTest, storeAndCollectColumnStats) {
   }
 }
 
+
+TEST_F(RowContainerTest, compact) {
+  constexpr int32_t kNumRows = 10'000;
+  auto rowVector = makeRowVector({
+      makeFlatVector<int64_t>(
+          kNumRows, [](auto row) { return row; }, nullEvery(7)),
+      makeFlatVector<std::string>(
+          kNumRows,
+          [](auto row) { return fmt::format("abcdefghijklmnopq_{}", row); },
+          nullEvery(11)),
+  });
+  auto rowContainer = makeRowContainer({BIGINT(), VARCHAR()}, {}, false);
+  ASSERT_TRUE(rowContainer->canCompact());
+
+  std::vector<char*> rows;
+  rows.reserve(kNumRows);
+  for (auto i = 0; i < kNumRows; ++i) {
+    rows.push_back(rowContainer->newRow());
+  }
+  SelectivityVector allRows(kNumRows);
+  for (auto i = 0; i < rowContainer->columnTypes().size(); ++i) {
+    DecodedVector decoded(*rowVector->childAt(i), allRows);
+    rowContainer->store(decoded, folly::Range(rows.data(), kNumRows), i);
+  }
+
+  // Erases 3 of every 4 rows.
+  std::vector<char*> erased;
+  for (auto i = 0; i < kNumRows; ++i) {
+    if (i % 4 != 0) {
+      erased.push_back(rows[i]);
+    }
+  }
+  rowContainer->eraseRows(folly::Range(erased.data(), erased.size()));
+  const auto numRows = rowContainer->numRows();
+  ASSERT_EQ(numRows, kNumRows / 4);
+  const auto sparseBytes = rowContainer->sparseBytes();
+  ASSERT_GT(sparseBytes, 0);
+
+  const auto freedBytes = rowContainer->compact();
+  ASSERT_GT(freedBytes, 0);
+  ASSERT_LE(freedBytes, sparseBytes);
+  ASSERT_LT(rowContainer->sparseBytes(), sparseBytes);
+  ASSERT_EQ(rowContainer->numRows(), numRows);
+  RowContainerTestHelper(rowContainer.get()).checkConsistency();
+
+  // The moved rows keep their values and order.
+  std::vector<char*> compactedRows(numRows);
+  RowContainerIterator iter;
+  ASSERT_EQ(
+      rowContainer->listRows(&iter, numRows, compactedRows.data()), numRows);
+  auto expected = makeRowVector({
+      makeFlatVector<int64_t>(
+          numRows,
+          [](auto row) { return row * 4; },
+          [](auto row) { return (row * 4) % 7 == 0; }),
+      makeFlatVector<std::string>(
+          numRows,
+          [](auto row) { return fmt::format("abcdefghijklmnopq_{}", row * 4); },
+          [](auto row) { return (row * 4) % 11 == 0; }),
+  });
+  for (auto i = 0; i < rowContainer->columnTypes().size(); ++i) {
+    auto result = BaseVector::create(
+        rowContainer->columnTypes()[i], numRows, pool_.get());
+    rowContainer->extractColumn(compactedRows.data(), numRows, i, result);
+    assertEqualVectors(expected->childAt(i), result);
+  }
+
+  // New rows are appended after the moved ones.
+  auto* newRow = rowContainer->newRow();
+  ASSERT_EQ(rowContainer->numRows(), numRows + 1);
+  ASSERT_EQ(rowContainer->findRows(folly::Range(&newRow, 1), rows.data()), 1);
+
+  // Rows of a join build are linked by pointers and can't be moved.
+  ASSERT_FALSE(makeRowContainer({BIGINT()}, {BIGINT()})->canCompact());
+}
+
 } // namespace facebook::velox::exec::test
@@ -248,6 +248,56 @@ TEST_F(RowNumberTest, spill) {
   }
 }
 
+TEST_F(RowNumberTest, spillPartitionTargetSize) {
+  std::vector<RowVectorPtr> vectors = createVectors(8, rowType_, fuzzerOpts_);
+  createDuckDbTable(vectors);
+
+  struct {
+    std::string targetSize;
+    uint32_t expectedSpilledPartitions;
+
+    std::string debugString() const {
+      return fmt::format(
+          "targetSize {}, expectedSpilledPartitions {}",
+          targetSize,
+          expectedSpilledPartitions);
+    }
+  } testSettings[] = {{"0B", 8 * 2}, {"1B", 8 * 2}, {"1GB", 1 * 2}};
+
+  for (const auto& testData : testSettings) {
+    SCOPED_TRACE(testData.debugString());
+    const auto spillDirectory = exec::test::TempDirectoryPath::create();
+    auto queryCtx = core::QueryCtx::create(executor_.get());
+    TestScopedSpillInjection scopedSpillInjection(100, ".*", 1);
+
+    core::PlanNodeId rowNumberPlanNodeId;
+    auto task =
+        AssertQueryBuilder(duckDbQueryRunner_)
+            .spillDirectory(spillDirectory->getPath())
+            .config(core::QueryConfig::kSpillEnabled, true)
+            .config(core::QueryConfig::kRowNumberSpillEnabled, true)
+            .config(core::QueryConfig::kSpillNumPartitionBits, 3)
+            .config(
+                core::QueryConfig::kSpillPartitionTargetSize,
+                testData.targetSize)
+            .queryCtx(queryCtx)
+            .plan(PlanBuilder()
+                      .values(vectors)
+                      .rowNumber({"c0"})
+                      .capturePlanNodeId(rowNumberPlanNodeId)
+                      .planNode())
+            .assertResults(
+                "SELECT *, row_number() over (partition by c0) FROM tmp");
+    auto taskStats = toPlanStats(task->taskStats());
+    auto& planStats = taskStats.at(rowNumberPlanNodeId);
+    ASSERT_GT(planStats.spilledBytes, 0);
+    ASSERT_EQ(planStats.spilledPartitions, testData.expectedSpilledPartitions);
+
+    task.reset();
+    waitForAllTasksToBeDeleted();
+  }
+}
+
 TEST_F(RowNumberTest, maxSpillBytes) {
   const auto rowType =
       ROW({"c0", "c1", "c2"}, {INTEGER(), INTEGER(), VARCHAR()});
@@ -18,6 +18,7 @@
 
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/core/PlanNode.h"
+#include "velox/exec/LocalPartition.h"
 #include "velox/exec/PlanNodeStats.h"
 
 #include "velox/exec/tests/utils/HiveConnectorTestBase.h"
@@ -268,6 +269,32 @@ TEST_F(ScaledScanControllerTest, estimateDriverUsage) {
   }
 }
 
+TEST_F(ScaledScanControllerTest, outputBackedUp) {
+  auto root = rootPool(256 << 20);
+  auto node = root->addAggregateChild("test");
+  const int numDrivers{2};
+  auto memoryManager = std::make_shared<LocalExchangeMemoryManager>(1 << 20);
+  auto controller = std::make_shared<ScaledScanController>(
+      node.get(), numDrivers, 0.5, memoryManager);
+  ContinueFuture future{ContinueFuture::makeEmpty()};
+  ASSERT_FALSE(controller->shouldStop(0, &future));
+  ASSERT_TRUE(controller->shouldStop(1, &future));
+
+  // Half of the buffer limit is not yet taken by the consumers.
+  ContinueFuture producerFuture{ContinueFuture::makeEmpty()};
+  ASSERT_FALSE(memoryManager->increaseMemoryUsage(&producerFuture, 512 << 10));
+  controller->updateAndTryScale(0, 1 << 20);
+  ASSERT_EQ(controller->stats().numRunningDrivers, 1);
+  ASSERT_EQ(controller->stats().numOutputBackedUp, 1);
+  ASSERT_FALSE(future.isReady());
+
+  memoryManager->decreaseMemoryUsage(512 << 10);
+  controller->updateAndTryScale(0, 1 << 20);
+  ASSERT_EQ(controller->stats().numRunningDrivers, 2);
+  ASSERT_EQ(controller->stats().numOutputBackedUp, 1);
+  ASSERT_TRUE(future.isReady());
+}
+
 TEST_F(ScaledScanControllerTest, error) {
   auto root = rootPool(256 << 20);
   auto node = root->addAggregateChild("test");
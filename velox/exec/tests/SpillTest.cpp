@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <fstream>
 #include <memory>
 
 #include "velox/common/base/RuntimeMetrics.h"
@@ -23,6 +24,7 @@
 #include "velox/common/file/FileSystems.h"
 #include "velox/exec/OperatorUtils.h"
 #include "velox/exec/Spill.h"
+#include "velox/exec/VectorHasher.h"
 #include "velox/exec/tests/utils/TempDirectoryPath.h"
 #include "velox/serializers/PrestoSerializer.h"
 #include "velox/type/Timestamp.h"
@@ -470,7 +472,8 @@ class SpillTest : public ::testing::TestWithParam<uint32_t>,
             "spillRuns[{}] spilledInputBytes[{}] spilledBytes[{}] spilledRows[{}] "
             "spilledPartitions[{}] spilledFiles[{}] spillFillTimeNanos[{}] "
             "spillSortTimeNanos[{}] spillExtractVectorTime[{}] spillSerializationTimeNanos[{}] spillWrites[{}] "
-            "spillFlushTimeNanos[{}] spillWriteTimeNanos[{}] maxSpillExceededLimitCount[0] "
+            "spillFlushTimeNanos[{}] spillWriteTimeNanos[{}] spillWriteWaitTimeNanos[0ns] "
+            "maxSpillExceededLimitCount[0] "
             "spillReadBytes[{}] spillReads[{}] spillReadTimeNanos[{}] "
             "spillReadDeserializationTimeNanos[{}]",
             finalStats.spillRuns,
@@ -880,6 +883,375 @@ TEST_P(SpillTest, validatePerSpillWriteSize) {
       "Spill bytes will overflow");
 }
 
+TEST_P(SpillTest, columnarFormat) {
+  auto tempDirectory = exec::test::TempDirectoryPath::create();
+  SpillState state(
+      [&]() -> const std::string& { return tempDirectory->getPath(); },
+      updateSpilledBytesCb_,
+      "test",
+      1,
+      0,
+      {},
+      kGB,
+      // Flushes each batch as separate column chunks.
+      0,
+      compressionKind_,
+      std::nullopt,
+      pool(),
+      &spillStats_,
+      "",
+      /*columnarFormat=*/true);
+  const int partitionIndex = 0;
+  state.setPartitionSpilled(partitionIndex);
+  std::vector<RowVectorPtr> batches;
+  for (auto i = 0; i < 3; ++i) {
+    batches.push_back(makeRowVector({
+        makeFlatVector<int64_t>(100, [&](auto row) { return i * 100 + row; }),
+        makeFlatVector<StringView>(
+            100,
+            [](auto row) {
+              return StringView::makeInline(std::to_string(row));
+            },
+            nullEvery(7)),
+        makeFlatVector<double>(100, [](auto row) { return row * 0.5; }),
+    }));
+    state.appendToPartition(partitionIndex, batches.back());
+  }
+  auto files = state.finish(partitionIndex);
+  ASSERT_EQ(files.size(), 1);
+  ASSERT_TRUE(files[0].columnar);
+
+  // Reads all the columns.
+  auto file = SpillReadFile::create(files[0], 1 << 20, pool(), &spillStats_);
+  RowVectorPtr batch;
+  for (const auto& expected : batches) {
+    ASSERT_TRUE(file->nextBatch(batch));
+    assertEqualVectors(expected, batch);
+  }
+  ASSERT_FALSE(file->nextBatch(batch));
+
+  // Reads a reordered subset of the columns.
+  const std::vector<column_index_t> projection{2, 0};
+  file = SpillReadFile::create(
+      files[0], 1 << 20, pool(), &spillStats_, projection);
+  for (const auto& expected : batches) {
+    ASSERT_TRUE(file->nextBatch(batch));
+    assertEqualVectors(
+        makeRowVector({expected->childAt(2), expected->childAt(0)}), batch);
+  }
+  ASSERT_FALSE(file->nextBatch(batch));
+}
+
+TEST_P(SpillTest, mergePrefixKeys) {
+  auto tempDirectory = exec::test::TempDirectoryPath::create();
+  const std::vector<CompareFlags> compareFlags{
+      {/*nullsFirst=*/true, /*ascending=*/true},
+      {/*nullsFirst=*/false, /*ascending=*/false}};
+  SpillState state(
+      [&]() -> const std::string& { return tempDirectory->getPath(); },
+      updateSpilledBytesCb_,
+      "test",
+      1,
+      2,
+      compareFlags,
+      kGB,
+      0,
+      compressionKind_,
+      std::nullopt,
+      pool(),
+      &spillStats_,
+      "",
+      /*columnarFormat=*/false,
+      /*writeExecutor=*/nullptr,
+      common::PrefixSortConfig());
+  const int partitionIndex = 0;
+  state.setPartitionSpilled(partitionIndex);
+
+  // Writes 'numFiles' sorted runs, each with keys (row / 10, string of
+  // -row % 10) and a payload column to identify the rows. The string keys
+  // share a long prefix so that the comparison falls back to them.
+  const int numFiles = 4;
+  const int numRowsPerFile = 500;
+  const std::string prefix(20, 'x');
+  for (auto file = 0; file < numFiles; ++file) {
+    auto keys = makeFlatVector<int64_t>(
+        numRowsPerFile,
+        [](auto row) { return row / 10; },
+        [&](auto row) { return row == 0 && file == 0; });
+    auto strings = makeFlatVector<std::string>(numRowsPerFile, [&](auto row) {
+      return prefix + std::to_string(9 - row % 10);
+    });
+    auto payload = makeFlatVector<int32_t>(
+        numRowsPerFile, [&](auto row) { return file * numRowsPerFile + row; });
+    state.appendToPartition(
+        partitionIndex, makeRowVector({keys, strings, payload}));
+    state.finishFile(partitionIndex);
+  }
+  auto files = state.finish(partitionIndex);
+  ASSERT_EQ(files.size(), numFiles);
+  for (const auto& file : files) {
+    ASSERT_GT(file.prefixKeySize, 0);
+    ASSERT_EQ(file.prefixKeyFallbackIndex, 1);
+  }
+
+  SpillPartition spillPartition(SpillPartitionId{0, 0}, std::move(files));
+  auto merge =
+      spillPartition.createOrderedReader(1 << 20, pool(), &spillStats_);
+  ASSERT_TRUE(merge != nullptr);
+  std::optional<int64_t> lastKey;
+  std::string lastString;
+  int numRows{0};
+  for (;;) {
+    auto* stream = merge->next();
+    if (stream == nullptr) {
+      break;
+    }
+    ASSERT_EQ(stream->current().childrenSize(), 3);
+    const auto index = stream->currentIndex();
+    const std::optional<int64_t> key = stream->decoded(0).isNullAt(index)
+        ? std::nullopt
+        : std::optional<int64_t>(stream->decoded(0).valueAt<int64_t>(index));
+    const auto string =
+        stream->decoded(1).valueAt<StringView>(index).str();
+    if (numRows == 0) {
+      ASSERT_FALSE(key.has_value());
+    } else {
+      ASSERT_TRUE(key.has_value());
+      if (lastKey.has_value() && lastKey.value() == key.value()) {
+        ASSERT_GE(lastString, string);
+      } else if (lastKey.has_value()) {
+        ASSERT_LT(lastKey.value(), key.value());
+      }
+    }
+    lastKey = key;
+    lastString = string;
+    ++numRows;
+    stream->pop();
+  }
+  ASSERT_EQ(numRows, numFiles * numRowsPerFile);
+}
+
+TEST_P(SpillTest, asyncWrite) {
+  auto tempDirectory = exec::test::TempDirectoryPath::create();
+  auto executor = std::make_unique<folly::CPUThreadPoolExecutor>(2);
+  SpillState state(
+      [&]() -> const std::string& { return tempDirectory->getPath(); },
+      updateSpilledBytesCb_,
+      "test",
+      1,
+      0,
+      {},
+      kGB,
+      0,
+      compressionKind_,
+      std::nullopt,
+      pool(),
+      &spillStats_,
+      "",
+      /*columnarFormat=*/false,
+      executor.get());
+  const int partitionIndex = 0;
+  state.setPartitionSpilled(partitionIndex);
+  const auto statsBefore = spillStats_.copy();
+  std::vector<RowVectorPtr> batches;
+  for (auto i = 0; i < 10; ++i) {
+    batches.push_back(makeRowVector({
+        makeFlatVector<int64_t>(1'000, [&](auto row) { return i + row; }),
+        makeFlatVector<int32_t>(1'000, [](auto row) { return row; }),
+    }));
+    state.appendToPartition(partitionIndex, batches.back());
+  }
+  auto files = state.finish(partitionIndex);
+  ASSERT_EQ(files.size(), 1);
+  const auto stats = spillStats_.copy() - statsBefore;
+  ASSERT_EQ(stats.spillWrites, batches.size());
+  ASSERT_EQ(stats.spilledBytes, files[0].size);
+
+  auto file = SpillReadFile::create(files[0], 1 << 20, pool(), &spillStats_);
+  RowVectorPtr batch;
+  for (const auto& expected : batches) {
+    ASSERT_TRUE(file->nextBatch(batch));
+    assertEqualVectors(expected, batch);
+  }
+  ASSERT_FALSE(file->nextBatch(batch));
+}
+
+TEST_P(SpillTest, pageRouting) {
+  auto tempDirectory = exec::test::TempDirectoryPath::create();
+  const HashBitRange routingBits(8, 10);
+  auto makeState = [&](const HashBitRange& bits) {
+    return std::make_unique<SpillState>(
+        [&]() -> const std::string& { return tempDirectory->getPath(); },
+        updateSpilledBytesCb_,
+        "test",
+        routingBits.numPartitions(),
+        0,
+        std::vector<CompareFlags>{},
+        kGB,
+        0,
+        compressionKind_,
+        std::nullopt,
+        pool(),
+        &spillStats_,
+        "",
+        /*columnarFormat=*/false,
+        /*writeExecutor=*/nullptr,
+        /*prefixKeyConfig=*/std::nullopt,
+        bits,
+        /*numPageRoutingKeys=*/1);
+  };
+
+  auto state = makeState(routingBits);
+  state->setPartitionSpilled(0);
+  std::vector<int64_t> expectedKeys;
+  RowTypePtr rowType;
+  for (auto i = 0; i < 10; ++i) {
+    auto batch = makeRowVector({
+        makeFlatVector<int64_t>(
+            1'000, [&](auto row) { return i * 1'000 + row; }),
+        makeFlatVector<StringView>(
+            1'000, [](auto row) { return StringView::makeInline("v"); }),
+    });
+    for (auto row = 0; row < batch->size(); ++row) {
+      expectedKeys.push_back(i * 1'000 + row);
+    }
+    rowType = asRowType(batch->type());
+    state->appendToPartition(0, batch);
+  }
+  auto files = state->finish(0);
+  ASSERT_EQ(files.size(), 1);
+  ASSERT_EQ(files[0].pageRoutingBits, routingBits);
+
+  // Moves each page to the partition of the next level it is routed to and
+  // checks that all its rows hash to that partition.
+  auto movedState = makeState(HashBitRange(10, 12));
+  for (auto partition = 0; partition < routingBits.numPartitions();
+       ++partition) {
+    movedState->setPartitionSpilled(partition);
+  }
+  auto hasher = VectorHasher::create(BIGINT(), 0);
+  raw_vector<uint64_t> hashes;
+  auto file = SpillReadFile::create(files[0], 1 << 20, pool(), &spillStats_);
+  int32_t partition;
+  std::unique_ptr<folly::IOBuf> page;
+  int32_t numPages{0};
+  while (file->nextPage(partition, page)) {
+    ++numPages;
+    ASSERT_NE(partition, SpillWriter::kUnroutedPage);
+    const auto batch = file->deserializePage(*page);
+    SelectivityVector rows(batch->size());
+    hashes.resize(batch->size());
+    hasher->decode(*batch->childAt(0), rows);
+    hasher->hash(rows, false, hashes);
+    for (auto row = 0; row < batch->size(); ++row) {
+      ASSERT_EQ(routingBits.partition(hashes[row]), partition);
+    }
+    movedState->appendPageToPartition(partition, rowType, std::move(page));
+  }
+  ASSERT_GT(numPages, 10);
+
+  std::vector<int64_t> keys;
+  for (auto movedPartition = 0; movedPartition < routingBits.numPartitions();
+       ++movedPartition) {
+    for (const auto& movedFile : movedState->finish(movedPartition)) {
+      auto movedReadFile =
+          SpillReadFile::create(movedFile, 1 << 20, pool(), &spillStats_);
+      RowVectorPtr batch;
+      while (movedReadFile->nextBatch(batch)) {
+        auto* values = batch->childAt(0)->asFlatVector<int64_t>();
+        for (auto row = 0; row < batch->size(); ++row) {
+          keys.push_back(values->valueAt(row));
+        }
+      }
+      // The moved pages are not grouped by the routing bits of the next level.
+      movedReadFile =
+          SpillReadFile::create(movedFile, 1 << 20, pool(), &spillStats_);
+      while (movedReadFile->nextPage(partition, page)) {
+        ASSERT_EQ(partition, SpillWriter::kUnroutedPage);
+      }
+    }
+  }
+  std::sort(keys.begin(), keys.end());
+  ASSERT_EQ(keys, expectedKeys);
+}
+
+TEST_P(SpillTest, checksumAndEncryption) {
+  struct {
+    bool checksum;
+    bool encryption;
+
+    std::string debugString() const {
+      return fmt::format("checksum {}, encryption {}", checksum, encryption);
+    }
+  } testSettings[] = {{true, false}, {false, true}, {true, true}};
+
+  for (const auto& testData : testSettings) {
+    SCOPED_TRACE(testData.debugString());
+    auto tempDirectory = exec::test::TempDirectoryPath::create();
+    SpillState state(
+        [&]() -> const std::string& { return tempDirectory->getPath(); },
+        updateSpilledBytesCb_,
+        "test",
+        1,
+        0,
+        {},
+        kGB,
+        0,
+        compressionKind_,
+        std::nullopt,
+        pool(),
+        &spillStats_,
+        "",
+        /*columnarFormat=*/false,
+        /*writeExecutor=*/nullptr,
+        /*prefixKeyConfig=*/std::nullopt,
+        /*pageRoutingBits=*/std::nullopt,
+        /*numPageRoutingKeys=*/0,
+        /*ioShare=*/{},
+        testData.checksum,
+        testData.encryption);
+    state.setPartitionSpilled(0);
+    std::vector<RowVectorPtr> batches;
+    for (auto i = 0; i < 5; ++i) {
+      batches.push_back(makeRowVector({
+          makeFlatVector<int64_t>(1'000, [&](auto row) { return i + row; }),
+          makeFlatVector<std::string>(
+              1'000, [](auto row) { return std::string(row % 32, 'x'); }),
+      }));
+      state.appendToPartition(0, batches.back());
+    }
+    auto files = state.finish(0);
+    ASSERT_EQ(files.size(), 1);
+    ASSERT_EQ(files[0].checksum, testData.checksum);
+    ASSERT_EQ(files[0].encryptionKey.empty(), !testData.encryption);
+
+    auto file = SpillReadFile::create(files[0], 1 << 20, pool(), &spillStats_);
+    RowVectorPtr batch;
+    for (const auto& expected : batches) {
+      ASSERT_TRUE(file->nextBatch(batch));
+      assertEqualVectors(expected, batch);
+    }
+    ASSERT_FALSE(file->nextBatch(batch));
+
+    // Flips a bit in the first block and expects the read to fail.
+    {
+      std::fstream stream(
+          files[0].path, std::ios::in | std::ios::out | std::ios::binary);
+      const auto offset = SpillWriteFile::kBlockHeaderSize + 16;
+      char byte;
+      stream.seekg(offset);
+      stream.read(&byte, 1);
+      byte ^= 1;
+      stream.seekp(offset);
+      stream.write(&byte, 1);
+    }
+    file = SpillReadFile::create(files[0], 1 << 20, pool(), &spillStats_);
+    VELOX_ASSERT_THROW(
+        file->nextBatch(batch),
+        testData.checksum ? "Checksum mismatch" : "failed the authentication");
+  }
+}
+
 namespace {
 SpillFiles makeFakeSpillFiles(int32_t numFiles) {
   auto tempDir = exec::test::TempDirectoryPath::create();
@@ -33,6 +33,7 @@
 #include "velox/connectors/hive/HiveDataSource.h"
 #include "velox/connectors/hive/HivePartitionFunction.h"
 #include "velox/dwio/common/CacheInputStream.h"
+#include "velox/dwio/common/FileMetadataCache.h"
 #include "velox/dwio/common/tests/utils/DataFiles.h"
 #include "velox/exec/Cursor.h"
 #include "velox/exec/Exchange.h"
@@ -59,6 +60,7 @@ using namespace facebook::velox::exec::test;
 using namespace facebook::velox::tests::utils;
 
 DECLARE_int32(cache_prefetch_min_pct);
+DECLARE_uint64(velox_file_metadata_cache_bytes);
 
 namespace {
 void verifyCacheStats(
@@ -1597,6 +1599,74 @@ TEST_F(TableScanTest, multipleSplits) {
   }
 }
 
+TEST_F(TableScanTest, multipleSplitsWithMetadataPrefetch) {
+  gflags::FlagSaver flagSaver;
+  FLAGS_velox_file_metadata_cache_bytes = 64 << 20;
+  auto* metadataCache = dwio::common::FileMetadataCache::getInstance();
+  ASSERT_NE(metadataCache, nullptr);
+
+  auto filePaths = makeFilePaths(40);
+  auto vectors = makeVectors(40, 100);
+  for (int32_t i = 0; i < vectors.size(); i++) {
+    writeToFile(filePaths[i]->getPath(), vectors[i]);
+  }
+  createDuckDbTable(vectors);
+
+  std::vector<std::shared_ptr<connector::ConnectorSplit>> splits;
+  for (const auto& filePath : filePaths) {
+    splits.push_back(HiveConnectorSplitBuilder(filePath->getPath())
+                         .fileProperties({.modificationTime = 1})
+                         .build());
+  }
+  const auto numHits = metadataCache->stats().numHits;
+  auto task = AssertQueryBuilder(tableScanNode(), duckDbQueryRunner_)
+                  .splits(splits)
+                  .config(QueryConfig::kMaxSplitPreloadPerDriver, "1")
+                  .config(QueryConfig::kMaxSplitMetadataPrefetchPerDriver, "8")
+                  .assertResults("SELECT * FROM tmp");
+  auto stats = getTableScanRuntimeStats(task);
+  ASSERT_GT(stats.at("preloadedSplits").sum, 10);
+  // The readers of the splits find the footers prefetched for them.
+  ASSERT_GT(metadataCache->stats().numHits, numHits);
+}
+
+TEST_F(TableScanTest, splitBundle) {
+  auto filePaths = makeFilePaths(20);
+  auto vectors = makeVectors(20, 100);
+  for (int32_t i = 0; i < vectors.size(); i++) {
+    writeToFile(filePaths[i]->getPath(), vectors[i]);
+  }
+  createDuckDbTable(vectors);
+
+  // Bundles of 8, 8 and 4 files.
+  auto hiveSplits = makeHiveConnectorSplits(filePaths);
+  std::vector<std::shared_ptr<connector::ConnectorSplit>> splits;
+  for (auto i = 0; i < hiveSplits.size(); i += 8) {
+    const auto end = std::min<size_t>(i + 8, hiveSplits.size());
+    splits.push_back(
+        std::make_shared<connector::hive::HiveConnectorSplitBundle>(
+            std::vector<std::shared_ptr<connector::hive::HiveConnectorSplit>>(
+                hiveSplits.begin() + i, hiveSplits.begin() + end)));
+  }
+  auto task = AssertQueryBuilder(tableScanNode(), duckDbQueryRunner_)
+                  .splits(splits)
+                  .assertResults("SELECT * FROM tmp");
+  auto stats = getTableScanRuntimeStats(task);
+  ASSERT_EQ(stats.at("numBundledSplits").sum, 20);
+
+  // Filters apply to all the files of a bundle.
+  auto plan = PlanBuilder(pool_.get())
+                  .startTableScan()
+                  .outputType(rowType_)
+                  .subfieldFilter("c1 > 0")
+                  .remainingFilter("c0 % 3 = 1")
+                  .endTableScan()
+                  .planNode();
+  AssertQueryBuilder(plan, duckDbQueryRunner_)
+      .splits(splits)
+      .assertResults("SELECT * FROM tmp WHERE c1 > 0 AND c0 % 3 = 1");
+}
+
 TEST_F(TableScanTest, preloadingSplitClose) {
   auto filePaths = makeFilePaths(100);
   auto vectors = makeVectors(100, 100);
@@ -1821,6 +1891,33 @@ TEST_F(TableScanTest, splitOffsetAndLength) {
       "SELECT * FROM tmp LIMIT 0");
 }
 
+TEST_F(TableScanTest, splitMorsels) {
+  auto vectors = makeVectors(10, 1'000);
+  auto filePath = TempFilePath::create();
+  writeToFile(filePath->getPath(), vectors);
+  createDuckDbTable(vectors);
+  const auto fileSize = fs::file_size(filePath->getPath());
+
+  auto task =
+      AssertQueryBuilder(tableScanNode(), duckDbQueryRunner_)
+          .config(
+              core::QueryConfig::kTableScanSplitMorselBytes,
+              std::to_string(bits::divRoundUp(fileSize, 4)))
+          .split(makeHiveConnectorSplit(filePath->getPath(), 0, fileSize))
+          .maxDrivers(2)
+          .assertResults("SELECT * FROM tmp");
+  ASSERT_EQ(task->taskStats().numTotalSplits, 4);
+
+  // A split of unknown length is not divided.
+  task = AssertQueryBuilder(tableScanNode(), duckDbQueryRunner_)
+             .config(
+                 core::QueryConfig::kTableScanSplitMorselBytes,
+                 std::to_string(bits::divRoundUp(fileSize, 4)))
+             .split(makeHiveConnectorSplit(filePath->getPath()))
+             .assertResults("SELECT * FROM tmp");
+  ASSERT_EQ(task->taskStats().numTotalSplits, 1);
+}
+
 TEST_F(TableScanTest, fileNotFound) {
   auto split =
       exec::test::HiveConnectorSplitBuilder("/path/to/nowhere.orc").build();
@@ -4834,6 +4931,39 @@ TEST_F(TableScanTest, varbinaryPartitionKey) {
   assertQuery(op, split, "SELECT c0, '2021-12-02' FROM tmp");
 }
 
+TEST_F(TableScanTest, remainingFilterOnPartitionKey) {
+  auto vectors = makeVectors(1, 1'000);
+  auto filePath = TempFilePath::create();
+  writeToFile(filePath->getPath(), vectors);
+  createDuckDbTable(vectors);
+
+  ColumnHandleMap assignments = {
+      {"c0", regularColumn("c0", BIGINT())},
+      {"ds", partitionKey("ds", VARCHAR())}};
+  auto plan = PlanBuilder()
+                  .startTableScan()
+                  .outputType(ROW({"c0"}, {BIGINT()}))
+                  .remainingFilter("c0 % 2 = 0 or length(ds) = 10")
+                  .assignments(assignments)
+                  .endTableScan()
+                  .planNode();
+  const auto makeSplit = [&](const std::string& ds) {
+    return exec::test::HiveConnectorSplitBuilder(filePath->getPath())
+        .partitionKey("ds", ds)
+        .build();
+  };
+
+  // The filter is compiled for each split and is true for all the rows of the
+  // first one.
+  auto task = AssertQueryBuilder(plan, duckDbQueryRunner_)
+                  .splits({makeSplit("2021-12-02"), makeSplit("2021-12-2")})
+                  .assertResults(
+                      "SELECT c0 FROM tmp UNION ALL "
+                      "SELECT c0 FROM tmp WHERE c0 % 2 = 0");
+  auto stats = getTableScanRuntimeStats(task);
+  ASSERT_EQ(stats.at("numRemainingFilterBinds").sum, 2);
+}
+
 TEST_F(TableScanTest, timestampPartitionKey) {
   const char* inputs[] = {"2023-10-14 07:00:00.0", "2024-01-06 04:00:00.0"};
   const auto getExpected = [&](bool asLocalTime) {
@@ -5070,6 +5200,42 @@ TEST_F(TableScanTest, dynamicFilterWithRowIndexColumn) {
       .assertResults(resVector);
 }
 
+TEST_F(TableScanTest, topNDynamicFilter) {
+  // The first file has the largest values, so that the threshold pushed down
+  // by the TopN after the first file filters out all rows of the others.
+  const vector_size_t size = 1'000;
+  const size_t numFiles{10};
+  auto filePaths = makeFilePaths(numFiles);
+  std::vector<RowVectorPtr> rows;
+  for (size_t i = 0; i < numFiles; ++i) {
+    rows.push_back(makeRowVector({
+        makeFlatVector<int64_t>(
+            size, [&](auto row) { return (numFiles - i) * size - row; }),
+        makeFlatVector<int32_t>(size, [&](auto row) { return row; }),
+    }));
+    writeToFile(filePaths[i]->getPath(), {rows.back()});
+  }
+  createDuckDbTable(rows);
+
+  core::PlanNodeId scanId;
+  core::PlanNodeId topNId;
+  auto plan = PlanBuilder()
+                  .tableScan(asRowType(rows[0]->type()))
+                  .capturePlanNodeId(scanId)
+                  .topN({"c0 DESC"}, 10, false)
+                  .capturePlanNodeId(topNId)
+                  .planNode();
+  auto task = AssertQueryBuilder(plan, duckDbQueryRunner_)
+                  .splits(makeHiveConnectorSplits(filePaths))
+                  .assertResults(
+                      "SELECT * FROM tmp ORDER BY c0 DESC LIMIT 10", {{0}});
+  const auto planStats = toPlanStats(task->taskStats());
+  ASSERT_EQ(
+      planStats.at(scanId).dynamicFilterStats.producerNodeIds,
+      std::unordered_set<core::PlanNodeId>({topNId}));
+  ASSERT_LT(planStats.at(scanId).outputRows, 2 * size);
+}
+
 // TODO: re-enable this test once we add back driver suspension support for
 // table scan.
 TEST_F(TableScanTest, DISABLED_memoryArbitrationWithSlowTableScan) {
@@ -1842,6 +1842,63 @@ TEST_F(TaskTest, spillDirectoryLifecycleManagement) {
   OperatorTestBase::deleteTaskAndCheckSpillDirectory(task);
 }
 
+TEST_F(TaskTest, overflowSpillDirectory) {
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(1'000, [](auto row) { return row % 300; }),
+      makeFlatVector<int64_t>(1'000, [](auto row) { return row; }),
+  });
+  core::PlanNodeId aggrNodeId;
+  const auto plan = PlanBuilder()
+                        .values({data})
+                        .singleAggregation({"c0"}, {"sum(c1)"}, {})
+                        .capturePlanNodeId(aggrNodeId)
+                        .planNode();
+  CursorParameters params;
+  params.planNode = plan;
+  params.queryCtx = core::QueryCtx::create(driverExecutor_.get());
+  params.queryCtx->testingOverrideConfigUnsafe(
+      {{core::QueryConfig::kSpillEnabled, "true"},
+       {core::QueryConfig::kAggregationSpillEnabled, "true"}});
+  params.maxDrivers = 1;
+
+  // Simulates other tasks that have used up the local spill tier.
+  const auto prevQuota = common::localSpillQuota();
+  common::setLocalSpillQuota(1);
+  common::updateLocalSpilledBytes(1);
+  SCOPE_EXIT {
+    common::updateLocalSpilledBytes(-1);
+    common::setLocalSpillQuota(prevQuota);
+  };
+
+  auto cursor = TaskCursor::create(params);
+  std::shared_ptr<Task> task = cursor->task();
+  auto rootTempDir = exec::test::TempDirectoryPath::create();
+  const auto localDirectoryPath = rootTempDir->getPath() + "/local";
+  const auto overflowDirectoryPath = rootTempDir->getPath() + "/overflow";
+  task->setSpillDirectory(localDirectoryPath, false);
+  task->setOverflowSpillDirectory(overflowDirectoryPath);
+
+  TestScopedSpillInjection scopedSpillInjection(100);
+  while (cursor->moveNext()) {
+  }
+  ASSERT_TRUE(waitForTaskCompletion(task.get(), 5'000'000));
+  EXPECT_EQ(exec::TaskState::kFinished, task->state());
+  auto taskStats = exec::toPlanStats(task->taskStats());
+  auto& stats = taskStats.at(aggrNodeId);
+  ASSERT_GT(stats.spilledRows, 0);
+  ASSERT_GT(stats.customStats.at(Operator::kOverflowSpilledBytes).sum, 0);
+
+  auto fs = filesystems::getFileSystem(overflowDirectoryPath, nullptr);
+  ASSERT_TRUE(fs->exists(overflowDirectoryPath));
+  ASSERT_FALSE(fs->exists(localDirectoryPath));
+
+  // The overflow spill directory goes away with the task.
+  cursor.reset();
+  task.reset();
+  waitForAllTasksToBeDeleted();
+  ASSERT_FALSE(fs->exists(overflowDirectoryPath));
+}
+
 TEST_F(TaskTest, spillDirNotCreated) {
   // Verify that no spill directory is created if spilling is not engaged.
   const std::vector<RowVectorPtr> probeVectors = {makeRowVector(
@@ -16,6 +16,7 @@
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/common/file/FileSystems.h"
 #include "velox/exec/PlanNodeStats.h"
+#include "velox/exec/TopNRowNumber.h"
 #include "velox/exec/tests/utils/AssertQueryBuilder.h"
 #include "velox/exec/tests/utils/OperatorTestBase.h"
 #include "velox/exec/tests/utils/PlanBuilder.h"
@@ -243,6 +244,52 @@ TEST_F(TopNRowNumberTest, manyPartitions) {
   testLimit(1, 1);
 }
 
+TEST_F(TopNRowNumberTest, inlineTopRows) {
+  const vector_size_t size = 20'000;
+  auto data = split(
+      makeRowVector(
+          {"d", "s", "p"},
+          {
+              // Data.
+              makeFlatVector<int64_t>(size, [](auto row) { return row; }),
+              // Sorting key. Unique, so that row numbers are deterministic.
+              makeFlatVector<int64_t>(
+                  size, [](auto row) { return (row * 7'919) % size; }),
+              // Partitioning key.
+              makeFlatVector<int64_t>(
+                  size, [](auto row) { return row % 1'000; }),
+          }),
+      10);
+
+  createDuckDbTable(data);
+
+  auto testLimit = [&](auto limit, size_t outputBatchBytes) {
+    SCOPED_TRACE(
+        fmt::format("Limit: {}, batch bytes: {}", limit, outputBatchBytes));
+    auto plan = PlanBuilder()
+                    .values(data)
+                    .topNRowNumber({"p"}, {"s"}, limit, true)
+                    .planNode();
+
+    AssertQueryBuilder(plan, duckDbQueryRunner_)
+        .config(
+            core::QueryConfig::kPreferredOutputBatchBytes,
+            fmt::format("{}", outputBatchBytes))
+        .assertResults(fmt::format(
+            "SELECT * FROM (SELECT *, row_number() over (partition by p order by s) as rn FROM tmp) "
+            " WHERE rn <= {}",
+            limit));
+  };
+
+  // Output batches of one row split partitions across batches.
+  for (const auto outputBatchBytes : {1, 1'024}) {
+    testLimit(1, outputBatchBytes);
+    testLimit(3, outputBatchBytes);
+    testLimit(TopNRowNumber::kMaxInlineLimit, outputBatchBytes);
+    testLimit(TopNRowNumber::kMaxInlineLimit + 1, outputBatchBytes);
+  }
+}
+
 TEST_F(TopNRowNumberTest, abandonPartialEarly) {
   auto data = makeRowVector(
       {"p", "s"},
@@ -234,6 +234,36 @@ TEST_F(TopNTest, multiBatch) {
   testSingleKey(vectors, "c2", 2'500);
 }
 
+TEST_F(TopNTest, firstKeyThreshold) {
+  // Rows are dropped on the first key once the TopN is full. Covers the
+  // integer key types, nulls, ties on the first key and dictionary encoding.
+  vector_size_t batchSize = 1'000;
+  std::vector<RowVectorPtr> vectors;
+  for (int32_t i = 0; i < 10; ++i) {
+    auto indices = makeIndicesInReverse(batchSize);
+    vectors.push_back(makeRowVector({
+        makeFlatVector<int8_t>(
+            batchSize, [&](auto row) { return (row + i) % 100; }, nullEvery(7)),
+        makeFlatVector<int16_t>(
+            batchSize, [&](auto row) { return row % 300 - i; }, nullEvery(11)),
+        wrapInDictionary(
+            indices,
+            makeFlatVector<int32_t>(
+                batchSize,
+                [&](auto row) { return (row * 7 + i) % 500; },
+                nullEvery(13))),
+        makeFlatVector<int64_t>(
+            batchSize, [&](auto row) { return row * 1'000 + i; }),
+    }));
+  }
+  createDuckDbTable(vectors);
+
+  testTwoKeys(vectors, "c0", "c3", 50);
+  testTwoKeys(vectors, "c1", "c3", 50);
+  testTwoKeys(vectors, "c2", "c3", 50);
+  testSingleKey(vectors, "c3", 50);
+}
+
 TEST_F(TopNTest, empty) {
   vector_size_t batchSize = 1'000;
   std::vector<RowVectorPtr> vectors;
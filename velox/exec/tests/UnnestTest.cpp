@@ -475,6 +475,54 @@ TEST_P(UnnestTest, batchSize) {
   ASSERT_EQ(expectedNumVectors, stats.at(unnestId).outputVectors);
 }
 
+TEST_P(UnnestTest, largeArraySplitAcrossBatches) {
+  // A few large arrays whose elements are split across output batches.
+  auto vector = makeRowVector({
+      makeFlatVector<int64_t>(3, [](auto row) { return row; }),
+      makeArrayVector<int64_t>(
+          3,
+          [](auto row) { return 1'000 * (row + 1); },
+          [](auto row, auto index) { return row * 10'000 + index; }),
+  });
+
+  std::vector<int64_t> rows;
+  std::vector<int64_t> values;
+  std::vector<int64_t> ordinals;
+  for (auto row = 0; row < 3; ++row) {
+    for (auto i = 0; i < 1'000 * (row + 1); ++i) {
+      rows.push_back(row);
+      values.push_back(row * 10'000 + i);
+      ordinals.push_back(i + 1);
+    }
+  }
+  auto expected = makeRowVector({
+      makeFlatVector<int64_t>(rows),
+      makeFlatVector<int64_t>(values),
+      makeFlatVector<int64_t>(ordinals),
+  });
+
+  auto op = PlanBuilder()
+                .values({vector})
+                .unnest({"c0"}, {"c1"}, "ordinal")
+                .planNode();
+  auto params = makeCursorParameters(op);
+  assertQuery(params, expected);
+
+  // The unnested column of each batch is a slice of the elements of 'c1'.
+  const auto* elements = vector->childAt(1)
+                             ->as<ArrayVector>()
+                             ->elements()
+                             ->asFlatVector<int64_t>();
+  auto [cursor, results] = readCursor(params, [](auto /*task*/) {});
+  for (const auto& result : results) {
+    auto* unnested = result->childAt(1)->asFlatVector<int64_t>();
+    ASSERT_NE(unnested, nullptr);
+    const auto* first = unnested->rawValues();
+    ASSERT_GE(first, elements->rawValues());
+    ASSERT_LT(first, elements->rawValues() + elements->size());
+  }
+}
+
 VELOX_INSTANTIATE_TEST_SUITE_P(
     UnnestTest,
     UnnestTest,
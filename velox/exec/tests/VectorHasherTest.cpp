@@ -367,6 +367,38 @@ TEST_F(VectorHasherTest, dictionary) {
   }
 }
 
+TEST_F(VectorHasherTest, dictionaryHashesAcrossBatches) {
+  auto hasher = exec::VectorHasher::create(BIGINT(), 1);
+  auto base = makeFlatVector<int64_t>(10, [](auto row) { return row + 3; });
+  raw_vector<uint64_t> hashes(100);
+
+  auto expectHashes = [&](const VectorPtr& vector,
+                          const SelectivityVector& rows,
+                          int64_t offset) {
+    hasher->decode(*vector, rows);
+    hasher->hash(rows, false, hashes);
+    rows.applyToSelected([&](auto row) {
+      EXPECT_EQ(hashes[row], folly::hasher<int64_t>()(row % 10 + offset))
+          << "at " << row;
+    });
+  };
+
+  // The first batch has more rows than the dictionary and caches its hashes.
+  expectHashes(makeDictionary(100, base), allRows_, 3);
+  // Smaller batches over the same dictionary use the cached hashes.
+  SelectivityVector fewRows(5);
+  expectHashes(makeDictionary(5, base), fewRows, 3);
+  expectHashes(makeDictionary(100, base), oddRows_, 3);
+
+  // A new dictionary of the same size does not use the hashes of the old one.
+  auto otherBase =
+      makeFlatVector<int64_t>(10, [](auto row) { return row + 20; });
+  expectHashes(makeDictionary(100, otherBase), allRows_, 20);
+  expectHashes(makeDictionary(5, otherBase), fewRows, 20);
+  // Back to the first dictionary.
+  expectHashes(makeDictionary(5, base), fewRows, 3);
+}
+
 // Tests how strings are mapped to uint64_t (if they fit) and to
 // consecutive ids of distinct values for the general case.
 TEST_F(VectorHasherTest, stringIds) {
@@ -1061,6 +1093,43 @@ TEST_F(VectorHasherTest, simdRange) {
   }
 }
 
+TEST_F(VectorHasherTest, simdRangeUnpaddedValues) {
+  // Values in memory not allocated by Velox, e.g. imported from Arrow, have no
+  // SIMD padding. The ids must be the same as for padded values.
+  constexpr int32_t kNumRows = 1001;
+  std::vector<int64_t> data(kNumRows);
+  std::iota(data.begin(), data.end(), 0);
+  auto padded = makeFlatVector<int64_t>(data);
+  auto unpadded = std::make_shared<FlatVector<int64_t>>(
+      pool(),
+      BIGINT(),
+      nullptr,
+      kNumRows,
+      BufferView<DummyReleaser>::create(
+          reinterpret_cast<const uint8_t*>(data.data()),
+          kNumRows * sizeof(int64_t),
+          DummyReleaser{}),
+      std::vector<BufferPtr>{});
+  ASSERT_TRUE(padded->hasSimdPaddedValues());
+  ASSERT_FALSE(unpadded->hasSimdPaddedValues());
+
+  auto hasher = exec::VectorHasher::create(BIGINT(), 0);
+  SelectivityVector rows(kNumRows);
+  raw_vector<uint64_t> result(kNumRows);
+  hasher->decode(*padded, rows);
+  hasher->computeValueIds(rows, result);
+  hasher->enableValueRange(1, 0);
+
+  exec::VectorHasher::ScratchMemory scratch;
+  raw_vector<uint64_t> paddedIds(kNumRows);
+  hasher->lookupValueIds(*padded, rows, scratch, paddedIds);
+  raw_vector<uint64_t> unpaddedIds(kNumRows);
+  hasher->lookupValueIds(*unpadded, rows, scratch, unpaddedIds);
+  for (auto i = 0; i < kNumRows; ++i) {
+    ASSERT_EQ(paddedIds[i], unpaddedIds[i]) << i;
+  }
+}
+
 TEST_F(VectorHasherTest, typeMismatch) {
   auto hasher = VectorHasher::create(BIGINT(), 0);
 
@@ -113,6 +113,92 @@ TEST_F(WindowTest, spill) {
   ASSERT_GT(stats.spilledPartitions, 0);
 }
 
+TEST_F(WindowTest, partitionStreamingSpill) {
+  const vector_size_t size = 1'000;
+  auto data = makeRowVector(
+      {"d", "p", "s"},
+      {
+          // Payload.
+          makeFlatVector<int64_t>(size, [](auto row) { return row; }),
+          // Partition key with one partition much bigger than the others.
+          makeFlatVector<int16_t>(
+              size, [](auto row) { return row < 800 ? 0 : row / 10; }),
+          // Sorting key.
+          makeFlatVector<int32_t>(size, [](auto row) { return row; }),
+      });
+
+  createDuckDbTable({data});
+
+  // The frame needs the whole partition, so PartitionStreamingWindowBuild is
+  // used.
+  const std::string kClause =
+      "sum(d) over (partition by p order by s "
+      "rows between unbounded preceding and unbounded following)";
+  core::PlanNodeId windowId;
+  auto plan = PlanBuilder()
+                  .values(split(data, 10))
+                  .streamingWindow({kClause})
+                  .capturePlanNodeId(windowId)
+                  .planNode();
+
+  auto spillDirectory = TempDirectoryPath::create();
+  TestScopedSpillInjection scopedSpillInjection(100);
+  auto task =
+      AssertQueryBuilder(plan, duckDbQueryRunner_)
+          .config(core::QueryConfig::kPreferredOutputBatchBytes, "1024")
+          .config(core::QueryConfig::kSpillEnabled, "true")
+          .config(core::QueryConfig::kWindowSpillEnabled, "true")
+          .spillDirectory(spillDirectory->getPath())
+          .assertResults(fmt::format("SELECT *, {} FROM tmp", kClause));
+
+  auto taskStats = exec::toPlanStats(task->taskStats());
+  const auto& stats = taskStats.at(windowId);
+
+  ASSERT_GT(stats.spilledBytes, 0);
+  ASSERT_GT(stats.spilledRows, 0);
+  ASSERT_GT(stats.spilledFiles, 0);
+}
+
+TEST_F(WindowTest, localPartition) {
+  const vector_size_t size = 1'000;
+  auto data = makeRowVector(
+      {"d", "p", "s"},
+      {
+          // Payload.
+          makeFlatVector<int64_t>(size, [](auto row) { return row; }),
+          // Partition key.
+          makeFlatVector<int16_t>(size, [](auto row) { return row % 11; }),
+          // Sorting key.
+          makeFlatVector<int32_t>(size, [](auto row) { return row; }),
+      });
+
+  createDuckDbTable({data});
+
+  core::PlanNodeId windowId;
+  auto plan = PlanBuilder()
+                  .values(split(data, 10), /*parallelizable=*/true)
+                  .localPartition(std::vector<std::string>{})
+                  .window({"row_number() over (partition by p order by s)"})
+                  .capturePlanNodeId(windowId)
+                  .planNode();
+
+  for (const bool localPartition : {false, true}) {
+    SCOPED_TRACE(fmt::format("localPartition {}", localPartition));
+    auto task =
+        AssertQueryBuilder(plan, duckDbQueryRunner_)
+            .config(
+                core::QueryConfig::kWindowLocalPartitionEnabled,
+                localPartition)
+            .maxDrivers(4)
+            .assertResults(
+                "SELECT d, p, s, row_number() over (partition by p order by s) "
+                "FROM (SELECT * FROM tmp UNION ALL SELECT * FROM tmp "
+                "UNION ALL SELECT * FROM tmp UNION ALL SELECT * FROM tmp)");
+    const auto planStats = exec::toPlanStats(task->taskStats());
+    ASSERT_EQ(planStats.at(windowId).numDrivers, localPartition ? 4 : 1);
+  }
+}
+
 TEST_F(WindowTest, spillUnsupported) {
   const vector_size_t size = 1'000;
   auto data = makeRowVector(
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/WorkStealingExecutor.h"
+
+#include <folly/synchronization/Baton.h>
+#include <gtest/gtest.h>
+
+#include "velox/exec/tests/utils/AssertQueryBuilder.h"
+#include "velox/exec/tests/utils/OperatorTestBase.h"
+#include "velox/exec/tests/utils/PlanBuilder.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::exec;
+using namespace facebook::velox::exec::test;
+
+class WorkStealingExecutorTest : public OperatorTestBase {};
+
+TEST_F(WorkStealingExecutorTest, remoteAdds) {
+  constexpr int32_t kNumFuncs = 10'000;
+  std::atomic<int32_t> numRun{0};
+  WorkStealingExecutor::Stats stats;
+  {
+    WorkStealingExecutor executor(4);
+    ASSERT_EQ(executor.numThreads(), 4);
+    for (auto i = 0; i < kNumFuncs; ++i) {
+      executor.add([&]() { ++numRun; });
+    }
+    // The destructor runs the functions still queued.
+    stats = executor.stats();
+  }
+  ASSERT_EQ(numRun, kNumFuncs);
+  ASSERT_EQ(stats.numRemoteAdds, kNumFuncs);
+  ASSERT_EQ(stats.numLocalAdds, 0);
+}
+
+TEST_F(WorkStealingExecutorTest, localAddsAreStolen) {
+  constexpr int32_t kNumFuncs = 100;
+  WorkStealingExecutor executor(2);
+  std::atomic<int32_t> numRun{0};
+  folly::Baton<> done;
+  // Adds all functions to the queue of one thread. The other thread has an
+  // empty queue and takes some of them.
+  executor.add([&]() {
+    for (auto i = 0; i < kNumFuncs; ++i) {
+      executor.add([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        if (++numRun == kNumFuncs) {
+          done.post();
+        }
+      });
+    }
+  });
+  done.wait();
+  const auto stats = executor.stats();
+  ASSERT_EQ(stats.numRemoteAdds, 1);
+  ASSERT_EQ(stats.numLocalAdds, kNumFuncs);
+  ASSERT_GT(stats.numSteals, 0);
+}
+
+TEST_F(WorkStealingExecutorTest, throwingFunction) {
+  WorkStealingExecutor executor(1);
+  folly::Baton<> done;
+  executor.add([]() { VELOX_FAIL("Expected"); });
+  executor.add([&]() { done.post(); });
+  done.wait();
+}
+
+TEST_F(WorkStealingExecutorTest, driverExecutor) {
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(1'000, [](auto row) { return row % 17; }),
+  });
+  createDuckDbTable({data});
+  auto plan = PlanBuilder()
+                  .values({data}, false, 10)
+                  .localPartition({"c0"})
+                  .singleAggregation({"c0"}, {"count(1)"})
+                  .planNode();
+
+  auto executor = std::make_unique<WorkStealingExecutor>(4);
+  AssertQueryBuilder(plan, duckDbQueryRunner_)
+      .queryCtx(core::QueryCtx::create(executor.get()))
+      .maxDrivers(4)
+      .assertResults("SELECT c0, count(*) * 10 FROM tmp GROUP BY 1");
+  waitForAllTasksToBeDeleted();
+  executor.reset();
+}
+
+TEST_F(WorkStealingExecutorTest, priorities) {
+  WorkStealingExecutor executor(1);
+  ASSERT_EQ(executor.getNumPriorities(), 3);
+  folly::Baton<> blocked;
+  folly::Baton<> release;
+  folly::Baton<> done;
+  std::vector<int8_t> order;
+  // Keeps the only thread busy while the functions are queued.
+  executor.add([&]() {
+    blocked.post();
+    release.wait();
+  });
+  blocked.wait();
+  executor.addWithPriority(
+      [&]() { order.push_back(folly::Executor::LO_PRI); },
+      folly::Executor::LO_PRI);
+  executor.add([&]() { order.push_back(folly::Executor::MID_PRI); });
+  executor.addWithPriority(
+      [&]() { order.push_back(folly::Executor::HI_PRI); },
+      folly::Executor::HI_PRI);
+  executor.addWithPriority([&]() { done.post(); }, folly::Executor::LO_PRI);
+  release.post();
+  done.wait();
+  ASSERT_EQ(
+      order,
+      std::vector<int8_t>(
+          {folly::Executor::HI_PRI,
+           folly::Executor::MID_PRI,
+           folly::Executor::LO_PRI}));
+}
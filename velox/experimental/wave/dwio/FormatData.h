@@ -244,6 +244,13 @@ struct ColumnOp {
 };
 
 /// Operations on leaf columns. This is specialized for each file format.
+///
+/// Only the test format of exec/tests/utils implements this so far. For
+/// Parquet, PLAIN pages of fixed width values map to kTrivial and bit packed
+/// RLE_DICTIONARY runs map to kDictionaryOnBitpack. The RLE runs of the
+/// hybrid encoding, DELTA_BINARY_PACKED values and definition levels need
+/// new DecodeSteps, and compressed pages need a decompression step on
+/// device.
 class FormatData {
  public:
   virtual ~FormatData() = default;
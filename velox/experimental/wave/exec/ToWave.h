@@ -517,6 +517,10 @@ struct ReadAggregation : public KernelStep {
   int32_t continueLabelN;
 };
 
+/// Inserts 'keys' and 'dependent' of each row into the hash table of
+/// 'state'. Together with JoinProbe and JoinExpand, the steps of a hash join.
+/// Not yet made by CompileState, so a HashBuild or HashProbe ends the Wave
+/// part of a pipeline and the join runs on the CPU.
 struct JoinBuild : public KernelStep {
   StepKind kind() const override {
     return StepKind::kJoinBuild;
@@ -526,6 +530,8 @@ struct JoinBuild : public KernelStep {
   std::vector<AbstractOperand*> dependent;
 };
 
+/// Looks up 'keys' in the hash table of 'state' and sets 'hits' to the first
+/// matching build row of each probe row.
 struct JoinProbe : public KernelStep {
   StepKind kind() const override {
     return StepKind::kJoinProbe;
@@ -540,6 +546,8 @@ struct JoinProbe : public KernelStep {
   int32_t nthWrap{-1};
 };
 
+/// Produces a row for each build row in 'hits' and extracts the build side
+/// 'columns' into 'extract'.
 struct JoinExpand : public KernelStep {
   StepKind kind() const override {
     return StepKind::kJoinExpand;
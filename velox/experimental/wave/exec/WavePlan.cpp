@@ -459,6 +459,9 @@ bool CompileState::tryPlanOperator(
     }
     segments_.back().steps.push_back(read);
   } else {
+    // TODO: Plan HashBuild and HashProbe as JoinBuild, JoinProbe and
+    // JoinExpand steps once their code generation and a host memory fallback
+    // for builds larger than the device memory exist.
     return false;
   }
   return true;
@@ -15,6 +15,9 @@
  */
 #pragma once
 
+#include <folly/Portability.h>
+#include <cstring>
+
 #include "velox/common/base/CountBits.h"
 #include "velox/common/base/Exceptions.h"
 #include "velox/core/CoreTypeSystem.h"
@@ -194,6 +197,114 @@ Status toDecimalValue(
   }
   return status;
 }
+
+/// Returns true if the 8 bytes at 'data' are ASCII digits and sets 'value' to
+/// the number they spell. Checks and converts all 8 bytes at once.
+inline bool parseEightDigits(const char* data, uint64_t& value) {
+  if constexpr (!folly::kIsLittleEndian) {
+    return false;
+  }
+  uint64_t chunk;
+  std::memcpy(&chunk, data, sizeof(chunk));
+  // Each byte is in ['0', '9'] if its high nibble and the high nibble of the
+  // byte plus 6 are both 3.
+  if (((chunk & 0xF0F0F0F0F0F0F0F0) |
+       (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) !=
+      0x3333333333333333) {
+    return false;
+  }
+  // Combines the digits in pairs, then in fours, then all 8.
+  chunk = ((chunk & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+  chunk = ((chunk & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+  value = ((chunk & 0x0000FFFF0000FFFF) * 42949672960001) >> 32;
+  return true;
+}
+
+/// Returns true if the 'size' bytes at 'data' are ASCII digits and sets
+/// 'value' to the number they spell. 'size' must be in [1, 19].
+inline bool parseDigits(const char* data, size_t size, uint64_t& value) {
+  value = 0;
+  size_t i = 0;
+  for (; i < size % 8; ++i) {
+    const uint8_t digit = data[i] - '0';
+    if (digit > 9) {
+      return false;
+    }
+    value = value * 10 + digit;
+  }
+  for (; i < size; i += 8) {
+    uint64_t digits;
+    if (!parseEightDigits(data + i, digits)) {
+      return false;
+    }
+    value = value * 100'000'000 + digits;
+  }
+  return true;
+}
+
+/// Casts the integers of up to 18 digits with an optional '-' in front, which
+/// is the common shape of the numeric strings. Returns false for the other
+/// strings and the values out of range of T, which are left to the per-row
+/// cast so that they get the same result and errors as before.
+template <typename T>
+inline bool tryCastDigitsToInteger(const StringView& input, T& value) {
+  const bool negative = input.size() > 0 && input.data()[0] == '-';
+  const auto numDigits = input.size() - negative;
+  uint64_t digits;
+  if (numDigits == 0 || numDigits > 18 ||
+      !parseDigits(input.data() + negative, numDigits, digits)) {
+    return false;
+  }
+  const auto signedValue =
+      negative ? -static_cast<int64_t>(digits) : static_cast<int64_t>(digits);
+  if (signedValue < std::numeric_limits<T>::min() ||
+      signedValue > std::numeric_limits<T>::max()) {
+    return false;
+  }
+  value = signedValue;
+  return true;
+}
+
+/// Casts the numbers of up to 15 digits with an optional '-' in front and an
+/// optional '.' between digits, e.g. '-12.345'. Both the digits and the power
+/// of ten are then exact doubles, so that their quotient is the correctly
+/// rounded value the cast hooks return. Returns false for the other strings.
+inline bool tryCastDigitsToDouble(const StringView& input, double& value) {
+  static constexpr double kPowersOfTen[] = {
+      1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+      1e13, 1e14, 1e15};
+  const char* data = input.data();
+  const size_t size = input.size();
+  if (size == 0) {
+    return false;
+  }
+  const bool negative = data[0] == '-';
+  const char* dot = static_cast<const char*>(
+      std::memchr(data + negative, '.', size - negative));
+  const size_t numWholeDigits =
+      (dot ? dot - data : size) - static_cast<size_t>(negative);
+  const size_t numFractionalDigits = dot ? data + size - dot - 1 : 0;
+  if (numWholeDigits == 0 || (dot && numFractionalDigits == 0) ||
+      numWholeDigits + numFractionalDigits > 15) {
+    return false;
+  }
+  uint64_t whole;
+  if (!parseDigits(data + negative, numWholeDigits, whole)) {
+    return false;
+  }
+  uint64_t fraction = 0;
+  if (dot && !parseDigits(dot + 1, numFractionalDigits, fraction)) {
+    return false;
+  }
+  const auto mantissa =
+      whole * static_cast<uint64_t>(kPowersOfTen[numFractionalDigits]) +
+      fraction;
+  value = static_cast<double>(mantissa) / kPowersOfTen[numFractionalDigits];
+  if (negative) {
+    value = -value;
+  }
+  return true;
+}
 } // namespace detail
 
 template <typename Func>
@@ -389,6 +500,42 @@ void CastExpr::applyDecimalCastKernel(
   const auto& fromPrecisionScale = getDecimalPrecisionScale(*fromType);
   const auto& toPrecisionScale = getDecimalPrecisionScale(*toType);
 
+  if constexpr (
+      std::is_same_v<TInput, int64_t> && std::is_same_v<TOutput, int64_t>) {
+    // Short decimals with at least as many integer digits in 'toType', and one
+    // more if rounding, cannot overflow. They are rescaled without checks in
+    // 64 bits.
+    const int32_t fromIntegerDigits =
+        fromPrecisionScale.first - fromPrecisionScale.second;
+    const int32_t toIntegerDigits =
+        toPrecisionScale.first - toPrecisionScale.second;
+    const int32_t scaleDifference =
+        toPrecisionScale.second - fromPrecisionScale.second;
+    if (toIntegerDigits >= fromIntegerDigits + (scaleDifference < 0 ? 1 : 0)) {
+      const auto factor =
+          static_cast<int64_t>(DecimalUtil::kPowersOfTen[abs(scaleDifference)]);
+      if (scaleDifference >= 0) {
+        rows.applyToSelected([&](vector_size_t row) {
+          castResultRawBuffer[row] = sourceVector->valueAt(row) * factor;
+        });
+      } else {
+        // Rounds half away from zero like DecimalUtil::rescaleWithRoundUp().
+        rows.applyToSelected([&](vector_size_t row) {
+          const auto value = sourceVector->valueAt(row);
+          const auto remainder = value % factor;
+          auto rescaled = value / factor;
+          if (value >= 0 && remainder >= factor / 2) {
+            ++rescaled;
+          } else if (remainder <= -factor / 2) {
+            --rescaled;
+          }
+          castResultRawBuffer[row] = rescaled;
+        });
+      }
+      return;
+    }
+  }
+
   applyToSelectedNoThrowLocal(
       context, rows, castResult, [&](vector_size_t row) {
         TOutput rescaledValue;
@@ -689,21 +836,52 @@ void CastExpr::applyCastPrimitives(
   auto* resultFlatVector = result->as<FlatVector<To>>();
   auto* inputSimpleVector = input.as<SimpleVector<From>>();
 
+  // Casts the strings of the common numeric shapes first, without the per-row
+  // overhead. The rest go through the cast kernel below.
+  const SelectivityVector* castRows = &rows;
+  LocalSelectivityVector remainingRows(context);
+  if constexpr (
+      FromKind == TypeKind::VARCHAR &&
+      (ToKind == TypeKind::TINYINT || ToKind == TypeKind::SMALLINT ||
+       ToKind == TypeKind::INTEGER || ToKind == TypeKind::BIGINT ||
+       ToKind == TypeKind::DOUBLE)) {
+    auto* remaining = remainingRows.get(rows);
+    rows.applyToSelected([&](vector_size_t row) {
+      const auto value = inputSimpleVector->valueAt(row);
+      To output;
+      bool done;
+      if constexpr (ToKind == TypeKind::DOUBLE) {
+        done = detail::tryCastDigitsToDouble(value, output);
+      } else {
+        done = detail::tryCastDigitsToInteger(value, output);
+      }
+      if (done) {
+        resultFlatVector->set(row, output);
+        remaining->setValid(row, false);
+      }
+    });
+    remaining->updateBounds();
+    if (!remaining->hasSelections()) {
+      return;
+    }
+    castRows = remaining;
+  }
+
   switch (hooks_->getPolicy()) {
     case LegacyCastPolicy:
-      applyToSelectedNoThrowLocal(context, rows, result, [&](int row) {
+      applyToSelectedNoThrowLocal(context, *castRows, result, [&](int row) {
         applyCastKernel<ToKind, FromKind, util::LegacyCastPolicy>(
             row, context, inputSimpleVector, resultFlatVector);
       });
       break;
     case PrestoCastPolicy:
-      applyToSelectedNoThrowLocal(context, rows, result, [&](int row) {
+      applyToSelectedNoThrowLocal(context, *castRows, result, [&](int row) {
         applyCastKernel<ToKind, FromKind, util::PrestoCastPolicy>(
             row, context, inputSimpleVector, resultFlatVector);
       });
       break;
     case SparkCastPolicy:
-      applyToSelectedNoThrowLocal(context, rows, result, [&](int row) {
+      applyToSelectedNoThrowLocal(context, *castRows, result, [&](int row) {
         applyCastKernel<ToKind, FromKind, util::SparkCastPolicy>(
             row, context, inputSimpleVector, resultFlatVector);
       });
@@ -489,6 +489,12 @@ class EvalCtx {
     return execCtx_->vectorPool();
   }
 
+  /// Returns the arena for scratch memory that is freed at the end of the
+  /// current ExprSet::eval. See core::ExecCtx::batchArena().
+  memory::BatchArena* batchArena() const {
+    return execCtx_->batchArena();
+  }
+
   VectorPtr getVector(const TypePtr& type, vector_size_t size) {
     return execCtx_->getVector(type, size);
   }
@@ -1357,6 +1357,7 @@ inline bool isPeelable(VectorEncoding::Simple encoding) {
   switch (encoding) {
     case VectorEncoding::Simple::CONSTANT:
     case VectorEncoding::Simple::DICTIONARY:
+    case VectorEncoding::Simple::SEQUENCE:
       return true;
     default:
       return false;
@@ -1460,7 +1461,9 @@ bool Expr::applyFunctionWithPeeling(
       // If we have a single input, velox needs to ensure that the
       // vectorFunction would receive a flat or constant input.
       for (int i = 0; i < inputValues_.size(); ++i) {
-        if (inputValues_[i]->encoding() == VectorEncoding::Simple::DICTIONARY) {
+        const auto encoding = inputValues_[i]->encoding();
+        if (encoding == VectorEncoding::Simple::DICTIONARY ||
+            encoding == VectorEncoding::Simple::SEQUENCE) {
           BaseVector::flattenVector(inputValues_[i]);
         }
       }
@@ -1524,7 +1527,20 @@ void Expr::applyFunction(
       : std::nullopt;
 
   try {
-    vectorFunction_->apply(rows, inputValues_, type(), context, result);
+    if (!valueCache_ || !valueCache_->enabled() ||
+        !valueCache_->eval(
+            rows,
+            *inputValues_[valueCache_->argIndex()],
+            type(),
+            context,
+            [&](const SelectivityVector& applyRows, VectorPtr& applyResult) {
+              vectorFunction_->apply(
+                  applyRows, inputValues_, type(), context, applyResult);
+            },
+            stats_,
+            result)) {
+      vectorFunction_->apply(rows, inputValues_, type(), context, result);
+    }
   } catch (const VeloxException&) {
     throw;
   } catch (const std::exception& e) {
@@ -1899,6 +1915,7 @@ void ExprSet::eval(
     const SelectivityVector& rows,
     EvalCtx& context,
     std::vector<VectorPtr>& result) {
+  core::ExecCtx::BatchScope batchScope(*context.execCtx());
   result.resize(exprs_.size());
   if (initialize) {
     clearSharedSubexprs();
@@ -1966,6 +1983,7 @@ void ExprSetSimplified::eval(
     const SelectivityVector& rows,
     EvalCtx& context,
     std::vector<VectorPtr>& result) {
+  core::ExecCtx::BatchScope batchScope(*context.execCtx());
   result.resize(exprs_.size());
   if (initialize) {
     clearSharedSubexprs();
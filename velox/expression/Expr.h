@@ -25,6 +25,7 @@
 #include "velox/core/Expressions.h"
 #include "velox/expression/DecodedArgs.h"
 #include "velox/expression/EvalCtx.h"
+#include "velox/expression/ExprValueCache.h"
 #include "velox/expression/VectorFunction.h"
 #include "velox/type/Subfield.h"
 #include "velox/vector/SimpleVector.h"
@@ -50,20 +51,29 @@ struct ExprStats {
   /// evaluation of rows.
   bool defaultNullRowsSkipped{false};
 
+  /// Number of rows whose results came from the value cache and number of
+  /// rows evaluated to fill it. See ExprValueCache.
+  uint64_t numValueCacheHits{0};
+  uint64_t numValueCacheMisses{0};
+
   void add(const ExprStats& other) {
     timing.add(other.timing);
     numProcessedRows += other.numProcessedRows;
     numProcessedVectors += other.numProcessedVectors;
     defaultNullRowsSkipped |= other.defaultNullRowsSkipped;
+    numValueCacheHits += other.numValueCacheHits;
+    numValueCacheMisses += other.numValueCacheMisses;
   }
 
   std::string toString() const {
     return fmt::format(
-        "timing: {}, numProcessedRows: {}, numProcessedVectors: {}, defaultNullRowsSkipped: {}",
+        "timing: {}, numProcessedRows: {}, numProcessedVectors: {}, defaultNullRowsSkipped: {}, numValueCacheHits: {}, numValueCacheMisses: {}",
         timing.toString(),
         numProcessedRows,
         numProcessedVectors,
-        defaultNullRowsSkipped ? "true" : "false");
+        defaultNullRowsSkipped ? "true" : "false",
+        numValueCacheHits,
+        numValueCacheMisses);
   }
 };
 
@@ -384,6 +394,16 @@ class Expr {
     return vectorFunction_;
   }
 
+  /// Caches the results of the function for the values of its only
+  /// non-constant input, which is at 'argIndex'. See ExprValueCache.
+  void enableValueCache(column_index_t argIndex, uint32_t maxEntries) {
+    valueCache_ = std::make_unique<ExprValueCache>(argIndex, maxEntries);
+  }
+
+  const ExprValueCache* valueCache() const {
+    return valueCache_.get();
+  }
+
   const VectorFunctionMetadata& vectorFunctionMetadata() const {
     return vectorFunctionMetadata_;
   }
@@ -675,6 +695,10 @@ class Expr {
   // The indices that are valid in 'dictionaryCache_'.
   std::unique_ptr<SelectivityVector> cachedDictionaryIndices_;
 
+  // Results for the values of the only non-constant input. Set by
+  // enableValueCache().
+  std::unique_ptr<ExprValueCache> valueCache_;
+
   /// Runtime statistics. CPU time, wall time and number of processed rows.
   ExprStats stats_;
 
@@ -21,8 +21,10 @@
 #include "velox/expression/ConstantExpr.h"
 #include "velox/expression/Expr.h"
 #include "velox/expression/FieldReference.h"
+#include "velox/expression/FusedExpr.h"
 #include "velox/expression/LambdaExpr.h"
 #include "velox/expression/RowConstructor.h"
+#include "velox/expression/ScopedVarSetter.h"
 #include "velox/expression/SimpleFunctionRegistry.h"
 #include "velox/expression/SpecialFormRegistry.h"
 #include "velox/expression/SwitchExpr.h"
@@ -85,6 +87,9 @@ struct Scope {
 
   std::vector<TypedExprPtr> rewrittenExpressions;
 
+  // True while compiling the inputs of an expression to be fused.
+  bool fusing{false};
+
   Scope(std::vector<std::string>&& _locals, Scope* _parent, ExprSet* _exprSet)
       : locals(_locals), parent(_parent), exprSet(_exprSet) {}
 
@@ -299,6 +304,33 @@ std::shared_ptr<Expr> compileLambda(
       config.exprTrackCpuUsage());
 }
 
+// Returns the index of the only non-constant input of 'expr' if the results
+// of 'expr' can be cached for the values of that input. See ExprValueCache.
+std::optional<column_index_t> valueCacheArg(const Expr& expr) {
+  if (expr.isSpecialForm() || !expr.vectorFunction() ||
+      !expr.isDeterministic()) {
+    return std::nullopt;
+  }
+  std::optional<column_index_t> argIndex;
+  for (column_index_t i = 0; i < expr.inputs().size(); ++i) {
+    if (dynamic_cast<const ConstantExpr*>(expr.inputs()[i].get())) {
+      continue;
+    }
+    if (argIndex.has_value()) {
+      return std::nullopt;
+    }
+    argIndex = i;
+  }
+  if (!argIndex.has_value()) {
+    return std::nullopt;
+  }
+  const auto& type = expr.inputs()[*argIndex]->type();
+  if (!type->isVarchar() && !type->isVarbinary()) {
+    return std::nullopt;
+  }
+  return argIndex;
+}
+
 ExprPtr tryFoldIfConstant(const ExprPtr& expr, Scope* scope) {
   if (expr->isConstant() && scope->exprSet->execCtx()) {
     try {
@@ -388,6 +420,11 @@ ExprPtr compileRewrittenExpression(
 
   const bool trackCpuUsage = config.exprTrackCpuUsage();
 
+  // Only the largest fusable trees are fused, not their subtrees.
+  const bool fuse = config.exprFusionEnabled() && !scope->fusing &&
+      FusedExpr::canFuse(expr);
+  ScopedVarSetter<bool> fusing(&scope->fusing, true, fuse);
+
   ExprPtr result;
   auto resultType = expr->type();
   auto compiledInputs = compileInputs(
@@ -519,11 +556,22 @@ ExprPtr compileRewrittenExpression(
   }
 
   result->computeMetadata();
+  if (config.exprValueCacheMaxEntries() > 0) {
+    if (auto argIndex = valueCacheArg(*result)) {
+      result->enableValueCache(*argIndex, config.exprValueCacheMaxEntries());
+    }
+  }
 
   // If the expression is constant folding it is redundant.
   auto folded = enableConstantFolding && !isConstantExpr
       ? tryFoldIfConstant(result, scope)
       : result;
+  if (fuse) {
+    if (auto fused = FusedExpr::tryFuse(folded)) {
+      fused->computeMetadata();
+      folded = fused;
+    }
+  }
   scope->visited[expr.get()] = folded;
   return folded;
 }
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/expression/ExprValueCache.h"
+
+#include "velox/expression/EvalCtx.h"
+#include "velox/expression/Expr.h"
+
+namespace facebook::velox::exec {
+
+bool ExprValueCache::eval(
+    const SelectivityVector& rows,
+    const BaseVector& arg,
+    const TypePtr& resultType,
+    EvalCtx& context,
+    const ApplyFunction& apply,
+    ExprStats& stats,
+    VectorPtr& result) {
+  LocalDecodedVector decodedHolder(context, arg, rows);
+  auto* decoded = decodedHolder.get();
+  LocalSelectivityVector hitRows(context, rows.end());
+  LocalSelectivityVector missRows(context, rows.end());
+  LocalSelectivityVector applyRows(context, rows.end());
+  hitRows->clearAll();
+  missRows->clearAll();
+  applyRows->clearAll();
+  sourceRows_.resize(rows.end());
+
+  // The first row of each value not in the cache.
+  folly::F14FastMap<StringView, vector_size_t> newValues;
+  std::vector<vector_size_t> newRows;
+  rows.applyToSelected([&](auto row) {
+    if (decoded->isNullAt(row)) {
+      missRows->setValid(row, true);
+      applyRows->setValid(row, true);
+      sourceRows_[row] = row;
+      return;
+    }
+    const auto value = decoded->valueAt<StringView>(row);
+    const std::string_view key(value.data(), value.size());
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      hitRows->setValid(row, true);
+      sourceRows_[row] = it->second;
+      return;
+    }
+    missRows->setValid(row, true);
+    auto [newIt, inserted] = newValues.emplace(value, row);
+    if (inserted) {
+      applyRows->setValid(row, true);
+      newRows.push_back(row);
+    }
+    sourceRows_[row] = newIt->second;
+  });
+  hitRows->updateBounds();
+  missRows->updateBounds();
+  applyRows->updateBounds();
+
+  VectorPtr newResults;
+  if (applyRows->hasSelections()) {
+    apply(*applyRows, newResults);
+    if (!newResults ||
+        (context.errors() != nullptr &&
+         !applyRows->testSelected([&](auto row) {
+           return !context.errors()->hasErrorAt(row);
+         }))) {
+      return false;
+    }
+  }
+
+  context.ensureWritable(rows, resultType, result);
+  if (hitRows->hasSelections()) {
+    result->copy(values_.get(), *hitRows, sourceRows_.data());
+  }
+  if (missRows->hasSelections()) {
+    result->copy(newResults.get(), *missRows, sourceRows_.data());
+  }
+
+  const auto numRows = rows.countSelected();
+  const auto numApplied = applyRows->countSelected();
+  stats.numValueCacheHits += numRows - numApplied;
+  stats.numValueCacheMisses += numApplied;
+  add(newRows, *decoded, newResults);
+  updateSample(numRows - numApplied, numRows);
+  return true;
+}
+
+void ExprValueCache::add(
+    const std::vector<vector_size_t>& newRows,
+    const DecodedVector& arg,
+    const VectorPtr& newResults) {
+  const auto numNew = std::min<vector_size_t>(
+      newRows.size(), maxEntries_ - entries_.size());
+  if (!enabled_ || numNew <= 0) {
+    return;
+  }
+  if (!values_) {
+    values_ = BaseVector::create(newResults->type(), 0, newResults->pool());
+  }
+  const auto offset = values_->size();
+  values_->resize(offset + numNew);
+  for (vector_size_t i = 0; i < numNew; ++i) {
+    const auto row = newRows[i];
+    const auto value = arg.valueAt<StringView>(row);
+    entries_.emplace(std::string(value.data(), value.size()), offset + i);
+    values_->copy(newResults.get(), offset + i, row, 1);
+  }
+}
+
+void ExprValueCache::updateSample(uint64_t numHits, uint64_t numRows) {
+  sampleHits_ += numHits;
+  sampleRows_ += numRows;
+  if (sampleRows_ < kSampleRows) {
+    return;
+  }
+  if (sampleHits_ * 2 < sampleRows_) {
+    enabled_ = false;
+    entries_.clear();
+    values_.reset();
+  }
+  sampleHits_ = 0;
+  sampleRows_ = 0;
+}
+
+} // namespace facebook::velox::exec
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#pragma once
+
+#include <folly/container/F14Map.h>
+
+#include "velox/vector/BaseVector.h"
+
+namespace facebook::velox::exec {
+
+class EvalCtx;
+struct ExprStats;
+
+/// Caches the results of a deterministic function for the distinct values of
+/// its only non-constant argument, which is a string, e.g. 's' in
+/// regexp_like(s, 'pattern') or json_extract(s, '$.a'). The function is
+/// evaluated once per distinct value whether or not 's' is dictionary encoded.
+/// Holds at most 'maxEntries' values. Turns itself off for good if less than
+/// half of a sample of rows do not need evaluation.
+class ExprValueCache {
+ public:
+  /// Evaluates the function on 'rows' into 'result'.
+  using ApplyFunction =
+      std::function<void(const SelectivityVector& rows, VectorPtr& result)>;
+
+  ExprValueCache(column_index_t argIndex, uint32_t maxEntries)
+      : argIndex_(argIndex), maxEntries_(maxEntries) {}
+
+  /// The index of the non-constant argument.
+  column_index_t argIndex() const {
+    return argIndex_;
+  }
+
+  bool enabled() const {
+    return enabled_;
+  }
+
+  /// Sets 'rows' of 'result' to the results of the function for the values of
+  /// 'arg'. Calls 'apply' on one row per distinct value not in the cache.
+  /// Returns false without setting 'result' if 'apply' reported errors, in
+  /// which case the caller evaluates all of 'rows'.
+  bool eval(
+      const SelectivityVector& rows,
+      const BaseVector& arg,
+      const TypePtr& resultType,
+      EvalCtx& context,
+      const ApplyFunction& apply,
+      ExprStats& stats,
+      VectorPtr& result);
+
+  /// Number of cached values.
+  vector_size_t size() const {
+    return entries_.size();
+  }
+
+ private:
+  static constexpr uint64_t kSampleRows = 1'024;
+
+  // Adds the values at 'newRows' of 'arg' with results at the same rows of
+  // 'newResults' as long as there is room.
+  void add(
+      const std::vector<vector_size_t>& newRows,
+      const DecodedVector& arg,
+      const VectorPtr& newResults);
+
+  // Turns the cache off if the hit rate of the last sample is too low.
+  void updateSample(uint64_t numHits, uint64_t numRows);
+
+  const column_index_t argIndex_;
+  const uint32_t maxEntries_;
+  bool enabled_{true};
+
+  // Maps the cached values to their positions in 'values_'.
+  folly::F14FastMap<std::string, vector_size_t> entries_;
+  // The results for the cached values.
+  VectorPtr values_;
+
+  uint64_t sampleHits_{0};
+  uint64_t sampleRows_{0};
+
+  // For each row, the position in 'values_' or in the results of 'apply' to
+  // copy from.
+  std::vector<vector_size_t> sourceRows_;
+};
+
+} // namespace facebook::velox::exec
@@ -0,0 +1,672 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/expression/FusedExpr.h"
+
+#include <cmath>
+
+#include <folly/String.h>
+#include <folly/Synchronized.h>
+#include <folly/container/F14Map.h>
+
+#include "velox/expression/ConjunctExpr.h"
+#include "velox/expression/ConstantExpr.h"
+#include "velox/expression/FieldReference.h"
+
+namespace facebook::velox::exec {
+
+enum class FusedOp {
+  kField,
+  kConstant,
+  kPlus,
+  kMinus,
+  kMultiply,
+  kDivide,
+  kEq,
+  kNeq,
+  kLt,
+  kLte,
+  kGt,
+  kGte,
+  kAnd,
+  kOr,
+};
+
+struct FusedInstruction {
+  FusedOp op;
+  // The kind of the operands, or of the value of a field or constant.
+  TypeKind kind;
+  // The instructions that produce the operands.
+  std::vector<int32_t> args;
+  // The field ordinal of a kField.
+  int32_t field{-1};
+  // The bits of the value of a kConstant.
+  int64_t constant{0};
+};
+
+struct FusedProgram {
+  // Each instruction only reads the results of earlier ones. The last one
+  // produces the result.
+  std::vector<FusedInstruction> instructions;
+};
+
+namespace {
+
+// The number of rows evaluated at a time. The values of an instruction for a
+// block take at most 2KB.
+constexpr int32_t kBlockSize = 256;
+
+template <typename F>
+auto dispatchKind(TypeKind kind, F&& func) {
+  switch (kind) {
+    case TypeKind::BOOLEAN:
+      return func(bool{});
+    case TypeKind::TINYINT:
+      return func(int8_t{});
+    case TypeKind::SMALLINT:
+      return func(int16_t{});
+    case TypeKind::INTEGER:
+      return func(int32_t{});
+    case TypeKind::BIGINT:
+      return func(int64_t{});
+    case TypeKind::REAL:
+      return func(float{});
+    case TypeKind::DOUBLE:
+      return func(double{});
+    default:
+      VELOX_UNREACHABLE("Unexpected kind {}", mapTypeKindToName(kind));
+  }
+}
+
+bool isFusableType(const TypePtr& type) {
+  switch (type->kind()) {
+    case TypeKind::BOOLEAN:
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+    case TypeKind::REAL:
+    case TypeKind::DOUBLE:
+      return !type->isDecimal() && !type->providesCustomComparison();
+    default:
+      return false;
+  }
+}
+
+std::optional<FusedOp> fusedOp(const std::string& name) {
+  static const folly::F14FastMap<std::string, FusedOp> kOps = {
+      {"plus", FusedOp::kPlus},
+      {"minus", FusedOp::kMinus},
+      {"multiply", FusedOp::kMultiply},
+      {"divide", FusedOp::kDivide},
+      {"eq", FusedOp::kEq},
+      {"neq", FusedOp::kNeq},
+      {"lt", FusedOp::kLt},
+      {"lte", FusedOp::kLte},
+      {"gt", FusedOp::kGt},
+      {"gte", FusedOp::kGte},
+      {kAnd, FusedOp::kAnd},
+      {kOr, FusedOp::kOr},
+  };
+  // Functions may be registered with a prefix, e.g. 'presto.default.'.
+  const auto pos = name.rfind('.');
+  auto it =
+      kOps.find(pos == std::string::npos ? name : name.substr(pos + 1));
+  if (it == kOps.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+bool isComparison(FusedOp op) {
+  return op >= FusedOp::kEq && op <= FusedOp::kGte;
+}
+
+bool isConjunct(FusedOp op) {
+  return op == FusedOp::kAnd || op == FusedOp::kOr;
+}
+
+bool isFusableCall(
+    FusedOp op,
+    const TypePtr& type,
+    const std::vector<TypePtr>& argTypes) {
+  if (isConjunct(op)) {
+    return type->isBoolean() && argTypes.size() >= 2 &&
+        std::all_of(argTypes.begin(), argTypes.end(), [](const auto& argType) {
+             return argType->isBoolean();
+           });
+  }
+  if (argTypes.size() != 2 || !argTypes[0]->equivalent(*argTypes[1]) ||
+      !isFusableType(argTypes[0]) || argTypes[0]->isBoolean()) {
+    return false;
+  }
+  if (isComparison(op)) {
+    return type->isBoolean();
+  }
+  // Integer division has its own rounding and errors.
+  if (op == FusedOp::kDivide && !argTypes[0]->isReal() &&
+      !argTypes[0]->isDouble()) {
+    return false;
+  }
+  return type->equivalent(*argTypes[0]);
+}
+
+bool canFuseInput(const core::TypedExprPtr& expr) {
+  if (auto field =
+          dynamic_cast<const core::FieldAccessTypedExpr*>(expr.get())) {
+    return field->isInputColumn() && isFusableType(expr->type());
+  }
+  if (dynamic_cast<const core::ConstantTypedExpr*>(expr.get())) {
+    return isFusableType(expr->type());
+  }
+  return FusedExpr::canFuse(expr);
+}
+
+// Translates a compiled tree into a FusedProgram.
+class FusedProgramBuilder {
+ public:
+  // Adds the instructions for 'expr'. Returns the instruction that produces
+  // its result or -1 if 'expr' cannot be fused.
+  int32_t add(Expr& expr) {
+    auto it = added_.find(&expr);
+    if (it != added_.end()) {
+      return it->second;
+    }
+    auto instruction = addImpl(expr);
+    if (instruction >= 0) {
+      added_[&expr] = instruction;
+    }
+    return instruction;
+  }
+
+  int32_t numOperations() const {
+    return numOperations_;
+  }
+
+  std::vector<FieldReference*>& fields() {
+    return fields_;
+  }
+
+  // Returns the program, which is shared with the other fused trees with the
+  // same operations over fields of the same types.
+  std::shared_ptr<const FusedProgram> build();
+
+ private:
+  int32_t addImpl(Expr& expr) {
+    if (expr.is<FusedExpr>()) {
+      return add(*expr.inputs()[0]);
+    }
+    if (expr.is<FieldReference>() && expr.inputs().empty()) {
+      return addField(*expr.as<FieldReference>());
+    }
+    if (expr.is<ConstantExpr>()) {
+      return addConstant(*expr.as<ConstantExpr>());
+    }
+
+    std::optional<FusedOp> op;
+    if (expr.is<ConjunctExpr>() || !expr.isSpecialForm()) {
+      op = fusedOp(expr.name());
+    }
+    if (!op.has_value() || isConjunct(*op) != expr.is<ConjunctExpr>()) {
+      return -1;
+    }
+    std::vector<int32_t> args;
+    std::vector<TypePtr> argTypes;
+    for (const auto& input : expr.inputs()) {
+      const auto arg = add(*input);
+      if (arg < 0) {
+        return -1;
+      }
+      args.push_back(arg);
+      argTypes.push_back(input->type());
+    }
+    if (!isFusableCall(*op, expr.type(), argTypes)) {
+      return -1;
+    }
+    ++numOperations_;
+    return addInstruction({*op, argTypes[0]->kind(), std::move(args)});
+  }
+
+  int32_t addField(FieldReference& field) {
+    if (!isFusableType(field.type())) {
+      return -1;
+    }
+    for (const auto& [ordinal, instruction] : fieldInstructions_) {
+      if (fields_[ordinal]->field() == field.field()) {
+        return instruction;
+      }
+    }
+    const int32_t ordinal = fields_.size();
+    fields_.push_back(&field);
+    const auto instruction = addInstruction(
+        {FusedOp::kField, field.type()->kind(), {}, ordinal});
+    fieldInstructions_.emplace_back(ordinal, instruction);
+    return instruction;
+  }
+
+  int32_t addConstant(const ConstantExpr& constant) {
+    const auto& value = constant.value();
+    if (!isFusableType(constant.type()) || value->isNullAt(0)) {
+      return -1;
+    }
+    const auto kind = constant.type()->kind();
+    const auto bits = dispatchKind(kind, [&](auto tag) {
+      using T = decltype(tag);
+      const T typedValue = value->as<SimpleVector<T>>()->valueAt(0);
+      int64_t bits = 0;
+      ::memcpy(&bits, &typedValue, sizeof(T));
+      return bits;
+    });
+    return addInstruction({FusedOp::kConstant, kind, {}, -1, bits});
+  }
+
+  int32_t addInstruction(FusedInstruction instruction) {
+    fingerprint_ += fmt::format(
+        "{}:{}:{}:{}:{};",
+        static_cast<int>(instruction.op),
+        static_cast<int>(instruction.kind),
+        folly::join(",", instruction.args),
+        instruction.field,
+        instruction.constant);
+    program_.instructions.push_back(std::move(instruction));
+    return program_.instructions.size() - 1;
+  }
+
+  FusedProgram program_;
+  std::string fingerprint_;
+  std::vector<FieldReference*> fields_;
+  // Pairs of field ordinal and the instruction that reads the field.
+  std::vector<std::pair<int32_t, int32_t>> fieldInstructions_;
+  folly::F14FastMap<const Expr*, int32_t> added_;
+  int32_t numOperations_{0};
+};
+
+std::shared_ptr<const FusedProgram> FusedProgramBuilder::build() {
+  // Caps the memory for workloads with many distinct expressions, e.g. with
+  // varying constants.
+  constexpr size_t kMaxCachedPrograms = 10'000;
+  static folly::Synchronized<folly::F14FastMap<
+      std::string,
+      std::shared_ptr<const FusedProgram>>>
+      cache;
+  return cache.withWLock([&](auto& programs) {
+    auto it = programs.find(fingerprint_);
+    if (it != programs.end()) {
+      return it->second;
+    }
+    if (programs.size() >= kMaxCachedPrograms) {
+      programs.clear();
+    }
+    auto program = std::make_shared<const FusedProgram>(std::move(program_));
+    programs.emplace(fingerprint_, program);
+    return program;
+  });
+}
+
+// The loops below have no branches on the values so that the compiler can
+// vectorize them. They return false if the interpreted tree must evaluate the
+// batch.
+template <typename T>
+bool arithmetic(
+    FusedOp op,
+    const T* left,
+    const T* right,
+    T* out,
+    int32_t size) {
+  if constexpr (std::is_integral_v<T>) {
+    bool overflow = false;
+    switch (op) {
+      case FusedOp::kPlus:
+        for (auto i = 0; i < size; ++i) {
+          overflow |= __builtin_add_overflow(left[i], right[i], &out[i]);
+        }
+        break;
+      case FusedOp::kMinus:
+        for (auto i = 0; i < size; ++i) {
+          overflow |= __builtin_sub_overflow(left[i], right[i], &out[i]);
+        }
+        break;
+      case FusedOp::kMultiply:
+        for (auto i = 0; i < size; ++i) {
+          overflow |= __builtin_mul_overflow(left[i], right[i], &out[i]);
+        }
+        break;
+      default:
+        VELOX_UNREACHABLE();
+    }
+    return !overflow;
+  } else {
+    switch (op) {
+      case FusedOp::kPlus:
+        for (auto i = 0; i < size; ++i) {
+          out[i] = left[i] + right[i];
+        }
+        break;
+      case FusedOp::kMinus:
+        for (auto i = 0; i < size; ++i) {
+          out[i] = left[i] - right[i];
+        }
+        break;
+      case FusedOp::kMultiply:
+        for (auto i = 0; i < size; ++i) {
+          out[i] = left[i] * right[i];
+        }
+        break;
+      case FusedOp::kDivide: {
+        // Dialects differ on division by zero.
+        bool zero = false;
+        for (auto i = 0; i < size; ++i) {
+          zero |= right[i] == 0;
+          out[i] = left[i] / right[i];
+        }
+        return !zero;
+      }
+      default:
+        VELOX_UNREACHABLE();
+    }
+    return true;
+  }
+}
+
+template <typename T>
+bool compare(
+    FusedOp op,
+    const T* left,
+    const T* right,
+    bool* out,
+    int32_t size) {
+  if constexpr (std::is_floating_point_v<T>) {
+    // Dialects differ on comparing NaN.
+    bool hasNaN = false;
+    for (auto i = 0; i < size; ++i) {
+      hasNaN |= std::isnan(left[i]) | std::isnan(right[i]);
+    }
+    if (hasNaN) {
+      return false;
+    }
+  }
+  switch (op) {
+    case FusedOp::kEq:
+      for (auto i = 0; i < size; ++i) {
+        out[i] = left[i] == right[i];
+      }
+      break;
+    case FusedOp::kNeq:
+      for (auto i = 0; i < size; ++i) {
+        out[i] = left[i] != right[i];
+      }
+      break;
+    case FusedOp::kLt:
+      for (auto i = 0; i < size; ++i) {
+        out[i] = left[i] < right[i];
+      }
+      break;
+    case FusedOp::kLte:
+      for (auto i = 0; i < size; ++i) {
+        out[i] = left[i] <= right[i];
+      }
+      break;
+    case FusedOp::kGt:
+      for (auto i = 0; i < size; ++i) {
+        out[i] = left[i] > right[i];
+      }
+      break;
+    case FusedOp::kGte:
+      for (auto i = 0; i < size; ++i) {
+        out[i] = left[i] >= right[i];
+      }
+      break;
+    default:
+      VELOX_UNREACHABLE();
+  }
+  return true;
+}
+
+void conjunct(
+    const FusedInstruction& instruction,
+    const std::vector<const void*>& operands,
+    bool* out,
+    int32_t size) {
+  ::memcpy(out, operands[instruction.args[0]], size);
+  for (auto j = 1; j < instruction.args.size(); ++j) {
+    const auto* arg = static_cast<const bool*>(operands[instruction.args[j]]);
+    if (instruction.op == FusedOp::kAnd) {
+      for (auto i = 0; i < size; ++i) {
+        out[i] = out[i] & arg[i];
+      }
+    } else {
+      for (auto i = 0; i < size; ++i) {
+        out[i] = out[i] | arg[i];
+      }
+    }
+  }
+}
+
+bool evalOperation(
+    const FusedInstruction& instruction,
+    const std::vector<const void*>& operands,
+    void* out,
+    int32_t size) {
+  if (isConjunct(instruction.op)) {
+    conjunct(instruction, operands, static_cast<bool*>(out), size);
+    return true;
+  }
+  return dispatchKind(instruction.kind, [&](auto tag) -> bool {
+    using T = decltype(tag);
+    if constexpr (std::is_same_v<T, bool>) {
+      VELOX_UNREACHABLE();
+    } else {
+      const auto* left = static_cast<const T*>(operands[instruction.args[0]]);
+      const auto* right = static_cast<const T*>(operands[instruction.args[1]]);
+      if (isComparison(instruction.op)) {
+        return compare(
+            instruction.op, left, right, static_cast<bool*>(out), size);
+      }
+      return arithmetic(
+          instruction.op, left, right, static_cast<T*>(out), size);
+    }
+  });
+}
+
+} // namespace
+
+FusedExpr::FusedExpr(
+    ExprPtr expr,
+    std::shared_ptr<const FusedProgram> program,
+    std::vector<FieldReference*> fields)
+    : SpecialForm(
+          expr->type(),
+          std::vector<ExprPtr>{expr},
+          "fused",
+          expr->supportsFlatNoNullsFastPath(),
+          false /* trackCpuUsage */),
+      program_(std::move(program)),
+      fields_(std::move(fields)) {
+  const auto& instructions = program_->instructions;
+  registers_.resize(instructions.size() * kBlockSize);
+  operands_.resize(instructions.size());
+  for (auto i = 0; i < instructions.size(); ++i) {
+    auto* block = registers_.data() + i * kBlockSize;
+    operands_[i] = block;
+    const auto& instruction = instructions[i];
+    if (instruction.op == FusedOp::kConstant) {
+      dispatchKind(instruction.kind, [&](auto tag) {
+        using T = decltype(tag);
+        T value;
+        ::memcpy(&value, &instruction.constant, sizeof(T));
+        std::fill_n(reinterpret_cast<T*>(block), kBlockSize, value);
+      });
+    }
+  }
+}
+
+// static
+bool FusedExpr::canFuse(const core::TypedExprPtr& expr) {
+  auto call = dynamic_cast<const core::CallTypedExpr*>(expr.get());
+  if (!call) {
+    return false;
+  }
+  auto op = fusedOp(call->name());
+  if (!op.has_value()) {
+    return false;
+  }
+  std::vector<TypePtr> argTypes;
+  for (const auto& input : call->inputs()) {
+    if (!canFuseInput(input)) {
+      return false;
+    }
+    argTypes.push_back(input->type());
+  }
+  return isFusableCall(*op, call->type(), argTypes);
+}
+
+// static
+ExprPtr FusedExpr::tryFuse(const ExprPtr& expr) {
+  FusedProgramBuilder builder;
+  if (builder.add(*expr) < 0 || builder.numOperations() < 2) {
+    return nullptr;
+  }
+  auto program = builder.build();
+  return std::make_shared<FusedExpr>(
+      expr, std::move(program), std::move(builder.fields()));
+}
+
+void FusedExpr::evalSpecialForm(
+    const SelectivityVector& rows,
+    EvalCtx& context,
+    VectorPtr& result) {
+  if (evalFused(rows, context, result)) {
+    ++numFusedBatches_;
+    return;
+  }
+  ++numInterpretedBatches_;
+  inputs_[0]->eval(rows, context, result);
+}
+
+void FusedExpr::evalSpecialFormSimplified(
+    const SelectivityVector& rows,
+    EvalCtx& context,
+    VectorPtr& result) {
+  inputs_[0]->evalSimplified(rows, context, result);
+}
+
+bool FusedExpr::evalFused(
+    const SelectivityVector& rows,
+    EvalCtx& context,
+    VectorPtr& result) {
+  const auto& instructions = program_->instructions;
+
+  // The values of the flat fields. Null for constant fields, whose value is
+  // copied to their instruction's block.
+  std::vector<const void*> fieldValues(fields_.size());
+  for (auto i = 0; i < fields_.size(); ++i) {
+    const auto index = fields_[i]->index(context);
+    context.ensureFieldLoaded(index, rows);
+    const auto& vector = context.getField(index);
+    if (vector->isConstantEncoding()) {
+      if (vector->isNullAt(0)) {
+        return false;
+      }
+    } else if (!vector->isFlatEncoding()) {
+      return false;
+    } else {
+      const auto* nulls = vector->rawNulls();
+      if (nulls && !rows.testSelected([&](auto row) {
+            return !bits::isBitNull(nulls, row);
+          })) {
+        return false;
+      }
+      fieldValues[i] = vector->valuesAsVoid();
+    }
+  }
+  for (auto i = 0; i < instructions.size(); ++i) {
+    const auto& instruction = instructions[i];
+    if (instruction.op != FusedOp::kField ||
+        fieldValues[instruction.field]) {
+      continue;
+    }
+    auto* block = registers_.data() + i * kBlockSize;
+    operands_[i] = block;
+    const auto& vector =
+        context.getField(fields_[instruction.field]->index(context));
+    dispatchKind(instruction.kind, [&](auto tag) {
+      using T = decltype(tag);
+      std::fill_n(
+          reinterpret_cast<T*>(block),
+          kBlockSize,
+          vector->template as<SimpleVector<T>>()->valueAt(0));
+    });
+  }
+
+  context.ensureWritable(rows, type(), result);
+  result->clearNulls(rows);
+  const auto* selected = rows.asRange().bits();
+  for (auto begin = rows.begin(); begin < rows.end(); begin += kBlockSize) {
+    const auto size = std::min(kBlockSize, rows.end() - begin);
+    for (auto i = 0; i < instructions.size(); ++i) {
+      const auto& instruction = instructions[i];
+      auto* block = registers_.data() + i * kBlockSize;
+      if (instruction.op == FusedOp::kConstant) {
+        continue;
+      }
+      if (instruction.op != FusedOp::kField) {
+        if (!evalOperation(instruction, operands_, block, size)) {
+          return false;
+        }
+        continue;
+      }
+      const auto* values = fieldValues[instruction.field];
+      if (!values) {
+        continue;
+      }
+      dispatchKind(instruction.kind, [&](auto tag) {
+        using T = decltype(tag);
+        if constexpr (std::is_same_v<T, bool>) {
+          auto* flags = reinterpret_cast<bool*>(block);
+          for (auto j = 0; j < size; ++j) {
+            flags[j] = bits::isBitSet(
+                static_cast<const uint64_t*>(values), begin + j);
+          }
+        } else {
+          operands_[i] = static_cast<const T*>(values) + begin;
+        }
+      });
+    }
+
+    dispatchKind(type()->kind(), [&](auto tag) {
+      using T = decltype(tag);
+      const auto* values = static_cast<const T*>(operands_.back());
+      auto* flatResult = result->asUnchecked<FlatVector<T>>();
+      if constexpr (std::is_same_v<T, bool>) {
+        auto* rawResult = flatResult->template mutableRawValues<uint64_t>();
+        bits::forEachSetBit(selected, begin, begin + size, [&](auto row) {
+          bits::setBit(rawResult, row, values[row - begin]);
+        });
+      } else if (rows.isAllSelected()) {
+        ::memcpy(
+            flatResult->mutableRawValues() + begin, values, size * sizeof(T));
+      } else {
+        auto* rawResult = flatResult->mutableRawValues();
+        bits::forEachSetBit(selected, begin, begin + size, [&](auto row) {
+          rawResult[row] = values[row - begin];
+        });
+      }
+    });
+  }
+  return true;
+}
+
+} // namespace facebook::velox::exec
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/expression/SpecialForm.h"
+
+namespace facebook::velox::exec {
+
+struct FusedProgram;
+
+/// Evaluates a tree of fixed-width arithmetic, comparison, AND and OR
+/// expressions over fields and constants, e.g. 'a * b + c * d > e', in one pass
+/// over blocks of rows. The intermediate results stay in a few block sized
+/// buffers instead of a vector per node. Used if
+/// QueryConfig::exprFusionEnabled() is true.
+///
+/// The only input is the interpreted tree. It evaluates the batches the fused
+/// loop cannot produce the same result for: inputs that are not flat or
+/// constant or have nulls in the selected rows, and batches where an integer
+/// operation overflows, a floating point comparison sees a NaN or a floating
+/// point division sees a zero.
+class FusedExpr : public SpecialForm {
+ public:
+  FusedExpr(
+      ExprPtr expr,
+      std::shared_ptr<const FusedProgram> program,
+      std::vector<FieldReference*> fields);
+
+  /// Returns true if 'expr' is a tree of operations that can be fused over
+  /// fields and constants. Checked before compiling 'expr', so that only the
+  /// largest such trees are fused.
+  static bool canFuse(const core::TypedExprPtr& expr);
+
+  /// Returns a FusedExpr over the compiled 'expr' or nullptr if 'expr' has
+  /// fewer than two operations to fuse.
+  static ExprPtr tryFuse(const ExprPtr& expr);
+
+  void evalSpecialForm(
+      const SelectivityVector& rows,
+      EvalCtx& context,
+      VectorPtr& result) override;
+
+  void evalSpecialFormSimplified(
+      const SelectivityVector& rows,
+      EvalCtx& context,
+      VectorPtr& result) override;
+
+  void computePropagatesNulls() override {
+    propagatesNulls_ = inputs_[0]->propagatesNulls();
+  }
+
+  std::string toString(bool recursive = true) const override {
+    return inputs_[0]->toString(recursive);
+  }
+
+  std::string toSql(
+      std::vector<VectorPtr>* complexConstants = nullptr) const override {
+    return inputs_[0]->toSql(complexConstants);
+  }
+
+  /// The number of batches evaluated by the fused loop and by the interpreted
+  /// tree.
+  uint64_t numFusedBatches() const {
+    return numFusedBatches_;
+  }
+
+  uint64_t numInterpretedBatches() const {
+    return numInterpretedBatches_;
+  }
+
+ private:
+  // Evaluates 'rows' with the fused loop. Returns false if the result would
+  // differ from the interpreted one, in which case 'result' may have been
+  // partially written.
+  bool evalFused(
+      const SelectivityVector& rows,
+      EvalCtx& context,
+      VectorPtr& result);
+
+  const std::shared_ptr<const FusedProgram> program_;
+
+  // The fields the program reads, in the order of its field ordinals.
+  const std::vector<FieldReference*> fields_;
+
+  // A block of values for each instruction of 'program_'. Those of the
+  // constants are set once.
+  std::vector<int64_t> registers_;
+
+  // The values of each instruction for the current block. Points into
+  // 'registers_' or into the flat input vectors.
+  std::vector<const void*> operands_;
+
+  uint64_t numFusedBatches_{0};
+  uint64_t numInterpretedBatches_{0};
+};
+
+} // namespace facebook::velox::exec
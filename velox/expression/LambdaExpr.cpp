@@ -37,10 +37,19 @@ class ExprCallable : public Callable {
       : signature_(std::move(signature)),
         capture_(std::move(capture)),
         body_(std::move(body)),
-        sharedExprsToReset_(std::move(sharedExprsToReset)) {}
+        sharedExprsToReset_(std::move(sharedExprsToReset)) {
+    for (auto i = signature_->size(); i < capture_->childrenSize(); ++i) {
+      if (!capture_->childAt(i)->isConstantEncoding()) {
+        hasNonConstantCapture_ = true;
+        break;
+      }
+    }
+  }
 
+  // Constant captures are resized instead of wrapped, so a lambda that
+  // captures nothing or only constants does not need 'wrapCapture'.
   bool hasCapture() const override {
-    return capture_->childrenSize() > signature_->size();
+    return hasNonConstantCapture_;
   }
 
   void apply(
@@ -120,7 +129,11 @@ class ExprCallable : public Callable {
     for (auto index = args.size(); index < capture_->childrenSize(); ++index) {
       auto values = capture_->childAt(index);
       VELOX_DCHECK(!isLazyNotLoaded(*values));
-      if (wrapCapture) {
+      if (values->isConstantEncoding()) {
+        if (values->size() != size) {
+          values = BaseVector::wrapInConstant(size, 0, values);
+        }
+      } else if (wrapCapture) {
         values = BaseVector::wrapInDictionary(
             BufferPtr(nullptr), wrapCapture, size, values);
       }
@@ -142,6 +155,7 @@ class ExprCallable : public Callable {
   // List of Shared Exprs that are decendants of 'body_' for which reset() needs
   // to be called before calling `body_->eval()`.
   std::vector<std::shared_ptr<Expr>> sharedExprsToReset_;
+  bool hasNonConstantCapture_{false};
 };
 
 void extractSharedExpressions(
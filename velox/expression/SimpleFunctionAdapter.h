@@ -156,6 +156,12 @@ class SimpleFunctionAdapter : public VectorFunction {
   /// primitivies.
   static constexpr bool specializeForAllEncodings = FUNC::num_args <= 3;
 
+  /// When true, a fast path for each combination of flat, constant and other
+  /// encodings will be used when some of the primitive arguments are neither
+  /// flat nor constant. Only these other arguments are decoded. Limited to
+  /// fewer arguments than above since there are 3 readers per argument.
+  static constexpr bool specializeForMixedEncodings = FUNC::num_args <= 2;
+
   /// If the initialize() method provided by functions throw, we don't (can't)
   /// throw immediately; rather, we capture the exception using this member
   /// variable and set that as error for every single active row. This is
@@ -380,7 +386,13 @@ class SimpleFunctionAdapter : public VectorFunction {
       }
     } else {
       decoded.resize(args.size());
-      unpack<0, false>(applyContext, decoded, args);
+      if constexpr (
+          allArgsFlatConstantFastPathEligible() &&
+          specializeForMixedEncodings) {
+        unpackSpecializeForMixedEncodings<0>(applyContext, decoded, args);
+      } else {
+        unpack<0, false>(applyContext, decoded, args);
+      }
     }
 
     if constexpr (fastPathIteration) {
@@ -506,6 +518,41 @@ class SimpleFunctionAdapter : public VectorFunction {
     }
   }
 
+  // This is called only when all args are eligible for the optimization and
+  // some are neither flat nor constant. Decodes only those.
+  template <int32_t POSITION, typename... TReader>
+  void unpackSpecializeForMixedEncodings(
+      ApplyContext& applyContext,
+      std::vector<std::optional<LocalDecodedVector>>& decodedArgs,
+      const std::vector<VectorPtr>& rawArgs,
+      TReader&... readers) const {
+    if constexpr (POSITION == FUNC::num_args) {
+      iterate(applyContext, readers...);
+    } else {
+      auto& arg = rawArgs[POSITION];
+      using type =
+          typename VectorExec::template resolver<arg_at<POSITION>>::in_type;
+      if (arg->isConstantEncoding()) {
+        auto reader = ConstantVectorReader<arg_at<POSITION>>(
+            *(arg->asUnchecked<ConstantVector<type>>()));
+        unpackSpecializeForMixedEncodings<POSITION + 1>(
+            applyContext, decodedArgs, rawArgs, readers..., reader);
+      } else if (arg->isFlatEncoding()) {
+        auto reader = FlatVectorReader<arg_at<POSITION>>(
+            *arg->asUnchecked<FlatVector<type>>());
+        unpackSpecializeForMixedEncodings<POSITION + 1>(
+            applyContext, decodedArgs, rawArgs, readers..., reader);
+      } else {
+        decodedArgs[POSITION] = LocalDecodedVector(
+            applyContext.context, *arg, *applyContext.rows);
+        auto reader =
+            VectorReader<arg_at<POSITION>>(decodedArgs[POSITION].value().get());
+        unpackSpecializeForMixedEncodings<POSITION + 1>(
+            applyContext, decodedArgs, rawArgs, readers..., reader);
+      }
+    }
+  }
+
   template <
       int32_t POSITION,
       bool allPrimitiveArgsFlatConstant,
@@ -16,6 +16,8 @@
 
 #include "velox/expression/SimpleFunctionRegistry.h"
 
+#include "velox/common/base/BitUtil.h"
+
 namespace facebook::velox::exec {
 namespace {
 
@@ -40,6 +42,7 @@ bool SimpleFunctionRegistry::registerFunctionInternal(
     bool overwrite) {
   const auto sanitizedName = sanitizeName(name);
   return registeredFunctions_.withWLock([&](auto& map) {
+    resolutions_.wlock()->clear();
     SignatureMap& signatureMap = map[sanitizedName];
     auto& functions = signatureMap[*metadata->signature()];
 
@@ -70,7 +73,32 @@ bool SimpleFunctionRegistry::registerFunctionInternal(
 
 void SimpleFunctionRegistry::removeFunction(const std::string& name) {
   const auto sanitizedName = sanitizeName(name);
-  registeredFunctions_.withWLock([&](auto& map) { map.erase(sanitizedName); });
+  registeredFunctions_.withWLock([&](auto& map) {
+    map.erase(sanitizedName);
+    resolutions_.wlock()->clear();
+  });
+}
+
+bool SimpleFunctionRegistry::ResolutionKey::operator==(
+    const ResolutionKey& other) const {
+  if (name != other.name || argTypes.size() != other.argTypes.size()) {
+    return false;
+  }
+  for (auto i = 0; i < argTypes.size(); ++i) {
+    if (*argTypes[i] != *other.argTypes[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t SimpleFunctionRegistry::ResolutionKeyHasher::operator()(
+    const ResolutionKey& key) const {
+  auto hash = std::hash<std::string>()(key.name);
+  for (const auto& type : key.argTypes) {
+    hash = bits::hashMix(hash, type->hashKind());
+  }
+  return hash;
 }
 
 namespace {
@@ -156,6 +184,16 @@ SimpleFunctionRegistry::resolveFunction(
   const FunctionEntry* selectedCandidate = nullptr;
   TypePtr selectedCandidateType = nullptr;
   registeredFunctions_.withRLock([&](const auto& map) {
+    ResolutionKey key{name, argTypes};
+    {
+      auto resolutions = resolutions_.rlock();
+      auto it = resolutions->find(key);
+      if (it != resolutions->end()) {
+        selectedCandidate = it->second.entry;
+        selectedCandidateType = it->second.type;
+        return;
+      }
+    }
     if (const auto* signatureMap = getSignatureMap(name, map)) {
       for (const auto& [candidateSignature, functionEntry] : *signatureMap) {
         SignatureBinder binder(candidateSignature, argTypes);
@@ -195,6 +233,13 @@ SimpleFunctionRegistry::resolveFunction(
         }
       }
     }
+
+    auto resolutions = resolutions_.wlock();
+    if (resolutions->size() >= kMaxCachedResolutions) {
+      resolutions->clear();
+    }
+    resolutions->emplace(
+        std::move(key), Resolution{selectedCandidate, selectedCandidateType});
   });
 
   VELOX_DCHECK(!selectedCandidate || selectedCandidateType);
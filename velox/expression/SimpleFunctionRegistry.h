@@ -106,7 +106,10 @@ class SimpleFunctionRegistry {
   }
 
   void clearRegistry() {
-    registeredFunctions_.withWLock([&](auto& map) { map.clear(); });
+    registeredFunctions_.withWLock([&](auto& map) {
+      map.clear();
+      resolutions_.wlock()->clear();
+    });
   }
 
   std::vector<const FunctionSignature*> getFunctionSignatures(
@@ -150,11 +153,39 @@ class SimpleFunctionRegistry {
     const TypePtr type_;
   };
 
+  /// Returns the function for 'name' with 'argTypes'. The result is cached,
+  /// so that compiling the same expression again, e.g. for each Driver of each
+  /// Task of a query, does not bind the signatures again.
   std::optional<ResolvedSimpleFunction> resolveFunction(
       const std::string& name,
       const std::vector<TypePtr>& argTypes) const;
 
+  /// The number of resolutions in the cache of resolveFunction().
+  size_t numCachedResolutions() const {
+    return resolutions_.rlock()->size();
+  }
+
  private:
+  // The most resolutions cached. The cache is cleared when it is full.
+  static constexpr size_t kMaxCachedResolutions = 10'000;
+
+  struct ResolutionKey {
+    std::string name;
+    std::vector<TypePtr> argTypes;
+
+    bool operator==(const ResolutionKey& other) const;
+  };
+
+  struct ResolutionKeyHasher {
+    size_t operator()(const ResolutionKey& key) const;
+  };
+
+  // The selected entry and result type, or nullptr if no function matches.
+  struct Resolution {
+    const FunctionEntry* entry;
+    TypePtr type;
+  };
+
   template <typename T>
   static std::unique_ptr<T> CreateUdf() {
     return std::make_unique<T>();
@@ -173,6 +204,15 @@ class SimpleFunctionRegistry {
       bool overwrite);
 
   folly::Synchronized<FunctionMap> registeredFunctions_;
+
+  // Updated while holding a read lock of 'registeredFunctions_' and cleared
+  // while holding its write lock, so that an entry never outlives the
+  // registration it refers to.
+  mutable folly::Synchronized<std::unordered_map<
+      ResolutionKey,
+      Resolution,
+      ResolutionKeyHasher>>
+      resolutions_;
 };
 
 const SimpleFunctionRegistry& simpleFunctions();
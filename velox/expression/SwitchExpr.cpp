@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 #include "velox/expression/SwitchExpr.h"
+
+#include <folly/container/F14Map.h>
+
 #include "velox/expression/BooleanMix.h"
 #include "velox/expression/ConstantExpr.h"
 #include "velox/expression/FieldReference.h"
@@ -21,10 +24,241 @@
 
 namespace facebook::velox::exec {
 
+struct SwitchDispatch {
+  enum class Kind { kEquals, kLessThan };
+
+  Kind kind;
+  FieldReference* field;
+
+  // kEquals over integers. 'table' has the case of each value from
+  // 'minValue' or -1 if the values are dense enough, otherwise
+  // 'integerCases' maps the values to their cases.
+  int64_t minValue{0};
+  std::vector<int32_t> table;
+  folly::F14FastMap<int64_t, int32_t> integerCases;
+
+  // kEquals over strings. The keys point into the constants of the
+  // conditions.
+  folly::F14FastMap<StringView, int32_t> stringCases;
+
+  // kLessThan: the strictly increasing bound of each case and whether the
+  // bound is inclusive, i.e. the condition is 'x <= bound'.
+  std::vector<int64_t> bounds;
+  std::vector<bool> inclusive;
+
+  // Returns the first case that matches 'value' or -1.
+  int32_t findCase(int64_t value) const {
+    if (kind == Kind::kLessThan) {
+      const auto it = std::lower_bound(bounds.begin(), bounds.end(), value);
+      if (it == bounds.end()) {
+        return -1;
+      }
+      const int32_t index = it - bounds.begin();
+      if (*it > value || inclusive[index]) {
+        return index;
+      }
+      return index + 1 < bounds.size() ? index + 1 : -1;
+    }
+    if (!table.empty()) {
+      // Unsigned arithmetic avoids overflow for values far from 'minValue'.
+      const auto offset =
+          static_cast<uint64_t>(value) - static_cast<uint64_t>(minValue);
+      return offset < table.size() ? table[offset] : -1;
+    }
+    const auto it = integerCases.find(value);
+    return it == integerCases.end() ? -1 : it->second;
+  }
+
+  int32_t findCase(StringView value) const {
+    const auto it = stringCases.find(value);
+    return it == stringCases.end() ? -1 : it->second;
+  }
+
+  // Sets 'cases[row]' to the first case that matches 'row' of 'decoded' or
+  // to -1 for all of 'rows'. Null values match no case.
+  void findCases(
+      const DecodedVector& decoded,
+      const SelectivityVector& rows,
+      int32_t* cases) const {
+    switch (field->type()->kind()) {
+      case TypeKind::TINYINT:
+        findCasesImpl<int8_t>(decoded, rows, cases);
+        break;
+      case TypeKind::SMALLINT:
+        findCasesImpl<int16_t>(decoded, rows, cases);
+        break;
+      case TypeKind::INTEGER:
+        findCasesImpl<int32_t>(decoded, rows, cases);
+        break;
+      case TypeKind::BIGINT:
+        findCasesImpl<int64_t>(decoded, rows, cases);
+        break;
+      case TypeKind::VARCHAR:
+      case TypeKind::VARBINARY:
+        findCasesImpl<StringView>(decoded, rows, cases);
+        break;
+      default:
+        VELOX_UNREACHABLE();
+    }
+  }
+
+  template <typename T>
+  void findCasesImpl(
+      const DecodedVector& decoded,
+      const SelectivityVector& rows,
+      int32_t* cases) const {
+    rows.applyToSelected([&](auto row) {
+      cases[row] = decoded.isNullAt(row)
+          ? -1
+          : findCase(decoded.valueAt<T>(row));
+    });
+  }
+};
+
 namespace {
 bool hasElseClause(const std::vector<ExprPtr>& inputs) {
   return inputs.size() % 2 == 1;
 }
+
+// The largest table of cases for equality with integer constants, as a
+// multiple of the number of cases.
+constexpr int64_t kMaxTableSizeFactor = 4;
+
+struct Comparison {
+  std::string name;
+  FieldReference* field;
+  const BaseVector* constant;
+};
+
+// Returns the comparison of a top level field with a non-null constant if
+// 'expr' is such a call to 'eq', 'lt' or 'lte'.
+std::optional<Comparison> asComparison(Expr& expr) {
+  if (expr.isSpecialForm() || expr.inputs().size() != 2) {
+    return std::nullopt;
+  }
+  // Functions may be registered with a prefix, e.g. 'presto.default.'.
+  const auto pos = expr.name().rfind('.');
+  auto name = pos == std::string::npos ? expr.name()
+                                       : expr.name().substr(pos + 1);
+  if (name != "eq" && name != "lt" && name != "lte") {
+    return std::nullopt;
+  }
+  auto* left = expr.inputs()[0].get();
+  auto* right = expr.inputs()[1].get();
+  if (name == "eq" && left->is<ConstantExpr>()) {
+    std::swap(left, right);
+  }
+  if (!left->is<FieldReference>() || !left->inputs().empty() ||
+      !right->is<ConstantExpr>()) {
+    return std::nullopt;
+  }
+  const auto& constant = right->as<ConstantExpr>()->value();
+  if (constant == nullptr || constant->isNullAt(0)) {
+    return std::nullopt;
+  }
+  return Comparison{
+      std::move(name), left->as<FieldReference>(), constant.get()};
+}
+
+std::optional<int64_t> integerValue(const BaseVector& constant) {
+  switch (constant.typeKind()) {
+    case TypeKind::TINYINT:
+      return constant.as<SimpleVector<int8_t>>()->valueAt(0);
+    case TypeKind::SMALLINT:
+      return constant.as<SimpleVector<int16_t>>()->valueAt(0);
+    case TypeKind::INTEGER:
+      return constant.as<SimpleVector<int32_t>>()->valueAt(0);
+    case TypeKind::BIGINT:
+      return constant.as<SimpleVector<int64_t>>()->valueAt(0);
+    default:
+      return std::nullopt;
+  }
+}
+
+// Returns the dispatch for the conditions of 'inputs' if all of them compare
+// the same integer or string column with constants. Equalities may repeat a
+// constant, in which case the first case wins. Ranges must have increasing
+// bounds.
+std::shared_ptr<const SwitchDispatch> makeDispatch(
+    const std::vector<ExprPtr>& inputs,
+    size_t numCases) {
+  if (numCases < 2) {
+    return nullptr;
+  }
+  std::vector<Comparison> comparisons;
+  for (auto i = 0; i < numCases; ++i) {
+    auto comparison = asComparison(*inputs[2 * i]);
+    if (!comparison.has_value() ||
+        (i > 0 &&
+         (comparison->field->field() != comparisons[0].field->field() ||
+          (comparison->name == "eq") != (comparisons[0].name == "eq")))) {
+      return nullptr;
+    }
+    comparisons.push_back(std::move(*comparison));
+  }
+
+  const auto& type = comparisons[0].field->type();
+  if (type->isDecimal() || type->providesCustomComparison()) {
+    return nullptr;
+  }
+  const bool isString =
+      type->kind() == TypeKind::VARCHAR || type->kind() == TypeKind::VARBINARY;
+  if (!isString && !integerValue(*comparisons[0].constant).has_value()) {
+    return nullptr;
+  }
+  for (const auto& comparison : comparisons) {
+    if (!comparison.constant->type()->equivalent(*type)) {
+      return nullptr;
+    }
+  }
+
+  auto dispatch = std::make_shared<SwitchDispatch>();
+  dispatch->field = comparisons[0].field;
+  if (comparisons[0].name != "eq") {
+    if (isString) {
+      return nullptr;
+    }
+    dispatch->kind = SwitchDispatch::Kind::kLessThan;
+    for (const auto& comparison : comparisons) {
+      const auto bound = *integerValue(*comparison.constant);
+      if (!dispatch->bounds.empty() && bound <= dispatch->bounds.back()) {
+        return nullptr;
+      }
+      dispatch->bounds.push_back(bound);
+      dispatch->inclusive.push_back(comparison.name == "lte");
+    }
+    return dispatch;
+  }
+
+  dispatch->kind = SwitchDispatch::Kind::kEquals;
+  if (isString) {
+    for (auto i = 0; i < numCases; ++i) {
+      dispatch->stringCases.emplace(
+          comparisons[i].constant->as<SimpleVector<StringView>>()->valueAt(0),
+          i);
+    }
+    return dispatch;
+  }
+  for (auto i = 0; i < numCases; ++i) {
+    dispatch->integerCases.emplace(*integerValue(*comparisons[i].constant), i);
+  }
+  int64_t minValue = std::numeric_limits<int64_t>::max();
+  int64_t maxValue = std::numeric_limits<int64_t>::min();
+  for (const auto& [value, _] : dispatch->integerCases) {
+    minValue = std::min(minValue, value);
+    maxValue = std::max(maxValue, value);
+  }
+  const auto range = static_cast<uint64_t>(maxValue) - minValue;
+  if (range < kMaxTableSizeFactor * numCases) {
+    dispatch->minValue = minValue;
+    dispatch->table.resize(range + 1, -1);
+    for (const auto& [value, caseIndex] : dispatch->integerCases) {
+      dispatch->table[value - minValue] = caseIndex;
+    }
+    dispatch->integerCases.clear();
+  }
+  return dispatch;
+}
 } // namespace
 
 SwitchExpr::SwitchExpr(
@@ -38,7 +272,8 @@ SwitchExpr::SwitchExpr(
           hasElseClause(inputs) && inputsSupportFlatNoNullsFastPath,
           false /* trackCpuUsage */),
       numCases_{inputs_.size() / 2},
-      hasElseClause_{hasElseClause(inputs_)} {
+      hasElseClause_{hasElseClause(inputs_)},
+      dispatch_{makeDispatch(inputs_, numCases_)} {
   std::vector<TypePtr> inputTypes;
   inputTypes.reserve(inputs_.size());
   std::transform(
@@ -87,53 +322,59 @@ void SwitchExpr::evalSpecialForm(
   VectorPtr condition;
   const uint64_t* values;
 
-  for (auto i = 0; i < numCases_; i++) {
-    context.releaseVector(condition);
-
-    if (!remainingRows.get()->hasSelections()) {
-      break;
+  if (dispatch_ != nullptr) {
+    if (remainingRows->hasSelections()) {
+      evalDispatch(*remainingRows.get(), context, localResult);
     }
+  } else {
+    for (auto i = 0; i < numCases_; i++) {
+      context.releaseVector(condition);
 
-    // evaluate the case condition
-    inputs_[2 * i]->eval(*remainingRows.get(), context, condition);
-
-    if (context.errors()) {
-      context.deselectErrors(*remainingRows);
-      if (!remainingRows->hasSelections()) {
+      if (!remainingRows.get()->hasSelections()) {
         break;
       }
-    }
 
-    const auto booleanMix = getFlatBool(
-        condition.get(),
-        *remainingRows.get(),
-        context,
-        &tempValues_,
-        nullptr,
-        true,
-        &values,
-        nullptr);
-    switch (booleanMix) {
-      case BooleanMix::kAllTrue:
-        inputs_[2 * i + 1]->eval(*remainingRows.get(), context, localResult);
-        remainingRows->clearAll();
-        continue;
-      case BooleanMix::kAllNull:
-      case BooleanMix::kAllFalse:
-        continue;
-      default: {
-        thenRows.get(remainingRows->end(), false);
-        bits::andBits(
-            thenRows.get()->asMutableRange().bits(),
-            remainingRows.get()->asRange().bits(),
-            values,
-            0,
-            remainingRows->end());
-        thenRows.get()->updateBounds();
-
-        if (thenRows.get()->hasSelections()) {
-          inputs_[2 * i + 1]->eval(*thenRows.get(), context, localResult);
-          remainingRows.get()->deselect(*thenRows.get());
+      // evaluate the case condition
+      inputs_[2 * i]->eval(*remainingRows.get(), context, condition);
+
+      if (context.errors()) {
+        context.deselectErrors(*remainingRows);
+        if (!remainingRows->hasSelections()) {
+          break;
+        }
+      }
+
+      const auto booleanMix = getFlatBool(
+          condition.get(),
+          *remainingRows.get(),
+          context,
+          &tempValues_,
+          nullptr,
+          true,
+          &values,
+          nullptr);
+      switch (booleanMix) {
+        case BooleanMix::kAllTrue:
+          inputs_[2 * i + 1]->eval(*remainingRows.get(), context, localResult);
+          remainingRows->clearAll();
+          continue;
+        case BooleanMix::kAllNull:
+        case BooleanMix::kAllFalse:
+          continue;
+        default: {
+          thenRows.get(remainingRows->end(), false);
+          bits::andBits(
+              thenRows.get()->asMutableRange().bits(),
+              remainingRows.get()->asRange().bits(),
+              values,
+              0,
+              remainingRows->end());
+          thenRows.get()->updateBounds();
+
+          if (thenRows.get()->hasSelections()) {
+            inputs_[2 * i + 1]->eval(*thenRows.get(), context, localResult);
+            remainingRows.get()->deselect(*thenRows.get());
+          }
         }
       }
     }
@@ -171,6 +412,42 @@ void SwitchExpr::evalSpecialForm(
   context.moveOrCopyResult(localResult, rows, finalResult);
 }
 
+void SwitchExpr::evalDispatch(
+    SelectivityVector& remainingRows,
+    EvalCtx& context,
+    VectorPtr& result) {
+  const auto index = dispatch_->field->index(context);
+  context.ensureFieldLoaded(index, remainingRows);
+  LocalDecodedVector decoded(
+      context, *context.getField(index), remainingRows);
+
+  rowCases_.resize(remainingRows.end());
+  dispatch_->findCases(*decoded, remainingRows, rowCases_.data());
+
+  caseRows_.resize(numCases_);
+  caseUsed_.assign(numCases_, false);
+  remainingRows.applyToSelected([&](auto row) {
+    const auto caseIndex = rowCases_[row];
+    if (caseIndex < 0) {
+      return;
+    }
+    if (!caseUsed_[caseIndex]) {
+      caseRows_[caseIndex].resizeFill(remainingRows.end(), false);
+      caseUsed_[caseIndex] = true;
+    }
+    caseRows_[caseIndex].setValid(row, true);
+    remainingRows.setValid(row, false);
+  });
+  remainingRows.updateBounds();
+
+  for (auto i = 0; i < numCases_; ++i) {
+    if (caseUsed_[i]) {
+      caseRows_[i].updateBounds();
+      inputs_[2 * i + 1]->eval(caseRows_[i], context, result);
+    }
+  }
+}
+
 // This is safe to call only after all metadata is computed for input
 // expressions.
 void SwitchExpr::computePropagatesNulls() {
@@ -20,6 +20,8 @@
 
 namespace facebook::velox::exec {
 
+struct SwitchDispatch;
+
 constexpr const char* kIf = "if";
 constexpr const char* kSwitch = "switch";
 
@@ -37,6 +39,11 @@ constexpr const char* kSwitch = "switch";
 ///
 /// IF expression can be represented as a CASE expression with a single
 /// condition.
+///
+/// A CASE whose conditions compare the same column with constants, e.g.
+/// 'x = 1', 'x = 5',... or 'x < 10', 'x < 20',... finds the first matching
+/// case of each row in one pass over the column with a lookup table or a
+/// binary search instead of evaluating the conditions one after another.
 class SwitchExpr : public SpecialForm {
  public:
   /// Inputs are concatenated conditions and results with an optional "else" at
@@ -65,10 +72,25 @@ class SwitchExpr : public SpecialForm {
 
   void computePropagatesNulls() override;
 
+  // Evaluates the then clauses for 'remainingRows' using 'dispatch_' and
+  // leaves the rows that match no case in 'remainingRows'.
+  void evalDispatch(
+      SelectivityVector& remainingRows,
+      EvalCtx& context,
+      VectorPtr& result);
+
   const size_t numCases_;
   const bool hasElseClause_;
   BufferPtr tempValues_;
 
+  // Set if the conditions compare one column with constants.
+  const std::shared_ptr<const SwitchDispatch> dispatch_;
+
+  // The case of each row and the rows of each case. Reused across batches.
+  std::vector<int32_t> rowCases_;
+  std::vector<SelectivityVector> caseRows_;
+  std::vector<bool> caseUsed_;
+
   friend class SwitchCallToSpecialForm;
 };
 
@@ -1226,6 +1226,66 @@ TEST_F(CastExprTest, primitiveValidCornerCases) {
   }
 }
 
+TEST_F(CastExprTest, numericStringShapes) {
+  // Integers of up to 18 digits and decimals of up to 15 digits are cast in
+  // bulk. The other strings are cast one by one.
+  testCast<std::string, int64_t>(
+      "bigint",
+      {"0",
+       "-0",
+       "7",
+       std::nullopt,
+       "-12345678",
+       "123456789012345678",
+       "-123456789012345678",
+       "000000000000000042",
+       "9223372036854775807",
+       "-9223372036854775808",
+       "+5",
+       " 12"},
+      {0,
+       0,
+       7,
+       std::nullopt,
+       -12345678,
+       123456789012345678,
+       -123456789012345678,
+       42,
+       9223372036854775807,
+       std::numeric_limits<int64_t>::min(),
+       5,
+       12});
+  testCast<std::string, int32_t>(
+      "integer",
+      {"2147483647", "-2147483648", "12345678", "-1"},
+      {2147483647, -2147483648, 12345678, -1});
+  testTryCast<std::string, int8_t>(
+      "tinyint",
+      {"127", "-128", "128", "-129", "1a", "12345678x"},
+      {127, -128, std::nullopt, std::nullopt, std::nullopt, std::nullopt});
+
+  testCast<std::string, double>(
+      "double",
+      {"1.5",
+       "-0.25",
+       "123456789012345",
+       "12345678.9012345",
+       "-0.000000000000001",
+       "1234567890123456",
+       "0.1",
+       "1e3",
+       "1."},
+      {1.5,
+       -0.25,
+       123456789012345.0,
+       12345678.9012345,
+       -0.000000000000001,
+       1234567890123456.0,
+       0.1,
+       1000,
+       1});
+}
+
 TEST_F(CastExprTest, truncateVsRound) {
   // Testing round cast from double to int.
   testCast<double, int>(
@@ -1756,6 +1816,21 @@ TEST_F(CastExprTest, decimalToDecimal) {
   testCast(
       shortFlat, makeFlatVector<int64_t>({0, 0, 0, 0, 6, 7, 7}, DECIMAL(4, 1)));
 
+  // short to short with room for the integer digits, which is rescaled
+  // without checks.
+  auto maxShortFlat = makeFlatVector<int64_t>(
+      {999'999'999'999'999'995, -999'999'999'999'999'995, 14, 15, -14, -15},
+      DECIMAL(18, 2));
+  testCast(
+      maxShortFlat,
+      makeFlatVector<int64_t>(
+          {100'000'000'000'000'000, -100'000'000'000'000'000, 1, 2, -1, -2},
+          DECIMAL(18, 1)));
+  testCast(
+      makeFlatVector<int64_t>({99'999'999'999'999'999, -7}, DECIMAL(17, 2)),
+      makeFlatVector<int64_t>(
+          {999'999'999'999'999'990, -70}, DECIMAL(18, 3)));
+
   // long to short, scale up.
   auto longFlat =
       makeFlatVector<int128_t>({-201, -109, 0, 105, 208}, DECIMAL(20, 2));
@@ -107,6 +107,46 @@ TEST_F(EvalCtxTest, vectorRecycler) {
   ASSERT_NE(vector.get(), newVector.get());
 }
 
+TEST_F(EvalCtxTest, batchArena) {
+  EvalCtx context(&execCtx_);
+  auto* arena = context.batchArena();
+  ASSERT_EQ(arena, execCtx_.batchArena());
+  {
+    core::ExecCtx::BatchScope outer(execCtx_);
+    arena->allocate<int32_t>(100);
+    {
+      // A nested scope doesn't reset the arena.
+      core::ExecCtx::BatchScope inner(execCtx_);
+      arena->allocate<int32_t>(100);
+    }
+    ASSERT_EQ(arena->allocatedBytes(), 800);
+  }
+  ASSERT_EQ(arena->allocatedBytes(), 0);
+  ASSERT_GT(arena->retainedBytes(), 0);
+}
+
+TEST_F(EvalCtxTest, batchVectorState) {
+  auto flat = makeFlatVector<int64_t>({1, 2, 3});
+  auto dictionary = wrapInDictionary(makeIndicesInReverse(3), flat);
+  ASSERT_EQ(execCtx_.batchVectorState(flat), nullptr);
+  {
+    core::ExecCtx::BatchScope scope(execCtx_);
+    auto* state = execCtx_.batchVectorState(flat);
+    ASSERT_NE(state, nullptr);
+    ASSERT_EQ(state->numUses, 1);
+    state->state = std::make_shared<int32_t>(7);
+
+    // Vectors over the same base share the state.
+    ASSERT_EQ(execCtx_.batchVectorState(dictionary), state);
+    ASSERT_EQ(state->numUses, 2);
+  }
+
+  core::ExecCtx::BatchScope scope(execCtx_);
+  auto* state = execCtx_.batchVectorState(flat);
+  ASSERT_EQ(state->numUses, 1);
+  ASSERT_EQ(state->state, nullptr);
+}
+
 TEST_F(EvalCtxTest, ensureErrorsVectorSize) {
   EvalCtx context(&execCtx_);
   context.ensureErrorsVectorSize(10);
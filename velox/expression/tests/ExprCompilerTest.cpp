@@ -17,6 +17,7 @@
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/expression/Expr.h"
 #include "velox/expression/FieldReference.h"
+#include "velox/expression/FusedExpr.h"
 #include "velox/functions/prestosql/registration/RegistrationFunctions.h"
 #include "velox/functions/prestosql/types/JsonType.h"
 #include "velox/parse/Expressions.h"
@@ -355,4 +356,77 @@ TEST_F(ExprCompilerTest, lambdaExpr) {
   ASSERT_EQ(distinctFields.size(), 2);
 }
 
+TEST_F(ExprCompilerTest, fusion) {
+  auto rowType =
+      ROW({"a", "b", "c", "d"}, {BIGINT(), BIGINT(), BIGINT(), DOUBLE()});
+  const std::string sql = "a * b + c > 10 AND d * 2.0 < 5.0 OR a = c";
+  auto interpreted = compile(makeTypedExpr(sql, rowType));
+  ASSERT_FALSE(interpreted->expr(0)->is<FusedExpr>());
+
+  queryCtx_->testingOverrideConfigUnsafe(
+      {{core::QueryConfig::kExprFusionEnabled, "true"}});
+  auto exprSet = compile(makeTypedExpr(sql, rowType));
+  auto* fused = exprSet->expr(0)->as<FusedExpr>();
+  ASSERT_NE(fused, nullptr);
+  ASSERT_EQ(interpreted->toString(), exprSet->toString());
+
+  // A single operation is not fused.
+  ASSERT_FALSE(
+      compile(makeTypedExpr("a + b", rowType))->expr(0)->is<FusedExpr>());
+  // Only the largest fusable tree is fused.
+  auto partial = compile(makeTypedExpr("abs(a * b + c) > 1", rowType));
+  ASSERT_FALSE(partial->expr(0)->is<FusedExpr>());
+  ASSERT_TRUE(partial->expr(0)->inputs()[0]->inputs()[0]->is<FusedExpr>());
+
+  auto evaluate = [&](ExprSet& exprSet, const RowVectorPtr& input) {
+    EvalCtx context(execCtx_.get(), &exprSet, input.get());
+    SelectivityVector rows(input->size());
+    std::vector<VectorPtr> results(1);
+    exprSet.eval(rows, context, results);
+    return results[0];
+  };
+
+  const vector_size_t size = 1'000;
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(size, [](auto row) { return row % 7 - 3; }),
+      makeFlatVector<int64_t>(size, [](auto row) { return row % 11; }),
+      makeConstant<int64_t>(2, size),
+      makeFlatVector<double>(size, [](auto row) { return row * 0.01; }),
+  });
+  velox::test::assertEqualVectors(
+      evaluate(*interpreted, data), evaluate(*exprSet, data));
+  EXPECT_EQ(fused->numFusedBatches(), 1);
+  EXPECT_EQ(fused->numInterpretedBatches(), 0);
+
+  // Nulls and NaNs are evaluated by the interpreted tree.
+  for (auto& input :
+       {makeRowVector({
+            makeFlatVector<int64_t>(
+                size, [](auto row) { return row; }, nullEvery(5)),
+            data->childAt(1),
+            data->childAt(2),
+            data->childAt(3),
+        }),
+        makeRowVector({
+            data->childAt(0),
+            data->childAt(1),
+            data->childAt(2),
+            makeConstant(std::numeric_limits<double>::quiet_NaN(), size),
+        })}) {
+    velox::test::assertEqualVectors(
+        evaluate(*interpreted, input), evaluate(*exprSet, input));
+  }
+  EXPECT_EQ(fused->numFusedBatches(), 1);
+  EXPECT_EQ(fused->numInterpretedBatches(), 2);
+
+  // An overflow raises the same error as without fusion.
+  auto overflow = makeRowVector({
+      makeFlatVector<int64_t>({1, std::numeric_limits<int64_t>::max()}),
+      makeFlatVector<int64_t>({1, 2}),
+      makeFlatVector<int64_t>({1, 1}),
+      makeFlatVector<double>({1, 1}),
+  });
+  VELOX_ASSERT_THROW(evaluate(*exprSet, overflow), "integer overflow");
+}
+
 } // namespace facebook::velox::exec::test
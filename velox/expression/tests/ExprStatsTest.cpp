@@ -423,3 +423,63 @@ TEST_F(ExprStatsTest, complexConstants) {
 
   ASSERT_TRUE(exec::unregisterExprSetListener(listener));
 }
+
+TEST_F(ExprStatsTest, valueCache) {
+  queryCtx_->testingOverrideConfigUnsafe({
+      {core::QueryConfig::kExprTrackCpuUsage, "true"},
+      {core::QueryConfig::kExprValueCacheMaxEntries, "100"},
+  });
+
+  vector_size_t size = 1'024;
+  auto data = makeRowVector({
+      makeFlatVector<std::string>(
+          size,
+          [](auto row) {
+            return fmt::format(
+                "long enough {} {}", row % 2 == 0 ? "abc" : "xyz", row % 10);
+          }),
+      makeFlatVector<std::string>(
+          size, [](auto row) { return fmt::format("abc {}", row); }),
+  });
+  auto rowType = asRowType(data->type());
+  auto expected =
+      makeFlatVector<bool>(size, [](auto row) { return row % 2 == 0; });
+
+  // 10 distinct values.
+  auto exprSet = compileExpressions({"regexp_like(c0, 'abc')"}, rowType);
+  auto* cache = exprSet->expr(0)->valueCache();
+  ASSERT_NE(cache, nullptr);
+  auto result = evaluate(*exprSet, data);
+  assertEqualVectors(expected, result);
+  ASSERT_EQ(exprSet->expr(0)->stats().numValueCacheMisses, 10);
+  ASSERT_EQ(exprSet->expr(0)->stats().numValueCacheHits, size - 10);
+  ASSERT_EQ(cache->size(), 10);
+
+  // All the values are cached. The function is applied to the 512 distinct
+  // rows of the peeled dictionary.
+  auto indices = makeIndices(size, [](auto row) { return row / 2 * 2; });
+  result = evaluate(
+      *exprSet,
+      makeRowVector({
+          wrapInDictionary(indices, data->childAt(0)),
+          wrapInDictionary(indices, data->childAt(1)),
+      }));
+  assertEqualVectors(makeConstant(true, size), result);
+  ASSERT_EQ(exprSet->expr(0)->stats().numValueCacheMisses, 10);
+  ASSERT_EQ(
+      exprSet->expr(0)->stats().numValueCacheHits, size - 10 + size / 2);
+  ASSERT_TRUE(cache->enabled());
+
+  // All distinct values. The cache is full after 100 and turns off.
+  exprSet = compileExpressions({"regexp_like(c1, 'abc')"}, rowType);
+  cache = exprSet->expr(0)->valueCache();
+  result = evaluate(*exprSet, data);
+  assertEqualVectors(makeConstant(true, size), result);
+  ASSERT_EQ(exprSet->expr(0)->stats().numValueCacheMisses, size);
+  ASSERT_FALSE(cache->enabled());
+  ASSERT_EQ(cache->size(), 0);
+
+  // Expressions with more than one non-constant input are not cached.
+  exprSet = compileExpressions({"strpos(c0, c1)"}, rowType);
+  ASSERT_EQ(exprSet->expr(0)->valueCache(), nullptr);
+}
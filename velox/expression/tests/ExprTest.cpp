@@ -1714,6 +1714,79 @@ TEST_P(ParameterizedExprTest, switchExpr) {
   assertEqualVectors(expected, result);
 }
 
+TEST_P(ParameterizedExprTest, switchDispatch) {
+  vector_size_t size = 1'000;
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(
+          size, [](auto row) { return row % 100 - 20; }, nullEvery(7)),
+      makeFlatVector<std::string>(
+          size, [](auto row) { return fmt::format("value {}", row % 13); }),
+  });
+  auto isNull = nullEvery(7);
+  auto c0 = [](auto row) { return row % 100 - 20; };
+
+  // Equality with dense constants. The first of the duplicate cases wins.
+  auto result = evaluate(
+      "case c0 when 1 then 10 when 2 then c0 * 100 when 3 then 30 "
+      "when 1 then 40 else 0 end",
+      data);
+  auto expected = makeFlatVector<int64_t>(size, [&](auto row) -> int64_t {
+    if (isNull(row)) {
+      return 0;
+    }
+    switch (c0(row)) {
+      case 1:
+        return 10;
+      case 2:
+        return 200;
+      case 3:
+        return 30;
+      default:
+        return 0;
+    }
+  });
+  assertEqualVectors(expected, result);
+
+  // Equality with sparse constants, one of them on the left, and no else.
+  result = evaluate(
+      "case when c0 = -20 then 1 when 50 = c0 then 2 when c0 = 79 then 3 end",
+      data);
+  expected = makeFlatVector<int64_t>(
+      size,
+      [&](auto row) {
+        return c0(row) == -20 ? 1 : (c0(row) == 50 ? 2 : 3);
+      },
+      [&](auto row) {
+        return isNull(row) ||
+            (c0(row) != -20 && c0(row) != 50 && c0(row) != 79);
+      });
+  assertEqualVectors(expected, result);
+
+  // Ranges.
+  result = evaluate(
+      "case when c0 < 0 then 1 when c0 <= 10 then 2 when c0 < 50 then 3 "
+      "else 4 end",
+      data);
+  expected = makeFlatVector<int64_t>(size, [&](auto row) {
+    if (isNull(row)) {
+      return 4;
+    }
+    const auto value = c0(row);
+    return value < 0 ? 1 : (value <= 10 ? 2 : (value < 50 ? 3 : 4));
+  });
+  assertEqualVectors(expected, result);
+
+  // Strings.
+  result = evaluate(
+      "case c1 when 'value 1' then 1 when 'value 12' then 2 "
+      "when 'value 1' then 3 else 0 end",
+      data);
+  expected = makeFlatVector<int64_t>(size, [](auto row) {
+    return row % 13 == 1 ? 1 : (row % 13 == 12 ? 2 : 0);
+  });
+  assertEqualVectors(expected, result);
+}
+
 TEST_P(ParameterizedExprTest, swithExprSanityChecks) {
   auto vector = makeRowVector({makeFlatVector<int32_t>({1, 2, 3})});
 
@@ -507,3 +507,35 @@ TEST_F(PeeledEncodingTest, peelingFails) {
     ASSERT_TRUE(!peeledEncoding);
   }
 }
+
+TEST_F(PeeledEncodingTest, sequence) {
+  // Sequences with the same run lengths are peeled to one row per run.
+  //    Input Vectors: Seq(Flat1), Seq(Flat2), Const1
+  //    Peeled Vectors: Flat1, Flat2, Const1
+  auto input1 = vectorMaker_.sequenceVector<int64_t>(
+      {1, 1, 1, 2, std::nullopt, std::nullopt, 3, 3, 3, 3});
+  auto values2 = makeFlatVector<int64_t>({10, 20, 30, 40});
+  auto input2 = std::make_shared<SequenceVector<int64_t>>(
+      pool(), input1->size(), values2, input1->getSequenceLengths());
+  auto const1 = makeConstant<int64_t>(5, input1->size());
+
+  SelectivityVector rows(input1->size());
+  LocalDecodedVector localDecodedVector(execCtx_);
+  std::vector<VectorPtr> peeledVectors;
+  auto peeledEncoding = PeeledEncoding::peel(
+      {input1, input2, const1}, rows, localDecodedVector, true, peeledVectors);
+  ASSERT_NE(peeledEncoding, nullptr);
+  ASSERT_EQ(peeledVectors.size(), 3);
+  ASSERT_EQ(peeledEncoding->wrapEncoding(), VectorEncoding::Simple::DICTIONARY);
+  ASSERT_EQ(peeledVectors[0].get(), input1->valueVector().get());
+  ASSERT_EQ(peeledVectors[1].get(), values2.get());
+
+  LocalSelectivityVector translatedRowsHolder(execCtx_);
+  auto translatedRows =
+      peeledEncoding->translateToInnerRows(rows, translatedRowsHolder);
+  EXPECT_EQ(translatedRows->countSelected(), 4);
+  assertEqualVectors(
+      input2,
+      peeledEncoding->wrap(BIGINT(), pool(), peeledVectors[1], rows),
+      rows);
+}
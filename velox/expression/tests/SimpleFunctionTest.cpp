@@ -1190,6 +1190,39 @@ TEST_F(SimpleFunctionTest, testAllNotNull) {
   assertEqualVectors(expected, result);
 }
 
+template <typename T>
+struct TimesTenPlusFunction {
+  VELOX_DEFINE_FUNCTION_TYPES(T);
+
+  void call(int64_t& out, const int64_t& a, const int64_t& b) {
+    out = a * 10 + b;
+  }
+};
+
+TEST_F(SimpleFunctionTest, mixedEncodings) {
+  registerFunction<TimesTenPlusFunction, int64_t, int64_t, int64_t>(
+      {"times_ten_plus"});
+  // A dictionary that is not peeled with a flat and a constant argument.
+  auto base = makeNullableFlatVector<int64_t>({1, std::nullopt, 3});
+  auto dictionary = wrapInDictionary(makeIndices({2, 1, 0, 2, 0}), 5, base);
+  auto flat = makeNullableFlatVector<int64_t>({1, 2, std::nullopt, 4, 5});
+  auto data = makeRowVector({dictionary, flat});
+
+  auto result = evaluate("times_ten_plus(c0, c1)", data);
+  assertEqualVectors(
+      makeNullableFlatVector<int64_t>({31, std::nullopt, std::nullopt, 34, 15}),
+      result);
+
+  result = evaluate("times_ten_plus(c1, c0)", data);
+  assertEqualVectors(
+      makeNullableFlatVector<int64_t>({13, std::nullopt, std::nullopt, 43, 51}),
+      result);
+
+  result = evaluate("times_ten_plus(c0, 7)", data);
+  assertEqualVectors(
+      makeNullableFlatVector<int64_t>({37, std::nullopt, 17, 37, 17}), result);
+}
+
 // Test that SimpleFunctionRegistry does not crash in multithreaded environment.
 TEST_F(SimpleFunctionTest, simpleFunctionRegistryThreadSafe) {
   std::vector<std::thread> threads;
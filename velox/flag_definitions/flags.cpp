@@ -105,6 +105,13 @@ DEFINE_bool(
     false,
     "If true, 'MemoryPool' will be running in debug mode to track the allocation and free call sites to detect the source of memory leak for testing purpose");
 
+DEFINE_uint64(
+    velox_memory_pool_allocation_sample_bytes,
+    0,
+    "If not zero, 'MemoryPool' records the call stack of an allocation once "
+    "every this many bytes allocated to profile the allocation sites. 0 "
+    "disables the sampling");
+
 // TODO: deprecate this after solves all the use cases that can cause
 // significant performance regression by memory usage tracking.
 DEFINE_bool(
@@ -120,11 +127,23 @@ DEFINE_bool(
 
 DEFINE_bool(velox_memory_use_hugepages, true, "Use explicit huge pages");
 
+DEFINE_bool(
+    velox_hash_string_allocator_use_slabs,
+    false,
+    "If true, HashStringAllocator serves allocations of up to 1KB from power "
+    "of two size class slabs instead of its free lists");
+
 DEFINE_int32(
     cache_prefetch_min_pct,
     80,
     "Minimum percentage of actual uses over references to a column for prefetching. No prefetch if > 100");
 
+DEFINE_uint64(
+    velox_file_metadata_cache_bytes,
+    0,
+    "Capacity in bytes of the process-wide cache of parsed file footers "
+    "shared by the readers of the same file. 0 disables the cache");
+
 DEFINE_bool(velox_ssd_odirect, true, "Use O_DIRECT for SSD cache IO");
 
 DEFINE_bool(
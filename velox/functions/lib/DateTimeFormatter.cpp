@@ -1254,6 +1254,106 @@ uint32_t DateTimeFormatter::maxResultSize(const tz::TimeZone* timezone) const {
   return size;
 }
 
+namespace {
+// Writes the 'width' lowest decimal digits of 'value'.
+inline void writeDigits(uint32_t value, size_t width, char* result) {
+  for (auto i = width; i > 0; --i) {
+    result[i - 1] = '0' + value % 10;
+    value /= 10;
+  }
+}
+} // namespace
+
+// static
+uint32_t DateTimeFormatter::computeFixedResultSize(
+    const std::vector<DateTimeToken>& tokens) {
+  uint32_t size = 0;
+  for (const auto& token : tokens) {
+    if (token.type == DateTimeToken::Type::kLiteral) {
+      size += token.literal.size();
+      continue;
+    }
+    const auto digits = token.pattern.minRepresentDigits;
+    switch (token.pattern.specifier) {
+      case DateTimeFormatSpecifier::YEAR:
+        if (digits != 2 && digits != 4) {
+          return 0;
+        }
+        break;
+      case DateTimeFormatSpecifier::MONTH_OF_YEAR:
+      case DateTimeFormatSpecifier::DAY_OF_MONTH:
+      case DateTimeFormatSpecifier::HOUR_OF_DAY:
+      case DateTimeFormatSpecifier::MINUTE_OF_HOUR:
+      case DateTimeFormatSpecifier::SECOND_OF_MINUTE:
+        if (digits != 2) {
+          return 0;
+        }
+        break;
+      case DateTimeFormatSpecifier::FRACTION_OF_SECOND:
+        if (digits == 0) {
+          return 0;
+        }
+        break;
+      default:
+        return 0;
+    }
+    size += digits;
+  }
+  return size;
+}
+
+void DateTimeFormatter::formatFixedWidth(
+    int32_t year,
+    uint32_t month,
+    uint32_t day,
+    uint32_t hour,
+    uint32_t minute,
+    uint32_t second,
+    uint32_t millis,
+    char* result) const {
+  for (const auto& token : tokens_) {
+    if (token.type == DateTimeToken::Type::kLiteral) {
+      std::memcpy(result, token.literal.data(), token.literal.size());
+      result += token.literal.size();
+      continue;
+    }
+    const auto digits = token.pattern.minRepresentDigits;
+    switch (token.pattern.specifier) {
+      case DateTimeFormatSpecifier::YEAR:
+        writeDigits(year, digits, result);
+        break;
+      case DateTimeFormatSpecifier::MONTH_OF_YEAR:
+        writeDigits(month, 2, result);
+        break;
+      case DateTimeFormatSpecifier::DAY_OF_MONTH:
+        writeDigits(day, 2, result);
+        break;
+      case DateTimeFormatSpecifier::HOUR_OF_DAY:
+        writeDigits(hour, 2, result);
+        break;
+      case DateTimeFormatSpecifier::MINUTE_OF_HOUR:
+        writeDigits(minute % 60, 2, result);
+        break;
+      case DateTimeFormatSpecifier::SECOND_OF_MINUTE:
+        writeDigits(second % 60, 2, result);
+        break;
+      case DateTimeFormatSpecifier::FRACTION_OF_SECOND:
+        // Milliseconds, truncated or padded with zeros on the right.
+        if (digits <= 3) {
+          static constexpr uint32_t kDivisors[] = {1, 100, 10, 1};
+          writeDigits(millis / kDivisors[digits], digits, result);
+        } else {
+          writeDigits(millis, 3, result);
+          std::fill(result + 3, result + digits, '0');
+        }
+        break;
+      default:
+        VELOX_UNREACHABLE();
+    }
+    result += digits;
+  }
+}
+
 int32_t DateTimeFormatter::format(
     const Timestamp& timestamp,
     const tz::TimeZone* timezone,
@@ -1276,6 +1376,22 @@ int32_t DateTimeFormatter::format(
   const date::year_month_day calDate(daysTimePoint);
   const date::weekday weekday(daysTimePoint);
 
+  if (fixedResultSize_ > 0 && fixedResultSize_ <= maxResultSize) {
+    const auto year = static_cast<signed>(calDate.year());
+    if (year >= 0 && year <= 9999) {
+      formatFixedWidth(
+          year,
+          static_cast<unsigned>(calDate.month()),
+          static_cast<unsigned>(calDate.day()),
+          durationInTheDay.hours().count(),
+          durationInTheDay.minutes().count(),
+          durationInTheDay.seconds().count(),
+          durationInTheDay.subseconds().count(),
+          result);
+      return fixedResultSize_;
+    }
+  }
+
   const char* resultStart = result;
   char* maxResultEnd = result + maxResultSize;
   for (auto& token : tokens_) {
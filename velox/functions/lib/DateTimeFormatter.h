@@ -175,7 +175,8 @@ class DateTimeFormatter {
       : literalBuf_(std::move(literalBuf)),
         bufSize_(bufSize),
         tokens_(std::move(tokens)),
-        type_(type) {}
+        type_(type),
+        fixedResultSize_(computeFixedResultSize(tokens_)) {}
 
   const std::unique_ptr<char[]>& literalBuf() const {
     return literalBuf_;
@@ -189,6 +190,14 @@ class DateTimeFormatter {
     return tokens_;
   }
 
+  /// Returns the size of the formatted strings if the format has only
+  /// literals and numeric fields of fixed width, e.g. 'yyyy-MM-dd HH:mm:ss',
+  /// or 0 otherwise. Years outside of [0, 9999] are formatted by the generic
+  /// path and may have a different size.
+  uint32_t fixedResultSize() const {
+    return fixedResultSize_;
+  }
+
   // Returns an Expected<DateTimeResult> object containing the parsed
   // Timestamp and timezone information if parsing succeeded. Otherwise,
   // Returns Unexpected with UserError status if parsing failed.
@@ -216,10 +225,26 @@ class DateTimeFormatter {
       const std::optional<std::string>& zeroOffsetText = std::nullopt) const;
 
  private:
+  static uint32_t computeFixedResultSize(
+      const std::vector<DateTimeToken>& tokens);
+
+  // Writes the fixed width fields and the literals of a format with a
+  // fixedResultSize() without padding or converting number by number.
+  void formatFixedWidth(
+      int32_t year,
+      uint32_t month,
+      uint32_t day,
+      uint32_t hour,
+      uint32_t minute,
+      uint32_t second,
+      uint32_t millis,
+      char* result) const;
+
   std::unique_ptr<char[]> literalBuf_;
   size_t bufSize_;
   std::vector<DateTimeToken> tokens_;
   DateTimeFormatterType type_;
+  const uint32_t fixedResultSize_;
 };
 
 Expected<std::shared_ptr<DateTimeFormatter>> buildMysqlDateTimeFormatter(
@@ -307,6 +307,47 @@ void KllSketch<T, A, C>::insert(T value) {
   doInsert(value);
 }
 
+template <typename T, typename A, typename C>
+void KllSketch<T, A, C>::insert(const T* values, size_t count) {
+  if (count == 0) {
+    return;
+  }
+  const auto [minIt, maxIt] = std::minmax_element(values, values + count, C());
+  if (n_ == 0) {
+    minValue_ = *minIt;
+    maxValue_ = *maxIt;
+  } else {
+    minValue_ = std::min(minValue_, *minIt, C());
+    maxValue_ = std::max(maxValue_, *maxIt, C());
+  }
+  VELOX_DCHECK_GT(k_, 0);
+  VELOX_DCHECK_GE(levels_.size(), 2);
+  size_t i = 0;
+  if (items_.size() < k_ && numLevels() == 1) {
+    // Same as doInsert(): level zero grows at the end until it holds k items.
+    const auto numAppend = std::min<size_t>(count, k_ - items_.size());
+    items_.insert(items_.end(), values, values + numAppend);
+    levels_[1] += numAppend;
+    i = numAppend;
+  }
+  while (i < count) {
+    if (levels_[0] == 0) {
+      // Level zero is full, compacts to make space for one more item.
+      items_[insertPosition()] = values[i++];
+      continue;
+    }
+    // Fills the free space below level zero from the top down like doInsert().
+    const auto numFree = std::min<size_t>(levels_[0], count - i);
+    for (size_t j = 0; j < numFree; ++j) {
+      items_[levels_[0] - 1 - j] = values[i + j];
+    }
+    levels_[0] -= numFree;
+    i += numFree;
+  }
+  n_ += count;
+  isLevelZeroSorted_ = false;
+}
+
 template <typename T, typename A, typename C>
 void KllSketch<T, A, C>::doInsert(T value) {
   VELOX_DCHECK_GT(k_, 0);
@@ -82,6 +82,11 @@ struct KllSketch {
   /// Add one new value to the sketch.
   void insert(T value);
 
+  /// Add 'count' new values to the sketch.  Equivalent to calling
+  /// insert(value) for each value in order, but computes the min and max once
+  /// per batch and copies values into the free space of level zero in bulk.
+  void insert(const T* values, size_t count);
+
   /// Call this before serialization can optimize the space used.
   void compact();
 
@@ -74,6 +74,16 @@ BufferPtr toWrapCapture(
   return wrapCapture;
 }
 
+// Same as above for all the entries of a FunctionVector over 'topLevelRows'.
+// Reuses 'elementToTopLevelRows' from getElementToTopLevelRows() for
+// 'topLevelRows', which maps the nested rows the same way, instead of
+// allocating the indices for each entry.
+inline BufferPtr toWrapCapture(
+    const Callable* callable,
+    const BufferPtr& elementToTopLevelRows) {
+  return callable->hasCapture() ? elementToTopLevelRows : nullptr;
+}
+
 // Given possibly wrapped array vector, flattens the wrappings and returns a
 // flat array vector. Returns the original vector unmodified if the vector is
 // not wrapped. Flattening is shallow, e.g. elements vector may still be
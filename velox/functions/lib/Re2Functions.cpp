@@ -14,6 +14,11 @@
  * limitations under the License.
  */
 #include "velox/functions/lib/Re2Functions.h"
+
+#include <cctype>
+#include <cstring>
+
+#include "velox/common/base/SimdUtil.h"
 #include "velox/functions/lib/string/StringImpl.h"
 #include "velox/vector/FunctionVector.h"
 
@@ -31,6 +36,31 @@ re2::StringPiece toStringPiece(const T& s) {
   return re2::StringPiece(s.data(), s.size());
 }
 
+/// Skips the strings that cannot match a pattern because they lack a literal
+/// that all the matches contain. Checking for the literal is much cheaper
+/// than running RE2.
+class LiteralPrefilter {
+ public:
+  explicit LiteralPrefilter(std::string_view pattern)
+      : literal_(extractRequiredLiteral(pattern)) {
+    // Single characters filter out too few strings.
+    if (literal_.size() < 2) {
+      literal_.clear();
+    }
+  }
+
+  /// Returns false if 'str' cannot match the pattern.
+  bool mayMatch(StringView str) const {
+    return literal_.empty() ||
+        simd::simdStrstr(
+            str.data(), str.size(), literal_.data(), literal_.size()) !=
+        std::string::npos;
+  }
+
+ private:
+  std::string literal_;
+};
+
 } // namespace
 
 namespace detail {
@@ -217,7 +247,8 @@ template <bool (*Fn)(StringView, const RE2&)>
 class Re2MatchConstantPattern final : public exec::VectorFunction {
  public:
   explicit Re2MatchConstantPattern(StringView pattern)
-      : re_(toStringPiece(pattern), RE2::Quiet) {}
+      : re_(toStringPiece(pattern), RE2::Quiet),
+        prefilter_(std::string_view(pattern)) {}
 
   void apply(
       const SelectivityVector& rows,
@@ -236,12 +267,14 @@ class Re2MatchConstantPattern final : public exec::VectorFunction {
     }
 
     context.applyToSelectedNoThrow(rows, [&](vector_size_t i) {
-      result.set(i, Fn(toSearch->valueAt<StringView>(i), re_));
+      const auto str = toSearch->valueAt<StringView>(i);
+      result.set(i, prefilter_.mayMatch(str) && Fn(str, re_));
     });
   }
 
  private:
   RE2 re_;
+  const LiteralPrefilter prefilter_;
 };
 
 template <bool (*Fn)(StringView, const RE2&)>
@@ -856,9 +889,9 @@ class LikeWithRe2 final : public exec::VectorFunction {
   LikeWithRe2(StringView pattern, std::optional<char> escapeChar) {
     RE2::Options opt{RE2::Quiet};
     opt.set_dot_nl(true);
-    re_.emplace(
-        toStringPiece(likePatternToRe2(pattern, escapeChar, validPattern_)),
-        opt);
+    const auto regex = likePatternToRe2(pattern, escapeChar, validPattern_);
+    re_.emplace(toStringPiece(regex), opt);
+    prefilter_.emplace(regex);
   }
 
   void apply(
@@ -891,7 +924,10 @@ class LikeWithRe2 final : public exec::VectorFunction {
     if (toSearch->isIdentityMapping()) {
       auto rawStrings = toSearch->data<StringView>();
       context.applyToSelectedNoThrow(rows, [&](vector_size_t i) {
-        result.set(i, re2FullMatch(rawStrings[i], *re_));
+        result.set(
+            i,
+            prefilter_->mayMatch(rawStrings[i]) &&
+                re2FullMatch(rawStrings[i], *re_));
       });
       return;
     }
@@ -911,6 +947,7 @@ class LikeWithRe2 final : public exec::VectorFunction {
 
  private:
   std::optional<RE2> re_;
+  std::optional<LiteralPrefilter> prefilter_;
   bool validPattern_;
 };
 
@@ -2072,6 +2109,150 @@ std::optional<std::string> parsePattern(
   return escapeChar.has_value() ? std::make_optional(os.str()) : std::nullopt;
 }
 
+std::string extractRequiredLiteral(std::string_view pattern) {
+  std::string longest;
+  std::string current;
+  const auto endRun = [&]() {
+    if (current.size() > longest.size()) {
+      longest = current;
+    }
+    current.clear();
+  };
+
+  // Literals inside groups are not collected since a group may be optional.
+  int32_t depth = 0;
+  size_t i = 0;
+  while (i < pattern.size()) {
+    const char c = pattern[i];
+    if ((c & 0x80) != 0 || c == '|') {
+      return "";
+    }
+    std::optional<char> literal;
+    size_t next = i + 1;
+    switch (c) {
+      case '\\': {
+        if (next == pattern.size()) {
+          return "";
+        }
+        const char escaped = pattern[next++];
+        if ((escaped & 0x80) != 0) {
+          return "";
+        }
+        if (!std::isalnum(escaped)) {
+          literal = escaped;
+        } else if (std::strchr("dDwWsSbBAz", escaped) == nullptr) {
+          // E.g. \x41, \p{Greek} or \Q...\E.
+          return "";
+        }
+        break;
+      }
+      case '[': {
+        // Skips the character class.
+        if (next < pattern.size() && pattern[next] == '^') {
+          ++next;
+        }
+        if (next < pattern.size() && pattern[next] == ']') {
+          ++next;
+        }
+        while (next < pattern.size() && pattern[next] != ']') {
+          if (pattern[next] == '\\') {
+            next += 2;
+          } else if (pattern.substr(next, 2) == "[:") {
+            const auto end = pattern.find(":]", next + 2);
+            if (end == std::string_view::npos) {
+              return "";
+            }
+            next = end + 2;
+          } else {
+            ++next;
+          }
+        }
+        if (next >= pattern.size()) {
+          return "";
+        }
+        ++next;
+        break;
+      }
+      case '(':
+        if (pattern.substr(next, 2) == "?:") {
+          next += 2;
+        } else if (pattern.substr(next, 3) == "?P<") {
+          // Skips the name of the group.
+          next = pattern.find('>', next);
+          if (next == std::string_view::npos) {
+            return "";
+          }
+          ++next;
+        } else if (pattern.substr(next, 1) == "?") {
+          // Flags, e.g. (?i).
+          return "";
+        }
+        ++depth;
+        break;
+      case ')':
+        --depth;
+        break;
+      case '.':
+      case '^':
+      case '$':
+        break;
+      case '*':
+      case '+':
+      case '?':
+      case '{':
+        // A quantifier without an operand.
+        return "";
+      default:
+        literal = c;
+    }
+
+    bool optional = false;
+    bool repeated = false;
+    if (next < pattern.size()) {
+      switch (pattern[next]) {
+        case '*':
+        case '?':
+          optional = true;
+          ++next;
+          break;
+        case '+':
+          repeated = true;
+          ++next;
+          break;
+        case '{': {
+          const auto end = pattern.find('}', next);
+          if (end == std::string_view::npos) {
+            return "";
+          }
+          // Also covers {n} with n > 0, which is a repetition.
+          optional = true;
+          next = end + 1;
+          break;
+        }
+        default:
+          break;
+      }
+      if ((optional || repeated) && next < pattern.size() &&
+          pattern[next] == '?') {
+        // Non-greedy.
+        ++next;
+      }
+    }
+
+    if (literal.has_value() && depth == 0 && !optional) {
+      current.push_back(*literal);
+      if (repeated) {
+        endRun();
+      }
+    } else {
+      endRun();
+    }
+    i = next;
+  }
+  endRun();
+  return longest;
+}
+
 PatternMetadata determinePatternKind(
     std::string_view pattern,
     std::optional<char> escapeChar) {
@@ -219,6 +219,12 @@ PatternMetadata determinePatternKind(
     std::string_view pattern,
     std::optional<char> escapeChar);
 
+/// Returns the longest string that every match of the RE2 'pattern' must
+/// contain, or an empty string if none is found. Gives up on patterns with
+/// alternations, flags, non-ASCII characters and escapes other than the
+/// common ones, so that the result is never wrong.
+std::string extractRequiredLiteral(std::string_view pattern);
+
 std::shared_ptr<exec::VectorFunction> makeLike(
     const std::string& name,
     const std::vector<exec::VectorFunctionArg>& inputArgs,
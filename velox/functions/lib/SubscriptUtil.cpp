@@ -329,13 +329,20 @@ VectorPtr MapSubscript::applyMap(
   VELOX_CHECK(mapArg->type()->childAt(0)->equivalent(*indexArg->type()));
 
   bool triggerCaching = shouldTriggerCaching(mapArg);
+  auto* lookupTable = &lookupTable_;
+  if (!triggerCaching) {
+    if (auto* batchTable = batchLookupTable(mapArg, context)) {
+      triggerCaching = true;
+      lookupTable = batchTable;
+    }
+  }
   if (indexArg->type()->isPrimitiveType() &&
       !indexArg->type()->providesCustomComparison()) {
     return VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
         applyMapTyped,
         indexArg->typeKind(),
         triggerCaching,
-        lookupTable_,
+        *lookupTable,
         rows,
         mapArg,
         indexArg,
@@ -347,8 +354,25 @@ VectorPtr MapSubscript::applyMap(
     // Vector's equalValueAt method, which calls the Types custom comparison
     // operator internally.
     return applyMapComplexType(
-        rows, mapArg, indexArg, context, triggerCaching, lookupTable_);
+        rows, mapArg, indexArg, context, triggerCaching, *lookupTable);
+  }
+}
+
+std::shared_ptr<LookupTableBase>* MapSubscript::batchLookupTable(
+    const VectorPtr& mapArg,
+    exec::EvalCtx& context) const {
+  if (!allowBatchCaching_ || mapArg->type()->childAt(0)->isBoolean()) {
+    return nullptr;
+  }
+  auto* batchState = context.execCtx()->batchVectorState(mapArg);
+  if (batchState == nullptr || batchState->numUses < 2) {
+    return nullptr;
+  }
+  if (batchState->state == nullptr) {
+    batchState->state = std::make_shared<std::shared_ptr<LookupTableBase>>();
   }
+  return static_cast<std::shared_ptr<LookupTableBase>*>(
+      batchState->state.get());
 }
 
 namespace {
@@ -145,7 +145,8 @@ class LookupTable : public LookupTableBase {
 
 class MapSubscript {
  public:
-  explicit MapSubscript(bool allowCaching) : allowCaching_(allowCaching) {}
+  explicit MapSubscript(bool allowCaching)
+      : allowCaching_(allowCaching), allowBatchCaching_(allowCaching) {}
 
   VectorPtr applyMap(
       const SelectivityVector& rows,
@@ -192,10 +193,22 @@ class MapSubscript {
     return false;
   }
 
+  // Returns the lookup table of 'mapArg' shared with the other subscripts
+  // over the same map vector in the batch, or nullptr if no other subscript
+  // has read the map vector in the batch. The first reader scans the maps
+  // so that a single lookup per row does not pay for building the table.
+  std::shared_ptr<LookupTableBase>* batchLookupTable(
+      const VectorPtr& mapArg,
+      exec::EvalCtx& context) const;
+
   // When true the function is allowed to cache a materialized version of the
   // processed map.
   mutable bool allowCaching_;
 
+  // When true the function may share a materialized version of the processed
+  // map with the other subscripts over the same map vector in the batch.
+  const bool allowBatchCaching_;
+
   // This is used to check if the same base map is being passed over and over
   // in the function. A shared_ptr is used to guarantee that if the map is
   // seen again then it was not modified.
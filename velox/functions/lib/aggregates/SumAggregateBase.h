@@ -110,6 +110,30 @@ class SumAggregateBase
         TAccumulator(0));
   }
 
+  // Integer sums can be undone exactly. Floating point sums can't, since
+  // rounding depends on the order of the additions.
+  bool supportsRemoveInput() const override {
+    return std::is_integral_v<TAccumulator>;
+  }
+
+  void removeSingleGroupRawInput(
+      char* group,
+      const SelectivityVector& rows,
+      const std::vector<VectorPtr>& args) override {
+    if constexpr (std::is_integral_v<TAccumulator>) {
+      DecodedVector decoded(*args[0], rows);
+      auto& sum =
+          *BaseAggregate::Aggregate::template value<TAccumulator>(group);
+      rows.applyToSelected([&](vector_size_t i) {
+        if (!decoded.isNullAt(i)) {
+          subtractValue(sum, TAccumulator(decoded.valueAt<TInput>(i)));
+        }
+      });
+    } else {
+      VELOX_UNSUPPORTED("removeSingleGroupRawInput not supported");
+    }
+  }
+
  protected:
   // TData is used to store the updated sum state. It can be either
   // TAccumulator or TResult, which in most cases are the same, but for
@@ -155,6 +179,20 @@ class SumAggregateBase
     velox::aggregate::SumHook<TData, Overflow>::add(result, value);
   }
 
+  // Disable undefined behavior sanitizer to not fail on signed integer
+  // overflow.
+  template <typename TData>
+#if defined(FOLLY_DISABLE_UNDEFINED_BEHAVIOR_SANITIZER)
+  FOLLY_DISABLE_UNDEFINED_BEHAVIOR_SANITIZER("signed-integer-overflow")
+#endif
+  static void subtractValue(TData& result, TData value) {
+    if constexpr (Overflow) {
+      result -= value;
+    } else {
+      result = functions::checkedMinus<TData>(result, value);
+    }
+  }
+
   // Disable undefined behavior sanitizer to not fail on signed integer
   // overflow.
   template <typename TData>
@@ -26,7 +26,11 @@
 namespace facebook::velox::functions::test {
 namespace {
 
-int regexMatch(int n, int blockSize, const char* functionName) {
+int regexMatch(
+    int n,
+    int blockSize,
+    const char* functionName,
+    const char* pattern = "[^9]{3,5}") {
   folly::BenchmarkSuspender kSuspender;
   FunctionBenchmarkBase benchmarkBase;
 
@@ -36,7 +40,8 @@ int regexMatch(int n, int blockSize, const char* functionName) {
   const auto data = benchmarkBase.maker().rowVector({vector});
 
   exec::ExprSet expr = benchmarkBase.compileExpression(
-      folly::to<std::string>(functionName, "(c0, '[^9]{3,5}')"), data->type());
+      folly::to<std::string>(functionName, "(c0, '", pattern, "')"),
+      data->type());
   kSuspender.dismiss();
   for (int i = 0; i != n; ++i) {
     benchmarkBase.evaluate(expr, data);
@@ -56,6 +61,16 @@ BENCHMARK_NAMED_PARAM_MULTI(regexSearch, bs1k, 1 << 10, "re2_search");
 BENCHMARK_NAMED_PARAM_MULTI(regexSearch, bs10k, 10 << 10, "re2_search");
 BENCHMARK_NAMED_PARAM_MULTI(regexSearch, bs100k, 100 << 10, "re2_search");
 
+// The pattern contains a literal that few strings contain, so most of them are
+// rejected without running RE2.
+int regexSearchLiteral(int n, int blockSize) {
+  return regexMatch(n, blockSize, "re2_search", "[0-9]+ab.*cd");
+}
+
+BENCHMARK_NAMED_PARAM_MULTI(regexSearchLiteral, bs1k, 1 << 10);
+BENCHMARK_NAMED_PARAM_MULTI(regexSearchLiteral, bs10k, 10 << 10);
+BENCHMARK_NAMED_PARAM_MULTI(regexSearchLiteral, bs100k, 100 << 10);
+
 int regexExtract(int n, int blockSize) {
   folly::BenchmarkSuspender kSuspender;
   FunctionBenchmarkBase benchmarkBase;
@@ -1347,6 +1347,39 @@ TEST_F(JodaDateTimeFormatterTest, formatResultSize) {
   EXPECT_EQ(getJodaDateTimeFormatter("CCCC")->maxResultSize(timezone), 4);
 }
 
+TEST_F(JodaDateTimeFormatterTest, formatFixedWidth) {
+  EXPECT_EQ(getJodaDateTimeFormatter("yyyy-MM-dd")->fixedResultSize(), 10);
+  EXPECT_EQ(
+      getJodaDateTimeFormatter("yyyy-MM-dd HH:mm:ss.SSS")->fixedResultSize(),
+      23);
+  EXPECT_EQ(getJodaDateTimeFormatter("yy/MM/dd S")->fixedResultSize(), 10);
+  EXPECT_EQ(getJodaDateTimeFormatter("yyyy-M-dd")->fixedResultSize(), 0);
+  EXPECT_EQ(getJodaDateTimeFormatter("yyyy-MMM-dd")->fixedResultSize(), 0);
+  EXPECT_EQ(getJodaDateTimeFormatter("yyyy-MM-dd Z")->fixedResultSize(), 0);
+
+  auto format = [this](
+                    const std::string& pattern, const Timestamp& timestamp) {
+    auto formatter = getJodaDateTimeFormatter(pattern);
+    const auto maxSize = formatter->maxResultSize(nullptr);
+    std::string result(maxSize, '\0');
+    result.resize(
+        formatter->format(timestamp, nullptr, maxSize, result.data()));
+    return result;
+  };
+  const auto timestamp = fromTimestampString("2024-03-05 07:08:09.012");
+  EXPECT_EQ(
+      format("yyyy-MM-dd HH:mm:ss.SSS", timestamp), "2024-03-05 07:08:09.012");
+  EXPECT_EQ(format("yy/MM/dd S", timestamp), "24/03/05 0");
+  EXPECT_EQ(format("ss.SSSSS", timestamp), "09.01200");
+  EXPECT_EQ(format("yyyy", fromTimestampString("5-01-01")), "0005");
+
+  // Years with more than 4 digits are formatted the generic way.
+  EXPECT_EQ(
+      format("yyyy-MM-dd", fromTimestampString("12345-01-02")), "12345-01-02");
+  EXPECT_EQ(
+      format("yyyy-MM-dd", fromTimestampString("-1-01-02")), "-0001-01-02");
+}
+
 TEST_F(JodaDateTimeFormatterTest, betterErrorMessaging) {
   VELOX_ASSERT_THROW(
       parseJoda("2057-02-29T14:48:14.891Z", "yyyy-MM-dd'T'HH:mm:ss.SSSZ"),
@@ -129,6 +129,26 @@ TEST_F(KllSketchTest, randomInput) {
   }
 }
 
+TEST_F(KllSketchTest, insertBatch) {
+  constexpr int N = 1e5;
+  std::vector<double> values(N);
+  KllSketch<double> expected(kDefaultK, {}, 0);
+  insertRandomData(0, N, expected, values.data());
+  for (int batchSize : {1, 100, 1000, N}) {
+    SCOPED_TRACE(fmt::format("batchSize: {}", batchSize));
+    KllSketch<double> kll(kDefaultK, {}, 0);
+    for (int i = 0; i < N; i += batchSize) {
+      kll.insert(values.data() + i, std::min(batchSize, N - i));
+    }
+    ASSERT_EQ(kll.totalCount(), N);
+    std::string expectedSerialized(expected.serializedByteSize(), '\0');
+    expected.serialize(expectedSerialized.data());
+    std::string serialized(kll.serializedByteSize(), '\0');
+    kll.serialize(serialized.data());
+    ASSERT_EQ(serialized, expectedSerialized);
+  }
+}
+
 TEST_F(KllSketchTest, merge) {
   constexpr int N = 1e4;
   constexpr int M = 1001;
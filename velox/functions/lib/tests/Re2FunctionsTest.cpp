@@ -348,6 +348,65 @@ TEST_F(Re2FunctionsTest, regexSearchBatch) {
   re2Search.testBatchAll();
 }
 
+TEST_F(Re2FunctionsTest, extractRequiredLiteral) {
+  EXPECT_EQ(extractRequiredLiteral("abc"), "abc");
+  EXPECT_EQ(extractRequiredLiteral("^ab.*cdef$"), "cdef");
+  EXPECT_EQ(extractRequiredLiteral("ab?cd"), "cd");
+  EXPECT_EQ(extractRequiredLiteral("xa+bcd"), "bcd");
+  EXPECT_EQ(extractRequiredLiteral("xya+b"), "xya");
+  EXPECT_EQ(extractRequiredLiteral("ab*?c"), "a");
+  EXPECT_EQ(extractRequiredLiteral("[0-9]+foo\\d"), "foo");
+  EXPECT_EQ(extractRequiredLiteral("[]a-z]foo[^x]"), "foo");
+  EXPECT_EQ(extractRequiredLiteral("a\\.b\\*c"), "a.b*c");
+  EXPECT_EQ(extractRequiredLiteral("(abc)de"), "de");
+  EXPECT_EQ(extractRequiredLiteral("(?:abc)?de"), "de");
+  EXPECT_EQ(extractRequiredLiteral("(?P<name>abc)de"), "de");
+  EXPECT_EQ(extractRequiredLiteral("abc{0,2}def"), "def");
+  EXPECT_EQ(extractRequiredLiteral("[[:alpha:]]xyz"), "xyz");
+
+  // Gives up on the patterns it does not understand.
+  EXPECT_EQ(extractRequiredLiteral("abc|def"), "");
+  EXPECT_EQ(extractRequiredLiteral("(?i)abc"), "");
+  EXPECT_EQ(extractRequiredLiteral("abc\\x41"), "");
+  EXPECT_EQ(extractRequiredLiteral("abc\\pN"), "");
+  EXPECT_EQ(extractRequiredLiteral("éabc"), "");
+  EXPECT_EQ(extractRequiredLiteral("[abc"), "");
+  EXPECT_EQ(extractRequiredLiteral(".*"), "");
+}
+
+TEST_F(Re2FunctionsTest, literalPrefilter) {
+  auto input = makeFlatVector<std::string>({
+      "foo",
+      "123foo",
+      "abc 123foo and more than inlined",
+      "123fo",
+      "abcabcabc",
+      "aabbc",
+      "xyz",
+      "",
+  });
+  auto test = [&](const std::string& expr,
+                  const std::vector<bool>& expected) {
+    auto result = evaluate(expr, makeRowVector({input}));
+    assertEqualVectors(makeFlatVector<bool>(expected), result);
+  };
+  test(
+      "re2_search(c0, '[0-9]+foo')",
+      {false, true, true, false, false, false, false, false});
+  test(
+      "re2_match(c0, '[0-9]+foo')",
+      {false, true, false, false, false, false, false, false});
+  test(
+      "re2_search(c0, 'a+bb?c')",
+      {false, false, true, false, true, true, false, false});
+  test(
+      "c0 like '%123foo%'",
+      {false, true, true, false, false, false, false, false});
+  test(
+      "c0 like '%bc_bc%'",
+      {false, false, false, false, true, false, false, false});
+}
+
 template <typename F>
 void testRe2Extract(F&& regexExtract) {
   // Regex with no subgroup matches.
@@ -16,6 +16,7 @@
 
 #include <folly/container/F14Set.h>
 
+#include "velox/common/base/SortingNetwork.h"
 #include "velox/expression/EvalCtx.h"
 #include "velox/expression/Expr.h"
 #include "velox/expression/VectorFunction.h"
@@ -117,11 +118,66 @@ inline void swapWithNull(
   vector->setNull(index, true);
 }
 
+// Sorts 'size' values at 'values' by 'lessThan'. Uses a sorting network for
+// the short arrays, which are the common case.
+template <typename T, typename LessThan>
+void sortValues(T* values, vector_size_t size, LessThan lessThan) {
+  if (size <= kSortingNetworkMaxSize) {
+    sortingNetwork(values, size, lessThan);
+  } else {
+    std::sort(values, values + size, lessThan);
+  }
+}
+
+// The minimum size of the integer arrays to sort by radix instead of by
+// comparisons.
+constexpr vector_size_t kMinRadixSortSize = 1'024;
+
+// Sorts 'size' integers at 'values' in ascending order, one byte at a time
+// from the least significant one. Skips the bytes that are the same in all the
+// values. 'scratch' is a buffer for the passes.
+template <typename T>
+void radixSort(T* values, vector_size_t size, std::vector<T>& scratch) {
+  using U = std::make_unsigned_t<T>;
+  // Flipping the sign bit orders the negative values before the positive ones.
+  constexpr U kSignBit = U(1) << (sizeof(T) * 8 - 1);
+  auto digit = [&](T value, int32_t shift) {
+    return ((static_cast<U>(value) ^ kSignBit) >> shift) & 0xFF;
+  };
+
+  scratch.resize(size);
+  T* from = values;
+  T* to = scratch.data();
+  for (int32_t shift = 0; shift < 8 * sizeof(T); shift += 8) {
+    std::array<vector_size_t, 256> offsets{};
+    for (vector_size_t i = 0; i < size; ++i) {
+      ++offsets[digit(from[i], shift)];
+    }
+    if (offsets[digit(from[0], shift)] == size) {
+      continue;
+    }
+    vector_size_t offset = 0;
+    for (auto& count : offsets) {
+      const auto next = offset + count;
+      count = offset;
+      offset = next;
+    }
+    for (vector_size_t i = 0; i < size; ++i) {
+      to[offsets[digit(from[i], shift)]++] = from[i];
+    }
+    std::swap(from, to);
+  }
+  if (from != values) {
+    std::copy(from, from + size, values);
+  }
+}
+
 template <TypeKind kind>
 void applyScalarType(
     const SelectivityVector& rows,
     const ArrayVector* inputArray,
     bool ascending,
+    bool canSortInPlace,
     exec::EvalCtx& context,
     VectorPtr& resultElements) {
   using T = typename TypeTraits<kind>::NativeType;
@@ -133,15 +189,21 @@ void applyScalarType(
       toElementRows(inputElements->size(), rows, inputArray);
   const vector_size_t elementsCount = inputElementRows.size();
 
-  // TODO: consider to use dictionary wrapping to avoid the direct sorting on
-  // the scalar values as we do for complex data type if this runs slow in
-  // practice.
-  resultElements =
-      BaseVector::create(inputElements->type(), elementsCount, context.pool());
-  resultElements->copy(
-      inputElements.get(), inputElementRows, /*toSourceRow=*/nullptr);
+  // Sorts the elements in place if no one else refers to them. Sorts a copy
+  // otherwise.
+  if (canSortInPlace &&
+      inputElements->encoding() == VectorEncoding::Simple::FLAT &&
+      BaseVector::isVectorWritable(inputElements)) {
+    resultElements = inputElements;
+  } else {
+    resultElements = BaseVector::create(
+        inputElements->type(), elementsCount, context.pool());
+    resultElements->copy(
+        inputElements.get(), inputElementRows, /*toSourceRow=*/nullptr);
+  }
 
   auto flatResults = resultElements->asFlatVector<T>();
+  std::vector<T> scratch;
 
   auto processRow = [&](vector_size_t row) {
     const auto size = inputArray->sizeAt(row);
@@ -176,25 +238,33 @@ void applyScalarType(
     } else if constexpr (kind == TypeKind::REAL || kind == TypeKind::DOUBLE) {
       T* resultRawValues = flatResults->mutableRawValues();
       if (ascending) {
-        std::sort(
+        sortValues(
             resultRawValues + startRow,
-            resultRawValues + endRow,
+            endRow - startRow,
             util::floating_point::NaNAwareLessThan<T>());
       } else {
-        std::sort(
+        sortValues(
             resultRawValues + startRow,
-            resultRawValues + endRow,
+            endRow - startRow,
             util::floating_point::NaNAwareGreaterThan<T>());
       }
     } else {
       T* resultRawValues = flatResults->mutableRawValues();
+      if constexpr (std::is_integral_v<T>) {
+        if (endRow - startRow >= kMinRadixSortSize) {
+          radixSort(resultRawValues + startRow, endRow - startRow, scratch);
+          if (!ascending) {
+            std::reverse(resultRawValues + startRow, resultRawValues + endRow);
+          }
+          return;
+        }
+      }
       if (ascending) {
-        std::sort(resultRawValues + startRow, resultRawValues + endRow);
+        sortValues(
+            resultRawValues + startRow, endRow - startRow, std::less<T>());
       } else {
-        std::sort(
-            resultRawValues + startRow,
-            resultRawValues + endRow,
-            std::greater<T>());
+        sortValues(
+            resultRawValues + startRow, endRow - startRow, std::greater<T>());
       }
     }
   };
@@ -246,11 +316,12 @@ class ArraySortFunction : public exec::VectorFunction {
       const auto flatIndex = constantArray->index();
 
       exec::LocalSingleRow singleRow(context, flatIndex);
-      localResult = applyFlat(*singleRow, flatArray, context);
+      localResult = applyFlat(*singleRow, flatArray, false, context);
       localResult =
           BaseVector::wrapInConstant(rows.end(), flatIndex, localResult);
     } else {
-      localResult = applyFlat(rows, arg, context);
+      // The elements of an array no one else refers to can be sorted in place.
+      localResult = applyFlat(rows, arg, arg.use_count() == 1, context);
     }
 
     context.moveOrCopyResult(localResult, rows, result);
@@ -260,6 +331,7 @@ class ArraySortFunction : public exec::VectorFunction {
   VectorPtr applyFlat(
       const SelectivityVector& rows,
       const VectorPtr& arg,
+      bool canSortInPlace,
       exec::EvalCtx& context) const {
     // Acquire the array elements vector.
     auto inputArray = arg->as<ArrayVector>();
@@ -272,6 +344,7 @@ class ArraySortFunction : public exec::VectorFunction {
           rows,
           inputArray,
           ascending_,
+          canSortInPlace,
           context,
           resultElements);
 
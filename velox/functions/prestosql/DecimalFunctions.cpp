@@ -40,6 +40,8 @@ struct DecimalPlusFunction {
     auto bScale = getDecimalPrecisionScale(*bType).second;
     aRescale_ = computeRescaleFactor(aScale, bScale);
     bRescale_ = computeRescaleFactor(bScale, aScale);
+    aFactor_ = toShortFactor(aRescale_);
+    bFactor_ = toShortFactor(bRescale_);
   }
 
   template <typename R, typename A, typename B>
@@ -50,6 +52,14 @@ struct DecimalPlusFunction {
 #endif
 #endif
   {
+    if constexpr (
+        std::is_same_v<R, int64_t> && std::is_same_v<A, int64_t> &&
+        std::is_same_v<B, int64_t>) {
+      // The precision of a short result has room for the rescaled inputs and
+      // their sum, so that none of them can overflow.
+      out = a * aFactor_ + b * bFactor_;
+      return;
+    }
     int128_t aRescaled;
     int128_t bRescaled;
     if (__builtin_mul_overflow(
@@ -69,8 +79,18 @@ struct DecimalPlusFunction {
     return std::max(0, toScale - fromScale);
   }
 
+  // Returns 10 ^ 'rescale' if it fits in 64 bits, as it does for the short
+  // results, or 0 otherwise.
+  inline static int64_t toShortFactor(uint8_t rescale) {
+    return rescale <= ShortDecimalType::kMaxPrecision
+        ? static_cast<int64_t>(DecimalUtil::kPowersOfTen[rescale])
+        : 0;
+  }
+
   uint8_t aRescale_;
   uint8_t bRescale_;
+  int64_t aFactor_;
+  int64_t bFactor_;
 };
 
 template <typename TExec>
@@ -89,6 +109,8 @@ struct DecimalMinusFunction {
     auto bScale = getDecimalPrecisionScale(*bType).second;
     aRescale_ = computeRescaleFactor(aScale, bScale);
     bRescale_ = computeRescaleFactor(bScale, aScale);
+    aFactor_ = toShortFactor(aRescale_);
+    bFactor_ = toShortFactor(bRescale_);
   }
 
   template <typename R, typename A, typename B>
@@ -99,6 +121,14 @@ struct DecimalMinusFunction {
 #endif
 #endif
   {
+    if constexpr (
+        std::is_same_v<R, int64_t> && std::is_same_v<A, int64_t> &&
+        std::is_same_v<B, int64_t>) {
+      // The precision of a short result has room for the rescaled inputs and
+      // their difference, so that none of them can overflow.
+      out = a * aFactor_ - b * bFactor_;
+      return;
+    }
     int128_t aRescaled;
     int128_t bRescaled;
     if (__builtin_mul_overflow(
@@ -118,8 +148,18 @@ struct DecimalMinusFunction {
     return std::max(0, toScale - fromScale);
   }
 
+  // Returns 10 ^ 'rescale' if it fits in 64 bits, as it does for the short
+  // results, or 0 otherwise.
+  inline static int64_t toShortFactor(uint8_t rescale) {
+    return rescale <= ShortDecimalType::kMaxPrecision
+        ? static_cast<int64_t>(DecimalUtil::kPowersOfTen[rescale])
+        : 0;
+  }
+
   uint8_t aRescale_;
   uint8_t bRescale_;
+  int64_t aFactor_;
+  int64_t bFactor_;
 };
 
 template <typename TExec>
@@ -128,6 +168,14 @@ struct DecimalMultiplyFunction {
 
   template <typename R, typename A, typename B>
   void call(R& out, const A& a, const B& b) {
+    if constexpr (
+        std::is_same_v<R, int64_t> && std::is_same_v<A, int64_t> &&
+        std::is_same_v<B, int64_t>) {
+      // The precision of a short result is the sum of the precisions of the
+      // inputs, so that their product cannot overflow.
+      out = a * b;
+      return;
+    }
     out = checkedMultiply<R>(checkedMultiply<R>(R(a), R(b)), R(1));
     DecimalUtil::valueInRange(out);
   }
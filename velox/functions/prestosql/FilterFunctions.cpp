@@ -64,8 +64,7 @@ class FilterFunctionBase : public exec::VectorFunction {
     while (auto entry = iter.next()) {
       auto elementRows =
           toElementRows<T>(numElements, *entry.rows, input.get());
-      auto wrapCapture =
-          toWrapCapture<T>(numElements, entry.callable, *entry.rows, input);
+      auto wrapCapture = toWrapCapture(entry.callable, elementToTopLevelRows);
 
       VectorPtr bits;
       entry.callable->apply(
@@ -512,6 +512,9 @@ class JsonParseImpl {
 
 class JsonParseFunction : public exec::VectorFunction {
  public:
+  explicit JsonParseFunction(bool nullOnError = false)
+      : nullOnError_(nullOnError) {}
+
   void apply(
       const SelectivityVector& rows,
       std::vector<VectorPtr>& args,
@@ -522,8 +525,7 @@ class JsonParseFunction : public exec::VectorFunction {
     assert(args.size() > 0);
     const auto& arg = args[0];
     VectorPtr localResult;
-    parser.apply(
-        rows, arg, outputType, context, localResult, false /* nullOnError */);
+    parser.apply(rows, arg, outputType, context, localResult, nullOnError_);
     context.moveOrCopyResult(localResult, rows, result);
   }
 
@@ -536,13 +538,18 @@ class JsonParseFunction : public exec::VectorFunction {
   }
 
  private:
+  const bool nullOnError_;
   JsonParseImpl parser;
 };
 
 class JsonExtractFunction : public exec::VectorFunction {
  public:
-  JsonExtractFunction(bool extractScalarOnly)
-      : extractScalarOnly_(extractScalarOnly) {}
+  /// 'extractor' is the compiled path if the path is a constant.
+  JsonExtractFunction(
+      bool extractScalarOnly,
+      std::shared_ptr<SIMDJsonExtractor> extractor = nullptr)
+      : extractScalarOnly_(extractScalarOnly),
+        extractor_(std::move(extractor)) {}
 
   void apply(
       const SelectivityVector& rows,
@@ -720,10 +727,9 @@ class JsonExtractFunction : public exec::VectorFunction {
       return simdjson::SUCCESS;
     };
 
-    auto& extractor = SIMDJsonExtractor::getInstance(jsonPath);
     bool isDefinitePath = true;
-    simdjson::padded_string paddedJson(json.data(), json.size());
-    SIMDJSON_TRY(extractor.extract(paddedJson, consumer, isDefinitePath));
+    SIMDJSON_TRY(extractorFor(jsonPath).extract(
+        toPaddedJson(json), consumer, isDefinitePath));
 
     if (results.size() == 0) {
       if (isDefinitePath) {
@@ -789,10 +795,9 @@ class JsonExtractFunction : public exec::VectorFunction {
       return simdjson::SUCCESS;
     };
 
-    auto& extractor = SIMDJsonExtractor::getInstance(jsonPath);
     bool isDefinitePath = true;
-    simdjson::padded_string paddedJson(json.data(), json.size());
-    SIMDJSON_TRY(extractor.extract(paddedJson, consumer, isDefinitePath));
+    SIMDJSON_TRY(extractorFor(jsonPath).extract(
+        toPaddedJson(json), consumer, isDefinitePath));
 
     if (resultStr.has_value()) {
       output = std::move(resultStr.value());
@@ -802,10 +807,42 @@ class JsonExtractFunction : public exec::VectorFunction {
     }
   }
 
+  SIMDJsonExtractor& extractorFor(const StringView& jsonPath) const {
+    return extractor_ ? *extractor_ : SIMDJsonExtractor::getInstance(jsonPath);
+  }
+
+  // Copies 'json' into 'paddedJson_', which is reused across rows, instead of
+  // allocating a simdjson::padded_string per row.
+  simdjson::padded_string_view toPaddedJson(const StringView& json) const {
+    paddedJson_.resize(json.size() + simdjson::SIMDJSON_PADDING);
+    std::memcpy(paddedJson_.data(), json.data(), json.size());
+    return simdjson::padded_string_view(
+        paddedJson_.data(), json.size(), paddedJson_.size());
+  }
+
   bool extractScalarOnly_{false};
+  const std::shared_ptr<SIMDJsonExtractor> extractor_;
   JsonParseImpl parser_;
+  mutable std::string paddedJson_;
 };
 
+// Returns the compiled path if the path argument is a non-null constant and
+// valid. Invalid paths are reported for each row as before.
+std::shared_ptr<SIMDJsonExtractor> compileConstantPath(
+    const std::vector<exec::VectorFunctionArg>& inputArgs) {
+  if (inputArgs.size() != 2 || inputArgs[1].constantValue == nullptr ||
+      inputArgs[1].constantValue->isNullAt(0)) {
+    return nullptr;
+  }
+  const auto path =
+      inputArgs[1].constantValue->as<ConstantVector<StringView>>()->valueAt(0);
+  try {
+    return SIMDJsonExtractor::compile(path);
+  } catch (const VeloxUserError&) {
+    return nullptr;
+  }
+}
+
 // This function is called when $internal$json_string_to_array/map/row
 // is called. It is used for expressions like 'Cast(json_parse(x) as
 // ARRAY<...>)' etc. This is an optimization to avoid parsing the json string
@@ -860,9 +897,10 @@ VELOX_DECLARE_STATEFUL_VECTOR_FUNCTION(
     udf_json_extract_scalar,
     JsonExtractFunction::signatures(true),
     [](const std::string& /*name*/,
-       const std::vector<exec::VectorFunctionArg>&,
+       const std::vector<exec::VectorFunctionArg>& inputArgs,
        const velox::core::QueryConfig&) {
-      return std::make_shared<JsonExtractFunction>(true);
+      return std::make_shared<JsonExtractFunction>(
+          true, compileConstantPath(inputArgs));
     });
 
 // Only used internally at Meta.
@@ -884,9 +922,10 @@ VELOX_DECLARE_STATEFUL_VECTOR_FUNCTION(
     udf_json_extract,
     JsonExtractFunction::signatures(false),
     [](const std::string& /*name*/,
-       const std::vector<exec::VectorFunctionArg>&,
+       const std::vector<exec::VectorFunctionArg>& inputArgs,
        const velox::core::QueryConfig&) {
-      return std::make_shared<JsonExtractFunction>(false);
+      return std::make_shared<JsonExtractFunction>(
+          false, compileConstantPath(inputArgs));
     });
 
 VELOX_DECLARE_STATEFUL_VECTOR_FUNCTION(
@@ -898,6 +937,17 @@ VELOX_DECLARE_STATEFUL_VECTOR_FUNCTION(
       return std::make_shared<JsonParseFunction>();
     });
 
+// Same as json_parse but returns null for invalid JSON. Used by
+// rewriteJsonExtractCall.
+VELOX_DECLARE_STATEFUL_VECTOR_FUNCTION(
+    udf_$internal$_json_parse_null_on_error,
+    JsonParseFunction::signatures(),
+    [](const std::string& /*name*/,
+       const std::vector<exec::VectorFunctionArg>&,
+       const velox::core::QueryConfig&) {
+      return std::make_shared<JsonParseFunction>(/*nullOnError=*/true);
+    });
+
 VELOX_DECLARE_VECTOR_FUNCTION(
     udf_$internal$_json_string_to_array,
     JsonInternalCastFunction::signaturesArray(),
@@ -913,4 +963,28 @@ VELOX_DECLARE_VECTOR_FUNCTION(
     JsonInternalCastFunction::signaturesRow(),
     std::make_unique<JsonInternalCastFunction>());
 
+core::TypedExprPtr rewriteJsonExtractCall(
+    const std::string& prefix,
+    const core::TypedExprPtr& expr) {
+  const auto call = std::dynamic_pointer_cast<const core::CallTypedExpr>(expr);
+  if (call == nullptr || call->inputs().size() != 2 ||
+      (call->name() != prefix + "json_extract" &&
+       call->name() != prefix + "json_extract_scalar")) {
+    return nullptr;
+  }
+  const auto& json = call->inputs()[0];
+  if (json->type()->kind() != TypeKind::VARCHAR || isJsonType(json->type())) {
+    return nullptr;
+  }
+  return std::make_shared<core::CallTypedExpr>(
+      call->type(),
+      std::vector<core::TypedExprPtr>{
+          std::make_shared<core::CallTypedExpr>(
+              JSON(),
+              std::vector<core::TypedExprPtr>{json},
+              prefix + "$internal$json_parse_null_on_error"),
+          call->inputs()[1]},
+      call->name());
+}
+
 } // namespace facebook::velox::functions
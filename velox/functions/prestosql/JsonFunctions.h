@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "velox/core/Expressions.h"
 #include "velox/functions/Macros.h"
 #include "velox/functions/UDFOutputString.h"
 #include "velox/functions/prestosql/json/JsonPathTokenizer.h"
@@ -25,6 +26,15 @@
 
 namespace facebook::velox::functions {
 
+/// Rewrites json_extract(x, path) and json_extract_scalar(x, path) over a
+/// varchar 'x' to parse 'x' in a separate call, which returns null for
+/// invalid JSON like the functions do. The calls extracting several paths
+/// from the same 'x' then share the parse as a common subexpression. Returns
+/// nullptr if 'expr' is not such a call.
+core::TypedExprPtr rewriteJsonExtractCall(
+    const std::string& prefix,
+    const core::TypedExprPtr& expr);
+
 template <typename T>
 struct IsJsonScalarFunction {
   VELOX_DEFINE_FUNCTION_TYPES(T);
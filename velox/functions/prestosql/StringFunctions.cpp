@@ -29,31 +29,65 @@ using namespace stringCore;
 namespace {
 /**
  * Upper and Lower functions have a fast path for ascii where the functions
- * can be applied in place.
+ * are applied to all rows in one pass into one buffer.
  * */
 template <bool isLower /*instantiate for upper or lower*/>
 class UpperLowerTemplateFunction : public exec::VectorFunction {
  private:
-  /// String encoding wrappable function
-  template <bool isAscii>
-  struct ApplyInternal {
-    static void apply(
-        const SelectivityVector& rows,
-        const DecodedVector* decodedInput,
-        FlatVector<StringView>* results) {
-      rows.applyToSelected([&](int row) {
-        auto proxy = exec::StringWriter(results, row);
-        if constexpr (isLower) {
-          stringImpl::lower<isAscii>(
-              proxy, decodedInput->valueAt<StringView>(row));
-        } else {
-          stringImpl::upper<isAscii>(
-              proxy, decodedInput->valueAt<StringView>(row));
-        }
-        proxy.finalize();
-      });
+  static void convertAscii(char* output, const StringView& input) {
+    if constexpr (isLower) {
+      lowerAscii(output, input.data(), input.size());
+    } else {
+      upperAscii(output, input.data(), input.size());
     }
-  };
+  }
+
+  // Writes the results for 'rows' of ASCII 'input' into one buffer of
+  // 'results' sized for all the values that are not inlined.
+  static void applyAscii(
+      const SelectivityVector& rows,
+      const DecodedVector& input,
+      FlatVector<StringView>& results) {
+    size_t numBytes = 0;
+    rows.applyToSelected([&](auto row) {
+      const auto value = input.valueAt<StringView>(row);
+      if (!value.isInline()) {
+        numBytes += value.size();
+      }
+    });
+    char* buffer = numBytes > 0
+        ? results.getRawStringBufferWithSpace(numBytes, true)
+        : nullptr;
+    rows.applyToSelected([&](auto row) {
+      const auto value = input.valueAt<StringView>(row);
+      if (value.isInline()) {
+        char inlined[StringView::kInlineSize];
+        convertAscii(inlined, value);
+        results.setNoCopy(row, StringView(inlined, value.size()));
+      } else {
+        convertAscii(buffer, value);
+        results.setNoCopy(row, StringView(buffer, value.size()));
+        buffer += value.size();
+      }
+    });
+  }
+
+  static void applyUtf8(
+      const SelectivityVector& rows,
+      const DecodedVector* decodedInput,
+      FlatVector<StringView>* results) {
+    rows.applyToSelected([&](int row) {
+      auto proxy = exec::StringWriter(results, row);
+      if constexpr (isLower) {
+        stringImpl::lower</*isAscii*/ false>(
+            proxy, decodedInput->valueAt<StringView>(row));
+      } else {
+        stringImpl::upper</*isAscii*/ false>(
+            proxy, decodedInput->valueAt<StringView>(row));
+      }
+      proxy.finalize();
+    });
+  }
 
  public:
   void apply(
@@ -77,8 +111,11 @@ class UpperLowerTemplateFunction : public exec::VectorFunction {
     prepareFlatResultsVector(result, rows, context, emptyVectorPtr);
     auto* resultFlatVector = result->as<FlatVector<StringView>>();
 
-    StringEncodingTemplateWrapper<ApplyInternal>::apply(
-        ascii, rows, decodedInput, resultFlatVector);
+    if (ascii) {
+      applyAscii(rows, *decodedInput, *resultFlatVector);
+      return;
+    }
+    applyUtf8(rows, decodedInput, resultFlatVector);
   }
 
   static std::vector<std::shared_ptr<exec::FunctionSignature>> signatures() {
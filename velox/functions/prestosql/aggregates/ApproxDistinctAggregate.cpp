@@ -74,6 +74,18 @@ struct HllAccumulator {
     }
   }
 
+  void appendHashes(const uint64_t* hashes, int32_t numHashes) {
+    int32_t i = 0;
+    for (; isSparse_ && i < numHashes; ++i) {
+      if (sparseHll_.insertHash(hashes[i])) {
+        toDense();
+      }
+    }
+    if (i < numHashes) {
+      denseHll_.insertHashes(hashes + i, numHashes - i);
+    }
+  }
+
   int64_t cardinality() const {
     return isSparse_ ? sparseHll_.cardinality() : denseHll_.cardinality();
   }
@@ -320,17 +332,36 @@ class ApproxDistinctAggregate : public exec::Aggregate {
     } else {
       decodeArguments(rows, args);
 
-      rows.applyToSelected([&](auto row) {
-        if (decodedValue_.isNullAt(row)) {
+      if constexpr (std::is_same_v<T, bool>) {
+        rows.applyToSelected([&](auto row) {
+          if (decodedValue_.isNullAt(row)) {
+            return;
+          }
+
+          auto accumulator = value<HllAccumulator<T>>(group);
+          clearNull(group);
+          accumulator->setIndexBitLength(indexBitLength_);
+          accumulator->append(decodedValue_.valueAt<T>(row));
+        });
+      } else {
+        // Hashes all values first so that the dense HLL inserts them in
+        // batches.
+        hashes_.resize(rows.countSelected());
+        int32_t numHashes = 0;
+        rows.applyToSelected([&](auto row) {
+          if (!decodedValue_.isNullAt(row)) {
+            hashes_[numHashes++] = hashOne(decodedValue_.valueAt<T>(row));
+          }
+        });
+        if (numHashes == 0) {
           return;
         }
 
         auto accumulator = value<HllAccumulator<T>>(group);
         clearNull(group);
         accumulator->setIndexBitLength(indexBitLength_);
-
-        accumulator->append(decodedValue_.valueAt<T>(row));
-      });
+        accumulator->appendHashes(hashes_.data(), numHashes);
+      }
     }
   }
 
@@ -484,6 +515,8 @@ class ApproxDistinctAggregate : public exec::Aggregate {
   DecodedVector decodedValue_;
   DecodedVector decodedMaxStandardError_;
   DecodedVector decodedHll_;
+  // Hashes of the input values of addSingleGroupRawInput().
+  std::vector<uint64_t> hashes_;
 };
 
 template <TypeKind kind>
@@ -312,7 +312,7 @@ struct ApproxMostFrequentAggregate : exec::Aggregate {
       auto vo = values->offsetAt(i);
       auto co = counts->offsetAt(i);
       for (int j = 0; j < size; ++j) {
-        accumulator->insert(v->valueAt(vo + j), c->valueAt(co + j));
+        accumulator->insert(v->valueAtFast(vo + j), c->valueAtFast(co + j));
       }
     });
   }
@@ -96,6 +96,10 @@ struct KllSketchAccumulator {
     sketch_.insert(value);
   }
 
+  void append(const T* values, size_t count) {
+    sketch_.insert(values, count);
+  }
+
   void append(
       T value,
       int64_t count,
@@ -458,19 +462,21 @@ class ApproxPercentileAggregate : public exec::Aggregate {
         accumulator->append(value, weight, allocator_, fixedRandomSeed_);
       });
     } else {
+      // Collects the values to insert them into the sketch in one batch.
+      values_.resize(rows.countSelected());
+      size_t numValues = 0;
       if (decodedValue_.mayHaveNulls()) {
         rows.applyToSelected([&](auto row) {
-          if (decodedValue_.isNullAt(row)) {
-            return;
+          if (!decodedValue_.isNullAt(row)) {
+            values_[numValues++] = decodedValue_.valueAt<T>(row);
           }
-
-          accumulator->append(decodedValue_.valueAt<T>(row));
         });
       } else {
         rows.applyToSelected([&](auto row) {
-          accumulator->append(decodedValue_.valueAt<T>(row));
+          values_[numValues++] = decodedValue_.valueAt<T>(row);
         });
       }
+      accumulator->append(values_.data(), numValues);
     }
   }
 
@@ -696,6 +702,8 @@ class ApproxPercentileAggregate : public exec::Aggregate {
   DecodedVector decodedWeight_;
   DecodedVector decodedAccuracy_;
   DecodedVector decodedDigest_;
+  // Values of addSingleGroupRawInput() to insert into the sketch.
+  std::vector<T> values_;
 
  private:
   template <bool kSingleGroup, bool checkIntermediateInputs>
@@ -25,6 +25,33 @@ namespace facebook::velox::aggregate::prestosql {
 
 namespace {
 
+template <typename S>
+void addToSum(S& sum, S value) {
+  if constexpr (std::is_same_v<S, double> || std::is_same_v<S, float>) {
+    sum += value;
+  } else {
+    S checkedSum;
+    auto overflow = __builtin_add_overflow(sum, value, &checkedSum);
+
+    if (UNLIKELY(overflow)) {
+      auto errorValue = (int128_t(sum) + int128_t(value));
+
+      if (errorValue < 0) {
+        VELOX_ARITHMETIC_ERROR(
+            "Value {} is less than {}",
+            errorValue,
+            std::numeric_limits<S>::min());
+      } else {
+        VELOX_ARITHMETIC_ERROR(
+            "Value {} exceeds {}",
+            errorValue,
+            std::numeric_limits<S>::max());
+      }
+    }
+    sum = checkedSum;
+  }
+}
+
 template <typename K, typename S>
 struct Accumulator {
   using ValuesMap = typename util::floating_point::HashMapNaNAwareTypeTraits<
@@ -46,11 +73,21 @@ struct Accumulator {
       const VectorPtr& mapValues,
       vector_size_t row,
       HashStringAllocator* allocator) {
-    auto keys = mapKeys->template as<SimpleVector<K>>();
-    auto values = mapValues->template as<SimpleVector<S>>();
     auto offset = mapVector->offsetAt(row);
     auto size = mapVector->sizeAt(row);
+    if constexpr (!std::is_same_v<K, bool>) {
+      if (mapKeys->isFlatEncoding() && mapValues->isFlatEncoding()) {
+        addFlatValues(
+            *mapKeys->template asUnchecked<FlatVector<K>>(),
+            *mapValues->template asUnchecked<FlatVector<S>>(),
+            offset,
+            size);
+        return;
+      }
+    }
 
+    auto keys = mapKeys->template as<SimpleVector<K>>();
+    auto values = mapValues->template as<SimpleVector<S>>();
     for (auto i = 0; i < size; ++i) {
       // Ignore null map keys.
       if (!keys->isNullAt(offset + i)) {
@@ -60,40 +97,40 @@ struct Accumulator {
     }
   }
 
+  // Same as addValues() over raw values and nulls, e.g. for intermediate
+  // results, which are flat maps.
+  void addFlatValues(
+      const FlatVector<K>& keys,
+      const FlatVector<S>& values,
+      vector_size_t offset,
+      vector_size_t size) {
+    const auto* rawKeys = keys.rawValues();
+    const auto* rawValues = values.rawValues();
+    const auto* keyNulls = keys.rawNulls();
+    const auto* valueNulls = values.rawNulls();
+    for (auto i = offset; i < offset + size; ++i) {
+      // Ignore null map keys.
+      if (keyNulls != nullptr && bits::isBitNull(keyNulls, i)) {
+        continue;
+      }
+      auto& sum = sums[rawKeys[i]];
+      if (valueNulls == nullptr || !bits::isBitNull(valueNulls, i)) {
+        addToSum(sum, rawValues[i]);
+      }
+    }
+  }
+
   void addValue(
       K key,
       const SimpleVector<S>* mapValues,
       vector_size_t row,
       TypeKind valueKind) {
+    // Look up the key once for both reading and updating the sum.
+    auto& sum = sums[key];
     if (mapValues->isNullAt(row)) {
-      sums[key] += 0;
-    } else {
-      auto value = mapValues->valueAt(row);
-
-      if constexpr (std::is_same_v<S, double> || std::is_same_v<S, float>) {
-        sums[key] += value;
-      } else {
-        S checkedSum;
-        auto overflow = __builtin_add_overflow(sums[key], value, &checkedSum);
-
-        if (UNLIKELY(overflow)) {
-          auto errorValue = (int128_t(sums[key]) + int128_t(value));
-
-          if (errorValue < 0) {
-            VELOX_ARITHMETIC_ERROR(
-                "Value {} is less than {}",
-                errorValue,
-                std::numeric_limits<S>::min());
-          } else {
-            VELOX_ARITHMETIC_ERROR(
-                "Value {} exceeds {}",
-                errorValue,
-                std::numeric_limits<S>::max());
-          }
-        }
-        sums[key] = checkedSum;
-      }
+      return;
     }
+    addToSum(sum, mapValues->valueAt(row));
   }
 
   vector_size_t extractValues(
@@ -214,35 +251,11 @@ struct ComplexTypeAccumulator {
             (values->isNullAt(offset + i)) ? 0 : values->valueAt(offset + i);
 
         // New entry.
-        if (!sums.contains(entry)) {
-          sums[entry] = value;
-        } else {
+        auto [it, inserted] = sums.try_emplace(entry, value);
+        if (!inserted) {
           // Existing entry.
-          if constexpr (std::is_same_v<V, double> || std::is_same_v<V, float>) {
-            sums[entry] += value;
-          } else {
-            V checkedSum;
-            auto overflow =
-                __builtin_add_overflow(sums[entry], value, &checkedSum);
-
-            if (UNLIKELY(overflow)) {
-              auto errorValue = (int128_t(sums[entry]) + int128_t(value));
-
-              if (errorValue < 0) {
-                VELOX_ARITHMETIC_ERROR(
-                    "Value {} is less than {}",
-                    errorValue,
-                    std::numeric_limits<V>::min());
-              } else {
-                VELOX_ARITHMETIC_ERROR(
-                    "Value {} exceeds {}",
-                    errorValue,
-                    std::numeric_limits<V>::max());
-              }
-            }
-            sums[entry] = checkedSum;
-            serializedKeys.removeLast(entry);
-          }
+          addToSum(it->second, value);
+          serializedKeys.removeLast(entry);
         }
       }
     }
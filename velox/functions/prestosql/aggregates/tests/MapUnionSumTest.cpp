@@ -129,6 +129,28 @@ TEST_F(MapUnionSumTest, nullAndEmptyMaps) {
       {emptyAndNullMaps}, {}, {"map_union_sum(c0)"}, {expectedEmpty});
 }
 
+TEST_F(MapUnionSumTest, nullValuesAndEncodedEntries) {
+  auto keys = makeFlatVector<int64_t>({1, 2, 1, 3, 2, 1});
+  auto values =
+      makeNullableFlatVector<int64_t>({10, std::nullopt, 11, 30, 20, 12});
+  auto expected = makeRowVector({
+      makeMapVector<int64_t, int64_t>({
+          {{1, 33}, {2, 20}, {3, 30}},
+      }),
+  });
+
+  auto data = makeRowVector({makeMapVector({0, 2, 4}, keys, values)});
+  testAggregations({data}, {}, {"map_union_sum(c0)"}, {expected});
+
+  // Same with keys and values that are not flat.
+  auto indices = makeIndices(keys->size(), [](auto row) { return row; });
+  data = makeRowVector({makeMapVector(
+      {0, 2, 4},
+      wrapInDictionary(indices, keys),
+      wrapInDictionary(indices, values))});
+  testAggregations({data}, {}, {"map_union_sum(c0)"}, {expected});
+}
+
 TEST_F(MapUnionSumTest, tinyintOverflow) {
   auto data = makeRowVector({
       makeNullableMapVector<int64_t, int8_t>({
@@ -15,6 +15,7 @@
  */
 #include <folly/Benchmark.h>
 #include <folly/init/Init.h>
+#include <random>
 #include "velox/expression/VectorFunction.h"
 #include "velox/functions/lib/benchmarks/FunctionBenchmarkBase.h"
 #include "velox/functions/prestosql/registration/RegistrationFunctions.h"
@@ -28,6 +29,11 @@ namespace {
 
 class HourFunction : public exec::VectorFunction {
  public:
+  /// If 'batchTimezone' is true, converts all the timestamps to the session
+  /// time zone at once.
+  explicit HourFunction(bool batchTimezone = false)
+      : batchTimezone_(batchTimezone) {}
+
   const tz::TimeZone* FOLLY_NULLABLE
   getTimeZoneIfNeeded(const core::QueryConfig& config) const {
     const tz::TimeZone* timeZone = nullptr;
@@ -58,7 +64,18 @@ class HourFunction : public exec::VectorFunction {
     // the user provided session timezone.
     const auto* timeZone =
         getTimeZoneIfNeeded(context.execCtx()->queryCtx()->queryConfig());
-    if (timeZone != nullptr) {
+    if (timeZone != nullptr && batchTimezone_) {
+      std::vector<Timestamp> localTimestamps(
+          timestamps + rows.begin(), timestamps + rows.end());
+      Timestamp::toTimezone(
+          *timeZone, localTimestamps.data(), localTimestamps.size());
+      rows.applyToSelected([&](int row) {
+        int64_t seconds = localTimestamps[row - rows.begin()].getSeconds();
+        std::tm dateTime;
+        gmtime_r((const time_t*)&seconds, &dateTime);
+        rawResults[row] = dateTime.tm_hour;
+      });
+    } else if (timeZone != nullptr) {
       rows.applyToSelected([&](int row) {
         auto timestamp = timestamps[row];
         timestamp.toTimezone(*timeZone);
@@ -84,6 +101,8 @@ class HourFunction : public exec::VectorFunction {
                 .argumentType("timestamp")
                 .build()};
   }
+ private:
+  const bool batchTimezone_;
 };
 
 class DateTimeBenchmark : public functions::test::FunctionBenchmarkBase {
@@ -94,6 +113,10 @@ class DateTimeBenchmark : public functions::test::FunctionBenchmarkBase {
         "hour_vector",
         HourFunction::signatures(),
         std::make_unique<HourFunction>());
+    registerVectorFunction(
+        "hour_vector_batch",
+        HourFunction::signatures(),
+        std::make_unique<HourFunction>(true));
   }
 
   void run(const std::string& functionName) {
@@ -110,6 +133,52 @@ class DateTimeBenchmark : public functions::test::FunctionBenchmarkBase {
     doRun(exprSet, data);
   }
 
+  // Runs 'functionName' in the America/Los_Angeles session time zone over
+  // timestamps from 2000 on, one 'step' seconds after the other if 'sorted'
+  // or in random order otherwise.
+  void runWithTimezone(
+      const std::string& functionName,
+      bool sorted,
+      int64_t step = 60) {
+    folly::BenchmarkSuspender suspender;
+    queryCtx_->testingOverrideConfigUnsafe({
+        {core::QueryConfig::kSessionTimezone, "America/Los_Angeles"},
+        {core::QueryConfig::kAdjustTimestampToTimezone, "true"},
+    });
+
+    constexpr int64_t kBegin = 946'684'800;
+    std::vector<int64_t> seconds(10'000);
+    for (size_t i = 0; i < seconds.size(); ++i) {
+      seconds[i] = kBegin + i * step;
+    }
+    if (!sorted) {
+      std::mt19937 rng(1);
+      std::shuffle(seconds.begin(), seconds.end(), rng);
+    }
+    auto data = vectorMaker_.rowVector({vectorMaker_.flatVector<Timestamp>(
+        seconds.size(), [&](auto row) { return Timestamp(seconds[row], 0); })});
+    auto exprSet =
+        compileExpression(fmt::format("{}(c0)", functionName), data->type());
+    suspender.dismiss();
+
+    doRun(exprSet, data);
+  }
+
+  // Runs format_datetime with 'pattern' over timestamps from 2000 on.
+  void runFormatDatetime(const std::string& pattern) {
+    folly::BenchmarkSuspender suspender;
+    auto data = vectorMaker_.rowVector(
+        {vectorMaker_.flatVector<Timestamp>(10'000, [](auto row) {
+          return Timestamp(
+              946'684'800 + row * 7'919, (row % 1'000) * 1'000'000);
+        })});
+    auto exprSet = compileExpression(
+        fmt::format("format_datetime(c0, '{}')", pattern), data->type());
+    suspender.dismiss();
+
+    doRun(exprSet, data);
+  }
+
   void runDateTrunc(const std::string& unit) {
     folly::BenchmarkSuspender suspender;
     VectorFuzzer::Options opts;
@@ -187,6 +256,42 @@ BENCHMARK_RELATIVE(hour_vector) {
   benchmark.run("hour_vector");
 }
 
+// One day apart, across the daylight savings transitions of 27 years.
+BENCHMARK(hourTimezoneSorted) {
+  DateTimeBenchmark benchmark;
+  benchmark.runWithTimezone("hour", true, 86'400);
+}
+
+BENCHMARK_RELATIVE(hourTimezoneSorted_vector) {
+  DateTimeBenchmark benchmark;
+  benchmark.runWithTimezone("hour_vector", true, 86'400);
+}
+
+BENCHMARK_RELATIVE(hourTimezoneSorted_vector_batch) {
+  DateTimeBenchmark benchmark;
+  benchmark.runWithTimezone("hour_vector_batch", true, 86'400);
+}
+
+BENCHMARK(hourTimezoneRandom) {
+  DateTimeBenchmark benchmark;
+  benchmark.runWithTimezone("hour", false, 86'400);
+}
+
+BENCHMARK_RELATIVE(hourTimezoneRandom_vector_batch) {
+  DateTimeBenchmark benchmark;
+  benchmark.runWithTimezone("hour_vector_batch", false, 86'400);
+}
+
+BENCHMARK(formatDatetimeFixedWidth) {
+  DateTimeBenchmark benchmark;
+  benchmark.runFormatDatetime("yyyy-MM-dd HH:mm:ss.SSS");
+}
+
+BENCHMARK_RELATIVE(formatDatetimeVariableWidth) {
+  DateTimeBenchmark benchmark;
+  benchmark.runFormatDatetime("yyyy-MMM-d H:m:s.SSS");
+}
+
 BENCHMARK(minute) {
   DateTimeBenchmark benchmark;
   benchmark.run("minute");
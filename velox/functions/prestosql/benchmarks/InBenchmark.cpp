@@ -73,6 +73,28 @@ class InBenchmark : public functions::test::FunctionBenchmarkBase {
     doRun(exprSet, data);
   }
 
+  // Runs IN over a list of 'numValues' strings longer than 8 bytes. The rows
+  // with row * 3 < numValues match.
+  void runStrings(size_t numValues) {
+    folly::BenchmarkSuspender suspender;
+    auto data = vectorMaker_.rowVector(
+        {vectorMaker_.flatVector<std::string>(1'000, [](auto row) {
+          return fmt::format("product-id-{}", row * 3);
+        })});
+
+    std::ostringstream inList;
+    inList << "'product-id-0'";
+    for (auto i = 1; i < numValues; ++i) {
+      inList << ", 'product-id-" << i << "'";
+    }
+
+    auto sql = fmt::format("c0 IN ({})", inList.str());
+    auto exprSet = compileExpression(sql, data->type());
+    suspender.dismiss();
+
+    doRun(exprSet, data);
+  }
+
   void doRun(ExprSet& exprSet, const RowVectorPtr& rowVector) {
     int cnt = 0;
     for (auto i = 0; i < 1000; i++) {
@@ -126,6 +148,21 @@ BENCHMARK_RELATIVE(in1K) {
   benchmark.run(1'000);
 }
 
+BENCHMARK(inStrings10) {
+  InBenchmark benchmark;
+  benchmark.runStrings(10);
+}
+
+BENCHMARK(inStrings1K) {
+  InBenchmark benchmark;
+  benchmark.runStrings(1'000);
+}
+
+BENCHMARK(inStrings10K) {
+  InBenchmark benchmark;
+  benchmark.runStrings(10'000);
+}
+
 } // namespace
 
 int main(int argc, char** argv) {
@@ -91,10 +91,26 @@ int main(int argc, char** argv) {
     auto name = fmt::format(
         "{}_{}_{}", mapType->childAt(0)->toString(), mapLength, baseVectorSize);
 
-    benchmarkBuilder.addBenchmarkSet(name, vm.rowVector(columns))
-        .addExpression("subscript", "element_at(c0, c1)")
-        .addExpression("subscriptNocaching", "subscriptNocaching(c0, c1)")
-        .withIterations(numberOfBatches);
+    auto& set =
+        benchmarkBuilder.addBenchmarkSet(name, vm.rowVector(columns))
+            .addExpression("subscript", "element_at(c0, c1)")
+            .addExpression("subscriptNocaching", "subscriptNocaching(c0, c1)")
+            .withIterations(numberOfBatches);
+
+    // Several subscripts over one map vector in each batch. These share a
+    // lookup table of the map vector unless caching is disabled.
+    if (mapType->childAt(0)->kind() == TypeKind::INTEGER) {
+      set.addExpression(
+             "subscripts",
+             "row_constructor(element_at(c0, c1), element_at(c0, c1 + 1), "
+             "element_at(c0, c1 + 2), element_at(c0, c1 + 3))")
+          .addExpression(
+              "subscriptsNocaching",
+              "row_constructor(subscriptNocaching(c0, c1), "
+              "subscriptNocaching(c0, c1 + 1), "
+              "subscriptNocaching(c0, c1 + 2), "
+              "subscriptNocaching(c0, c1 + 3))");
+    }
   };
 
   auto createSetsForType = [&](const auto& keyType) {
@@ -58,6 +58,29 @@ class StringAsciiUTFFunctionBenchmark
     doRun(exprSet, rowVector);
   }
 
+  // Runs 'expression' over strings in c0.
+  void runStringExpression(const std::string& expression, bool utf) {
+    folly::BenchmarkSuspender suspender;
+
+    VectorFuzzer::Options opts;
+    if (utf) {
+      opts.charEncodings.clear();
+      opts.charEncodings = {UTF8CharList::UNICODE_CASE_SENSITIVE};
+    }
+
+    opts.stringLength = 100;
+    opts.vectorSize = 100'000;
+    VectorFuzzer fuzzer(opts, execCtx_.pool());
+    auto vector = fuzzer.fuzzFlat(VARCHAR());
+
+    auto rowVector = vectorMaker_.rowVector({vector});
+    auto exprSet = compileExpression(expression, rowVector->type());
+
+    suspender.dismiss();
+
+    doRun(exprSet, rowVector);
+  }
+
   void runSubStr(bool utf) {
     folly::BenchmarkSuspender suspender;
 
@@ -146,6 +169,46 @@ BENCHMARK_RELATIVE(asciiUpper) {
   benchmark.runUpperLower("upper", false);
 }
 
+BENCHMARK(utfLength) {
+  StringAsciiUTFFunctionBenchmark benchmark;
+  benchmark.runStringExpression("length(c0)", true);
+}
+
+BENCHMARK_RELATIVE(asciiLength) {
+  StringAsciiUTFFunctionBenchmark benchmark;
+  benchmark.runStringExpression("length(c0)", false);
+}
+
+BENCHMARK(utfTrim) {
+  StringAsciiUTFFunctionBenchmark benchmark;
+  benchmark.runStringExpression("trim(c0)", true);
+}
+
+BENCHMARK_RELATIVE(asciiTrim) {
+  StringAsciiUTFFunctionBenchmark benchmark;
+  benchmark.runStringExpression("trim(c0)", false);
+}
+
+BENCHMARK(utfStrPos) {
+  StringAsciiUTFFunctionBenchmark benchmark;
+  benchmark.runStringExpression("strpos(c0, 'a')", true);
+}
+
+BENCHMARK_RELATIVE(asciiStrPos) {
+  StringAsciiUTFFunctionBenchmark benchmark;
+  benchmark.runStringExpression("strpos(c0, 'a')", false);
+}
+
+BENCHMARK(utfReplace) {
+  StringAsciiUTFFunctionBenchmark benchmark;
+  benchmark.runStringExpression("replace(c0, 'a', 'bc')", true);
+}
+
+BENCHMARK_RELATIVE(asciiReplace) {
+  StringAsciiUTFFunctionBenchmark benchmark;
+  benchmark.runStringExpression("replace(c0, 'a', 'bc')", false);
+}
+
 BENCHMARK(utfSubStr) {
   StringAsciiUTFFunctionBenchmark benchmark;
   benchmark.runSubStr(true);
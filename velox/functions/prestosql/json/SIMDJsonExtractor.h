@@ -34,7 +34,7 @@ class SIMDJsonExtractor {
    * See class comments in JsonPathTokenizer.h for more details on how json path
    * is interpreted and has notable differences compared to Jayway (used by
    * Presto java).
-   * @param json: A json string of type simdjson::padded_string
+   * @param json: A json string of type simdjson::padded_string_view
    * @param path: Path to locate a JSON object. Following operators are
    * supported.
    *              "$"      Root member of a JSON structure no matter if it's an
@@ -64,7 +64,7 @@ class SIMDJsonExtractor {
    */
   template <typename TConsumer>
   simdjson::error_code extract(
-      const simdjson::padded_string& json,
+      const simdjson::padded_string_view& json,
       TConsumer& consumer,
       bool& isDefinitePath);
 
@@ -78,6 +78,11 @@ class SIMDJsonExtractor {
   /// instance is not passed between threads.
   static SIMDJsonExtractor& getInstance(folly::StringPiece path);
 
+  /// Returns a new SIMDJsonExtractor for 'path' that the caller owns. Used to
+  /// tokenize a constant path once per function instance instead of looking
+  /// it up for every row. Throws if 'path' is invalid.
+  static std::shared_ptr<SIMDJsonExtractor> compile(folly::StringPiece path);
+
  private:
   // Shouldn't instantiate directly - use getInstance().
   explicit SIMDJsonExtractor(const std::string& path) {
@@ -123,7 +128,7 @@ simdjson::error_code extractArray(
 
 template <typename TConsumer>
 simdjson::error_code SIMDJsonExtractor::extract(
-    const simdjson::padded_string& paddedJson,
+    const simdjson::padded_string_view& paddedJson,
     TConsumer& consumer,
     bool& isDefinitePath) {
   SIMDJSON_ASSIGN_OR_RAISE(auto jsonDoc, simdjsonParse(paddedJson));
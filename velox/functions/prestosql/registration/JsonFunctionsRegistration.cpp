@@ -68,6 +68,13 @@ void registerJsonFunctions(const std::string& prefix) {
 
   VELOX_REGISTER_VECTOR_FUNCTION(udf_json_parse, prefix + "json_parse");
 
+  VELOX_REGISTER_VECTOR_FUNCTION(
+      udf_$internal$_json_parse_null_on_error,
+      prefix + "$internal$json_parse_null_on_error");
+  exec::registerExpressionRewrite([prefix](const auto& expr) {
+    return rewriteJsonExtractCall(prefix, expr);
+  });
+
   VELOX_REGISTER_VECTOR_FUNCTION(
       udf_$internal$_json_string_to_array,
       prefix + "$internal$json_string_to_array_cast");
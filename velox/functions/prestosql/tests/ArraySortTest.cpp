@@ -868,6 +868,51 @@ TEST_F(ArraySortTest, timestampWithTimezoneWithLambda) {
       {std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt});
 }
 
+TEST_F(ArraySortTest, shortAndLongIntegerArrays) {
+  // Arrays of up to 16 elements are sorted by a sorting network, long integer
+  // arrays by radix.
+  auto test = [&](auto value) {
+    using T = decltype(value);
+    std::vector<std::vector<T>> arrays;
+    for (auto size : {0, 1, 2, 5, 16, 17, 1'023, 1'024, 3'000}) {
+      std::vector<T> array(size);
+      for (auto i = 0; i < size; ++i) {
+        // Distinct, repeated, negative and positive values.
+        array[i] = static_cast<T>((i * 7'919 + size) % 1'000 - 500) *
+            static_cast<T>(sizeof(T) > 2 ? 1'000'003 : 1);
+      }
+      arrays.push_back(std::move(array));
+    }
+    // The same values in the low bytes, so that radix skips their passes.
+    arrays.push_back(std::vector<T>(2'000, std::numeric_limits<T>::min()));
+    arrays.back()[7] = 0;
+    arrays.back()[11] = std::numeric_limits<T>::max();
+
+    auto ascending = arrays;
+    auto descending = arrays;
+    for (size_t i = 0; i < arrays.size(); ++i) {
+      std::sort(ascending[i].begin(), ascending[i].end());
+      std::sort(descending[i].begin(), descending[i].end(), std::greater<T>());
+    }
+
+    auto data = makeRowVector({makeArrayVector<T>(arrays)});
+    assertEqualVectors(
+        makeArrayVector<T>(ascending), evaluate("array_sort(c0)", data));
+    assertEqualVectors(
+        makeArrayVector<T>(descending), evaluate("array_sort_desc(c0)", data));
+    // The outer call sorts the elements of the inner result in place.
+    assertEqualVectors(
+        makeArrayVector<T>(ascending),
+        evaluate("array_sort(array_sort_desc(c0))", data));
+    assertEqualVectors(makeArrayVector<T>(arrays), data->childAt(0));
+  };
+
+  test(int8_t());
+  test(int16_t());
+  test(int32_t());
+  test(int64_t());
+}
+
 TEST_F(ArraySortTest, floatingPointExtremes) {
   testFloatingPoint<float>();
   testFloatingPoint<double>();
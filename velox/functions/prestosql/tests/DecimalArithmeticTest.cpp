@@ -115,6 +115,17 @@ TEST_F(DecimalArithmeticTest, add) {
        makeNullableFlatVector<int64_t>(
            {1, 2, 5, std::nullopt, std::nullopt}, DECIMAL(10, 3))});
 
+  // The largest inputs of short decimals that add up to a short decimal.
+  testDecimalExpr<TypeKind::BIGINT>(
+      makeFlatVector<int64_t>(
+          {10'999'999'999'999'989, -10'999'999'999'999'989, 1},
+          DECIMAL(17, 2)),
+      "c0 + c1",
+      {makeFlatVector<int64_t>(
+           {999'999'999'999'999, -999'999'999'999'999, 0}, DECIMAL(15, 1)),
+       makeFlatVector<int64_t>(
+           {999'999'999'999'999, -999'999'999'999'999, 1}, DECIMAL(15, 2))});
+
   // Addition overflow.
   VELOX_ASSERT_USER_THROW(
       testDecimalExpr<TypeKind::HUGEINT>(
@@ -201,6 +212,17 @@ TEST_F(DecimalArithmeticTest, subtract) {
        makeNullableFlatVector<int64_t>(
            {1, 2, 5, std::nullopt, std::nullopt}, DECIMAL(10, 3))});
 
+  // The largest inputs of short decimals that subtract to a short decimal.
+  testDecimalExpr<TypeKind::BIGINT>(
+      makeFlatVector<int64_t>(
+          {10'999'999'999'999'989, -10'999'999'999'999'989, -1},
+          DECIMAL(17, 2)),
+      "c0 - c1",
+      {makeFlatVector<int64_t>(
+           {999'999'999'999'999, -999'999'999'999'999, 0}, DECIMAL(15, 1)),
+       makeFlatVector<int64_t>(
+           {-999'999'999'999'999, 999'999'999'999'999, 1}, DECIMAL(15, 2))});
+
   // Subtraction overflow.
   VELOX_ASSERT_USER_THROW(
       testDecimalExpr<TypeKind::HUGEINT>(
@@ -270,6 +292,15 @@ TEST_F(DecimalArithmeticTest, multiply) {
   testDecimalExpr<TypeKind::BIGINT>(
       expectedConstantFlat, "c0 * 1.00", {shortFlat});
 
+  // The largest inputs of short decimals that multiply to a short decimal.
+  testDecimalExpr<TypeKind::BIGINT>(
+      makeFlatVector<int64_t>(
+          {999'999'998'000'000'001, -999'999'998'000'000'001},
+          DECIMAL(18, 5)),
+      "c0 * c1",
+      {makeFlatVector<int64_t>({999'999'999, -999'999'999}, DECIMAL(9, 2)),
+       makeFlatVector<int64_t>({999'999'999, 999'999'999}, DECIMAL(9, 3))});
+
   // Long decimal limits
   VELOX_ASSERT_USER_THROW(
       testDecimalExpr<TypeKind::HUGEINT>(
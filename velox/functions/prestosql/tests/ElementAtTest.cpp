@@ -1428,6 +1428,28 @@ TEST_F(ElementAtTest, timestampWithTimeZoneWithCaching) {
   testCaching({mapOfRowKeys, lookup}, makeConstant<int32_t>(5, 1));
 }
 
+TEST_F(ElementAtTest, sharedLookupTable) {
+  // Several subscripts over the same map vector share one lookup table in the
+  // batch. The maps are large enough to be materialized.
+  vector_size_t vectorSize = 100;
+  auto mapVector = makeMapVector<int64_t, int64_t>(
+      vectorSize,
+      [](auto /*row*/) { return 200; },
+      [](auto idx) { return idx % 200; },
+      [](auto idx) { return idx; });
+  auto data = makeRowVector({mapVector});
+
+  auto result = evaluate("c0[1] + element_at(c0, 5) + c0[7]", data);
+  test::assertEqualVectors(
+      makeFlatVector<int64_t>(
+          vectorSize, [](auto row) { return 600 * row + 13; }),
+      result);
+
+  result = evaluate("c0[1] + element_at(c0, 500)", data);
+  test::assertEqualVectors(
+      makeNullConstant(TypeKind::BIGINT, vectorSize), result);
+}
+
 TEST_F(ElementAtTest, highlySelective) {
   // Verify that selecting a single element from a large array/map will ensure
   // the underlying elements vector is flattened before generating the result
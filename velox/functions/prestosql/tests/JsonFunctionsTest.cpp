@@ -1105,6 +1105,45 @@ TEST_F(JsonFunctionsTest, jsonExtractVarcharInput) {
   EXPECT_EQ(std::nullopt, jsonExtract(kJson, "$.book[1:2]", true));
 }
 
+TEST_F(JsonFunctionsTest, jsonExtractManyPathsVarcharInput) {
+  auto data = makeRowVector({makeNullableFlatVector<std::string>(
+      {R"({"a": 1, "b": "x", "c": {"d": true}})",
+       R"({"a": 2, "c": {"d": false}})",
+       R"({"a": 3, "b": })",
+       std::nullopt})});
+  auto exprSet = compileExpressions(
+      {"json_extract_scalar(c0, '$.a')",
+       "json_extract_scalar(c0, '$.b')",
+       "json_extract(c0, '$.c')"},
+      asRowType(data->type()));
+
+  // The three calls share one parse of c0.
+  const auto& parse = exprSet->expr(0)->inputs()[0];
+  ASSERT_EQ(parse->name(), "$internal$json_parse_null_on_error");
+  ASSERT_EQ(exprSet->expr(1)->inputs()[0], parse);
+  ASSERT_EQ(exprSet->expr(2)->inputs()[0], parse);
+
+  SelectivityVector rows(data->size());
+  std::vector<VectorPtr> results(3);
+  exec::EvalCtx evalCtx(&execCtx_, exprSet.get(), data.get());
+  exprSet->eval(rows, evalCtx, results);
+
+  // The invalid JSON in row 2 is null in all the results.
+  velox::test::assertEqualVectors(
+      makeNullableFlatVector<std::string>(
+          {"1", "2", std::nullopt, std::nullopt}),
+      results[0]);
+  velox::test::assertEqualVectors(
+      makeNullableFlatVector<std::string>(
+          {"x", std::nullopt, std::nullopt, std::nullopt}),
+      results[1]);
+  velox::test::assertEqualVectors(
+      makeNullableFlatVector<std::string>(
+          {R"({"d":true})", R"({"d":false})", std::nullopt, std::nullopt},
+          JSON()),
+      results[2]);
+}
+
 // The following tests ensure that the internal json functions
 // $internal$json_string_to_array/map/row_cast can be invoked without issues
 // from Prestissimo. The actual functionality is tested in JsonCastTest.
@@ -88,6 +88,52 @@ TEST_F(TransformTest, differentResultType) {
   assertEqualVectors(expectedResult, result);
 }
 
+TEST_F(TransformTest, constantCaptures) {
+  vector_size_t size = 1'000;
+  auto input = makeRowVector({
+      makeArrayVector<int64_t>(size, modN(5), modN(7), nullEvery(11)),
+      makeConstant<int64_t>(10, size),
+      makeFlatVector<int64_t>(size, [](auto row) { return row; }),
+      makeConstant<std::string>("a string that is not inlined", size),
+  });
+
+  // Only constant captures.
+  auto result =
+      evaluate<ArrayVector>("transform(c0, x -> x + c1 * 2)", input);
+  auto expectedResult = makeArrayVector<int64_t>(
+      size,
+      modN(5),
+      [](vector_size_t row) { return row % 7 + 20; },
+      nullEvery(11));
+  assertEqualVectors(expectedResult, result);
+
+  result = evaluate<ArrayVector>(
+      "transform(c0, x -> concat(c3, cast(x as varchar)))", input);
+  auto expectedStrings = makeArrayVector<std::string>(
+      size,
+      modN(5),
+      [](vector_size_t row) {
+        return fmt::format("a string that is not inlined{}", row % 7);
+      },
+      nullEvery(11));
+  assertEqualVectors(expectedStrings, result);
+
+  // Constant and non-constant captures.
+  std::vector<int64_t> rowOfElement;
+  for (auto row = 0; row < size; ++row) {
+    if (row % 11 != 0) {
+      rowOfElement.insert(rowOfElement.end(), row % 5, row);
+    }
+  }
+  result = evaluate<ArrayVector>("transform(c0, x -> x + c1 + c2)", input);
+  expectedResult = makeArrayVector<int64_t>(
+      size,
+      modN(5),
+      [&](vector_size_t row) { return row % 7 + 10 + rowOfElement[row]; },
+      nullEvery(11));
+  assertEqualVectors(expectedResult, result);
+}
+
 // Test different lambdas applied to different rows
 TEST_F(TransformTest, conditional) {
   vector_size_t size = 1'000;
@@ -422,6 +422,37 @@ TEST_F(AggregateWindowTest, zeroRangeFrame) {
   test("range between k following and unbounded following", expected);
 }
 
+// Tests sliding frames over partitions that span several output blocks. sum
+// and count compute them by removing the rows that leave the frame. c2 has
+// runs of nulls long enough to make some frames all null.
+TEST_F(AggregateWindowTest, slidingFrames) {
+  auto size = 5'000;
+  auto input = makeRowVector({
+      makeFlatVector<int64_t>(size, [](auto row) { return row % 2; }),
+      makeFlatVector<int64_t>(size, [](auto row) { return row; }),
+      makeFlatVector<int64_t>(
+          size,
+          [](auto row) { return row % 17 - 8; },
+          [](auto row) { return row / 100 % 3 == 0; }),
+  });
+  createDuckDbTable({input});
+
+  const std::vector<std::string> frameClauses = {
+      "rows between 100 preceding and current row",
+      "rows between 10 preceding and 5 following",
+      "rows between 1 preceding and 1 following",
+      "rows between current row and unbounded following",
+  };
+  for (const auto& function : {"sum(c2)", "count(c2)", "sum(1)"}) {
+    WindowTestBase::testWindowFunction(
+        {input},
+        function,
+        {"partition by c0 order by c1"},
+        frameClauses,
+        /*createTable=*/false);
+  }
+}
+
 TEST_F(AggregateWindowTest, singlePartitionColumnForPrefixSort) {
   auto size = 100;
   auto input = makeRowVector(
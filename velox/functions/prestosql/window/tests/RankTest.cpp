@@ -97,6 +97,31 @@ TEST_P(RankTest, randomInput) {
   testWindowFunction({makeRandomInputVector(30)});
 }
 
+// Tests peers over ORDER BY keys of several types with nulls and many peers.
+TEST_P(RankTest, peerKeyTypes) {
+  if (function_ == "row_number()") {
+    GTEST_SKIP() << "row_number() is not deterministic over peers";
+  }
+  const vector_size_t size = 100;
+  auto data = makeRowVector({
+      makeFlatVector<int32_t>(size, [](auto row) { return row % 3; }),
+      makeFlatVector<bool>(
+          size, [](auto row) { return row % 4 == 0; }, nullEvery(7)),
+      makeFlatVector<Timestamp>(
+          size,
+          [](auto row) { return Timestamp(row % 5, (row % 2) * 1'000); },
+          nullEvery(11)),
+      makeFlatVector<double>(
+          size, [](auto row) { return row % 6 * 0.5; }, nullEvery(13)),
+  });
+  WindowTestBase::testWindowFunction(
+      {data},
+      function_,
+      {"partition by c0 order by c1, c2",
+       "partition by c0 order by c2 desc nulls first, c3",
+       "order by c1 nulls first, c3 desc"});
+}
+
 // Run above tests for all combinations of rank function and over clauses.
 VELOX_INSTANTIATE_TEST_SUITE_P(
     RankTestInstantiation,
@@ -16,6 +16,7 @@
 
 #include "velox/functions/remote/client/Remote.h"
 
+#include <folly/futures/Future.h>
 #include <folly/io/async/EventBase.h>
 #include "velox/expression/Expr.h"
 #include "velox/expression/VectorFunction.h"
@@ -43,7 +44,8 @@ class RemoteFunction : public exec::VectorFunction {
         location_(metadata.location),
         thriftClient_(getThriftClient(location_, &eventBase_)),
         serdeFormat_(metadata.serdeFormat),
-        serde_(getSerde(serdeFormat_)) {
+        serde_(getSerde(serdeFormat_)),
+        maxRowsPerRequest_(metadata.maxRowsPerRequest) {
     std::vector<TypePtr> types;
     types.reserve(inputArgs.size());
     serializedInputTypes_.reserve(inputArgs.size());
@@ -77,16 +79,133 @@ class RemoteFunction : public exec::VectorFunction {
       const TypePtr& outputType,
       exec::EvalCtx& context,
       VectorPtr& result) const {
+    auto* pool = context.pool();
+    const auto numRows = rows.end();
+    const auto numSelected = rows.countSelected();
+
+    // Sends only the selected rows. 'indices' maps the position of each of
+    // them in the request to its row. Null if all rows are selected.
+    BufferPtr indices;
+    const vector_size_t* rawIndices = nullptr;
+    if (numSelected < numRows) {
+      indices = allocateIndices(numSelected, pool);
+      auto* mutableIndices = indices->asMutable<vector_size_t>();
+      vector_size_t position = 0;
+      rows.applyToSelected(
+          [&](vector_size_t row) { mutableIndices[position++] = row; });
+      rawIndices = mutableIndices;
+    }
+
+    // Splits the rows into requests of at most 'maxRowsPerRequest_' rows,
+    // which are all in flight at the same time.
+    const vector_size_t rowsPerRequest =
+        maxRowsPerRequest_ > 0 ? maxRowsPerRequest_ : numSelected;
+    std::vector<vector_size_t> offsets;
+    std::vector<folly::SemiFuture<remote::RemoteFunctionResponse>> responses;
+    for (vector_size_t offset = 0; offset < numSelected;
+         offset += rowsPerRequest) {
+      const auto size = std::min(rowsPerRequest, numSelected - offset);
+      std::vector<VectorPtr> requestArgs;
+      requestArgs.reserve(args.size());
+      for (const auto& arg : args) {
+        if (indices) {
+          requestArgs.push_back(BaseVector::wrapInDictionary(
+              nullptr,
+              Buffer::slice<vector_size_t>(indices, offset, size, pool),
+              size,
+              arg));
+        } else if (size == numRows) {
+          requestArgs.push_back(arg);
+        } else {
+          requestArgs.push_back(arg->slice(offset, size));
+        }
+      }
+      offsets.push_back(offset);
+      responses.push_back(thriftClient_->semifuture_invokeFunction(
+          makeRequest(std::move(requestArgs), size, outputType, context)));
+    }
+    args.clear();
+
+    auto tries = folly::collectAll(std::move(responses))
+                     .via(&eventBase_)
+                     .getVia(&eventBase_);
+
+    VectorPtr selectedResult;
+    for (size_t i = 0; i < tries.size(); ++i) {
+      remote::RemoteFunctionResponse remoteResponse;
+      try {
+        remoteResponse = std::move(tries[i].value());
+      } catch (const std::exception& e) {
+        VELOX_FAIL(
+            "Error while executing remote function '{}' at '{}': {}",
+            functionName_,
+            location_.describe(),
+            e.what());
+      }
+
+      const auto offset = offsets[i];
+      auto outputRowVector = IOBufToRowVector(
+          remoteResponse.result().value().payload().value(),
+          ROW({outputType}),
+          *pool,
+          serde_.get());
+      auto requestResult = outputRowVector->childAt(0);
+      if (tries.size() == 1) {
+        selectedResult = std::move(requestResult);
+      } else {
+        if (!selectedResult) {
+          selectedResult = BaseVector::create(outputType, numSelected, pool);
+        }
+        selectedResult->copy(
+            requestResult.get(), offset, 0, requestResult->size());
+      }
+
+      if (auto errorPayload = remoteResponse.result().value().errorPayload()) {
+        auto errorsRowVector = IOBufToRowVector(
+            *errorPayload, ROW({VARCHAR()}), *pool, serde_.get());
+        auto errorsVector =
+            errorsRowVector->childAt(0)->asFlatVector<StringView>();
+        VELOX_CHECK(errorsVector, "Should be convertible to flat vector");
+
+        for (vector_size_t j = 0; j < errorsRowVector->size(); ++j) {
+          if (errorsVector->isNullAt(j)) {
+            continue;
+          }
+          const auto row = rawIndices ? rawIndices[offset + j] : offset + j;
+          try {
+            throw std::runtime_error(errorsVector->valueAt(j));
+          } catch (const std::exception& ex) {
+            context.setError(row, std::current_exception());
+          }
+        }
+      }
+    }
+
+    if (!indices) {
+      result = std::move(selectedResult);
+      return;
+    }
+
+    // Maps each selected row to its position in 'selectedResult'.
+    auto rowIndices = allocateIndices(numRows, pool);
+    auto* rawRowIndices = rowIndices->asMutable<vector_size_t>();
+    for (vector_size_t i = 0; i < numSelected; ++i) {
+      rawRowIndices[rawIndices[i]] = i;
+    }
+    result = BaseVector::wrapInDictionary(
+        nullptr, std::move(rowIndices), numRows, std::move(selectedResult));
+  }
+
+  // Returns a request to evaluate the function over 'size' rows of 'args'.
+  remote::RemoteFunctionRequest makeRequest(
+      std::vector<VectorPtr> args,
+      vector_size_t size,
+      const TypePtr& outputType,
+      exec::EvalCtx& context) const {
     // Create type and row vector for serialization.
     auto remoteRowVector = std::make_shared<RowVector>(
-        context.pool(),
-        remoteInputType_,
-        BufferPtr{},
-        rows.end(),
-        std::move(args));
-
-    // Send to remote server.
-    remote::RemoteFunctionResponse remoteResponse;
+        context.pool(), remoteInputType_, BufferPtr{}, size, std::move(args));
+
     remote::RemoteFunctionRequest request;
     request.throwOnError_ref() = context.throwOnError();
 
@@ -96,58 +215,22 @@ class RemoteFunction : public exec::VectorFunction {
     functionHandle->argumentTypes_ref() = serializedInputTypes_;
 
     auto requestInputs = request.inputs_ref();
-    requestInputs->rowCount_ref() = remoteRowVector->size();
+    requestInputs->rowCount_ref() = size;
     requestInputs->pageFormat_ref() = serdeFormat_;
-
-    // TODO: serialize only active rows.
     requestInputs->payload_ref() = rowVectorToIOBuf(
-        remoteRowVector, rows.end(), *context.pool(), serde_.get());
-
-    try {
-      thriftClient_->sync_invokeFunction(remoteResponse, request);
-    } catch (const std::exception& e) {
-      VELOX_FAIL(
-          "Error while executing remote function '{}' at '{}': {}",
-          functionName_,
-          location_.describe(),
-          e.what());
-    }
-
-    auto outputRowVector = IOBufToRowVector(
-        remoteResponse.result().value().payload().value(),
-        ROW({outputType}),
-        *context.pool(),
-        serde_.get());
-    result = outputRowVector->childAt(0);
-
-    if (auto errorPayload = remoteResponse.result().value().errorPayload()) {
-      auto errorsRowVector = IOBufToRowVector(
-          *errorPayload, ROW({VARCHAR()}), *context.pool(), serde_.get());
-      auto errorsVector =
-          errorsRowVector->childAt(0)->asFlatVector<StringView>();
-      VELOX_CHECK(errorsVector, "Should be convertible to flat vector");
-
-      SelectivityVector selectedRows(errorsRowVector->size());
-      selectedRows.applyToSelected([&](vector_size_t i) {
-        if (errorsVector->isNullAt(i)) {
-          return;
-        }
-        try {
-          throw std::runtime_error(errorsVector->valueAt(i));
-        } catch (const std::exception& ex) {
-          context.setError(i, std::current_exception());
-        }
-      });
-    }
+        remoteRowVector, size, *context.pool(), serde_.get());
+    return request;
   }
 
   const std::string functionName_;
   folly::SocketAddress location_;
 
-  folly::EventBase eventBase_;
+  // Driven by apply() while waiting for the responses.
+  mutable folly::EventBase eventBase_;
   std::unique_ptr<RemoteFunctionClient> thriftClient_;
   remote::PageFormat serdeFormat_;
   std::unique_ptr<VectorSerde> serde_;
+  const vector_size_t maxRowsPerRequest_;
 
   // Structures we construct once to cache:
   RowTypePtr remoteInputType_;
@@ -30,6 +30,12 @@ struct RemoteVectorFunctionMetadata : public exec::VectorFunctionMetadata {
 
   /// The serialization format to be used
   remote::PageFormat serdeFormat{remote::PageFormat::PRESTO_PAGE};
+
+  /// The maximum number of rows to send in one request. Larger batches are
+  /// split into requests that are in flight at the same time, which overlaps
+  /// the serialization, the network round trips and the evaluation on the
+  /// server. 0 means no limit.
+  vector_size_t maxRowsPerRequest{0};
 };
 
 /// Registers a new remote function. It will use the meatadata defined in
@@ -114,6 +114,14 @@ class RemoteFunctionTest
                               .build()};
     registerRemoteFunction("remote_divide", divSignatures, metadata);
 
+    // Sends at most 3 rows per request.
+    RemoteVectorFunctionMetadata chunkedMetadata = metadata;
+    chunkedMetadata.maxRowsPerRequest = 3;
+    registerRemoteFunction(
+        "remote_plus_chunked", plusSignatures, chunkedMetadata);
+    registerRemoteFunction(
+        "remote_divide_chunked", divSignatures, chunkedMetadata);
+
     auto substrSignatures = {exec::FunctionSignatureBuilder()
                                  .returnType("varchar")
                                  .argumentType("varchar")
@@ -135,6 +143,10 @@ class RemoteFunctionTest
         {params.functionPrefix + ".remote_fail"});
     registerFunction<CheckedDivideFunction, double, double, double>(
         {params.functionPrefix + ".remote_divide"});
+    registerFunction<PlusFunction, int64_t, int64_t, int64_t>(
+        {params.functionPrefix + ".remote_plus_chunked"});
+    registerFunction<CheckedDivideFunction, double, double, double>(
+        {params.functionPrefix + ".remote_divide_chunked"});
     registerFunction<SubstrFunction, Varchar, Varchar, int32_t>(
         {params.functionPrefix + ".remote_substr"});
     registerFunction<OpaqueTypeFunction, int64_t, std::shared_ptr<Foo>>(
@@ -181,6 +193,43 @@ TEST_P(RemoteFunctionTest, tryException) {
   assertEqualVectors(expected, results);
 }
 
+TEST_P(RemoteFunctionTest, chunked) {
+  auto data = makeRowVector(
+      {makeFlatVector<int64_t>(10, [](auto row) { return row; })});
+  auto results =
+      evaluate<SimpleVector<int64_t>>("remote_plus_chunked(c0, c0)", data);
+  assertEqualVectors(
+      makeFlatVector<int64_t>(10, [](auto row) { return row * 2; }), results);
+
+  // Only the selected rows are sent.
+  results = evaluate<SimpleVector<int64_t>>(
+      "if(c0 % 3 = 0, 0, remote_plus_chunked(c0, c0))", data);
+  assertEqualVectors(
+      makeFlatVector<int64_t>(
+          10, [](auto row) { return row % 3 == 0 ? 0 : row * 2; }),
+      results);
+
+  results = evaluate<SimpleVector<int64_t>>(
+      "if(c0 % 3 = 0, 0, remote_plus(c0, c0))", data);
+  assertEqualVectors(
+      makeFlatVector<int64_t>(
+          10, [](auto row) { return row % 3 == 0 ? 0 : row * 2; }),
+      results);
+
+  // The errors are set on the rows they come from.
+  auto numerators = makeFlatVector<double>(10, [](auto row) { return row; });
+  auto denominators = makeFlatVector<double>(
+      10, [](auto row) { return row % 4 == 3 ? 0 : 1; });
+  auto divideResults = evaluate<SimpleVector<double>>(
+      "if(c2 % 2 = 0, null::double, TRY(remote_divide_chunked(c0, c1)))",
+      makeRowVector({numerators, denominators, data->childAt(0)}));
+  auto expected = makeFlatVector<double>(
+      10,
+      [](auto row) { return row; },
+      [](auto row) { return row % 2 == 0 || row % 4 == 3; });
+  assertEqualVectors(expected, divideResults);
+}
+
 TEST_P(RemoteFunctionTest, conditionalConjunction) {
   // conditional conjunction disables throwing on error.
   auto inputVector0 = makeFlatVector<bool>({true, true});
@@ -292,33 +292,40 @@ class RowVectorHasher : public SparkVectorHasher<HashClass> {
   std::vector<std::shared_ptr<SparkVectorHasher<HashClass>>> hashers_;
 };
 
+// Hashes a column of primitive values into 'result' one column at a time,
+// without a virtual call per value. The loop over flat values has no
+// indirection, so that the compiler can vectorize it.
 template <typename HashClass, typename ReturnType, typename ArgType>
 void hashSimdTyped(
     const SelectivityVector* rows,
-    std::vector<VectorPtr>& args,
-    FlatVector<ReturnType>& result,
-    const int32_t hashIdx) {
-  const ArgType* __restrict rawA =
-      args[hashIdx]->asUnchecked<FlatVector<ArgType>>()->rawValues();
+    const DecodedVector& decoded,
+    FlatVector<ReturnType>& result) {
   auto* __restrict rawResult = result.template mutableRawValues<ReturnType>();
-  rows->applyToSelected([&](auto row) {
-    rawResult[row] = hashOne<HashClass>(rawA[row], rawResult[row]);
-  });
+  if (decoded.isIdentityMapping()) {
+    const ArgType* __restrict rawA = decoded.data<ArgType>();
+    rows->applyToSelected([&](auto row) {
+      rawResult[row] = hashOne<HashClass>(rawA[row], rawResult[row]);
+    });
+  } else {
+    rows->applyToSelected([&](auto row) {
+      rawResult[row] = hashOne<HashClass>(
+          decoded.valueAt<ArgType>(row), rawResult[row]);
+    });
+  }
 }
 
 template <typename HashClass, typename ReturnType>
 void hashSimd(
     const SelectivityVector* rows,
-    std::vector<VectorPtr>& args,
-    FlatVector<ReturnType>& result,
-    const int32_t hashIdx) {
-  switch (args[hashIdx]->typeKind()) {
+    const DecodedVector& decoded,
+    FlatVector<ReturnType>& result) {
+  switch (decoded.base()->typeKind()) {
 #define SCALAR_CASE(kind) \
   case TypeKind::kind:    \
     return hashSimdTyped< \
         HashClass,        \
         ReturnType,       \
-        TypeTraits<TypeKind::kind>::NativeType>(rows, args, result, hashIdx);
+        TypeTraits<TypeKind::kind>::NativeType>(rows, decoded, result);
     SCALAR_CASE(TINYINT)
     SCALAR_CASE(SMALLINT)
     SCALAR_CASE(INTEGER)
@@ -373,9 +380,8 @@ void applyWithType(
          kind == TypeKind::REAL || kind == TypeKind::DOUBLE ||
          kind == TypeKind::TIMESTAMP || kind == TypeKind::VARCHAR ||
          kind == TypeKind::VARBINARY || kind == TypeKind::HUGEINT ||
-         kind == TypeKind::UNKNOWN) &&
-        args[i]->isFlatEncoding()) {
-      hashSimd<HashClass, ReturnType>(selected, args, result, i);
+         kind == TypeKind::UNKNOWN)) {
+      hashSimd<HashClass, ReturnType>(selected, *decoded, result);
       continue;
     }
 
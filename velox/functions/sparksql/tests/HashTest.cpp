@@ -303,5 +303,20 @@ TEST_F(HashTest, simd) {
   runSIMDHashAndAssert<UnknownValue>(UnknownValue(), 42, 10);
 }
 
+TEST_F(HashTest, encodedInputs) {
+  auto flat = makeNullableFlatVector<int64_t>(
+      {1, std::nullopt, -1, 0xcafecafe, std::nullopt, 42});
+  auto expected = hash(flat);
+
+  auto indices = makeIndicesInReverse(flat->size());
+  assertEqualVectors(
+      wrapInDictionary(indices, expected),
+      hash(wrapInDictionary(indices, flat)));
+
+  auto constant = BaseVector::wrapInConstant(flat->size(), 3, flat);
+  assertEqualVectors(
+      BaseVector::wrapInConstant(flat->size(), 3, expected), hash(constant));
+}
+
 } // namespace
 } // namespace facebook::velox::functions::sparksql::test
@@ -149,6 +149,31 @@ TEST_F(FunctionRegistryTest, removeFunction) {
   checkFunctionExists(functionName, 0, 0);
 }
 
+TEST_F(FunctionRegistryTest, simpleFunctionResolutionCache) {
+  const std::string functionName = "func_cached";
+  auto& registry = exec::simpleFunctions();
+  ASSERT_FALSE(registry.resolveFunction(functionName, {VARCHAR()}).has_value());
+  const auto numCached = registry.numCachedResolutions();
+  ASSERT_GT(numCached, 0);
+
+  // Registering a function clears the cache, including the failed resolution.
+  registerFunction<FuncOne, Varchar, Varchar>(
+      std::vector<std::string>{functionName});
+  ASSERT_EQ(registry.numCachedResolutions(), 0);
+  for (auto i = 0; i < 2; ++i) {
+    auto resolved = registry.resolveFunction(functionName, {VARCHAR()});
+    ASSERT_TRUE(resolved.has_value());
+    ASSERT_EQ(*resolved->type(), *VARCHAR());
+    ASSERT_EQ(registry.numCachedResolutions(), 1);
+  }
+  ASSERT_FALSE(registry.resolveFunction(functionName, {BIGINT()}).has_value());
+  ASSERT_EQ(registry.numCachedResolutions(), 2);
+
+  removeFunction(functionName);
+  ASSERT_EQ(registry.numCachedResolutions(), 0);
+  ASSERT_FALSE(registry.resolveFunction(functionName, {VARCHAR()}).has_value());
+}
+
 TEST_F(FunctionRegistryTest, getFunctionSignaturesByName) {
   {
     auto signatures = getFunctionSignatures("func_one");
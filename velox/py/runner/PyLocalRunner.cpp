@@ -16,6 +16,7 @@
 
 #include "velox/py/runner/PyLocalRunner.h"
 
+#include <cerrno>
 #include <pybind11/stl.h>
 #include "velox/connectors/hive/HiveConnectorSplit.h"
 #include "velox/core/PlanNode.h"
@@ -24,6 +25,8 @@
 #include "velox/exec/PlanNodeStats.h"
 #include "velox/exec/Spill.h"
 #include "velox/py/vector/PyVector.h"
+#include "velox/vector/arrow/Abi.h"
+#include "velox/vector/arrow/Bridge.h"
 
 namespace facebook::velox::py {
 namespace {
@@ -38,6 +41,59 @@ std::mutex& taskRegistryLock() {
   return lock;
 }
 
+// The private data of the ArrowArrayStream returned by executeArrowStream().
+struct ArrowStreamState {
+  std::shared_ptr<exec::TaskCursor> cursor;
+  std::shared_ptr<memory::MemoryPool> pool;
+  RowTypePtr outputType;
+  std::string lastError;
+};
+
+ArrowStreamState* streamState(ArrowArrayStream* stream) {
+  return static_cast<ArrowStreamState*>(stream->private_data);
+}
+
+int getStreamSchema(ArrowArrayStream* stream, ArrowSchema* out) {
+  auto* state = streamState(stream);
+  try {
+    exportToArrow(
+        BaseVector::create(state->outputType, 0, state->pool.get()), *out);
+  } catch (const std::exception& e) {
+    state->lastError = e.what();
+    return EINVAL;
+  }
+  return 0;
+}
+
+// The batches are flattened so that they all match the schema.
+int getStreamNext(ArrowArrayStream* stream, ArrowArray* out) {
+  auto* state = streamState(stream);
+  try {
+    if (!state->cursor->moveNext()) {
+      // A released array marks the end of the stream.
+      out->release = nullptr;
+      return 0;
+    }
+    VectorPtr vector = state->cursor->current();
+    BaseVector::flattenVector(vector);
+    exportToArrow(vector, *out, state->pool.get());
+  } catch (const std::exception& e) {
+    state->lastError = e.what();
+    return EIO;
+  }
+  return 0;
+}
+
+const char* getStreamLastError(ArrowArrayStream* stream) {
+  const auto& error = streamState(stream)->lastError;
+  return error.empty() ? nullptr : error.c_str();
+}
+
+void releaseStream(ArrowArrayStream* stream) {
+  delete streamState(stream);
+  stream->release = nullptr;
+}
+
 } // namespace
 
 namespace py = pybind11;
@@ -47,6 +103,8 @@ PyVector PyTaskIterator::Iterator::operator*() const {
 }
 
 void PyTaskIterator::Iterator::advance() {
+  // Lets other Python threads run while the drivers produce the next batch.
+  py::gil_scoped_release release;
   if (cursor_ && cursor_->moveNext()) {
     vector_ = cursor_->current();
   } else {
@@ -57,7 +115,9 @@ void PyTaskIterator::Iterator::advance() {
 PyLocalRunner::PyLocalRunner(
     const PyPlanNode& pyPlanNode,
     const std::shared_ptr<memory::MemoryPool>& pool,
-    const std::shared_ptr<folly::CPUThreadPoolExecutor>& executor)
+    const std::shared_ptr<folly::CPUThreadPoolExecutor>& executor,
+    int32_t maxDrivers,
+    uint64_t bufferedBytes)
     : rootPool_(pool),
       outputPool_(memory::memoryManager()->addLeafPool()),
       executor_(executor),
@@ -76,7 +136,9 @@ PyLocalRunner::PyLocalRunner(
 
   cursor_ = exec::TaskCursor::create({
       .planNode = planNode_,
+      .maxDrivers = maxDrivers,
       .queryCtx = queryCtx,
+      .bufferedBytes = bufferedBytes,
       .outputPool = outputPool_,
   });
 }
@@ -91,10 +153,11 @@ void PyLocalRunner::addFileSplit(
   cursor_->task()->addSplit(planId, std::move(split));
 }
 
-py::iterator PyLocalRunner::execute() {
-  if (pyIterator_) {
+void PyLocalRunner::startTask() {
+  if (started_) {
     throw std::runtime_error("PyLocalRunner can only be executed once.");
   }
+  started_ = true;
 
   // Add any files passed by the client during plan building.
   for (auto& [scanId, splits] : *scanFiles_) {
@@ -108,11 +171,38 @@ py::iterator PyLocalRunner::execute() {
     std::lock_guard<std::mutex> guard(taskRegistryLock());
     taskRegistry().push_back(cursor_->task());
   }
+}
 
+py::iterator PyLocalRunner::execute() {
+  startTask();
   pyIterator_ = std::make_shared<PyTaskIterator>(cursor_, outputPool_);
   return py::make_iterator(pyIterator_->begin(), pyIterator_->end());
 }
 
+py::capsule PyLocalRunner::executeArrowStream() {
+  startTask();
+  auto* stream = new ArrowArrayStream{
+      .get_schema = getStreamSchema,
+      .get_next = getStreamNext,
+      .get_last_error = getStreamLastError,
+      .release = releaseStream,
+      .private_data = new ArrowStreamState{
+          .cursor = cursor_,
+          .pool = outputPool_,
+          .outputType = asRowType(planNode_->outputType()),
+      }};
+  // The consumer moves the stream out of the capsule and marks it released.
+  // Otherwise the stream is released with the capsule.
+  return py::capsule(stream, "arrow_array_stream", [](PyObject* capsule) {
+    auto* stream = static_cast<ArrowArrayStream*>(
+        PyCapsule_GetPointer(capsule, "arrow_array_stream"));
+    if (stream->release != nullptr) {
+      stream->release(stream);
+    }
+    delete stream;
+  });
+}
+
 std::string PyLocalRunner::printPlanWithStats() const {
   return exec::printPlanWithStats(
       *planNode_, cursor_->task()->taskStats(), true);
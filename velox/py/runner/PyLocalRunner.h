@@ -34,12 +34,17 @@ class PyTaskIterator;
 /// velox.py.plan_builder).
 /// @param pool The memory pool to pass to the task.
 /// @param executor The executor that will be used by drivers.
+/// @param maxDrivers The maximum number of drivers per pipeline.
+/// @param bufferedBytes The size of the output batches the drivers produce
+/// before they wait for the client to consume them.
 class PyLocalRunner {
  public:
   explicit PyLocalRunner(
       const PyPlanNode& pyPlanNode,
       const std::shared_ptr<memory::MemoryPool>& pool,
-      const std::shared_ptr<folly::CPUThreadPoolExecutor>& executor);
+      const std::shared_ptr<folly::CPUThreadPoolExecutor>& executor,
+      int32_t maxDrivers = 1,
+      uint64_t bufferedBytes = 512 * 1024);
 
   /// Add a split to scan an entire file.
   ///
@@ -54,6 +59,12 @@ class PyLocalRunner {
   /// Execute the task and returns an iterable to the output vectors.
   pybind11::iterator execute();
 
+  /// Executes the task and returns a PyCapsule holding an ArrowArrayStream of
+  /// the output, as defined by the Arrow PyCapsule interface. Fixed width
+  /// columns are not copied. Backs __arrow_c_stream__(), so that PyArrow and
+  /// Polars can read the output directly.
+  pybind11::capsule executeArrowStream();
+
   /// Prints a descriptive debug message containing plan and execution stats.
   /// If the task hasn't finished, will print the plan with the current stats.
   std::string printPlanWithStats() const;
@@ -61,6 +72,10 @@ class PyLocalRunner {
  private:
   friend class PyTaskIterator;
 
+  // Adds the splits of the files passed during plan building and registers
+  // the task. Throws if called twice.
+  void startTask();
+
   // Memory pools and thread pool to be used by queryCtx.
   std::shared_ptr<memory::MemoryPool> rootPool_;
   std::shared_ptr<memory::MemoryPool> outputPool_;
@@ -75,6 +90,8 @@ class PyLocalRunner {
   // The Python iterator that exposes output vectors.
   std::shared_ptr<PyTaskIterator> pyIterator_;
 
+  bool started_{false};
+
   const TScanFilesPtr scanFiles_;
 };
 
@@ -39,10 +39,43 @@ PYBIND11_MODULE(runner, m) {
 
   py::class_<velox::py::PyLocalRunner>(m, "LocalRunner")
       // Only expose the plan node through the Python API.
-      .def(py::init([](const velox::py::PyPlanNode& planNode) {
-        return velox::py::PyLocalRunner{planNode, rootPool, executor};
-      }))
-      .def("execute", &velox::py::PyLocalRunner::execute)
+      .def(
+          py::init([](const velox::py::PyPlanNode& planNode,
+                      int32_t maxDrivers,
+                      uint64_t bufferedBytes) {
+            return velox::py::PyLocalRunner{
+                planNode, rootPool, executor, maxDrivers, bufferedBytes};
+          }),
+          py::arg("plan_node"),
+          py::arg("max_drivers") = 1,
+          py::arg("buffered_bytes") = 512 * 1024,
+          py::doc(R"(
+        Creates a runner for the plan.
+
+        Args:
+          plan_node: The plan to execute.
+          max_drivers: The maximum number of threads running each pipeline.
+          buffered_bytes: The size of the output the drivers produce before
+                          they wait for the client to consume it.
+          )"))
+      .def(
+          "execute",
+          &velox::py::PyLocalRunner::execute,
+          py::doc(R"(
+        Executes the plan and returns an iterator over the output vectors.
+        The GIL is released while waiting for the next vector.
+          )"))
+      .def(
+          "__arrow_c_stream__",
+          [](velox::py::PyLocalRunner& runner, py::object /*requestedSchema*/) {
+            return runner.executeArrowStream();
+          },
+          py::arg("requested_schema") = py::none(),
+          py::doc(R"(
+        Executes the plan and returns its output as an Arrow C stream
+        PyCapsule, e.g. for pyarrow.RecordBatchReader.from_stream() or
+        polars.from_arrow(). The requested schema is ignored.
+          )"))
       .def(
           "print_plan_with_stats",
           &velox::py::PyLocalRunner::printPlanWithStats,
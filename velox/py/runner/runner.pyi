@@ -18,12 +18,16 @@
 
 from typing import Iterator
 
+from velox.py.plan_builder import PlanNode
 from velox.py.vector import Vector
 
 
 class LocalRunner:
-    def __init__(self, PlanNode) -> None: ...
+    def __init__(
+        self, plan_node: PlanNode, max_drivers: int = 1, buffered_bytes: int = 524288
+    ) -> None: ...
     def execute(self) -> Iterator[Vector]: ...
+    def __arrow_c_stream__(self, requested_schema: object = None) -> object: ...
     def add_file_split(self, plan_id: str, file_path: str) -> None: ...
     def print_plan_with_stats(self) -> str: ...
 
@@ -64,6 +64,43 @@ class TestPyVeloxRunner(unittest.TestCase):
             total_size += vector.size()
         self.assertEqual(total_size, 100)
 
+    def test_runner_multi_threaded(self):
+        vectors = []
+        batch_size = 10
+        num_batches = 10
+
+        for i in range(num_batches):
+            array = pyarrow.array(list(range(i * batch_size, (i + 1) * batch_size)))
+            batch = pyarrow.record_batch([array], names=["c0"])
+            vectors.append(to_velox(batch))
+
+        plan_builder = PlanBuilder().values(vectors).order_by(["c0 DESC"])
+        runner = LocalRunner(
+            plan_builder.get_plan_node(), max_drivers=4, buffered_bytes=1024
+        )
+        total_size = 0
+
+        for vector in runner.execute():
+            total_size += vector.size()
+        self.assertEqual(total_size, batch_size * num_batches)
+
+    def test_runner_arrow_stream(self):
+        vectors = []
+        batch_size = 10
+        num_batches = 10
+
+        for i in range(num_batches):
+            array = pyarrow.array(list(range(i * batch_size, (i + 1) * batch_size)))
+            batch = pyarrow.record_batch([array], names=["c0"])
+            vectors.append(to_velox(batch))
+
+        plan_builder = PlanBuilder().values(vectors)
+        runner = LocalRunner(plan_builder.get_plan_node())
+        table = pyarrow.RecordBatchReader.from_stream(runner).read_all()
+        self.assertEqual(table.num_rows, batch_size * num_batches)
+        self.assertEqual(table.column("c0").to_pylist(), list(range(100)))
+        self.assertRaises(RuntimeError, runner.execute)
+
     def test_runner_with_values_order_limit(self):
         vectors = []
         batch_size = 10
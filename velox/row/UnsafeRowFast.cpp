@@ -15,6 +15,11 @@
  */
 #include "velox/row/UnsafeRowFast.h"
 
+#include <numeric>
+
+#include "velox/common/memory/RawVector.h"
+#include "velox/row/UnsafeRowDeserializers.h"
+
 namespace facebook::velox::row {
 
 namespace {
@@ -172,6 +177,14 @@ int32_t UnsafeRowFast::serialize(vector_size_t index, char* buffer) const {
   return serializeRow(index, buffer);
 }
 
+void UnsafeRowFast::serialize(
+    vector_size_t offset,
+    vector_size_t size,
+    const size_t* bufferOffsets,
+    char* buffer) const {
+  serializeRow(offset, size, bufferOffsets, buffer);
+}
+
 void UnsafeRowFast::serializeFixedWidth(vector_size_t index, char* buffer)
     const {
   VELOX_DCHECK(fixedWidthTypeKind_);
@@ -425,4 +438,190 @@ int32_t UnsafeRowFast::serializeRow(vector_size_t index, char* buffer) const {
 
   return variableWidthOffset;
 }
+
+void UnsafeRowFast::serializeRow(
+    vector_size_t offset,
+    vector_size_t size,
+    const size_t* bufferOffsets,
+    char* buffer) const {
+  const bool contiguous = decoded_.isIdentityMapping();
+  raw_vector<vector_size_t> rows(size);
+  if (contiguous) {
+    std::iota(rows.begin(), rows.end(), offset);
+  } else {
+    for (auto i = 0; i < size; ++i) {
+      rows[i] = decoded_.index(offset + i);
+    }
+  }
+
+  // Offsets of the next variable-width value within each row.
+  std::vector<int64_t> variableWidthOffsets(
+      size, rowNullBytes_ + kFieldWidth * children_.size());
+
+  for (auto childIdx = 0; childIdx < children_.size(); ++childIdx) {
+    const auto& child = children_[childIdx];
+    const size_t fieldOffset = rowNullBytes_ + childIdx * kFieldWidth;
+
+    // Null flags of a flat child over contiguous rows are scanned a word at a
+    // time instead of testing each row.
+    const bool flat = contiguous && child.decoded_.isIdentityMapping();
+    const uint64_t* rawNulls =
+        flat ? child.decoded_.base()->rawNulls() : nullptr;
+    const bool testNulls = !flat && child.decoded_.mayHaveNulls();
+
+    if (rawNulls != nullptr) {
+      bits::forEachUnsetBit(rawNulls, offset, offset + size, [&](auto row) {
+        bits::setBit(buffer + bufferOffsets[row - offset], childIdx, true);
+      });
+    } else if (testNulls) {
+      for (auto i = 0; i < size; ++i) {
+        if (child.isNullAt(rows[i])) {
+          bits::setBit(buffer + bufferOffsets[i], childIdx, true);
+        }
+      }
+    }
+
+    // Calls 'func' with the positions in 'rows' of non-null values.
+    auto forEachNonNull = [&](auto func) {
+      if (rawNulls != nullptr) {
+        bits::forEachSetBit(rawNulls, offset, offset + size, [&](auto row) {
+          func(row - offset);
+        });
+      } else {
+        for (auto i = 0; i < size; ++i) {
+          if (!testNulls || !child.isNullAt(rows[i])) {
+            func(i);
+          }
+        }
+      }
+    };
+
+    if (childIsFixedWidth_[childIdx]) {
+      const auto* rawValues = child.decoded_.data<char>();
+      if (flat && child.supportsBulkCopy_ && rawValues != nullptr) {
+        const auto valueBytes = child.valueBytes_;
+        forEachNonNull([&](auto i) {
+          ::memcpy(
+              buffer + bufferOffsets[i] + fieldOffset,
+              rawValues + rows[i] * valueBytes,
+              valueBytes);
+        });
+      } else {
+        forEachNonNull([&](auto i) {
+          child.serializeFixedWidth(
+              rows[i], buffer + bufferOffsets[i] + fieldOffset);
+        });
+      }
+      continue;
+    }
+
+    forEachNonNull([&](auto i) {
+      auto* row = buffer + bufferOffsets[i];
+      auto& variableWidthOffset = variableWidthOffsets[i];
+      const auto valueSize =
+          child.serializeVariableWidth(rows[i], row + variableWidthOffset);
+      // Write size and offset.
+      uint64_t sizeAndOffset = variableWidthOffset << 32 | valueSize;
+      reinterpret_cast<uint64_t*>(row + rowNullBytes_)[childIdx] =
+          sizeAndOffset;
+
+      variableWidthOffset += alignBytes(valueSize);
+    });
+  }
+}
+
+namespace {
+
+// Deserializes the fixed-width field 'column' of all 'data' rows.
+template <TypeKind Kind>
+VectorPtr deserializeFixedWidth(
+    const TypePtr& type,
+    const std::vector<std::optional<std::string_view>>& data,
+    int32_t column,
+    size_t nullBytes,
+    memory::MemoryPool* pool) {
+  using T = typename TypeTraits<Kind>::NativeType;
+
+  const vector_size_t numRows = data.size();
+  auto flatVector = BaseVector::create<FlatVector<T>>(type, numRows, pool);
+  auto nulls = allocateNulls(numRows, pool);
+  auto* rawNulls = nulls->asMutable<uint64_t>();
+  bool hasNulls = false;
+
+  const size_t valueOffset = nullBytes + column * kFieldWidth;
+  for (auto i = 0; i < numRows; ++i) {
+    const char* row = data[i]->data();
+    if (bits::isBitSet(reinterpret_cast<const uint8_t*>(row), column)) {
+      bits::setBit(rawNulls, i, bits::kNull);
+      hasNulls = true;
+    } else if constexpr (std::is_same_v<T, Timestamp>) {
+      int64_t micros;
+      ::memcpy(&micros, row + valueOffset, sizeof(int64_t));
+      flatVector->set(i, Timestamp::fromMicros(micros));
+    } else {
+      T value;
+      ::memcpy(&value, row + valueOffset, sizeof(T));
+      flatVector->set(i, value);
+    }
+  }
+
+  if (hasNulls) {
+    flatVector->setNulls(nulls);
+  }
+  return flatVector;
+}
+
+// Returns the views over the variable-width field 'column' of all 'data'
+// rows. Null values are std::nullopt.
+std::vector<std::optional<std::string_view>> variableWidthValues(
+    const std::vector<std::optional<std::string_view>>& data,
+    int32_t column,
+    size_t nullBytes) {
+  std::vector<std::optional<std::string_view>> values(data.size());
+  const size_t valueOffset = nullBytes + column * kFieldWidth;
+  for (auto i = 0; i < data.size(); ++i) {
+    const char* row = data[i]->data();
+    if (bits::isBitSet(reinterpret_cast<const uint8_t*>(row), column)) {
+      continue;
+    }
+    uint64_t offsetAndSize;
+    ::memcpy(&offsetAndSize, row + valueOffset, sizeof(uint64_t));
+    values[i] = std::string_view(
+        row + (offsetAndSize >> 32), static_cast<uint32_t>(offsetAndSize));
+  }
+  return values;
+}
+} // namespace
+
+// static
+RowVectorPtr UnsafeRowFast::deserialize(
+    const std::vector<std::optional<std::string_view>>& data,
+    const RowTypePtr& rowType,
+    memory::MemoryPool* pool) {
+  for (const auto& row : data) {
+    if (!row.has_value()) {
+      // Null rows are only supported by the row-by-row deserializer.
+      return std::dynamic_pointer_cast<RowVector>(
+          UnsafeRowDeserializer::deserialize(data, rowType, pool));
+    }
+  }
+
+  const auto numFields = rowType->size();
+  const size_t nullBytes = alignBits(numFields);
+
+  std::vector<VectorPtr> fields(numFields);
+  for (auto i = 0; i < numFields; ++i) {
+    const auto& type = rowType->childAt(i);
+    if (isFixedWidth(type) && type->kind() != TypeKind::UNKNOWN) {
+      fields[i] = VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+          deserializeFixedWidth, type->kind(), type, data, i, nullBytes, pool);
+    } else {
+      fields[i] = UnsafeRowDeserializer::deserialize(
+          variableWidthValues(data, i, nullBytes), type, pool);
+    }
+  }
+
+  return std::make_shared<RowVector>(
+      pool, rowType, nullptr, data.size(), std::move(fields));
+}
 } // namespace facebook::velox::row
@@ -43,6 +43,28 @@ class UnsafeRowFast {
   /// 'buffer' must have sufficient capacity and set to all zeros.
   int32_t serialize(vector_size_t index, char* buffer) const;
 
+  /// Serializes rows in the range [offset, offset + size) into 'buffer' at
+  /// given 'bufferOffsets'. Each column is written for all rows before moving
+  /// to the next one. 'buffer' must have sufficient capacity and set to all
+  /// zeros. 'bufferOffsets' must be pre-filled with the write offsets for each
+  /// row and must be accessible for 'size' elements. The caller must ensure
+  /// that the space between each offset in 'bufferOffsets' is no less than the
+  /// 'fixedRowSize' or 'rowSize'.
+  void serialize(
+      vector_size_t offset,
+      vector_size_t size,
+      const size_t* bufferOffsets,
+      char* buffer) const;
+
+  /// Deserializes multiple rows into a RowVector of specified type. The type
+  /// must match the contents of the serialized rows. Fixed-width columns are
+  /// read column by column for all rows. Other columns are deserialized using
+  /// UnsafeRowDeserializer.
+  static RowVectorPtr deserialize(
+      const std::vector<std::optional<std::string_view>>& data,
+      const RowTypePtr& rowType,
+      memory::MemoryPool* pool);
+
  protected:
   explicit UnsafeRowFast(const VectorPtr& vector);
 
@@ -110,6 +132,14 @@ class UnsafeRowFast {
   /// Serializes struct value to buffer. Value must not be null.
   int32_t serializeRow(vector_size_t index, char* buffer) const;
 
+  /// Serializes struct values in range [offset, offset + size) to buffer.
+  /// Value must not be null.
+  void serializeRow(
+      vector_size_t offset,
+      vector_size_t size,
+      const size_t* bufferOffsets,
+      char* buffer) const;
+
   const TypeKind typeKind_;
   DecodedVector decoded_;
 
@@ -53,6 +53,40 @@ class SerializeBenchmark {
     VELOX_CHECK_EQ(copy->size(), data->size());
   }
 
+  void serializeUnsafeBatch(const RowTypePtr& rowType) {
+    folly::BenchmarkSuspender suspender;
+    auto data = makeData(rowType);
+    suspender.dismiss();
+
+    const auto numRows = data->size();
+    std::vector<size_t> rowSize(numRows);
+    std::vector<size_t> offsets(numRows);
+
+    UnsafeRowFast fast(data);
+    auto totalSize = computeTotalSize(fast, rowType, numRows, rowSize, offsets);
+    auto buffer = AlignedBuffer::allocate<char>(totalSize, pool(), 0);
+    auto serialized = serialize(fast, numRows, buffer, rowSize, offsets);
+    VELOX_CHECK_EQ(serialized.size(), numRows);
+  }
+
+  void deserializeUnsafeBatch(const RowTypePtr& rowType) {
+    folly::BenchmarkSuspender suspender;
+    auto data = makeData(rowType);
+
+    const auto numRows = data->size();
+    std::vector<size_t> rowSize(numRows);
+    std::vector<size_t> offsets(numRows);
+
+    UnsafeRowFast fast(data);
+    auto totalSize = computeTotalSize(fast, rowType, numRows, rowSize, offsets);
+    auto buffer = AlignedBuffer::allocate<char>(totalSize, pool(), 0);
+    auto serialized = serialize(fast, numRows, buffer, rowSize, offsets);
+    suspender.dismiss();
+
+    auto copy = UnsafeRowFast::deserialize(serialized, rowType, pool());
+    VELOX_CHECK_EQ(copy->size(), data->size());
+  }
+
   void serializeCompact(const RowTypePtr& rowType) {
     folly::BenchmarkSuspender suspender;
     auto data = makeData(rowType);
@@ -163,6 +197,40 @@ class SerializeBenchmark {
     return serialized;
   }
 
+  size_t computeTotalSize(
+      UnsafeRowFast& unsafeRow,
+      const RowTypePtr& rowType,
+      vector_size_t numRows,
+      std::vector<size_t>& rowSize,
+      std::vector<size_t>& offsets) {
+    size_t totalSize = 0;
+    const auto fixedRowSize = UnsafeRowFast::fixedRowSize(rowType);
+    for (auto i = 0; i < numRows; ++i) {
+      rowSize[i] = fixedRowSize.has_value() ? fixedRowSize.value()
+                                            : unsafeRow.rowSize(i);
+      offsets[i] = totalSize;
+      totalSize += rowSize[i];
+    }
+    return totalSize;
+  }
+
+  std::vector<std::optional<std::string_view>> serialize(
+      UnsafeRowFast& unsafeRow,
+      vector_size_t numRows,
+      BufferPtr& buffer,
+      const std::vector<size_t>& rowSize,
+      const std::vector<size_t>& offsets) {
+    auto rawBuffer = buffer->asMutable<char>();
+    unsafeRow.serialize(0, numRows, offsets.data(), rawBuffer);
+
+    std::vector<std::optional<std::string_view>> serialized;
+    for (auto i = 0; i < numRows; ++i) {
+      serialized.push_back(
+          std::string_view(rawBuffer + offsets[i], rowSize[i]));
+    }
+    return serialized;
+  }
+
   size_t computeTotalSize(
       CompactRow& compactRow,
       const RowTypePtr& rowType,
@@ -224,35 +292,45 @@ class SerializeBenchmark {
       memory::memoryManager()->addLeafPool()};
 };
 
-#define SERDE_BENCHMARKS(name, rowType)      \
-  BENCHMARK(unsafe_serialize_##name) {       \
-    SerializeBenchmark benchmark;            \
-    benchmark.serializeUnsafe(rowType);      \
-  }                                          \
-                                             \
-  BENCHMARK(compact_serialize_##name) {      \
-    SerializeBenchmark benchmark;            \
-    benchmark.serializeCompact(rowType);     \
-  }                                          \
-                                             \
-  BENCHMARK(container_serialize_##name) {    \
-    SerializeBenchmark benchmark;            \
-    benchmark.serializeContainer(rowType);   \
-  }                                          \
-                                             \
-  BENCHMARK(unsafe_deserialize_##name) {     \
-    SerializeBenchmark benchmark;            \
-    benchmark.deserializeUnsafe(rowType);    \
-  }                                          \
-                                             \
-  BENCHMARK(compact_deserialize_##name) {    \
-    SerializeBenchmark benchmark;            \
-    benchmark.deserializeCompact(rowType);   \
-  }                                          \
-                                             \
-  BENCHMARK(container_deserialize_##name) {  \
-    SerializeBenchmark benchmark;            \
-    benchmark.deserializeContainer(rowType); \
+#define SERDE_BENCHMARKS(name, rowType)        \
+  BENCHMARK(unsafe_serialize_##name) {         \
+    SerializeBenchmark benchmark;              \
+    benchmark.serializeUnsafe(rowType);        \
+  }                                            \
+                                               \
+  BENCHMARK(unsafe_batch_serialize_##name) {   \
+    SerializeBenchmark benchmark;              \
+    benchmark.serializeUnsafeBatch(rowType);   \
+  }                                            \
+                                               \
+  BENCHMARK(compact_serialize_##name) {        \
+    SerializeBenchmark benchmark;              \
+    benchmark.serializeCompact(rowType);       \
+  }                                            \
+                                               \
+  BENCHMARK(container_serialize_##name) {      \
+    SerializeBenchmark benchmark;              \
+    benchmark.serializeContainer(rowType);     \
+  }                                            \
+                                               \
+  BENCHMARK(unsafe_deserialize_##name) {       \
+    SerializeBenchmark benchmark;              \
+    benchmark.deserializeUnsafe(rowType);      \
+  }                                            \
+                                               \
+  BENCHMARK(unsafe_batch_deserialize_##name) { \
+    SerializeBenchmark benchmark;              \
+    benchmark.deserializeUnsafeBatch(rowType); \
+  }                                            \
+                                               \
+  BENCHMARK(compact_deserialize_##name) {      \
+    SerializeBenchmark benchmark;              \
+    benchmark.deserializeCompact(rowType);     \
+  }                                            \
+                                               \
+  BENCHMARK(container_deserialize_##name) {    \
+    SerializeBenchmark benchmark;              \
+    benchmark.deserializeContainer(rowType);   \
   }
 
 SERDE_BENCHMARKS(
@@ -305,6 +383,25 @@ SERDE_BENCHMARKS(
         VARCHAR(),
     }));
 
+SERDE_BENCHMARKS(
+    mixedWidth5,
+    ROW({BOOLEAN(), SMALLINT(), INTEGER(), BIGINT(), VARCHAR()}));
+
+SERDE_BENCHMARKS(
+    mixedWidth10,
+    ROW({
+        BOOLEAN(),
+        TINYINT(),
+        SMALLINT(),
+        INTEGER(),
+        BIGINT(),
+        REAL(),
+        DOUBLE(),
+        TIMESTAMP(),
+        VARCHAR(),
+        VARCHAR(),
+    }));
+
 SERDE_BENCHMARKS(arrays, ROW({BIGINT(), ARRAY(BIGINT())}));
 
 SERDE_BENCHMARKS(nestedArrays, ROW({BIGINT(), ARRAY(ARRAY(BIGINT()))}));
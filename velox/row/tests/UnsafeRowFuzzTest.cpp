@@ -195,5 +195,60 @@ TEST_F(UnsafeRowFuzzTests, fast) {
   });
 }
 
+TEST_F(UnsafeRowFuzzTests, batch) {
+  auto rowType = ROW({
+      BOOLEAN(),
+      TINYINT(),
+      SMALLINT(),
+      INTEGER(),
+      BIGINT(),
+      REAL(),
+      DOUBLE(),
+      VARCHAR(),
+      VARBINARY(),
+      UNKNOWN(),
+      DECIMAL(20, 2),
+      DECIMAL(12, 4),
+      TIMESTAMP(),
+      DATE(),
+      ARRAY(INTEGER()),
+      MAP(BIGINT(), VARCHAR()),
+      ROW({BOOLEAN(), ROW({INTEGER(), TIMESTAMP()}), VARCHAR()}),
+  });
+
+  doTest(rowType, [&](const RowVectorPtr& data) {
+    const auto numRows = data->size();
+    UnsafeRowFast fast(data);
+
+    // The buffers are contiguous, so the rows are written at fixed offsets
+    // from the first one.
+    std::vector<size_t> offsets(numRows);
+    for (auto i = 0; i < numRows; ++i) {
+      VELOX_CHECK_LE(fast.rowSize(i), kBufferSize);
+      offsets[i] = i * kBufferSize;
+    }
+    fast.serialize(0, numRows, offsets.data(), buffers_[0]);
+
+    std::vector<std::optional<std::string_view>> serialized;
+    serialized.reserve(numRows);
+    std::string expected(kBufferSize, '\0');
+    for (auto i = 0; i < numRows; ++i) {
+      const auto rowSize = fast.rowSize(i);
+      std::fill(expected.begin(), expected.end(), '\0');
+      EXPECT_EQ(rowSize, fast.serialize(i, expected.data()));
+      EXPECT_EQ(
+          std::string_view(expected.data(), rowSize),
+          std::string_view(buffers_[i], rowSize))
+          << i << ", " << data->toString(i);
+
+      serialized.push_back(std::string_view(buffers_[i], rowSize));
+    }
+
+    assertEqualVectors(
+        data, UnsafeRowFast::deserialize(serialized, rowType, pool_.get()));
+    return serialized;
+  });
+}
+
 } // namespace
 } // namespace facebook::velox::row
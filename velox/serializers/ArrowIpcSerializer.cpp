@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/serializers/ArrowIpcSerializer.h"
+
+#include "arrow/buffer.h"
+#include "arrow/c/bridge.h"
+#include "arrow/io/api.h"
+#include "arrow/ipc/api.h"
+#include "arrow/util/compression.h"
+#include "velox/common/base/Exceptions.h"
+#include "velox/vector/arrow/Bridge.h"
+
+namespace facebook::velox::serializer {
+namespace {
+using TPageSize = int32_t;
+
+arrow::ipc::IpcWriteOptions toIpcWriteOptions(
+    const VectorSerde::Options* options) {
+  auto writeOptions = arrow::ipc::IpcWriteOptions::Defaults();
+  const auto compressionKind = options == nullptr
+      ? common::CompressionKind::CompressionKind_NONE
+      : options->compressionKind;
+  arrow::Compression::type arrowCompression;
+  switch (compressionKind) {
+    case common::CompressionKind::CompressionKind_NONE:
+      return writeOptions;
+    case common::CompressionKind::CompressionKind_LZ4:
+      arrowCompression = arrow::Compression::LZ4_FRAME;
+      break;
+    case common::CompressionKind::CompressionKind_ZSTD:
+      arrowCompression = arrow::Compression::ZSTD;
+      break;
+    default:
+      VELOX_USER_FAIL(
+          "Arrow IPC body compression supports only LZ4 and ZSTD, not {}",
+          common::compressionKindToString(compressionKind));
+  }
+  auto codec = arrow::util::Codec::Create(arrowCompression);
+  VELOX_CHECK(
+      codec.ok(),
+      "Failed to create Arrow codec: {}",
+      codec.status().ToString());
+  writeOptions.codec = std::move(codec).ValueUnsafe();
+  return writeOptions;
+}
+
+// Buffers the appended rows in a flat RowVector and encodes them as one Arrow
+// record batch on flush.
+class ArrowIpcVectorSerializer : public IterativeVectorSerializer {
+ public:
+  ArrowIpcVectorSerializer(
+      RowTypePtr type,
+      memory::MemoryPool* pool,
+      const VectorSerde::Options* options)
+      : type_(std::move(type)),
+        pool_(pool),
+        writeOptions_(toIpcWriteOptions(options)) {}
+
+  void append(
+      const RowVectorPtr& vector,
+      const folly::Range<const IndexRange*>& ranges,
+      Scratch& /*scratch*/) override {
+    copyRanges_.clear();
+    vector_size_t numRows = 0;
+    for (const auto& range : ranges) {
+      copyRanges_.push_back({range.begin, numBuffered() + numRows, range.size});
+      numRows += range.size;
+    }
+    appendRanges(vector, numRows);
+  }
+
+  void append(
+      const RowVectorPtr& vector,
+      const folly::Range<const vector_size_t*>& rows,
+      Scratch& /*scratch*/) override {
+    copyRanges_.clear();
+    const auto offset = numBuffered();
+    for (vector_size_t i = 0; i < rows.size(); ++i) {
+      copyRanges_.push_back({rows[i], offset + i, 1});
+    }
+    appendRanges(vector, rows.size());
+  }
+
+  bool supportsAppendRows() const override {
+    return true;
+  }
+
+  size_t maxSerializedSize() const override {
+    return sizeof(TPageSize) + encode()->size();
+  }
+
+  void flush(OutputStream* stream) override {
+    const auto& encoded = encode();
+    const TPageSize size = encoded->size();
+    stream->write(reinterpret_cast<const char*>(&size), sizeof(size));
+    stream->write(reinterpret_cast<const char*>(encoded->data()), size);
+  }
+
+  void clear() override {
+    buffered_.reset();
+    encoded_.reset();
+  }
+
+ private:
+  vector_size_t numBuffered() const {
+    return buffered_ == nullptr ? 0 : buffered_->size();
+  }
+
+  void appendRanges(const RowVectorPtr& vector, vector_size_t numRows) {
+    if (buffered_ == nullptr) {
+      buffered_ = BaseVector::create<RowVector>(type_, 0, pool_);
+    }
+    buffered_->resize(buffered_->size() + numRows);
+    buffered_->copyRanges(vector.get(), copyRanges_);
+    encoded_.reset();
+  }
+
+  // Encodes the buffered rows as an IPC stream. The result is cached so that
+  // maxSerializedSize() followed by flush() encodes once.
+  const std::shared_ptr<arrow::Buffer>& encode() const {
+    if (encoded_ != nullptr) {
+      return encoded_;
+    }
+    const auto rows = buffered_ != nullptr
+        ? buffered_
+        : BaseVector::create<RowVector>(type_, 0, pool_);
+    ArrowArray arrowArray;
+    ArrowSchema arrowSchema;
+    exportToArrow(rows, arrowArray, pool_);
+    exportToArrow(rows, arrowSchema);
+    auto batch = arrow::ImportRecordBatch(&arrowArray, &arrowSchema);
+    VELOX_CHECK(
+        batch.ok(),
+        "Failed to import record batch: {}",
+        batch.status().ToString());
+
+    auto sink = arrow::io::BufferOutputStream::Create();
+    VELOX_CHECK(sink.ok(), "{}", sink.status().ToString());
+    auto writer = arrow::ipc::MakeStreamWriter(
+        *sink, (*batch)->schema(), writeOptions_);
+    VELOX_CHECK(
+        writer.ok(),
+        "Failed to create IPC writer: {}",
+        writer.status().ToString());
+    auto status = (*writer)->WriteRecordBatch(**batch);
+    if (status.ok()) {
+      status = (*writer)->Close();
+    }
+    VELOX_CHECK(
+        status.ok(), "Failed to write IPC stream: {}", status.ToString());
+    auto encoded = (*sink)->Finish();
+    VELOX_CHECK(encoded.ok(), "{}", encoded.status().ToString());
+    encoded_ = std::move(encoded).ValueUnsafe();
+    return encoded_;
+  }
+
+  const RowTypePtr type_;
+  memory::MemoryPool* const pool_;
+  const arrow::ipc::IpcWriteOptions writeOptions_;
+
+  RowVectorPtr buffered_;
+  std::vector<BaseVector::CopyRange> copyRanges_;
+  mutable std::shared_ptr<arrow::Buffer> encoded_;
+};
+
+vector_size_t flatRowSize(const BaseVector* vector) {
+  if (vector->size() == 0) {
+    return 0;
+  }
+  return vector->estimateFlatSize() / vector->size();
+}
+} // namespace
+
+void ArrowIpcVectorSerde::estimateSerializedSize(
+    const BaseVector* vector,
+    const folly::Range<const vector_size_t*>& rows,
+    vector_size_t** sizes,
+    Scratch& /*scratch*/) {
+  const auto rowSize = flatRowSize(vector);
+  for (auto i = 0; i < rows.size(); ++i) {
+    *sizes[i] += rowSize;
+  }
+}
+
+void ArrowIpcVectorSerde::estimateSerializedSize(
+    const BaseVector* vector,
+    const folly::Range<const IndexRange*>& ranges,
+    vector_size_t** sizes,
+    Scratch& /*scratch*/) {
+  const auto rowSize = flatRowSize(vector);
+  for (auto i = 0; i < ranges.size(); ++i) {
+    *sizes[i] += rowSize * ranges[i].size;
+  }
+}
+
+std::unique_ptr<IterativeVectorSerializer>
+ArrowIpcVectorSerde::createIterativeSerializer(
+    RowTypePtr type,
+    int32_t /* numRows */,
+    StreamArena* streamArena,
+    const Options* options) {
+  return std::make_unique<ArrowIpcVectorSerializer>(
+      std::move(type), streamArena->pool(), options);
+}
+
+void ArrowIpcVectorSerde::deserialize(
+    ByteInputStream* source,
+    velox::memory::MemoryPool* pool,
+    RowTypePtr type,
+    RowVectorPtr* result,
+    vector_size_t resultOffset,
+    const Options* /*options*/) {
+  const auto size = source->read<TPageSize>();
+  auto buffer = arrow::AllocateBuffer(size);
+  VELOX_CHECK(buffer.ok(), "{}", buffer.status().ToString());
+  source->readBytes((*buffer)->mutable_data(), size);
+
+  auto reader = arrow::ipc::RecordBatchStreamReader::Open(
+      std::make_shared<arrow::io::BufferReader>(
+          std::shared_ptr<arrow::Buffer>(std::move(buffer).ValueUnsafe())));
+  VELOX_CHECK(
+      reader.ok(),
+      "Failed to open IPC stream: {}",
+      reader.status().ToString());
+  std::shared_ptr<arrow::RecordBatch> batch;
+  auto status = (*reader)->ReadNext(&batch);
+  VELOX_CHECK(
+      status.ok() && batch != nullptr,
+      "Failed to read record batch: {}",
+      status.ToString());
+
+  ArrowArray arrowArray;
+  ArrowSchema arrowSchema;
+  status = arrow::ExportRecordBatch(*batch, &arrowArray, &arrowSchema);
+  VELOX_CHECK(
+      status.ok(), "Failed to export record batch: {}", status.ToString());
+  const auto imported =
+      importFromArrowAsOwner(arrowSchema, arrowArray, pool);
+  const vector_size_t numRows = imported->size();
+
+  if (resultOffset > 0) {
+    VELOX_CHECK_NOT_NULL(*result);
+    VELOX_CHECK_EQ(result->use_count(), 1);
+    (*result)->resize(resultOffset + numRows);
+  } else if (*result && result->use_count() == 1) {
+    VELOX_CHECK(
+        *(*result)->type() == *type,
+        "Unexpected type: {} vs. {}",
+        (*result)->type()->toString(),
+        type->toString());
+    (*result)->prepareForReuse();
+    (*result)->resize(numRows);
+  } else {
+    *result = BaseVector::create<RowVector>(type, numRows, pool);
+  }
+
+  // The imported batch owns the Arrow buffers; copy its columns into
+  // 'result' which carries the Velox names and types.
+  const auto* importedRow = imported->asUnchecked<RowVector>();
+  VELOX_CHECK_EQ(importedRow->childrenSize(), type->size());
+  for (auto i = 0; i < type->size(); ++i) {
+    (*result)->childAt(i)->copy(
+        importedRow->childAt(i).get(), resultOffset, 0, numRows);
+  }
+}
+
+// static
+void ArrowIpcVectorSerde::registerVectorSerde() {
+  velox::registerVectorSerde(std::make_unique<ArrowIpcVectorSerde>());
+}
+
+// static
+void ArrowIpcVectorSerde::registerNamedVectorSerde() {
+  velox::registerNamedVectorSerde(
+      VectorSerde::Kind::kArrowIpc, std::make_unique<ArrowIpcVectorSerde>());
+}
+
+} // namespace facebook::velox::serializer
@@ -17,7 +17,57 @@
 #include "velox/serializers/PrestoIterativeVectorSerializer.h"
 #include "velox/serializers/PrestoSerializerSerializationUtils.h"
 
+#include <folly/io/Cursor.h>
+
+#include <cstdlib>
+#include <thread>
+
 namespace facebook::velox::serializer::presto::detail {
+namespace {
+// The number of pages flushed with the codec chosen from a sample of the first
+// of them, see PrestoOptions::adaptiveCompression.
+constexpr int32_t kAdaptiveSampleInterval = 32;
+constexpr int64_t kMaxAdaptiveSampleBytes = 64 << 10;
+
+// Returns the 1 minute load average per core, 0 if unknown.
+double cpuLoad() {
+  const auto numCores = std::thread::hardware_concurrency();
+  double load;
+  if (numCores == 0 || getloadavg(&load, 1) != 1) {
+    return 0;
+  }
+  return load / numCores;
+}
+
+// Returns true if 'rows' of 'vector' are worth a dictionary-encoded page
+// column: 'vector' is a dictionary without nulls added by the wrapper over
+// values wider than the int32_t indices and 'rows' use each value twice on
+// average.
+bool isDictionaryWorthIt(
+    const BaseVector& vector,
+    const folly::Range<const vector_size_t*>& rows) {
+  if (vector.encoding() != VectorEncoding::Simple::DICTIONARY ||
+      vector.nulls() != nullptr) {
+    return false;
+  }
+  const auto& type = vector.type();
+  if (!type->isPrimitiveType() ||
+      (type->isFixedWidth() && type->cppSizeInBytes() <= sizeof(int32_t))) {
+    return false;
+  }
+  const auto* indices = vector.wrapInfo()->as<vector_size_t>();
+  std::vector<bool> used(vector.valueVector()->size());
+  vector_size_t numUsed = 0;
+  for (const auto row : rows) {
+    if (!used[indices[row]]) {
+      used[indices[row]] = true;
+      ++numUsed;
+    }
+  }
+  return numUsed * 2 <= rows.size();
+}
+} // namespace
+
 PrestoIterativeVectorSerializer::PrestoIterativeVectorSerializer(
     const RowTypePtr& rowType,
     int32_t numRows,
@@ -35,6 +85,20 @@ PrestoIterativeVectorSerializer::PrestoIterativeVectorSerializer(
     streams_.emplace_back(
         types[i], std::nullopt, std::nullopt, streamArena, numRows, opts);
   }
+  if (opts_.appendDictionaries) {
+    dictionaries_.resize(numTypes);
+  }
+  if (opts_.adaptiveCompression) {
+    adaptiveCodecs_.push_back(common::compressionKindToCodec(
+        common::CompressionKind::CompressionKind_NONE));
+    adaptiveCodecs_.push_back(common::compressionKindToCodec(
+        common::CompressionKind::CompressionKind_LZ4));
+    adaptiveCodecs_.push_back(folly::compression::getCodec(
+        folly::compression::CodecType::ZSTD,
+        folly::compression::COMPRESSION_LEVEL_FASTEST));
+    adaptiveCodecs_.push_back(common::compressionKindToCodec(
+        common::CompressionKind::CompressionKind_ZSTD));
+  }
 }
 
 void PrestoIterativeVectorSerializer::append(
@@ -45,6 +109,17 @@ void PrestoIterativeVectorSerializer::append(
   if (numNewRows == 0) {
     return;
   }
+  if (opts_.appendDictionaries) {
+    std::vector<vector_size_t> rows;
+    rows.reserve(numNewRows);
+    for (const auto& range : ranges) {
+      for (auto row = range.begin; row < range.begin + range.size; ++row) {
+        rows.push_back(row);
+      }
+    }
+    append(vector, folly::Range(rows.data(), rows.size()), scratch);
+    return;
+  }
   numRows_ += numNewRows;
   for (int32_t i = 0; i < vector->childrenSize(); ++i) {
     serializeColumn(vector->childAt(i), ranges, &streams_[i], scratch);
@@ -61,16 +136,88 @@ void PrestoIterativeVectorSerializer::append(
   }
   numRows_ += numNewRows;
   for (int32_t i = 0; i < vector->childrenSize(); ++i) {
+    if (opts_.appendDictionaries &&
+        appendDictionary(i, vector->childAt(i), rows, scratch)) {
+      continue;
+    }
     serializeColumn(vector->childAt(i), rows, &streams_[i], scratch);
   }
 }
 
+bool PrestoIterativeVectorSerializer::appendDictionary(
+    int32_t column,
+    const VectorPtr& vector,
+    const folly::Range<const vector_size_t*>& rows,
+    Scratch& scratch) {
+  auto& stream = streams_[column];
+  auto& dictionary = dictionaries_[column];
+  if (!stream.isDictionaryStream()) {
+    if (!stream.empty() || !isDictionaryWorthIt(*vector, rows)) {
+      return false;
+    }
+    stream.startDictionary(rows.size());
+  }
+
+  auto* valuesStream = stream.childAt(0);
+  stream.appendNonNull(rows.size());
+  if (vector->encoding() != VectorEncoding::Simple::DICTIONARY ||
+      vector->nulls() != nullptr) {
+    // Values without a reusable dictionary are added to the page dictionary
+    // as is.
+    serializeColumn(vector, rows, valuesStream, scratch);
+    for (vector_size_t i = 0; i < rows.size(); ++i) {
+      stream.appendOne<int32_t>(dictionary.size + i);
+    }
+    dictionary.size += rows.size();
+    return true;
+  }
+
+  const auto& base = vector->valueVector();
+  if (dictionary.base != base) {
+    dictionary.base = base;
+    dictionary.indices.assign(base->size(), -1);
+  }
+  const auto* indices = vector->wrapInfo()->as<vector_size_t>();
+  ScratchPtr<vector_size_t, 64> newValuesHolder(scratch);
+  auto* newValues = newValuesHolder.get(rows.size());
+  vector_size_t numNewValues = 0;
+  for (const auto row : rows) {
+    auto& pageIndex = dictionary.indices[indices[row]];
+    if (pageIndex < 0) {
+      pageIndex = dictionary.size + numNewValues;
+      newValues[numNewValues++] = indices[row];
+    }
+  }
+  if (numNewValues > 0) {
+    serializeColumn(
+        base,
+        folly::Range<const vector_size_t*>(newValues, numNewValues),
+        valuesStream,
+        scratch);
+    dictionary.size += numNewValues;
+  }
+  for (const auto row : rows) {
+    stream.appendOne<int32_t>(dictionary.indices[indices[row]]);
+  }
+  return true;
+}
+
 size_t PrestoIterativeVectorSerializer::maxSerializedSize() const {
   size_t dataSize = 4; // streams_.size()
   for (auto& stream : streams_) {
     dataSize += const_cast<VectorStream&>(stream).serializedSize();
   }
 
+  if (opts_.adaptiveCompression) {
+    uint64_t compressedSize = dataSize;
+    for (const auto& codec : adaptiveCodecs_) {
+      if (needCompression(*codec)) {
+        compressedSize =
+            std::max(compressedSize, codec->maxCompressedLength(dataSize));
+      }
+    }
+    return kHeaderSize + compressedSize;
+  }
   auto compressedSize = needCompression(*codec_)
       ? codec_->maxCompressedLength(dataSize)
       : dataSize;
@@ -81,6 +228,68 @@ size_t PrestoIterativeVectorSerializer::maxSerializedSize() const {
 // numRows(4) | codec(1) | uncompressedSize(4) | compressedSize(4) |
 // checksum(8) | data
 void PrestoIterativeVectorSerializer::flush(OutputStream* out) {
+  if (opts_.adaptiveCompression) {
+    flushAdaptive(out);
+  } else {
+    flushConfigured(out);
+  }
+}
+
+void PrestoIterativeVectorSerializer::flushAdaptive(OutputStream* out) {
+  if (numPagesToNextSample_ == 0) {
+    chooseAdaptiveCodec();
+    numPagesToNextSample_ = kAdaptiveSampleInterval;
+  }
+  --numPagesToNextSample_;
+  ++numAdaptivePages_[static_cast<int32_t>(adaptiveCodec_)];
+  auto& codec = adaptiveCodec(adaptiveCodec_);
+  if (!needCompression(codec)) {
+    flushStreams(streams_, numRows_, *streamArena_, codec, 1, out);
+    return;
+  }
+  auto [size, compressedSize] = flushStreams(
+      streams_,
+      numRows_,
+      *streamArena_,
+      codec,
+      opts_.minCompressionRatio,
+      out,
+      adaptiveCodec_ == AdaptiveCodec::kLz4 ? kLz4CodecId : kZstdCodecId);
+  stats_.compressionInputBytes += size;
+  stats_.compressedBytes += compressedSize;
+}
+
+void PrestoIterativeVectorSerializer::chooseAdaptiveCodec() {
+  IOBufOutputStream page(*streamArena_->pool(), nullptr, streamArena_->size());
+  writeInt32(&page, streams_.size());
+  for (auto& stream : streams_) {
+    stream.flush(&page);
+  }
+  const auto pageBuffer = page.getIOBuf();
+  const auto sampleSize = std::min<int64_t>(
+      pageBuffer->computeChainDataLength(), kMaxAdaptiveSampleBytes);
+  auto sample = folly::IOBuf::create(sampleSize);
+  folly::io::Cursor(pageBuffer.get()).pull(sample->writableData(), sampleSize);
+  sample->append(sampleSize);
+
+  // The codecs are tried from the cheapest to the strongest. A stronger codec
+  // must make the sample 5% smaller than the previous choice, up to 25% when
+  // the CPUs are fully loaded.
+  const double minSavings = 0.05 + 0.2 * std::min(cpuLoad(), 1.0);
+  adaptiveCodec_ = AdaptiveCodec::kNone;
+  double maxSize = sampleSize * opts_.minCompressionRatio;
+  for (const auto kind :
+       {AdaptiveCodec::kLz4, AdaptiveCodec::kZstdFast, AdaptiveCodec::kZstd}) {
+    const auto compressedSize =
+        adaptiveCodec(kind).compress(sample.get())->computeChainDataLength();
+    if (compressedSize <= maxSize) {
+      adaptiveCodec_ = kind;
+      maxSize = compressedSize * (1 - minSavings);
+    }
+  }
+}
+
+void PrestoIterativeVectorSerializer::flushConfigured(OutputStream* out) {
   constexpr int32_t kMaxCompressionAttemptsToSkip = 30;
   if (!needCompression(*codec_)) {
     flushStreams(
@@ -129,6 +338,14 @@ PrestoIterativeVectorSerializer::runtimeStats() {
        {"compressionSkippedBytes",
         RuntimeCounter(
             stats_.compressionSkippedBytes, RuntimeCounter::Unit::kBytes)}});
+  if (opts_.adaptiveCompression) {
+    map.insert(
+        {{"adaptiveCompressionNonePages",
+          RuntimeCounter(numAdaptivePages_[0])},
+         {"adaptiveCompressionLz4Pages", RuntimeCounter(numAdaptivePages_[1])},
+         {"adaptiveCompressionZstdPages",
+          RuntimeCounter(numAdaptivePages_[2] + numAdaptivePages_[3])}});
+  }
   return map;
 }
 
@@ -137,5 +354,8 @@ void PrestoIterativeVectorSerializer::clear() {
   for (auto& stream : streams_) {
     stream.clear();
   }
+  for (auto& dictionary : dictionaries_) {
+    dictionary = PageDictionary{};
+  }
 }
 } // namespace facebook::velox::serializer::presto::detail
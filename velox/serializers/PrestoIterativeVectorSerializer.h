@@ -15,6 +15,8 @@
  */
 #pragma once
 
+#include <array>
+
 #include "velox/serializers/PrestoSerializer.h"
 #include "velox/serializers/VectorStream.h"
 #include "velox/vector/VectorStream.h"
@@ -51,15 +53,63 @@ class PrestoIterativeVectorSerializer : public IterativeVectorSerializer {
   void clear() override;
 
  private:
+  // The dictionary values of a column of the page added by appendDictionary().
+  struct PageDictionary {
+    // The values of the last appended dictionary vector and the index in
+    // the page dictionary of each of them, -1 if not added yet.
+    VectorPtr base;
+    std::vector<vector_size_t> indices;
+    // The number of values in the page dictionary.
+    vector_size_t size{0};
+  };
+
+  // Appends 'rows' of 'vector' to the dictionary-encoded stream of
+  // 'column', switching an empty stream to dictionary encoding if 'vector'
+  // is worth it. Returns false if the stream of 'column' stays flat.
+  bool appendDictionary(
+      int32_t column,
+      const VectorPtr& vector,
+      const folly::Range<const vector_size_t*>& rows,
+      Scratch& scratch);
+
+  // The codecs PrestoOptions::adaptiveCompression chooses from.
+  enum class AdaptiveCodec : int8_t { kNone, kLz4, kZstdFast, kZstd };
+  static constexpr int32_t kNumAdaptiveCodecs = 4;
+
+  // Flushes a page with 'codec_' if 'opts_.adaptiveCompression' is false.
+  void flushConfigured(OutputStream* out);
+
+  // Flushes a page with 'adaptiveCodec_', first choosing it from a sample of
+  // the page every kAdaptiveSampleInterval pages.
+  void flushAdaptive(OutputStream* out);
+
+  // Sets 'adaptiveCodec_' to the codec that compresses a sample of the page in
+  // 'streams_' best for the current CPU load.
+  void chooseAdaptiveCodec();
+
+  folly::compression::Codec& adaptiveCodec(AdaptiveCodec kind) const {
+    return *adaptiveCodecs_[static_cast<int32_t>(kind)];
+  }
+
   const PrestoVectorSerde::PrestoOptions opts_;
   StreamArena* const streamArena_;
   const std::unique_ptr<folly::compression::Codec> codec_;
 
   int32_t numRows_{0};
   std::vector<VectorStream, memory::StlAllocator<VectorStream>> streams_;
+  // One per column if 'opts_.appendDictionaries' is true.
+  std::vector<PageDictionary> dictionaries_;
 
   // Count of forthcoming compressions to skip.
   int32_t numCompressionToSkip_{0};
   CompressionStats stats_;
+
+  // One codec per AdaptiveCodec if 'opts_.adaptiveCompression' is true.
+  std::vector<std::unique_ptr<folly::compression::Codec>> adaptiveCodecs_;
+  AdaptiveCodec adaptiveCodec_{AdaptiveCodec::kNone};
+  // Count of pages to flush before sampling the next page.
+  int32_t numPagesToNextSample_{0};
+  // The number of pages flushed with each AdaptiveCodec.
+  std::array<int64_t, kNumAdaptiveCodecs> numAdaptivePages_{};
 };
 } // namespace facebook::velox::serializer::presto::detail
@@ -186,9 +186,17 @@ void PrestoVectorSerde::deserialize(
     source->readBytes(compressBuf->writableData(), header.compressedSize);
     compressBuf->append(header.compressedSize);
 
+    // A page of an adaptive compression serializer names its codec.
+    const auto codecId = detail::codecIdBits(header.pageCodecMarker);
+    const auto pageCodec = codecId == 0
+        ? nullptr
+        : common::compressionKindToCodec(
+              detail::codecIdToCompressionKind(codecId));
+
     // Process chained uncompressed results IOBufs.
-    auto uncompress =
-        codec->uncompress(compressBuf.get(), header.uncompressedSize);
+    auto uncompress = (pageCodec != nullptr ? pageCodec : codec)
+                          ->uncompress(
+                              compressBuf.get(), header.uncompressedSize);
     auto uncompressedSource = std::make_unique<BufferInputStream>(
         byteRangesFromIOBuf(uncompress.get()));
     detail::readTopColumns(
@@ -80,6 +80,29 @@ class PrestoVectorSerde : public VectorSerde {
     /// affect the encoding of the input vectors. This is only relevant when
     /// using BatchVectorSerializer.
     bool preserveEncodings{false};
+
+    /// If true and the input stream has a memory owner, see
+    /// ByteInputStream::memoryOwner(), the deserializer references the stream
+    /// memory instead of copying it: the values of fixed-width columns without
+    /// nulls that are aligned in the stream, and the string data of string
+    /// columns. The deserialized vectors then keep the whole stream memory
+    /// alive.
+    bool zeroCopyDeserialize{false};
+
+    /// If true, the IterativeVectorSerializer writes a primitive column as a
+    /// dictionary block if the first vector appended to the page is a
+    /// dictionary whose values are reused across the appended rows. The page
+    /// dictionary adds each value of a dictionary once, so later appends of
+    /// rows of the same dictionary only add indices.
+    bool appendDictionaries{false};
+
+    /// If true, the IterativeVectorSerializer ignores 'compressionKind' and
+    /// picks the codec of its pages itself: it compresses a sample of every
+    /// 32nd page with LZ4 and two ZSTD levels and uses the cheapest codec that
+    /// reaches 'minCompressionRatio' for the next pages, a stronger one only
+    /// if it saves enough bytes for the current CPU load. The page marker
+    /// names the codec, so the deserializer does not need the same options.
+    bool adaptiveCompression{false};
   };
 
   PrestoVectorSerde() : VectorSerde(Kind::kPresto) {}
@@ -596,6 +596,41 @@ void readLosslessTimestampValues(
   }
 }
 
+// Keeps the memory of a deserialized stream alive while a vector references
+// it.
+struct StreamMemoryReleaser {
+  void addRef() const {}
+  void release() const {}
+
+  std::shared_ptr<const void> owner;
+};
+
+// Returns a view over the next 'size' bytes of 'source' and skips them if
+// zero copy deserialization is enabled, 'source' has a memory owner and the
+// bytes are contiguous and aligned to 'alignment'. Returns nullptr and leaves
+// 'source' as is otherwise, in which case the caller copies the bytes.
+BufferPtr readBufferView(
+    ByteInputStream* source,
+    int32_t size,
+    size_t alignment,
+    const PrestoVectorSerde::PrestoOptions& opts) {
+  if (!opts.zeroCopyDeserialize || source->memoryOwner() == nullptr ||
+      size == 0) {
+    return nullptr;
+  }
+  const auto position = source->tellp();
+  const auto view = source->nextView(size);
+  if (view.size() != size ||
+      reinterpret_cast<uintptr_t>(view.data()) % alignment != 0) {
+    source->seekp(position);
+    return nullptr;
+  }
+  return BufferView<StreamMemoryReleaser>::create(
+      reinterpret_cast<const uint8_t*>(view.data()),
+      size,
+      StreamMemoryReleaser{source->memoryOwner()});
+}
+
 template <typename T>
 void readValues(
     ByteInputStream* source,
@@ -706,6 +741,20 @@ void read(
   auto nullCount = readNulls(
       source, size, resultOffset, incomingNulls, numIncomingNulls, *flatResult);
 
+  if constexpr (
+      std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+      !std::is_same_v<T, int128_t>) {
+    // The values of a column without nulls are laid out in the stream as in
+    // the values buffer, so the buffer can reference them in place.
+    if (resultOffset == 0 && numIncomingNulls == 0 && nullCount == 0) {
+      if (auto view =
+              readBufferView(source, size * sizeof(T), alignof(T), opts)) {
+        flatResult->unsafeSetValues(std::move(view));
+        return;
+      }
+    }
+  }
+
   BufferPtr values = flatResult->mutableValues(resultOffset + numNewValues);
   if constexpr (std::is_same_v<T, Timestamp>) {
     if (opts.useLosslessTimestamp) {
@@ -800,12 +849,18 @@ void read<StringView>(
     return;
   }
 
-  auto* rawStrings =
-      flatResult->getRawStringBufferWithSpace(dataSize, true /*exactSize*/);
-
-  source->readBytes(rawStrings, dataSize);
+  const char* rawChars;
+  if (auto view = readBufferView(source, dataSize, 1, opts)) {
+    // The StringViews reference the string data in the stream.
+    rawChars = view->as<char>();
+    flatResult->addStringBuffer(view);
+  } else {
+    auto* rawStrings =
+        flatResult->getRawStringBufferWithSpace(dataSize, true /*exactSize*/);
+    source->readBytes(rawStrings, dataSize);
+    rawChars = rawStrings;
+  }
   int32_t previousOffset = 0;
-  auto rawChars = reinterpret_cast<char*>(rawStrings);
   for (int32_t i = 0; i < numNewValues; ++i) {
     int32_t offset = rawValues[resultOffset + i].size();
     rawValues[resultOffset + i] =
@@ -33,6 +33,10 @@ inline bool isChecksumBitSet(int8_t codec) {
   return (codec & kCheckSumBitMask) == kCheckSumBitMask;
 }
 
+inline int8_t codecIdBits(int8_t codec) {
+  return (codec & kCodecIdBitMask) >> kCodecIdShift;
+}
+
 void readTopColumns(
     ByteInputStream& source,
     const RowTypePtr& type,
@@ -30,6 +30,14 @@ namespace facebook::velox::serializer::presto::detail {
 constexpr int8_t kCompressedBitMask = 1;
 constexpr int8_t kEncryptedBitMask = 2;
 constexpr int8_t kCheckSumBitMask = 4;
+// The codec id bits of the page codec marker. A compressed page with a codec
+// id other than 0 is compressed with the codec of that id instead of the
+// codec of the serde options, see PrestoOptions::adaptiveCompression. Presto
+// leaves these bits 0.
+constexpr int8_t kCodecIdShift = 3;
+constexpr int8_t kCodecIdBitMask = 7 << kCodecIdShift;
+constexpr int8_t kLz4CodecId = 1;
+constexpr int8_t kZstdCodecId = 2;
 // uncompressed size comes after the number of rows and the codec
 constexpr int32_t kSizeInBytesOffset{4 + 1};
 // There header for a page is:
@@ -275,6 +283,19 @@ inline int64_t flushUncompressed(
   return uncompressedSize;
 }
 
+inline common::CompressionKind codecIdToCompressionKind(int8_t codecId) {
+  switch (codecId) {
+    case kLz4CodecId:
+      return common::CompressionKind::CompressionKind_LZ4;
+    case kZstdCodecId:
+      return common::CompressionKind::CompressionKind_ZSTD;
+    default:
+      VELOX_FAIL("Invalid page codec id: {}", codecId);
+  }
+}
+
+// 'codecId' is written to the codec marker of a compressed page, see
+// kCodecIdBitMask.
 template <typename Allocator>
 inline FlushSizes flushCompressed(
     std::vector<VectorStream, Allocator>& streams,
@@ -283,8 +304,9 @@ inline FlushSizes flushCompressed(
     int32_t numRows,
     float minCompressionRatio,
     OutputStream* output,
-    PrestoOutputStreamListener* listener) {
-  char codecMask = kCompressedBitMask;
+    PrestoOutputStreamListener* listener,
+    int8_t codecId = 0) {
+  char codecMask = kCompressedBitMask | (codecId << kCodecIdShift);
   if (listener) {
     codecMask |= kCheckSumBitMask;
   }
@@ -316,7 +338,7 @@ inline FlushSizes flushCompressed(
         numRows,
         uncompressedSize,
         uncompressedSize,
-        codecMask & ~kCompressedBitMask,
+        codecMask & ~(kCompressedBitMask | kCodecIdBitMask),
         iobuf,
         output,
         listener);
@@ -340,7 +362,8 @@ inline FlushSizes flushStreams(
     const StreamArena& arena,
     folly::compression::Codec& codec,
     float minCompressionRatio,
-    OutputStream* out) {
+    OutputStream* out,
+    int8_t codecId = 0) {
   auto listener = dynamic_cast<PrestoOutputStreamListener*>(out->listener());
   // Reset CRC computation
   if (listener) {
@@ -352,7 +375,14 @@ inline FlushSizes flushStreams(
     return {size, size};
   } else {
     return flushCompressed(
-        streams, arena, codec, numRows, minCompressionRatio, out, listener);
+        streams,
+        arena,
+        codec,
+        numRows,
+        minCompressionRatio,
+        out,
+        listener,
+        codecId);
   }
 }
 
@@ -15,11 +15,52 @@
  */
 #include "velox/serializers/UnsafeRowSerializer.h"
 #include <folly/lang/Bits.h>
-#include "velox/row/UnsafeRowDeserializers.h"
 #include "velox/row/UnsafeRowFast.h"
 #include "velox/serializers/RowSerializer.h"
 
 namespace facebook::velox::serializer::spark {
+namespace {
+using TRowSize = uint32_t;
+
+class UnsafeRowVectorSerializer : public RowSerializer<row::UnsafeRowFast> {
+ public:
+  explicit UnsafeRowVectorSerializer(
+      memory::MemoryPool* pool,
+      const VectorSerde::Options* options)
+      : RowSerializer<row::UnsafeRowFast>(pool, options) {}
+
+ private:
+  void serializeRanges(
+      const row::UnsafeRowFast& row,
+      const folly::Range<const IndexRange*>& ranges,
+      char* rawBuffer,
+      const std::vector<vector_size_t>& rowSize) override {
+    size_t offset = 0;
+    vector_size_t index = 0;
+    for (const auto& range : ranges) {
+      if (range.size == 1) {
+        // Fast path for single-row serialization.
+        *reinterpret_cast<TRowSize*>(rawBuffer + offset) =
+            folly::Endian::big(rowSize[index]);
+        auto size =
+            row.serialize(range.begin, rawBuffer + offset + sizeof(TRowSize));
+        offset += size + sizeof(TRowSize);
+        ++index;
+      } else {
+        raw_vector<size_t> offsets(range.size);
+        for (auto i = 0; i < range.size; ++i, ++index) {
+          // Write raw size. Needs to be in big endian order.
+          *(TRowSize*)(rawBuffer + offset) = folly::Endian::big(rowSize[index]);
+          offsets[i] = offset + sizeof(TRowSize);
+          offset += rowSize[index] + sizeof(TRowSize);
+        }
+        // Write row data for all rows in range, one column at a time.
+        row.serialize(range.begin, range.size, offsets.data(), rawBuffer);
+      }
+    }
+  }
+};
+} // namespace
 
 void UnsafeRowVectorSerde::estimateSerializedSize(
     const row::UnsafeRowFast* unsafeRow,
@@ -34,7 +75,7 @@ UnsafeRowVectorSerde::createIterativeSerializer(
     int32_t /* numRows */,
     StreamArena* streamArena,
     const Options* options) {
-  return std::make_unique<RowSerializer<row::UnsafeRowFast>>(
+  return std::make_unique<UnsafeRowVectorSerializer>(
       streamArena->pool(), options);
 }
 
@@ -54,9 +95,7 @@ void UnsafeRowVectorSerde::deserialize(
     return;
   }
 
-  *result = std::dynamic_pointer_cast<RowVector>(
-      velox::row::UnsafeRowDeserializer::deserialize(
-          serializedRows, type, pool));
+  *result = velox::row::UnsafeRowFast::deserialize(serializedRows, type, pool);
 }
 
 // static
@@ -207,6 +207,24 @@ void VectorStream::flattenStream(
   initializeFlatStream(vector, initialNumRows);
 }
 
+void VectorStream::startDictionary(int32_t initialNumRows) {
+  VELOX_CHECK(type_->isPrimitiveType());
+  VELOX_CHECK(empty());
+  VELOX_CHECK(!isConstantStream_ && !isDictionaryStream_);
+
+  encoding_ = VectorEncoding::Simple::DICTIONARY;
+  isDictionaryStream_ = true;
+  initializeHeader(kDictionary, *streamArena_);
+  values_.startWrite(initialNumRows * sizeof(int32_t));
+  children_.emplace_back(
+      type_,
+      std::nullopt,
+      std::nullopt,
+      streamArena_,
+      std::max(initialNumRows, 1),
+      opts_);
+}
+
 void VectorStream::flush(OutputStream* out) {
   out->write(reinterpret_cast<char*>(header_.buffer), header_.size);
 
@@ -309,6 +327,12 @@ void VectorStream::flushNulls(OutputStream* out) {
 }
 
 void VectorStream::clear() {
+  if (isDictionaryStream_ && type_->isPrimitiveType()) {
+    // The next page starts flat, see startDictionary().
+    isDictionaryStream_ = false;
+    children_.clear();
+    initializeFlatStream(std::nullopt, 0);
+  }
   encoding_ = std::nullopt;
   initializeHeader(typeToEncodingName(type_), *streamArena_);
   nonNullCount_ = 0;
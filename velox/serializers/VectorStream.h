@@ -42,6 +42,11 @@ class VectorStream {
 
   void flattenStream(const VectorPtr& vector, int32_t initialNumRows);
 
+  // Switches an empty flat stream of a primitive type to dictionary encoding.
+  // The dictionary values are then appended to childAt(0) and the int32_t
+  // indices to 'this'. clear() switches the stream back to flat encoding.
+  void startDictionary(int32_t initialNumRows);
+
   std::optional<VectorEncoding::Simple> getEncoding(
       std::optional<VectorEncoding::Simple> encoding,
       std::optional<VectorPtr> vector) {
@@ -157,6 +162,10 @@ class VectorStream {
     return isConstantStream_;
   }
 
+  bool empty() const {
+    return nullCount_ == 0 && nonNullCount_ == 0;
+  }
+
   bool preserveEncodings() const {
     return opts_.preserveEncodings;
   }
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/serializers/ArrowIpcSerializer.h"
+#include <gtest/gtest.h>
+#include <numeric>
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/vector/fuzzer/VectorFuzzer.h"
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+namespace facebook::velox::serializer {
+namespace {
+
+class ArrowIpcSerializerTest
+    : public ::testing::Test,
+      public velox::test::VectorTestBase,
+      public testing::WithParamInterface<common::CompressionKind> {
+ protected:
+  static void SetUpTestCase() {
+    memory::MemoryManager::testingSetInstance({});
+  }
+
+  void SetUp() override {
+    deregisterNamedVectorSerde(VectorSerde::Kind::kArrowIpc);
+    ArrowIpcVectorSerde::registerNamedVectorSerde();
+    serde_ = getNamedVectorSerde(VectorSerde::Kind::kArrowIpc);
+    ASSERT_EQ(serde_->kind(), VectorSerde::Kind::kArrowIpc);
+    options_ = std::make_unique<VectorSerde::Options>(GetParam(), 0.8);
+  }
+
+  void TearDown() override {
+    deregisterNamedVectorSerde(VectorSerde::Kind::kArrowIpc);
+  }
+
+  // Appends the rows of 'rowVector' in ranges of growing size, or row by row
+  // if 'appendRows' is true, and flushes them as one page to 'output'.
+  void serialize(
+      const RowVectorPtr& rowVector,
+      bool appendRows,
+      std::ostream* output) {
+    const auto numRows = rowVector->size();
+    const auto start = output->tellp();
+    auto arena = std::make_unique<StreamArena>(pool());
+    auto serializer = serde_->createIterativeSerializer(
+        asRowType(rowVector->type()), numRows, arena.get(), options_.get());
+    Scratch scratch;
+    if (appendRows) {
+      std::vector<vector_size_t> rows(numRows);
+      std::iota(rows.begin(), rows.end(), 0);
+      serializer->append(
+          rowVector, folly::Range(rows.data(), rows.size()), scratch);
+    } else {
+      std::vector<IndexRange> ranges;
+      vector_size_t offset = 0;
+      vector_size_t rangeSize = 1;
+      while (offset < numRows) {
+        const auto size = std::min<vector_size_t>(rangeSize, numRows - offset);
+        ranges.push_back(IndexRange{offset, size});
+        offset += size;
+        rangeSize *= 2;
+      }
+      serializer->append(
+          rowVector, folly::Range(ranges.data(), ranges.size()), scratch);
+    }
+    const auto size = serializer->maxSerializedSize();
+    OStreamOutputStream out(output);
+    serializer->flush(&out);
+    ASSERT_EQ(size, output->tellp() - start);
+  }
+
+  RowVectorPtr fuzzInput(vector_size_t size) {
+    const auto rowType = ROW({
+        BOOLEAN(),
+        TINYINT(),
+        SMALLINT(),
+        INTEGER(),
+        BIGINT(),
+        REAL(),
+        DOUBLE(),
+        VARCHAR(),
+        TIMESTAMP(),
+        ROW({VARCHAR(), INTEGER()}),
+        ARRAY(INTEGER()),
+        MAP(VARCHAR(), INTEGER()),
+    });
+    VectorFuzzer::Options opts;
+    opts.vectorSize = size;
+    opts.nullRatio = 0.1;
+    opts.stringVariableLength = true;
+    opts.timestampPrecision =
+        VectorFuzzer::Options::TimestampPrecision::kMicroSeconds;
+    const auto seed = folly::Random::rand32();
+    LOG(INFO) << "Seed: " << seed;
+    VectorFuzzer fuzzer(opts, pool(), seed);
+    return fuzzer.fuzzInputRow(rowType);
+  }
+
+  VectorSerde* serde_;
+  std::unique_ptr<VectorSerde::Options> options_;
+};
+
+TEST_P(ArrowIpcSerializerTest, roundTrip) {
+  for (const bool appendRows : {false, true}) {
+    SCOPED_TRACE(fmt::format("appendRows {}", appendRows));
+    const auto data = fuzzInput(100);
+    std::ostringstream out;
+    serialize(data, appendRows, &out);
+
+    const auto serialized = out.str();
+    auto source = std::make_unique<BufferInputStream>(std::vector<ByteRange>{
+        {reinterpret_cast<uint8_t*>(const_cast<char*>(serialized.data())),
+         static_cast<int32_t>(serialized.size()),
+         0}});
+    RowVectorPtr result;
+    serde_->deserialize(
+        source.get(),
+        pool(),
+        asRowType(data->type()),
+        &result,
+        options_.get());
+    ASSERT_TRUE(source->atEnd());
+    test::assertEqualVectors(data, result);
+  }
+}
+
+TEST_P(ArrowIpcSerializerTest, appendPages) {
+  const auto first = fuzzInput(50);
+  const auto second = fuzzInput(70);
+  std::ostringstream out;
+  serialize(first, false, &out);
+  serialize(second, true, &out);
+
+  const auto serialized = out.str();
+  auto source = std::make_unique<BufferInputStream>(std::vector<ByteRange>{
+      {reinterpret_cast<uint8_t*>(const_cast<char*>(serialized.data())),
+       static_cast<int32_t>(serialized.size()),
+       0}});
+  const auto rowType = asRowType(first->type());
+  RowVectorPtr result;
+  ASSERT_TRUE(serde_->supportsAppendInDeserialize());
+  while (!source->atEnd()) {
+    serde_->deserialize(
+        source.get(),
+        pool(),
+        rowType,
+        &result,
+        result == nullptr ? 0 : result->size(),
+        options_.get());
+  }
+
+  auto expected = BaseVector::create<RowVector>(rowType, 0, pool());
+  expected->append(first.get());
+  expected->append(second.get());
+  test::assertEqualVectors(expected, result);
+}
+
+TEST_P(ArrowIpcSerializerTest, estimateSerializedSize) {
+  const auto data = fuzzInput(10);
+  std::vector<vector_size_t> sizes(2, 0);
+  std::vector<vector_size_t*> sizePointers{&sizes[0], &sizes[1]};
+  const std::vector<IndexRange> ranges{{0, 1}, {1, 9}};
+  Scratch scratch;
+  serde_->estimateSerializedSize(
+      data.get(),
+      folly::Range(ranges.data(), ranges.size()),
+      sizePointers.data(),
+      scratch);
+  ASSERT_GT(sizes[0], 0);
+  ASSERT_EQ(sizes[1], 9 * sizes[0]);
+}
+
+TEST_P(ArrowIpcSerializerTest, unsupportedCompression) {
+  auto arena = std::make_unique<StreamArena>(pool());
+  const VectorSerde::Options options(
+      common::CompressionKind::CompressionKind_SNAPPY, 0.8);
+  VELOX_ASSERT_USER_THROW(
+      serde_->createIterativeSerializer(
+          ROW({BIGINT()}), 1, arena.get(), &options),
+      "Arrow IPC body compression supports only LZ4 and ZSTD, not snappy");
+}
+
+VELOX_INSTANTIATE_TEST_SUITE_P(
+    ArrowIpcSerializerTest,
+    ArrowIpcSerializerTest,
+    testing::Values(
+        common::CompressionKind::CompressionKind_NONE,
+        common::CompressionKind::CompressionKind_LZ4,
+        common::CompressionKind::CompressionKind_ZSTD));
+} // namespace
+} // namespace facebook::velox::serializer
@@ -1451,6 +1451,159 @@ TEST_P(PrestoSerializerTest, ioBufRoundTrip) {
   }
 }
 
+TEST_P(PrestoSerializerTest, zeroCopyDeserialize) {
+  auto input = makeTestVector(1'000);
+  std::ostringstream out;
+  serialize(input, &out, nullptr);
+  auto owner = std::make_shared<std::string>(out.str());
+  const auto* begin = owner->data();
+  const auto* end = begin + owner->size();
+
+  ByteRange range{
+      reinterpret_cast<uint8_t*>(owner->data()),
+      static_cast<int32_t>(owner->size()),
+      0};
+  auto byteStream =
+      std::make_unique<BufferInputStream>(std::vector<ByteRange>{range}, owner);
+  auto options = getParamSerdeOptions(nullptr);
+  options.zeroCopyDeserialize = true;
+  RowVectorPtr result;
+  serde_->deserialize(
+      byteStream.get(),
+      pool_.get(),
+      asRowType(input->type()),
+      &result,
+      0,
+      &options);
+  // The vectors keep the stream memory alive.
+  byteStream.reset();
+  owner.reset();
+  assertEqualVectors(input, result);
+
+  // A compressed page is copied out of the stream when it is decompressed.
+  if (GetParam() != common::CompressionKind::CompressionKind_NONE) {
+    return;
+  }
+  auto* strings = result->childAt(2)->asFlatVector<StringView>();
+  ASSERT_EQ(strings->stringBuffers().size(), 1);
+  const auto& stringBuffer = strings->stringBuffers()[0];
+  ASSERT_TRUE(stringBuffer->isView());
+  ASSERT_GE(stringBuffer->as<char>(), begin);
+  ASSERT_LE(stringBuffer->as<char>() + stringBuffer->size(), end);
+  for (auto i = 0; i < 2; ++i) {
+    const auto& values = result->childAt(i)->values();
+    if (values->isView()) {
+      ASSERT_GE(values->as<char>(), begin);
+      ASSERT_LE(values->as<char>() + values->size(), end);
+    }
+  }
+}
+
+TEST_P(PrestoSerializerTest, appendDictionaries) {
+  const vector_size_t kNumRows = 1'000;
+  auto base = makeFlatVector<std::string>(
+      10, [](auto row) { return fmt::format("a long string value {}", row); });
+  auto makeInput = [&](vector_size_t offset) {
+    auto indices =
+        makeIndices(kNumRows, [&](auto row) { return (row + offset) % 10; });
+    return makeRowVector(
+        {wrapInDictionary(indices, base),
+         makeFlatVector<int64_t>(kNumRows, [](auto row) { return row; })});
+  };
+  const auto first = makeInput(0);
+  const auto second = makeInput(3);
+  const auto flat = makeRowVector(
+      {makeFlatVector<std::string>(
+           kNumRows, [](auto row) { return fmt::format("flat {}", row); }),
+       makeFlatVector<int64_t>(kNumRows, [](auto row) { return row; })});
+
+  const auto rowType = asRowType(first->type());
+  auto expected = BaseVector::create<RowVector>(rowType, 0, pool_.get());
+  expected->append(first.get());
+  expected->append(second.get());
+  expected->append(flat.get());
+
+  auto options = getParamSerdeOptions(nullptr);
+  auto serializeInputs = [&](bool appendDictionaries) {
+    options.appendDictionaries = appendDictionaries;
+    StreamArena arena(pool_.get());
+    auto serializer =
+        serde_->createIterativeSerializer(rowType, kNumRows, &arena, &options);
+    serializer->append(first);
+    serializer->append(second);
+    serializer->append(flat);
+    std::ostringstream out;
+    OStreamOutputStream output(&out);
+    serializer->flush(&output);
+
+    // A cleared page starts flat.
+    serializer->clear();
+    serializer->append(flat);
+    std::ostringstream flatOut;
+    OStreamOutputStream flatOutput(&flatOut);
+    serializer->flush(&flatOutput);
+    assertEqualVectors(flat, deserialize(rowType, flatOut.str(), &options));
+    return out.str();
+  };
+
+  const auto flatPage = serializeInputs(false);
+  const auto dictionaryPage = serializeInputs(true);
+  if (GetParam() == common::CompressionKind::CompressionKind_NONE) {
+    ASSERT_LT(dictionaryPage.size(), flatPage.size());
+  }
+  const auto result = deserialize(rowType, dictionaryPage, &options);
+  ASSERT_EQ(
+      result->childAt(0)->encoding(), VectorEncoding::Simple::DICTIONARY);
+  // Each value of 'base' is added once, followed by the flat strings.
+  ASSERT_EQ(result->childAt(0)->valueVector()->size(), 10 + kNumRows);
+  assertEqualVectors(expected, result);
+}
+
+TEST_P(PrestoSerializerTest, adaptiveCompression) {
+  const vector_size_t kNumRows = 10'000;
+  const auto compressible = makeRowVector({makeFlatVector<std::string>(
+      kNumRows, [](auto row) { return fmt::format("value {}", row % 7); })});
+  const auto random = makeRowVector({makeFlatVector<int64_t>(
+      kNumRows, [](auto /*row*/) { return folly::Random::rand64(); })});
+  const auto rowType = asRowType(compressible->type());
+
+  auto options = getParamSerdeOptions(nullptr);
+  options.adaptiveCompression = true;
+  auto serializePage = [&](const RowVectorPtr& input,
+                           std::unordered_map<std::string, RuntimeCounter>&
+                               stats) {
+    StreamArena arena(pool_.get());
+    auto serializer =
+        serde_->createIterativeSerializer(rowType, kNumRows, &arena, &options);
+    serializer->append(input);
+    std::ostringstream out;
+    OStreamOutputStream output(&out);
+    serializer->flush(&output);
+    stats = serializer->runtimeStats();
+    return out.str();
+  };
+
+  // The page names its codec, so the deserializer needs no codec option.
+  serializer::presto::PrestoVectorSerde::PrestoOptions readOptions;
+  std::unordered_map<std::string, RuntimeCounter> stats;
+  const auto compressedPage = serializePage(compressible, stats);
+  ASSERT_EQ(stats.at("adaptiveCompressionNonePages").value, 0);
+  ASSERT_EQ(
+      stats.at("adaptiveCompressionLz4Pages").value +
+          stats.at("adaptiveCompressionZstdPages").value,
+      1);
+  // The codec marker follows the number of rows.
+  ASSERT_NE(compressedPage[4] & 1, 0);
+  ASSERT_NE(compressedPage[4] >> 3, 0);
+  assertEqualVectors(
+      compressible, deserialize(rowType, compressedPage, &readOptions));
+
+  const auto randomPage = serializePage(random, stats);
+  ASSERT_EQ(stats.at("adaptiveCompressionNonePages").value, 1);
+  ASSERT_EQ(randomPage[4] & 1, 0);
+  assertEqualVectors(random, deserialize(rowType, randomPage, &readOptions));
+}
+
 TEST_P(PrestoSerializerTest, roundTrip) {
   VectorFuzzer::Options opts;
   opts.timestampPrecision =
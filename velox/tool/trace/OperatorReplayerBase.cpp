@@ -16,8 +16,11 @@
 
 #include <folly/json.h>
 
+#include <numeric>
 #include <utility>
 
+#include "velox/common/base/SuccinctPrinter.h"
+#include "velox/common/time/Timer.h"
 #include "velox/core/PlanNode.h"
 #include "velox/exec/PlanNodeStats.h"
 #include "velox/exec/TaskTraceReader.h"
@@ -89,6 +92,58 @@ RowVectorPtr OperatorReplayerBase::run(bool copyResults) {
   return result;
 }
 
+OperatorReplayerBase::BenchmarkStats OperatorReplayerBase::benchmark(
+    int32_t numRuns,
+    bool copyResults) {
+  VELOX_USER_CHECK_GT(numRuns, 0);
+  std::vector<uint64_t> micros(numRuns);
+  std::vector<uint64_t> inputRows(numRuns);
+  for (auto i = 0; i < numRuns; ++i) {
+    {
+      MicrosecondTimer timer(&micros[i]);
+      run(copyResults);
+    }
+    inputRows[i] = lastInputRows_;
+  }
+  std::vector<int32_t> order(numRuns);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](auto lhs, auto rhs) {
+    return micros[lhs] < micros[rhs];
+  });
+  auto percentile = [&](int32_t pct) {
+    return order[std::min<int32_t>(numRuns - 1, numRuns * pct / 100)];
+  };
+  BenchmarkStats stats;
+  stats.numRuns = numRuns;
+  stats.minMicros = micros[order.front()];
+  stats.p50Micros = micros[percentile(50)];
+  stats.p90Micros = micros[percentile(90)];
+  stats.maxMicros = micros[order.back()];
+  const auto median = percentile(50);
+  if (micros[median] > 0) {
+    stats.inputRowsPerSecond = inputRows[median] * 1e6 / micros[median];
+  }
+  return stats;
+}
+
+std::string OperatorReplayerBase::BenchmarkStats::toString() const {
+  return fmt::format(
+      "runs: {}, min: {}, p50: {}, p90: {}, max: {}, input rows/s: {:.0f}",
+      numRuns,
+      succinctMicros(minMicros),
+      succinctMicros(p50Micros),
+      succinctMicros(p90Micros),
+      succinctMicros(maxMicros),
+      inputRowsPerSecond);
+}
+
+void OperatorReplayerBase::setQueryConfigs(
+    const std::unordered_map<std::string, std::string>& queryConfigs) {
+  for (const auto& [name, value] : queryConfigs) {
+    queryConfigs_[name] = value;
+  }
+}
+
 core::PlanNodePtr OperatorReplayerBase::createPlan() {
   const auto* replayNode = core::PlanNode::findFirstNode(
       planFragment_.get(),
@@ -144,6 +199,8 @@ void OperatorReplayerBase::printStats(
     const std::shared_ptr<exec::Task>& task) const {
   const auto planStats = exec::toPlanStats(task->taskStats());
   const auto& stats = planStats.at(replayPlanNodeId_);
+  // A scan has no input rows, so its rows read count instead.
+  lastInputRows_ = stats.inputRows > 0 ? stats.inputRows : stats.rawInputRows;
   for (const auto& [name, operatorStats] : stats.operatorStats) {
     LOG(INFO) << "Stats of replaying operator " << name << " : "
               << operatorStats->toString();
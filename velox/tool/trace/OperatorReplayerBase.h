@@ -47,6 +47,27 @@ class OperatorReplayerBase {
 
   virtual RowVectorPtr run(bool copyResults = true);
 
+  /// The latencies of repeated replays.
+  struct BenchmarkStats {
+    int32_t numRuns{0};
+    uint64_t minMicros{0};
+    uint64_t p50Micros{0};
+    uint64_t p90Micros{0};
+    uint64_t maxMicros{0};
+    /// The input rows of the replayed operator per second of the median run.
+    double inputRowsPerSecond{0};
+
+    std::string toString() const;
+  };
+
+  /// Replays 'numRuns' times and returns the distribution of the latencies.
+  BenchmarkStats benchmark(int32_t numRuns, bool copyResults = false);
+
+  /// Overrides the traced query configs, e.g. to replay with other spill
+  /// settings.
+  void setQueryConfigs(
+      const std::unordered_map<std::string, std::string>& queryConfigs);
+
  protected:
   virtual core::PlanNodePtr createPlanNode(
       const core::PlanNode* node,
@@ -77,8 +98,12 @@ class OperatorReplayerBase {
   core::PlanNodePtr planFragment_;
   core::PlanNodeId replayPlanNodeId_;
 
+  // Prints the stats of the replayed operator and records its input rows in
+  // 'lastInputRows_'.
   void printStats(const std::shared_ptr<exec::Task>& task) const;
 
+  mutable uint64_t lastInputRows_{0};
+
  private:
   std::function<core::PlanNodePtr(std::string, core::PlanNodePtr)>
   replayNodeFactory(const core::PlanNode* node) const;
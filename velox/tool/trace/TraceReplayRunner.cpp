@@ -16,6 +16,7 @@
 
 #include "velox/tool/trace/TraceReplayRunner.h"
 
+#include <folly/String.h>
 #include <gflags/gflags.h>
 
 #include "velox/common/file/FileSystems.h"
@@ -99,9 +100,36 @@ DEFINE_uint64(
     0,
     "Specify the query memory capacity limit in GB. If it is zero, then there is no limit.");
 DEFINE_bool(copy_results, false, "Copy the replaying results.");
+DEFINE_int32(
+    num_replays,
+    1,
+    "Number of times to replay. If more than 1, prints the distribution of "
+    "the replay latencies and the input rows per second of the operator.");
+DEFINE_string(
+    query_config_overrides,
+    "",
+    "A comma-separated list of name=value query configs to replay with "
+    "instead of the traced ones, e.g. 'spill_enabled=false'.");
 
 namespace facebook::velox::tool::trace {
 namespace {
+std::unordered_map<std::string, std::string> parseQueryConfigs(
+    const std::string& configs) {
+  std::unordered_map<std::string, std::string> result;
+  std::vector<std::string> pairs;
+  folly::split(',', configs, pairs, true);
+  for (const auto& pair : pairs) {
+    std::string name;
+    std::string value;
+    VELOX_USER_CHECK(
+        folly::split('=', pair, name, value),
+        "Bad query config: {}, expected name=value",
+        pair);
+    result[name] = value;
+  }
+  return result;
+}
+
 VectorSerde::Kind getVectorSerdeKind() {
   switch (FLAGS_shuffle_serialization_format) {
     case 0:
@@ -403,6 +431,14 @@ void TraceReplayRunner::run() {
     return;
   }
   VELOX_USER_CHECK(!FLAGS_task_id.empty(), "--task_id must be provided");
-  createReplayer()->run(FLAGS_copy_results);
+  auto replayer = createReplayer();
+  replayer->setQueryConfigs(parseQueryConfigs(FLAGS_query_config_overrides));
+  if (FLAGS_num_replays <= 1) {
+    replayer->run(FLAGS_copy_results);
+    return;
+  }
+  const auto stats = replayer->benchmark(FLAGS_num_replays, FLAGS_copy_results);
+  LOG(INFO) << "Replay latencies of " << FLAGS_node_id << ": "
+            << stats.toString();
 }
 } // namespace facebook::velox::tool::trace
@@ -201,6 +201,39 @@ TEST_F(FilterProjectReplayerTest, filterProject) {
   }
 }
 
+TEST_F(FilterProjectReplayerTest, benchmark) {
+  const auto traceRoot = fmt::format("{}/{}", testDir_->getPath(), "benchmark");
+  const auto planWithSplits = createPlan(PlanMode::FilterProject);
+  std::shared_ptr<Task> task;
+  AssertQueryBuilder(planWithSplits.plan)
+      .maxDrivers(2)
+      .config(core::QueryConfig::kQueryTraceEnabled, true)
+      .config(core::QueryConfig::kQueryTraceDir, traceRoot)
+      .config(core::QueryConfig::kQueryTraceMaxBytes, 100UL << 30)
+      .config(core::QueryConfig::kQueryTraceTaskRegExp, ".*")
+      .config(core::QueryConfig::kQueryTraceNodeIds, projectNodeId_)
+      .splits(planWithSplits.splits)
+      .copyResults(pool(), task);
+
+  FilterProjectReplayer replayer(
+      traceRoot,
+      task->queryCtx()->queryId(),
+      task->taskId(),
+      projectNodeId_,
+      "FilterProject",
+      "",
+      0,
+      executor_.get());
+  replayer.setQueryConfigs(
+      {{core::QueryConfig::kPreferredOutputBatchRows, "100"}});
+  const auto stats = replayer.benchmark(3);
+  ASSERT_EQ(stats.numRuns, 3);
+  ASSERT_LE(stats.minMicros, stats.p50Micros);
+  ASSERT_LE(stats.p50Micros, stats.p90Micros);
+  ASSERT_LE(stats.p90Micros, stats.maxMicros);
+  ASSERT_GT(stats.inputRowsPerSecond, 0);
+}
+
 TEST_F(FilterProjectReplayerTest, filterOnly) {
   const auto planWithSplits = createPlan(PlanMode::FilterOnly);
   AssertQueryBuilder builder(planWithSplits.plan);
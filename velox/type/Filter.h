@@ -57,6 +57,7 @@ enum class FilterKind {
   kHugeintRange,
   kTimestampRange,
   kHugeintValuesUsingHashTable,
+  kBigintValuesUsingBloomFilter,
 };
 
 class Filter;
@@ -1134,6 +1135,97 @@ class BigintValuesUsingBitmask final : public Filter {
   const int64_t max_;
 };
 
+/// IN-list filter for integral data types backed by a Bloom filter over the
+/// hashes of the accepted values. The filter may let through values that are
+/// not in the list but never rejects a value that is. This makes it only
+/// suitable for filters whose result is re-checked later, e.g. dynamic filters
+/// pushed down from a hash join build. 'min' and 'max' bound the accepted
+/// values so that row group and stripe statistics can still be used for
+/// pruning.
+class BigintValuesUsingBloomFilter final : public Filter {
+ public:
+  /// @param min Minimum value.
+  /// @param max Maximum value.
+  /// @param bloomFilter Bloom filter with the hashes of the accepted values as
+  /// computed by hash().
+  /// @param nullAllowed Null values are passing the filter if true.
+  BigintValuesUsingBloomFilter(
+      int64_t min,
+      int64_t max,
+      std::shared_ptr<const BloomFilter<>> bloomFilter,
+      bool nullAllowed);
+
+  BigintValuesUsingBloomFilter(
+      const BigintValuesUsingBloomFilter& other,
+      bool nullAllowed)
+      : Filter(true, nullAllowed, FilterKind::kBigintValuesUsingBloomFilter),
+        min_(other.min_),
+        max_(other.max_),
+        bloomFilter_(other.bloomFilter_) {}
+
+  /// Returns the hash of 'value' as inserted into and looked up in the Bloom
+  /// filter.
+  static uint64_t hash(int64_t value) {
+    return folly::hasher<int64_t>()(value);
+  }
+
+  folly::dynamic serialize() const override;
+
+  static FilterPtr create(const folly::dynamic& obj);
+
+  std::unique_ptr<Filter> clone(
+      std::optional<bool> nullAllowed = std::nullopt) const final {
+    if (nullAllowed) {
+      return std::make_unique<BigintValuesUsingBloomFilter>(
+          *this, nullAllowed.value());
+    } else {
+      return std::make_unique<BigintValuesUsingBloomFilter>(*this);
+    }
+  }
+
+  bool testInt64(int64_t value) const final {
+    if (value < min_ || value > max_) {
+      return false;
+    }
+    return bloomFilter_->mayContain(hash(value));
+  }
+
+  bool testInt64Range(int64_t min, int64_t max, bool hasNull) const final;
+
+  /// Combines with 'other' using 'AND' logic. Since the result of this filter
+  /// is approximate anyway, a combination that cannot be represented keeps
+  /// only 'other', which is a valid superset of the exact result.
+  std::unique_ptr<Filter> mergeWith(const Filter* other) const final;
+
+  int64_t min() const {
+    return min_;
+  }
+
+  int64_t max() const {
+    return max_;
+  }
+
+  const BloomFilter<>& bloomFilter() const {
+    return *bloomFilter_;
+  }
+
+  std::string toString() const override {
+    return fmt::format(
+        "BigintValuesUsingBloomFilter: [{}, {}] {}",
+        min_,
+        max_,
+        nullAllowed_ ? "with nulls" : "no nulls");
+  }
+
+  bool testingEquals(const Filter& other) const final;
+
+ private:
+  const int64_t min_;
+  const int64_t max_;
+  // Shared between the copies of the filter made for each split or driver.
+  const std::shared_ptr<const BloomFilter<>> bloomFilter_;
+};
+
 // NOT IN-list filter for integral data types. Implemented as a hash table. Good
 // for large number of rejected values that do not fit within a small range.
 class NegatedBigintValuesUsingHashTable final : public Filter {
@@ -1924,6 +2016,7 @@ class BytesValues final : public Filter {
 
     lower_ = *std::min_element(values_.begin(), values_.end());
     upper_ = *std::max_element(values_.begin(), values_.end());
+    initPrefixBits();
   }
 
   BytesValues(const BytesValues& other, bool nullAllowed)
@@ -1931,7 +2024,9 @@ class BytesValues final : public Filter {
         lower_(other.lower_),
         upper_(other.upper_),
         values_(other.values_),
-        lengths_(other.lengths_) {}
+        lengths_(other.lengths_),
+        prefixBits_(other.prefixBits_),
+        prefixShift_(other.prefixShift_) {}
 
   folly::dynamic serialize() const override;
 
@@ -1951,8 +2046,11 @@ class BytesValues final : public Filter {
   }
 
   bool testBytes(const char* value, int32_t length) const final {
-    return lengths_.contains(length) &&
-        values_.contains(std::string(value, length));
+    const auto bit = prefixBit(value, length);
+    if (!bits::isBitSet(prefixBits_.data(), bit)) {
+      return false;
+    }
+    return values_.find(std::string_view(value, length)) != values_.end();
   }
 
   bool testBytesRange(
@@ -1969,10 +2067,24 @@ class BytesValues final : public Filter {
   bool testingEquals(const Filter& other) const final;
 
  private:
+  // Sets the bits of 'prefixBits_' for 'values_'.
+  void initPrefixBits();
+
+  // Returns the bit of 'prefixBits_' for the length and the first 8 bytes of
+  // a value. Most values not in 'values_' are rejected by the bit before
+  // hashing and comparing all their bytes.
+  uint64_t prefixBit(const char* value, int32_t length) const {
+    uint64_t prefix = 0;
+    memcpy(&prefix, value, std::min<int32_t>(length, sizeof(prefix)));
+    return ((prefix ^ length) * 0x9E3779B97F4A7C15ULL) >> prefixShift_;
+  }
+
   std::string lower_;
   std::string upper_;
   folly::F14FastSet<std::string> values_;
   folly::F14FastSet<uint32_t> lengths_;
+  std::vector<uint64_t> prefixBits_;
+  int32_t prefixShift_;
 };
 
 /// Represents a combination of two of more range filters on integral types with
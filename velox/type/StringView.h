@@ -153,6 +153,12 @@ struct StringView {
     return !(*this == other);
   }
 
+  /// Returns true if the sizes and the first kPrefixSize bytes of 'this' and
+  /// 'other' are equal. Does not read the characters that are out of line.
+  bool sizeAndPrefixEquals(const StringView& other) const {
+    return sizeAndPrefixAsInt64() == other.sizeAndPrefixAsInt64();
+  }
+
   // Returns 0, if this == other
   //       < 0, if this < other
   //       > 0, if this > other
@@ -91,6 +91,26 @@ void Timestamp::toTimezone(const tz::TimeZone& zone) {
   }
 }
 
+// static
+void Timestamp::toTimezone(
+    const tz::TimeZone& zone,
+    Timestamp* timestamps,
+    size_t size) {
+  tz::TimeZone::OffsetRange range{0, 0, 0};
+  try {
+    for (size_t i = 0; i < size; ++i) {
+      auto& seconds = timestamps[i].seconds_;
+      if (!range.contains(seconds)) {
+        range = zone.offsetRange(std::chrono::seconds(seconds));
+      }
+      seconds += range.offset;
+    }
+  } catch (const std::invalid_argument& e) {
+    // Same as in toTimezone() above.
+    VELOX_FAIL_UNSUPPORTED_INPUT_UNCATCHABLE(e.what());
+  }
+}
+
 const tz::TimeZone& Timestamp::defaultTimezone() {
   static const tz::TimeZone* kDefault = ({
     // TODO: We are hard-coding PST/PDT here to be aligned with the current
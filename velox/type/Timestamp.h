@@ -374,6 +374,12 @@ struct Timestamp {
   ///  ts.toString(); // returns December 31, 1969 16:00:00
   void toTimezone(const tz::TimeZone& zone);
 
+  /// Same as toTimezone() over 'size' 'timestamps'. Looks up the offset only
+  /// for the values that have a different one than the previous value, which
+  /// is rare for sorted or clustered values.
+  static void
+  toTimezone(const tz::TimeZone& zone, Timestamp* timestamps, size_t size);
+
   /// A default time zone that is same across the process.
   static const tz::TimeZone& defaultTimezone();
 
@@ -101,6 +101,13 @@ TEST_F(FilterSerDeTest, valuesFilters) {
           NegatedBigintValuesUsingHashTable(lower, upper, values, nullAllowed));
       testSerde(
           NegatedBigintValuesUsingBitmask(lower, upper, values, nullAllowed));
+      auto bloomFilter = std::make_shared<BloomFilter<>>();
+      bloomFilter->reset(values.size());
+      for (auto value : values) {
+        bloomFilter->insert(BigintValuesUsingBloomFilter::hash(value));
+      }
+      testSerde(BigintValuesUsingBloomFilter(
+          lower, upper, std::move(bloomFilter), nullAllowed));
       testSerde(BytesValues(strValues, nullAllowed));
       testSerde(NegatedBytesValues(strValues, nullAllowed));
 
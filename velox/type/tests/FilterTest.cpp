@@ -463,6 +463,58 @@ TEST(FilterTest, bigintValuesUsingBitmask) {
   EXPECT_FALSE(filter->testInt64Range(1234, 2000, false));
 }
 
+TEST(FilterTest, bigintValuesUsingBloomFilter) {
+  auto bloomFilter = std::make_shared<BloomFilter<>>();
+  bloomFilter->reset(1'000);
+  for (int64_t i = 0; i < 1'000; ++i) {
+    bloomFilter->insert(BigintValuesUsingBloomFilter::hash(i * 3));
+  }
+  BigintValuesUsingBloomFilter filter(0, 2'997, bloomFilter, false);
+
+  // No false negatives.
+  for (int64_t i = 0; i < 1'000; ++i) {
+    EXPECT_TRUE(filter.testInt64(i * 3));
+  }
+  // Few false positives.
+  int32_t numPassed = 0;
+  for (int64_t i = 0; i < 1'000; ++i) {
+    numPassed += filter.testInt64(i * 3 + 1);
+  }
+  EXPECT_LT(numPassed, 100);
+  EXPECT_FALSE(filter.testNull());
+  EXPECT_FALSE(filter.testInt64(-3));
+  EXPECT_FALSE(filter.testInt64(3'000));
+
+  EXPECT_TRUE(filter.testInt64Range(5, 50, false));
+  EXPECT_FALSE(filter.testInt64Range(-10, -5, false));
+  EXPECT_FALSE(filter.testInt64Range(3'000, 4'000, false));
+
+  // Merge with a range narrows the range.
+  auto merged = filter.mergeWith(BigintRange(0, 10, false).clone().get());
+  ASSERT_EQ(merged->kind(), FilterKind::kBigintValuesUsingBloomFilter);
+  EXPECT_TRUE(merged->testInt64(9));
+  EXPECT_FALSE(merged->testInt64(12));
+  merged = BigintRange(3'000, 4'000, false).mergeWith(&filter);
+  EXPECT_EQ(merged->kind(), FilterKind::kAlwaysFalse);
+
+  // Merge with an IN-list keeps the values that pass the Bloom filter.
+  auto values = createBigintValues({3, 6, 7, 3'000}, false);
+  merged = values->mergeWith(&filter);
+  EXPECT_TRUE(merged->testInt64(3));
+  EXPECT_TRUE(merged->testInt64(6));
+  EXPECT_FALSE(merged->testInt64(3'000));
+  EXPECT_FALSE(merged->testInt64(9));
+
+  // Merge with a NOT IN-list keeps the NOT IN-list.
+  auto negated = createNegatedBigintValues({3, 6}, false);
+  merged = filter.mergeWith(negated.get());
+  EXPECT_TRUE(merged->testingEquals(*negated));
+
+  auto clone = filter.clone(true);
+  EXPECT_TRUE(clone->testNull());
+  EXPECT_TRUE(clone->testInt64(3));
+}
+
 TEST(FilterTest, negatedBigintValuesUsingBitmask) {
   auto filter = createNegatedBigintValues({1, 6, 1000, 8, 9, 100, 10}, false);
   auto castedFilter =
@@ -974,6 +1026,33 @@ TEST(FilterTest, bytesValues) {
   EXPECT_FALSE(filter->testBytesRange(std::nullopt, "Banana", false));
 }
 
+TEST(FilterTest, manyBytesValues) {
+  auto makeCustomer = [](int32_t i) {
+    return "customer-" + std::to_string(i % 7) + "-" + std::to_string(i);
+  };
+  std::vector<std::string> values;
+  for (auto i = 0; i < 10'000; ++i) {
+    values.push_back(makeCustomer(i));
+  }
+  values.push_back("");
+  values.push_back("a");
+  auto filter = in(values);
+
+  for (const auto& value : values) {
+    EXPECT_TRUE(filter->testBytes(value.data(), value.size())) << value;
+  }
+  EXPECT_FALSE(filter->testBytes("b", 1));
+  EXPECT_FALSE(filter->testBytes("customer-1-1", 11));
+  for (auto i = 10'000; i < 20'000; ++i) {
+    const auto value = makeCustomer(i);
+    EXPECT_FALSE(filter->testBytes(value.data(), value.size())) << value;
+  }
+
+  auto copy = filter->clone(true);
+  EXPECT_TRUE(copy->testBytes(values[123].data(), values[123].size()));
+  EXPECT_FALSE(copy->testBytes("b", 1));
+}
+
 TEST(FilterTest, negatedBytesValues) {
   // create a filter
   std::vector<std::string> values(
@@ -408,6 +408,31 @@ TEST(TimestampTest, outOfRange) {
       "Unable to convert timezone 'America/Los_Angeles' past");
 }
 
+TEST(TimestampTest, toTimezoneBatch) {
+  const auto* timezone = tz::locateZone("America/Los_Angeles");
+  std::vector<Timestamp> timestamps;
+  // Sorted values around the transitions of 2024, then unsorted ones.
+  for (int64_t seconds = 1'704'096'000; seconds < 1'735'718'400;
+       seconds += 3'541) {
+    timestamps.emplace_back(seconds, 123);
+  }
+  for (int64_t seconds : {0L, 1'721'890'800L, -86'400'000L, 1'704'096'000L}) {
+    timestamps.emplace_back(seconds, 0);
+  }
+
+  auto expected = timestamps;
+  for (auto& timestamp : expected) {
+    timestamp.toTimezone(*timezone);
+  }
+  Timestamp::toTimezone(*timezone, timestamps.data(), timestamps.size());
+  EXPECT_EQ(expected, timestamps);
+
+  std::vector<Timestamp> outOfRange{Timestamp(0, 0), Timestamp(32517359891, 0)};
+  VELOX_ASSERT_THROW(
+      Timestamp::toTimezone(*timezone, outOfRange.data(), outOfRange.size()),
+      "Unable to convert timezone 'America/Los_Angeles' past");
+}
+
 // In debug mode, Timestamp constructor will throw exception if range check
 // fails.
 #ifdef NDEBUG
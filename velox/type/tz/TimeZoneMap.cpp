@@ -289,19 +289,22 @@ TDuration toSysImpl(
   return getZonedTime(tz, timePoint, choose).get_sys_time().time_since_epoch();
 }
 
-template <typename TDuration>
-TDuration toLocalImpl(
-    const TDuration& timestamp,
-    const date::time_zone* tz,
-    const std::chrono::minutes offset) {
-  date::sys_time<TDuration> timePoint{timestamp};
-  validateRange(timePoint);
-
-  // If this is an offset time zone.
-  if (tz == nullptr) {
-    return (timePoint + offset).time_since_epoch();
+// The system times covered by the transitions of TimeZone, 1900-01-01 and
+// 2100-01-01.
+constexpr int64_t kTransitionsBegin = -2'208'988'800;
+constexpr int64_t kTransitionsEnd = 4'102'444'800;
+
+// Returns the position of the last of 'size' sorted 'values' that is less than
+// or equal to 'value'. 'values[0]' must be less than or equal to 'value'. Does
+// not branch on the values.
+size_t findLastNotGreater(const int64_t* values, size_t size, int64_t value) {
+  const auto* base = values;
+  while (size > 1) {
+    const auto half = size / 2;
+    base = base[half] <= value ? base + half : base;
+    size -= half;
   }
-  return date::zoned_time{tz, timePoint}.get_local_time().time_since_epoch();
+  return base - values;
 }
 
 template <bool isLongName>
@@ -452,12 +455,67 @@ TimeZone::milliseconds TimeZone::to_sys(
 }
 
 TimeZone::seconds TimeZone::to_local(TimeZone::seconds timestamp) const {
-  return toLocalImpl(timestamp, tz_, offset_);
+  return timestamp + seconds(offsetRange(timestamp).offset);
 }
 
 TimeZone::milliseconds TimeZone::to_local(
     TimeZone::milliseconds timestamp) const {
-  return toLocalImpl(timestamp, tz_, offset_);
+  const auto range = offsetRange(std::chrono::floor<seconds>(timestamp));
+  return timestamp + seconds(range.offset);
+}
+
+TimeZone::OffsetRange TimeZone::offsetRange(seconds timestamp) const {
+  const auto value = timestamp.count();
+  if (tz_ == nullptr) {
+    // The range is all the time points validateRange() accepts.
+    static const int64_t kMinSeconds =
+        std::chrono::duration_cast<seconds>(
+            date::sys_days{date::year::min() / 1 / 1}.time_since_epoch())
+            .count();
+    static const int64_t kMaxSeconds =
+        std::chrono::duration_cast<seconds>(
+            (date::sys_days{date::year::max() / 12 / 31} + date::days{1})
+                .time_since_epoch())
+            .count();
+    validateRange(date::sys_seconds{timestamp});
+    return {kMinSeconds, kMaxSeconds, seconds(offset_).count()};
+  }
+
+  std::call_once(transitionsFlag_, [&]() { buildTransitions(); });
+  if (value >= transitions_.front() && value < transitions_.back()) {
+    const auto i = findLastNotGreater(
+        transitions_.data(), transitionOffsets_.size(), value);
+    return {transitions_[i], transitions_[i + 1], transitionOffsets_[i]};
+  }
+
+  validateRange(date::sys_seconds{timestamp});
+  const auto info = tz_->get_info(date::sys_seconds{timestamp});
+  return {
+      info.begin.time_since_epoch().count(),
+      info.end.time_since_epoch().count(),
+      info.offset.count()};
+}
+
+void TimeZone::buildTransitions() const {
+  auto time = kTransitionsBegin;
+  while (time < kTransitionsEnd) {
+    date::sys_info info;
+    try {
+      info = tz_->get_info(date::sys_seconds{seconds(time)});
+    } catch (const std::invalid_argument&) {
+      // external/date cannot convert past the last transition of the zones
+      // with repetition rules. offsetRange() throws for these times.
+      break;
+    }
+    // Skips the transitions that only change the abbreviation.
+    if (transitionOffsets_.empty() ||
+        transitionOffsets_.back() != info.offset.count()) {
+      transitions_.push_back(time);
+      transitionOffsets_.push_back(info.offset.count());
+    }
+    time = info.end.time_since_epoch().count();
+  }
+  transitions_.push_back(std::min(time, kTransitionsEnd));
 }
 
 TimeZone::seconds TimeZone::correct_nonexistent_time(
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <chrono>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -147,6 +148,24 @@ class TimeZone {
   seconds to_local(seconds timestamp) const;
   milliseconds to_local(milliseconds timestamp) const;
 
+  /// The system times in seconds in [begin, end) that have the same offset to
+  /// the local time.
+  struct OffsetRange {
+    int64_t begin;
+    int64_t end;
+    int64_t offset;
+
+    bool contains(int64_t timestamp) const {
+      return timestamp >= begin && timestamp < end;
+    }
+  };
+
+  /// Returns the range of the system time 'timestamp'. Converting many values
+  /// through the range of the previous one, e.g. sorted values, skips the
+  /// lookup for most of them. Throws like to_local() for the values it cannot
+  /// convert.
+  OffsetRange offsetRange(seconds timestamp) const;
+
   /// If a local time is nonexistent, i.e. refers to a time that exists in the
   /// gap during a time zone conversion, this returns the time adjusted by
   /// the difference between the two time zones, so that it lies in the later
@@ -184,10 +203,20 @@ class TimeZone {
       TChoose choose = TChoose::kFail) const;
 
  private:
+  // Fills 'transitions_' and 'transitionOffsets_'.
+  void buildTransitions() const;
+
   const date::time_zone* tz_{nullptr};
   const std::chrono::minutes offset_{0};
   const std::string timeZoneName_;
   const int16_t timeZoneID_;
+
+  // The system times at which the offset of 'tz_' changes from 1900 to 2100
+  // or to the last time external/date can convert, followed by that end, and
+  // the offset from each but the last one on. Built on first use.
+  mutable std::once_flag transitionsFlag_;
+  mutable std::vector<int64_t> transitions_;
+  mutable std::vector<int64_t> transitionOffsets_;
 };
 
 } // namespace facebook::velox::tz
@@ -19,6 +19,7 @@
 #include "velox/common/base/Exceptions.h"
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/external/date/date.h"
+#include "velox/external/date/tz.h"
 #include "velox/type/tz/TimeZoneMap.h"
 
 namespace facebook::velox::tz {
@@ -91,6 +92,41 @@ TEST(TimeZoneMapTest, offsetToLocal) {
   EXPECT_NE(toLocalTime("-07:00", ts), toLocalTime("America/Los_Angeles", ts));
 }
 
+TEST(TimeZoneMapTest, offsetRange) {
+  for (const auto* name :
+       {"America/Los_Angeles",
+        "Europe/London",
+        "Asia/Kolkata",
+        "Australia/Lord_Howe",
+        "-03:30"}) {
+    SCOPED_TRACE(name);
+    const auto* tz = locateZone(name);
+    // From 1850 to 2037, across the start of the transition tables.
+    for (int64_t ts = -3'786'825'600; ts < 2'114'380'800; ts += 86'399 * 7) {
+      const auto range = tz->offsetRange(seconds(ts));
+      ASSERT_TRUE(range.contains(ts));
+      const auto local = tz->tz() == nullptr
+          ? ts + range.offset
+          : date::zoned_time{tz->tz(), date::sys_seconds{seconds(ts)}}
+                .get_local_time()
+                .time_since_epoch()
+                .count();
+      ASSERT_EQ(local, ts + range.offset);
+      ASSERT_EQ(local, tz->to_local(seconds(ts)).count());
+      ASSERT_EQ(
+          local * 1'000 + 999,
+          tz->to_local(milliseconds(ts * 1'000 + 999)).count());
+    }
+  }
+
+  // The offset changes at the ends of the range.
+  const auto* tz = locateZone("America/Los_Angeles");
+  const auto range = tz->offsetRange(seconds(1'704'096'000));
+  EXPECT_EQ(-8 * 3'600, range.offset);
+  EXPECT_EQ(-7 * 3'600, tz->offsetRange(seconds(range.end)).offset);
+  EXPECT_EQ(-7 * 3'600, tz->offsetRange(seconds(range.begin - 1)).offset);
+}
+
 TEST(TimeZoneMapTest, offsetToSys) {
   auto toSysTime = [&](std::string_view name, size_t ts) {
     const auto* tz = locateZone(name);
@@ -203,6 +203,9 @@ void DecodedVector::combineWrappers(
       hasExtraNulls_ = true;
       mayHaveNulls_ = true;
     }
+  } else if (topEncoding == VectorEncoding::Simple::SEQUENCE) {
+    applySequenceWrapper(*vector, rows, true);
+    values = getValueVector(vector);
   } else {
     VELOX_FAIL(
         "Unsupported wrapper encoding: {}",
@@ -241,6 +244,10 @@ void DecodedVector::combineWrappers(
         applyDictionaryWrapper(*values, rows);
         values = getValueVector(values);
         break;
+      case VectorEncoding::Simple::SEQUENCE:
+        applySequenceWrapper(*values, rows, false);
+        values = getValueVector(values);
+        break;
       default:
         VELOX_CHECK(false, "Unsupported vector encoding");
     }
@@ -286,6 +293,56 @@ void DecodedVector::applyDictionaryWrapper(
   });
 }
 
+namespace {
+// Sets the first 'size' elements of 'runs' to the run of each row of the
+// SequenceVector 'sequenceVector'.
+void setSequenceRuns(
+    const BaseVector& sequenceVector,
+    vector_size_t size,
+    vector_size_t* runs) {
+  const auto* lengths = sequenceVector.wrapInfo()->as<SequenceLength>();
+  const vector_size_t numRuns = sequenceVector.valueVector()->size();
+  vector_size_t row = 0;
+  for (vector_size_t run = 0; run < numRuns && row < size; ++run) {
+    const auto runEnd =
+        std::min<int64_t>(row + static_cast<int64_t>(lengths[run]), size);
+    std::fill(runs + row, runs + runEnd, run);
+    row = runEnd;
+  }
+  VELOX_CHECK_EQ(row, size, "Sequence lengths cover fewer rows than needed");
+}
+} // namespace
+
+void DecodedVector::applySequenceWrapper(
+    const BaseVector& sequenceVector,
+    const SelectivityVector* rows,
+    bool isTopLevel) {
+  if (isTopLevel) {
+    copiedIndices_.resize(size_ > 0 ? size_ : 1);
+    setSequenceRuns(sequenceVector, size_, copiedIndices_.data());
+    indices_ = copiedIndices_.data();
+    return;
+  }
+  if (size_ == 0 || (rows && !rows->hasSelections())) {
+    // No further processing is needed.
+    return;
+  }
+
+  // Sequence values carry their own nulls, so only the indices change.
+  std::vector<vector_size_t> runs(sequenceVector.size());
+  setSequenceRuns(sequenceVector, runs.size(), runs.data());
+  auto currentIndices = indices_;
+  if (indicesNotCopied()) {
+    copiedIndices_.resize(size_);
+    indices_ = copiedIndices_.data();
+  }
+  applyToRows(rows, [&](vector_size_t row) {
+    if (!nulls_ || !bits::isBitNull(nulls_, row)) {
+      copiedIndices_[row] = runs[currentIndices[row]];
+    }
+  });
+}
+
 void DecodedVector::fillInIndices() const {
   if (isConstantMapping_) {
     if (size_ > zeroIndices().size() || constantIndex_ != 0) {
@@ -348,6 +348,14 @@ class DecodedVector {
       const BaseVector& dictionaryVector,
       const SelectivityVector* rows);
 
+  // Maps the rows through the run lengths of the SequenceVector
+  // 'sequenceVector'. Sets 'indices_' to the run of each row if this is the
+  // top level wrapper.
+  void applySequenceWrapper(
+      const BaseVector& sequenceVector,
+      const SelectivityVector* rows,
+      bool isTopLevel);
+
   void copyNulls(vector_size_t size);
 
   void fillInIndices() const;
@@ -79,6 +79,70 @@ char* FlatVector<StringView>::getRawStringBufferWithSpace(
   return rawBuffer;
 }
 
+template <>
+bool FlatVector<StringView>::computeIsAllAscii(
+    const SelectivityVector& rows) const {
+  const auto isInBuffer = [](const StringView& value, const Buffer& buffer) {
+    const auto* data = buffer.as<char>();
+    return value.data() >= data &&
+        value.data() + value.size() <= data + buffer.size();
+  };
+
+  bool isAllAscii = true;
+  bool inBuffers = !stringBuffers_.empty();
+  uint64_t numBytes = 0;
+  size_t lastBuffer = 0;
+  rows.applyToSelected([&](auto row) {
+    if (isNullAt(row)) {
+      return;
+    }
+    const auto& value = rawValues_[row];
+    if (value.isInline()) {
+      isAllAscii &= functions::stringCore::isAscii(value.data(), value.size());
+      return;
+    }
+    numBytes += value.size();
+    if (!inBuffers || isInBuffer(value, *stringBuffers_[lastBuffer])) {
+      return;
+    }
+    inBuffers = false;
+    for (auto i = 0; i < stringBuffers_.size(); ++i) {
+      if (isInBuffer(value, *stringBuffers_[i])) {
+        lastBuffer = i;
+        inBuffers = true;
+        break;
+      }
+    }
+  });
+  if (!isAllAscii || numBytes == 0) {
+    return isAllAscii;
+  }
+
+  if (inBuffers) {
+    uint64_t bufferBytes = 0;
+    for (const auto& buffer : stringBuffers_) {
+      bufferBytes += buffer->size();
+    }
+    if (bufferBytes <= 2 * numBytes &&
+        std::all_of(
+            stringBuffers_.begin(),
+            stringBuffers_.end(),
+            [](const BufferPtr& buffer) {
+              return functions::stringCore::isAscii(
+                  buffer->as<char>(), buffer->size());
+            })) {
+      return true;
+    }
+  }
+  rows.applyToSelected([&](auto row) {
+    if (!isNullAt(row) && !rawValues_[row].isInline()) {
+      isAllAscii &= functions::stringCore::isAscii(
+          rawValues_[row].data(), rawValues_[row].size());
+    }
+  });
+  return isAllAscii;
+}
+
 template <>
 void FlatVector<StringView>::prepareForReuse() {
   BaseVector::prepareForReuse();
@@ -191,6 +191,12 @@ class FlatVector final : public SimpleVector<T> {
   /// Returns the raw values of this vector as a continuous array.
   const T* rawValues() const;
 
+  /// Returns true if full width SIMD loads from rawValues() are safe at any
+  /// row below size(), so that loops over the values need no scalar tail.
+  bool hasSimdPaddedValues() const {
+    return values_ != nullptr && values_->hasSimdPadding();
+  }
+
   const void* valuesAsVoid() const override {
     return rawValues_;
   }
@@ -543,6 +549,10 @@ class FlatVector final : public SimpleVector<T> {
   }
 
  private:
+  bool computeIsAllAscii(const SelectivityVector& rows) const override {
+    return SimpleVector<T>::computeIsAllAscii(rows);
+  }
+
   void ensureValues() {
     if (rawValues_ == nullptr) {
       mutableRawValues();
@@ -651,6 +661,12 @@ char* FlatVector<StringView>::getRawStringBufferWithSpace(
 template <>
 void FlatVector<StringView>::prepareForReuse();
 
+/// Checks the values that are not inlined in bulk over the string buffers if
+/// they all point into these and these are not much larger than the values.
+template <>
+bool FlatVector<StringView>::computeIsAllAscii(
+    const SelectivityVector& rows) const;
+
 template <>
 VectorPtr FlatVector<StringView>::copyPreserveEncodings(
     velox::memory::MemoryPool* pool) const;
@@ -32,6 +32,8 @@ class Callable {
  public:
   virtual ~Callable() = default;
 
+  /// Returns true if the captures need 'wrapCapture' to be aligned with the
+  /// rows of apply(). False if there are no captures or they are constant.
   virtual bool hasCapture() const = 0;
 
   /// Applies 'this' to 'args' for 'rows' and returns the result in
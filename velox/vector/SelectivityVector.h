@@ -191,9 +191,12 @@ class SelectivityVector {
    * Removes rows that are not present in the 'other' vector.
    */
   void intersect(const SelectivityVector& other) {
-    bits::andBits(
-        bits_.data(), other.bits_.data(), begin_, std::min(end_, other.size()));
-    updateBounds();
+    const auto end = std::min(end_, other.size());
+    if (other.isAllSelected() && end == end_) {
+      return;
+    }
+    bits::andBits(bits_.data(), other.bits_.data(), begin_, end);
+    updateBoundsWithin(begin_, end_);
   }
 
   /**
@@ -202,9 +205,12 @@ class SelectivityVector {
    * any keys passing should actually be inverted
    */
   void deselect(const SelectivityVector& other) {
+    if (!other.hasSelections()) {
+      return;
+    }
     bits::andWithNegatedBits(
         bits_.data(), other.bits_.data(), begin_, std::min(end_, other.size()));
-    updateBounds();
+    updateBoundsWithin(begin_, end_);
   }
 
   void deselect(const uint64_t* bits, int32_t begin, int32_t end) {
@@ -213,7 +219,7 @@ class SelectivityVector {
         reinterpret_cast<const uint64_t*>(bits),
         std::max<int32_t>(begin_, begin),
         std::min<int32_t>(end_, end));
-    updateBounds();
+    updateBoundsWithin(begin_, end_);
   }
 
   void deselectNulls(const uint64_t* bits, int32_t begin, int32_t end) {
@@ -222,7 +228,7 @@ class SelectivityVector {
         reinterpret_cast<const uint64_t*>(bits),
         std::max<int32_t>(begin_, begin),
         std::min<int32_t>(end_, end));
-    updateBounds();
+    updateBoundsWithin(begin_, end_);
   }
 
   void deselectNonNulls(const uint64_t* bits, int32_t begin, int32_t end) {
@@ -231,7 +237,7 @@ class SelectivityVector {
         reinterpret_cast<const uint64_t*>(bits),
         std::max<int32_t>(begin_, begin),
         std::min<int32_t>(end_, end));
-    updateBounds();
+    updateBoundsWithin(begin_, end_);
   }
 
   /// Clear null bits in 'nulls' for active rows.
@@ -289,17 +295,7 @@ class SelectivityVector {
    * index (noting that the range in between may contain not selected indices).
    */
   void updateBounds() {
-    begin_ = bits::findFirstBit(bits_.data(), 0, size_);
-    if (begin_ == -1) {
-      begin_ = 0;
-      end_ = 0;
-      VELOX_SUPPRESS_STRINGOP_OVERFLOW_WARNING
-      allSelected_ = false;
-      VELOX_UNSUPPRESS_STRINGOP_OVERFLOW_WARNING
-      return;
-    }
-    end_ = bits::findLastBit(bits_.data(), begin_, size_) + 1;
-    allSelected_.reset();
+    updateBoundsWithin(0, size_);
   }
 
   bool isAllSelected() const {
@@ -391,6 +387,23 @@ class SelectivityVector {
   // One past the last selected value, if there are any selected.
   vector_size_t end_ = 0;
 
+  // Same as updateBounds() when no bit outside of [begin, end) is set. Used
+  // after the operations that only clear bits, so that the bits outside of the
+  // previous bounds are not scanned again.
+  void updateBoundsWithin(vector_size_t begin, vector_size_t end) {
+    begin_ = bits::findFirstBit(bits_.data(), begin, end);
+    if (begin_ == -1) {
+      begin_ = 0;
+      end_ = 0;
+      VELOX_SUPPRESS_STRINGOP_OVERFLOW_WARNING
+      allSelected_ = false;
+      VELOX_UNSUPPRESS_STRINGOP_OVERFLOW_WARNING
+      return;
+    }
+    end_ = bits::findLastBit(bits_.data(), begin_, end) + 1;
+    allSelected_.reset();
+  }
+
   mutable std::optional<bool> allSelected_;
 
   friend class SelectivityIterator;
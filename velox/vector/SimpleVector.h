@@ -327,14 +327,7 @@ class SimpleVector : public BaseVector {
       return asciiInfo.isAllAscii();
     }
     ensureIsAsciiCapacity();
-    bool isAllAscii = true;
-    rows.applyToSelected([&](auto row) {
-      if (!isNullAt(row)) {
-        auto string = valueAt(row);
-        isAllAscii &=
-            functions::stringCore::isAscii(string.data(), string.size());
-      }
-    });
+    const bool isAllAscii = computeIsAllAscii(rows);
 
     // Set isAllAscii flag, it will unset if we encounter any utf.
     auto wlockedAsciiComputedRows = asciiInfo.writeLockedAsciiComputedRows();
@@ -450,6 +443,22 @@ class SimpleVector : public BaseVector {
   }
 
  protected:
+  /// Returns true if the non-null values of 'rows' are all ASCII. Used only
+  /// if T is StringView.
+  virtual bool computeIsAllAscii(const SelectivityVector& rows) const {
+    bool isAllAscii = true;
+    if constexpr (std::is_same_v<T, StringView>) {
+      rows.applyToSelected([&](auto row) {
+        if (!isNullAt(row)) {
+          auto string = valueAt(row);
+          isAllAscii &=
+              functions::stringCore::isAscii(string.data(), string.size());
+        }
+      });
+    }
+    return isAllAscii;
+  }
+
   template <typename U = T>
   typename std::enable_if_t<std::is_same_v<U, StringView>, void>
   ensureIsAsciiCapacity() {
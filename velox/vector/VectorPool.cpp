@@ -20,7 +20,7 @@ namespace facebook::velox {
 namespace {
 
 /// Checks if specified type is supported and returns an index of the
-/// corresponding TypePool cache in VectorPool::vectors_ array. Return -1 if
+/// corresponding TypePool cache in VectorPool::Cache::vectors. Return -1 if
 /// type is not supported, i.e. not a built-in singleton type.
 FOLLY_ALWAYS_INLINE int32_t toCacheIndex(const TypePtr& type) {
   static constexpr int32_t kNumCachedVectorTypes =
@@ -47,13 +47,46 @@ FOLLY_ALWAYS_INLINE int32_t toCacheIndex(const TypePtr& type) {
 
   return -1;
 }
+
+bool isComplexType(const TypePtr& type) {
+  switch (type->kind()) {
+    case TypeKind::ARRAY:
+    case TypeKind::MAP:
+    case TypeKind::ROW:
+      return true;
+    default:
+      return false;
+  }
+}
 } // namespace
 
+VectorPool::VectorPool(
+    memory::MemoryPool* pool,
+    std::shared_ptr<Cache> cache)
+    : pool_{pool}, cache_{cache != nullptr ? std::move(cache) : makeCache()} {}
+
+// static
+std::shared_ptr<VectorPool::Cache> VectorPool::makeCache() {
+  return std::make_shared<Cache>();
+}
+
 VectorPtr VectorPool::get(const TypePtr& type, vector_size_t size) {
-  auto cacheIndex = toCacheIndex(type);
-  if (cacheIndex >= 0 && size <= kMaxRecycleSize) {
-    return vectors_[cacheIndex].pop(type, size, *pool_);
+  if (size <= kMaxRecycleSize) {
+    TypePool* typePool{nullptr};
+    const auto cacheIndex = toCacheIndex(type);
+    if (cacheIndex >= 0) {
+      typePool = &cache_->vectors[cacheIndex];
+    } else if (isComplexType(type)) {
+      typePool = complexTypePool(type, false);
+    }
+    if (typePool != nullptr) {
+      if (auto vector = typePool->pop(size)) {
+        ++stats_.numHits;
+        return vector;
+      }
+    }
   }
+  ++stats_.numMisses;
   return BaseVector::create(type, size, pool_);
 }
 
@@ -65,11 +98,34 @@ bool VectorPool::release(VectorPtr& vector) {
     return false;
   }
 
-  auto cacheIndex = toCacheIndex(vector->type());
-  if (cacheIndex < 0) {
+  const auto cacheIndex = toCacheIndex(vector->type());
+  if (cacheIndex >= 0) {
+    return cache_->vectors[cacheIndex].maybePushBack(vector);
+  }
+  if (!isComplexType(vector->type())) {
+    return false;
+  }
+  auto* typePool = complexTypePool(vector->type(), true);
+  if (typePool == nullptr) {
     return false;
   }
-  return vectors_[cacheIndex].maybePushBack(vector);
+  return typePool->maybePushBack(vector);
+}
+
+VectorPool::TypePool* VectorPool::complexTypePool(
+    const TypePtr& type,
+    bool add) {
+  auto& complexVectors = cache_->complexVectors;
+  for (auto& [cachedType, typePool] : complexVectors) {
+    if (cachedType == type || *cachedType == *type) {
+      return &typePool;
+    }
+  }
+  if (!add || complexVectors.size() >= kMaxComplexTypes) {
+    return nullptr;
+  }
+  complexVectors.emplace_back(type, TypePool{});
+  return &complexVectors.back().second;
 }
 
 size_t VectorPool::release(std::vector<VectorPtr>& vectors) {
@@ -85,53 +141,67 @@ size_t VectorPool::release(std::vector<VectorPtr>& vectors) {
 }
 
 void VectorPool::clear() {
-  for (auto& vectorPool : vectors_) {
+  for (auto& vectorPool : cache_->vectors) {
     vectorPool.clear();
   }
+  cache_->complexVectors.clear();
 }
 
 bool VectorPool::TypePool::maybePushBack(VectorPtr& vector) {
-  // Check that this is a Flat Vector with an initialized, unique, and mutable
-  // values Buffer and an uninitialized or unique and mutable nulls Buffer.
-  if (!vector->isWritable() || !vector->isFlatEncoding() || !vector->values()) {
-    return false;
-  }
   if (size >= kNumPerType) {
     return false;
   }
-
-  vector->prepareForReuse();
+  if (vector->isFlatEncoding()) {
+    // Check that this is a Flat Vector with an initialized, unique, and
+    // mutable values Buffer and an uninitialized or unique and mutable nulls
+    // Buffer.
+    if (!vector->isWritable() || !vector->values()) {
+      return false;
+    }
+    vector->prepareForReuse();
+  } else {
+    // An ARRAY, MAP or ROW vector with unique and mutable buffers and
+    // recursively singly-referenced children. The children are emptied and
+    // keep their buffers. The size is reset so that pop() resizes the children
+    // and sets the rows not null.
+    const auto encoding = vector->encoding();
+    if ((encoding != VectorEncoding::Simple::ARRAY &&
+         encoding != VectorEncoding::Simple::MAP &&
+         encoding != VectorEncoding::Simple::ROW) ||
+        !vector->isWritable()) {
+      return false;
+    }
+    vector->prepareForReuse();
+    vector->resize(0);
+  }
   vectors[size++] = std::move(vector);
   return true;
 }
 
-VectorPtr VectorPool::TypePool::pop(
-    const TypePtr& type,
-    vector_size_t vectorSize,
-    memory::MemoryPool& pool) {
-  if (size) {
-    auto result = std::move(vectors[--size]);
-    if (UNLIKELY(result->rawNulls() != nullptr)) {
-      // This is a recyclable vector, no need to check uniqueness.
-      simd::memset(
-          const_cast<uint64_t*>(result->rawNulls()),
-          bits::kNotNullByte,
-          bits::roundUp(std::min<int32_t>(vectorSize, result->size()), 64) / 8);
-    }
-    if (UNLIKELY(
-            result->typeKind() == TypeKind::VARCHAR ||
-            result->typeKind() == TypeKind::VARBINARY)) {
-      simd::memset(
-          const_cast<void*>(result->valuesAsVoid()),
-          0,
-          std::min<int32_t>(vectorSize, result->size()) * sizeof(StringView));
-    }
-    if (result->size() != vectorSize) {
-      result->resize(vectorSize);
-    }
-    return result;
+VectorPtr VectorPool::TypePool::pop(vector_size_t vectorSize) {
+  if (size == 0) {
+    return nullptr;
+  }
+  auto result = std::move(vectors[--size]);
+  if (UNLIKELY(result->rawNulls() != nullptr)) {
+    // This is a recyclable vector, no need to check uniqueness.
+    simd::memset(
+        const_cast<uint64_t*>(result->rawNulls()),
+        bits::kNotNullByte,
+        bits::roundUp(std::min<int32_t>(vectorSize, result->size()), 64) / 8);
+  }
+  if (UNLIKELY(
+          result->typeKind() == TypeKind::VARCHAR ||
+          result->typeKind() == TypeKind::VARBINARY)) {
+    simd::memset(
+        const_cast<void*>(result->valuesAsVoid()),
+        0,
+        std::min<int32_t>(vectorSize, result->size()) * sizeof(StringView));
+  }
+  if (result->size() != vectorSize) {
+    result->resize(vectorSize);
   }
-  return BaseVector::create(type, vectorSize, &pool);
+  return result;
 }
 
 void VectorPool::TypePool::clear() {
@@ -20,24 +20,50 @@
 
 namespace facebook::velox {
 
-/// A thread-level cache of pre-allocated flat vectors of different types.
+/// A thread-level cache of pre-allocated vectors of different types.
 /// Keeps up to 10 recyclable vectors of each type. A vector is
-/// recyclable if it is flat and recursively singly-referenced.
-/// Only singleton built-in types are supported. Decimal types, fixed-size array
-/// type, complex and custom types are not supported. Calling 'get' for an
-/// unsupported type already returns a newly allocated vector. Calling 'release'
+/// recyclable if it is flat, or ARRAY, MAP or ROW, and recursively
+/// singly-referenced. Recycled VARCHAR and VARBINARY vectors keep one string
+/// buffer. Flat vectors are supported for singleton built-in types. Decimal
+/// types, fixed-size array type and custom types are not supported. Vectors of
+/// complex types are cached for up to 8 distinct types. Calling 'get' for an
+/// unsupported type always returns a newly allocated vector. Calling 'release'
 /// for an unsupported type is a no-op.
+///
+/// The recycled vectors may be kept in a Cache shared by the VectorPools of
+/// the operators of one driver, so that a vector released by one operator is
+/// reused by the next one. The operators of a driver run on one thread at a
+/// time. A vector taken from a shared cache stays allocated from the memory
+/// pool of the operator that created it.
 class VectorPool {
  public:
-  explicit VectorPool(memory::MemoryPool* pool) : pool_{pool} {}
+  /// The recycled vectors. May be shared by VectorPools that are used by one
+  /// thread at a time.
+  struct Cache;
+
+  struct Stats {
+    /// Number of vectors returned by get() from the cache.
+    uint64_t numHits{0};
+    /// Number of vectors allocated by get().
+    uint64_t numMisses{0};
+  };
+
+  /// Keeps the recycled vectors in 'cache' if set, otherwise in a cache owned
+  /// by 'this'.
+  explicit VectorPool(
+      memory::MemoryPool* pool,
+      std::shared_ptr<Cache> cache = nullptr);
+
+  /// Makes a cache to share between VectorPools.
+  static std::shared_ptr<Cache> makeCache();
 
   /// Gets a possibly recycled vector of 'type and 'size'. Allocates from
-  /// 'pool_' if no pre-allocated vector or type is a complex type.
+  /// 'pool_' if no pre-allocated vector or type is not supported.
   VectorPtr get(const TypePtr& type, vector_size_t size);
 
-  /// Moves vector into 'this' if it is flat, recursively singly referenced and
-  /// there is space. The function returns true if 'vector' is not null and has
-  /// been returned back to this pool, otherwise returns false.
+  /// Moves vector into 'this' if it is recyclable and there is space. The
+  /// function returns true if 'vector' is not null and has been returned back
+  /// to this pool, otherwise returns false.
   bool release(VectorPtr& vector);
 
   size_t release(std::vector<VectorPtr>& vectors);
@@ -45,11 +71,16 @@ class VectorPool {
   /// Clears all the cached vectors.
   void clear();
 
+  const Stats& stats() const {
+    return stats_;
+  }
+
  private:
   /// Max number of elements for a vector to be recyclable. The larger
   /// the batch the less the win from recycling.
   static constexpr vector_size_t kMaxRecycleSize = 64 * 1024;
   static constexpr int32_t kNumPerType = 10;
+  static constexpr int32_t kMaxComplexTypes = 8;
 
   struct TypePool {
     int32_t size{0};
@@ -57,22 +88,31 @@ class VectorPool {
 
     bool maybePushBack(VectorPtr& vector);
 
-    VectorPtr pop(
-        const TypePtr& type,
-        vector_size_t vectorSize,
-        memory::MemoryPool& pool);
+    /// Returns a recycled vector or nullptr if there is none.
+    VectorPtr pop(vector_size_t vectorSize);
 
     /// Clears all the cached vectors.
     void clear();
   };
 
-  memory::MemoryPool* const pool_;
-
   static constexpr int32_t kNumCachedVectorTypes =
       static_cast<int32_t>(TypeKind::HUGEINT) + 1;
 
-  /// Caches of pre-allocated vectors indexed by typeKind.
-  std::array<TypePool, kNumCachedVectorTypes> vectors_;
+  // Returns the cache of complex 'type', adding one if there is space.
+  // Returns nullptr if the cache is full.
+  TypePool* complexTypePool(const TypePtr& type, bool add);
+
+  memory::MemoryPool* const pool_;
+  const std::shared_ptr<Cache> cache_;
+  Stats stats_;
+};
+
+struct VectorPool::Cache {
+  /// Caches of pre-allocated flat vectors indexed by typeKind.
+  std::array<TypePool, kNumCachedVectorTypes> vectors;
+
+  /// Caches of pre-allocated ARRAY, MAP and ROW vectors with their types.
+  std::vector<std::pair<TypePtr, TypePool>> complexVectors;
 };
 
 /// A simple vector ptr wrapper with an associated vector pool. It releases
@@ -1696,6 +1696,24 @@ VectorPtr createDictionaryVector(
       std::move(wrapped));
 }
 
+// Sets 'rawIndices' to the index of the run of each of the 'length' rows of an
+// REE array with 'numRuns' 'runEnds'.
+template <typename T>
+void setReeIndices(
+    const T* runEnds,
+    int64_t numRuns,
+    int64_t length,
+    vector_size_t* rawIndices) {
+  int64_t cursor = 0;
+  for (int64_t i = 0; i < numRuns && cursor < length; ++i) {
+    const auto runEnd = std::min<int64_t>(runEnds[i], length);
+    VELOX_CHECK_GE(runEnd, cursor, "REE run ends must be increasing.");
+    std::fill(rawIndices + cursor, rawIndices + runEnd, i);
+    cursor = runEnd;
+  }
+  VELOX_CHECK_EQ(cursor, length, "REE runs must cover all the rows.");
+}
+
 VectorPtr createVectorFromReeArray(
     memory::MemoryPool* pool,
     const ArrowSchema& arrowSchema,
@@ -1712,10 +1730,13 @@ VectorPtr createVectorFromReeArray(
 
   const auto& runEndSchema = *arrowSchema.children[0];
   auto runEndType = importFromArrowImpl(runEndSchema.format, runEndSchema);
-  VELOX_CHECK_EQ(
-      runEndType->kind(),
-      TypeKind::INTEGER,
-      "Only int32 run lengths are supported for REE arrow conversion.");
+  const auto runEndKind = runEndType->kind();
+  VELOX_CHECK(
+      runEndKind == TypeKind::SMALLINT || runEndKind == TypeKind::INTEGER ||
+          runEndKind == TypeKind::BIGINT,
+      "Only int16, int32 and int64 run ends are supported for REE arrow "
+      "conversion, got {}.",
+      runEndType->toString());
 
   // If there is more than one run, we turn it into a dictionary.
   if (values->size() > 1) {
@@ -1724,18 +1745,32 @@ VectorPtr createVectorFromReeArray(
 
     // REE runs cannot be null.
     VELOX_CHECK_EQ(runsArray.null_count, 0);
-
-    const auto* runsBuffer = static_cast<const int32_t*>(runsArray.buffers[1]);
-    VELOX_CHECK_NOT_NULL(runsBuffer);
+    VELOX_CHECK_NOT_NULL(runsArray.buffers[1]);
 
     auto indices = allocateIndices(arrowArray.length, pool);
     auto rawIndices = indices->asMutable<vector_size_t>();
-
-    size_t cursor = 0;
-    for (size_t i = 0; i < runsArray.length; ++i) {
-      while (cursor < runsBuffer[i]) {
-        rawIndices[cursor++] = i;
-      }
+    switch (runEndKind) {
+      case TypeKind::SMALLINT:
+        setReeIndices(
+            static_cast<const int16_t*>(runsArray.buffers[1]),
+            runsArray.length,
+            arrowArray.length,
+            rawIndices);
+        break;
+      case TypeKind::INTEGER:
+        setReeIndices(
+            static_cast<const int32_t*>(runsArray.buffers[1]),
+            runsArray.length,
+            arrowArray.length,
+            rawIndices);
+        break;
+      default:
+        setReeIndices(
+            static_cast<const int64_t*>(runsArray.buffers[1]),
+            runsArray.length,
+            arrowArray.length,
+            rawIndices);
+        break;
     }
     return BaseVector::wrapInDictionary(
         nullptr, indices, arrowArray.length, values);
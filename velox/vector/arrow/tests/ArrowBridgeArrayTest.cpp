@@ -1745,6 +1745,37 @@ class ArrowBridgeArrayImportTest : public ArrowBridgeArrayExportTest {
     EXPECT_EQ(decoded.valueAt<int32_t>(32), 50);
     EXPECT_EQ(decoded.valueAt<int32_t>(33), 50);
     EXPECT_EQ(decoded.valueAt<int32_t>(61), 50);
+
+    // Run ends of other widths.
+    testImportREERunEnds<arrow::Int16Builder>(arrow::int16());
+    testImportREERunEnds<arrow::Int64Builder>(arrow::int64());
+  }
+
+  template <typename TRunEndBuilder>
+  void testImportREERunEnds(
+      const std::shared_ptr<arrow::DataType>& runEndType) {
+    auto pool = arrow::default_memory_pool();
+    arrow::RunEndEncodedBuilder ree(
+        pool,
+        std::make_shared<TRunEndBuilder>(pool),
+        std::make_shared<arrow::Int64Builder>(pool),
+        run_end_encoded(runEndType, arrow::int64()));
+    ASSERT_OK(ree.AppendScalar(*arrow::MakeScalar<int64_t>(7), 3));
+    ASSERT_OK(ree.AppendScalar(*arrow::MakeScalar<int64_t>(8), 1));
+    ASSERT_OK(ree.AppendScalar(*arrow::MakeScalar<int64_t>(9), 4));
+    ASSERT_OK_AND_ASSIGN(auto array, ree.Finish());
+
+    VectorPtr vector;
+    toVeloxVector(*array, vector);
+
+    ASSERT_EQ(*vector->type(), *BIGINT());
+    EXPECT_EQ(vector->encoding(), VectorEncoding::Simple::DICTIONARY);
+    ASSERT_EQ(vector->size(), 8);
+    const std::vector<int64_t> expected{7, 7, 7, 8, 9, 9, 9, 9};
+    DecodedVector decoded(*vector);
+    for (auto i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(decoded.valueAt<int64_t>(i), expected[i]) << i;
+    }
   }
 
   void testImportFailures() {
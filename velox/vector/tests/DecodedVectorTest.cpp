@@ -19,6 +19,7 @@
 #include <gflags/gflags.h>
 #include <glog/logging.h>
 #include <gtest/gtest.h>
+#include <numeric>
 #include <optional>
 
 #include "velox/type/Variant.h"
@@ -594,6 +595,53 @@ TEST_F(DecodedVectorTest, dictionary) {
       1000, [](vector_size_t i) { return std::make_shared<int>(i % 5); });
 }
 
+TEST_F(DecodedVectorTest, sequence) {
+  const std::vector<std::optional<int64_t>> data{
+      10, 10, 10, std::nullopt, 15, 15, std::nullopt, std::nullopt, 20};
+  auto sequence = vectorMaker_.sequenceVector(data);
+  ASSERT_EQ(sequence->encoding(), VectorEncoding::Simple::SEQUENCE);
+
+  auto check = [&](const DecodedVector& decoded,
+                   const std::vector<vector_size_t>& rows,
+                   const std::vector<std::optional<int64_t>>& expected) {
+    EXPECT_FALSE(decoded.isIdentityMapping());
+    EXPECT_FALSE(decoded.isConstantMapping());
+    EXPECT_EQ(decoded.base(), sequence->valueVector().get());
+    for (auto row : rows) {
+      if (expected[row].has_value()) {
+        EXPECT_FALSE(decoded.isNullAt(row)) << row;
+        EXPECT_EQ(decoded.valueAt<int64_t>(row), expected[row].value()) << row;
+      } else {
+        EXPECT_TRUE(decoded.isNullAt(row)) << row;
+      }
+    }
+  };
+
+  std::vector<vector_size_t> allRows(data.size());
+  std::iota(allRows.begin(), allRows.end(), 0);
+  DecodedVector decoded(*sequence);
+  check(decoded, allRows, data);
+  // One base row per run.
+  EXPECT_EQ(decoded.index(0), decoded.index(2));
+  EXPECT_EQ(decoded.index(4), decoded.index(5));
+  EXPECT_NE(decoded.index(2), decoded.index(4));
+
+  SelectivityVector rows(data.size(), false);
+  rows.setValid(1, true);
+  rows.setValid(5, true);
+  rows.updateBounds();
+  decoded.decode(*sequence, rows);
+  check(decoded, {1, 5}, data);
+
+  // Dictionary over sequence.
+  auto indices = makeIndicesInReverse(data.size());
+  auto dictionary =
+      BaseVector::wrapInDictionary(nullptr, indices, data.size(), sequence);
+  std::vector<std::optional<int64_t>> reversed(data.rbegin(), data.rend());
+  decoded.decode(*dictionary);
+  check(decoded, allRows, reversed);
+}
+
 TEST_F(DecodedVectorTest, dictionaryOverLazy) {
   constexpr vector_size_t size = 1000;
   auto lazyVector = vectorMaker_.lazyFlatVector<int32_t>(
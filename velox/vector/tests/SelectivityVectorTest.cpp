@@ -188,6 +188,44 @@ TEST(SelectivityVectorTest, deselectTwice) {
   ASSERT_NO_FATAL_FAILURE(assertState(expected, vector));
 }
 
+TEST(SelectivityVectorTest, boundsAfterIntersectAndDeselect) {
+  const size_t vectorSize = 1'000;
+  SelectivityVector vector(vectorSize, false);
+  vector.setValidRange(100, 900, true);
+  vector.updateBounds();
+
+  // Intersecting with all rows keeps the selection.
+  vector.intersect(SelectivityVector(vectorSize));
+  ASSERT_EQ(vector.begin(), 100);
+  ASSERT_EQ(vector.end(), 900);
+  ASSERT_EQ(vector.countSelected(), 800);
+
+  SelectivityVector other(vectorSize);
+  other.setValidRange(0, 300, false);
+  other.setValidRange(600, vectorSize, false);
+  other.updateBounds();
+  vector.intersect(other);
+  ASSERT_EQ(vector.begin(), 300);
+  ASSERT_EQ(vector.end(), 600);
+  ASSERT_EQ(vector.countSelected(), 300);
+
+  // Deselecting nothing keeps the selection.
+  vector.deselect(SelectivityVector(vectorSize, false));
+  ASSERT_EQ(vector.countSelected(), 300);
+
+  std::vector<uint64_t> nulls(bits::nwords(vectorSize), bits::kNotNull64);
+  bits::fillBits(nulls.data(), 300, 450, bits::kNull);
+  vector.deselectNulls(nulls.data(), 0, vectorSize);
+  ASSERT_EQ(vector.begin(), 450);
+  ASSERT_EQ(vector.end(), 600);
+
+  vector.deselectNonNulls(nulls.data(), 0, vectorSize);
+  ASSERT_FALSE(vector.hasSelections());
+  ASSERT_EQ(vector.begin(), 0);
+  ASSERT_EQ(vector.end(), 0);
+  ASSERT_FALSE(vector.isAllSelected());
+}
+
 TEST(SelectivityVectorTest, setValidRange) {
   const size_t vectorSize = 1000;
   SelectivityVector vector(vectorSize);
@@ -273,6 +273,33 @@ TEST_F(SimpleVectorNonParameterizedTest, computeAscii) {
   }
 }
 
+TEST_F(SimpleVectorNonParameterizedTest, computeAsciiStringBuffers) {
+  // The values that are not inlined are checked over the string buffer, which
+  // also holds the non-ASCII value of the last row.
+  auto vector = maker_.flatVector<std::string>(
+      {"a long enough ascii value",
+       "short",
+       "another long ascii value",
+       "a long non-ascii value \u00fc"});
+  SelectivityVector asciiRows(vector->size());
+  asciiRows.setValid(3, false);
+  asciiRows.updateBounds();
+  ASSERT_TRUE(vector->computeAndSetIsAscii(asciiRows));
+
+  vector->invalidateIsAscii();
+  ASSERT_FALSE(vector->computeAndSetIsAscii(SelectivityVector(vector->size())));
+
+  // All values in the buffer are ASCII.
+  vector = maker_.flatVector<std::string>(
+      {"a long enough ascii value", "short", "another long ascii value"});
+  ASSERT_TRUE(vector->computeAndSetIsAscii(SelectivityVector(vector->size())));
+
+  // A non-ASCII inlined value.
+  vector = maker_.flatVector<std::string>(
+      {"a long enough ascii value", "\u00fc", "another long ascii value"});
+  ASSERT_FALSE(vector->computeAndSetIsAscii(SelectivityVector(vector->size())));
+}
+
 TEST_F(SimpleVectorNonParameterizedTest, isAscii) {
   for (auto encoding : kAsciiEncodings) {
     LOG(INFO) << "Running:" << encoding;
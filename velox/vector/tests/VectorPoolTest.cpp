@@ -196,4 +196,67 @@ TEST_F(VectorPoolTest, clear) {
     ASSERT_EQ(vectorPtrs[i].lock(), nullptr);
   }
 }
+
+TEST_F(VectorPoolTest, complexTypes) {
+  VectorPool vectorPool(pool());
+  const auto rowType = ROW({"a", "b"}, {BIGINT(), ARRAY(VARCHAR())});
+
+  auto vector = vectorPool.get(rowType, 1'000);
+  auto* rowVector = vector->asChecked<RowVector>();
+  rowVector->setNull(10, true);
+  auto* arrayVector = rowVector->childAt(1)->asChecked<ArrayVector>();
+  arrayVector->elements()->resize(100);
+  arrayVector->setOffsetAndSize(0, 0, 100);
+  auto* vectorPtr = vector.get();
+  ASSERT_TRUE(vectorPool.release(vector));
+
+  // A vector of an equal but different type instance is recycled.
+  const auto otherRowType = ROW({"a", "b"}, {BIGINT(), ARRAY(VARCHAR())});
+  auto recycledVector = vectorPool.get(otherRowType, 2'000);
+  ASSERT_EQ(recycledVector.get(), vectorPtr);
+  ASSERT_EQ(recycledVector->size(), 2'000);
+  ASSERT_FALSE(recycledVector->isNullAt(10));
+  rowVector = recycledVector->asChecked<RowVector>();
+  ASSERT_EQ(rowVector->childAt(0)->size(), 2'000);
+  arrayVector = rowVector->childAt(1)->asChecked<ArrayVector>();
+  ASSERT_EQ(arrayVector->size(), 2'000);
+  ASSERT_EQ(arrayVector->sizeAt(0), 0);
+  ASSERT_EQ(arrayVector->elements()->size(), 0);
+
+  // A vector with a shared child is not recycled.
+  auto child = rowVector->childAt(0);
+  ASSERT_FALSE(vectorPool.release(recycledVector));
+  child.reset();
+  ASSERT_TRUE(vectorPool.release(recycledVector));
+
+  // Vectors go back to the pool of their type.
+  auto mapVector = vectorPool.get(MAP(BIGINT(), DOUBLE()), 100);
+  ASSERT_TRUE(vectorPool.release(mapVector));
+  ASSERT_EQ(vectorPool.get(rowType, 100).get(), vectorPtr);
+  ASSERT_NE(vectorPool.get(rowType, 100).get(), vectorPtr);
+}
+
+TEST_F(VectorPoolTest, sharedCache) {
+  auto cache = VectorPool::makeCache();
+  auto otherPool = rootPool_->addLeafChild("sharedCache");
+  VectorPool vectorPool(pool(), cache);
+  VectorPool otherVectorPool(otherPool.get(), cache);
+
+  auto vector = vectorPool.get(VARCHAR(), 1'000);
+  auto* vectorPtr = vector.get();
+  ASSERT_TRUE(vectorPool.release(vector));
+
+  // The vector released through one pool is served by the other.
+  auto recycledVector = otherVectorPool.get(VARCHAR(), 1'000);
+  ASSERT_EQ(recycledVector.get(), vectorPtr);
+  ASSERT_EQ(recycledVector->pool(), pool());
+  ASSERT_EQ(vectorPool.stats().numHits, 0);
+  ASSERT_EQ(vectorPool.stats().numMisses, 1);
+  ASSERT_EQ(otherVectorPool.stats().numHits, 1);
+  ASSERT_EQ(otherVectorPool.stats().numMisses, 0);
+
+  // A vector of an unsupported type is a miss.
+  otherVectorPool.get(DECIMAL(10, 2), 10);
+  ASSERT_EQ(otherVectorPool.stats().numMisses, 1);
+}
 } // namespace facebook::velox::test